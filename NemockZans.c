@@ -12,6 +12,13 @@ bool pre_process_record_user(uint16_t keycode, keyrecord_t *record) {
     static uint16_t prev_keycode;
     static bool     is_pressed[UINT8_MAX];
 
+#ifdef COMBO_TRACE
+    combo_trace_press(record);
+#endif
+#ifdef CHORD_ENABLE
+    if (!process_chord(keycode, record)) return false;
+#endif
+
     // Cache previous and next input for tap-hold decisions
     if (record->event.pressed) {
         prev_keycode = next_keycode;
@@ -104,6 +111,9 @@ bool process_record_user(uint16_t keycode, keyrecord_t *record) {
     if (record->event.pressed) {
         // Store processed event for combo detection in preprocess record
         prev_event = record->event.type;
+#ifdef COMBO_TRACE
+        combo_trace_record(keycode, record);
+#endif
 
         if (!process_autocorrect(keycode, record) || !process_caps_unlock(keycode, record)) return false;
 
@@ -5,6 +5,9 @@
 #include QMK_KEYBOARD_H
 
 #include "autocorrect.h"
+#ifdef CHORD_ENABLE
+#   include "chords.h"
+#endif
 #ifdef COMBO_ENABLE
 #   include "combos.h"
 #endif
@@ -19,13 +19,19 @@
 
 #ifdef SPLIT_KEYBOARD
 #   define EE_HANDS
+#   ifdef RGB_MATRIX_ENABLE
+#       define SPLIT_TRANSACTION_IDS_USER RGB_EVENT_SYNC // Key events and effect seed in rgb_matrix.c
+#   endif
 #endif
 
 #ifdef COMBO_ENABLE
 #   define COMBO_TERM 30
 #   define EXTRA_SHORT_COMBOS
 #   define COMBO_SHOULD_TRIGGER
-#   define COMBO_ONLY_FROM_LAYER 0
+#   define COMBO_ONLY_FROM_LAYER CMB
+#   define COMBO_TERM_PER_COMBO
+//#   define COMBO_TERM_LEARN
+//#   define COMBO_TRACE // Needs CONSOLE_ENABLE
 #endif
 
 #ifdef MOUSEKEY_ENABLE
@@ -60,9 +66,15 @@
 #   define RGB_MATRIX_DEFAULT_MODE RGB_MATRIX_CUSTOM_CANDY_TAP
 #   define DEF_MODE RGB_MATRIX_DEFAULT_MODE
 #   define CMK_MODE RGB_MATRIX_CUSTOM_CANDY_RAIN
+#   define RGB_MATRIX_LED_FLUSH_LIMIT rgb_flush_limit // Frame interval set in rgb_matrix.c
+//#   define RGB_GOVERNOR_STATS // Needs CONSOLE_ENABLE
 #endif
 
 // Layout macros
 #ifndef __ASSEMBLER__
 #   include "layout.h"
+#   ifdef RGB_MATRIX_ENABLE
+#       include <stdint.h>
+extern uint8_t rgb_flush_limit;
+#   endif
 #endif
\ No newline at end of file
@@ -14,8 +14,24 @@
 #   include "autocorrect_data.h"
 #endif
 
+// Case of a typed letter in bit 7 of its typo buffer byte
+#define TYPO_SHIFT 128
+
 static bool autocorrect_on = true;
 
+// Last correction that an immediate Backspace can revert. The original
+// keys are still in the typo buffer, only its first byte is overwritten.
+static struct {
+    uint16_t state;      // Leaf of the correction in the dictionary
+    uint16_t keycode;    // Key that triggered the correction, with its Shift
+    uint8_t  size;       // Buffer size before the correction, 0 when disarmed
+    uint8_t  first;      // First buffer byte before the correction
+    uint8_t  backspaces; // Typed characters replaced by the correction
+    uint8_t  sent;       // Characters sent by the correction
+} undo;
+// Leaf of a reverted correction that is skipped once
+static uint16_t suppressed;
+
 void autocorrect_toggle(void) {
     autocorrect_on = !autocorrect_on;
 }
@@ -24,12 +40,19 @@ bool process_autocorrect(uint16_t keycode, keyrecord_t* record) {
     static uint8_t typo_buffer[DICTIONARY_MAX_LENGTH] = {0};
     static uint8_t buffer_size = 0;
 
-    // Reset with non-Shift modifiers or when feature is off.
-    if (get_mods() & ~MOD_MASK_SHIFT || autocorrect_on == false) {
-        buffer_size = 0;
+    // Reset with non-Shift modifiers.
+    if (get_mods() & ~MOD_MASK_SHIFT) {
+        buffer_size = undo.size = suppressed = 0;
         return true;
     }
 
+    // Caps lock is left to the host, which also capitalizes the correction.
+    uint8_t const shifted = ((get_mods() | get_weak_mods()) & MOD_MASK_SHIFT
+#ifdef CAPS_WORD_ENABLE
+                             || is_caps_word_on()
+#endif
+                            ) ? TYPO_SHIFT : 0;
+
     // Handle modifiers and quantum keycodes.
     switch(keycode) {
         case KC_LSFT:
@@ -42,7 +65,30 @@ bool process_autocorrect(uint16_t keycode, keyrecord_t* record) {
             if (record->tap.count == 0) {
                 return true;
             }
+            keycode &= 0xff;
+    }
+
+    // Revert the last correction with a Backspace that immediately follows it.
+    if (undo.size) {
+        if ((uint8_t)keycode == KC_BSPC) {
+            typo_buffer[0] = undo.first;
+            for (uint8_t i = 0; i < undo.sent; ++i) {
+                tap_code(KC_BSPC);
+            }
+            for (uint8_t i = undo.size - undo.backspaces - 1; i < undo.size - 1; ++i) {
+                uint8_t const key = typo_buffer[i] & ~TYPO_SHIFT;
+                tap_code16(typo_buffer[i] & TYPO_SHIFT ? S(key) : key);
+            }
+            tap_code16(undo.keycode);
+
+            buffer_size = undo.size;
+            suppressed = undo.state;
+            undo.size = 0;
+            return false;
+        }
+        undo.size = 0;
     }
+    uint16_t const typed_keycode = keycode;
 
     // Handle non-alpha keycodes.
     if (!(KC_A <= (uint8_t)keycode && (uint8_t)keycode <= KC_Z)) {
@@ -51,15 +97,17 @@ bool process_autocorrect(uint16_t keycode, keyrecord_t* record) {
             keycode = KC_SPC;
         } else if ((uint8_t)keycode == KC_ENT) {
             // Reset buffer and replace Enter with Space as word boundary.
-            buffer_size = 0;
+            buffer_size = suppressed = 0;
             keycode = KC_SPC;
         } else if ((uint8_t)keycode == KC_BSPC && buffer_size > 0) {
-            // Subtract buffer for Backspace.
-            --buffer_size;
+            // Subtract buffer for Backspace, a deleted word is no longer suppressed.
+            if (--buffer_size == 0) {
+                suppressed = 0;
+            }
             return true;
         } else {
             // Reset for all other keycodes.
-            buffer_size = 0;
+            buffer_size = suppressed = 0;
             return true;
         }
     }
@@ -70,8 +118,8 @@ bool process_autocorrect(uint16_t keycode, keyrecord_t* record) {
         buffer_size = DICTIONARY_MAX_LENGTH - 1;
     }
 
-    // Append keycode to buffer.
-    typo_buffer[buffer_size++] = (uint8_t)keycode;
+    // Append keycode to buffer with the case of letters.
+    typo_buffer[buffer_size++] = (uint8_t)keycode | (keycode == KC_SPC ? 0 : shifted);
     // Return if buffer is smaller than the shortest word.
     if (buffer_size < DICTIONARY_MIN_LENGTH) {
         return true;
@@ -81,9 +129,10 @@ bool process_autocorrect(uint16_t keycode, keyrecord_t* record) {
     uint16_t state = 0;
     uint8_t code = pgm_read_byte(dictionary + state);
     for (int8_t i = buffer_size - 1; i >= 0; --i) {
+        uint8_t const key = typo_buffer[i] & ~TYPO_SHIFT;
         if (code & 64) {  // Check for match in node with multiple children.
             code &= 63;
-            for (; code != typo_buffer[i]; code = pgm_read_byte(dictionary + (state += 3))) {
+            for (; code != key; code = pgm_read_byte(dictionary + (state += 3))) {
                 if (!code) {
                     return true;
                 }
@@ -91,7 +140,7 @@ bool process_autocorrect(uint16_t keycode, keyrecord_t* record) {
             // Follow link to child node.
             state = (pgm_read_byte(dictionary + state + 1) | pgm_read_byte(dictionary + state + 2) << 8);
         // Otherwise check for match in node with a single child.
-        } else if (code != typo_buffer[i]) {
+        } else if (code != key) {
             return true;
         } else if (!(code = pgm_read_byte(dictionary + (++state)))) {
             ++state;
@@ -101,11 +150,54 @@ bool process_autocorrect(uint16_t keycode, keyrecord_t* record) {
         code = pgm_read_byte(dictionary + state);
 
         if (code & 128) {  // A typo was found! Apply correction.
+            // Expansions are flagged with bit 6 and stay on when corrections are toggled off.
+            if (!(code & 64) && autocorrect_on == false) {
+                return true;
+            }
+            // Skip a reverted correction once.
+            if (state == suppressed) {
+                suppressed = 0;
+                return true;
+            }
             uint8_t const backspaces = code & 63;
+            char const *correction = (char const *)(dictionary + state + 1);
+
+            // Follow the case of the first replaced letter, or write all caps
+            // when every letter of a corrected word was shifted.
+            bool const capital = typo_buffer[buffer_size - 1 - backspaces] & TYPO_SHIFT;
+            bool upper = false;
+            if (!(code & 64)) {
+                uint8_t letters = 0;
+                int8_t j = buffer_size - 1 - (keycode == KC_SPC);
+                for (upper = true; j >= 0 && typo_buffer[j] != KC_SPC; --j, ++letters) {
+                    upper &= !!(typo_buffer[j] & TYPO_SHIFT);
+                }
+                upper &= letters > 1;
+            }
+
+            // Send the correction without held modifiers.
+            uint8_t const mods = get_mods();
+            clear_mods();
+            clear_weak_mods();
             for (uint8_t i = 0; i < backspaces; ++i) {
                 tap_code(KC_BSPC);
             }
-            send_string_P((char const *)(dictionary + state + 1));
+            for (char const *c = correction; pgm_read_byte(c); ++c) {
+                char ch = pgm_read_byte(c);
+                if ((upper || (capital && c == correction)) && 'a' <= ch && ch <= 'z') {
+                    ch -= 'a' - 'A';
+                }
+                send_char(ch);
+            }
+            set_mods(mods);
+
+            // Record the correction for undo.
+            undo.state      = state;
+            undo.keycode    = shifted ? S(typed_keycode) : typed_keycode;
+            undo.size       = buffer_size;
+            undo.first      = typo_buffer[0];
+            undo.backspaces = backspaces;
+            undo.sent       = strlen_P(correction) + (keycode == KC_SPC);
 
             if (keycode == KC_SPC) {
                 typo_buffer[0] = KC_SPC;
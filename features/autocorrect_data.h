@@ -1,6 +1,7 @@
-/* Generated dictionary code (3074 entries):
+/* Generated dictionary code (3082 entries):
 :addin:             -> adding
 :adn:               -> and
+:afaik:             => as far as I know
 :aganist            -> against
 :agian              -> again
 :agin               -> again
@@ -16,6 +17,8 @@
 :atthe              -> at the
 :bouyant            -> buoyant
 :boyant             -> buoyant
+:brb:               => be right back
+:btw:               => by the way
 :choses             -> chooses
 :dum:               -> dumb
 :efel               -> evil
@@ -37,6 +40,8 @@
 :hten:              -> then
 :htere              -> there
 :hting              -> thing
+:iirc:              => if I recall correctly
+:imo:               => in my opinion
 :inot:              -> into
 :iwll               -> will
 :iwth               -> with
@@ -55,6 +60,7 @@
 :olther             -> other
 :ommitted           -> omitted
 :ommitting          -> omitting
+:omw:               => on my way
 :onyl:              -> only
 :oponent            -> opponent
 :opose              -> oppose
@@ -91,6 +97,7 @@
 :szie               -> size
 :tast:              -> taste
 :tath:              -> that
+:tbh:               => to be honest
 :teh:               -> the
 :tehy:              -> they
 :tghe:              -> the
@@ -111,6 +118,7 @@
 :tjhe:              -> the
 :tkae:              -> take
 :tothe              -> to the
+:ttyl:              => talk to you later
 :ture               -> true
 :turth              -> truth
 :tust:              -> trust
@@ -3078,2665 +3086,2674 @@ youself             -> yourself
 #define DICTIONARY_MIN_LENGTH  4  // ":gt:"
 #define DICTIONARY_MAX_LENGTH 19  // "differentiatiations"
 
-static const uint8_t dictionary[49370] PROGMEM = {108, 73, 0, 4, 83, 7, 6, 47,
-  9, 7, 24, 13, 8, 198, 29, 9, 14, 66, 10, 164, 66, 11, 109, 77, 12, 153, 79,
-  14, 181, 79, 15, 75, 80, 16, 126, 90, 17, 113, 93, 18, 31, 112, 19, 174, 112,
-  21, 26, 113, 22, 56, 124, 23, 64, 147, 24, 126, 165, 25, 230, 165, 26, 47,
-  166, 27, 137, 166, 28, 169, 166, 29, 207, 192, 0, 68, 134, 0, 6, 191, 0, 7,
-  238, 0, 8, 70, 1, 9, 86, 2, 10, 95, 2, 11, 121, 2, 12, 177, 2, 14, 221, 2, 15,
-  245, 2, 16, 103, 3, 17, 185, 3, 18, 106, 4, 19, 225, 4, 21, 15, 5, 22, 94, 5,
-  23, 14, 6, 24, 228, 6, 26, 253, 6, 28, 21, 7, 0, 72, 150, 0, 10, 158, 0, 15,
-  168, 0, 17, 175, 0, 23, 183, 0, 0, 25, 11, 0, 131, 97, 118, 101, 0, 16, 4, 21,
-  19, 0, 131, 103, 109, 97, 0, 8, 21, 0, 130, 97, 108, 0, 11, 23, 44, 0, 130,
-  97, 110, 0, 11, 23, 44, 0, 130, 97, 116, 0, 12, 0, 69, 200, 0, 15, 210, 0, 0,
-  24, 19, 8, 21, 0, 130, 108, 105, 99, 0, 69, 217, 0, 24, 228, 0, 0, 19, 8, 21,
-  0, 132, 117, 98, 108, 105, 99, 0, 19, 8, 21, 0, 131, 98, 108, 105, 99, 0, 68,
-  1, 1, 7, 9, 1, 8, 14, 1, 12, 38, 1, 22, 53, 1, 24, 62, 1, 0, 5, 21, 18, 9, 0,
-  128, 101, 0, 17, 4, 0, 129, 0, 68, 21, 1, 8, 28, 1, 0, 7, 0, 131, 101, 97,
-  100, 0, 6, 24, 22, 0, 131, 99, 101, 101, 100, 0, 21, 4, 11, 6, 6, 4, 22, 28,
-  15, 18, 19, 0, 128, 101, 0, 8, 24, 44, 0, 131, 115, 101, 100, 0, 15, 6, 17,
-  12, 0, 128, 101, 0, 68, 104, 1, 6, 137, 1, 7, 146, 1, 11, 157, 1, 13, 189, 1,
-  15, 196, 1, 17, 211, 1, 18, 219, 1, 21, 239, 1, 23, 28, 2, 25, 78, 2, 0, 78,
-  114, 1, 16, 122, 1, 25, 130, 1, 0, 23, 44, 0, 131, 97, 107, 101, 0, 22, 44, 0,
-  131, 97, 109, 101, 0, 11, 0, 131, 97, 118, 101, 0, 12, 23, 21, 4, 0, 129, 108,
-  101, 0, 12, 22, 8, 7, 0, 132, 99, 105, 100, 101, 0, 74, 167, 1, 13, 174, 1,
-  23, 181, 1, 0, 23, 44, 0, 131, 104, 101, 0, 23, 44, 0, 131, 104, 101, 0, 44,
-  8, 11, 23, 44, 0, 132, 0, 23, 44, 0, 130, 104, 101, 0, 5, 16, 8, 22, 22, 8,
-  21, 0, 134, 101, 109, 98, 108, 101, 0, 11, 23, 44, 0, 130, 101, 110, 0, 80,
-  226, 1, 21, 234, 1, 0, 22, 44, 0, 131, 111, 109, 101, 0, 8, 11, 0, 129, 0, 71,
-  252, 1, 8, 4, 2, 10, 14, 2, 28, 20, 2, 0, 17, 24, 44, 0, 130, 101, 114, 0, 23,
-  11, 0, 133, 116, 104, 101, 114, 101, 0, 4, 44, 0, 128, 101, 0, 25, 44, 0, 131,
-  101, 114, 121, 0, 68, 38, 2, 12, 55, 2, 23, 69, 2, 0, 12, 25, 8, 21, 5, 4, 0,
-  135, 98, 114, 101, 118, 105, 97, 116, 101, 0, 21, 26, 28, 19, 18, 6, 0, 133,
-  114, 105, 103, 104, 116, 0, 12, 16, 16, 18, 6, 0, 128, 101, 0, 12, 17, 14, 0,
-  130, 102, 101, 0, 12, 21, 8, 11, 22, 0, 128, 102, 0, 17, 0, 72, 104, 2, 12,
-  111, 2, 0, 5, 0, 130, 105, 110, 103, 0, 16, 16, 18, 6, 0, 132, 105, 110, 103,
-  0, 72, 131, 2, 12, 138, 2, 23, 147, 2, 0, 23, 44, 0, 130, 104, 101, 0, 23, 26,
-  44, 0, 131, 105, 116, 104, 0, 108, 157, 2, 4, 160, 2, 21, 168, 2, 0, 128, 101,
-  0, 23, 44, 0, 131, 104, 97, 116, 0, 24, 18, 22, 44, 0, 131, 116, 104, 0, 79,
-  190, 2, 21, 199, 2, 22, 208, 2, 23, 216, 2, 0, 5, 24, 19, 8, 21, 0, 128, 99,
-  0, 8, 11, 23, 44, 0, 130, 105, 114, 0, 11, 23, 44, 0, 130, 105, 115, 0, 12,
-  10, 0, 129, 0, 72, 228, 2, 18, 236, 2, 0, 8, 17, 22, 0, 130, 97, 107, 0, 21,
-  26, 44, 0, 131, 111, 114, 107, 0, 68, 2, 3, 15, 14, 3, 24, 79, 3, 28, 95, 3,
-  0, 23, 24, 21, 12, 25, 0, 132, 116, 117, 97, 108, 0, 72, 24, 3, 18, 42, 3, 24,
-  65, 3, 0, 70, 31, 3, 19, 36, 3, 0, 27, 8, 0, 129, 0, 27, 8, 44, 0, 129, 0, 70,
-  49, 3, 21, 58, 3, 0, 22, 44, 0, 131, 114, 111, 108, 108, 0, 23, 17, 18, 6, 0,
-  129, 0, 9, 28, 23, 24, 4, 8, 5, 0, 133, 105, 102, 117, 108, 0, 9, 22, 8, 6,
-  24, 22, 0, 133, 99, 101, 115, 115, 102, 117, 108, 0, 17, 18, 44, 0, 130, 108,
-  121, 0, 72, 116, 3, 18, 137, 3, 21, 146, 3, 24, 155, 3, 0, 76, 123, 3, 18,
-  130, 3, 0, 23, 44, 0, 130, 109, 101, 0, 22, 44, 0, 130, 109, 101, 0, 8, 19,
-  44, 0, 131, 111, 101, 109, 0, 8, 23, 17, 12, 0, 129, 105, 109, 0, 70, 165, 3,
-  7, 174, 3, 15, 179, 3, 0, 6, 4, 25, 0, 131, 117, 117, 109, 0, 44, 0, 128, 98,
-  0, 18, 6, 0, 128, 110, 0, 68, 210, 3, 7, 238, 3, 8, 245, 3, 10, 255, 3, 11,
-  13, 4, 12, 33, 4, 18, 57, 4, 26, 96, 4, 0, 76, 217, 3, 22, 229, 3, 0, 15, 5,
-  24, 19, 8, 21, 0, 130, 99, 97, 110, 0, 21, 8, 19, 44, 0, 130, 111, 110, 0, 4,
-  44, 0, 130, 110, 100, 0, 23, 11, 44, 0, 132, 116, 104, 101, 110, 0, 12, 21, 8,
-  25, 18, 22, 44, 0, 131, 101, 105, 103, 110, 0, 68, 20, 4, 23, 27, 4, 0, 23, 0,
-  131, 104, 97, 110, 0, 44, 0, 129, 101, 110, 0, 71, 40, 4, 15, 47, 4, 0, 7, 4,
-  44, 0, 128, 103, 0, 15, 12, 25, 44, 0, 130, 97, 105, 110, 0, 76, 67, 4, 17,
-  79, 4, 26, 88, 4, 0, 23, 24, 23, 44, 0, 132, 105, 116, 105, 111, 110, 0, 26,
-  14, 0, 132, 110, 111, 119, 110, 0, 17, 14, 0, 131, 111, 119, 110, 0, 17, 18,
-  14, 0, 132, 110, 111, 119, 110, 0, 75, 134, 4, 12, 143, 4, 15, 155, 4, 16,
-  164, 4, 17, 170, 4, 19, 178, 4, 23, 186, 4, 24, 211, 4, 26, 218, 4, 0, 23, 15,
-  4, 0, 128, 117, 103, 104, 0, 22, 12, 25, 12, 7, 5, 24, 22, 0, 128, 110, 0, 22,
-  4, 44, 0, 131, 108, 115, 111, 0, 6, 0, 130, 111, 109, 0, 26, 14, 0, 131, 110,
-  111, 119, 0, 23, 22, 44, 0, 130, 111, 112, 0, 17, 0, 108, 195, 4, 8, 199, 4,
-  0, 130, 111, 116, 0, 16, 18, 16, 0, 134, 101, 109, 101, 110, 116, 111, 0, 28,
-  44, 0, 130, 111, 117, 0, 17, 14, 0, 130, 111, 119, 0, 79, 238, 4, 16, 247, 4,
-  18, 255, 4, 24, 8, 5, 0, 4, 11, 44, 0, 131, 101, 108, 112, 0, 8, 23, 23, 4, 0,
-  128, 116, 0, 24, 22, 44, 0, 131, 111, 117, 112, 0, 18, 21, 23, 0, 128, 101, 0,
-  68, 31, 5, 8, 45, 5, 18, 70, 5, 23, 79, 5, 28, 86, 5, 0, 17, 18, 12, 23, 24,
-  15, 18, 25, 8, 21, 0, 128, 121, 0, 75, 52, 5, 28, 62, 5, 0, 10, 24, 4, 7, 0,
-  130, 116, 101, 114, 0, 25, 44, 0, 131, 101, 114, 121, 0, 23, 24, 4, 0, 130,
-  104, 111, 114, 0, 22, 4, 15, 44, 0, 129, 0, 8, 25, 44, 0, 130, 114, 121, 0,
-  68, 116, 5, 8, 148, 5, 11, 204, 5, 12, 213, 5, 15, 236, 5, 22, 247, 5, 24, 2,
-  6, 0, 79, 126, 5, 21, 131, 5, 28, 140, 5, 0, 6, 0, 128, 115, 0, 21, 4, 11, 0,
-  131, 97, 115, 115, 0, 22, 44, 0, 131, 97, 121, 115, 0, 70, 161, 5, 21, 168, 5,
-  22, 189, 5, 24, 198, 5, 0, 18, 21, 19, 0, 128, 115, 0, 7, 0, 68, 177, 5, 7,
-  184, 5, 0, 131, 100, 114, 101, 115, 115, 0, 4, 0, 128, 115, 0, 18, 18, 15, 0,
-  132, 115, 101, 115, 0, 44, 0, 130, 115, 101, 0, 12, 23, 44, 0, 131, 104, 105,
-  115, 0, 23, 0, 75, 222, 5, 17, 228, 5, 0, 132, 116, 104, 105, 115, 0, 8, 12,
-  6, 22, 0, 128, 116, 0, 15, 18, 21, 23, 17, 18, 6, 0, 130, 115, 0, 8, 6, 24,
-  22, 0, 131, 99, 101, 115, 115, 0, 4, 23, 23, 22, 44, 0, 132, 97, 116, 117,
-  115, 0, 68, 39, 6, 10, 79, 6, 11, 85, 6, 12, 115, 6, 17, 162, 6, 18, 174, 6,
-  22, 197, 6, 27, 219, 6, 0, 21, 0, 72, 48, 6, 23, 71, 6, 0, 74, 55, 6, 19, 61,
-  6, 0, 132, 114, 101, 97, 116, 0, 8, 22, 0, 132, 97, 114, 97, 116, 101, 0, 22,
-  44, 0, 131, 97, 114, 116, 0, 44, 0, 129, 105, 116, 0, 68, 92, 6, 23, 111, 6,
-  0, 87, 99, 6, 26, 104, 6, 0, 131, 104, 97, 116, 0, 44, 0, 131, 104, 97, 116,
-  0, 129, 97, 116, 0, 76, 125, 6, 21, 130, 6, 22, 139, 6, 0, 10, 0, 130, 116, 0,
-  6, 18, 19, 28, 11, 0, 128, 101, 0, 82, 146, 6, 22, 156, 6, 0, 19, 16, 18, 6,
-  8, 7, 0, 130, 101, 0, 4, 0, 129, 115, 116, 0, 4, 7, 12, 6, 6, 4, 0, 131, 101,
-  110, 116, 0, 79, 181, 6, 17, 190, 6, 0, 4, 44, 0, 131, 32, 108, 111, 116, 0,
-  12, 44, 0, 130, 116, 111, 0, 68, 204, 6, 24, 210, 6, 0, 23, 44, 0, 128, 101,
-  0, 23, 44, 0, 131, 114, 117, 115, 116, 0, 17, 8, 0, 132, 110, 101, 120, 116,
-  0, 82, 235, 6, 21, 243, 6, 0, 23, 28, 44, 0, 131, 111, 117, 0, 11, 23, 44, 0,
-  129, 111, 117, 103, 104, 0, 75, 4, 7, 17, 13, 7, 0, 18, 22, 44, 0, 131, 104,
-  111, 119, 0, 18, 14, 0, 131, 110, 111, 119, 0, 72, 37, 7, 11, 46, 7, 15, 55,
-  7, 18, 63, 7, 23, 73, 7, 0, 23, 11, 0, 132, 116, 104, 101, 121, 0, 8, 23, 44,
-  0, 131, 104, 101, 121, 0, 4, 8, 21, 0, 129, 108, 121, 0, 21, 23, 22, 44, 0,
-  131, 111, 114, 121, 0, 12, 21, 4, 25, 0, 130, 101, 116, 121, 0, 71, 114, 7, 8,
-  131, 7, 12, 153, 7, 15, 28, 8, 16, 143, 8, 17, 156, 8, 21, 209, 8, 22, 250, 8,
-  23, 3, 9, 28, 27, 9, 0, 17, 4, 10, 18, 19, 18, 21, 19, 0, 133, 97, 103, 97,
-  110, 100, 97, 0, 78, 138, 7, 21, 145, 7, 0, 16, 0, 130, 97, 107, 101, 0, 28,
-  44, 0, 130, 101, 97, 114, 0, 71, 163, 7, 15, 202, 7, 17, 254, 7, 0, 8, 0, 80,
-  172, 7, 19, 185, 7, 0, 22, 22, 4, 16, 0, 132, 32, 109, 101, 100, 105, 97, 0,
-  18, 15, 28, 6, 17, 8, 0, 134, 99, 108, 111, 112, 101, 100, 105, 97, 0, 68,
-  209, 7, 18, 243, 7, 0, 76, 216, 7, 17, 227, 7, 0, 17, 8, 10, 0, 131, 116, 97,
-  108, 105, 97, 0, 8, 11, 19, 4, 21, 4, 19, 0, 132, 114, 110, 97, 108, 105, 97,
-  0, 10, 4, 16, 0, 131, 110, 111, 108, 105, 97, 0, 72, 5, 8, 17, 15, 8, 0, 15,
-  15, 12, 16, 0, 129, 110, 105, 97, 0, 8, 15, 12, 16, 0, 132, 108, 101, 110,
-  110, 105, 97, 0, 69, 41, 8, 12, 53, 8, 22, 63, 8, 24, 72, 8, 0, 4, 17, 24, 6,
-  17, 12, 0, 129, 117, 108, 97, 0, 21, 21, 8, 24, 10, 0, 128, 108, 97, 0, 24, 9,
-  8, 21, 0, 129, 97, 108, 0, 81, 79, 8, 22, 93, 8, 0, 12, 22, 17, 8, 19, 0, 133,
-  105, 110, 115, 117, 108, 97, 0, 76, 100, 8, 17, 129, 8, 0, 17, 0, 72, 109, 8,
-  17, 118, 8, 0, 19, 0, 131, 110, 115, 117, 108, 97, 0, 8, 19, 0, 133, 105, 110,
-  115, 117, 108, 97, 0, 12, 17, 17, 8, 19, 0, 134, 105, 110, 115, 117, 108, 97,
-  0, 28, 22, 28, 11, 19, 16, 8, 0, 130, 101, 109, 97, 0, 8, 0, 68, 165, 8, 16,
-  174, 8, 0, 17, 17, 12, 15, 0, 129, 97, 110, 0, 81, 181, 8, 18, 193, 8, 0, 18,
-  17, 8, 11, 19, 0, 132, 109, 101, 110, 97, 0, 10, 18, 15, 18, 21, 19, 0, 134,
-  101, 103, 111, 109, 101, 110, 97, 0, 71, 216, 8, 8, 231, 8, 0, 8, 11, 18, 23,
-  6, 18, 0, 133, 97, 104, 101, 100, 114, 97, 0, 79, 238, 8, 28, 244, 8, 0, 6, 0,
-  129, 97, 114, 0, 44, 0, 129, 97, 114, 0, 21, 8, 28, 0, 130, 97, 114, 115, 0,
-  85, 10, 9, 24, 19, 9, 0, 18, 19, 21, 12, 4, 0, 128, 115, 0, 18, 5, 4, 0, 128,
-  32, 97, 0, 71, 34, 9, 26, 41, 9, 0, 18, 23, 0, 129, 97, 121, 0, 4, 0, 129, 97,
-  121, 0, 68, 66, 9, 9, 77, 9, 11, 89, 9, 12, 135, 9, 14, 253, 12, 23, 17, 13,
-  0, 12, 11, 6, 21, 4, 0, 130, 97, 105, 99, 0, 12, 23, 17, 8, 12, 6, 22, 0, 128,
-  105, 99, 0, 68, 99, 9, 12, 105, 9, 23, 127, 9, 0, 8, 0, 129, 99, 104, 0, 75,
-  112, 9, 26, 118, 9, 0, 26, 0, 129, 99, 104, 0, 11, 0, 132, 119, 104, 105, 99,
-  104, 0, 12, 26, 22, 0, 129, 99, 104, 0, 69, 178, 9, 6, 193, 9, 7, 205, 9, 9,
-  217, 9, 10, 1, 10, 11, 38, 10, 15, 79, 10, 16, 139, 10, 17, 229, 10, 19, 242,
-  10, 21, 24, 11, 22, 57, 11, 23, 66, 11, 28, 240, 12, 0, 18, 19, 18, 21, 7, 28,
-  11, 0, 131, 104, 111, 98, 105, 99, 0, 22, 28, 19, 0, 132, 115, 121, 99, 104,
-  105, 99, 0, 8, 16, 16, 18, 6, 0, 132, 101, 100, 105, 99, 0, 68, 227, 9, 6,
-  235, 9, 23, 245, 9, 0, 21, 23, 0, 129, 102, 105, 99, 0, 8, 19, 22, 0, 130,
-  105, 102, 105, 99, 0, 17, 8, 12, 6, 22, 0, 130, 105, 102, 105, 99, 0, 72, 8,
-  10, 21, 23, 10, 0, 23, 21, 4, 23, 22, 0, 134, 114, 97, 116, 101, 103, 105, 99,
-  0, 24, 15, 4, 23, 8, 16, 0, 132, 108, 117, 114, 103, 105, 99, 0, 83, 45, 10,
-  28, 70, 10, 0, 4, 21, 10, 18, 12, 5, 18, 11, 23, 24, 4, 0, 139, 111, 98, 105,
-  111, 103, 114, 97, 112, 104, 105, 99, 0, 22, 19, 0, 130, 99, 104, 105, 99, 0,
-  68, 89, 10, 11, 98, 10, 12, 108, 10, 0, 23, 8, 16, 0, 129, 108, 105, 99, 0,
-  23, 4, 6, 0, 130, 111, 108, 105, 99, 0, 73, 115, 10, 19, 126, 10, 0, 18, 21,
-  19, 0, 132, 108, 105, 102, 105, 99, 0, 18, 21, 7, 28, 11, 0, 131, 104, 105,
-  108, 105, 99, 0, 71, 155, 10, 8, 165, 10, 12, 197, 10, 17, 208, 10, 23, 219,
-  10, 0, 4, 6, 4, 0, 130, 101, 109, 105, 99, 0, 7, 0, 68, 174, 10, 8, 186, 10,
-  0, 6, 6, 4, 0, 134, 97, 100, 101, 109, 105, 99, 0, 6, 4, 0, 133, 97, 100, 101,
-  109, 105, 99, 0, 18, 17, 18, 6, 8, 0, 131, 109, 105, 99, 0, 4, 28, 7, 0, 132,
-  110, 97, 109, 105, 99, 0, 28, 11, 21, 0, 130, 104, 109, 105, 99, 0, 18, 16,
-  18, 6, 8, 0, 132, 110, 111, 109, 105, 99, 0, 82, 249, 10, 28, 11, 11, 0, 6,
-  22, 4, 21, 4, 19, 4, 15, 0, 134, 111, 115, 99, 111, 112, 105, 99, 0, 23, 17,
-  18, 16, 0, 132, 111, 116, 121, 112, 105, 99, 0, 23, 8, 16, 28, 22, 0, 108, 37,
-  11, 22, 45, 11, 0, 132, 109, 101, 116, 114, 105, 99, 0, 4, 0, 135, 121, 109,
-  109, 101, 116, 114, 105, 99, 0, 4, 15, 6, 0, 129, 115, 105, 99, 0, 68, 88, 11,
-  6, 242, 11, 8, 0, 12, 12, 46, 12, 16, 121, 12, 21, 131, 12, 22, 142, 12, 0,
-  76, 101, 11, 15, 114, 11, 16, 123, 11, 21, 180, 11, 0, 22, 24, 11, 23, 17, 8,
-  0, 130, 115, 116, 105, 99, 0, 4, 10, 0, 130, 99, 116, 105, 99, 0, 68, 130, 11,
-  22, 143, 11, 0, 15, 5, 16, 8, 0, 133, 101, 109, 97, 116, 105, 99, 0, 68, 150,
-  11, 12, 164, 11, 0, 21, 4, 11, 6, 0, 134, 105, 115, 109, 97, 116, 105, 99, 0,
-  21, 4, 6, 0, 136, 104, 97, 114, 105, 115, 109, 97, 116, 105, 99, 0, 70, 187,
-  11, 8, 233, 11, 0, 81, 194, 11, 18, 214, 11, 0, 28, 22, 18, 8, 7, 12, 0, 138,
-  105, 111, 115, 121, 110, 99, 114, 97, 116, 105, 99, 0, 21, 24, 4, 8, 5, 0,
-  138, 117, 114, 101, 97, 117, 99, 114, 97, 116, 105, 99, 0, 44, 0, 131, 114,
-  97, 116, 105, 99, 0, 8, 15, 6, 6, 8, 0, 134, 108, 101, 99, 116, 105, 99, 0,
-  75, 10, 12, 17, 24, 12, 22, 37, 12, 0, 23, 22, 4, 0, 134, 101, 115, 116, 104,
-  101, 116, 105, 99, 0, 18, 9, 0, 134, 112, 104, 111, 110, 101, 116, 105, 99, 0,
-  4, 0, 131, 99, 101, 116, 105, 99, 0, 79, 53, 12, 22, 91, 12, 0, 68, 60, 12,
-  18, 69, 12, 0, 17, 4, 0, 131, 121, 116, 105, 99, 0, 8, 0, 79, 78, 12, 17, 86,
-  12, 0, 4, 19, 0, 129, 104, 105, 99, 0, 129, 104, 105, 99, 0, 76, 98, 12, 15,
-  110, 12, 0, 21, 4, 19, 0, 133, 97, 115, 105, 116, 105, 99, 0, 4, 8, 21, 0,
-  132, 105, 115, 116, 105, 99, 0, 4, 21, 7, 0, 130, 97, 116, 105, 99, 0, 4, 23,
-  17, 4, 0, 130, 99, 116, 105, 99, 0, 68, 152, 12, 12, 169, 12, 24, 227, 12, 0,
-  15, 6, 17, 18, 6, 12, 0, 134, 111, 99, 108, 97, 115, 116, 105, 99, 0, 79, 179,
-  12, 22, 195, 12, 24, 212, 12, 0, 5, 4, 5, 18, 21, 19, 0, 133, 105, 108, 105,
-  115, 116, 105, 99, 0, 21, 8, 23, 6, 4, 21, 4, 11, 6, 0, 133, 105, 115, 116,
-  105, 99, 0, 10, 5, 12, 15, 0, 135, 110, 103, 117, 105, 115, 116, 105, 99, 0,
-  18, 6, 6, 4, 0, 134, 111, 117, 115, 116, 105, 99, 0, 17, 18, 11, 19, 28, 15,
-  18, 19, 0, 130, 105, 99, 0, 68, 4, 13, 8, 10, 13, 0, 5, 0, 129, 99, 107, 0,
-  11, 6, 0, 129, 99, 107, 0, 4, 9, 0, 129, 99, 116, 0, 68, 58, 13, 5, 157, 13,
-  8, 163, 13, 12, 67, 27, 14, 132, 27, 15, 142, 27, 17, 205, 27, 18, 178, 28,
-  21, 40, 29, 24, 165, 29, 28, 188, 29, 0, 72, 74, 13, 12, 103, 13, 17, 114, 13,
-  18, 123, 13, 21, 135, 13, 0, 11, 0, 70, 83, 13, 21, 93, 13, 0, 4, 8, 5, 0,
-  130, 104, 101, 97, 100, 0, 18, 9, 0, 131, 101, 104, 101, 97, 100, 0, 15, 25,
-  17, 12, 0, 131, 97, 108, 105, 100, 0, 21, 23, 22, 0, 130, 97, 110, 100, 0, 15,
-  26, 18, 7, 0, 131, 110, 108, 111, 97, 100, 0, 72, 142, 13, 26, 149, 13, 0, 11,
-  0, 130, 97, 114, 100, 0, 18, 23, 0, 130, 97, 114, 100, 0, 17, 4, 0, 129, 100,
-  0, 68, 233, 13, 5, 249, 13, 6, 25, 14, 7, 222, 14, 8, 96, 15, 9, 159, 15, 10,
-  172, 15, 11, 239, 15, 12, 54, 16, 14, 167, 16, 15, 194, 16, 16, 52, 17, 17,
-  110, 17, 18, 107, 18, 19, 117, 18, 21, 183, 18, 22, 16, 20, 23, 74, 21, 24,
-  126, 25, 25, 180, 25, 26, 28, 26, 28, 53, 26, 29, 122, 26, 0, 23, 21, 18, 19,
-  21, 18, 6, 17, 12, 0, 131, 97, 116, 101, 100, 0, 76, 0, 14, 21, 12, 14, 0, 6,
-  22, 8, 7, 0, 131, 114, 105, 98, 101, 100, 0, 18, 22, 4, 0, 133, 98, 115, 111,
-  114, 98, 101, 100, 0, 72, 41, 14, 12, 50, 14, 17, 75, 14, 21, 108, 14, 24,
-  125, 14, 0, 19, 27, 8, 0, 129, 116, 101, 100, 0, 25, 0, 71, 59, 14, 17, 66,
-  14, 0, 4, 0, 130, 115, 101, 100, 0, 18, 6, 0, 130, 110, 99, 101, 100, 0, 68,
-  82, 14, 24, 95, 14, 0, 25, 4, 7, 4, 0, 134, 118, 97, 110, 99, 101, 100, 0, 18,
-  17, 4, 0, 133, 110, 111, 117, 110, 99, 101, 100, 0, 18, 9, 17, 8, 8, 21, 0,
-  135, 105, 110, 102, 111, 114, 99, 101, 100, 0, 71, 135, 14, 18, 186, 14, 21,
-  212, 14, 0, 82, 145, 14, 21, 161, 14, 24, 173, 14, 0, 21, 17, 23, 12, 0, 136,
-  110, 116, 114, 111, 100, 117, 99, 101, 100, 0, 23, 17, 12, 0, 132, 111, 100,
-  117, 99, 101, 100, 0, 21, 23, 17, 12, 0, 133, 111, 100, 117, 99, 101, 100, 0,
-  17, 0, 81, 195, 14, 18, 203, 14, 0, 4, 0, 130, 110, 99, 101, 100, 0, 21, 19,
-  0, 130, 110, 99, 101, 100, 0, 23, 22, 5, 18, 0, 129, 116, 101, 100, 0, 71,
-  241, 14, 8, 252, 14, 12, 39, 15, 21, 49, 15, 24, 57, 15, 25, 86, 15, 0, 8, 6,
-  27, 8, 0, 131, 101, 100, 101, 100, 0, 69, 3, 15, 8, 11, 15, 0, 16, 8, 0, 129,
-  100, 101, 100, 0, 6, 0, 72, 20, 15, 21, 27, 15, 0, 21, 0, 131, 100, 101, 100,
-  0, 8, 19, 24, 22, 0, 133, 115, 101, 100, 101, 100, 0, 6, 12, 15, 8, 0, 130,
-  116, 101, 100, 0, 18, 44, 0, 128, 114, 101, 100, 0, 86, 64, 15, 23, 74, 15, 0,
-  21, 8, 19, 0, 130, 97, 100, 101, 100, 0, 12, 23, 22, 5, 24, 22, 0, 130, 116,
-  101, 100, 0, 18, 21, 19, 0, 130, 105, 100, 101, 100, 0, 70, 112, 15, 8, 120,
-  15, 10, 130, 15, 11, 139, 15, 21, 149, 15, 0, 8, 21, 19, 0, 129, 100, 101, 0,
-  21, 10, 4, 22, 12, 7, 0, 129, 100, 0, 4, 21, 8, 25, 4, 0, 129, 100, 0, 22, 12,
-  15, 5, 24, 19, 0, 129, 100, 0, 10, 10, 4, 0, 132, 114, 101, 101, 100, 0, 12,
-  22, 12, 23, 4, 22, 0, 131, 102, 105, 101, 100, 0, 72, 179, 15, 17, 195, 15, 0,
-  7, 15, 26, 18, 17, 14, 6, 4, 0, 132, 101, 100, 103, 101, 100, 0, 68, 202, 15,
-  12, 231, 15, 0, 75, 209, 15, 21, 221, 15, 0, 6, 17, 8, 22, 12, 7, 0, 130, 116,
-  101, 100, 0, 4, 0, 132, 114, 97, 110, 103, 101, 100, 0, 22, 0, 131, 103, 110,
-  101, 100, 0, 70, 246, 15, 17, 44, 16, 0, 68, 3, 16, 8, 13, 16, 17, 22, 16, 23,
-  33, 16, 0, 8, 23, 0, 133, 97, 117, 103, 104, 116, 0, 21, 0, 131, 97, 99, 104,
-  101, 100, 0, 24, 18, 17, 18, 21, 19, 0, 130, 101, 100, 0, 4, 23, 8, 7, 0, 132,
-  99, 104, 101, 100, 0, 24, 4, 15, 0, 130, 99, 104, 101, 100, 0, 70, 76, 16, 9,
-  83, 16, 15, 102, 16, 17, 127, 16, 21, 138, 16, 25, 147, 16, 28, 157, 16, 0, 8,
-  7, 0, 129, 100, 101, 0, 22, 12, 23, 4, 22, 12, 7, 0, 135, 115, 97, 116, 105,
-  115, 102, 105, 101, 100, 0, 83, 109, 16, 23, 118, 16, 0, 4, 0, 131, 112, 108,
-  105, 101, 100, 0, 12, 23, 17, 8, 0, 130, 101, 100, 0, 21, 24, 18, 13, 0, 130,
-  101, 121, 101, 100, 0, 21, 24, 5, 0, 131, 105, 101, 100, 0, 21, 8, 7, 0, 131,
-  105, 118, 101, 100, 0, 21, 21, 4, 16, 0, 131, 105, 101, 100, 0, 72, 174, 16,
-  17, 184, 16, 0, 8, 22, 0, 132, 111, 117, 103, 104, 116, 0, 12, 21, 11, 22, 0,
-  132, 117, 110, 107, 0, 76, 210, 16, 15, 235, 16, 18, 21, 17, 19, 32, 17, 24,
-  43, 17, 0, 73, 217, 16, 15, 226, 16, 0, 15, 24, 9, 0, 129, 108, 101, 100, 0,
-  27, 8, 0, 132, 105, 108, 101, 100, 0, 72, 245, 16, 12, 1, 17, 24, 10, 17, 0,
-  29, 8, 5, 16, 8, 0, 132, 122, 108, 101, 100, 0, 4, 23, 8, 7, 0, 130, 101, 100,
-  0, 17, 4, 0, 132, 110, 117, 108, 108, 101, 100, 0, 21, 23, 17, 18, 6, 0, 129,
-  108, 101, 100, 0, 12, 23, 15, 24, 16, 0, 129, 105, 101, 100, 0, 17, 17, 4, 0,
-  129, 108, 101, 100, 0, 68, 65, 17, 16, 77, 17, 18, 88, 17, 21, 96, 17, 0, 15,
-  6, 18, 21, 19, 0, 130, 105, 109, 101, 100, 0, 8, 7, 17, 18, 6, 0, 130, 110,
-  101, 100, 0, 9, 0, 130, 114, 109, 101, 100, 0, 18, 9, 8, 19, 0, 133, 114, 102,
-  111, 114, 109, 101, 100, 0, 68, 135, 17, 8, 143, 17, 10, 152, 17, 12, 165, 17,
-  16, 215, 17, 17, 228, 17, 18, 14, 18, 23, 95, 18, 0, 15, 19, 0, 129, 110, 101,
-  100, 0, 23, 23, 4, 0, 129, 100, 101, 100, 0, 12, 22, 22, 8, 7, 0, 133, 105,
-  103, 110, 101, 100, 0, 68, 175, 17, 15, 190, 17, 23, 206, 17, 0, 23, 17, 4,
-  16, 0, 134, 105, 110, 116, 97, 105, 110, 101, 100, 0, 19, 12, 22, 12, 7, 0,
-  134, 99, 105, 112, 108, 105, 110, 101, 100, 0, 17, 18, 6, 0, 129, 117, 101,
-  100, 0, 4, 7, 17, 18, 6, 0, 132, 101, 109, 110, 101, 100, 0, 72, 235, 17, 18,
-  244, 17, 0, 19, 19, 4, 11, 0, 130, 101, 100, 0, 71, 251, 17, 22, 4, 18, 0, 17,
-  4, 5, 4, 0, 130, 101, 100, 0, 12, 21, 19, 16, 12, 0, 130, 101, 100, 0, 76, 21,
-  18, 22, 77, 18, 0, 85, 28, 18, 23, 39, 18, 0, 19, 16, 12, 0, 131, 115, 111,
-  110, 101, 100, 0, 80, 46, 18, 17, 63, 18, 0, 8, 16, 8, 21, 18, 9, 4, 0, 134,
-  110, 116, 105, 111, 110, 101, 100, 0, 12, 4, 16, 0, 136, 101, 110, 116, 105,
-  111, 110, 101, 100, 0, 12, 21, 19, 16, 8, 0, 137, 105, 109, 112, 114, 105,
-  115, 111, 110, 101, 100, 0, 12, 22, 8, 7, 0, 132, 116, 105, 110, 101, 100, 0,
-  19, 19, 24, 22, 0, 129, 115, 101, 100, 0, 76, 127, 18, 19, 149, 18, 22, 173,
-  18, 0, 75, 134, 18, 24, 141, 18, 0, 22, 0, 129, 112, 101, 100, 0, 20, 8, 0,
-  129, 112, 101, 100, 0, 79, 156, 18, 18, 163, 18, 0, 8, 11, 0, 130, 101, 100,
-  0, 15, 8, 25, 8, 7, 0, 130, 101, 100, 0, 4, 15, 8, 0, 131, 112, 115, 101, 100,
-  0, 68, 211, 18, 8, 248, 18, 9, 122, 19, 12, 131, 19, 19, 145, 19, 21, 151, 19,
-  23, 193, 19, 24, 205, 19, 28, 3, 20, 0, 72, 218, 18, 26, 241, 18, 0, 75, 225,
-  18, 19, 228, 18, 0, 129, 100, 0, 4, 22, 12, 7, 0, 132, 112, 101, 97, 114, 101,
-  100, 0, 4, 0, 129, 100, 101, 100, 0, 71, 11, 19, 9, 20, 19, 10, 54, 19, 12,
-  65, 19, 22, 79, 19, 23, 91, 19, 0, 8, 17, 8, 21, 0, 133, 100, 101, 0, 72, 30,
-  19, 9, 37, 19, 17, 47, 19, 0, 21, 0, 129, 114, 101, 100, 0, 8, 21, 0, 132,
-  101, 114, 114, 101, 100, 0, 12, 0, 129, 114, 101, 100, 0, 12, 21, 23, 0, 131,
-  103, 101, 114, 101, 100, 0, 7, 22, 17, 18, 6, 0, 133, 105, 100, 101, 114, 101,
-  100, 0, 26, 17, 4, 0, 133, 115, 119, 101, 114, 101, 100, 0, 86, 98, 19, 27,
-  113, 19, 0, 17, 12, 16, 7, 4, 0, 133, 105, 115, 116, 101, 114, 101, 100, 0, 8,
-  0, 132, 101, 114, 116, 101, 100, 0, 9, 18, 0, 130, 101, 114, 101, 100, 0, 24,
-  20, 6, 8, 21, 0, 134, 113, 117, 105, 114, 101, 100, 0, 22, 0, 128, 97, 100, 0,
-  68, 161, 19, 18, 173, 19, 24, 182, 19, 0, 8, 19, 19, 4, 22, 12, 7, 0, 130,
-  101, 100, 0, 21, 21, 12, 16, 0, 130, 101, 100, 0, 6, 18, 0, 132, 99, 117, 114,
-  114, 101, 100, 0, 24, 5, 12, 21, 23, 23, 4, 0, 130, 101, 100, 0, 70, 215, 19,
-  10, 223, 19, 20, 235, 19, 0, 6, 18, 0, 129, 114, 101, 100, 0, 4, 8, 15, 8, 5,
-  0, 130, 101, 114, 101, 100, 0, 72, 242, 19, 17, 250, 19, 0, 21, 0, 130, 105,
-  114, 101, 100, 0, 18, 6, 0, 130, 101, 114, 101, 100, 0, 23, 21, 21, 4, 16, 0,
-  133, 116, 121, 114, 101, 100, 0, 68, 35, 20, 8, 104, 20, 12, 132, 20, 17, 176,
-  20, 22, 187, 20, 24, 35, 21, 0, 72, 45, 20, 19, 59, 20, 21, 80, 20, 0, 21, 15,
-  6, 17, 12, 0, 134, 114, 101, 97, 115, 101, 100, 0, 108, 66, 20, 15, 71, 20, 0,
-  129, 115, 101, 100, 0, 8, 0, 132, 97, 112, 115, 101, 100, 0, 68, 87, 20, 21,
-  94, 20, 0, 11, 0, 129, 115, 101, 100, 0, 4, 11, 0, 132, 97, 115, 115, 101,
-  100, 0, 73, 111, 20, 21, 123, 20, 0, 9, 18, 21, 19, 0, 132, 101, 115, 115,
-  101, 100, 0, 7, 7, 4, 0, 129, 115, 101, 100, 0, 68, 142, 20, 6, 154, 20, 21,
-  169, 20, 0, 11, 19, 16, 8, 0, 131, 115, 105, 115, 101, 100, 0, 12, 23, 21, 6,
-  0, 134, 105, 116, 105, 99, 105, 115, 101, 100, 0, 4, 0, 131, 111, 115, 101, 0,
-  18, 6, 22, 17, 8, 0, 130, 99, 101, 100, 0, 68, 200, 20, 8, 212, 20, 18, 1, 21,
-  24, 9, 21, 0, 21, 21, 4, 11, 0, 133, 97, 115, 115, 101, 100, 0, 74, 222, 20,
-  21, 234, 20, 22, 246, 20, 0, 18, 21, 19, 0, 132, 114, 101, 115, 115, 101, 100,
-  0, 27, 8, 0, 133, 112, 114, 101, 115, 115, 101, 100, 0, 22, 5, 18, 0, 133,
-  101, 115, 115, 101, 100, 0, 19, 19, 18, 0, 130, 101, 100, 0, 6, 0, 70, 18, 21,
-  12, 24, 21, 0, 4, 0, 130, 101, 100, 0, 7, 0, 133, 115, 99, 117, 115, 115, 101,
-  100, 0, 70, 42, 21, 16, 65, 21, 0, 68, 49, 21, 6, 56, 21, 0, 131, 99, 117,
+static const uint8_t dictionary[49547] PROGMEM = {108, 73, 0, 4, 4, 8, 6, 224,
+  9, 7, 201, 13, 8, 119, 30, 9, 191, 66, 10, 85, 67, 11, 30, 78, 12, 74, 80, 14,
+  102, 80, 15, 252, 80, 16, 47, 91, 17, 34, 94, 18, 208, 112, 19, 95, 113, 21,
+  203, 113, 22, 233, 124, 23, 241, 147, 24, 47, 166, 25, 151, 166, 26, 224, 166,
+  27, 58, 167, 28, 90, 167, 29, 128, 193, 0, 68, 137, 0, 5, 194, 0, 6, 212, 0,
+  7, 34, 1, 8, 122, 1, 9, 138, 2, 10, 147, 2, 11, 173, 2, 12, 248, 2, 14, 36, 3,
+  15, 85, 3, 16, 226, 3, 17, 52, 4, 18, 229, 4, 19, 113, 5, 21, 159, 5, 22, 238,
+  5, 23, 158, 6, 24, 116, 7, 26, 141, 7, 28, 198, 7, 0, 72, 153, 0, 10, 161, 0,
+  15, 171, 0, 17, 178, 0, 23, 186, 0, 0, 25, 11, 0, 131, 97, 118, 101, 0, 16, 4,
+  21, 19, 0, 131, 103, 109, 97, 0, 8, 21, 0, 130, 97, 108, 0, 11, 23, 44, 0,
+  130, 97, 110, 0, 11, 23, 44, 0, 130, 97, 116, 0, 21, 5, 44, 0, 194, 101, 32,
+  114, 105, 103, 104, 116, 32, 98, 97, 99, 107, 0, 76, 219, 0, 21, 8, 1, 0, 69,
+  226, 0, 15, 236, 0, 0, 24, 19, 8, 21, 0, 130, 108, 105, 99, 0, 69, 243, 0, 24,
+  254, 0, 0, 19, 8, 21, 0, 132, 117, 98, 108, 105, 99, 0, 19, 8, 21, 0, 131, 98,
+  108, 105, 99, 0, 12, 12, 44, 0, 195, 102, 32, 73, 32, 114, 101, 99, 97, 108,
+  108, 32, 99, 111, 114, 114, 101, 99, 116, 108, 121, 0, 68, 53, 1, 7, 61, 1, 8,
+  66, 1, 12, 90, 1, 22, 105, 1, 24, 114, 1, 0, 5, 21, 18, 9, 0, 128, 101, 0, 17,
+  4, 0, 129, 0, 68, 73, 1, 8, 80, 1, 0, 7, 0, 131, 101, 97, 100, 0, 6, 24, 22,
+  0, 131, 99, 101, 101, 100, 0, 21, 4, 11, 6, 6, 4, 22, 28, 15, 18, 19, 0, 128,
+  101, 0, 8, 24, 44, 0, 131, 115, 101, 100, 0, 15, 6, 17, 12, 0, 128, 101, 0,
+  68, 156, 1, 6, 189, 1, 7, 198, 1, 11, 209, 1, 13, 241, 1, 15, 248, 1, 17, 7,
+  2, 18, 15, 2, 21, 35, 2, 23, 80, 2, 25, 130, 2, 0, 78, 166, 1, 16, 174, 1, 25,
+  182, 1, 0, 23, 44, 0, 131, 97, 107, 101, 0, 22, 44, 0, 131, 97, 109, 101, 0,
+  11, 0, 131, 97, 118, 101, 0, 12, 23, 21, 4, 0, 129, 108, 101, 0, 12, 22, 8, 7,
+  0, 132, 99, 105, 100, 101, 0, 74, 219, 1, 13, 226, 1, 23, 233, 1, 0, 23, 44,
+  0, 131, 104, 101, 0, 23, 44, 0, 131, 104, 101, 0, 44, 8, 11, 23, 44, 0, 132,
+  0, 23, 44, 0, 130, 104, 101, 0, 5, 16, 8, 22, 22, 8, 21, 0, 134, 101, 109, 98,
+  108, 101, 0, 11, 23, 44, 0, 130, 101, 110, 0, 80, 22, 2, 21, 30, 2, 0, 22, 44,
+  0, 131, 111, 109, 101, 0, 8, 11, 0, 129, 0, 71, 48, 2, 8, 56, 2, 10, 66, 2,
+  28, 72, 2, 0, 17, 24, 44, 0, 130, 101, 114, 0, 23, 11, 0, 133, 116, 104, 101,
+  114, 101, 0, 4, 44, 0, 128, 101, 0, 25, 44, 0, 131, 101, 114, 121, 0, 68, 90,
+  2, 12, 107, 2, 23, 121, 2, 0, 12, 25, 8, 21, 5, 4, 0, 135, 98, 114, 101, 118,
+  105, 97, 116, 101, 0, 21, 26, 28, 19, 18, 6, 0, 133, 114, 105, 103, 104, 116,
+  0, 12, 16, 16, 18, 6, 0, 128, 101, 0, 12, 17, 14, 0, 130, 102, 101, 0, 12, 21,
+  8, 11, 22, 0, 128, 102, 0, 17, 0, 72, 156, 2, 12, 163, 2, 0, 5, 0, 130, 105,
+  110, 103, 0, 16, 16, 18, 6, 0, 132, 105, 110, 103, 0, 69, 186, 2, 8, 202, 2,
+  12, 209, 2, 23, 218, 2, 0, 23, 44, 0, 194, 111, 32, 98, 101, 32, 104, 111,
+  110, 101, 115, 116, 0, 23, 44, 0, 130, 104, 101, 0, 23, 26, 44, 0, 131, 105,
+  116, 104, 0, 108, 228, 2, 4, 231, 2, 21, 239, 2, 0, 128, 101, 0, 23, 44, 0,
+  131, 104, 97, 116, 0, 24, 18, 22, 44, 0, 131, 116, 104, 0, 79, 5, 3, 21, 14,
+  3, 22, 23, 3, 23, 31, 3, 0, 5, 24, 19, 8, 21, 0, 128, 99, 0, 8, 11, 23, 44, 0,
+  130, 105, 114, 0, 11, 23, 44, 0, 130, 105, 115, 0, 12, 10, 0, 129, 0, 72, 46,
+  3, 12, 54, 3, 18, 76, 3, 0, 8, 17, 22, 0, 130, 97, 107, 0, 4, 9, 4, 44, 0,
+  196, 115, 32, 102, 97, 114, 32, 97, 115, 32, 73, 32, 107, 110, 111, 119, 0,
+  21, 26, 44, 0, 131, 111, 114, 107, 0, 68, 98, 3, 15, 110, 3, 24, 175, 3, 28,
+  191, 3, 0, 23, 24, 21, 12, 25, 0, 132, 116, 117, 97, 108, 0, 72, 120, 3, 18,
+  138, 3, 24, 161, 3, 0, 70, 127, 3, 19, 132, 3, 0, 27, 8, 0, 129, 0, 27, 8, 44,
+  0, 129, 0, 70, 145, 3, 21, 154, 3, 0, 22, 44, 0, 131, 114, 111, 108, 108, 0,
+  23, 17, 18, 6, 0, 129, 0, 9, 28, 23, 24, 4, 8, 5, 0, 133, 105, 102, 117, 108,
+  0, 9, 22, 8, 6, 24, 22, 0, 133, 99, 101, 115, 115, 102, 117, 108, 0, 81, 198,
+  3, 23, 205, 3, 0, 18, 44, 0, 130, 108, 121, 0, 23, 44, 0, 195, 97, 108, 107,
+  32, 116, 111, 32, 121, 111, 117, 32, 108, 97, 116, 101, 114, 0, 72, 239, 3,
+  18, 4, 4, 21, 13, 4, 24, 22, 4, 0, 76, 246, 3, 18, 253, 3, 0, 23, 44, 0, 130,
+  109, 101, 0, 22, 44, 0, 130, 109, 101, 0, 8, 19, 44, 0, 131, 111, 101, 109, 0,
+  8, 23, 17, 12, 0, 129, 105, 109, 0, 70, 32, 4, 7, 41, 4, 15, 46, 4, 0, 6, 4,
+  25, 0, 131, 117, 117, 109, 0, 44, 0, 128, 98, 0, 18, 6, 0, 128, 110, 0, 68,
+  77, 4, 7, 105, 4, 8, 112, 4, 10, 122, 4, 11, 136, 4, 12, 156, 4, 18, 180, 4,
+  26, 219, 4, 0, 76, 84, 4, 22, 96, 4, 0, 15, 5, 24, 19, 8, 21, 0, 130, 99, 97,
+  110, 0, 21, 8, 19, 44, 0, 130, 111, 110, 0, 4, 44, 0, 130, 110, 100, 0, 23,
+  11, 44, 0, 132, 116, 104, 101, 110, 0, 12, 21, 8, 25, 18, 22, 44, 0, 131, 101,
+  105, 103, 110, 0, 68, 143, 4, 23, 150, 4, 0, 23, 0, 131, 104, 97, 110, 0, 44,
+  0, 129, 101, 110, 0, 71, 163, 4, 15, 170, 4, 0, 7, 4, 44, 0, 128, 103, 0, 15,
+  12, 25, 44, 0, 130, 97, 105, 110, 0, 76, 190, 4, 17, 202, 4, 26, 211, 4, 0,
+  23, 24, 23, 44, 0, 132, 105, 116, 105, 111, 110, 0, 26, 14, 0, 132, 110, 111,
+  119, 110, 0, 17, 14, 0, 131, 111, 119, 110, 0, 17, 18, 14, 0, 132, 110, 111,
+  119, 110, 0, 75, 1, 5, 12, 10, 5, 15, 22, 5, 16, 31, 5, 17, 58, 5, 19, 66, 5,
+  23, 74, 5, 24, 99, 5, 26, 106, 5, 0, 23, 15, 4, 0, 128, 117, 103, 104, 0, 22,
+  12, 25, 12, 7, 5, 24, 22, 0, 128, 110, 0, 22, 4, 44, 0, 131, 108, 115, 111, 0,
+  70, 38, 5, 12, 42, 5, 0, 130, 111, 109, 0, 44, 0, 194, 110, 32, 109, 121, 32,
+  111, 112, 105, 110, 105, 111, 110, 0, 26, 14, 0, 131, 110, 111, 119, 0, 23,
+  22, 44, 0, 130, 111, 112, 0, 17, 0, 108, 83, 5, 8, 87, 5, 0, 130, 111, 116, 0,
+  16, 18, 16, 0, 134, 101, 109, 101, 110, 116, 111, 0, 28, 44, 0, 130, 111, 117,
+  0, 17, 14, 0, 130, 111, 119, 0, 79, 126, 5, 16, 135, 5, 18, 143, 5, 24, 152,
+  5, 0, 4, 11, 44, 0, 131, 101, 108, 112, 0, 8, 23, 23, 4, 0, 128, 116, 0, 24,
+  22, 44, 0, 131, 111, 117, 112, 0, 18, 21, 23, 0, 128, 101, 0, 68, 175, 5, 8,
+  189, 5, 18, 214, 5, 23, 223, 5, 28, 230, 5, 0, 17, 18, 12, 23, 24, 15, 18, 25,
+  8, 21, 0, 128, 121, 0, 75, 196, 5, 28, 206, 5, 0, 10, 24, 4, 7, 0, 130, 116,
+  101, 114, 0, 25, 44, 0, 131, 101, 114, 121, 0, 23, 24, 4, 0, 130, 104, 111,
+  114, 0, 22, 4, 15, 44, 0, 129, 0, 8, 25, 44, 0, 130, 114, 121, 0, 68, 4, 6, 8,
+  36, 6, 11, 92, 6, 12, 101, 6, 15, 124, 6, 22, 135, 6, 24, 146, 6, 0, 79, 14,
+  6, 21, 19, 6, 28, 28, 6, 0, 6, 0, 128, 115, 0, 21, 4, 11, 0, 131, 97, 115,
+  115, 0, 22, 44, 0, 131, 97, 121, 115, 0, 70, 49, 6, 21, 56, 6, 22, 77, 6, 24,
+  86, 6, 0, 18, 21, 19, 0, 128, 115, 0, 7, 0, 68, 65, 6, 7, 72, 6, 0, 131, 100,
+  114, 101, 115, 115, 0, 4, 0, 128, 115, 0, 18, 18, 15, 0, 132, 115, 101, 115,
+  0, 44, 0, 130, 115, 101, 0, 12, 23, 44, 0, 131, 104, 105, 115, 0, 23, 0, 75,
+  110, 6, 17, 116, 6, 0, 132, 116, 104, 105, 115, 0, 8, 12, 6, 22, 0, 128, 116,
+  0, 15, 18, 21, 23, 17, 18, 6, 0, 130, 115, 0, 8, 6, 24, 22, 0, 131, 99, 101,
+  115, 115, 0, 4, 23, 23, 22, 44, 0, 132, 97, 116, 117, 115, 0, 68, 183, 6, 10,
+  223, 6, 11, 229, 6, 12, 3, 7, 17, 50, 7, 18, 62, 7, 22, 85, 7, 27, 107, 7, 0,
+  21, 0, 72, 192, 6, 23, 215, 6, 0, 74, 199, 6, 19, 205, 6, 0, 132, 114, 101,
+  97, 116, 0, 8, 22, 0, 132, 97, 114, 97, 116, 101, 0, 22, 44, 0, 131, 97, 114,
+  116, 0, 44, 0, 129, 105, 116, 0, 68, 236, 6, 23, 255, 6, 0, 87, 243, 6, 26,
+  248, 6, 0, 131, 104, 97, 116, 0, 44, 0, 131, 104, 97, 116, 0, 129, 97, 116, 0,
+  76, 13, 7, 21, 18, 7, 22, 27, 7, 0, 10, 0, 130, 116, 0, 6, 18, 19, 28, 11, 0,
+  128, 101, 0, 82, 34, 7, 22, 44, 7, 0, 19, 16, 18, 6, 8, 7, 0, 130, 101, 0, 4,
+  0, 129, 115, 116, 0, 4, 7, 12, 6, 6, 4, 0, 131, 101, 110, 116, 0, 79, 69, 7,
+  17, 78, 7, 0, 4, 44, 0, 131, 32, 108, 111, 116, 0, 12, 44, 0, 130, 116, 111,
+  0, 68, 92, 7, 24, 98, 7, 0, 23, 44, 0, 128, 101, 0, 23, 44, 0, 131, 114, 117,
+  115, 116, 0, 17, 8, 0, 132, 110, 101, 120, 116, 0, 82, 123, 7, 21, 131, 7, 0,
+  23, 28, 44, 0, 131, 111, 117, 0, 11, 23, 44, 0, 129, 111, 117, 103, 104, 0,
+  75, 154, 7, 16, 163, 7, 17, 176, 7, 23, 184, 7, 0, 18, 22, 44, 0, 131, 104,
+  111, 119, 0, 18, 44, 0, 194, 110, 32, 109, 121, 32, 119, 97, 121, 0, 18, 14,
+  0, 131, 110, 111, 119, 0, 5, 44, 0, 194, 121, 32, 116, 104, 101, 32, 119, 97,
+  121, 0, 72, 214, 7, 11, 223, 7, 15, 232, 7, 18, 240, 7, 23, 250, 7, 0, 23, 11,
+  0, 132, 116, 104, 101, 121, 0, 8, 23, 44, 0, 131, 104, 101, 121, 0, 4, 8, 21,
+  0, 129, 108, 121, 0, 21, 23, 22, 44, 0, 131, 111, 114, 121, 0, 12, 21, 4, 25,
+  0, 130, 101, 116, 121, 0, 71, 35, 8, 8, 52, 8, 12, 74, 8, 15, 205, 8, 16, 64,
+  9, 17, 77, 9, 21, 130, 9, 22, 171, 9, 23, 180, 9, 28, 204, 9, 0, 17, 4, 10,
+  18, 19, 18, 21, 19, 0, 133, 97, 103, 97, 110, 100, 97, 0, 78, 59, 8, 21, 66,
+  8, 0, 16, 0, 130, 97, 107, 101, 0, 28, 44, 0, 130, 101, 97, 114, 0, 71, 84, 8,
+  15, 123, 8, 17, 175, 8, 0, 8, 0, 80, 93, 8, 19, 106, 8, 0, 22, 22, 4, 16, 0,
+  132, 32, 109, 101, 100, 105, 97, 0, 18, 15, 28, 6, 17, 8, 0, 134, 99, 108,
+  111, 112, 101, 100, 105, 97, 0, 68, 130, 8, 18, 164, 8, 0, 76, 137, 8, 17,
+  148, 8, 0, 17, 8, 10, 0, 131, 116, 97, 108, 105, 97, 0, 8, 11, 19, 4, 21, 4,
+  19, 0, 132, 114, 110, 97, 108, 105, 97, 0, 10, 4, 16, 0, 131, 110, 111, 108,
+  105, 97, 0, 72, 182, 8, 17, 192, 8, 0, 15, 15, 12, 16, 0, 129, 110, 105, 97,
+  0, 8, 15, 12, 16, 0, 132, 108, 101, 110, 110, 105, 97, 0, 69, 218, 8, 12, 230,
+  8, 22, 240, 8, 24, 249, 8, 0, 4, 17, 24, 6, 17, 12, 0, 129, 117, 108, 97, 0,
+  21, 21, 8, 24, 10, 0, 128, 108, 97, 0, 24, 9, 8, 21, 0, 129, 97, 108, 0, 81,
+  0, 9, 22, 14, 9, 0, 12, 22, 17, 8, 19, 0, 133, 105, 110, 115, 117, 108, 97, 0,
+  76, 21, 9, 17, 50, 9, 0, 17, 0, 72, 30, 9, 17, 39, 9, 0, 19, 0, 131, 110, 115,
+  117, 108, 97, 0, 8, 19, 0, 133, 105, 110, 115, 117, 108, 97, 0, 12, 17, 17, 8,
+  19, 0, 134, 105, 110, 115, 117, 108, 97, 0, 28, 22, 28, 11, 19, 16, 8, 0, 130,
+  101, 109, 97, 0, 8, 0, 68, 86, 9, 16, 95, 9, 0, 17, 17, 12, 15, 0, 129, 97,
+  110, 0, 81, 102, 9, 18, 114, 9, 0, 18, 17, 8, 11, 19, 0, 132, 109, 101, 110,
+  97, 0, 10, 18, 15, 18, 21, 19, 0, 134, 101, 103, 111, 109, 101, 110, 97, 0,
+  71, 137, 9, 8, 152, 9, 0, 8, 11, 18, 23, 6, 18, 0, 133, 97, 104, 101, 100,
+  114, 97, 0, 79, 159, 9, 28, 165, 9, 0, 6, 0, 129, 97, 114, 0, 44, 0, 129, 97,
+  114, 0, 21, 8, 28, 0, 130, 97, 114, 115, 0, 85, 187, 9, 24, 196, 9, 0, 18, 19,
+  21, 12, 4, 0, 128, 115, 0, 18, 5, 4, 0, 128, 32, 97, 0, 71, 211, 9, 26, 218,
+  9, 0, 18, 23, 0, 129, 97, 121, 0, 4, 0, 129, 97, 121, 0, 68, 243, 9, 9, 254,
+  9, 11, 10, 10, 12, 56, 10, 14, 174, 13, 23, 194, 13, 0, 12, 11, 6, 21, 4, 0,
+  130, 97, 105, 99, 0, 12, 23, 17, 8, 12, 6, 22, 0, 128, 105, 99, 0, 68, 20, 10,
+  12, 26, 10, 23, 48, 10, 0, 8, 0, 129, 99, 104, 0, 75, 33, 10, 26, 39, 10, 0,
+  26, 0, 129, 99, 104, 0, 11, 0, 132, 119, 104, 105, 99, 104, 0, 12, 26, 22, 0,
+  129, 99, 104, 0, 69, 99, 10, 6, 114, 10, 7, 126, 10, 9, 138, 10, 10, 178, 10,
+  11, 215, 10, 15, 0, 11, 16, 60, 11, 17, 150, 11, 19, 163, 11, 21, 201, 11, 22,
+  234, 11, 23, 243, 11, 28, 161, 13, 0, 18, 19, 18, 21, 7, 28, 11, 0, 131, 104,
+  111, 98, 105, 99, 0, 22, 28, 19, 0, 132, 115, 121, 99, 104, 105, 99, 0, 8, 16,
+  16, 18, 6, 0, 132, 101, 100, 105, 99, 0, 68, 148, 10, 6, 156, 10, 23, 166, 10,
+  0, 21, 23, 0, 129, 102, 105, 99, 0, 8, 19, 22, 0, 130, 105, 102, 105, 99, 0,
+  17, 8, 12, 6, 22, 0, 130, 105, 102, 105, 99, 0, 72, 185, 10, 21, 200, 10, 0,
+  23, 21, 4, 23, 22, 0, 134, 114, 97, 116, 101, 103, 105, 99, 0, 24, 15, 4, 23,
+  8, 16, 0, 132, 108, 117, 114, 103, 105, 99, 0, 83, 222, 10, 28, 247, 10, 0, 4,
+  21, 10, 18, 12, 5, 18, 11, 23, 24, 4, 0, 139, 111, 98, 105, 111, 103, 114, 97,
+  112, 104, 105, 99, 0, 22, 19, 0, 130, 99, 104, 105, 99, 0, 68, 10, 11, 11, 19,
+  11, 12, 29, 11, 0, 23, 8, 16, 0, 129, 108, 105, 99, 0, 23, 4, 6, 0, 130, 111,
+  108, 105, 99, 0, 73, 36, 11, 19, 47, 11, 0, 18, 21, 19, 0, 132, 108, 105, 102,
+  105, 99, 0, 18, 21, 7, 28, 11, 0, 131, 104, 105, 108, 105, 99, 0, 71, 76, 11,
+  8, 86, 11, 12, 118, 11, 17, 129, 11, 23, 140, 11, 0, 4, 6, 4, 0, 130, 101,
+  109, 105, 99, 0, 7, 0, 68, 95, 11, 8, 107, 11, 0, 6, 6, 4, 0, 134, 97, 100,
+  101, 109, 105, 99, 0, 6, 4, 0, 133, 97, 100, 101, 109, 105, 99, 0, 18, 17, 18,
+  6, 8, 0, 131, 109, 105, 99, 0, 4, 28, 7, 0, 132, 110, 97, 109, 105, 99, 0, 28,
+  11, 21, 0, 130, 104, 109, 105, 99, 0, 18, 16, 18, 6, 8, 0, 132, 110, 111, 109,
+  105, 99, 0, 82, 170, 11, 28, 188, 11, 0, 6, 22, 4, 21, 4, 19, 4, 15, 0, 134,
+  111, 115, 99, 111, 112, 105, 99, 0, 23, 17, 18, 16, 0, 132, 111, 116, 121,
+  112, 105, 99, 0, 23, 8, 16, 28, 22, 0, 108, 214, 11, 22, 222, 11, 0, 132, 109,
+  101, 116, 114, 105, 99, 0, 4, 0, 135, 121, 109, 109, 101, 116, 114, 105, 99,
+  0, 4, 15, 6, 0, 129, 115, 105, 99, 0, 68, 9, 12, 6, 163, 12, 8, 177, 12, 12,
+  223, 12, 16, 42, 13, 21, 52, 13, 22, 63, 13, 0, 76, 22, 12, 15, 35, 12, 16,
+  44, 12, 21, 101, 12, 0, 22, 24, 11, 23, 17, 8, 0, 130, 115, 116, 105, 99, 0,
+  4, 10, 0, 130, 99, 116, 105, 99, 0, 68, 51, 12, 22, 64, 12, 0, 15, 5, 16, 8,
+  0, 133, 101, 109, 97, 116, 105, 99, 0, 68, 71, 12, 12, 85, 12, 0, 21, 4, 11,
+  6, 0, 134, 105, 115, 109, 97, 116, 105, 99, 0, 21, 4, 6, 0, 136, 104, 97, 114,
+  105, 115, 109, 97, 116, 105, 99, 0, 70, 108, 12, 8, 154, 12, 0, 81, 115, 12,
+  18, 135, 12, 0, 28, 22, 18, 8, 7, 12, 0, 138, 105, 111, 115, 121, 110, 99,
+  114, 97, 116, 105, 99, 0, 21, 24, 4, 8, 5, 0, 138, 117, 114, 101, 97, 117, 99,
+  114, 97, 116, 105, 99, 0, 44, 0, 131, 114, 97, 116, 105, 99, 0, 8, 15, 6, 6,
+  8, 0, 134, 108, 101, 99, 116, 105, 99, 0, 75, 187, 12, 17, 201, 12, 22, 214,
+  12, 0, 23, 22, 4, 0, 134, 101, 115, 116, 104, 101, 116, 105, 99, 0, 18, 9, 0,
+  134, 112, 104, 111, 110, 101, 116, 105, 99, 0, 4, 0, 131, 99, 101, 116, 105,
+  99, 0, 79, 230, 12, 22, 12, 13, 0, 68, 237, 12, 18, 246, 12, 0, 17, 4, 0, 131,
+  121, 116, 105, 99, 0, 8, 0, 79, 255, 12, 17, 7, 13, 0, 4, 19, 0, 129, 104,
+  105, 99, 0, 129, 104, 105, 99, 0, 76, 19, 13, 15, 31, 13, 0, 21, 4, 19, 0,
+  133, 97, 115, 105, 116, 105, 99, 0, 4, 8, 21, 0, 132, 105, 115, 116, 105, 99,
+  0, 4, 21, 7, 0, 130, 97, 116, 105, 99, 0, 4, 23, 17, 4, 0, 130, 99, 116, 105,
+  99, 0, 68, 73, 13, 12, 90, 13, 24, 148, 13, 0, 15, 6, 17, 18, 6, 12, 0, 134,
+  111, 99, 108, 97, 115, 116, 105, 99, 0, 79, 100, 13, 22, 116, 13, 24, 133, 13,
+  0, 5, 4, 5, 18, 21, 19, 0, 133, 105, 108, 105, 115, 116, 105, 99, 0, 21, 8,
+  23, 6, 4, 21, 4, 11, 6, 0, 133, 105, 115, 116, 105, 99, 0, 10, 5, 12, 15, 0,
+  135, 110, 103, 117, 105, 115, 116, 105, 99, 0, 18, 6, 6, 4, 0, 134, 111, 117,
+  115, 116, 105, 99, 0, 17, 18, 11, 19, 28, 15, 18, 19, 0, 130, 105, 99, 0, 68,
+  181, 13, 8, 187, 13, 0, 5, 0, 129, 99, 107, 0, 11, 6, 0, 129, 99, 107, 0, 4,
+  9, 0, 129, 99, 116, 0, 68, 235, 13, 5, 78, 14, 8, 84, 14, 12, 244, 27, 14, 53,
+  28, 15, 63, 28, 17, 126, 28, 18, 99, 29, 21, 217, 29, 24, 86, 30, 28, 109, 30,
+  0, 72, 251, 13, 12, 24, 14, 17, 35, 14, 18, 44, 14, 21, 56, 14, 0, 11, 0, 70,
+  4, 14, 21, 14, 14, 0, 4, 8, 5, 0, 130, 104, 101, 97, 100, 0, 18, 9, 0, 131,
+  101, 104, 101, 97, 100, 0, 15, 25, 17, 12, 0, 131, 97, 108, 105, 100, 0, 21,
+  23, 22, 0, 130, 97, 110, 100, 0, 15, 26, 18, 7, 0, 131, 110, 108, 111, 97,
+  100, 0, 72, 63, 14, 26, 70, 14, 0, 11, 0, 130, 97, 114, 100, 0, 18, 23, 0,
+  130, 97, 114, 100, 0, 17, 4, 0, 129, 100, 0, 68, 154, 14, 5, 170, 14, 6, 202,
+  14, 7, 143, 15, 8, 17, 16, 9, 80, 16, 10, 93, 16, 11, 160, 16, 12, 231, 16,
+  14, 88, 17, 15, 115, 17, 16, 229, 17, 17, 31, 18, 18, 28, 19, 19, 38, 19, 21,
+  104, 19, 22, 193, 20, 23, 251, 21, 24, 47, 26, 25, 101, 26, 26, 205, 26, 28,
+  230, 26, 29, 43, 27, 0, 23, 21, 18, 19, 21, 18, 6, 17, 12, 0, 131, 97, 116,
+  101, 100, 0, 76, 177, 14, 21, 189, 14, 0, 6, 22, 8, 7, 0, 131, 114, 105, 98,
+  101, 100, 0, 18, 22, 4, 0, 133, 98, 115, 111, 114, 98, 101, 100, 0, 72, 218,
+  14, 12, 227, 14, 17, 252, 14, 21, 29, 15, 24, 46, 15, 0, 19, 27, 8, 0, 129,
+  116, 101, 100, 0, 25, 0, 71, 236, 14, 17, 243, 14, 0, 4, 0, 130, 115, 101,
+  100, 0, 18, 6, 0, 130, 110, 99, 101, 100, 0, 68, 3, 15, 24, 16, 15, 0, 25, 4,
+  7, 4, 0, 134, 118, 97, 110, 99, 101, 100, 0, 18, 17, 4, 0, 133, 110, 111, 117,
+  110, 99, 101, 100, 0, 18, 9, 17, 8, 8, 21, 0, 135, 105, 110, 102, 111, 114,
+  99, 101, 100, 0, 71, 56, 15, 18, 107, 15, 21, 133, 15, 0, 82, 66, 15, 21, 82,
+  15, 24, 94, 15, 0, 21, 17, 23, 12, 0, 136, 110, 116, 114, 111, 100, 117, 99,
+  101, 100, 0, 23, 17, 12, 0, 132, 111, 100, 117, 99, 101, 100, 0, 21, 23, 17,
+  12, 0, 133, 111, 100, 117, 99, 101, 100, 0, 17, 0, 81, 116, 15, 18, 124, 15,
+  0, 4, 0, 130, 110, 99, 101, 100, 0, 21, 19, 0, 130, 110, 99, 101, 100, 0, 23,
+  22, 5, 18, 0, 129, 116, 101, 100, 0, 71, 162, 15, 8, 173, 15, 12, 216, 15, 21,
+  226, 15, 24, 234, 15, 25, 7, 16, 0, 8, 6, 27, 8, 0, 131, 101, 100, 101, 100,
+  0, 69, 180, 15, 8, 188, 15, 0, 16, 8, 0, 129, 100, 101, 100, 0, 6, 0, 72, 197,
+  15, 21, 204, 15, 0, 21, 0, 131, 100, 101, 100, 0, 8, 19, 24, 22, 0, 133, 115,
+  101, 100, 101, 100, 0, 6, 12, 15, 8, 0, 130, 116, 101, 100, 0, 18, 44, 0, 128,
+  114, 101, 100, 0, 86, 241, 15, 23, 251, 15, 0, 21, 8, 19, 0, 130, 97, 100,
+  101, 100, 0, 12, 23, 22, 5, 24, 22, 0, 130, 116, 101, 100, 0, 18, 21, 19, 0,
+  130, 105, 100, 101, 100, 0, 70, 33, 16, 8, 41, 16, 10, 51, 16, 11, 60, 16, 21,
+  70, 16, 0, 8, 21, 19, 0, 129, 100, 101, 0, 21, 10, 4, 22, 12, 7, 0, 129, 100,
+  0, 4, 21, 8, 25, 4, 0, 129, 100, 0, 22, 12, 15, 5, 24, 19, 0, 129, 100, 0, 10,
+  10, 4, 0, 132, 114, 101, 101, 100, 0, 12, 22, 12, 23, 4, 22, 0, 131, 102, 105,
+  101, 100, 0, 72, 100, 16, 17, 116, 16, 0, 7, 15, 26, 18, 17, 14, 6, 4, 0, 132,
+  101, 100, 103, 101, 100, 0, 68, 123, 16, 12, 152, 16, 0, 75, 130, 16, 21, 142,
+  16, 0, 6, 17, 8, 22, 12, 7, 0, 130, 116, 101, 100, 0, 4, 0, 132, 114, 97, 110,
+  103, 101, 100, 0, 22, 0, 131, 103, 110, 101, 100, 0, 70, 167, 16, 17, 221, 16,
+  0, 68, 180, 16, 8, 190, 16, 17, 199, 16, 23, 210, 16, 0, 8, 23, 0, 133, 97,
+  117, 103, 104, 116, 0, 21, 0, 131, 97, 99, 104, 101, 100, 0, 24, 18, 17, 18,
+  21, 19, 0, 130, 101, 100, 0, 4, 23, 8, 7, 0, 132, 99, 104, 101, 100, 0, 24, 4,
+  15, 0, 130, 99, 104, 101, 100, 0, 70, 253, 16, 9, 4, 17, 15, 23, 17, 17, 48,
+  17, 21, 59, 17, 25, 68, 17, 28, 78, 17, 0, 8, 7, 0, 129, 100, 101, 0, 22, 12,
+  23, 4, 22, 12, 7, 0, 135, 115, 97, 116, 105, 115, 102, 105, 101, 100, 0, 83,
+  30, 17, 23, 39, 17, 0, 4, 0, 131, 112, 108, 105, 101, 100, 0, 12, 23, 17, 8,
+  0, 130, 101, 100, 0, 21, 24, 18, 13, 0, 130, 101, 121, 101, 100, 0, 21, 24, 5,
+  0, 131, 105, 101, 100, 0, 21, 8, 7, 0, 131, 105, 118, 101, 100, 0, 21, 21, 4,
+  16, 0, 131, 105, 101, 100, 0, 72, 95, 17, 17, 105, 17, 0, 8, 22, 0, 132, 111,
+  117, 103, 104, 116, 0, 12, 21, 11, 22, 0, 132, 117, 110, 107, 0, 76, 131, 17,
+  15, 156, 17, 18, 198, 17, 19, 209, 17, 24, 220, 17, 0, 73, 138, 17, 15, 147,
+  17, 0, 15, 24, 9, 0, 129, 108, 101, 100, 0, 27, 8, 0, 132, 105, 108, 101, 100,
+  0, 72, 166, 17, 12, 178, 17, 24, 187, 17, 0, 29, 8, 5, 16, 8, 0, 132, 122,
+  108, 101, 100, 0, 4, 23, 8, 7, 0, 130, 101, 100, 0, 17, 4, 0, 132, 110, 117,
+  108, 108, 101, 100, 0, 21, 23, 17, 18, 6, 0, 129, 108, 101, 100, 0, 12, 23,
+  15, 24, 16, 0, 129, 105, 101, 100, 0, 17, 17, 4, 0, 129, 108, 101, 100, 0, 68,
+  242, 17, 16, 254, 17, 18, 9, 18, 21, 17, 18, 0, 15, 6, 18, 21, 19, 0, 130,
+  105, 109, 101, 100, 0, 8, 7, 17, 18, 6, 0, 130, 110, 101, 100, 0, 9, 0, 130,
+  114, 109, 101, 100, 0, 18, 9, 8, 19, 0, 133, 114, 102, 111, 114, 109, 101,
+  100, 0, 68, 56, 18, 8, 64, 18, 10, 73, 18, 12, 86, 18, 16, 136, 18, 17, 149,
+  18, 18, 191, 18, 23, 16, 19, 0, 15, 19, 0, 129, 110, 101, 100, 0, 23, 23, 4,
+  0, 129, 100, 101, 100, 0, 12, 22, 22, 8, 7, 0, 133, 105, 103, 110, 101, 100,
+  0, 68, 96, 18, 15, 111, 18, 23, 127, 18, 0, 23, 17, 4, 16, 0, 134, 105, 110,
+  116, 97, 105, 110, 101, 100, 0, 19, 12, 22, 12, 7, 0, 134, 99, 105, 112, 108,
+  105, 110, 101, 100, 0, 17, 18, 6, 0, 129, 117, 101, 100, 0, 4, 7, 17, 18, 6,
+  0, 132, 101, 109, 110, 101, 100, 0, 72, 156, 18, 18, 165, 18, 0, 19, 19, 4,
+  11, 0, 130, 101, 100, 0, 71, 172, 18, 22, 181, 18, 0, 17, 4, 5, 4, 0, 130,
+  101, 100, 0, 12, 21, 19, 16, 12, 0, 130, 101, 100, 0, 76, 198, 18, 22, 254,
+  18, 0, 85, 205, 18, 23, 216, 18, 0, 19, 16, 12, 0, 131, 115, 111, 110, 101,
+  100, 0, 80, 223, 18, 17, 240, 18, 0, 8, 16, 8, 21, 18, 9, 4, 0, 134, 110, 116,
+  105, 111, 110, 101, 100, 0, 12, 4, 16, 0, 136, 101, 110, 116, 105, 111, 110,
+  101, 100, 0, 12, 21, 19, 16, 8, 0, 137, 105, 109, 112, 114, 105, 115, 111,
+  110, 101, 100, 0, 12, 22, 8, 7, 0, 132, 116, 105, 110, 101, 100, 0, 19, 19,
+  24, 22, 0, 129, 115, 101, 100, 0, 76, 48, 19, 19, 70, 19, 22, 94, 19, 0, 75,
+  55, 19, 24, 62, 19, 0, 22, 0, 129, 112, 101, 100, 0, 20, 8, 0, 129, 112, 101,
+  100, 0, 79, 77, 19, 18, 84, 19, 0, 8, 11, 0, 130, 101, 100, 0, 15, 8, 25, 8,
+  7, 0, 130, 101, 100, 0, 4, 15, 8, 0, 131, 112, 115, 101, 100, 0, 68, 132, 19,
+  8, 169, 19, 9, 43, 20, 12, 52, 20, 19, 66, 20, 21, 72, 20, 23, 114, 20, 24,
+  126, 20, 28, 180, 20, 0, 72, 139, 19, 26, 162, 19, 0, 75, 146, 19, 19, 149,
+  19, 0, 129, 100, 0, 4, 22, 12, 7, 0, 132, 112, 101, 97, 114, 101, 100, 0, 4,
+  0, 129, 100, 101, 100, 0, 71, 188, 19, 9, 197, 19, 10, 231, 19, 12, 242, 19,
+  22, 0, 20, 23, 12, 20, 0, 8, 17, 8, 21, 0, 133, 100, 101, 0, 72, 207, 19, 9,
+  214, 19, 17, 224, 19, 0, 21, 0, 129, 114, 101, 100, 0, 8, 21, 0, 132, 101,
+  114, 114, 101, 100, 0, 12, 0, 129, 114, 101, 100, 0, 12, 21, 23, 0, 131, 103,
+  101, 114, 101, 100, 0, 7, 22, 17, 18, 6, 0, 133, 105, 100, 101, 114, 101, 100,
+  0, 26, 17, 4, 0, 133, 115, 119, 101, 114, 101, 100, 0, 86, 19, 20, 27, 34, 20,
+  0, 17, 12, 16, 7, 4, 0, 133, 105, 115, 116, 101, 114, 101, 100, 0, 8, 0, 132,
+  101, 114, 116, 101, 100, 0, 9, 18, 0, 130, 101, 114, 101, 100, 0, 24, 20, 6,
+  8, 21, 0, 134, 113, 117, 105, 114, 101, 100, 0, 22, 0, 128, 97, 100, 0, 68,
+  82, 20, 18, 94, 20, 24, 103, 20, 0, 8, 19, 19, 4, 22, 12, 7, 0, 130, 101, 100,
+  0, 21, 21, 12, 16, 0, 130, 101, 100, 0, 6, 18, 0, 132, 99, 117, 114, 114, 101,
+  100, 0, 24, 5, 12, 21, 23, 23, 4, 0, 130, 101, 100, 0, 70, 136, 20, 10, 144,
+  20, 20, 156, 20, 0, 6, 18, 0, 129, 114, 101, 100, 0, 4, 8, 15, 8, 5, 0, 130,
+  101, 114, 101, 100, 0, 72, 163, 20, 17, 171, 20, 0, 21, 0, 130, 105, 114, 101,
+  100, 0, 18, 6, 0, 130, 101, 114, 101, 100, 0, 23, 21, 21, 4, 16, 0, 133, 116,
+  121, 114, 101, 100, 0, 68, 212, 20, 8, 25, 21, 12, 53, 21, 17, 97, 21, 22,
+  108, 21, 24, 212, 21, 0, 72, 222, 20, 19, 236, 20, 21, 1, 21, 0, 21, 15, 6,
+  17, 12, 0, 134, 114, 101, 97, 115, 101, 100, 0, 108, 243, 20, 15, 248, 20, 0,
+  129, 115, 101, 100, 0, 8, 0, 132, 97, 112, 115, 101, 100, 0, 68, 8, 21, 21,
+  15, 21, 0, 11, 0, 129, 115, 101, 100, 0, 4, 11, 0, 132, 97, 115, 115, 101,
+  100, 0, 73, 32, 21, 21, 44, 21, 0, 9, 18, 21, 19, 0, 132, 101, 115, 115, 101,
+  100, 0, 7, 7, 4, 0, 129, 115, 101, 100, 0, 68, 63, 21, 6, 75, 21, 21, 90, 21,
+  0, 11, 19, 16, 8, 0, 131, 115, 105, 115, 101, 100, 0, 12, 23, 21, 6, 0, 134,
+  105, 116, 105, 99, 105, 115, 101, 100, 0, 4, 0, 131, 111, 115, 101, 0, 18, 6,
+  22, 17, 8, 0, 130, 99, 101, 100, 0, 68, 121, 21, 8, 133, 21, 18, 178, 21, 24,
+  186, 21, 0, 21, 21, 4, 11, 0, 133, 97, 115, 115, 101, 100, 0, 74, 143, 21, 21,
+  155, 21, 22, 167, 21, 0, 18, 21, 19, 0, 132, 114, 101, 115, 115, 101, 100, 0,
+  27, 8, 0, 133, 112, 114, 101, 115, 115, 101, 100, 0, 22, 5, 18, 0, 133, 101,
+  115, 115, 101, 100, 0, 19, 19, 18, 0, 130, 101, 100, 0, 6, 0, 70, 195, 21, 12,
+  201, 21, 0, 4, 0, 130, 101, 100, 0, 7, 0, 133, 115, 99, 117, 115, 115, 101,
+  100, 0, 70, 219, 21, 16, 242, 21, 0, 68, 226, 21, 6, 233, 21, 0, 131, 99, 117,
   115, 101, 100, 0, 6, 4, 0, 132, 117, 115, 101, 100, 0, 16, 4, 0, 132, 117,
-  115, 101, 100, 0, 68, 108, 21, 6, 99, 23, 8, 164, 23, 9, 192, 23, 12, 197, 23,
-  15, 26, 24, 16, 38, 24, 17, 50, 24, 22, 141, 24, 23, 215, 24, 24, 87, 25, 0,
-  70, 139, 21, 7, 175, 21, 8, 194, 21, 12, 204, 21, 15, 44, 22, 16, 82, 22, 17,
-  134, 22, 21, 164, 22, 23, 32, 23, 24, 82, 23, 0, 12, 0, 75, 148, 21, 22, 162,
-  21, 0, 19, 18, 22, 0, 132, 115, 116, 105, 99, 97, 116, 101, 100, 0, 22, 8, 7,
-  0, 134, 105, 99, 99, 97, 116, 101, 100, 0, 12, 19, 4, 15, 8, 7, 0, 137, 105,
-  108, 97, 112, 105, 100, 97, 116, 101, 100, 0, 15, 8, 21, 0, 132, 97, 116, 101,
-  100, 0, 70, 220, 21, 15, 234, 21, 19, 245, 21, 21, 3, 22, 25, 19, 22, 0, 18,
-  22, 4, 0, 134, 115, 111, 99, 105, 97, 116, 101, 100, 0, 12, 23, 24, 16, 0,
-  132, 97, 116, 101, 100, 0, 18, 21, 19, 27, 8, 0, 132, 114, 105, 97, 116, 101,
-  100, 0, 18, 8, 23, 8, 7, 0, 134, 114, 105, 111, 114, 97, 116, 101, 100, 0, 12,
-  0, 85, 28, 22, 23, 35, 22, 0, 8, 7, 0, 132, 101, 100, 0, 18, 16, 0, 132, 97,
-  116, 101, 100, 0, 72, 51, 22, 24, 66, 22, 0, 21, 8, 23, 17, 12, 0, 133, 114,
+  115, 101, 100, 0, 68, 29, 22, 6, 20, 24, 8, 85, 24, 9, 113, 24, 12, 118, 24,
+  15, 203, 24, 16, 215, 24, 17, 227, 24, 22, 62, 25, 23, 136, 25, 24, 8, 26, 0,
+  70, 60, 22, 7, 96, 22, 8, 115, 22, 12, 125, 22, 15, 221, 22, 16, 3, 23, 17,
+  55, 23, 21, 85, 23, 23, 209, 23, 24, 3, 24, 0, 12, 0, 75, 69, 22, 22, 83, 22,
+  0, 19, 18, 22, 0, 132, 115, 116, 105, 99, 97, 116, 101, 100, 0, 22, 8, 7, 0,
+  134, 105, 99, 99, 97, 116, 101, 100, 0, 12, 19, 4, 15, 8, 7, 0, 137, 105, 108,
+  97, 112, 105, 100, 97, 116, 101, 100, 0, 15, 8, 21, 0, 132, 97, 116, 101, 100,
+  0, 70, 141, 22, 15, 155, 22, 19, 166, 22, 21, 180, 22, 25, 196, 22, 0, 18, 22,
+  4, 0, 134, 115, 111, 99, 105, 97, 116, 101, 100, 0, 12, 23, 24, 16, 0, 132,
+  97, 116, 101, 100, 0, 18, 21, 19, 27, 8, 0, 132, 114, 105, 97, 116, 101, 100,
+  0, 18, 8, 23, 8, 7, 0, 134, 114, 105, 111, 114, 97, 116, 101, 100, 0, 12, 0,
+  85, 205, 22, 23, 212, 22, 0, 8, 7, 0, 132, 101, 100, 0, 18, 16, 0, 132, 97,
+  116, 101, 100, 0, 72, 228, 22, 24, 243, 22, 0, 21, 8, 23, 17, 12, 0, 133, 114,
   101, 108, 97, 116, 101, 100, 0, 6, 18, 17, 17, 12, 0, 136, 111, 99, 117, 108,
-  97, 116, 101, 100, 0, 82, 89, 22, 23, 121, 22, 0, 74, 96, 22, 21, 109, 22, 0,
+  97, 116, 101, 100, 0, 82, 10, 23, 23, 42, 23, 0, 74, 17, 23, 21, 30, 23, 0,
   15, 4, 16, 4, 0, 133, 97, 109, 97, 116, 101, 100, 0, 24, 4, 0, 134, 116, 111,
   109, 97, 116, 101, 100, 0, 12, 22, 8, 0, 134, 116, 105, 109, 97, 116, 101,
-  100, 0, 12, 0, 70, 143, 22, 16, 156, 22, 0, 4, 9, 0, 134, 115, 99, 105, 110,
-  97, 116, 101, 100, 0, 4, 27, 8, 0, 131, 101, 100, 0, 74, 177, 22, 12, 218, 22,
-  18, 233, 22, 24, 17, 23, 0, 72, 184, 22, 21, 205, 22, 0, 23, 17, 12, 22, 8, 7,
-  0, 139, 105, 115, 105, 110, 116, 101, 103, 114, 97, 116, 101, 100, 0, 8, 23,
-  17, 12, 0, 134, 103, 114, 97, 116, 101, 100, 0, 6, 21, 4, 6, 17, 12, 0, 133,
-  101, 114, 97, 116, 101, 100, 0, 80, 240, 22, 19, 1, 23, 0, 8, 16, 16, 16, 18,
-  6, 0, 136, 101, 109, 111, 114, 97, 116, 101, 100, 0, 18, 21, 18, 6, 17, 12, 0,
+  100, 0, 12, 0, 70, 64, 23, 16, 77, 23, 0, 4, 9, 0, 134, 115, 99, 105, 110, 97,
+  116, 101, 100, 0, 4, 27, 8, 0, 131, 101, 100, 0, 74, 98, 23, 12, 139, 23, 18,
+  154, 23, 24, 194, 23, 0, 72, 105, 23, 21, 126, 23, 0, 23, 17, 12, 22, 8, 7, 0,
+  139, 105, 115, 105, 110, 116, 101, 103, 114, 97, 116, 101, 100, 0, 8, 23, 17,
+  12, 0, 134, 103, 114, 97, 116, 101, 100, 0, 6, 21, 4, 6, 17, 12, 0, 133, 101,
+  114, 97, 116, 101, 100, 0, 80, 161, 23, 19, 178, 23, 0, 8, 16, 16, 16, 18, 6,
+  0, 136, 101, 109, 111, 114, 97, 116, 101, 100, 0, 18, 21, 18, 6, 17, 12, 0,
   135, 112, 111, 114, 97, 116, 101, 100, 0, 10, 4, 17, 12, 0, 134, 117, 103,
-  117, 114, 97, 116, 101, 100, 0, 76, 39, 23, 22, 68, 23, 0, 79, 46, 23, 21, 57,
-  23, 0, 4, 23, 8, 21, 0, 132, 97, 116, 101, 100, 0, 12, 0, 133, 114, 105, 116,
-  97, 116, 101, 100, 0, 8, 25, 8, 7, 0, 134, 97, 115, 116, 97, 116, 101, 100, 0,
-  15, 4, 25, 8, 21, 0, 135, 101, 118, 97, 108, 117, 97, 116, 101, 100, 0, 72,
-  106, 23, 12, 151, 23, 0, 79, 113, 23, 17, 140, 23, 0, 72, 120, 23, 15, 131,
-  23, 0, 21, 0, 133, 101, 108, 101, 99, 116, 101, 100, 0, 8, 0, 133, 101, 99,
+  117, 114, 97, 116, 101, 100, 0, 76, 216, 23, 22, 245, 23, 0, 79, 223, 23, 21,
+  234, 23, 0, 4, 23, 8, 21, 0, 132, 97, 116, 101, 100, 0, 12, 0, 133, 114, 105,
+  116, 97, 116, 101, 100, 0, 8, 25, 8, 7, 0, 134, 97, 115, 116, 97, 116, 101,
+  100, 0, 15, 4, 25, 8, 21, 0, 135, 101, 118, 97, 108, 117, 97, 116, 101, 100,
+  0, 72, 27, 24, 12, 72, 24, 0, 79, 34, 24, 17, 61, 24, 0, 72, 41, 24, 15, 52,
+  24, 0, 21, 0, 133, 101, 108, 101, 99, 116, 101, 100, 0, 8, 0, 133, 101, 99,
   116, 101, 100, 0, 18, 6, 0, 132, 110, 101, 99, 116, 101, 100, 0, 23, 22, 8,
-  21, 0, 132, 114, 105, 99, 116, 101, 100, 0, 68, 171, 23, 12, 180, 23, 0, 8,
-  21, 6, 0, 131, 116, 101, 100, 0, 6, 17, 18, 6, 0, 132, 101, 105, 116, 101,
-  100, 0, 8, 15, 0, 129, 0, 80, 207, 23, 22, 7, 24, 24, 17, 24, 0, 71, 220, 23,
-  8, 227, 23, 16, 232, 23, 18, 253, 23, 0, 4, 0, 129, 116, 101, 100, 0, 129,
-  116, 101, 100, 0, 72, 239, 23, 18, 246, 23, 0, 132, 105, 116, 116, 101, 100,
-  0, 6, 0, 129, 116, 101, 100, 0, 6, 0, 131, 109, 105, 116, 116, 101, 100, 0,
-  18, 11, 0, 132, 105, 115, 116, 101, 100, 0, 20, 6, 4, 0, 129, 116, 101, 100,
-  0, 4, 11, 27, 8, 0, 133, 97, 108, 116, 101, 100, 0, 19, 18, 21, 19, 0, 132,
-  109, 112, 116, 101, 100, 0, 72, 57, 24, 12, 106, 24, 0, 76, 67, 24, 23, 85,
-  24, 24, 96, 24, 0, 21, 18, 22, 8, 7, 0, 137, 105, 115, 111, 114, 105, 101,
-  110, 116, 101, 100, 0, 23, 4, 19, 0, 133, 101, 110, 116, 101, 100, 0, 15, 9,
-  17, 12, 0, 130, 99, 101, 100, 0, 4, 24, 20, 0, 68, 117, 24, 6, 128, 24, 0,
-  135, 99, 113, 117, 97, 105, 110, 116, 101, 100, 0, 6, 4, 0, 136, 113, 117, 97,
-  105, 110, 116, 101, 100, 0, 68, 154, 24, 12, 182, 24, 17, 193, 24, 24, 199,
-  24, 0, 70, 161, 24, 25, 173, 24, 0, 4, 18, 21, 5, 0, 133, 100, 99, 97, 115,
-  116, 0, 8, 7, 0, 129, 97, 116, 101, 100, 0, 6, 27, 8, 0, 133, 105, 115, 116,
-  101, 100, 0, 12, 0, 128, 97, 100, 0, 21, 23, 17, 12, 0, 136, 101, 110, 116,
-  114, 117, 115, 116, 101, 100, 0, 72, 225, 24, 12, 234, 24, 18, 62, 25, 0, 10,
-  21, 4, 23, 0, 130, 101, 100, 0, 80, 241, 24, 24, 41, 25, 0, 80, 251, 24, 17,
-  18, 25, 18, 31, 25, 0, 72, 2, 25, 18, 9, 25, 0, 133, 105, 116, 116, 101, 100,
-  0, 44, 0, 133, 105, 116, 116, 101, 100, 0, 21, 18, 6, 0, 135, 109, 109, 105,
-  116, 116, 101, 100, 0, 6, 0, 132, 109, 105, 116, 116, 101, 100, 0, 20, 0, 108,
-  50, 25, 4, 52, 25, 0, 130, 0, 134, 99, 113, 117, 105, 116, 116, 101, 100, 0,
-  79, 69, 25, 16, 79, 25, 0, 4, 0, 132, 108, 111, 116, 116, 101, 100, 0, 18, 21,
-  19, 0, 130, 101, 100, 0, 69, 94, 25, 23, 111, 25, 0, 12, 21, 23, 12, 7, 0,
-  135, 115, 116, 114, 105, 98, 117, 116, 101, 100, 0, 12, 22, 17, 18, 6, 0, 133,
-  116, 105, 116, 117, 116, 101, 100, 0, 71, 136, 25, 15, 147, 25, 23, 155, 25,
-  0, 18, 21, 23, 17, 12, 0, 129, 99, 101, 100, 0, 6, 17, 12, 0, 129, 100, 101,
-  0, 70, 162, 25, 19, 172, 25, 0, 8, 27, 8, 0, 131, 117, 116, 101, 100, 0, 4, 6,
-  0, 129, 114, 101, 100, 0, 72, 190, 25, 12, 230, 25, 15, 15, 26, 0, 12, 0, 70,
-  202, 25, 15, 213, 25, 21, 218, 25, 0, 17, 18, 6, 0, 132, 101, 105, 118, 101,
-  100, 0, 131, 118, 101, 100, 0, 10, 4, 0, 133, 103, 114, 105, 101, 118, 101,
-  100, 0, 70, 240, 25, 17, 250, 25, 21, 4, 26, 0, 8, 21, 0, 131, 101, 105, 118,
-  101, 100, 0, 18, 6, 0, 131, 110, 105, 118, 101, 100, 0, 12, 7, 0, 133, 101,
-  114, 105, 118, 101, 100, 0, 18, 22, 12, 7, 0, 132, 115, 111, 108, 118, 101,
-  100, 0, 82, 35, 26, 26, 45, 26, 0, 15, 4, 0, 131, 108, 111, 119, 101, 100, 0,
-  4, 17, 10, 0, 130, 101, 100, 0, 68, 60, 26, 17, 109, 26, 0, 79, 73, 26, 19,
-  79, 26, 21, 83, 26, 23, 98, 26, 0, 44, 0, 130, 105, 100, 0, 130, 105, 100, 0,
-  23, 18, 21, 19, 0, 135, 111, 114, 116, 114, 97, 121, 101, 100, 0, 21, 18, 19,
-  0, 131, 114, 97, 121, 101, 100, 0, 4, 19, 16, 18, 6, 6, 4, 0, 130, 105, 101,
-  100, 0, 12, 0, 79, 137, 26, 17, 196, 26, 21, 228, 26, 23, 56, 27, 0, 68, 147,
-  26, 5, 172, 26, 8, 186, 26, 0, 17, 18, 12, 23, 24, 23, 22, 17, 12, 0, 138,
-  105, 116, 117, 116, 105, 111, 110, 97, 108, 105, 122, 101, 100, 0, 4, 23, 22,
-  8, 7, 0, 132, 105, 108, 105, 122, 101, 100, 0, 21, 0, 132, 97, 108, 105, 115,
-  101, 100, 0, 76, 203, 26, 18, 216, 26, 0, 25, 15, 4, 10, 0, 133, 97, 110, 105,
-  122, 101, 100, 0, 6, 8, 21, 0, 132, 103, 110, 105, 122, 101, 100, 0, 68, 238,
-  26, 8, 253, 26, 18, 40, 27, 0, 23, 24, 19, 16, 18, 6, 0, 133, 101, 114, 105,
-  122, 101, 100, 0, 23, 0, 68, 6, 27, 6, 21, 27, 0, 21, 4, 11, 6, 0, 134, 99,
-  116, 101, 114, 105, 122, 101, 100, 0, 4, 21, 4, 6, 0, 138, 104, 97, 114, 97,
-  99, 116, 101, 114, 105, 122, 101, 100, 0, 10, 4, 23, 4, 6, 0, 135, 101, 103,
-  111, 114, 105, 122, 101, 100, 0, 12, 21, 6, 0, 130, 99, 105, 122, 101, 100, 0,
-  68, 83, 27, 14, 92, 27, 18, 101, 27, 19, 114, 27, 21, 124, 27, 0, 21, 28, 16,
-  0, 130, 105, 97, 100, 0, 24, 15, 0, 131, 105, 107, 117, 100, 0, 17, 12, 16,
-  24, 11, 0, 132, 97, 110, 111, 105, 100, 0, 8, 21, 44, 0, 131, 97, 112, 105,
-  100, 0, 11, 23, 0, 130, 105, 114, 100, 0, 8, 15, 4, 23, 0, 130, 107, 101, 100,
-  0, 72, 152, 27, 12, 161, 27, 18, 193, 27, 0, 16, 4, 17, 8, 0, 128, 101, 100,
-  0, 8, 0, 73, 173, 27, 11, 179, 27, 28, 187, 27, 0, 131, 105, 101, 108, 100, 0,
-  22, 0, 131, 105, 101, 108, 100, 0, 131, 105, 101, 108, 100, 0, 22, 8, 21, 11,
-  23, 0, 130, 104, 111, 108, 100, 0, 68, 224, 27, 8, 239, 27, 12, 84, 28, 18,
-  94, 28, 21, 110, 28, 24, 119, 28, 0, 15, 24, 9, 8, 6, 4, 8, 19, 0, 130, 32,
-  97, 110, 100, 0, 80, 252, 27, 19, 56, 28, 21, 64, 28, 23, 74, 28, 0, 80, 3,
-  28, 18, 28, 28, 0, 68, 10, 28, 18, 15, 28, 0, 131, 101, 110, 100, 0, 6, 6, 8,
-  21, 0, 134, 111, 109, 109, 101, 110, 100, 0, 6, 0, 70, 37, 28, 8, 48, 28, 0,
-  8, 21, 0, 133, 111, 109, 109, 101, 110, 100, 0, 21, 0, 130, 109, 101, 110,
-  100, 0, 19, 4, 11, 0, 128, 101, 100, 0, 12, 9, 0, 132, 114, 105, 101, 110,
-  100, 0, 4, 8, 21, 11, 23, 0, 128, 101, 100, 0, 8, 21, 9, 0, 131, 105, 101,
-  110, 100, 0, 19, 22, 12, 21, 21, 18, 6, 0, 133, 101, 115, 112, 111, 110, 100,
-  0, 24, 23, 8, 21, 0, 128, 101, 100, 0, 82, 126, 28, 21, 152, 28, 0, 21, 0, 85,
-  135, 28, 24, 143, 28, 0, 4, 0, 132, 111, 117, 110, 100, 0, 22, 0, 131, 114,
-  111, 117, 110, 100, 0, 68, 159, 28, 18, 165, 28, 0, 130, 111, 117, 110, 100,
-  0, 10, 14, 6, 4, 5, 0, 132, 114, 111, 117, 110, 100, 0, 76, 188, 28, 18, 231,
-  28, 21, 31, 29, 0, 72, 195, 28, 21, 205, 28, 0, 21, 19, 0, 132, 101, 114, 105,
-  111, 100, 0, 8, 0, 85, 214, 28, 23, 223, 28, 0, 19, 0, 133, 101, 114, 105,
-  111, 100, 0, 22, 4, 0, 130, 111, 105, 100, 0, 75, 238, 28, 23, 19, 29, 0, 85,
-  245, 28, 28, 6, 29, 0, 18, 5, 10, 12, 8, 17, 0, 134, 104, 98, 111, 114, 104,
-  111, 111, 100, 0, 15, 8, 14, 12, 15, 0, 132, 105, 104, 111, 111, 100, 0, 22,
-  8, 12, 21, 19, 0, 130, 104, 111, 111, 100, 0, 6, 8, 21, 0, 130, 111, 114, 100,
-  0, 68, 56, 29, 8, 83, 29, 12, 120, 29, 18, 131, 29, 24, 142, 29, 0, 26, 0, 72,
-  65, 29, 18, 74, 29, 0, 21, 18, 9, 0, 130, 111, 114, 100, 0, 9, 0, 131, 114,
-  119, 97, 114, 100, 0, 71, 93, 29, 12, 103, 29, 24, 111, 29, 0, 12, 22, 17, 18,
-  6, 0, 128, 101, 100, 0, 26, 0, 131, 101, 105, 114, 100, 0, 20, 17, 18, 6, 0,
-  128, 101, 100, 0, 5, 7, 15, 12, 11, 6, 0, 128, 116, 104, 0, 6, 18, 21, 0, 132,
-  101, 99, 111, 114, 100, 0, 68, 149, 29, 23, 157, 29, 0, 10, 0, 131, 117, 97,
-  114, 100, 0, 19, 4, 6, 0, 128, 101, 100, 0, 79, 172, 29, 18, 181, 29, 0, 18,
-  11, 22, 0, 130, 117, 108, 100, 0, 21, 4, 0, 128, 110, 100, 0, 4, 8, 21, 15, 4,
-  0, 129, 100, 121, 0, 68, 6, 30, 5, 79, 30, 6, 173, 30, 7, 31, 38, 8, 66, 39,
-  10, 214, 39, 11, 58, 42, 12, 183, 42, 14, 208, 42, 15, 242, 42, 16, 65, 49,
-  17, 184, 49, 18, 106, 51, 19, 139, 51, 21, 192, 51, 22, 64, 54, 23, 4, 56, 24,
-  188, 61, 25, 32, 62, 28, 104, 65, 29, 113, 65, 0, 70, 22, 30, 7, 34, 30, 14,
-  44, 30, 16, 51, 30, 25, 70, 30, 0, 19, 22, 8, 16, 4, 17, 0, 130, 97, 99, 101,
-  0, 12, 8, 4, 7, 12, 0, 133, 101, 97, 0, 16, 0, 130, 97, 107, 101, 0, 68, 58,
-  30, 17, 65, 30, 0, 6, 8, 5, 0, 129, 101, 0, 130, 97, 109, 101, 0, 4, 15, 0,
-  130, 114, 118, 97, 101, 0, 68, 92, 30, 12, 102, 30, 15, 134, 30, 18, 160, 30,
-  0, 15, 12, 4, 25, 4, 0, 128, 108, 101, 0, 21, 6, 0, 72, 112, 30, 22, 122, 30,
-  0, 7, 0, 132, 115, 99, 114, 105, 98, 101, 0, 12, 7, 0, 134, 101, 115, 99, 114,
-  105, 98, 101, 0, 68, 141, 30, 24, 152, 30, 0, 15, 12, 4, 25, 4, 0, 130, 98,
-  108, 101, 0, 18, 7, 0, 130, 98, 108, 101, 0, 19, 18, 21, 7, 28, 11, 0, 130,
-  104, 111, 98, 101, 0, 68, 198, 30, 8, 239, 30, 12, 42, 31, 16, 120, 31, 17,
-  132, 31, 19, 229, 37, 23, 242, 37, 24, 253, 37, 0, 82, 205, 30, 23, 213, 30,
-  0, 19, 22, 0, 131, 97, 99, 101, 0, 22, 0, 69, 222, 30, 12, 230, 30, 0, 24, 22,
-  0, 129, 110, 99, 101, 0, 16, 21, 4, 0, 130, 105, 99, 101, 0, 71, 249, 30, 17,
-  6, 31, 21, 32, 31, 0, 17, 8, 19, 8, 7, 17, 12, 0, 129, 110, 99, 101, 0, 72,
-  13, 31, 12, 23, 31, 0, 21, 8, 9, 8, 21, 0, 130, 99, 101, 0, 6, 22, 0, 131,
-  101, 110, 99, 101, 0, 8, 9, 8, 21, 0, 129, 110, 99, 101, 0, 70, 55, 31, 8, 63,
-  31, 23, 84, 31, 25, 95, 31, 0, 8, 21, 19, 0, 129, 115, 101, 0, 81, 70, 31, 19,
-  76, 31, 0, 131, 105, 101, 99, 101, 0, 44, 0, 131, 105, 101, 99, 101, 0, 4, 21,
-  19, 0, 131, 99, 116, 105, 99, 101, 0, 72, 102, 31, 12, 111, 31, 0, 22, 0, 131,
-  114, 118, 105, 99, 101, 0, 7, 0, 132, 101, 118, 105, 99, 101, 0, 8, 21, 8, 9,
-  8, 21, 0, 130, 110, 99, 101, 0, 68, 151, 31, 8, 97, 34, 12, 159, 37, 18, 199,
-  37, 21, 208, 37, 24, 219, 37, 0, 71, 182, 31, 8, 230, 31, 10, 21, 32, 12, 51,
-  32, 15, 79, 32, 16, 160, 32, 17, 174, 32, 21, 237, 32, 22, 166, 33, 23, 220,
-  33, 0, 81, 189, 31, 24, 219, 31, 0, 8, 0, 70, 198, 31, 19, 210, 31, 0, 22, 17,
-  4, 21, 23, 0, 131, 101, 110, 99, 101, 0, 8, 7, 0, 131, 101, 110, 99, 101, 0,
-  5, 4, 0, 132, 110, 100, 97, 110, 99, 101, 0, 21, 0, 68, 239, 31, 8, 9, 32, 0,
-  8, 0, 79, 248, 31, 19, 0, 32, 0, 6, 0, 132, 97, 110, 99, 101, 0, 19, 4, 0,
-  132, 97, 110, 99, 101, 0, 19, 19, 4, 0, 133, 97, 114, 97, 110, 99, 101, 0, 76,
-  28, 32, 17, 41, 32, 0, 15, 15, 8, 23, 17, 12, 0, 131, 101, 110, 99, 101, 0, 8,
-  25, 0, 131, 101, 97, 110, 99, 101, 0, 71, 58, 32, 21, 68, 32, 0, 8, 5, 18, 0,
-  131, 101, 110, 99, 101, 0, 8, 19, 27, 8, 0, 131, 101, 110, 99, 101, 0, 68, 92,
-  32, 5, 118, 32, 8, 135, 32, 15, 149, 32, 0, 69, 99, 32, 25, 112, 32, 0, 17,
-  12, 0, 135, 109, 98, 97, 108, 97, 110, 99, 101, 0, 4, 0, 128, 104, 101, 0, 16,
-  8, 22, 22, 8, 21, 0, 136, 101, 109, 98, 108, 97, 110, 99, 101, 0, 5, 16, 8,
-  22, 8, 21, 0, 133, 108, 97, 110, 99, 101, 0, 8, 6, 27, 8, 0, 131, 101, 110,
-  99, 101, 0, 18, 9, 21, 8, 19, 0, 132, 114, 109, 97, 110, 99, 101, 0, 76, 181,
-  32, 23, 224, 32, 0, 68, 191, 32, 9, 205, 32, 16, 214, 32, 0, 23, 17, 12, 4,
-  16, 0, 134, 101, 110, 97, 110, 99, 101, 0, 8, 7, 0, 132, 97, 110, 99, 101, 0,
-  18, 21, 19, 0, 131, 101, 110, 99, 101, 0, 17, 12, 4, 16, 0, 132, 101, 110, 97,
-  110, 99, 101, 0, 68, 250, 32, 8, 9, 33, 21, 116, 33, 24, 155, 33, 0, 8, 21,
-  19, 19, 4, 0, 135, 101, 97, 114, 97, 110, 99, 101, 0, 69, 28, 33, 7, 63, 33,
-  9, 74, 33, 11, 86, 33, 19, 95, 33, 25, 106, 33, 0, 80, 35, 33, 24, 47, 33, 0,
-  8, 16, 8, 21, 0, 133, 114, 97, 110, 99, 101, 0, 21, 23, 18, 21, 19, 0, 136,
-  117, 98, 101, 114, 97, 110, 99, 101, 0, 17, 12, 11, 0, 133, 114, 97, 110, 99,
-  101, 0, 21, 8, 23, 17, 12, 0, 131, 101, 110, 99, 101, 0, 7, 4, 0, 131, 101,
-  110, 99, 101, 0, 19, 4, 0, 132, 97, 114, 97, 110, 99, 101, 0, 18, 10, 0, 131,
-  110, 97, 110, 99, 101, 0, 24, 6, 0, 70, 129, 33, 8, 137, 33, 18, 145, 33, 0,
-  18, 0, 131, 101, 110, 99, 101, 0, 21, 0, 131, 101, 110, 99, 101, 0, 134, 99,
-  117, 114, 114, 101, 110, 99, 101, 0, 6, 6, 18, 0, 131, 114, 101, 110, 99, 101,
-  0, 76, 176, 33, 22, 191, 33, 24, 210, 33, 0, 4, 17, 17, 18, 6, 8, 21, 0, 131,
-  115, 97, 110, 99, 101, 0, 12, 4, 17, 18, 6, 8, 21, 0, 135, 110, 97, 105, 115,
-  115, 97, 110, 99, 101, 0, 17, 0, 132, 105, 115, 97, 110, 99, 101, 0, 68, 233,
-  33, 8, 243, 33, 17, 254, 33, 22, 56, 34, 0, 23, 22, 17, 12, 0, 132, 110, 99,
-  101, 0, 19, 16, 18, 6, 0, 131, 101, 110, 99, 101, 0, 68, 5, 34, 12, 23, 34, 0,
-  12, 24, 20, 4, 0, 137, 99, 113, 117, 97, 105, 110, 116, 97, 110, 99, 101, 0,
-  4, 0, 80, 32, 34, 24, 40, 34, 0, 131, 101, 110, 97, 110, 99, 101, 0, 20, 4, 0,
-  137, 99, 113, 117, 97, 105, 110, 116, 97, 110, 99, 101, 0, 12, 0, 86, 65, 34,
-  27, 89, 34, 0, 81, 72, 34, 21, 80, 34, 0, 12, 0, 131, 101, 110, 99, 101, 0, 8,
-  19, 0, 131, 101, 110, 99, 101, 0, 8, 0, 131, 101, 110, 99, 101, 0, 70, 134,
-  34, 7, 162, 34, 10, 3, 35, 12, 48, 35, 15, 95, 35, 16, 159, 35, 17, 172, 35,
-  19, 226, 35, 21, 249, 35, 22, 255, 36, 23, 40, 37, 25, 148, 37, 0, 82, 141,
-  34, 22, 153, 34, 0, 17, 12, 0, 133, 110, 111, 99, 101, 110, 99, 101, 0, 5, 4,
-  0, 132, 101, 110, 99, 101, 0, 72, 172, 34, 12, 216, 34, 17, 225, 34, 0, 72,
-  179, 34, 19, 189, 34, 0, 21, 6, 0, 133, 100, 101, 110, 99, 101, 0, 72, 196,
-  34, 16, 208, 34, 0, 7, 17, 12, 0, 132, 110, 100, 101, 110, 99, 101, 0, 12, 0,
-  131, 97, 110, 99, 101, 0, 24, 10, 0, 131, 97, 110, 99, 101, 0, 8, 0, 83, 234,
-  34, 23, 250, 34, 0, 12, 7, 17, 12, 0, 136, 101, 112, 101, 110, 100, 101, 110,
-  99, 101, 0, 23, 4, 0, 131, 97, 110, 99, 101, 0, 72, 13, 35, 12, 24, 35, 17,
-  39, 35, 0, 15, 15, 4, 0, 131, 105, 97, 110, 99, 101, 0, 15, 8, 23, 17, 12, 0,
-  133, 108, 105, 103, 101, 110, 99, 101, 0, 8, 25, 0, 130, 97, 110, 99, 101, 0,
-  74, 55, 35, 23, 83, 35, 0, 8, 15, 0, 68, 65, 35, 15, 75, 35, 0, 134, 108, 101,
-  103, 105, 97, 110, 99, 101, 0, 4, 0, 131, 97, 110, 99, 101, 0, 12, 4, 19, 0,
-  134, 116, 105, 101, 110, 99, 101, 0, 69, 105, 35, 12, 137, 35, 24, 147, 35, 0,
-  16, 8, 22, 0, 72, 116, 35, 22, 124, 35, 0, 21, 0, 131, 97, 110, 99, 101, 0, 8,
-  21, 0, 136, 101, 109, 98, 108, 97, 110, 99, 101, 0, 10, 12, 25, 0, 131, 97,
-  110, 99, 101, 0, 9, 9, 8, 0, 133, 108, 117, 101, 110, 99, 101, 0, 21, 18, 9,
-  21, 8, 19, 0, 131, 97, 110, 99, 101, 0, 72, 179, 35, 12, 191, 35, 0, 23, 17,
-  12, 4, 16, 0, 131, 97, 110, 99, 101, 0, 68, 198, 35, 16, 212, 35, 0, 23, 17,
-  12, 4, 16, 0, 134, 101, 110, 97, 110, 99, 101, 0, 8, 21, 19, 0, 134, 101, 109,
-  105, 110, 101, 110, 99, 101, 0, 80, 233, 35, 22, 242, 35, 0, 18, 6, 8, 21, 0,
-  129, 115, 101, 0, 12, 7, 0, 129, 115, 101, 0, 68, 21, 36, 5, 32, 36, 7, 44,
-  36, 8, 54, 36, 9, 145, 36, 12, 156, 36, 18, 169, 36, 21, 179, 36, 24, 229, 36,
-  0, 8, 19, 19, 4, 0, 131, 97, 110, 99, 101, 0, 16, 8, 16, 8, 21, 0, 131, 97,
-  110, 99, 101, 0, 17, 12, 11, 0, 131, 97, 110, 99, 101, 0, 71, 70, 36, 9, 81,
-  36, 12, 111, 36, 15, 124, 36, 25, 133, 36, 0, 17, 12, 11, 0, 133, 114, 97,
-  110, 99, 101, 0, 73, 88, 36, 21, 99, 36, 0, 8, 21, 0, 134, 101, 114, 101, 110,
-  99, 101, 0, 44, 0, 134, 101, 102, 101, 114, 101, 110, 99, 101, 0, 19, 27, 8,
-  0, 134, 101, 114, 105, 101, 110, 99, 101, 0, 18, 23, 0, 131, 97, 110, 99, 101,
-  0, 8, 22, 21, 8, 19, 0, 131, 97, 110, 99, 101, 0, 8, 21, 0, 132, 101, 114,
-  101, 110, 99, 101, 0, 19, 27, 8, 0, 133, 101, 114, 105, 101, 110, 99, 101, 0,
-  17, 10, 12, 0, 131, 97, 110, 99, 101, 0, 72, 186, 36, 24, 196, 36, 0, 9, 8,
-  21, 0, 132, 101, 110, 99, 101, 0, 6, 0, 70, 205, 36, 18, 219, 36, 0, 18, 8,
-  21, 0, 137, 99, 117, 114, 114, 101, 110, 99, 101, 0, 134, 99, 117, 114, 114,
-  101, 110, 99, 101, 0, 70, 236, 36, 22, 246, 36, 0, 6, 18, 0, 131, 114, 101,
-  110, 99, 101, 0, 17, 12, 0, 131, 97, 110, 99, 101, 0, 76, 9, 37, 17, 18, 37,
-  22, 25, 37, 0, 15, 0, 132, 99, 101, 110, 115, 101, 0, 18, 17, 0, 129, 115,
-  101, 0, 12, 4, 17, 17, 18, 6, 8, 21, 0, 131, 97, 110, 99, 101, 0, 76, 53, 37,
-  17, 65, 37, 19, 126, 37, 22, 137, 37, 0, 21, 8, 11, 17, 12, 0, 131, 97, 110,
-  99, 101, 0, 68, 75, 37, 8, 91, 37, 12, 101, 37, 0, 12, 24, 20, 6, 4, 0, 135,
-  97, 105, 110, 116, 97, 110, 99, 101, 0, 19, 8, 21, 0, 131, 97, 110, 99, 101,
-  0, 4, 0, 80, 110, 37, 24, 116, 37, 0, 129, 97, 110, 99, 101, 0, 20, 6, 4, 0,
-  131, 97, 110, 99, 101, 0, 8, 6, 6, 4, 0, 131, 97, 110, 99, 101, 0, 12, 22, 8,
-  21, 0, 131, 97, 110, 99, 101, 0, 8, 15, 8, 21, 0, 131, 97, 110, 99, 101, 0,
-  70, 169, 37, 8, 177, 37, 23, 188, 37, 0, 22, 0, 130, 101, 110, 99, 101, 0, 7,
-  24, 4, 0, 132, 105, 101, 110, 99, 101, 0, 22, 12, 27, 8, 0, 131, 101, 110, 99,
-  101, 0, 19, 22, 8, 21, 0, 129, 115, 101, 0, 8, 9, 8, 21, 0, 130, 101, 110, 99,
-  101, 0, 20, 8, 22, 0, 130, 101, 110, 99, 101, 0, 4, 22, 8, 16, 4, 17, 0, 131,
-  112, 97, 99, 101, 0, 17, 8, 15, 18, 12, 25, 0, 130, 99, 101, 0, 7, 0, 81, 6,
-  38, 18, 16, 38, 0, 8, 0, 133, 105, 110, 100, 117, 99, 101, 0, 21, 23, 6, 17,
-  12, 0, 135, 116, 114, 111, 100, 117, 99, 101, 0, 68, 47, 38, 8, 123, 38, 12,
-  155, 38, 18, 23, 39, 24, 52, 39, 0, 79, 63, 38, 17, 76, 38, 21, 90, 38, 23,
-  100, 38, 24, 109, 38, 0, 8, 16, 21, 4, 16, 0, 132, 97, 108, 97, 100, 101, 0,
-  18, 15, 15, 18, 6, 0, 133, 111, 110, 110, 97, 100, 101, 0, 8, 19, 0, 132, 97,
-  114, 97, 100, 101, 0, 22, 17, 12, 0, 130, 101, 97, 100, 0, 22, 21, 24, 19, 0,
-  134, 101, 114, 115, 117, 97, 100, 101, 0, 70, 130, 38, 19, 142, 38, 0, 21, 8,
-  19, 24, 22, 0, 131, 115, 101, 100, 101, 0, 8, 15, 15, 12, 16, 0, 132, 105,
-  112, 101, 100, 101, 0, 68, 174, 38, 6, 178, 38, 21, 202, 38, 22, 251, 38, 23,
-  3, 39, 25, 13, 39, 0, 19, 0, 128, 0, 72, 185, 38, 24, 193, 38, 0, 21, 0, 131,
-  115, 105, 100, 101, 0, 22, 0, 131, 105, 99, 105, 100, 101, 0, 68, 209, 38, 8,
-  226, 38, 0, 6, 6, 4, 22, 28, 15, 18, 19, 0, 132, 104, 97, 114, 105, 100, 101,
-  0, 25, 0, 82, 235, 38, 25, 241, 38, 0, 130, 114, 105, 100, 101, 0, 18, 0, 133,
-  101, 114, 114, 105, 100, 101, 0, 22, 4, 0, 131, 105, 100, 101, 0, 12, 23, 23,
-  4, 0, 130, 117, 100, 101, 0, 8, 7, 0, 132, 105, 118, 105, 100, 101, 0, 76, 30,
-  39, 22, 41, 39, 0, 22, 19, 8, 0, 132, 105, 115, 111, 100, 101, 0, 7, 12, 19,
-  8, 0, 132, 115, 111, 100, 101, 0, 23, 12, 23, 23, 4, 15, 0, 133, 105, 116,
-  117, 100, 101, 0, 72, 73, 39, 23, 79, 39, 0, 21, 11, 23, 0, 128, 0, 68, 92,
-  39, 12, 103, 39, 17, 113, 39, 23, 201, 39, 0, 21, 4, 24, 10, 0, 130, 110, 116,
-  101, 101, 0, 16, 16, 18, 6, 0, 129, 116, 101, 101, 0, 68, 120, 39, 8, 169, 39,
-  0, 21, 0, 68, 129, 39, 24, 141, 39, 0, 10, 0, 134, 117, 97, 114, 97, 110, 116,
-  101, 101, 0, 68, 148, 39, 10, 160, 39, 0, 10, 0, 135, 117, 97, 114, 97, 110,
-  116, 101, 101, 0, 133, 97, 114, 97, 110, 116, 101, 101, 0, 21, 0, 68, 178, 39,
-  24, 188, 39, 0, 24, 10, 0, 132, 97, 110, 116, 101, 101, 0, 4, 10, 0, 135, 117,
-  97, 114, 97, 110, 116, 101, 101, 0, 12, 16, 18, 6, 0, 132, 109, 105, 116, 116,
-  101, 101, 0, 68, 233, 39, 7, 7, 41, 8, 112, 41, 12, 194, 41, 16, 249, 41, 17,
-  2, 42, 0, 72, 11, 40, 10, 31, 40, 11, 42, 40, 12, 58, 40, 15, 86, 40, 16, 116,
-  40, 17, 143, 40, 21, 152, 40, 22, 196, 40, 23, 205, 40, 24, 238, 40, 0, 79,
-  18, 40, 22, 24, 40, 0, 44, 0, 128, 117, 101, 0, 24, 0, 131, 97, 103, 101, 0,
-  21, 18, 16, 0, 131, 116, 103, 97, 103, 101, 0, 21, 18, 16, 16, 8, 11, 0, 134,
-  111, 114, 114, 104, 97, 103, 101, 0, 85, 65, 40, 23, 75, 40, 0, 4, 16, 0, 131,
-  114, 105, 97, 103, 101, 0, 21, 8, 11, 0, 132, 105, 116, 97, 103, 101, 0, 73,
-  93, 40, 12, 106, 40, 0, 18, 16, 4, 6, 0, 132, 117, 102, 108, 97, 103, 101, 0,
-  25, 12, 21, 19, 0, 130, 101, 103, 101, 0, 16, 0, 68, 125, 40, 12, 132, 40, 0,
-  7, 0, 131, 97, 103, 101, 0, 21, 10, 15, 12, 19, 0, 131, 97, 103, 101, 0, 11,
-  6, 0, 131, 97, 110, 103, 101, 0, 72, 159, 40, 21, 170, 40, 0, 9, 9, 24, 22, 0,
-  132, 114, 97, 103, 101, 0, 68, 177, 40, 18, 185, 40, 0, 16, 0, 130, 105, 97,
-  103, 101, 0, 16, 8, 4, 11, 0, 130, 104, 97, 103, 101, 0, 8, 16, 0, 130, 115,
-  97, 103, 101, 0, 81, 212, 40, 21, 229, 40, 0, 8, 6, 8, 21, 19, 0, 136, 101,
-  114, 99, 101, 110, 116, 97, 103, 101, 0, 18, 16, 0, 130, 103, 97, 103, 101, 0,
-  10, 0, 108, 247, 40, 4, 253, 40, 0, 131, 97, 117, 103, 101, 0, 15, 0, 132,
-  110, 103, 117, 97, 103, 101, 0, 72, 14, 41, 12, 81, 41, 0, 15, 0, 68, 32, 41,
-  12, 38, 41, 15, 47, 41, 25, 53, 41, 26, 64, 41, 0, 131, 108, 101, 103, 101, 0,
-  25, 12, 21, 19, 0, 130, 103, 101, 0, 4, 0, 130, 103, 101, 0, 12, 21, 19, 0,
-  132, 105, 108, 101, 103, 101, 0, 18, 17, 14, 4, 0, 136, 99, 107, 110, 111,
-  119, 108, 101, 100, 103, 101, 0, 79, 88, 41, 21, 99, 41, 0, 12, 23, 21, 4, 6,
-  0, 131, 97, 103, 101, 0, 7, 23, 21, 4, 6, 0, 133, 114, 105, 100, 103, 101, 0,
-  15, 0, 68, 130, 41, 8, 154, 41, 12, 166, 41, 15, 176, 41, 26, 185, 41, 0, 108,
-  137, 41, 25, 143, 41, 0, 130, 108, 101, 103, 101, 0, 12, 21, 19, 0, 132, 105,
-  108, 101, 103, 101, 0, 25, 12, 21, 19, 0, 132, 105, 108, 101, 103, 101, 0, 23,
-  21, 4, 6, 0, 130, 97, 103, 101, 0, 4, 11, 6, 0, 129, 110, 103, 101, 0, 18, 17,
-  14, 0, 129, 100, 103, 101, 0, 68, 207, 41, 8, 218, 41, 15, 226, 41, 21, 239,
-  41, 0, 21, 21, 4, 16, 0, 131, 105, 97, 103, 101, 0, 22, 0, 131, 105, 101, 103,
-  101, 0, 8, 25, 12, 21, 19, 0, 132, 105, 108, 101, 103, 101, 0, 23, 21, 4, 6,
-  0, 129, 100, 103, 101, 0, 4, 12, 0, 131, 109, 97, 103, 101, 0, 68, 9, 42, 24,
-  49, 42, 0, 70, 19, 42, 15, 29, 42, 23, 40, 42, 0, 27, 8, 0, 131, 104, 97, 110,
-  103, 101, 0, 15, 4, 11, 6, 0, 131, 101, 110, 103, 101, 0, 22, 0, 131, 114, 97,
-  110, 103, 101, 0, 18, 23, 0, 131, 110, 103, 117, 101, 0, 70, 68, 42, 23, 76,
-  42, 28, 175, 42, 0, 4, 16, 18, 23, 22, 0, 128, 0, 71, 92, 42, 16, 122, 42, 18,
-  132, 42, 22, 141, 42, 23, 150, 42, 0, 72, 99, 42, 17, 113, 42, 0, 23, 8, 15,
-  19, 16, 18, 6, 0, 130, 32, 116, 104, 101, 0, 4, 44, 0, 130, 32, 116, 104, 101,
-  0, 18, 21, 9, 0, 130, 32, 116, 104, 101, 0, 23, 44, 0, 130, 32, 116, 104, 101,
-  0, 4, 44, 0, 130, 32, 116, 104, 101, 0, 68, 157, 42, 24, 165, 42, 0, 44, 0,
-  130, 32, 116, 104, 101, 0, 18, 5, 4, 0, 130, 32, 116, 104, 101, 0, 23, 44, 0,
-  130, 104, 101, 121, 0, 85, 190, 42, 29, 200, 42, 0, 4, 21, 19, 0, 130, 105,
-  114, 105, 101, 0, 22, 44, 0, 130, 105, 122, 101, 0, 80, 218, 42, 21, 226, 42,
-  24, 235, 42, 0, 4, 0, 131, 109, 97, 107, 101, 0, 18, 5, 0, 131, 114, 111, 107,
-  101, 0, 12, 15, 0, 130, 107, 101, 0, 69, 20, 43, 6, 189, 47, 7, 201, 47, 12,
-  208, 47, 14, 92, 48, 15, 100, 48, 18, 106, 48, 19, 116, 48, 22, 6, 49, 23, 49,
-  49, 25, 58, 49, 0, 68, 39, 43, 12, 124, 46, 15, 138, 47, 22, 149, 47, 23, 164,
-  47, 24, 179, 47, 0, 70, 73, 43, 7, 142, 43, 8, 154, 43, 10, 41, 44, 12, 113,
-  44, 15, 159, 44, 16, 203, 44, 17, 233, 44, 21, 14, 45, 22, 111, 45, 23, 249,
-  45, 0, 68, 83, 43, 12, 97, 43, 24, 129, 43, 0, 15, 19, 8, 21, 21, 12, 0, 131,
-  101, 97, 98, 108, 101, 0, 83, 104, 43, 23, 119, 43, 0, 22, 12, 7, 0, 136, 101,
-  115, 112, 105, 99, 97, 98, 108, 101, 0, 18, 17, 0, 131, 101, 97, 98, 108, 101,
-  0, 7, 18, 21, 19, 8, 21, 0, 131, 105, 98, 108, 101, 0, 8, 21, 6, 17, 12, 0,
-  131, 105, 98, 108, 101, 0, 71, 176, 43, 8, 187, 43, 15, 202, 43, 17, 212, 43,
-  21, 232, 43, 23, 6, 44, 24, 31, 44, 0, 12, 6, 8, 7, 0, 132, 97, 98, 108, 101,
-  0, 22, 21, 18, 9, 0, 134, 101, 115, 101, 101, 97, 98, 108, 101, 0, 4, 6, 22,
-  0, 132, 97, 98, 108, 101, 0, 12, 9, 8, 7, 17, 12, 0, 139, 117, 110, 100, 101,
-  102, 105, 110, 97, 98, 108, 101, 0, 76, 239, 43, 24, 249, 43, 0, 22, 8, 7, 0,
-  132, 97, 98, 108, 101, 0, 10, 12, 9, 17, 18, 6, 0, 132, 97, 98, 108, 101, 0,
-  68, 13, 44, 18, 23, 44, 0, 5, 8, 7, 0, 132, 97, 98, 108, 101, 0, 17, 0, 132,
-  97, 98, 108, 101, 0, 15, 4, 25, 0, 132, 97, 98, 108, 101, 0, 68, 54, 44, 12,
-  65, 44, 17, 89, 44, 21, 100, 44, 0, 17, 4, 16, 0, 131, 101, 97, 98, 108, 101,
-  0, 15, 0, 72, 74, 44, 10, 80, 44, 0, 131, 105, 98, 108, 101, 0, 8, 17, 0, 131,
-  105, 98, 108, 101, 0, 4, 11, 6, 0, 131, 101, 97, 98, 108, 101, 0, 4, 11, 6, 8,
-  21, 0, 131, 101, 97, 98, 108, 101, 0, 79, 120, 44, 23, 148, 44, 0, 68, 127,
-  44, 12, 138, 44, 0, 25, 4, 0, 133, 105, 108, 97, 98, 108, 101, 0, 4, 25, 4, 0,
-  132, 97, 98, 108, 101, 0, 4, 19, 16, 18, 6, 0, 131, 98, 108, 101, 0, 68, 169,
-  44, 12, 180, 44, 15, 192, 44, 0, 25, 4, 0, 132, 105, 108, 97, 98, 108, 101, 0,
-  25, 4, 0, 133, 97, 105, 108, 97, 98, 108, 101, 0, 4, 9, 17, 12, 0, 131, 105,
-  98, 108, 101, 0, 4, 0, 79, 212, 44, 21, 221, 44, 0, 9, 0, 131, 109, 97, 98,
-  108, 101, 0, 10, 18, 21, 19, 0, 131, 109, 97, 98, 108, 101, 0, 18, 0, 76, 242,
-  44, 23, 0, 45, 0, 22, 12, 9, 0, 134, 115, 105, 111, 110, 97, 98, 108, 101, 0,
-  22, 8, 24, 20, 0, 133, 105, 111, 110, 97, 98, 108, 101, 0, 72, 24, 45, 19, 61,
-  45, 23, 73, 45, 0, 69, 31, 45, 19, 48, 45, 0, 16, 8, 16, 8, 21, 0, 139, 109,
+  21, 0, 132, 114, 105, 99, 116, 101, 100, 0, 68, 92, 24, 12, 101, 24, 0, 8, 21,
+  6, 0, 131, 116, 101, 100, 0, 6, 17, 18, 6, 0, 132, 101, 105, 116, 101, 100, 0,
+  8, 15, 0, 129, 0, 80, 128, 24, 22, 184, 24, 24, 194, 24, 0, 71, 141, 24, 8,
+  148, 24, 16, 153, 24, 18, 174, 24, 0, 4, 0, 129, 116, 101, 100, 0, 129, 116,
+  101, 100, 0, 72, 160, 24, 18, 167, 24, 0, 132, 105, 116, 116, 101, 100, 0, 6,
+  0, 129, 116, 101, 100, 0, 6, 0, 131, 109, 105, 116, 116, 101, 100, 0, 18, 11,
+  0, 132, 105, 115, 116, 101, 100, 0, 20, 6, 4, 0, 129, 116, 101, 100, 0, 4, 11,
+  27, 8, 0, 133, 97, 108, 116, 101, 100, 0, 19, 18, 21, 19, 0, 132, 109, 112,
+  116, 101, 100, 0, 72, 234, 24, 12, 27, 25, 0, 76, 244, 24, 23, 6, 25, 24, 17,
+  25, 0, 21, 18, 22, 8, 7, 0, 137, 105, 115, 111, 114, 105, 101, 110, 116, 101,
+  100, 0, 23, 4, 19, 0, 133, 101, 110, 116, 101, 100, 0, 15, 9, 17, 12, 0, 130,
+  99, 101, 100, 0, 4, 24, 20, 0, 68, 38, 25, 6, 49, 25, 0, 135, 99, 113, 117,
+  97, 105, 110, 116, 101, 100, 0, 6, 4, 0, 136, 113, 117, 97, 105, 110, 116,
+  101, 100, 0, 68, 75, 25, 12, 103, 25, 17, 114, 25, 24, 120, 25, 0, 70, 82, 25,
+  25, 94, 25, 0, 4, 18, 21, 5, 0, 133, 100, 99, 97, 115, 116, 0, 8, 7, 0, 129,
+  97, 116, 101, 100, 0, 6, 27, 8, 0, 133, 105, 115, 116, 101, 100, 0, 12, 0,
+  128, 97, 100, 0, 21, 23, 17, 12, 0, 136, 101, 110, 116, 114, 117, 115, 116,
+  101, 100, 0, 72, 146, 25, 12, 155, 25, 18, 239, 25, 0, 10, 21, 4, 23, 0, 130,
+  101, 100, 0, 80, 162, 25, 24, 218, 25, 0, 80, 172, 25, 17, 195, 25, 18, 208,
+  25, 0, 72, 179, 25, 18, 186, 25, 0, 133, 105, 116, 116, 101, 100, 0, 44, 0,
+  133, 105, 116, 116, 101, 100, 0, 21, 18, 6, 0, 135, 109, 109, 105, 116, 116,
+  101, 100, 0, 6, 0, 132, 109, 105, 116, 116, 101, 100, 0, 20, 0, 108, 227, 25,
+  4, 229, 25, 0, 130, 0, 134, 99, 113, 117, 105, 116, 116, 101, 100, 0, 79, 246,
+  25, 16, 0, 26, 0, 4, 0, 132, 108, 111, 116, 116, 101, 100, 0, 18, 21, 19, 0,
+  130, 101, 100, 0, 69, 15, 26, 23, 32, 26, 0, 12, 21, 23, 12, 7, 0, 135, 115,
+  116, 114, 105, 98, 117, 116, 101, 100, 0, 12, 22, 17, 18, 6, 0, 133, 116, 105,
+  116, 117, 116, 101, 100, 0, 71, 57, 26, 15, 68, 26, 23, 76, 26, 0, 18, 21, 23,
+  17, 12, 0, 129, 99, 101, 100, 0, 6, 17, 12, 0, 129, 100, 101, 0, 70, 83, 26,
+  19, 93, 26, 0, 8, 27, 8, 0, 131, 117, 116, 101, 100, 0, 4, 6, 0, 129, 114,
+  101, 100, 0, 72, 111, 26, 12, 151, 26, 15, 192, 26, 0, 12, 0, 70, 123, 26, 15,
+  134, 26, 21, 139, 26, 0, 17, 18, 6, 0, 132, 101, 105, 118, 101, 100, 0, 131,
+  118, 101, 100, 0, 10, 4, 0, 133, 103, 114, 105, 101, 118, 101, 100, 0, 70,
+  161, 26, 17, 171, 26, 21, 181, 26, 0, 8, 21, 0, 131, 101, 105, 118, 101, 100,
+  0, 18, 6, 0, 131, 110, 105, 118, 101, 100, 0, 12, 7, 0, 133, 101, 114, 105,
+  118, 101, 100, 0, 18, 22, 12, 7, 0, 132, 115, 111, 108, 118, 101, 100, 0, 82,
+  212, 26, 26, 222, 26, 0, 15, 4, 0, 131, 108, 111, 119, 101, 100, 0, 4, 17, 10,
+  0, 130, 101, 100, 0, 68, 237, 26, 17, 30, 27, 0, 79, 250, 26, 19, 0, 27, 21,
+  4, 27, 23, 19, 27, 0, 44, 0, 130, 105, 100, 0, 130, 105, 100, 0, 23, 18, 21,
+  19, 0, 135, 111, 114, 116, 114, 97, 121, 101, 100, 0, 21, 18, 19, 0, 131, 114,
+  97, 121, 101, 100, 0, 4, 19, 16, 18, 6, 6, 4, 0, 130, 105, 101, 100, 0, 12, 0,
+  79, 58, 27, 17, 117, 27, 21, 149, 27, 23, 233, 27, 0, 68, 68, 27, 5, 93, 27,
+  8, 107, 27, 0, 17, 18, 12, 23, 24, 23, 22, 17, 12, 0, 138, 105, 116, 117, 116,
+  105, 111, 110, 97, 108, 105, 122, 101, 100, 0, 4, 23, 22, 8, 7, 0, 132, 105,
+  108, 105, 122, 101, 100, 0, 21, 0, 132, 97, 108, 105, 115, 101, 100, 0, 76,
+  124, 27, 18, 137, 27, 0, 25, 15, 4, 10, 0, 133, 97, 110, 105, 122, 101, 100,
+  0, 6, 8, 21, 0, 132, 103, 110, 105, 122, 101, 100, 0, 68, 159, 27, 8, 174, 27,
+  18, 217, 27, 0, 23, 24, 19, 16, 18, 6, 0, 133, 101, 114, 105, 122, 101, 100,
+  0, 23, 0, 68, 183, 27, 6, 198, 27, 0, 21, 4, 11, 6, 0, 134, 99, 116, 101, 114,
+  105, 122, 101, 100, 0, 4, 21, 4, 6, 0, 138, 104, 97, 114, 97, 99, 116, 101,
+  114, 105, 122, 101, 100, 0, 10, 4, 23, 4, 6, 0, 135, 101, 103, 111, 114, 105,
+  122, 101, 100, 0, 12, 21, 6, 0, 130, 99, 105, 122, 101, 100, 0, 68, 4, 28, 14,
+  13, 28, 18, 22, 28, 19, 35, 28, 21, 45, 28, 0, 21, 28, 16, 0, 130, 105, 97,
+  100, 0, 24, 15, 0, 131, 105, 107, 117, 100, 0, 17, 12, 16, 24, 11, 0, 132, 97,
+  110, 111, 105, 100, 0, 8, 21, 44, 0, 131, 97, 112, 105, 100, 0, 11, 23, 0,
+  130, 105, 114, 100, 0, 8, 15, 4, 23, 0, 130, 107, 101, 100, 0, 72, 73, 28, 12,
+  82, 28, 18, 114, 28, 0, 16, 4, 17, 8, 0, 128, 101, 100, 0, 8, 0, 73, 94, 28,
+  11, 100, 28, 28, 108, 28, 0, 131, 105, 101, 108, 100, 0, 22, 0, 131, 105, 101,
+  108, 100, 0, 131, 105, 101, 108, 100, 0, 22, 8, 21, 11, 23, 0, 130, 104, 111,
+  108, 100, 0, 68, 145, 28, 8, 160, 28, 12, 5, 29, 18, 15, 29, 21, 31, 29, 24,
+  40, 29, 0, 15, 24, 9, 8, 6, 4, 8, 19, 0, 130, 32, 97, 110, 100, 0, 80, 173,
+  28, 19, 233, 28, 21, 241, 28, 23, 251, 28, 0, 80, 180, 28, 18, 205, 28, 0, 68,
+  187, 28, 18, 192, 28, 0, 131, 101, 110, 100, 0, 6, 6, 8, 21, 0, 134, 111, 109,
+  109, 101, 110, 100, 0, 6, 0, 70, 214, 28, 8, 225, 28, 0, 8, 21, 0, 133, 111,
+  109, 109, 101, 110, 100, 0, 21, 0, 130, 109, 101, 110, 100, 0, 19, 4, 11, 0,
+  128, 101, 100, 0, 12, 9, 0, 132, 114, 105, 101, 110, 100, 0, 4, 8, 21, 11, 23,
+  0, 128, 101, 100, 0, 8, 21, 9, 0, 131, 105, 101, 110, 100, 0, 19, 22, 12, 21,
+  21, 18, 6, 0, 133, 101, 115, 112, 111, 110, 100, 0, 24, 23, 8, 21, 0, 128,
+  101, 100, 0, 82, 47, 29, 21, 73, 29, 0, 21, 0, 85, 56, 29, 24, 64, 29, 0, 4,
+  0, 132, 111, 117, 110, 100, 0, 22, 0, 131, 114, 111, 117, 110, 100, 0, 68, 80,
+  29, 18, 86, 29, 0, 130, 111, 117, 110, 100, 0, 10, 14, 6, 4, 5, 0, 132, 114,
+  111, 117, 110, 100, 0, 76, 109, 29, 18, 152, 29, 21, 208, 29, 0, 72, 116, 29,
+  21, 126, 29, 0, 21, 19, 0, 132, 101, 114, 105, 111, 100, 0, 8, 0, 85, 135, 29,
+  23, 144, 29, 0, 19, 0, 133, 101, 114, 105, 111, 100, 0, 22, 4, 0, 130, 111,
+  105, 100, 0, 75, 159, 29, 23, 196, 29, 0, 85, 166, 29, 28, 183, 29, 0, 18, 5,
+  10, 12, 8, 17, 0, 134, 104, 98, 111, 114, 104, 111, 111, 100, 0, 15, 8, 14,
+  12, 15, 0, 132, 105, 104, 111, 111, 100, 0, 22, 8, 12, 21, 19, 0, 130, 104,
+  111, 111, 100, 0, 6, 8, 21, 0, 130, 111, 114, 100, 0, 68, 233, 29, 8, 4, 30,
+  12, 41, 30, 18, 52, 30, 24, 63, 30, 0, 26, 0, 72, 242, 29, 18, 251, 29, 0, 21,
+  18, 9, 0, 130, 111, 114, 100, 0, 9, 0, 131, 114, 119, 97, 114, 100, 0, 71, 14,
+  30, 12, 24, 30, 24, 32, 30, 0, 12, 22, 17, 18, 6, 0, 128, 101, 100, 0, 26, 0,
+  131, 101, 105, 114, 100, 0, 20, 17, 18, 6, 0, 128, 101, 100, 0, 5, 7, 15, 12,
+  11, 6, 0, 128, 116, 104, 0, 6, 18, 21, 0, 132, 101, 99, 111, 114, 100, 0, 68,
+  70, 30, 23, 78, 30, 0, 10, 0, 131, 117, 97, 114, 100, 0, 19, 4, 6, 0, 128,
+  101, 100, 0, 79, 93, 30, 18, 102, 30, 0, 18, 11, 22, 0, 130, 117, 108, 100, 0,
+  21, 4, 0, 128, 110, 100, 0, 4, 8, 21, 15, 4, 0, 129, 100, 121, 0, 68, 183, 30,
+  5, 0, 31, 6, 94, 31, 7, 208, 38, 8, 243, 39, 10, 135, 40, 11, 235, 42, 12,
+  104, 43, 14, 129, 43, 15, 163, 43, 16, 242, 49, 17, 105, 50, 18, 27, 52, 19,
+  60, 52, 21, 113, 52, 22, 241, 54, 23, 181, 56, 24, 109, 62, 25, 209, 62, 28,
+  25, 66, 29, 34, 66, 0, 70, 199, 30, 7, 211, 30, 14, 221, 30, 16, 228, 30, 25,
+  247, 30, 0, 19, 22, 8, 16, 4, 17, 0, 130, 97, 99, 101, 0, 12, 8, 4, 7, 12, 0,
+  133, 101, 97, 0, 16, 0, 130, 97, 107, 101, 0, 68, 235, 30, 17, 242, 30, 0, 6,
+  8, 5, 0, 129, 101, 0, 130, 97, 109, 101, 0, 4, 15, 0, 130, 114, 118, 97, 101,
+  0, 68, 13, 31, 12, 23, 31, 15, 55, 31, 18, 81, 31, 0, 15, 12, 4, 25, 4, 0,
+  128, 108, 101, 0, 21, 6, 0, 72, 33, 31, 22, 43, 31, 0, 7, 0, 132, 115, 99,
+  114, 105, 98, 101, 0, 12, 7, 0, 134, 101, 115, 99, 114, 105, 98, 101, 0, 68,
+  62, 31, 24, 73, 31, 0, 15, 12, 4, 25, 4, 0, 130, 98, 108, 101, 0, 18, 7, 0,
+  130, 98, 108, 101, 0, 19, 18, 21, 7, 28, 11, 0, 130, 104, 111, 98, 101, 0, 68,
+  119, 31, 8, 160, 31, 12, 219, 31, 16, 41, 32, 17, 53, 32, 19, 150, 38, 23,
+  163, 38, 24, 174, 38, 0, 82, 126, 31, 23, 134, 31, 0, 19, 22, 0, 131, 97, 99,
+  101, 0, 22, 0, 69, 143, 31, 12, 151, 31, 0, 24, 22, 0, 129, 110, 99, 101, 0,
+  16, 21, 4, 0, 130, 105, 99, 101, 0, 71, 170, 31, 17, 183, 31, 21, 209, 31, 0,
+  17, 8, 19, 8, 7, 17, 12, 0, 129, 110, 99, 101, 0, 72, 190, 31, 12, 200, 31, 0,
+  21, 8, 9, 8, 21, 0, 130, 99, 101, 0, 6, 22, 0, 131, 101, 110, 99, 101, 0, 8,
+  9, 8, 21, 0, 129, 110, 99, 101, 0, 70, 232, 31, 8, 240, 31, 23, 5, 32, 25, 16,
+  32, 0, 8, 21, 19, 0, 129, 115, 101, 0, 81, 247, 31, 19, 253, 31, 0, 131, 105,
+  101, 99, 101, 0, 44, 0, 131, 105, 101, 99, 101, 0, 4, 21, 19, 0, 131, 99, 116,
+  105, 99, 101, 0, 72, 23, 32, 12, 32, 32, 0, 22, 0, 131, 114, 118, 105, 99,
+  101, 0, 7, 0, 132, 101, 118, 105, 99, 101, 0, 8, 21, 8, 9, 8, 21, 0, 130, 110,
+  99, 101, 0, 68, 72, 32, 8, 18, 35, 12, 80, 38, 18, 120, 38, 21, 129, 38, 24,
+  140, 38, 0, 71, 103, 32, 8, 151, 32, 10, 198, 32, 12, 228, 32, 15, 0, 33, 16,
+  81, 33, 17, 95, 33, 21, 158, 33, 22, 87, 34, 23, 141, 34, 0, 81, 110, 32, 24,
+  140, 32, 0, 8, 0, 70, 119, 32, 19, 131, 32, 0, 22, 17, 4, 21, 23, 0, 131, 101,
+  110, 99, 101, 0, 8, 7, 0, 131, 101, 110, 99, 101, 0, 5, 4, 0, 132, 110, 100,
+  97, 110, 99, 101, 0, 21, 0, 68, 160, 32, 8, 186, 32, 0, 8, 0, 79, 169, 32, 19,
+  177, 32, 0, 6, 0, 132, 97, 110, 99, 101, 0, 19, 4, 0, 132, 97, 110, 99, 101,
+  0, 19, 19, 4, 0, 133, 97, 114, 97, 110, 99, 101, 0, 76, 205, 32, 17, 218, 32,
+  0, 15, 15, 8, 23, 17, 12, 0, 131, 101, 110, 99, 101, 0, 8, 25, 0, 131, 101,
+  97, 110, 99, 101, 0, 71, 235, 32, 21, 245, 32, 0, 8, 5, 18, 0, 131, 101, 110,
+  99, 101, 0, 8, 19, 27, 8, 0, 131, 101, 110, 99, 101, 0, 68, 13, 33, 5, 39, 33,
+  8, 56, 33, 15, 70, 33, 0, 69, 20, 33, 25, 33, 33, 0, 17, 12, 0, 135, 109, 98,
+  97, 108, 97, 110, 99, 101, 0, 4, 0, 128, 104, 101, 0, 16, 8, 22, 22, 8, 21, 0,
+  136, 101, 109, 98, 108, 97, 110, 99, 101, 0, 5, 16, 8, 22, 8, 21, 0, 133, 108,
+  97, 110, 99, 101, 0, 8, 6, 27, 8, 0, 131, 101, 110, 99, 101, 0, 18, 9, 21, 8,
+  19, 0, 132, 114, 109, 97, 110, 99, 101, 0, 76, 102, 33, 23, 145, 33, 0, 68,
+  112, 33, 9, 126, 33, 16, 135, 33, 0, 23, 17, 12, 4, 16, 0, 134, 101, 110, 97,
+  110, 99, 101, 0, 8, 7, 0, 132, 97, 110, 99, 101, 0, 18, 21, 19, 0, 131, 101,
+  110, 99, 101, 0, 17, 12, 4, 16, 0, 132, 101, 110, 97, 110, 99, 101, 0, 68,
+  171, 33, 8, 186, 33, 21, 37, 34, 24, 76, 34, 0, 8, 21, 19, 19, 4, 0, 135, 101,
+  97, 114, 97, 110, 99, 101, 0, 69, 205, 33, 7, 240, 33, 9, 251, 33, 11, 7, 34,
+  19, 16, 34, 25, 27, 34, 0, 80, 212, 33, 24, 224, 33, 0, 8, 16, 8, 21, 0, 133,
+  114, 97, 110, 99, 101, 0, 21, 23, 18, 21, 19, 0, 136, 117, 98, 101, 114, 97,
+  110, 99, 101, 0, 17, 12, 11, 0, 133, 114, 97, 110, 99, 101, 0, 21, 8, 23, 17,
+  12, 0, 131, 101, 110, 99, 101, 0, 7, 4, 0, 131, 101, 110, 99, 101, 0, 19, 4,
+  0, 132, 97, 114, 97, 110, 99, 101, 0, 18, 10, 0, 131, 110, 97, 110, 99, 101,
+  0, 24, 6, 0, 70, 50, 34, 8, 58, 34, 18, 66, 34, 0, 18, 0, 131, 101, 110, 99,
+  101, 0, 21, 0, 131, 101, 110, 99, 101, 0, 134, 99, 117, 114, 114, 101, 110,
+  99, 101, 0, 6, 6, 18, 0, 131, 114, 101, 110, 99, 101, 0, 76, 97, 34, 22, 112,
+  34, 24, 131, 34, 0, 4, 17, 17, 18, 6, 8, 21, 0, 131, 115, 97, 110, 99, 101, 0,
+  12, 4, 17, 18, 6, 8, 21, 0, 135, 110, 97, 105, 115, 115, 97, 110, 99, 101, 0,
+  17, 0, 132, 105, 115, 97, 110, 99, 101, 0, 68, 154, 34, 8, 164, 34, 17, 175,
+  34, 22, 233, 34, 0, 23, 22, 17, 12, 0, 132, 110, 99, 101, 0, 19, 16, 18, 6, 0,
+  131, 101, 110, 99, 101, 0, 68, 182, 34, 12, 200, 34, 0, 12, 24, 20, 4, 0, 137,
+  99, 113, 117, 97, 105, 110, 116, 97, 110, 99, 101, 0, 4, 0, 80, 209, 34, 24,
+  217, 34, 0, 131, 101, 110, 97, 110, 99, 101, 0, 20, 4, 0, 137, 99, 113, 117,
+  97, 105, 110, 116, 97, 110, 99, 101, 0, 12, 0, 86, 242, 34, 27, 10, 35, 0, 81,
+  249, 34, 21, 1, 35, 0, 12, 0, 131, 101, 110, 99, 101, 0, 8, 19, 0, 131, 101,
+  110, 99, 101, 0, 8, 0, 131, 101, 110, 99, 101, 0, 70, 55, 35, 7, 83, 35, 10,
+  180, 35, 12, 225, 35, 15, 16, 36, 16, 80, 36, 17, 93, 36, 19, 147, 36, 21,
+  170, 36, 22, 176, 37, 23, 217, 37, 25, 69, 38, 0, 82, 62, 35, 22, 74, 35, 0,
+  17, 12, 0, 133, 110, 111, 99, 101, 110, 99, 101, 0, 5, 4, 0, 132, 101, 110,
+  99, 101, 0, 72, 93, 35, 12, 137, 35, 17, 146, 35, 0, 72, 100, 35, 19, 110, 35,
+  0, 21, 6, 0, 133, 100, 101, 110, 99, 101, 0, 72, 117, 35, 16, 129, 35, 0, 7,
+  17, 12, 0, 132, 110, 100, 101, 110, 99, 101, 0, 12, 0, 131, 97, 110, 99, 101,
+  0, 24, 10, 0, 131, 97, 110, 99, 101, 0, 8, 0, 83, 155, 35, 23, 171, 35, 0, 12,
+  7, 17, 12, 0, 136, 101, 112, 101, 110, 100, 101, 110, 99, 101, 0, 23, 4, 0,
+  131, 97, 110, 99, 101, 0, 72, 190, 35, 12, 201, 35, 17, 216, 35, 0, 15, 15, 4,
+  0, 131, 105, 97, 110, 99, 101, 0, 15, 8, 23, 17, 12, 0, 133, 108, 105, 103,
+  101, 110, 99, 101, 0, 8, 25, 0, 130, 97, 110, 99, 101, 0, 74, 232, 35, 23, 4,
+  36, 0, 8, 15, 0, 68, 242, 35, 15, 252, 35, 0, 134, 108, 101, 103, 105, 97,
+  110, 99, 101, 0, 4, 0, 131, 97, 110, 99, 101, 0, 12, 4, 19, 0, 134, 116, 105,
+  101, 110, 99, 101, 0, 69, 26, 36, 12, 58, 36, 24, 68, 36, 0, 16, 8, 22, 0, 72,
+  37, 36, 22, 45, 36, 0, 21, 0, 131, 97, 110, 99, 101, 0, 8, 21, 0, 136, 101,
+  109, 98, 108, 97, 110, 99, 101, 0, 10, 12, 25, 0, 131, 97, 110, 99, 101, 0, 9,
+  9, 8, 0, 133, 108, 117, 101, 110, 99, 101, 0, 21, 18, 9, 21, 8, 19, 0, 131,
+  97, 110, 99, 101, 0, 72, 100, 36, 12, 112, 36, 0, 23, 17, 12, 4, 16, 0, 131,
+  97, 110, 99, 101, 0, 68, 119, 36, 16, 133, 36, 0, 23, 17, 12, 4, 16, 0, 134,
+  101, 110, 97, 110, 99, 101, 0, 8, 21, 19, 0, 134, 101, 109, 105, 110, 101,
+  110, 99, 101, 0, 80, 154, 36, 22, 163, 36, 0, 18, 6, 8, 21, 0, 129, 115, 101,
+  0, 12, 7, 0, 129, 115, 101, 0, 68, 198, 36, 5, 209, 36, 7, 221, 36, 8, 231,
+  36, 9, 66, 37, 12, 77, 37, 18, 90, 37, 21, 100, 37, 24, 150, 37, 0, 8, 19, 19,
+  4, 0, 131, 97, 110, 99, 101, 0, 16, 8, 16, 8, 21, 0, 131, 97, 110, 99, 101, 0,
+  17, 12, 11, 0, 131, 97, 110, 99, 101, 0, 71, 247, 36, 9, 2, 37, 12, 32, 37,
+  15, 45, 37, 25, 54, 37, 0, 17, 12, 11, 0, 133, 114, 97, 110, 99, 101, 0, 73,
+  9, 37, 21, 20, 37, 0, 8, 21, 0, 134, 101, 114, 101, 110, 99, 101, 0, 44, 0,
+  134, 101, 102, 101, 114, 101, 110, 99, 101, 0, 19, 27, 8, 0, 134, 101, 114,
+  105, 101, 110, 99, 101, 0, 18, 23, 0, 131, 97, 110, 99, 101, 0, 8, 22, 21, 8,
+  19, 0, 131, 97, 110, 99, 101, 0, 8, 21, 0, 132, 101, 114, 101, 110, 99, 101,
+  0, 19, 27, 8, 0, 133, 101, 114, 105, 101, 110, 99, 101, 0, 17, 10, 12, 0, 131,
+  97, 110, 99, 101, 0, 72, 107, 37, 24, 117, 37, 0, 9, 8, 21, 0, 132, 101, 110,
+  99, 101, 0, 6, 0, 70, 126, 37, 18, 140, 37, 0, 18, 8, 21, 0, 137, 99, 117,
+  114, 114, 101, 110, 99, 101, 0, 134, 99, 117, 114, 114, 101, 110, 99, 101, 0,
+  70, 157, 37, 22, 167, 37, 0, 6, 18, 0, 131, 114, 101, 110, 99, 101, 0, 17, 12,
+  0, 131, 97, 110, 99, 101, 0, 76, 186, 37, 17, 195, 37, 22, 202, 37, 0, 15, 0,
+  132, 99, 101, 110, 115, 101, 0, 18, 17, 0, 129, 115, 101, 0, 12, 4, 17, 17,
+  18, 6, 8, 21, 0, 131, 97, 110, 99, 101, 0, 76, 230, 37, 17, 242, 37, 19, 47,
+  38, 22, 58, 38, 0, 21, 8, 11, 17, 12, 0, 131, 97, 110, 99, 101, 0, 68, 252,
+  37, 8, 12, 38, 12, 22, 38, 0, 12, 24, 20, 6, 4, 0, 135, 97, 105, 110, 116, 97,
+  110, 99, 101, 0, 19, 8, 21, 0, 131, 97, 110, 99, 101, 0, 4, 0, 80, 31, 38, 24,
+  37, 38, 0, 129, 97, 110, 99, 101, 0, 20, 6, 4, 0, 131, 97, 110, 99, 101, 0, 8,
+  6, 6, 4, 0, 131, 97, 110, 99, 101, 0, 12, 22, 8, 21, 0, 131, 97, 110, 99, 101,
+  0, 8, 15, 8, 21, 0, 131, 97, 110, 99, 101, 0, 70, 90, 38, 8, 98, 38, 23, 109,
+  38, 0, 22, 0, 130, 101, 110, 99, 101, 0, 7, 24, 4, 0, 132, 105, 101, 110, 99,
+  101, 0, 22, 12, 27, 8, 0, 131, 101, 110, 99, 101, 0, 19, 22, 8, 21, 0, 129,
+  115, 101, 0, 8, 9, 8, 21, 0, 130, 101, 110, 99, 101, 0, 20, 8, 22, 0, 130,
+  101, 110, 99, 101, 0, 4, 22, 8, 16, 4, 17, 0, 131, 112, 97, 99, 101, 0, 17, 8,
+  15, 18, 12, 25, 0, 130, 99, 101, 0, 7, 0, 81, 183, 38, 18, 193, 38, 0, 8, 0,
+  133, 105, 110, 100, 117, 99, 101, 0, 21, 23, 6, 17, 12, 0, 135, 116, 114, 111,
+  100, 117, 99, 101, 0, 68, 224, 38, 8, 44, 39, 12, 76, 39, 18, 200, 39, 24,
+  229, 39, 0, 79, 240, 38, 17, 253, 38, 21, 11, 39, 23, 21, 39, 24, 30, 39, 0,
+  8, 16, 21, 4, 16, 0, 132, 97, 108, 97, 100, 101, 0, 18, 15, 15, 18, 6, 0, 133,
+  111, 110, 110, 97, 100, 101, 0, 8, 19, 0, 132, 97, 114, 97, 100, 101, 0, 22,
+  17, 12, 0, 130, 101, 97, 100, 0, 22, 21, 24, 19, 0, 134, 101, 114, 115, 117,
+  97, 100, 101, 0, 70, 51, 39, 19, 63, 39, 0, 21, 8, 19, 24, 22, 0, 131, 115,
+  101, 100, 101, 0, 8, 15, 15, 12, 16, 0, 132, 105, 112, 101, 100, 101, 0, 68,
+  95, 39, 6, 99, 39, 21, 123, 39, 22, 172, 39, 23, 180, 39, 25, 190, 39, 0, 19,
+  0, 128, 0, 72, 106, 39, 24, 114, 39, 0, 21, 0, 131, 115, 105, 100, 101, 0, 22,
+  0, 131, 105, 99, 105, 100, 101, 0, 68, 130, 39, 8, 147, 39, 0, 6, 6, 4, 22,
+  28, 15, 18, 19, 0, 132, 104, 97, 114, 105, 100, 101, 0, 25, 0, 82, 156, 39,
+  25, 162, 39, 0, 130, 114, 105, 100, 101, 0, 18, 0, 133, 101, 114, 114, 105,
+  100, 101, 0, 22, 4, 0, 131, 105, 100, 101, 0, 12, 23, 23, 4, 0, 130, 117, 100,
+  101, 0, 8, 7, 0, 132, 105, 118, 105, 100, 101, 0, 76, 207, 39, 22, 218, 39, 0,
+  22, 19, 8, 0, 132, 105, 115, 111, 100, 101, 0, 7, 12, 19, 8, 0, 132, 115, 111,
+  100, 101, 0, 23, 12, 23, 23, 4, 15, 0, 133, 105, 116, 117, 100, 101, 0, 72,
+  250, 39, 23, 0, 40, 0, 21, 11, 23, 0, 128, 0, 68, 13, 40, 12, 24, 40, 17, 34,
+  40, 23, 122, 40, 0, 21, 4, 24, 10, 0, 130, 110, 116, 101, 101, 0, 16, 16, 18,
+  6, 0, 129, 116, 101, 101, 0, 68, 41, 40, 8, 90, 40, 0, 21, 0, 68, 50, 40, 24,
+  62, 40, 0, 10, 0, 134, 117, 97, 114, 97, 110, 116, 101, 101, 0, 68, 69, 40,
+  10, 81, 40, 0, 10, 0, 135, 117, 97, 114, 97, 110, 116, 101, 101, 0, 133, 97,
+  114, 97, 110, 116, 101, 101, 0, 21, 0, 68, 99, 40, 24, 109, 40, 0, 24, 10, 0,
+  132, 97, 110, 116, 101, 101, 0, 4, 10, 0, 135, 117, 97, 114, 97, 110, 116,
+  101, 101, 0, 12, 16, 18, 6, 0, 132, 109, 105, 116, 116, 101, 101, 0, 68, 154,
+  40, 7, 184, 41, 8, 33, 42, 12, 115, 42, 16, 170, 42, 17, 179, 42, 0, 72, 188,
+  40, 10, 208, 40, 11, 219, 40, 12, 235, 40, 15, 7, 41, 16, 37, 41, 17, 64, 41,
+  21, 73, 41, 22, 117, 41, 23, 126, 41, 24, 159, 41, 0, 79, 195, 40, 22, 201,
+  40, 0, 44, 0, 128, 117, 101, 0, 24, 0, 131, 97, 103, 101, 0, 21, 18, 16, 0,
+  131, 116, 103, 97, 103, 101, 0, 21, 18, 16, 16, 8, 11, 0, 134, 111, 114, 114,
+  104, 97, 103, 101, 0, 85, 242, 40, 23, 252, 40, 0, 4, 16, 0, 131, 114, 105,
+  97, 103, 101, 0, 21, 8, 11, 0, 132, 105, 116, 97, 103, 101, 0, 73, 14, 41, 12,
+  27, 41, 0, 18, 16, 4, 6, 0, 132, 117, 102, 108, 97, 103, 101, 0, 25, 12, 21,
+  19, 0, 130, 101, 103, 101, 0, 16, 0, 68, 46, 41, 12, 53, 41, 0, 7, 0, 131, 97,
+  103, 101, 0, 21, 10, 15, 12, 19, 0, 131, 97, 103, 101, 0, 11, 6, 0, 131, 97,
+  110, 103, 101, 0, 72, 80, 41, 21, 91, 41, 0, 9, 9, 24, 22, 0, 132, 114, 97,
+  103, 101, 0, 68, 98, 41, 18, 106, 41, 0, 16, 0, 130, 105, 97, 103, 101, 0, 16,
+  8, 4, 11, 0, 130, 104, 97, 103, 101, 0, 8, 16, 0, 130, 115, 97, 103, 101, 0,
+  81, 133, 41, 21, 150, 41, 0, 8, 6, 8, 21, 19, 0, 136, 101, 114, 99, 101, 110,
+  116, 97, 103, 101, 0, 18, 16, 0, 130, 103, 97, 103, 101, 0, 10, 0, 108, 168,
+  41, 4, 174, 41, 0, 131, 97, 117, 103, 101, 0, 15, 0, 132, 110, 103, 117, 97,
+  103, 101, 0, 72, 191, 41, 12, 2, 42, 0, 15, 0, 68, 209, 41, 12, 215, 41, 15,
+  224, 41, 25, 230, 41, 26, 241, 41, 0, 131, 108, 101, 103, 101, 0, 25, 12, 21,
+  19, 0, 130, 103, 101, 0, 4, 0, 130, 103, 101, 0, 12, 21, 19, 0, 132, 105, 108,
+  101, 103, 101, 0, 18, 17, 14, 4, 0, 136, 99, 107, 110, 111, 119, 108, 101,
+  100, 103, 101, 0, 79, 9, 42, 21, 20, 42, 0, 12, 23, 21, 4, 6, 0, 131, 97, 103,
+  101, 0, 7, 23, 21, 4, 6, 0, 133, 114, 105, 100, 103, 101, 0, 15, 0, 68, 51,
+  42, 8, 75, 42, 12, 87, 42, 15, 97, 42, 26, 106, 42, 0, 108, 58, 42, 25, 64,
+  42, 0, 130, 108, 101, 103, 101, 0, 12, 21, 19, 0, 132, 105, 108, 101, 103,
+  101, 0, 25, 12, 21, 19, 0, 132, 105, 108, 101, 103, 101, 0, 23, 21, 4, 6, 0,
+  130, 97, 103, 101, 0, 4, 11, 6, 0, 129, 110, 103, 101, 0, 18, 17, 14, 0, 129,
+  100, 103, 101, 0, 68, 128, 42, 8, 139, 42, 15, 147, 42, 21, 160, 42, 0, 21,
+  21, 4, 16, 0, 131, 105, 97, 103, 101, 0, 22, 0, 131, 105, 101, 103, 101, 0, 8,
+  25, 12, 21, 19, 0, 132, 105, 108, 101, 103, 101, 0, 23, 21, 4, 6, 0, 129, 100,
+  103, 101, 0, 4, 12, 0, 131, 109, 97, 103, 101, 0, 68, 186, 42, 24, 226, 42, 0,
+  70, 196, 42, 15, 206, 42, 23, 217, 42, 0, 27, 8, 0, 131, 104, 97, 110, 103,
+  101, 0, 15, 4, 11, 6, 0, 131, 101, 110, 103, 101, 0, 22, 0, 131, 114, 97, 110,
+  103, 101, 0, 18, 23, 0, 131, 110, 103, 117, 101, 0, 70, 245, 42, 23, 253, 42,
+  28, 96, 43, 0, 4, 16, 18, 23, 22, 0, 128, 0, 71, 13, 43, 16, 43, 43, 18, 53,
+  43, 22, 62, 43, 23, 71, 43, 0, 72, 20, 43, 17, 34, 43, 0, 23, 8, 15, 19, 16,
+  18, 6, 0, 130, 32, 116, 104, 101, 0, 4, 44, 0, 130, 32, 116, 104, 101, 0, 18,
+  21, 9, 0, 130, 32, 116, 104, 101, 0, 23, 44, 0, 130, 32, 116, 104, 101, 0, 4,
+  44, 0, 130, 32, 116, 104, 101, 0, 68, 78, 43, 24, 86, 43, 0, 44, 0, 130, 32,
+  116, 104, 101, 0, 18, 5, 4, 0, 130, 32, 116, 104, 101, 0, 23, 44, 0, 130, 104,
+  101, 121, 0, 85, 111, 43, 29, 121, 43, 0, 4, 21, 19, 0, 130, 105, 114, 105,
+  101, 0, 22, 44, 0, 130, 105, 122, 101, 0, 80, 139, 43, 21, 147, 43, 24, 156,
+  43, 0, 4, 0, 131, 109, 97, 107, 101, 0, 18, 5, 0, 131, 114, 111, 107, 101, 0,
+  12, 15, 0, 130, 107, 101, 0, 69, 197, 43, 6, 110, 48, 7, 122, 48, 12, 129, 48,
+  14, 13, 49, 15, 21, 49, 18, 27, 49, 19, 37, 49, 22, 183, 49, 23, 226, 49, 25,
+  235, 49, 0, 68, 216, 43, 12, 45, 47, 15, 59, 48, 22, 70, 48, 23, 85, 48, 24,
+  100, 48, 0, 70, 250, 43, 7, 63, 44, 8, 75, 44, 10, 218, 44, 12, 34, 45, 15,
+  80, 45, 16, 124, 45, 17, 154, 45, 21, 191, 45, 22, 32, 46, 23, 170, 46, 0, 68,
+  4, 44, 12, 18, 44, 24, 50, 44, 0, 15, 19, 8, 21, 21, 12, 0, 131, 101, 97, 98,
+  108, 101, 0, 83, 25, 44, 23, 40, 44, 0, 22, 12, 7, 0, 136, 101, 115, 112, 105,
+  99, 97, 98, 108, 101, 0, 18, 17, 0, 131, 101, 97, 98, 108, 101, 0, 7, 18, 21,
+  19, 8, 21, 0, 131, 105, 98, 108, 101, 0, 8, 21, 6, 17, 12, 0, 131, 105, 98,
+  108, 101, 0, 71, 97, 44, 8, 108, 44, 15, 123, 44, 17, 133, 44, 21, 153, 44,
+  23, 183, 44, 24, 208, 44, 0, 12, 6, 8, 7, 0, 132, 97, 98, 108, 101, 0, 22, 21,
+  18, 9, 0, 134, 101, 115, 101, 101, 97, 98, 108, 101, 0, 4, 6, 22, 0, 132, 97,
+  98, 108, 101, 0, 12, 9, 8, 7, 17, 12, 0, 139, 117, 110, 100, 101, 102, 105,
+  110, 97, 98, 108, 101, 0, 76, 160, 44, 24, 170, 44, 0, 22, 8, 7, 0, 132, 97,
+  98, 108, 101, 0, 10, 12, 9, 17, 18, 6, 0, 132, 97, 98, 108, 101, 0, 68, 190,
+  44, 18, 200, 44, 0, 5, 8, 7, 0, 132, 97, 98, 108, 101, 0, 17, 0, 132, 97, 98,
+  108, 101, 0, 15, 4, 25, 0, 132, 97, 98, 108, 101, 0, 68, 231, 44, 12, 242, 44,
+  17, 10, 45, 21, 21, 45, 0, 17, 4, 16, 0, 131, 101, 97, 98, 108, 101, 0, 15, 0,
+  72, 251, 44, 10, 1, 45, 0, 131, 105, 98, 108, 101, 0, 8, 17, 0, 131, 105, 98,
+  108, 101, 0, 4, 11, 6, 0, 131, 101, 97, 98, 108, 101, 0, 4, 11, 6, 8, 21, 0,
+  131, 101, 97, 98, 108, 101, 0, 79, 41, 45, 23, 69, 45, 0, 68, 48, 45, 12, 59,
+  45, 0, 25, 4, 0, 133, 105, 108, 97, 98, 108, 101, 0, 4, 25, 4, 0, 132, 97, 98,
+  108, 101, 0, 4, 19, 16, 18, 6, 0, 131, 98, 108, 101, 0, 68, 90, 45, 12, 101,
+  45, 15, 113, 45, 0, 25, 4, 0, 132, 105, 108, 97, 98, 108, 101, 0, 25, 4, 0,
+  133, 97, 105, 108, 97, 98, 108, 101, 0, 4, 9, 17, 12, 0, 131, 105, 98, 108,
+  101, 0, 4, 0, 79, 133, 45, 21, 142, 45, 0, 9, 0, 131, 109, 97, 98, 108, 101,
+  0, 10, 18, 21, 19, 0, 131, 109, 97, 98, 108, 101, 0, 18, 0, 76, 163, 45, 23,
+  177, 45, 0, 22, 12, 9, 0, 134, 115, 105, 111, 110, 97, 98, 108, 101, 0, 22, 8,
+  24, 20, 0, 133, 105, 111, 110, 97, 98, 108, 101, 0, 72, 201, 45, 19, 238, 45,
+  23, 250, 45, 0, 69, 208, 45, 19, 225, 45, 0, 16, 8, 16, 8, 21, 0, 139, 109,
   101, 109, 111, 114, 97, 98, 108, 101, 0, 8, 22, 17, 12, 0, 133, 97, 114, 97,
-  98, 108, 101, 0, 16, 18, 6, 0, 132, 97, 114, 97, 98, 108, 101, 0, 72, 80, 45,
-  24, 99, 45, 0, 17, 8, 19, 17, 12, 0, 138, 109, 112, 101, 110, 101, 116, 114,
-  97, 98, 108, 101, 0, 18, 25, 4, 9, 0, 133, 114, 97, 98, 108, 101, 0, 68, 130,
-  45, 8, 139, 45, 17, 154, 45, 21, 174, 45, 22, 185, 45, 24, 239, 45, 0, 8, 9,
-  0, 131, 105, 98, 108, 101, 0, 21, 7, 4, 0, 134, 100, 114, 101, 115, 115, 97,
-  98, 108, 101, 0, 8, 19, 22, 8, 7, 17, 12, 0, 137, 105, 115, 112, 101, 110,
-  115, 97, 98, 108, 101, 0, 8, 25, 8, 21, 0, 131, 105, 98, 108, 101, 0, 72, 195,
-  45, 12, 205, 45, 18, 231, 45, 0, 6, 6, 4, 0, 131, 105, 98, 108, 101, 0, 16, 0,
-  71, 214, 45, 21, 222, 45, 0, 4, 0, 131, 105, 98, 108, 101, 0, 8, 19, 0, 131,
-  105, 98, 108, 101, 0, 19, 0, 131, 105, 98, 108, 101, 0, 4, 15, 19, 0, 131,
-  105, 98, 108, 101, 0, 68, 12, 46, 10, 23, 46, 12, 34, 46, 19, 63, 46, 21, 96,
-  46, 22, 113, 46, 0, 19, 16, 18, 6, 0, 131, 105, 98, 108, 101, 0, 8, 25, 0,
-  132, 101, 116, 97, 98, 108, 101, 0, 74, 41, 46, 21, 52, 46, 0, 8, 25, 0, 133,
+  98, 108, 101, 0, 16, 18, 6, 0, 132, 97, 114, 97, 98, 108, 101, 0, 72, 1, 46,
+  24, 20, 46, 0, 17, 8, 19, 17, 12, 0, 138, 109, 112, 101, 110, 101, 116, 114,
+  97, 98, 108, 101, 0, 18, 25, 4, 9, 0, 133, 114, 97, 98, 108, 101, 0, 68, 51,
+  46, 8, 60, 46, 17, 75, 46, 21, 95, 46, 22, 106, 46, 24, 160, 46, 0, 8, 9, 0,
+  131, 105, 98, 108, 101, 0, 21, 7, 4, 0, 134, 100, 114, 101, 115, 115, 97, 98,
+  108, 101, 0, 8, 19, 22, 8, 7, 17, 12, 0, 137, 105, 115, 112, 101, 110, 115,
+  97, 98, 108, 101, 0, 8, 25, 8, 21, 0, 131, 105, 98, 108, 101, 0, 72, 116, 46,
+  12, 126, 46, 18, 152, 46, 0, 6, 6, 4, 0, 131, 105, 98, 108, 101, 0, 16, 0, 71,
+  135, 46, 21, 143, 46, 0, 4, 0, 131, 105, 98, 108, 101, 0, 8, 19, 0, 131, 105,
+  98, 108, 101, 0, 19, 0, 131, 105, 98, 108, 101, 0, 4, 15, 19, 0, 131, 105, 98,
+  108, 101, 0, 68, 189, 46, 10, 200, 46, 12, 211, 46, 19, 240, 46, 21, 17, 47,
+  22, 34, 47, 0, 19, 16, 18, 6, 0, 131, 105, 98, 108, 101, 0, 8, 25, 0, 132,
+  101, 116, 97, 98, 108, 101, 0, 74, 218, 46, 21, 229, 46, 0, 8, 25, 0, 133,
   101, 116, 97, 98, 108, 101, 0, 12, 0, 133, 114, 105, 116, 97, 98, 108, 101, 0,
-  80, 70, 46, 24, 83, 46, 0, 18, 6, 17, 12, 0, 132, 97, 116, 105, 98, 108, 101,
+  80, 247, 46, 24, 4, 47, 0, 18, 6, 17, 12, 0, 132, 97, 116, 105, 98, 108, 101,
   0, 21, 21, 18, 6, 17, 12, 0, 131, 105, 98, 108, 101, 0, 18, 9, 17, 18, 6, 0,
   136, 109, 102, 111, 114, 116, 97, 98, 108, 101, 0, 12, 22, 8, 21, 0, 131, 105,
-  98, 108, 101, 0, 68, 146, 46, 6, 157, 46, 7, 169, 46, 15, 200, 46, 19, 227,
-  46, 22, 236, 46, 23, 40, 47, 0, 15, 12, 4, 25, 4, 0, 131, 98, 108, 101, 0, 12,
-  23, 18, 17, 0, 131, 101, 97, 98, 108, 101, 0, 68, 176, 46, 12, 189, 46, 0, 8,
+  98, 108, 101, 0, 68, 67, 47, 6, 78, 47, 7, 90, 47, 15, 121, 47, 19, 148, 47,
+  22, 157, 47, 23, 217, 47, 0, 15, 12, 4, 25, 4, 0, 131, 98, 108, 101, 0, 12,
+  23, 18, 17, 0, 131, 101, 97, 98, 108, 101, 0, 68, 97, 47, 12, 110, 47, 0, 8,
   21, 6, 17, 12, 0, 133, 100, 105, 98, 108, 101, 0, 16, 21, 18, 9, 0, 131, 97,
-  98, 108, 101, 0, 74, 207, 46, 12, 217, 46, 0, 8, 17, 0, 130, 103, 105, 98,
+  98, 108, 101, 0, 74, 128, 47, 12, 138, 47, 0, 8, 17, 0, 130, 103, 105, 98,
   108, 101, 0, 4, 25, 4, 0, 131, 97, 98, 108, 101, 0, 4, 6, 0, 131, 97, 98, 108,
-  101, 0, 17, 0, 72, 245, 46, 18, 25, 47, 0, 19, 22, 0, 72, 255, 46, 12, 15, 47,
-  0, 7, 17, 12, 0, 137, 105, 115, 112, 101, 110, 115, 97, 98, 108, 101, 0, 7,
-  17, 12, 0, 131, 97, 98, 108, 101, 0, 19, 8, 21, 0, 135, 115, 112, 111, 110,
-  115, 105, 98, 108, 101, 0, 68, 56, 47, 12, 69, 47, 19, 96, 47, 22, 107, 47,
-  24, 125, 47, 0, 25, 8, 17, 12, 0, 133, 105, 116, 97, 98, 108, 101, 0, 83, 76,
-  47, 25, 86, 47, 0, 22, 18, 11, 0, 131, 97, 98, 108, 101, 0, 8, 17, 12, 0, 131,
+  101, 0, 17, 0, 72, 166, 47, 18, 202, 47, 0, 19, 22, 0, 72, 176, 47, 12, 192,
+  47, 0, 7, 17, 12, 0, 137, 105, 115, 112, 101, 110, 115, 97, 98, 108, 101, 0,
+  7, 17, 12, 0, 131, 97, 98, 108, 101, 0, 19, 8, 21, 0, 135, 115, 112, 111, 110,
+  115, 105, 98, 108, 101, 0, 68, 233, 47, 12, 246, 47, 19, 17, 48, 22, 28, 48,
+  24, 46, 48, 0, 25, 8, 17, 12, 0, 133, 105, 116, 97, 98, 108, 101, 0, 83, 253,
+  47, 25, 7, 48, 0, 22, 18, 11, 0, 131, 97, 98, 108, 101, 0, 8, 17, 12, 0, 131,
   97, 98, 108, 101, 0, 8, 6, 6, 4, 0, 131, 97, 98, 108, 101, 0, 12, 22, 8, 21,
   12, 0, 136, 114, 101, 115, 105, 115, 116, 105, 98, 108, 101, 0, 19, 22, 12, 7,
   17, 12, 0, 131, 97, 98, 108, 101, 0, 12, 4, 25, 4, 0, 130, 97, 98, 108, 101,
   0, 12, 17, 18, 19, 22, 8, 21, 0, 132, 115, 105, 98, 108, 101, 0, 4, 6, 12, 7,
   8, 21, 19, 0, 132, 116, 97, 98, 108, 101, 0, 15, 4, 25, 0, 130, 97, 98, 108,
   101, 0, 4, 17, 8, 23, 0, 131, 116, 97, 99, 108, 101, 0, 18, 16, 0, 129, 101,
-  108, 0, 69, 230, 47, 6, 19, 48, 11, 29, 48, 19, 47, 48, 22, 59, 48, 23, 68,
-  48, 26, 83, 48, 0, 12, 0, 80, 239, 47, 22, 251, 47, 0, 18, 23, 24, 4, 0, 132,
-  111, 98, 105, 108, 101, 0, 81, 2, 48, 22, 12, 48, 0, 18, 19, 22, 8, 21, 0,
-  130, 108, 101, 0, 18, 19, 0, 130, 108, 101, 0, 23, 21, 4, 0, 131, 105, 99,
-  108, 101, 0, 19, 18, 8, 16, 8, 21, 23, 27, 8, 0, 134, 111, 112, 104, 105, 108,
-  101, 0, 18, 21, 7, 28, 11, 0, 130, 104, 105, 108, 101, 0, 12, 16, 0, 130, 115,
-  105, 108, 101, 0, 17, 8, 6, 21, 8, 16, 0, 133, 97, 110, 116, 105, 108, 101, 0,
-  11, 0, 132, 119, 104, 105, 108, 101, 0, 6, 12, 17, 0, 129, 101, 108, 0, 24,
-  21, 0, 129, 101, 0, 26, 11, 0, 132, 119, 104, 111, 108, 101, 0, 68, 135, 48,
-  8, 175, 48, 12, 185, 48, 16, 198, 48, 18, 238, 48, 19, 249, 48, 0, 72, 145,
-  48, 16, 153, 48, 17, 163, 48, 0, 19, 0, 131, 111, 112, 108, 101, 0, 27, 8, 0,
+  108, 0, 69, 151, 48, 6, 196, 48, 11, 206, 48, 19, 224, 48, 22, 236, 48, 23,
+  245, 48, 26, 4, 49, 0, 12, 0, 80, 160, 48, 22, 172, 48, 0, 18, 23, 24, 4, 0,
+  132, 111, 98, 105, 108, 101, 0, 81, 179, 48, 22, 189, 48, 0, 18, 19, 22, 8,
+  21, 0, 130, 108, 101, 0, 18, 19, 0, 130, 108, 101, 0, 23, 21, 4, 0, 131, 105,
+  99, 108, 101, 0, 19, 18, 8, 16, 8, 21, 23, 27, 8, 0, 134, 111, 112, 104, 105,
+  108, 101, 0, 18, 21, 7, 28, 11, 0, 130, 104, 105, 108, 101, 0, 12, 16, 0, 130,
+  115, 105, 108, 101, 0, 17, 8, 6, 21, 8, 16, 0, 133, 97, 110, 116, 105, 108,
+  101, 0, 11, 0, 132, 119, 104, 105, 108, 101, 0, 6, 12, 17, 0, 129, 101, 108,
+  0, 24, 21, 0, 129, 101, 0, 26, 11, 0, 132, 119, 104, 111, 108, 101, 0, 68, 56,
+  49, 8, 96, 49, 12, 106, 49, 16, 119, 49, 18, 159, 49, 19, 170, 49, 0, 72, 66,
+  49, 16, 74, 49, 17, 84, 49, 0, 19, 0, 131, 111, 112, 108, 101, 0, 27, 8, 0,
   132, 97, 109, 112, 108, 101, 0, 17, 12, 19, 0, 132, 101, 97, 112, 112, 108,
   101, 0, 18, 19, 0, 132, 101, 111, 112, 108, 101, 0, 6, 12, 21, 19, 0, 132,
-  110, 99, 105, 112, 108, 101, 0, 68, 205, 48, 8, 214, 48, 0, 8, 21, 19, 0, 130,
-  98, 108, 101, 0, 86, 221, 48, 27, 229, 48, 0, 22, 4, 0, 130, 98, 108, 101, 0,
+  110, 99, 105, 112, 108, 101, 0, 68, 126, 49, 8, 135, 49, 0, 8, 21, 19, 0, 130,
+  98, 108, 101, 0, 86, 142, 49, 27, 150, 49, 0, 22, 4, 0, 130, 98, 108, 101, 0,
   8, 0, 132, 97, 109, 112, 108, 101, 0, 8, 18, 19, 0, 133, 101, 111, 112, 108,
-  101, 0, 4, 17, 12, 19, 0, 132, 101, 97, 112, 112, 108, 101, 0, 68, 19, 49, 8,
-  26, 49, 17, 33, 49, 22, 41, 49, 0, 9, 0, 130, 108, 115, 101, 0, 44, 0, 130,
+  101, 0, 4, 17, 12, 19, 0, 132, 101, 97, 112, 112, 108, 101, 0, 68, 196, 49, 8,
+  203, 49, 17, 210, 49, 22, 218, 49, 0, 9, 0, 130, 108, 115, 101, 0, 44, 0, 130,
   108, 115, 101, 0, 8, 19, 0, 130, 99, 105, 108, 0, 12, 16, 0, 129, 105, 108,
   101, 0, 28, 22, 0, 131, 116, 121, 108, 101, 0, 8, 15, 0, 129, 101, 108, 0, 68,
-  81, 49, 12, 92, 49, 16, 148, 49, 18, 155, 49, 24, 160, 49, 0, 6, 4, 5, 0, 132,
-  101, 99, 97, 109, 101, 0, 23, 0, 73, 107, 49, 11, 117, 49, 23, 127, 49, 28,
-  136, 49, 0, 12, 15, 0, 131, 101, 116, 105, 109, 101, 0, 10, 12, 17, 0, 130,
-  116, 105, 109, 101, 0, 22, 4, 19, 0, 131, 105, 109, 101, 0, 21, 8, 25, 8, 0,
-  131, 32, 116, 105, 109, 101, 0, 28, 11, 21, 0, 129, 101, 0, 21, 9, 0, 128, 0,
-  70, 167, 49, 22, 176, 49, 0, 6, 4, 25, 0, 131, 117, 117, 109, 0, 4, 0, 130,
-  115, 117, 109, 101, 0, 70, 206, 49, 8, 214, 49, 11, 13, 50, 12, 25, 50, 16,
-  248, 50, 18, 11, 51, 21, 94, 51, 0, 12, 22, 0, 130, 110, 99, 101, 0, 74, 224,
-  49, 16, 249, 49, 25, 1, 50, 0, 76, 231, 49, 28, 241, 49, 0, 21, 18, 5, 4, 0,
+  2, 50, 12, 13, 50, 16, 69, 50, 18, 76, 50, 24, 81, 50, 0, 6, 4, 5, 0, 132,
+  101, 99, 97, 109, 101, 0, 23, 0, 73, 28, 50, 11, 38, 50, 23, 48, 50, 28, 57,
+  50, 0, 12, 15, 0, 131, 101, 116, 105, 109, 101, 0, 10, 12, 17, 0, 130, 116,
+  105, 109, 101, 0, 22, 4, 19, 0, 131, 105, 109, 101, 0, 21, 8, 25, 8, 0, 131,
+  32, 116, 105, 109, 101, 0, 28, 11, 21, 0, 129, 101, 0, 21, 9, 0, 128, 0, 70,
+  88, 50, 22, 97, 50, 0, 6, 4, 25, 0, 131, 117, 117, 109, 0, 4, 0, 130, 115,
+  117, 109, 101, 0, 70, 127, 50, 8, 135, 50, 11, 190, 50, 12, 202, 50, 16, 169,
+  51, 18, 188, 51, 21, 15, 52, 0, 12, 22, 0, 130, 110, 99, 101, 0, 74, 145, 50,
+  16, 170, 50, 25, 178, 50, 0, 76, 152, 50, 28, 162, 50, 0, 21, 18, 5, 4, 0,
   130, 105, 110, 101, 0, 11, 0, 130, 105, 101, 110, 101, 0, 18, 22, 0, 129, 111,
   110, 101, 0, 8, 23, 17, 12, 0, 131, 114, 118, 101, 110, 101, 0, 6, 4, 16, 5,
-  24, 22, 0, 129, 105, 110, 101, 0, 68, 62, 50, 6, 75, 50, 8, 87, 50, 9, 129,
-  50, 10, 138, 50, 16, 146, 50, 17, 156, 50, 21, 168, 50, 22, 181, 50, 23, 209,
-  50, 24, 224, 50, 29, 236, 50, 0, 23, 17, 4, 21, 4, 24, 20, 0, 131, 105, 110,
-  101, 0, 4, 7, 8, 16, 0, 132, 105, 99, 105, 110, 101, 0, 10, 0, 76, 96, 50, 28,
-  106, 50, 0, 11, 0, 133, 121, 103, 105, 101, 110, 101, 0, 75, 113, 50, 12, 119,
-  50, 0, 131, 105, 101, 110, 101, 0, 11, 0, 134, 121, 103, 105, 101, 110, 101,
-  0, 9, 8, 7, 0, 131, 105, 110, 101, 0, 28, 11, 0, 129, 101, 110, 101, 0, 18,
-  23, 17, 4, 19, 0, 129, 109, 101, 0, 4, 17, 24, 10, 0, 133, 97, 110, 105, 110,
-  101, 0, 24, 18, 15, 9, 0, 133, 117, 111, 114, 105, 110, 101, 0, 68, 188, 50,
-  12, 198, 50, 0, 10, 4, 16, 0, 131, 122, 105, 110, 101, 0, 10, 4, 16, 0, 132,
-  97, 122, 105, 110, 101, 0, 17, 8, 21, 4, 24, 20, 0, 133, 97, 110, 116, 105,
-  110, 101, 0, 10, 8, 21, 8, 19, 0, 131, 114, 105, 110, 101, 0, 12, 10, 4, 16,
-  0, 132, 97, 122, 105, 110, 101, 0, 76, 255, 50, 24, 4, 51, 0, 23, 0, 129, 101,
-  0, 15, 18, 25, 0, 129, 101, 0, 75, 27, 51, 16, 45, 51, 18, 61, 51, 19, 69, 51,
-  23, 80, 51, 0, 19, 4, 17, 4, 21, 5, 16, 8, 16, 0, 133, 111, 112, 104, 111,
-  110, 101, 0, 18, 21, 8, 9, 0, 135, 112, 104, 101, 114, 111, 109, 111, 110,
-  101, 0, 17, 0, 130, 32, 111, 110, 101, 0, 18, 15, 15, 4, 0, 130, 104, 111,
-  110, 101, 0, 22, 8, 16, 12, 21, 5, 0, 133, 115, 116, 111, 110, 101, 0, 24, 18,
-  5, 21, 12, 4, 0, 131, 114, 110, 101, 0, 85, 116, 51, 22, 123, 51, 25, 131, 51,
-  0, 16, 0, 130, 111, 114, 101, 0, 11, 23, 0, 130, 111, 115, 101, 0, 15, 44, 0,
-  130, 111, 118, 101, 0, 79, 152, 51, 18, 161, 51, 22, 169, 51, 28, 179, 51, 0,
-  18, 8, 19, 0, 130, 112, 108, 101, 0, 15, 8, 25, 8, 7, 0, 128, 0, 12, 15, 6, 8,
-  0, 130, 112, 115, 101, 0, 23, 11, 6, 21, 4, 0, 131, 101, 116, 121, 112, 101,
-  0, 68, 226, 51, 6, 43, 52, 8, 53, 52, 11, 117, 52, 12, 128, 52, 16, 191, 52,
-  18, 199, 52, 21, 227, 52, 23, 234, 52, 24, 248, 52, 25, 33, 54, 0, 70, 242,
-  51, 12, 1, 52, 15, 15, 52, 26, 22, 52, 29, 33, 52, 0, 21, 8, 11, 23, 15, 4, 8,
-  11, 0, 133, 99, 97, 114, 101, 0, 17, 18, 12, 15, 15, 12, 16, 0, 131, 97, 105,
-  114, 101, 0, 24, 19, 18, 19, 0, 128, 0, 9, 18, 22, 0, 131, 116, 119, 97, 114,
-  101, 0, 29, 12, 5, 0, 131, 97, 114, 114, 101, 0, 18, 22, 44, 0, 131, 99, 111,
-  114, 101, 0, 75, 63, 52, 23, 95, 52, 26, 105, 52, 0, 87, 70, 52, 26, 83, 52,
-  0, 21, 8, 25, 18, 0, 132, 32, 116, 104, 101, 114, 101, 0, 16, 18, 22, 0, 132,
-  101, 119, 104, 101, 114, 101, 0, 11, 44, 0, 132, 116, 104, 101, 114, 101, 0,
-  11, 28, 17, 4, 0, 132, 119, 104, 101, 114, 101, 0, 22, 12, 15, 5, 24, 19, 0,
-  129, 101, 114, 0, 72, 138, 52, 18, 149, 52, 24, 164, 52, 0, 16, 8, 21, 19, 0,
-  131, 105, 101, 114, 101, 0, 23, 21, 19, 8, 21, 0, 133, 101, 114, 116, 111,
-  105, 114, 101, 0, 20, 0, 68, 173, 52, 7, 181, 52, 0, 132, 99, 113, 117, 105,
-  114, 101, 0, 4, 0, 133, 99, 113, 117, 105, 114, 101, 0, 18, 0, 131, 109, 111,
-  114, 101, 0, 71, 206, 52, 9, 215, 52, 0, 8, 5, 0, 131, 102, 111, 114, 101, 0,
-  21, 8, 11, 23, 0, 131, 101, 102, 111, 114, 101, 0, 8, 11, 26, 0, 129, 101, 0,
-  24, 6, 8, 13, 17, 18, 6, 0, 131, 116, 117, 114, 101, 0, 68, 14, 53, 7, 23, 53,
-  11, 36, 53, 15, 43, 53, 22, 70, 53, 23, 112, 53, 29, 21, 54, 0, 20, 22, 0,
-  131, 117, 97, 114, 101, 0, 8, 8, 6, 18, 21, 19, 0, 132, 100, 117, 114, 101, 0,
-  22, 0, 131, 117, 114, 101, 0, 24, 6, 0, 72, 53, 53, 12, 60, 53, 0, 19, 0, 130,
-  105, 97, 114, 0, 21, 10, 4, 0, 130, 116, 117, 114, 101, 0, 72, 80, 53, 17, 91,
-  53, 22, 103, 53, 0, 12, 15, 0, 133, 101, 105, 115, 117, 114, 101, 0, 8, 22, 0,
-  134, 99, 101, 110, 115, 117, 114, 101, 0, 8, 15, 5, 0, 130, 105, 110, 103, 0,
-  108, 131, 53, 4, 136, 53, 6, 209, 53, 21, 241, 53, 22, 253, 53, 24, 8, 54, 0,
-  130, 114, 117, 101, 0, 73, 152, 53, 16, 164, 53, 17, 171, 53, 21, 182, 53, 23,
-  197, 53, 0, 24, 17, 4, 16, 0, 131, 99, 116, 117, 114, 101, 0, 4, 0, 130, 101,
-  117, 114, 0, 12, 16, 0, 132, 105, 97, 116, 117, 114, 101, 0, 8, 16, 8, 23, 0,
-  134, 112, 101, 114, 97, 116, 117, 114, 101, 0, 12, 15, 0, 132, 101, 114, 97,
-  116, 117, 114, 101, 0, 85, 216, 53, 24, 229, 53, 0, 24, 23, 22, 0, 134, 114,
-  117, 99, 116, 117, 114, 101, 0, 23, 22, 0, 133, 114, 117, 99, 116, 117, 114,
-  101, 0, 8, 23, 12, 15, 0, 131, 97, 116, 117, 114, 101, 0, 18, 16, 0, 132, 105,
-  115, 116, 117, 114, 101, 0, 6, 12, 21, 10, 4, 0, 131, 108, 116, 117, 114, 101,
-  0, 8, 12, 22, 0, 133, 101, 105, 122, 117, 114, 101, 0, 72, 40, 54, 24, 50, 54,
-  0, 24, 18, 0, 132, 101, 117, 118, 114, 101, 0, 18, 8, 17, 4, 16, 0, 133, 111,
-  101, 117, 118, 114, 101, 0, 68, 92, 54, 8, 117, 54, 12, 155, 54, 14, 19, 55,
-  15, 26, 55, 17, 35, 55, 18, 146, 55, 21, 185, 55, 24, 200, 55, 0, 79, 99, 54,
-  24, 107, 54, 0, 9, 0, 131, 97, 108, 115, 101, 0, 6, 8, 5, 0, 131, 97, 117,
-  115, 101, 0, 72, 127, 54, 12, 134, 54, 22, 145, 54, 0, 11, 23, 0, 130, 115,
-  101, 0, 6, 21, 8, 27, 8, 0, 130, 115, 101, 115, 0, 18, 12, 7, 0, 131, 99, 101,
-  115, 101, 0, 70, 177, 54, 7, 191, 54, 10, 209, 54, 16, 220, 54, 21, 234, 54,
-  23, 3, 55, 24, 13, 55, 0, 21, 8, 6, 27, 8, 0, 134, 101, 114, 99, 105, 115,
-  101, 0, 17, 4, 11, 6, 8, 16, 0, 135, 114, 99, 104, 97, 110, 100, 105, 115,
-  101, 0, 18, 6, 8, 21, 0, 130, 110, 105, 115, 101, 0, 12, 21, 19, 16, 18, 6, 0,
-  132, 111, 109, 105, 115, 101, 0, 82, 241, 54, 19, 248, 54, 0, 23, 22, 0, 129,
-  101, 115, 0, 24, 22, 0, 132, 114, 112, 114, 105, 115, 101, 0, 21, 18, 23, 0,
-  130, 111, 105, 115, 101, 0, 44, 0, 130, 115, 101, 0, 4, 16, 0, 129, 101, 115,
-  0, 12, 4, 9, 0, 131, 108, 115, 101, 0, 68, 48, 55, 8, 57, 55, 12, 128, 55, 18,
-  134, 55, 0, 22, 12, 24, 17, 0, 129, 99, 101, 0, 70, 67, 55, 16, 78, 55, 22,
-  87, 55, 0, 22, 12, 15, 0, 133, 99, 101, 110, 115, 101, 0, 12, 0, 131, 109,
-  101, 110, 115, 101, 0, 69, 100, 55, 8, 106, 55, 12, 113, 55, 22, 122, 55, 0,
-  4, 0, 129, 99, 101, 0, 21, 19, 0, 129, 99, 101, 0, 15, 0, 132, 99, 101, 110,
-  115, 101, 0, 8, 0, 129, 99, 101, 0, 22, 0, 129, 99, 101, 0, 19, 8, 21, 0, 132,
-  115, 112, 111, 110, 115, 101, 0, 19, 0, 81, 158, 55, 18, 169, 55, 24, 177, 55,
-  0, 4, 21, 23, 0, 131, 115, 112, 111, 115, 101, 0, 44, 0, 130, 112, 111, 115,
-  101, 0, 22, 0, 130, 112, 111, 115, 101, 0, 8, 25, 8, 21, 19, 0, 134, 101, 114,
-  118, 101, 114, 115, 101, 0, 68, 210, 55, 6, 239, 55, 18, 250, 55, 0, 70, 217,
-  55, 8, 227, 55, 0, 6, 8, 5, 0, 132, 97, 117, 115, 101, 0, 6, 4, 5, 0, 134,
-  101, 99, 97, 117, 115, 101, 0, 4, 8, 5, 0, 132, 99, 97, 117, 115, 101, 0, 6,
-  8, 5, 0, 131, 97, 117, 115, 101, 0, 68, 26, 56, 8, 131, 60, 12, 166, 60, 15,
-  73, 61, 23, 85, 61, 24, 115, 61, 25, 179, 61, 0, 69, 66, 56, 6, 81, 56, 7,
-  112, 56, 10, 220, 56, 12, 13, 57, 15, 247, 57, 16, 87, 58, 17, 184, 58, 19,
-  236, 58, 21, 246, 58, 23, 241, 59, 24, 49, 60, 25, 99, 60, 0, 21, 8, 27, 8, 0,
-  133, 97, 99, 101, 114, 98, 97, 116, 101, 0, 12, 0, 82, 90, 56, 19, 101, 56, 0,
-  22, 22, 4, 0, 132, 99, 105, 97, 116, 101, 0, 24, 7, 0, 132, 108, 105, 99, 97,
-  116, 101, 0, 68, 122, 56, 16, 153, 56, 18, 166, 56, 0, 71, 129, 56, 16, 140,
-  56, 0, 17, 4, 6, 0, 132, 105, 100, 97, 116, 101, 0, 18, 6, 6, 4, 0, 132, 109,
-  111, 100, 97, 116, 101, 0, 18, 6, 6, 4, 0, 131, 109, 111, 100, 97, 116, 101,
-  0, 79, 173, 56, 16, 186, 56, 0, 18, 22, 17, 18, 6, 0, 132, 105, 100, 97, 116,
-  101, 0, 80, 193, 56, 18, 208, 56, 0, 18, 6, 4, 0, 135, 99, 111, 109, 109, 111,
-  100, 97, 116, 101, 0, 6, 6, 4, 0, 132, 109, 111, 100, 97, 116, 101, 0, 72,
-  230, 56, 17, 243, 56, 18, 1, 57, 0, 21, 10, 4, 0, 133, 103, 114, 101, 103, 97,
-  116, 101, 0, 12, 23, 22, 8, 25, 17, 12, 0, 132, 103, 97, 116, 101, 0, 19, 18,
-  21, 19, 0, 132, 97, 103, 97, 116, 101, 0, 70, 38, 57, 7, 70, 57, 15, 96, 57,
-  19, 124, 57, 21, 155, 57, 22, 189, 57, 23, 201, 57, 25, 218, 57, 0, 72, 45,
-  57, 18, 59, 57, 0, 12, 21, 19, 19, 4, 0, 134, 101, 99, 105, 97, 116, 101, 0,
-  10, 8, 17, 0, 132, 116, 105, 97, 116, 101, 0, 76, 77, 57, 17, 87, 57, 0, 7,
-  17, 4, 6, 0, 131, 97, 116, 101, 0, 4, 6, 0, 130, 100, 97, 116, 101, 0, 76,
-  103, 57, 15, 113, 57, 0, 6, 4, 9, 0, 130, 116, 97, 116, 101, 0, 12, 9, 9, 4,
-  0, 132, 105, 97, 116, 101, 0, 18, 21, 19, 0, 82, 135, 57, 19, 146, 57, 0, 21,
-  19, 19, 4, 0, 133, 105, 97, 116, 101, 0, 4, 0, 131, 114, 105, 97, 116, 101, 0,
-  72, 162, 57, 19, 173, 57, 0, 23, 8, 7, 0, 130, 111, 114, 97, 116, 101, 0, 18,
-  21, 19, 4, 0, 135, 112, 114, 111, 112, 114, 105, 97, 116, 101, 0, 22, 8, 6, 8,
-  17, 0, 130, 116, 97, 116, 101, 0, 21, 18, 19, 18, 21, 19, 22, 12, 7, 0, 130,
-  111, 110, 97, 116, 101, 0, 76, 225, 57, 23, 237, 57, 0, 15, 15, 4, 0, 133,
-  101, 118, 105, 97, 116, 101, 0, 6, 4, 0, 132, 105, 118, 97, 116, 101, 0, 70,
-  4, 58, 12, 33, 58, 19, 43, 58, 24, 56, 58, 0, 82, 11, 58, 24, 21, 58, 0, 11,
-  6, 0, 131, 111, 108, 97, 116, 101, 0, 15, 4, 6, 0, 133, 99, 117, 108, 97, 116,
-  101, 0, 9, 9, 4, 0, 130, 105, 97, 116, 101, 0, 16, 4, 8, 23, 0, 134, 109, 112,
-  108, 97, 116, 101, 0, 70, 63, 58, 15, 76, 58, 0, 24, 15, 4, 6, 0, 134, 99,
-  117, 108, 97, 116, 101, 0, 4, 6, 0, 132, 99, 117, 108, 97, 116, 101, 0, 68,
-  103, 58, 12, 116, 58, 18, 152, 58, 23, 161, 58, 24, 173, 58, 0, 23, 12, 10, 8,
-  15, 0, 132, 105, 109, 97, 116, 101, 0, 27, 18, 21, 19, 0, 68, 128, 58, 18,
-  139, 58, 0, 135, 112, 114, 111, 120, 105, 109, 97, 116, 101, 0, 21, 19, 19, 4,
-  0, 136, 120, 105, 109, 97, 116, 101, 0, 18, 21, 0, 130, 109, 97, 116, 101, 0,
-  12, 10, 8, 15, 0, 131, 105, 109, 97, 116, 101, 0, 22, 17, 18, 6, 0, 130, 109,
-  97, 116, 101, 0, 76, 191, 58, 22, 221, 58, 0, 73, 198, 58, 16, 206, 58, 0, 8,
-  7, 0, 130, 105, 116, 101, 0, 12, 4, 23, 17, 18, 6, 0, 134, 109, 105, 110, 97,
-  116, 101, 0, 12, 22, 22, 4, 0, 133, 97, 115, 115, 105, 110, 97, 116, 101, 0,
-  7, 24, 0, 132, 112, 100, 97, 116, 101, 0, 68, 12, 59, 8, 24, 59, 10, 89, 59,
-  18, 96, 59, 21, 146, 59, 23, 160, 59, 24, 230, 59, 0, 19, 21, 18, 6, 0, 132,
-  111, 114, 97, 116, 101, 0, 74, 34, 59, 17, 46, 59, 19, 58, 59, 0, 4, 27, 8, 0,
-  132, 103, 101, 114, 97, 116, 101, 0, 4, 10, 0, 134, 101, 110, 101, 114, 97,
-  116, 101, 0, 72, 65, 59, 24, 74, 59, 0, 22, 0, 132, 97, 114, 97, 116, 101, 0,
-  6, 24, 21, 0, 136, 101, 99, 117, 112, 101, 114, 97, 116, 101, 0, 8, 7, 0, 129,
-  100, 101, 0, 76, 106, 59, 16, 121, 59, 17, 135, 59, 0, 15, 21, 8, 16, 4, 0,
-  135, 108, 105, 111, 114, 97, 116, 101, 0, 16, 8, 16, 16, 18, 6, 0, 133, 111,
-  114, 97, 116, 101, 0, 18, 27, 8, 0, 132, 101, 114, 97, 116, 101, 0, 8, 10, 4,
-  27, 8, 0, 133, 103, 101, 114, 97, 116, 101, 0, 76, 173, 59, 17, 186, 59, 21,
-  202, 59, 22, 215, 59, 0, 15, 12, 9, 17, 12, 0, 133, 116, 114, 97, 116, 101, 0,
-  8, 22, 17, 18, 6, 0, 135, 99, 101, 110, 116, 114, 97, 116, 101, 0, 8, 19, 21,
-  8, 19, 0, 133, 116, 114, 97, 116, 101, 0, 17, 12, 16, 7, 4, 0, 133, 105, 115,
-  116, 114, 97, 116, 101, 0, 6, 4, 0, 132, 99, 117, 114, 97, 116, 101, 0, 72,
-  251, 59, 12, 6, 60, 22, 36, 60, 0, 25, 8, 15, 0, 132, 105, 116, 97, 116, 101,
-  0, 79, 13, 60, 16, 26, 60, 0, 15, 12, 6, 4, 9, 0, 133, 105, 116, 97, 116, 101,
-  0, 16, 12, 0, 133, 105, 116, 97, 116, 101, 0, 8, 16, 18, 11, 0, 132, 32, 115,
-  116, 97, 116, 101, 0, 70, 56, 60, 20, 67, 60, 0, 8, 7, 4, 0, 132, 113, 117,
-  97, 116, 101, 0, 71, 74, 60, 12, 86, 60, 0, 4, 17, 12, 0, 132, 101, 113, 117,
-  97, 116, 101, 0, 7, 4, 17, 12, 0, 133, 101, 113, 117, 97, 116, 101, 0, 68,
-  106, 60, 18, 119, 60, 0, 21, 10, 4, 0, 133, 103, 114, 97, 118, 97, 116, 101,
-  0, 17, 17, 8, 21, 0, 133, 111, 118, 97, 116, 101, 0, 15, 0, 79, 140, 60, 19,
-  149, 60, 0, 4, 19, 0, 131, 101, 116, 116, 101, 0, 16, 18, 6, 16, 12, 0, 136,
-  110, 99, 111, 109, 112, 108, 101, 116, 101, 0, 68, 194, 60, 6, 208, 60, 7,
-  221, 60, 15, 228, 60, 17, 1, 61, 19, 29, 61, 21, 41, 61, 22, 52, 61, 26, 64,
-  61, 0, 21, 19, 18, 21, 19, 19, 4, 0, 131, 105, 97, 116, 101, 0, 12, 5, 8, 15,
-  19, 0, 131, 115, 99, 105, 116, 101, 0, 17, 12, 0, 129, 99, 116, 0, 18, 0, 81,
-  237, 60, 19, 245, 60, 0, 18, 16, 0, 128, 104, 105, 99, 0, 17, 12, 0, 134, 109,
-  112, 111, 108, 105, 116, 101, 0, 4, 0, 76, 10, 61, 21, 18, 61, 0, 9, 0, 132,
-  110, 105, 116, 101, 0, 10, 8, 16, 18, 19, 0, 130, 97, 116, 101, 0, 22, 12, 7,
-  0, 133, 101, 115, 112, 105, 116, 101, 0, 26, 28, 4, 15, 19, 0, 129, 103, 104,
-  116, 0, 18, 19, 18, 0, 132, 112, 111, 115, 105, 116, 101, 0, 21, 0, 132, 119,
-  114, 105, 116, 101, 0, 4, 19, 16, 8, 23, 0, 131, 108, 97, 116, 101, 0, 8, 0,
-  79, 94, 61, 22, 105, 61, 0, 16, 18, 0, 132, 101, 108, 101, 116, 116, 101, 0,
-  4, 6, 0, 131, 115, 101, 116, 116, 101, 0, 69, 125, 61, 6, 158, 61, 15, 170,
-  61, 0, 12, 0, 85, 134, 61, 23, 146, 61, 0, 23, 4, 0, 133, 116, 114, 105, 98,
-  117, 116, 101, 0, 17, 18, 6, 0, 132, 114, 105, 98, 117, 116, 101, 0, 8, 6, 27,
-  8, 0, 133, 101, 99, 117, 116, 101, 0, 18, 19, 0, 130, 108, 117, 116, 101, 0,
-  12, 21, 19, 0, 129, 97, 116, 101, 0, 74, 201, 61, 12, 227, 61, 22, 237, 61,
-  23, 5, 62, 0, 72, 208, 61, 15, 219, 61, 0, 15, 15, 18, 6, 0, 130, 97, 103,
-  117, 101, 0, 24, 7, 17, 12, 0, 129, 101, 0, 20, 17, 24, 0, 131, 105, 113, 117,
-  101, 0, 68, 244, 61, 21, 251, 61, 0, 6, 0, 130, 117, 115, 101, 0, 8, 19, 0,
-  132, 117, 114, 115, 117, 101, 0, 76, 12, 62, 15, 21, 62, 0, 23, 22, 17, 12, 0,
-  128, 116, 101, 0, 24, 6, 12, 21, 10, 4, 0, 128, 114, 101, 0, 72, 45, 62, 11,
-  95, 62, 12, 103, 62, 18, 82, 65, 0, 12, 0, 68, 54, 62, 6, 60, 62, 0, 17, 0,
-  130, 118, 101, 0, 72, 67, 62, 21, 86, 62, 0, 71, 74, 62, 21, 80, 62, 0, 131,
-  101, 105, 118, 101, 0, 131, 101, 105, 118, 101, 0, 8, 19, 0, 131, 101, 105,
-  118, 101, 0, 4, 0, 131, 104, 97, 118, 101, 0, 72, 116, 62, 15, 154, 62, 22,
-  162, 62, 23, 3, 63, 0, 79, 123, 62, 21, 144, 62, 0, 8, 0, 69, 132, 62, 21,
-  138, 62, 0, 131, 105, 101, 118, 101, 0, 131, 105, 101, 118, 101, 0, 23, 8, 21,
-  0, 131, 105, 101, 118, 101, 0, 8, 5, 0, 129, 101, 118, 101, 0, 72, 172, 62,
-  17, 183, 62, 22, 225, 62, 0, 21, 10, 10, 4, 0, 130, 115, 105, 118, 101, 0, 8,
-  11, 8, 21, 0, 75, 195, 62, 19, 211, 62, 0, 19, 16, 18, 6, 0, 137, 114, 101,
-  104, 101, 110, 115, 105, 118, 101, 0, 4, 0, 136, 112, 114, 101, 104, 101, 110,
-  115, 105, 118, 101, 0, 8, 21, 0, 74, 235, 62, 19, 247, 62, 0, 4, 0, 134, 103,
-  114, 101, 115, 115, 105, 118, 101, 0, 18, 0, 134, 112, 114, 101, 115, 115,
-  105, 118, 101, 0, 68, 25, 63, 6, 38, 64, 8, 118, 64, 12, 129, 64, 17, 6, 65,
-  22, 21, 65, 24, 47, 65, 0, 70, 44, 63, 10, 59, 63, 16, 76, 63, 21, 87, 63, 22,
-  230, 63, 23, 243, 63, 0, 4, 25, 18, 21, 19, 0, 134, 111, 99, 97, 116, 105,
-  118, 101, 0, 18, 21, 8, 19, 0, 136, 114, 101, 114, 111, 103, 97, 116, 105,
-  118, 101, 0, 12, 21, 19, 0, 132, 105, 116, 105, 118, 101, 0, 72, 97, 63, 18,
-  134, 63, 23, 187, 63, 0, 69, 104, 63, 16, 119, 63, 0, 4, 15, 15, 18, 6, 0,
-  134, 111, 114, 97, 116, 105, 118, 101, 0, 8, 16, 16, 18, 6, 0, 134, 111, 114,
-  97, 116, 105, 118, 101, 0, 75, 144, 63, 13, 157, 63, 21, 171, 63, 0, 23, 24,
-  4, 0, 132, 105, 116, 97, 116, 105, 118, 101, 0, 21, 8, 19, 0, 136, 106, 111,
-  114, 97, 116, 105, 118, 101, 0, 8, 16, 16, 18, 6, 0, 135, 109, 111, 114, 97,
-  116, 105, 118, 101, 0, 22, 0, 76, 196, 63, 17, 214, 63, 0, 17, 12, 17, 12, 16,
-  7, 4, 0, 137, 115, 116, 114, 97, 116, 105, 118, 101, 0, 12, 16, 7, 4, 0, 135,
-  105, 115, 116, 114, 97, 116, 105, 118, 101, 0, 17, 8, 22, 17, 12, 0, 132, 105,
-  116, 105, 118, 101, 0, 68, 253, 63, 8, 8, 64, 17, 20, 64, 0, 15, 24, 16, 24,
-  6, 0, 132, 105, 118, 101, 0, 19, 16, 18, 6, 0, 132, 105, 116, 105, 118, 101,
-  0, 4, 22, 8, 21, 19, 8, 21, 0, 135, 101, 110, 116, 97, 116, 105, 118, 101, 0,
-  72, 51, 64, 15, 69, 64, 17, 83, 64, 24, 100, 64, 0, 19, 22, 8, 21, 19, 0, 137,
-  101, 114, 115, 112, 101, 99, 116, 105, 118, 101, 0, 8, 15, 18, 6, 0, 134, 108,
-  101, 99, 116, 105, 118, 101, 0, 12, 23, 6, 22, 12, 7, 0, 136, 116, 105, 110,
-  99, 116, 105, 118, 101, 0, 21, 23, 22, 12, 7, 0, 137, 101, 115, 116, 114, 117,
-  99, 116, 105, 118, 101, 0, 19, 16, 18, 6, 0, 129, 116, 105, 118, 101, 0, 68,
-  148, 64, 17, 160, 64, 21, 174, 64, 23, 205, 64, 24, 219, 64, 25, 231, 64, 0,
-  12, 23, 12, 17, 12, 0, 132, 116, 105, 118, 101, 0, 24, 16, 12, 7, 0, 134, 105,
-  110, 117, 116, 105, 118, 101, 0, 68, 181, 64, 18, 193, 64, 0, 19, 16, 18, 6,
-  0, 132, 97, 116, 105, 118, 101, 0, 11, 23, 24, 4, 0, 130, 97, 116, 105, 118,
-  101, 0, 12, 18, 15, 19, 27, 8, 0, 132, 97, 116, 105, 118, 101, 0, 17, 12, 16,
-  12, 7, 0, 132, 116, 105, 118, 101, 0, 76, 238, 64, 21, 249, 64, 0, 21, 8, 7,
-  0, 132, 97, 116, 105, 118, 101, 0, 8, 22, 17, 18, 6, 0, 132, 97, 116, 105,
-  118, 101, 0, 8, 22, 8, 21, 19, 8, 21, 0, 130, 97, 116, 105, 118, 101, 0, 81,
-  28, 65, 18, 38, 65, 0, 8, 22, 0, 131, 105, 116, 105, 118, 101, 0, 19, 0, 131,
-  105, 116, 105, 118, 101, 0, 23, 0, 70, 56, 65, 17, 73, 65, 0, 8, 22, 17, 18,
-  6, 0, 134, 116, 104, 105, 99, 117, 116, 105, 118, 101, 0, 12, 0, 131, 105,
-  116, 105, 118, 101, 0, 82, 89, 65, 25, 96, 65, 0, 21, 19, 0, 130, 118, 101, 0,
-  5, 4, 0, 131, 111, 118, 101, 0, 15, 23, 22, 0, 130, 121, 108, 101, 0, 72, 120,
-  65, 12, 130, 65, 0, 12, 22, 44, 0, 131, 101, 105, 122, 101, 0, 72, 149, 65,
-  10, 162, 65, 15, 173, 65, 17, 185, 65, 21, 197, 65, 22, 3, 66, 0, 17, 8, 10,
-  18, 16, 18, 11, 0, 131, 105, 122, 101, 0, 18, 6, 8, 21, 0, 130, 110, 105, 122,
-  101, 0, 15, 4, 16, 21, 18, 9, 0, 131, 105, 122, 101, 0, 12, 10, 21, 18, 0,
-  132, 97, 110, 105, 115, 101, 0, 72, 207, 65, 18, 220, 65, 19, 235, 65, 0, 10,
-  4, 15, 19, 0, 132, 105, 97, 114, 105, 122, 101, 0, 10, 21, 8, 23, 4, 6, 0,
-  134, 103, 111, 114, 105, 122, 101, 0, 85, 242, 65, 24, 249, 65, 0, 24, 22, 0,
-  129, 115, 101, 0, 22, 0, 132, 114, 112, 114, 105, 115, 101, 0, 21, 8, 27, 8,
-  0, 131, 99, 105, 115, 101, 0, 72, 30, 66, 9, 38, 66, 12, 53, 66, 15, 107, 66,
-  18, 148, 66, 0, 22, 28, 16, 0, 128, 108, 102, 0, 12, 23, 17, 4, 15, 19, 0,
-  132, 105, 110, 116, 105, 102, 102, 0, 8, 0, 75, 65, 66, 15, 82, 66, 21, 90,
-  66, 0, 70, 72, 66, 23, 77, 66, 0, 130, 105, 101, 102, 0, 130, 105, 101, 102,
-  0, 8, 5, 0, 130, 105, 101, 102, 0, 69, 97, 66, 10, 102, 66, 0, 130, 105, 101,
-  102, 0, 130, 105, 101, 102, 0, 72, 114, 66, 18, 143, 66, 0, 80, 121, 66, 22,
-  132, 66, 0, 22, 12, 11, 0, 132, 109, 115, 101, 108, 102, 0, 24, 18, 28, 0,
-  131, 114, 115, 101, 108, 102, 0, 11, 0, 128, 100, 0, 22, 17, 18, 12, 23, 12,
-  7, 17, 18, 6, 0, 129, 32, 111, 102, 0, 76, 174, 66, 17, 19, 67, 21, 90, 77, 0,
-  71, 187, 66, 8, 194, 66, 17, 214, 66, 21, 12, 67, 0, 17, 8, 0, 128, 110, 103,
-  0, 21, 14, 29, 23, 12, 15, 5, 0, 137, 66, 108, 105, 116, 122, 107, 114, 105,
-  101, 103, 0, 75, 224, 66, 17, 231, 66, 18, 240, 66, 0, 23, 0, 130, 105, 110,
-  103, 0, 12, 10, 8, 5, 0, 128, 110, 103, 0, 71, 250, 66, 10, 255, 66, 18, 4,
-  67, 0, 130, 105, 110, 103, 0, 130, 105, 110, 103, 0, 15, 0, 130, 107, 105,
-  110, 103, 0, 24, 7, 0, 128, 110, 103, 0, 68, 44, 67, 7, 57, 67, 12, 68, 67,
-  17, 241, 76, 18, 250, 76, 21, 37, 77, 24, 47, 77, 28, 80, 77, 0, 12, 21, 8, 9,
-  8, 21, 0, 131, 114, 105, 110, 103, 0, 24, 15, 6, 17, 12, 0, 129, 105, 110,
-  103, 0, 68, 132, 67, 5, 240, 67, 6, 21, 68, 7, 49, 68, 8, 50, 69, 9, 246, 69,
-  10, 2, 70, 11, 52, 70, 14, 102, 70, 15, 130, 70, 16, 213, 70, 17, 53, 71, 19,
-  222, 71, 21, 232, 71, 22, 214, 72, 23, 123, 73, 24, 67, 76, 25, 97, 76, 26,
-  164, 76, 28, 192, 76, 29, 203, 76, 0, 72, 151, 67, 14, 159, 67, 16, 180, 67,
-  17, 188, 67, 21, 203, 67, 25, 231, 67, 0, 16, 0, 130, 110, 105, 110, 103, 0,
-  80, 166, 67, 23, 173, 67, 0, 132, 97, 107, 105, 110, 103, 0, 132, 97, 107,
-  105, 110, 103, 0, 8, 21, 0, 128, 105, 110, 103, 0, 12, 23, 17, 12, 4, 16, 0,
-  133, 97, 105, 110, 105, 110, 103, 0, 87, 210, 67, 24, 220, 67, 0, 21, 18, 19,
-  0, 130, 121, 105, 110, 103, 0, 18, 6, 17, 8, 0, 130, 103, 105, 110, 103, 0,
-  11, 0, 132, 97, 118, 105, 110, 103, 0, 12, 21, 6, 0, 72, 251, 67, 22, 7, 68,
-  0, 7, 0, 134, 115, 99, 114, 105, 98, 105, 110, 103, 0, 12, 7, 0, 136, 101,
-  115, 99, 114, 105, 98, 105, 110, 103, 0, 68, 28, 68, 17, 37, 68, 0, 8, 21, 0,
-  130, 104, 105, 110, 103, 0, 8, 19, 22, 12, 7, 0, 131, 115, 105, 110, 103, 0,
-  68, 74, 68, 8, 108, 68, 12, 119, 68, 15, 131, 68, 17, 146, 68, 21, 231, 68,
-  22, 244, 68, 24, 6, 69, 0, 83, 81, 68, 22, 92, 68, 0, 15, 15, 8, 6, 0, 130,
-  100, 105, 110, 103, 0, 24, 22, 24, 19, 0, 136, 101, 114, 115, 117, 97, 100,
-  105, 110, 103, 0, 8, 6, 8, 21, 0, 132, 100, 105, 110, 103, 0, 6, 8, 21, 0,
-  133, 115, 105, 100, 105, 110, 103, 0, 24, 12, 5, 8, 21, 0, 134, 117, 105, 108,
-  100, 105, 110, 103, 0, 68, 156, 68, 8, 200, 68, 18, 214, 68, 0, 23, 22, 0, 75,
-  166, 68, 24, 187, 68, 0, 23, 12, 11, 26, 23, 18, 17, 0, 139, 105, 116, 104,
-  115, 116, 97, 110, 100, 105, 110, 103, 0, 18, 0, 135, 116, 115, 116, 97, 110,
-  100, 105, 110, 103, 0, 19, 17, 12, 0, 135, 109, 112, 101, 110, 100, 105, 110,
-  103, 0, 19, 8, 21, 21, 18, 6, 0, 134, 115, 112, 111, 110, 100, 105, 110, 103,
-  0, 18, 6, 4, 0, 133, 99, 111, 114, 100, 105, 110, 103, 0, 18, 19, 8, 21, 21,
-  18, 6, 0, 134, 115, 112, 111, 110, 100, 105, 110, 103, 0, 70, 13, 69, 23, 42,
-  69, 0, 79, 20, 69, 17, 32, 69, 0, 17, 12, 0, 134, 99, 108, 117, 100, 105, 110,
-  103, 0, 12, 0, 132, 108, 117, 100, 105, 110, 103, 0, 22, 0, 130, 121, 105,
-  110, 103, 0, 70, 84, 69, 8, 110, 69, 10, 117, 69, 11, 132, 69, 12, 141, 69,
-  16, 149, 69, 17, 159, 69, 21, 168, 69, 22, 205, 69, 23, 211, 69, 24, 220, 69,
-  0, 76, 91, 69, 21, 100, 69, 0, 23, 18, 17, 0, 131, 105, 110, 103, 0, 18, 9,
-  17, 8, 0, 131, 105, 110, 103, 0, 5, 0, 131, 105, 110, 103, 0, 7, 8, 15, 26,
-  18, 17, 14, 6, 4, 0, 131, 105, 110, 103, 0, 6, 4, 6, 0, 131, 105, 110, 103, 0,
-  15, 0, 132, 121, 105, 110, 103, 0, 18, 6, 8, 5, 0, 131, 105, 110, 103, 0, 12,
-  11, 22, 0, 131, 105, 110, 103, 0, 68, 178, 69, 8, 185, 69, 10, 197, 69, 0, 6,
-  0, 131, 105, 110, 103, 0, 9, 21, 8, 23, 17, 12, 0, 131, 105, 110, 103, 0, 4,
-  0, 130, 101, 105, 110, 103, 0, 130, 101, 105, 110, 103, 0, 4, 14, 22, 0, 131,
-  105, 110, 103, 0, 81, 227, 69, 22, 238, 69, 0, 12, 23, 17, 18, 6, 0, 131, 105,
-  110, 103, 0, 22, 12, 0, 131, 105, 110, 103, 0, 12, 21, 21, 18, 11, 0, 130,
-  121, 105, 110, 103, 0, 17, 0, 72, 11, 70, 12, 42, 70, 0, 79, 18, 70, 22, 31,
-  70, 0, 4, 11, 6, 0, 133, 108, 101, 110, 103, 105, 110, 103, 0, 22, 8, 16, 0,
-  133, 97, 103, 105, 110, 103, 0, 17, 12, 21, 0, 133, 103, 105, 110, 103, 0, 70,
-  59, 70, 23, 72, 70, 0, 17, 4, 11, 6, 27, 8, 0, 132, 103, 105, 110, 103, 0, 70,
-  79, 70, 21, 90, 70, 0, 4, 16, 0, 133, 116, 99, 104, 105, 110, 103, 0, 8, 25,
-  8, 0, 132, 121, 116, 104, 105, 110, 103, 0, 68, 109, 70, 16, 120, 70, 0, 15,
-  23, 0, 133, 97, 108, 107, 105, 110, 103, 0, 4, 0, 133, 109, 97, 107, 105, 110,
-  103, 0, 69, 146, 70, 8, 162, 70, 10, 173, 70, 15, 188, 70, 18, 204, 70, 0, 16,
-  8, 22, 22, 8, 21, 0, 135, 101, 109, 98, 108, 105, 110, 103, 0, 12, 6, 0, 133,
-  101, 105, 108, 105, 110, 103, 0, 10, 24, 23, 22, 0, 134, 114, 117, 103, 103,
-  108, 105, 110, 103, 0, 8, 23, 21, 18, 9, 0, 134, 101, 116, 101, 108, 108, 105,
-  110, 103, 0, 21, 23, 0, 130, 108, 105, 110, 103, 0, 68, 232, 70, 8, 245, 70,
-  12, 3, 71, 15, 18, 71, 16, 34, 71, 24, 44, 71, 0, 15, 6, 18, 21, 19, 0, 131,
-  105, 109, 105, 110, 103, 0, 7, 8, 8, 21, 0, 134, 100, 101, 101, 109, 105, 110,
-  103, 0, 15, 8, 11, 26, 21, 8, 25, 18, 0, 132, 109, 105, 110, 103, 0, 8, 26,
-  21, 8, 25, 18, 0, 133, 104, 101, 108, 109, 105, 110, 103, 0, 18, 6, 8, 5, 0,
-  131, 105, 110, 103, 0, 21, 7, 0, 130, 109, 105, 110, 103, 0, 68, 66, 71, 12,
-  78, 71, 17, 199, 71, 24, 214, 71, 0, 15, 19, 27, 8, 0, 131, 105, 110, 105,
-  110, 103, 0, 68, 88, 71, 10, 109, 71, 17, 175, 71, 0, 23, 21, 8, 23, 17, 12,
-  0, 139, 101, 110, 116, 101, 114, 116, 97, 105, 110, 105, 110, 103, 0, 72, 119,
-  71, 10, 127, 71, 12, 138, 71, 0, 5, 0, 130, 110, 105, 110, 103, 0, 8, 5, 0,
-  133, 105, 110, 110, 105, 110, 103, 0, 69, 148, 71, 8, 158, 71, 22, 166, 71, 0,
-  134, 101, 103, 105, 110, 110, 105, 110, 103, 0, 21, 0, 132, 110, 105, 110,
-  103, 0, 8, 7, 0, 132, 110, 105, 110, 103, 0, 12, 0, 73, 184, 71, 16, 190, 71,
+  24, 22, 0, 129, 105, 110, 101, 0, 68, 239, 50, 6, 252, 50, 8, 8, 51, 9, 50,
+  51, 10, 59, 51, 16, 67, 51, 17, 77, 51, 21, 89, 51, 22, 102, 51, 23, 130, 51,
+  24, 145, 51, 29, 157, 51, 0, 23, 17, 4, 21, 4, 24, 20, 0, 131, 105, 110, 101,
+  0, 4, 7, 8, 16, 0, 132, 105, 99, 105, 110, 101, 0, 10, 0, 76, 17, 51, 28, 27,
+  51, 0, 11, 0, 133, 121, 103, 105, 101, 110, 101, 0, 75, 34, 51, 12, 40, 51, 0,
+  131, 105, 101, 110, 101, 0, 11, 0, 134, 121, 103, 105, 101, 110, 101, 0, 9, 8,
+  7, 0, 131, 105, 110, 101, 0, 28, 11, 0, 129, 101, 110, 101, 0, 18, 23, 17, 4,
+  19, 0, 129, 109, 101, 0, 4, 17, 24, 10, 0, 133, 97, 110, 105, 110, 101, 0, 24,
+  18, 15, 9, 0, 133, 117, 111, 114, 105, 110, 101, 0, 68, 109, 51, 12, 119, 51,
+  0, 10, 4, 16, 0, 131, 122, 105, 110, 101, 0, 10, 4, 16, 0, 132, 97, 122, 105,
+  110, 101, 0, 17, 8, 21, 4, 24, 20, 0, 133, 97, 110, 116, 105, 110, 101, 0, 10,
+  8, 21, 8, 19, 0, 131, 114, 105, 110, 101, 0, 12, 10, 4, 16, 0, 132, 97, 122,
+  105, 110, 101, 0, 76, 176, 51, 24, 181, 51, 0, 23, 0, 129, 101, 0, 15, 18, 25,
+  0, 129, 101, 0, 75, 204, 51, 16, 222, 51, 18, 238, 51, 19, 246, 51, 23, 1, 52,
+  0, 19, 4, 17, 4, 21, 5, 16, 8, 16, 0, 133, 111, 112, 104, 111, 110, 101, 0,
+  18, 21, 8, 9, 0, 135, 112, 104, 101, 114, 111, 109, 111, 110, 101, 0, 17, 0,
+  130, 32, 111, 110, 101, 0, 18, 15, 15, 4, 0, 130, 104, 111, 110, 101, 0, 22,
+  8, 16, 12, 21, 5, 0, 133, 115, 116, 111, 110, 101, 0, 24, 18, 5, 21, 12, 4, 0,
+  131, 114, 110, 101, 0, 85, 37, 52, 22, 44, 52, 25, 52, 52, 0, 16, 0, 130, 111,
+  114, 101, 0, 11, 23, 0, 130, 111, 115, 101, 0, 15, 44, 0, 130, 111, 118, 101,
+  0, 79, 73, 52, 18, 82, 52, 22, 90, 52, 28, 100, 52, 0, 18, 8, 19, 0, 130, 112,
+  108, 101, 0, 15, 8, 25, 8, 7, 0, 128, 0, 12, 15, 6, 8, 0, 130, 112, 115, 101,
+  0, 23, 11, 6, 21, 4, 0, 131, 101, 116, 121, 112, 101, 0, 68, 147, 52, 6, 220,
+  52, 8, 230, 52, 11, 38, 53, 12, 49, 53, 16, 112, 53, 18, 120, 53, 21, 148, 53,
+  23, 155, 53, 24, 169, 53, 25, 210, 54, 0, 70, 163, 52, 12, 178, 52, 15, 192,
+  52, 26, 199, 52, 29, 210, 52, 0, 21, 8, 11, 23, 15, 4, 8, 11, 0, 133, 99, 97,
+  114, 101, 0, 17, 18, 12, 15, 15, 12, 16, 0, 131, 97, 105, 114, 101, 0, 24, 19,
+  18, 19, 0, 128, 0, 9, 18, 22, 0, 131, 116, 119, 97, 114, 101, 0, 29, 12, 5, 0,
+  131, 97, 114, 114, 101, 0, 18, 22, 44, 0, 131, 99, 111, 114, 101, 0, 75, 240,
+  52, 23, 16, 53, 26, 26, 53, 0, 87, 247, 52, 26, 4, 53, 0, 21, 8, 25, 18, 0,
+  132, 32, 116, 104, 101, 114, 101, 0, 16, 18, 22, 0, 132, 101, 119, 104, 101,
+  114, 101, 0, 11, 44, 0, 132, 116, 104, 101, 114, 101, 0, 11, 28, 17, 4, 0,
+  132, 119, 104, 101, 114, 101, 0, 22, 12, 15, 5, 24, 19, 0, 129, 101, 114, 0,
+  72, 59, 53, 18, 70, 53, 24, 85, 53, 0, 16, 8, 21, 19, 0, 131, 105, 101, 114,
+  101, 0, 23, 21, 19, 8, 21, 0, 133, 101, 114, 116, 111, 105, 114, 101, 0, 20,
+  0, 68, 94, 53, 7, 102, 53, 0, 132, 99, 113, 117, 105, 114, 101, 0, 4, 0, 133,
+  99, 113, 117, 105, 114, 101, 0, 18, 0, 131, 109, 111, 114, 101, 0, 71, 127,
+  53, 9, 136, 53, 0, 8, 5, 0, 131, 102, 111, 114, 101, 0, 21, 8, 11, 23, 0, 131,
+  101, 102, 111, 114, 101, 0, 8, 11, 26, 0, 129, 101, 0, 24, 6, 8, 13, 17, 18,
+  6, 0, 131, 116, 117, 114, 101, 0, 68, 191, 53, 7, 200, 53, 11, 213, 53, 15,
+  220, 53, 22, 247, 53, 23, 33, 54, 29, 198, 54, 0, 20, 22, 0, 131, 117, 97,
+  114, 101, 0, 8, 8, 6, 18, 21, 19, 0, 132, 100, 117, 114, 101, 0, 22, 0, 131,
+  117, 114, 101, 0, 24, 6, 0, 72, 230, 53, 12, 237, 53, 0, 19, 0, 130, 105, 97,
+  114, 0, 21, 10, 4, 0, 130, 116, 117, 114, 101, 0, 72, 1, 54, 17, 12, 54, 22,
+  24, 54, 0, 12, 15, 0, 133, 101, 105, 115, 117, 114, 101, 0, 8, 22, 0, 134, 99,
+  101, 110, 115, 117, 114, 101, 0, 8, 15, 5, 0, 130, 105, 110, 103, 0, 108, 52,
+  54, 4, 57, 54, 6, 130, 54, 21, 162, 54, 22, 174, 54, 24, 185, 54, 0, 130, 114,
+  117, 101, 0, 73, 73, 54, 16, 85, 54, 17, 92, 54, 21, 103, 54, 23, 118, 54, 0,
+  24, 17, 4, 16, 0, 131, 99, 116, 117, 114, 101, 0, 4, 0, 130, 101, 117, 114, 0,
+  12, 16, 0, 132, 105, 97, 116, 117, 114, 101, 0, 8, 16, 8, 23, 0, 134, 112,
+  101, 114, 97, 116, 117, 114, 101, 0, 12, 15, 0, 132, 101, 114, 97, 116, 117,
+  114, 101, 0, 85, 137, 54, 24, 150, 54, 0, 24, 23, 22, 0, 134, 114, 117, 99,
+  116, 117, 114, 101, 0, 23, 22, 0, 133, 114, 117, 99, 116, 117, 114, 101, 0, 8,
+  23, 12, 15, 0, 131, 97, 116, 117, 114, 101, 0, 18, 16, 0, 132, 105, 115, 116,
+  117, 114, 101, 0, 6, 12, 21, 10, 4, 0, 131, 108, 116, 117, 114, 101, 0, 8, 12,
+  22, 0, 133, 101, 105, 122, 117, 114, 101, 0, 72, 217, 54, 24, 227, 54, 0, 24,
+  18, 0, 132, 101, 117, 118, 114, 101, 0, 18, 8, 17, 4, 16, 0, 133, 111, 101,
+  117, 118, 114, 101, 0, 68, 13, 55, 8, 38, 55, 12, 76, 55, 14, 196, 55, 15,
+  203, 55, 17, 212, 55, 18, 67, 56, 21, 106, 56, 24, 121, 56, 0, 79, 20, 55, 24,
+  28, 55, 0, 9, 0, 131, 97, 108, 115, 101, 0, 6, 8, 5, 0, 131, 97, 117, 115,
+  101, 0, 72, 48, 55, 12, 55, 55, 22, 66, 55, 0, 11, 23, 0, 130, 115, 101, 0, 6,
+  21, 8, 27, 8, 0, 130, 115, 101, 115, 0, 18, 12, 7, 0, 131, 99, 101, 115, 101,
+  0, 70, 98, 55, 7, 112, 55, 10, 130, 55, 16, 141, 55, 21, 155, 55, 23, 180, 55,
+  24, 190, 55, 0, 21, 8, 6, 27, 8, 0, 134, 101, 114, 99, 105, 115, 101, 0, 17,
+  4, 11, 6, 8, 16, 0, 135, 114, 99, 104, 97, 110, 100, 105, 115, 101, 0, 18, 6,
+  8, 21, 0, 130, 110, 105, 115, 101, 0, 12, 21, 19, 16, 18, 6, 0, 132, 111, 109,
+  105, 115, 101, 0, 82, 162, 55, 19, 169, 55, 0, 23, 22, 0, 129, 101, 115, 0,
+  24, 22, 0, 132, 114, 112, 114, 105, 115, 101, 0, 21, 18, 23, 0, 130, 111, 105,
+  115, 101, 0, 44, 0, 130, 115, 101, 0, 4, 16, 0, 129, 101, 115, 0, 12, 4, 9, 0,
+  131, 108, 115, 101, 0, 68, 225, 55, 8, 234, 55, 12, 49, 56, 18, 55, 56, 0, 22,
+  12, 24, 17, 0, 129, 99, 101, 0, 70, 244, 55, 16, 255, 55, 22, 8, 56, 0, 22,
+  12, 15, 0, 133, 99, 101, 110, 115, 101, 0, 12, 0, 131, 109, 101, 110, 115,
+  101, 0, 69, 21, 56, 8, 27, 56, 12, 34, 56, 22, 43, 56, 0, 4, 0, 129, 99, 101,
+  0, 21, 19, 0, 129, 99, 101, 0, 15, 0, 132, 99, 101, 110, 115, 101, 0, 8, 0,
+  129, 99, 101, 0, 22, 0, 129, 99, 101, 0, 19, 8, 21, 0, 132, 115, 112, 111,
+  110, 115, 101, 0, 19, 0, 81, 79, 56, 18, 90, 56, 24, 98, 56, 0, 4, 21, 23, 0,
+  131, 115, 112, 111, 115, 101, 0, 44, 0, 130, 112, 111, 115, 101, 0, 22, 0,
+  130, 112, 111, 115, 101, 0, 8, 25, 8, 21, 19, 0, 134, 101, 114, 118, 101, 114,
+  115, 101, 0, 68, 131, 56, 6, 160, 56, 18, 171, 56, 0, 70, 138, 56, 8, 148, 56,
+  0, 6, 8, 5, 0, 132, 97, 117, 115, 101, 0, 6, 4, 5, 0, 134, 101, 99, 97, 117,
+  115, 101, 0, 4, 8, 5, 0, 132, 99, 97, 117, 115, 101, 0, 6, 8, 5, 0, 131, 97,
+  117, 115, 101, 0, 68, 203, 56, 8, 52, 61, 12, 87, 61, 15, 250, 61, 23, 6, 62,
+  24, 36, 62, 25, 100, 62, 0, 69, 243, 56, 6, 2, 57, 7, 33, 57, 10, 141, 57, 12,
+  190, 57, 15, 168, 58, 16, 8, 59, 17, 105, 59, 19, 157, 59, 21, 167, 59, 23,
+  162, 60, 24, 226, 60, 25, 20, 61, 0, 21, 8, 27, 8, 0, 133, 97, 99, 101, 114,
+  98, 97, 116, 101, 0, 12, 0, 82, 11, 57, 19, 22, 57, 0, 22, 22, 4, 0, 132, 99,
+  105, 97, 116, 101, 0, 24, 7, 0, 132, 108, 105, 99, 97, 116, 101, 0, 68, 43,
+  57, 16, 74, 57, 18, 87, 57, 0, 71, 50, 57, 16, 61, 57, 0, 17, 4, 6, 0, 132,
+  105, 100, 97, 116, 101, 0, 18, 6, 6, 4, 0, 132, 109, 111, 100, 97, 116, 101,
+  0, 18, 6, 6, 4, 0, 131, 109, 111, 100, 97, 116, 101, 0, 79, 94, 57, 16, 107,
+  57, 0, 18, 22, 17, 18, 6, 0, 132, 105, 100, 97, 116, 101, 0, 80, 114, 57, 18,
+  129, 57, 0, 18, 6, 4, 0, 135, 99, 111, 109, 109, 111, 100, 97, 116, 101, 0, 6,
+  6, 4, 0, 132, 109, 111, 100, 97, 116, 101, 0, 72, 151, 57, 17, 164, 57, 18,
+  178, 57, 0, 21, 10, 4, 0, 133, 103, 114, 101, 103, 97, 116, 101, 0, 12, 23,
+  22, 8, 25, 17, 12, 0, 132, 103, 97, 116, 101, 0, 19, 18, 21, 19, 0, 132, 97,
+  103, 97, 116, 101, 0, 70, 215, 57, 7, 247, 57, 15, 17, 58, 19, 45, 58, 21, 76,
+  58, 22, 110, 58, 23, 122, 58, 25, 139, 58, 0, 72, 222, 57, 18, 236, 57, 0, 12,
+  21, 19, 19, 4, 0, 134, 101, 99, 105, 97, 116, 101, 0, 10, 8, 17, 0, 132, 116,
+  105, 97, 116, 101, 0, 76, 254, 57, 17, 8, 58, 0, 7, 17, 4, 6, 0, 131, 97, 116,
+  101, 0, 4, 6, 0, 130, 100, 97, 116, 101, 0, 76, 24, 58, 15, 34, 58, 0, 6, 4,
+  9, 0, 130, 116, 97, 116, 101, 0, 12, 9, 9, 4, 0, 132, 105, 97, 116, 101, 0,
+  18, 21, 19, 0, 82, 56, 58, 19, 67, 58, 0, 21, 19, 19, 4, 0, 133, 105, 97, 116,
+  101, 0, 4, 0, 131, 114, 105, 97, 116, 101, 0, 72, 83, 58, 19, 94, 58, 0, 23,
+  8, 7, 0, 130, 111, 114, 97, 116, 101, 0, 18, 21, 19, 4, 0, 135, 112, 114, 111,
+  112, 114, 105, 97, 116, 101, 0, 22, 8, 6, 8, 17, 0, 130, 116, 97, 116, 101, 0,
+  21, 18, 19, 18, 21, 19, 22, 12, 7, 0, 130, 111, 110, 97, 116, 101, 0, 76, 146,
+  58, 23, 158, 58, 0, 15, 15, 4, 0, 133, 101, 118, 105, 97, 116, 101, 0, 6, 4,
+  0, 132, 105, 118, 97, 116, 101, 0, 70, 181, 58, 12, 210, 58, 19, 220, 58, 24,
+  233, 58, 0, 82, 188, 58, 24, 198, 58, 0, 11, 6, 0, 131, 111, 108, 97, 116,
+  101, 0, 15, 4, 6, 0, 133, 99, 117, 108, 97, 116, 101, 0, 9, 9, 4, 0, 130, 105,
+  97, 116, 101, 0, 16, 4, 8, 23, 0, 134, 109, 112, 108, 97, 116, 101, 0, 70,
+  240, 58, 15, 253, 58, 0, 24, 15, 4, 6, 0, 134, 99, 117, 108, 97, 116, 101, 0,
+  4, 6, 0, 132, 99, 117, 108, 97, 116, 101, 0, 68, 24, 59, 12, 37, 59, 18, 73,
+  59, 23, 82, 59, 24, 94, 59, 0, 23, 12, 10, 8, 15, 0, 132, 105, 109, 97, 116,
+  101, 0, 27, 18, 21, 19, 0, 68, 49, 59, 18, 60, 59, 0, 135, 112, 114, 111, 120,
+  105, 109, 97, 116, 101, 0, 21, 19, 19, 4, 0, 136, 120, 105, 109, 97, 116, 101,
+  0, 18, 21, 0, 130, 109, 97, 116, 101, 0, 12, 10, 8, 15, 0, 131, 105, 109, 97,
+  116, 101, 0, 22, 17, 18, 6, 0, 130, 109, 97, 116, 101, 0, 76, 112, 59, 22,
+  142, 59, 0, 73, 119, 59, 16, 127, 59, 0, 8, 7, 0, 130, 105, 116, 101, 0, 12,
+  4, 23, 17, 18, 6, 0, 134, 109, 105, 110, 97, 116, 101, 0, 12, 22, 22, 4, 0,
+  133, 97, 115, 115, 105, 110, 97, 116, 101, 0, 7, 24, 0, 132, 112, 100, 97,
+  116, 101, 0, 68, 189, 59, 8, 201, 59, 10, 10, 60, 18, 17, 60, 21, 67, 60, 23,
+  81, 60, 24, 151, 60, 0, 19, 21, 18, 6, 0, 132, 111, 114, 97, 116, 101, 0, 74,
+  211, 59, 17, 223, 59, 19, 235, 59, 0, 4, 27, 8, 0, 132, 103, 101, 114, 97,
+  116, 101, 0, 4, 10, 0, 134, 101, 110, 101, 114, 97, 116, 101, 0, 72, 242, 59,
+  24, 251, 59, 0, 22, 0, 132, 97, 114, 97, 116, 101, 0, 6, 24, 21, 0, 136, 101,
+  99, 117, 112, 101, 114, 97, 116, 101, 0, 8, 7, 0, 129, 100, 101, 0, 76, 27,
+  60, 16, 42, 60, 17, 56, 60, 0, 15, 21, 8, 16, 4, 0, 135, 108, 105, 111, 114,
+  97, 116, 101, 0, 16, 8, 16, 16, 18, 6, 0, 133, 111, 114, 97, 116, 101, 0, 18,
+  27, 8, 0, 132, 101, 114, 97, 116, 101, 0, 8, 10, 4, 27, 8, 0, 133, 103, 101,
+  114, 97, 116, 101, 0, 76, 94, 60, 17, 107, 60, 21, 123, 60, 22, 136, 60, 0,
+  15, 12, 9, 17, 12, 0, 133, 116, 114, 97, 116, 101, 0, 8, 22, 17, 18, 6, 0,
+  135, 99, 101, 110, 116, 114, 97, 116, 101, 0, 8, 19, 21, 8, 19, 0, 133, 116,
+  114, 97, 116, 101, 0, 17, 12, 16, 7, 4, 0, 133, 105, 115, 116, 114, 97, 116,
+  101, 0, 6, 4, 0, 132, 99, 117, 114, 97, 116, 101, 0, 72, 172, 60, 12, 183, 60,
+  22, 213, 60, 0, 25, 8, 15, 0, 132, 105, 116, 97, 116, 101, 0, 79, 190, 60, 16,
+  203, 60, 0, 15, 12, 6, 4, 9, 0, 133, 105, 116, 97, 116, 101, 0, 16, 12, 0,
+  133, 105, 116, 97, 116, 101, 0, 8, 16, 18, 11, 0, 132, 32, 115, 116, 97, 116,
+  101, 0, 70, 233, 60, 20, 244, 60, 0, 8, 7, 4, 0, 132, 113, 117, 97, 116, 101,
+  0, 71, 251, 60, 12, 7, 61, 0, 4, 17, 12, 0, 132, 101, 113, 117, 97, 116, 101,
+  0, 7, 4, 17, 12, 0, 133, 101, 113, 117, 97, 116, 101, 0, 68, 27, 61, 18, 40,
+  61, 0, 21, 10, 4, 0, 133, 103, 114, 97, 118, 97, 116, 101, 0, 17, 17, 8, 21,
+  0, 133, 111, 118, 97, 116, 101, 0, 15, 0, 79, 61, 61, 19, 70, 61, 0, 4, 19, 0,
+  131, 101, 116, 116, 101, 0, 16, 18, 6, 16, 12, 0, 136, 110, 99, 111, 109, 112,
+  108, 101, 116, 101, 0, 68, 115, 61, 6, 129, 61, 7, 142, 61, 15, 149, 61, 17,
+  178, 61, 19, 206, 61, 21, 218, 61, 22, 229, 61, 26, 241, 61, 0, 21, 19, 18,
+  21, 19, 19, 4, 0, 131, 105, 97, 116, 101, 0, 12, 5, 8, 15, 19, 0, 131, 115,
+  99, 105, 116, 101, 0, 17, 12, 0, 129, 99, 116, 0, 18, 0, 81, 158, 61, 19, 166,
+  61, 0, 18, 16, 0, 128, 104, 105, 99, 0, 17, 12, 0, 134, 109, 112, 111, 108,
+  105, 116, 101, 0, 4, 0, 76, 187, 61, 21, 195, 61, 0, 9, 0, 132, 110, 105, 116,
+  101, 0, 10, 8, 16, 18, 19, 0, 130, 97, 116, 101, 0, 22, 12, 7, 0, 133, 101,
+  115, 112, 105, 116, 101, 0, 26, 28, 4, 15, 19, 0, 129, 103, 104, 116, 0, 18,
+  19, 18, 0, 132, 112, 111, 115, 105, 116, 101, 0, 21, 0, 132, 119, 114, 105,
+  116, 101, 0, 4, 19, 16, 8, 23, 0, 131, 108, 97, 116, 101, 0, 8, 0, 79, 15, 62,
+  22, 26, 62, 0, 16, 18, 0, 132, 101, 108, 101, 116, 116, 101, 0, 4, 6, 0, 131,
+  115, 101, 116, 116, 101, 0, 69, 46, 62, 6, 79, 62, 15, 91, 62, 0, 12, 0, 85,
+  55, 62, 23, 67, 62, 0, 23, 4, 0, 133, 116, 114, 105, 98, 117, 116, 101, 0, 17,
+  18, 6, 0, 132, 114, 105, 98, 117, 116, 101, 0, 8, 6, 27, 8, 0, 133, 101, 99,
+  117, 116, 101, 0, 18, 19, 0, 130, 108, 117, 116, 101, 0, 12, 21, 19, 0, 129,
+  97, 116, 101, 0, 74, 122, 62, 12, 148, 62, 22, 158, 62, 23, 182, 62, 0, 72,
+  129, 62, 15, 140, 62, 0, 15, 15, 18, 6, 0, 130, 97, 103, 117, 101, 0, 24, 7,
+  17, 12, 0, 129, 101, 0, 20, 17, 24, 0, 131, 105, 113, 117, 101, 0, 68, 165,
+  62, 21, 172, 62, 0, 6, 0, 130, 117, 115, 101, 0, 8, 19, 0, 132, 117, 114, 115,
+  117, 101, 0, 76, 189, 62, 15, 198, 62, 0, 23, 22, 17, 12, 0, 128, 116, 101, 0,
+  24, 6, 12, 21, 10, 4, 0, 128, 114, 101, 0, 72, 222, 62, 11, 16, 63, 12, 24,
+  63, 18, 3, 66, 0, 12, 0, 68, 231, 62, 6, 237, 62, 0, 17, 0, 130, 118, 101, 0,
+  72, 244, 62, 21, 7, 63, 0, 71, 251, 62, 21, 1, 63, 0, 131, 101, 105, 118, 101,
+  0, 131, 101, 105, 118, 101, 0, 8, 19, 0, 131, 101, 105, 118, 101, 0, 4, 0,
+  131, 104, 97, 118, 101, 0, 72, 37, 63, 15, 75, 63, 22, 83, 63, 23, 180, 63, 0,
+  79, 44, 63, 21, 65, 63, 0, 8, 0, 69, 53, 63, 21, 59, 63, 0, 131, 105, 101,
+  118, 101, 0, 131, 105, 101, 118, 101, 0, 23, 8, 21, 0, 131, 105, 101, 118,
+  101, 0, 8, 5, 0, 129, 101, 118, 101, 0, 72, 93, 63, 17, 104, 63, 22, 146, 63,
+  0, 21, 10, 10, 4, 0, 130, 115, 105, 118, 101, 0, 8, 11, 8, 21, 0, 75, 116, 63,
+  19, 132, 63, 0, 19, 16, 18, 6, 0, 137, 114, 101, 104, 101, 110, 115, 105, 118,
+  101, 0, 4, 0, 136, 112, 114, 101, 104, 101, 110, 115, 105, 118, 101, 0, 8, 21,
+  0, 74, 156, 63, 19, 168, 63, 0, 4, 0, 134, 103, 114, 101, 115, 115, 105, 118,
+  101, 0, 18, 0, 134, 112, 114, 101, 115, 115, 105, 118, 101, 0, 68, 202, 63, 6,
+  215, 64, 8, 39, 65, 12, 50, 65, 17, 183, 65, 22, 198, 65, 24, 224, 65, 0, 70,
+  221, 63, 10, 236, 63, 16, 253, 63, 21, 8, 64, 22, 151, 64, 23, 164, 64, 0, 4,
+  25, 18, 21, 19, 0, 134, 111, 99, 97, 116, 105, 118, 101, 0, 18, 21, 8, 19, 0,
+  136, 114, 101, 114, 111, 103, 97, 116, 105, 118, 101, 0, 12, 21, 19, 0, 132,
+  105, 116, 105, 118, 101, 0, 72, 18, 64, 18, 55, 64, 23, 108, 64, 0, 69, 25,
+  64, 16, 40, 64, 0, 4, 15, 15, 18, 6, 0, 134, 111, 114, 97, 116, 105, 118, 101,
+  0, 8, 16, 16, 18, 6, 0, 134, 111, 114, 97, 116, 105, 118, 101, 0, 75, 65, 64,
+  13, 78, 64, 21, 92, 64, 0, 23, 24, 4, 0, 132, 105, 116, 97, 116, 105, 118,
+  101, 0, 21, 8, 19, 0, 136, 106, 111, 114, 97, 116, 105, 118, 101, 0, 8, 16,
+  16, 18, 6, 0, 135, 109, 111, 114, 97, 116, 105, 118, 101, 0, 22, 0, 76, 117,
+  64, 17, 135, 64, 0, 17, 12, 17, 12, 16, 7, 4, 0, 137, 115, 116, 114, 97, 116,
+  105, 118, 101, 0, 12, 16, 7, 4, 0, 135, 105, 115, 116, 114, 97, 116, 105, 118,
+  101, 0, 17, 8, 22, 17, 12, 0, 132, 105, 116, 105, 118, 101, 0, 68, 174, 64, 8,
+  185, 64, 17, 197, 64, 0, 15, 24, 16, 24, 6, 0, 132, 105, 118, 101, 0, 19, 16,
+  18, 6, 0, 132, 105, 116, 105, 118, 101, 0, 4, 22, 8, 21, 19, 8, 21, 0, 135,
+  101, 110, 116, 97, 116, 105, 118, 101, 0, 72, 228, 64, 15, 246, 64, 17, 4, 65,
+  24, 21, 65, 0, 19, 22, 8, 21, 19, 0, 137, 101, 114, 115, 112, 101, 99, 116,
+  105, 118, 101, 0, 8, 15, 18, 6, 0, 134, 108, 101, 99, 116, 105, 118, 101, 0,
+  12, 23, 6, 22, 12, 7, 0, 136, 116, 105, 110, 99, 116, 105, 118, 101, 0, 21,
+  23, 22, 12, 7, 0, 137, 101, 115, 116, 114, 117, 99, 116, 105, 118, 101, 0, 19,
+  16, 18, 6, 0, 129, 116, 105, 118, 101, 0, 68, 69, 65, 17, 81, 65, 21, 95, 65,
+  23, 126, 65, 24, 140, 65, 25, 152, 65, 0, 12, 23, 12, 17, 12, 0, 132, 116,
+  105, 118, 101, 0, 24, 16, 12, 7, 0, 134, 105, 110, 117, 116, 105, 118, 101, 0,
+  68, 102, 65, 18, 114, 65, 0, 19, 16, 18, 6, 0, 132, 97, 116, 105, 118, 101, 0,
+  11, 23, 24, 4, 0, 130, 97, 116, 105, 118, 101, 0, 12, 18, 15, 19, 27, 8, 0,
+  132, 97, 116, 105, 118, 101, 0, 17, 12, 16, 12, 7, 0, 132, 116, 105, 118, 101,
+  0, 76, 159, 65, 21, 170, 65, 0, 21, 8, 7, 0, 132, 97, 116, 105, 118, 101, 0,
+  8, 22, 17, 18, 6, 0, 132, 97, 116, 105, 118, 101, 0, 8, 22, 8, 21, 19, 8, 21,
+  0, 130, 97, 116, 105, 118, 101, 0, 81, 205, 65, 18, 215, 65, 0, 8, 22, 0, 131,
+  105, 116, 105, 118, 101, 0, 19, 0, 131, 105, 116, 105, 118, 101, 0, 23, 0, 70,
+  233, 65, 17, 250, 65, 0, 8, 22, 17, 18, 6, 0, 134, 116, 104, 105, 99, 117,
+  116, 105, 118, 101, 0, 12, 0, 131, 105, 116, 105, 118, 101, 0, 82, 10, 66, 25,
+  17, 66, 0, 21, 19, 0, 130, 118, 101, 0, 5, 4, 0, 131, 111, 118, 101, 0, 15,
+  23, 22, 0, 130, 121, 108, 101, 0, 72, 41, 66, 12, 51, 66, 0, 12, 22, 44, 0,
+  131, 101, 105, 122, 101, 0, 72, 70, 66, 10, 83, 66, 15, 94, 66, 17, 106, 66,
+  21, 118, 66, 22, 180, 66, 0, 17, 8, 10, 18, 16, 18, 11, 0, 131, 105, 122, 101,
+  0, 18, 6, 8, 21, 0, 130, 110, 105, 122, 101, 0, 15, 4, 16, 21, 18, 9, 0, 131,
+  105, 122, 101, 0, 12, 10, 21, 18, 0, 132, 97, 110, 105, 115, 101, 0, 72, 128,
+  66, 18, 141, 66, 19, 156, 66, 0, 10, 4, 15, 19, 0, 132, 105, 97, 114, 105,
+  122, 101, 0, 10, 21, 8, 23, 4, 6, 0, 134, 103, 111, 114, 105, 122, 101, 0, 85,
+  163, 66, 24, 170, 66, 0, 24, 22, 0, 129, 115, 101, 0, 22, 0, 132, 114, 112,
+  114, 105, 115, 101, 0, 21, 8, 27, 8, 0, 131, 99, 105, 115, 101, 0, 72, 207,
+  66, 9, 215, 66, 12, 230, 66, 15, 28, 67, 18, 69, 67, 0, 22, 28, 16, 0, 128,
+  108, 102, 0, 12, 23, 17, 4, 15, 19, 0, 132, 105, 110, 116, 105, 102, 102, 0,
+  8, 0, 75, 242, 66, 15, 3, 67, 21, 11, 67, 0, 70, 249, 66, 23, 254, 66, 0, 130,
+  105, 101, 102, 0, 130, 105, 101, 102, 0, 8, 5, 0, 130, 105, 101, 102, 0, 69,
+  18, 67, 10, 23, 67, 0, 130, 105, 101, 102, 0, 130, 105, 101, 102, 0, 72, 35,
+  67, 18, 64, 67, 0, 80, 42, 67, 22, 53, 67, 0, 22, 12, 11, 0, 132, 109, 115,
+  101, 108, 102, 0, 24, 18, 28, 0, 131, 114, 115, 101, 108, 102, 0, 11, 0, 128,
+  100, 0, 22, 17, 18, 12, 23, 12, 7, 17, 18, 6, 0, 129, 32, 111, 102, 0, 76, 95,
+  67, 17, 196, 67, 21, 11, 78, 0, 71, 108, 67, 8, 115, 67, 17, 135, 67, 21, 189,
+  67, 0, 17, 8, 0, 128, 110, 103, 0, 21, 14, 29, 23, 12, 15, 5, 0, 137, 66, 108,
+  105, 116, 122, 107, 114, 105, 101, 103, 0, 75, 145, 67, 17, 152, 67, 18, 161,
+  67, 0, 23, 0, 130, 105, 110, 103, 0, 12, 10, 8, 5, 0, 128, 110, 103, 0, 71,
+  171, 67, 10, 176, 67, 18, 181, 67, 0, 130, 105, 110, 103, 0, 130, 105, 110,
+  103, 0, 15, 0, 130, 107, 105, 110, 103, 0, 24, 7, 0, 128, 110, 103, 0, 68,
+  221, 67, 7, 234, 67, 12, 245, 67, 17, 162, 77, 18, 171, 77, 21, 214, 77, 24,
+  224, 77, 28, 1, 78, 0, 12, 21, 8, 9, 8, 21, 0, 131, 114, 105, 110, 103, 0, 24,
+  15, 6, 17, 12, 0, 129, 105, 110, 103, 0, 68, 53, 68, 5, 161, 68, 6, 198, 68,
+  7, 226, 68, 8, 227, 69, 9, 167, 70, 10, 179, 70, 11, 229, 70, 14, 23, 71, 15,
+  51, 71, 16, 134, 71, 17, 230, 71, 19, 143, 72, 21, 153, 72, 22, 135, 73, 23,
+  44, 74, 24, 244, 76, 25, 18, 77, 26, 85, 77, 28, 113, 77, 29, 124, 77, 0, 72,
+  72, 68, 14, 80, 68, 16, 101, 68, 17, 109, 68, 21, 124, 68, 25, 152, 68, 0, 16,
+  0, 130, 110, 105, 110, 103, 0, 80, 87, 68, 23, 94, 68, 0, 132, 97, 107, 105,
+  110, 103, 0, 132, 97, 107, 105, 110, 103, 0, 8, 21, 0, 128, 105, 110, 103, 0,
+  12, 23, 17, 12, 4, 16, 0, 133, 97, 105, 110, 105, 110, 103, 0, 87, 131, 68,
+  24, 141, 68, 0, 21, 18, 19, 0, 130, 121, 105, 110, 103, 0, 18, 6, 17, 8, 0,
+  130, 103, 105, 110, 103, 0, 11, 0, 132, 97, 118, 105, 110, 103, 0, 12, 21, 6,
+  0, 72, 172, 68, 22, 184, 68, 0, 7, 0, 134, 115, 99, 114, 105, 98, 105, 110,
+  103, 0, 12, 7, 0, 136, 101, 115, 99, 114, 105, 98, 105, 110, 103, 0, 68, 205,
+  68, 17, 214, 68, 0, 8, 21, 0, 130, 104, 105, 110, 103, 0, 8, 19, 22, 12, 7, 0,
+  131, 115, 105, 110, 103, 0, 68, 251, 68, 8, 29, 69, 12, 40, 69, 15, 52, 69,
+  17, 67, 69, 21, 152, 69, 22, 165, 69, 24, 183, 69, 0, 83, 2, 69, 22, 13, 69,
+  0, 15, 15, 8, 6, 0, 130, 100, 105, 110, 103, 0, 24, 22, 24, 19, 0, 136, 101,
+  114, 115, 117, 97, 100, 105, 110, 103, 0, 8, 6, 8, 21, 0, 132, 100, 105, 110,
+  103, 0, 6, 8, 21, 0, 133, 115, 105, 100, 105, 110, 103, 0, 24, 12, 5, 8, 21,
+  0, 134, 117, 105, 108, 100, 105, 110, 103, 0, 68, 77, 69, 8, 121, 69, 18, 135,
+  69, 0, 23, 22, 0, 75, 87, 69, 24, 108, 69, 0, 23, 12, 11, 26, 23, 18, 17, 0,
+  139, 105, 116, 104, 115, 116, 97, 110, 100, 105, 110, 103, 0, 18, 0, 135, 116,
+  115, 116, 97, 110, 100, 105, 110, 103, 0, 19, 17, 12, 0, 135, 109, 112, 101,
+  110, 100, 105, 110, 103, 0, 19, 8, 21, 21, 18, 6, 0, 134, 115, 112, 111, 110,
+  100, 105, 110, 103, 0, 18, 6, 4, 0, 133, 99, 111, 114, 100, 105, 110, 103, 0,
+  18, 19, 8, 21, 21, 18, 6, 0, 134, 115, 112, 111, 110, 100, 105, 110, 103, 0,
+  70, 190, 69, 23, 219, 69, 0, 79, 197, 69, 17, 209, 69, 0, 17, 12, 0, 134, 99,
+  108, 117, 100, 105, 110, 103, 0, 12, 0, 132, 108, 117, 100, 105, 110, 103, 0,
+  22, 0, 130, 121, 105, 110, 103, 0, 70, 5, 70, 8, 31, 70, 10, 38, 70, 11, 53,
+  70, 12, 62, 70, 16, 70, 70, 17, 80, 70, 21, 89, 70, 22, 126, 70, 23, 132, 70,
+  24, 141, 70, 0, 76, 12, 70, 21, 21, 70, 0, 23, 18, 17, 0, 131, 105, 110, 103,
+  0, 18, 9, 17, 8, 0, 131, 105, 110, 103, 0, 5, 0, 131, 105, 110, 103, 0, 7, 8,
+  15, 26, 18, 17, 14, 6, 4, 0, 131, 105, 110, 103, 0, 6, 4, 6, 0, 131, 105, 110,
+  103, 0, 15, 0, 132, 121, 105, 110, 103, 0, 18, 6, 8, 5, 0, 131, 105, 110, 103,
+  0, 12, 11, 22, 0, 131, 105, 110, 103, 0, 68, 99, 70, 8, 106, 70, 10, 118, 70,
+  0, 6, 0, 131, 105, 110, 103, 0, 9, 21, 8, 23, 17, 12, 0, 131, 105, 110, 103,
+  0, 4, 0, 130, 101, 105, 110, 103, 0, 130, 101, 105, 110, 103, 0, 4, 14, 22, 0,
+  131, 105, 110, 103, 0, 81, 148, 70, 22, 159, 70, 0, 12, 23, 17, 18, 6, 0, 131,
+  105, 110, 103, 0, 22, 12, 0, 131, 105, 110, 103, 0, 12, 21, 21, 18, 11, 0,
+  130, 121, 105, 110, 103, 0, 17, 0, 72, 188, 70, 12, 219, 70, 0, 79, 195, 70,
+  22, 208, 70, 0, 4, 11, 6, 0, 133, 108, 101, 110, 103, 105, 110, 103, 0, 22, 8,
+  16, 0, 133, 97, 103, 105, 110, 103, 0, 17, 12, 21, 0, 133, 103, 105, 110, 103,
+  0, 70, 236, 70, 23, 249, 70, 0, 17, 4, 11, 6, 27, 8, 0, 132, 103, 105, 110,
+  103, 0, 70, 0, 71, 21, 11, 71, 0, 4, 16, 0, 133, 116, 99, 104, 105, 110, 103,
+  0, 8, 25, 8, 0, 132, 121, 116, 104, 105, 110, 103, 0, 68, 30, 71, 16, 41, 71,
+  0, 15, 23, 0, 133, 97, 108, 107, 105, 110, 103, 0, 4, 0, 133, 109, 97, 107,
+  105, 110, 103, 0, 69, 67, 71, 8, 83, 71, 10, 94, 71, 15, 109, 71, 18, 125, 71,
+  0, 16, 8, 22, 22, 8, 21, 0, 135, 101, 109, 98, 108, 105, 110, 103, 0, 12, 6,
+  0, 133, 101, 105, 108, 105, 110, 103, 0, 10, 24, 23, 22, 0, 134, 114, 117,
+  103, 103, 108, 105, 110, 103, 0, 8, 23, 21, 18, 9, 0, 134, 101, 116, 101, 108,
+  108, 105, 110, 103, 0, 21, 23, 0, 130, 108, 105, 110, 103, 0, 68, 153, 71, 8,
+  166, 71, 12, 180, 71, 15, 195, 71, 16, 211, 71, 24, 221, 71, 0, 15, 6, 18, 21,
+  19, 0, 131, 105, 109, 105, 110, 103, 0, 7, 8, 8, 21, 0, 134, 100, 101, 101,
+  109, 105, 110, 103, 0, 15, 8, 11, 26, 21, 8, 25, 18, 0, 132, 109, 105, 110,
+  103, 0, 8, 26, 21, 8, 25, 18, 0, 133, 104, 101, 108, 109, 105, 110, 103, 0,
+  18, 6, 8, 5, 0, 131, 105, 110, 103, 0, 21, 7, 0, 130, 109, 105, 110, 103, 0,
+  68, 243, 71, 12, 255, 71, 17, 120, 72, 24, 135, 72, 0, 15, 19, 27, 8, 0, 131,
+  105, 110, 105, 110, 103, 0, 68, 9, 72, 10, 30, 72, 17, 96, 72, 0, 23, 21, 8,
+  23, 17, 12, 0, 139, 101, 110, 116, 101, 114, 116, 97, 105, 110, 105, 110, 103,
+  0, 72, 40, 72, 10, 48, 72, 12, 59, 72, 0, 5, 0, 130, 110, 105, 110, 103, 0, 8,
+  5, 0, 133, 105, 110, 110, 105, 110, 103, 0, 69, 69, 72, 8, 79, 72, 22, 87, 72,
+  0, 134, 101, 103, 105, 110, 110, 105, 110, 103, 0, 21, 0, 132, 110, 105, 110,
+  103, 0, 8, 7, 0, 132, 110, 105, 110, 103, 0, 12, 0, 73, 105, 72, 16, 111, 72,
   0, 8, 7, 0, 130, 103, 0, 21, 8, 23, 8, 7, 0, 130, 103, 0, 12, 10, 12, 5, 0,
   135, 101, 103, 105, 110, 110, 105, 110, 103, 0, 21, 0, 130, 110, 105, 110,
-  103, 0, 12, 11, 22, 0, 130, 112, 105, 110, 103, 0, 68, 254, 71, 8, 21, 72, 12,
-  49, 72, 18, 81, 72, 21, 91, 72, 24, 119, 72, 25, 197, 72, 0, 72, 5, 72, 25,
-  15, 72, 0, 11, 7, 4, 0, 132, 114, 105, 110, 103, 0, 130, 121, 105, 110, 103,
-  0, 9, 0, 72, 30, 72, 9, 38, 72, 0, 21, 0, 130, 114, 105, 110, 103, 0, 8, 21,
-  0, 133, 101, 114, 114, 105, 110, 103, 0, 24, 20, 0, 68, 59, 72, 7, 69, 72, 0,
-  134, 99, 113, 117, 105, 114, 105, 110, 103, 0, 4, 0, 135, 99, 113, 117, 105,
-  114, 105, 110, 103, 0, 6, 6, 4, 0, 130, 100, 105, 110, 103, 0, 24, 0, 70, 100,
-  72, 7, 114, 72, 0, 6, 4, 8, 21, 0, 136, 99, 117, 114, 114, 105, 110, 103, 0,
-  131, 105, 110, 103, 0, 70, 126, 72, 23, 164, 72, 0, 70, 133, 72, 8, 156, 72,
-  0, 72, 140, 72, 18, 150, 72, 0, 21, 0, 133, 117, 114, 114, 105, 110, 103, 0,
-  130, 114, 105, 110, 103, 0, 21, 0, 130, 114, 105, 110, 103, 0, 68, 171, 72,
-  24, 186, 72, 0, 9, 24, 17, 4, 16, 0, 133, 99, 116, 117, 114, 105, 110, 103, 0,
-  17, 0, 133, 114, 116, 117, 114, 105, 110, 103, 0, 24, 18, 8, 17, 4, 16, 0,
-  135, 111, 101, 117, 118, 114, 105, 110, 103, 0, 68, 230, 72, 8, 7, 73, 12, 51,
-  73, 18, 100, 73, 22, 109, 73, 0, 75, 237, 72, 21, 251, 72, 0, 6, 24, 19, 0,
-  134, 114, 99, 104, 97, 115, 105, 110, 103, 0, 21, 4, 11, 0, 133, 97, 115, 115,
-  105, 110, 103, 0, 85, 14, 73, 22, 41, 73, 0, 7, 0, 68, 23, 73, 7, 33, 73, 0,
+  103, 0, 12, 11, 22, 0, 130, 112, 105, 110, 103, 0, 68, 175, 72, 8, 198, 72,
+  12, 226, 72, 18, 2, 73, 21, 12, 73, 24, 40, 73, 25, 118, 73, 0, 72, 182, 72,
+  25, 192, 72, 0, 11, 7, 4, 0, 132, 114, 105, 110, 103, 0, 130, 121, 105, 110,
+  103, 0, 9, 0, 72, 207, 72, 9, 215, 72, 0, 21, 0, 130, 114, 105, 110, 103, 0,
+  8, 21, 0, 133, 101, 114, 114, 105, 110, 103, 0, 24, 20, 0, 68, 236, 72, 7,
+  246, 72, 0, 134, 99, 113, 117, 105, 114, 105, 110, 103, 0, 4, 0, 135, 99, 113,
+  117, 105, 114, 105, 110, 103, 0, 6, 6, 4, 0, 130, 100, 105, 110, 103, 0, 24,
+  0, 70, 21, 73, 7, 35, 73, 0, 6, 4, 8, 21, 0, 136, 99, 117, 114, 114, 105, 110,
+  103, 0, 131, 105, 110, 103, 0, 70, 47, 73, 23, 85, 73, 0, 70, 54, 73, 8, 77,
+  73, 0, 72, 61, 73, 18, 71, 73, 0, 21, 0, 133, 117, 114, 114, 105, 110, 103, 0,
+  130, 114, 105, 110, 103, 0, 21, 0, 130, 114, 105, 110, 103, 0, 68, 92, 73, 24,
+  107, 73, 0, 9, 24, 17, 4, 16, 0, 133, 99, 116, 117, 114, 105, 110, 103, 0, 17,
+  0, 133, 114, 116, 117, 114, 105, 110, 103, 0, 24, 18, 8, 17, 4, 16, 0, 135,
+  111, 101, 117, 118, 114, 105, 110, 103, 0, 68, 151, 73, 8, 184, 73, 12, 228,
+  73, 18, 21, 74, 22, 30, 74, 0, 75, 158, 73, 21, 172, 73, 0, 6, 24, 19, 0, 134,
+  114, 99, 104, 97, 115, 105, 110, 103, 0, 21, 4, 11, 0, 133, 97, 115, 115, 105,
+  110, 103, 0, 85, 191, 73, 22, 218, 73, 0, 7, 0, 68, 200, 73, 7, 210, 73, 0,
   133, 100, 114, 101, 115, 115, 105, 110, 103, 0, 4, 0, 130, 115, 105, 110, 103,
-  0, 22, 18, 19, 0, 130, 115, 105, 110, 103, 0, 70, 61, 73, 15, 74, 73, 22, 86,
-  73, 0, 8, 27, 8, 0, 133, 114, 99, 105, 115, 105, 110, 103, 0, 5, 4, 23, 22, 8,
+  0, 22, 18, 19, 0, 130, 115, 105, 110, 103, 0, 70, 238, 73, 15, 251, 73, 22, 7,
+  74, 0, 8, 27, 8, 0, 133, 114, 99, 105, 115, 105, 110, 103, 0, 5, 4, 23, 22, 8,
   0, 130, 104, 105, 110, 103, 0, 12, 23, 12, 21, 6, 0, 133, 99, 105, 115, 105,
   110, 103, 0, 18, 15, 0, 132, 115, 105, 110, 103, 0, 4, 21, 21, 4, 11, 0, 134,
-  97, 115, 115, 105, 110, 103, 0, 68, 157, 73, 6, 190, 74, 11, 245, 74, 12, 254,
-  74, 15, 68, 75, 17, 80, 75, 19, 121, 75, 22, 136, 75, 23, 169, 75, 24, 4, 76,
-  28, 56, 76, 0, 71, 176, 73, 12, 215, 73, 17, 231, 73, 21, 13, 74, 23, 89, 74,
-  25, 175, 74, 0, 68, 183, 73, 18, 199, 73, 0, 16, 18, 6, 6, 4, 0, 134, 109,
-  111, 100, 97, 116, 105, 110, 103, 0, 16, 18, 6, 6, 4, 0, 134, 109, 111, 100,
-  97, 116, 105, 110, 103, 0, 21, 18, 12, 21, 8, 23, 8, 7, 0, 133, 97, 116, 105,
-  110, 103, 0, 12, 16, 0, 72, 241, 73, 12, 255, 73, 0, 15, 8, 0, 136, 105, 109,
-  105, 110, 97, 116, 105, 110, 103, 0, 15, 24, 6, 0, 136, 109, 105, 110, 97,
-  116, 105, 110, 103, 0, 72, 26, 74, 10, 41, 74, 18, 56, 74, 21, 73, 74, 0, 10,
+  97, 115, 115, 105, 110, 103, 0, 68, 78, 74, 6, 111, 75, 11, 166, 75, 12, 175,
+  75, 15, 245, 75, 17, 1, 76, 19, 42, 76, 22, 57, 76, 23, 90, 76, 24, 181, 76,
+  28, 233, 76, 0, 71, 97, 74, 12, 136, 74, 17, 152, 74, 21, 190, 74, 23, 10, 75,
+  25, 96, 75, 0, 68, 104, 74, 18, 120, 74, 0, 16, 18, 6, 6, 4, 0, 134, 109, 111,
+  100, 97, 116, 105, 110, 103, 0, 16, 18, 6, 6, 4, 0, 134, 109, 111, 100, 97,
+  116, 105, 110, 103, 0, 21, 18, 12, 21, 8, 23, 8, 7, 0, 133, 97, 116, 105, 110,
+  103, 0, 12, 16, 0, 72, 162, 74, 12, 176, 74, 0, 15, 8, 0, 136, 105, 109, 105,
+  110, 97, 116, 105, 110, 103, 0, 15, 24, 6, 0, 136, 109, 105, 110, 97, 116,
+  105, 110, 103, 0, 72, 203, 74, 10, 218, 74, 18, 233, 74, 21, 250, 74, 0, 10,
   4, 27, 8, 0, 134, 103, 101, 114, 97, 116, 105, 110, 103, 0, 8, 17, 8, 7, 0,
   135, 105, 103, 114, 97, 116, 105, 110, 103, 0, 16, 16, 8, 16, 16, 18, 6, 0,
   135, 111, 114, 97, 116, 105, 110, 103, 0, 8, 10, 4, 27, 8, 0, 135, 103, 101,
-  114, 97, 116, 105, 110, 103, 0, 72, 102, 74, 12, 115, 74, 17, 128, 74, 22,
-  140, 74, 0, 25, 8, 15, 0, 134, 105, 116, 97, 116, 105, 110, 103, 0, 16, 16,
-  12, 0, 135, 105, 116, 97, 116, 105, 110, 103, 0, 8, 12, 15, 4, 0, 133, 97,
-  116, 105, 110, 103, 0, 72, 147, 74, 12, 161, 74, 0, 25, 8, 7, 0, 135, 97, 115,
-  116, 97, 116, 105, 110, 103, 0, 25, 8, 7, 0, 135, 97, 115, 116, 97, 116, 105,
-  110, 103, 0, 18, 17, 17, 8, 21, 0, 135, 111, 118, 97, 116, 105, 110, 103, 0,
-  72, 197, 74, 12, 234, 74, 0, 21, 24, 22, 0, 72, 208, 74, 22, 219, 74, 0, 21,
-  0, 133, 114, 101, 99, 116, 105, 110, 103, 0, 22, 8, 21, 0, 137, 117, 114, 114,
-  101, 99, 116, 105, 110, 103, 0, 27, 8, 0, 133, 99, 105, 116, 105, 110, 103, 0,
-  44, 0, 132, 116, 104, 105, 110, 103, 0, 80, 5, 75, 24, 55, 75, 0, 72, 15, 75,
-  16, 21, 75, 18, 44, 75, 0, 130, 116, 105, 110, 103, 0, 72, 28, 75, 18, 36, 75,
-  0, 133, 105, 116, 116, 105, 110, 103, 0, 6, 0, 130, 116, 105, 110, 103, 0, 6,
-  0, 132, 109, 105, 116, 116, 105, 110, 103, 0, 6, 8, 21, 0, 133, 114, 117, 105,
-  116, 105, 110, 103, 0, 4, 8, 16, 22, 0, 133, 108, 116, 105, 110, 103, 0, 72,
-  87, 75, 12, 104, 75, 0, 16, 4, 15, 19, 16, 12, 0, 135, 101, 109, 101, 110,
+  114, 97, 116, 105, 110, 103, 0, 72, 23, 75, 12, 36, 75, 17, 49, 75, 22, 61,
+  75, 0, 25, 8, 15, 0, 134, 105, 116, 97, 116, 105, 110, 103, 0, 16, 16, 12, 0,
+  135, 105, 116, 97, 116, 105, 110, 103, 0, 8, 12, 15, 4, 0, 133, 97, 116, 105,
+  110, 103, 0, 72, 68, 75, 12, 82, 75, 0, 25, 8, 7, 0, 135, 97, 115, 116, 97,
+  116, 105, 110, 103, 0, 25, 8, 7, 0, 135, 97, 115, 116, 97, 116, 105, 110, 103,
+  0, 18, 17, 17, 8, 21, 0, 135, 111, 118, 97, 116, 105, 110, 103, 0, 72, 118,
+  75, 12, 155, 75, 0, 21, 24, 22, 0, 72, 129, 75, 22, 140, 75, 0, 21, 0, 133,
+  114, 101, 99, 116, 105, 110, 103, 0, 22, 8, 21, 0, 137, 117, 114, 114, 101,
+  99, 116, 105, 110, 103, 0, 27, 8, 0, 133, 99, 105, 116, 105, 110, 103, 0, 44,
+  0, 132, 116, 104, 105, 110, 103, 0, 80, 182, 75, 24, 232, 75, 0, 72, 192, 75,
+  16, 198, 75, 18, 221, 75, 0, 130, 116, 105, 110, 103, 0, 72, 205, 75, 18, 213,
+  75, 0, 133, 105, 116, 116, 105, 110, 103, 0, 6, 0, 130, 116, 105, 110, 103, 0,
+  6, 0, 132, 109, 105, 116, 116, 105, 110, 103, 0, 6, 8, 21, 0, 133, 114, 117,
+  105, 116, 105, 110, 103, 0, 4, 8, 16, 22, 0, 133, 108, 116, 105, 110, 103, 0,
+  72, 8, 76, 12, 25, 76, 0, 16, 4, 15, 19, 16, 12, 0, 135, 101, 109, 101, 110,
   116, 105, 110, 103, 0, 18, 19, 4, 22, 12, 7, 0, 134, 112, 111, 105, 110, 116,
   105, 110, 103, 0, 16, 8, 23, 4, 0, 134, 116, 101, 109, 112, 116, 105, 110,
-  103, 0, 68, 143, 75, 12, 160, 75, 0, 6, 4, 7, 4, 18, 21, 5, 0, 135, 99, 97,
-  115, 116, 105, 110, 103, 0, 25, 0, 131, 105, 116, 105, 110, 103, 0, 68, 179,
-  75, 8, 190, 75, 12, 215, 75, 0, 21, 8, 17, 8, 10, 0, 131, 105, 110, 103, 0,
-  74, 197, 75, 14, 206, 75, 0, 21, 4, 23, 0, 131, 105, 110, 103, 0, 21, 4, 16,
-  0, 131, 105, 110, 103, 0, 16, 0, 80, 224, 75, 18, 249, 75, 0, 72, 231, 75, 18,
-  239, 75, 0, 134, 105, 116, 116, 105, 110, 103, 0, 44, 0, 134, 105, 116, 116,
-  105, 110, 103, 0, 6, 0, 133, 109, 105, 116, 116, 105, 110, 103, 0, 70, 17, 76,
-  7, 31, 76, 15, 37, 76, 19, 48, 76, 0, 8, 6, 27, 8, 0, 135, 101, 99, 117, 116,
+  103, 0, 68, 64, 76, 12, 81, 76, 0, 6, 4, 7, 4, 18, 21, 5, 0, 135, 99, 97, 115,
+  116, 105, 110, 103, 0, 25, 0, 131, 105, 116, 105, 110, 103, 0, 68, 100, 76, 8,
+  111, 76, 12, 136, 76, 0, 21, 8, 17, 8, 10, 0, 131, 105, 110, 103, 0, 74, 118,
+  76, 14, 127, 76, 0, 21, 4, 23, 0, 131, 105, 110, 103, 0, 21, 4, 16, 0, 131,
+  105, 110, 103, 0, 16, 0, 80, 145, 76, 18, 170, 76, 0, 72, 152, 76, 18, 160,
+  76, 0, 134, 105, 116, 116, 105, 110, 103, 0, 44, 0, 134, 105, 116, 116, 105,
+  110, 103, 0, 6, 0, 133, 109, 105, 116, 116, 105, 110, 103, 0, 70, 194, 76, 7,
+  208, 76, 15, 214, 76, 19, 225, 76, 0, 8, 6, 27, 8, 0, 135, 101, 99, 117, 116,
   105, 110, 103, 0, 131, 114, 105, 110, 103, 0, 18, 19, 0, 132, 108, 117, 116,
   105, 110, 103, 0, 44, 0, 130, 116, 105, 110, 103, 0, 21, 8, 25, 8, 0, 130,
-  104, 105, 110, 103, 0, 22, 0, 68, 76, 76, 21, 85, 76, 0, 6, 0, 132, 117, 115,
-  105, 110, 103, 0, 8, 19, 0, 134, 117, 114, 115, 117, 105, 110, 103, 0, 72,
-  107, 76, 12, 136, 76, 18, 149, 76, 0, 70, 114, 76, 12, 124, 76, 0, 8, 21, 0,
-  131, 105, 118, 105, 110, 103, 0, 6, 8, 21, 0, 133, 101, 105, 118, 105, 110,
-  103, 0, 8, 15, 8, 5, 0, 133, 105, 101, 118, 105, 110, 103, 0, 21, 19, 17, 12,
-  0, 135, 109, 112, 114, 111, 118, 105, 110, 103, 0, 18, 15, 0, 68, 174, 76, 18,
-  182, 76, 0, 132, 108, 111, 119, 105, 110, 103, 0, 9, 0, 132, 108, 111, 119,
-  105, 110, 103, 0, 23, 28, 17, 4, 0, 131, 104, 105, 110, 103, 0, 76, 210, 76,
-  28, 223, 76, 0, 23, 12, 21, 6, 0, 131, 99, 105, 122, 105, 110, 103, 0, 23, 8,
-  15, 8, 22, 18, 21, 19, 0, 134, 121, 116, 105, 122, 105, 110, 103, 0, 12, 17,
-  4, 8, 16, 0, 129, 103, 0, 75, 1, 77, 23, 14, 77, 0, 23, 19, 12, 7, 0, 132,
-  104, 116, 104, 111, 110, 103, 0, 75, 21, 77, 22, 31, 77, 0, 19, 12, 7, 0, 130,
+  104, 105, 110, 103, 0, 22, 0, 68, 253, 76, 21, 6, 77, 0, 6, 0, 132, 117, 115,
+  105, 110, 103, 0, 8, 19, 0, 134, 117, 114, 115, 117, 105, 110, 103, 0, 72, 28,
+  77, 12, 57, 77, 18, 70, 77, 0, 70, 35, 77, 12, 45, 77, 0, 8, 21, 0, 131, 105,
+  118, 105, 110, 103, 0, 6, 8, 21, 0, 133, 101, 105, 118, 105, 110, 103, 0, 8,
+  15, 8, 5, 0, 133, 105, 101, 118, 105, 110, 103, 0, 21, 19, 17, 12, 0, 135,
+  109, 112, 114, 111, 118, 105, 110, 103, 0, 18, 15, 0, 68, 95, 77, 18, 103, 77,
+  0, 132, 108, 111, 119, 105, 110, 103, 0, 9, 0, 132, 108, 111, 119, 105, 110,
+  103, 0, 23, 28, 17, 4, 0, 131, 104, 105, 110, 103, 0, 76, 131, 77, 28, 144,
+  77, 0, 23, 12, 21, 6, 0, 131, 99, 105, 122, 105, 110, 103, 0, 23, 8, 15, 8,
+  22, 18, 21, 19, 0, 134, 121, 116, 105, 122, 105, 110, 103, 0, 12, 17, 4, 8,
+  16, 0, 129, 103, 0, 75, 178, 77, 23, 191, 77, 0, 23, 19, 12, 7, 0, 132, 104,
+  116, 104, 111, 110, 103, 0, 75, 198, 77, 22, 208, 77, 0, 19, 12, 7, 0, 130,
   104, 111, 110, 103, 0, 130, 114, 111, 110, 103, 0, 12, 23, 22, 0, 131, 114,
-  105, 110, 103, 0, 80, 57, 77, 17, 64, 77, 18, 73, 77, 0, 4, 0, 130, 111, 110,
-  103, 0, 17, 24, 21, 0, 130, 105, 110, 103, 0, 16, 4, 0, 130, 110, 103, 0, 21,
-  21, 4, 6, 0, 129, 105, 110, 103, 0, 24, 5, 16, 8, 21, 24, 17, 0, 136, 78, 117,
-  114, 101, 109, 98, 101, 114, 103, 0, 70, 131, 77, 8, 39, 78, 10, 51, 78, 12,
-  134, 78, 19, 143, 78, 22, 177, 78, 23, 248, 78, 0, 68, 150, 77, 11, 186, 77,
-  12, 195, 77, 15, 230, 77, 21, 238, 77, 24, 31, 78, 0, 8, 0, 83, 159, 77, 22,
-  181, 77, 0, 81, 166, 77, 22, 176, 77, 0, 12, 0, 133, 109, 112, 101, 97, 99,
-  104, 0, 130, 101, 99, 104, 0, 129, 114, 99, 104, 0, 12, 26, 0, 131, 104, 105,
-  99, 104, 0, 75, 205, 77, 19, 216, 77, 23, 221, 77, 0, 26, 7, 17, 4, 22, 0,
-  131, 105, 99, 104, 0, 129, 116, 99, 104, 0, 26, 22, 0, 131, 105, 116, 99, 104,
-  0, 11, 26, 0, 130, 105, 99, 104, 0, 68, 245, 77, 24, 22, 78, 0, 72, 252, 77,
-  21, 9, 78, 0, 22, 4, 8, 21, 0, 134, 115, 101, 97, 114, 99, 104, 0, 12, 8, 11,
-  0, 134, 105, 101, 114, 97, 114, 99, 104, 0, 6, 0, 131, 104, 117, 114, 99, 104,
-  0, 11, 6, 0, 129, 114, 99, 104, 0, 23, 7, 17, 4, 44, 0, 130, 32, 116, 104,
-  101, 0, 81, 58, 78, 24, 67, 78, 0, 8, 21, 23, 22, 0, 128, 116, 104, 0, 18, 0,
-  75, 76, 78, 23, 124, 78, 0, 23, 0, 78, 88, 78, 15, 100, 78, 17, 111, 78, 0, 4,
-  8, 21, 5, 0, 131, 114, 111, 117, 103, 104, 0, 15, 4, 0, 134, 116, 104, 111,
-  117, 103, 104, 0, 8, 25, 8, 0, 133, 32, 116, 104, 111, 117, 103, 104, 0, 15,
-  4, 0, 131, 104, 111, 117, 103, 104, 0, 6, 11, 26, 0, 130, 105, 99, 104, 0, 68,
-  150, 78, 15, 165, 78, 0, 21, 10, 17, 18, 11, 19, 0, 132, 111, 103, 114, 97,
-  112, 104, 0, 10, 18, 21, 8, 12, 11, 0, 129, 121, 112, 104, 0, 76, 184, 78, 24,
-  236, 78, 0, 74, 194, 78, 15, 207, 78, 21, 223, 78, 0, 17, 12, 23, 22, 12, 7,
-  0, 130, 117, 105, 115, 104, 0, 19, 16, 18, 6, 4, 0, 134, 99, 111, 109, 112,
-  108, 105, 115, 104, 0, 18, 24, 15, 9, 0, 133, 111, 117, 114, 105, 115, 104, 0,
-  20, 17, 12, 15, 8, 21, 0, 129, 105, 115, 104, 0, 68, 20, 79, 8, 34, 79, 10,
-  42, 79, 12, 76, 79, 15, 87, 79, 17, 96, 79, 21, 126, 79, 24, 136, 79, 26, 144,
-  79, 0, 8, 26, 17, 18, 16, 16, 18, 6, 0, 129, 108, 116, 104, 0, 17, 12, 17, 0,
-  130, 116, 104, 0, 72, 52, 79, 12, 62, 79, 24, 69, 79, 0, 21, 23, 22, 0, 130,
-  110, 103, 116, 104, 0, 8, 11, 0, 129, 104, 116, 0, 18, 9, 0, 129, 104, 116, 0,
-  26, 7, 17, 4, 5, 0, 129, 100, 116, 104, 0, 8, 26, 23, 0, 129, 102, 116, 104,
-  0, 72, 103, 79, 24, 118, 79, 0, 8, 23, 17, 12, 17, 0, 133, 101, 116, 101, 101,
-  110, 116, 104, 0, 18, 16, 0, 131, 110, 116, 104, 0, 24, 23, 44, 0, 131, 114,
-  117, 116, 104, 0, 18, 9, 0, 129, 114, 116, 104, 0, 12, 44, 0, 131, 119, 105,
-  116, 104, 0, 72, 160, 79, 23, 168, 79, 0, 25, 18, 16, 0, 129, 105, 101, 0, 23,
-  12, 9, 4, 21, 10, 0, 131, 102, 105, 116, 105, 0, 68, 203, 79, 6, 226, 79, 8,
-  17, 80, 12, 24, 80, 17, 33, 80, 18, 58, 80, 21, 65, 80, 0, 70, 210, 79, 8,
-  217, 79, 0, 5, 0, 130, 97, 99, 107, 0, 21, 11, 22, 0, 130, 105, 101, 107, 0,
-  4, 0, 69, 238, 79, 13, 249, 79, 21, 3, 80, 0, 16, 18, 6, 0, 131, 101, 98, 97,
-  99, 107, 0, 28, 11, 0, 132, 105, 106, 97, 99, 107, 0, 23, 17, 24, 18, 22, 0,
-  132, 100, 116, 114, 97, 99, 107, 0, 12, 15, 0, 129, 107, 101, 0, 17, 21, 7, 0,
-  130, 105, 110, 107, 0, 76, 40, 80, 24, 50, 80, 0, 23, 11, 0, 132, 116, 104,
-  105, 110, 107, 0, 12, 11, 23, 0, 130, 110, 107, 0, 18, 18, 5, 0, 129, 107, 0,
-  26, 18, 44, 0, 131, 119, 111, 114, 107, 0, 68, 106, 80, 7, 66, 88, 8, 108, 88,
-  12, 9, 89, 15, 68, 89, 18, 217, 89, 23, 6, 90, 24, 15, 90, 26, 91, 90, 28,
-  100, 90, 0, 70, 143, 80, 7, 79, 82, 8, 107, 82, 11, 117, 82, 12, 142, 82, 17,
-  45, 85, 19, 56, 86, 21, 88, 86, 22, 201, 86, 23, 251, 86, 24, 135, 87, 25, 20,
-  88, 0, 68, 153, 80, 12, 162, 80, 18, 70, 82, 0, 23, 22, 5, 18, 0, 129, 108,
-  101, 0, 68, 196, 80, 6, 205, 80, 7, 219, 80, 9, 227, 80, 10, 250, 80, 11, 47,
-  81, 15, 128, 81, 17, 156, 81, 21, 189, 81, 22, 239, 81, 23, 4, 82, 0, 21, 5,
-  8, 10, 15, 4, 0, 129, 0, 21, 4, 21, 8, 12, 11, 0, 131, 104, 105, 99, 97, 108,
-  0, 24, 13, 0, 129, 105, 97, 108, 0, 73, 234, 80, 12, 241, 80, 0, 18, 0, 129,
-  105, 97, 108, 0, 23, 21, 4, 0, 129, 105, 97, 108, 0, 18, 15, 0, 72, 7, 81, 12,
-  23, 81, 18, 32, 81, 0, 4, 11, 6, 21, 4, 0, 134, 111, 108, 111, 103, 105, 99,
-  97, 108, 0, 133, 108, 111, 103, 105, 99, 97, 108, 0, 8, 17, 8, 10, 0, 135, 97,
-  108, 111, 103, 105, 99, 97, 108, 0, 70, 54, 81, 19, 69, 81, 0, 4, 21, 8, 12,
-  11, 0, 133, 114, 99, 104, 105, 99, 97, 108, 0, 68, 76, 81, 18, 85, 81, 0, 21,
-  10, 18, 16, 8, 7, 0, 129, 0, 22, 0, 76, 94, 81, 18, 110, 81, 0, 15, 12, 11,
-  19, 0, 136, 111, 115, 111, 112, 104, 105, 99, 97, 108, 0, 15, 28, 11, 19, 0,
-  138, 105, 108, 111, 115, 111, 112, 104, 105, 99, 97, 108, 0, 69, 135, 81, 18,
-  147, 81, 0, 4, 12, 7, 0, 132, 111, 108, 105, 99, 97, 108, 0, 19, 0, 130, 116,
-  105, 99, 97, 108, 0, 81, 163, 81, 18, 176, 81, 0, 4, 23, 12, 21, 24, 19, 0,
-  132, 105, 99, 97, 108, 0, 17, 17, 4, 6, 0, 134, 111, 110, 105, 99, 97, 108, 0,
-  72, 196, 81, 23, 224, 81, 0, 80, 203, 81, 19, 213, 81, 0, 16, 18, 6, 0, 131,
-  99, 105, 97, 108, 0, 16, 8, 0, 133, 105, 114, 105, 99, 97, 108, 0, 8, 16, 28,
-  22, 0, 134, 109, 101, 116, 114, 105, 99, 97, 108, 0, 28, 11, 19, 4, 23, 4, 16,
-  0, 138, 101, 116, 97, 112, 104, 121, 115, 105, 99, 97, 108, 0, 79, 17, 82, 17,
-  28, 82, 21, 43, 82, 22, 62, 82, 0, 18, 19, 0, 132, 105, 116, 105, 99, 97, 108,
-  0, 8, 7, 17, 12, 0, 136, 100, 101, 110, 116, 105, 99, 97, 108, 0, 68, 50, 82,
-  6, 54, 82, 0, 129, 108, 101, 0, 132, 105, 116, 105, 99, 97, 108, 0, 12, 8, 11,
-  23, 4, 0, 129, 0, 23, 18, 21, 19, 0, 129, 111, 108, 0, 76, 86, 82, 21, 96, 82,
-  0, 21, 18, 6, 0, 131, 100, 105, 97, 108, 0, 18, 16, 12, 21, 19, 0, 129, 105,
-  97, 108, 0, 21, 8, 25, 8, 22, 0, 130, 97, 108, 0, 82, 124, 82, 23, 132, 82, 0,
-  6, 15, 4, 0, 129, 111, 108, 0, 4, 8, 15, 0, 132, 116, 104, 97, 108, 0, 70,
-  167, 82, 7, 210, 83, 16, 223, 83, 17, 234, 83, 19, 14, 84, 21, 25, 84, 23, 98,
-  84, 25, 33, 85, 0, 68, 192, 82, 12, 203, 82, 16, 75, 83, 17, 85, 83, 19, 143,
-  83, 21, 152, 83, 22, 190, 83, 24, 199, 83, 0, 17, 12, 9, 0, 131, 110, 99, 105,
-  97, 108, 0, 73, 222, 82, 11, 2, 83, 17, 14, 83, 21, 26, 83, 23, 55, 83, 25,
-  64, 83, 0, 73, 229, 82, 12, 245, 82, 0, 18, 17, 12, 0, 137, 117, 110, 111,
-  102, 102, 105, 99, 105, 97, 108, 0, 17, 8, 5, 0, 134, 101, 102, 105, 99, 105,
-  97, 108, 0, 19, 4, 21, 10, 18, 8, 10, 0, 130, 97, 108, 0, 12, 25, 18, 21, 19,
-  0, 132, 99, 105, 97, 108, 0, 72, 33, 83, 18, 44, 83, 0, 16, 16, 18, 6, 0, 132,
-  99, 105, 97, 108, 0, 11, 19, 4, 23, 8, 16, 0, 130, 97, 108, 0, 17, 8, 7, 12,
-  0, 130, 97, 108, 0, 18, 21, 19, 0, 131, 110, 99, 105, 97, 108, 0, 8, 11, 6, 0,
-  131, 105, 99, 97, 108, 0, 68, 95, 83, 8, 107, 83, 12, 134, 83, 0, 23, 22, 5,
-  24, 22, 0, 131, 116, 105, 97, 108, 0, 86, 114, 83, 24, 123, 83, 0, 22, 8, 0,
-  131, 116, 105, 97, 108, 0, 15, 9, 17, 12, 0, 131, 116, 105, 97, 108, 0, 15, 6,
-  0, 131, 105, 99, 97, 108, 0, 28, 23, 0, 131, 105, 99, 97, 108, 0, 8, 25, 0,
-  68, 162, 83, 18, 178, 83, 0, 21, 23, 17, 18, 6, 0, 135, 111, 118, 101, 114,
-  115, 105, 97, 108, 0, 21, 23, 17, 18, 6, 0, 131, 115, 105, 97, 108, 0, 24, 16,
-  0, 131, 105, 99, 97, 108, 0, 7, 24, 13, 0, 132, 105, 99, 105, 97, 108, 0, 12,
-  6, 24, 22, 0, 133, 105, 99, 105, 100, 97, 108, 0, 18, 17, 18, 21, 19, 0, 129,
-  110, 97, 108, 0, 72, 241, 83, 18, 255, 83, 0, 23, 17, 8, 23, 17, 8, 6, 0, 133,
+  105, 110, 103, 0, 80, 234, 77, 17, 241, 77, 18, 250, 77, 0, 4, 0, 130, 111,
+  110, 103, 0, 17, 24, 21, 0, 130, 105, 110, 103, 0, 16, 4, 0, 130, 110, 103, 0,
+  21, 21, 4, 6, 0, 129, 105, 110, 103, 0, 24, 5, 16, 8, 21, 24, 17, 0, 136, 78,
+  117, 114, 101, 109, 98, 101, 114, 103, 0, 70, 52, 78, 8, 216, 78, 10, 228, 78,
+  12, 55, 79, 19, 64, 79, 22, 98, 79, 23, 169, 79, 0, 68, 71, 78, 11, 107, 78,
+  12, 116, 78, 15, 151, 78, 21, 159, 78, 24, 208, 78, 0, 8, 0, 83, 80, 78, 22,
+  102, 78, 0, 81, 87, 78, 22, 97, 78, 0, 12, 0, 133, 109, 112, 101, 97, 99, 104,
+  0, 130, 101, 99, 104, 0, 129, 114, 99, 104, 0, 12, 26, 0, 131, 104, 105, 99,
+  104, 0, 75, 126, 78, 19, 137, 78, 23, 142, 78, 0, 26, 7, 17, 4, 22, 0, 131,
+  105, 99, 104, 0, 129, 116, 99, 104, 0, 26, 22, 0, 131, 105, 116, 99, 104, 0,
+  11, 26, 0, 130, 105, 99, 104, 0, 68, 166, 78, 24, 199, 78, 0, 72, 173, 78, 21,
+  186, 78, 0, 22, 4, 8, 21, 0, 134, 115, 101, 97, 114, 99, 104, 0, 12, 8, 11, 0,
+  134, 105, 101, 114, 97, 114, 99, 104, 0, 6, 0, 131, 104, 117, 114, 99, 104, 0,
+  11, 6, 0, 129, 114, 99, 104, 0, 23, 7, 17, 4, 44, 0, 130, 32, 116, 104, 101,
+  0, 81, 235, 78, 24, 244, 78, 0, 8, 21, 23, 22, 0, 128, 116, 104, 0, 18, 0, 75,
+  253, 78, 23, 45, 79, 0, 23, 0, 78, 9, 79, 15, 21, 79, 17, 32, 79, 0, 4, 8, 21,
+  5, 0, 131, 114, 111, 117, 103, 104, 0, 15, 4, 0, 134, 116, 104, 111, 117, 103,
+  104, 0, 8, 25, 8, 0, 133, 32, 116, 104, 111, 117, 103, 104, 0, 15, 4, 0, 131,
+  104, 111, 117, 103, 104, 0, 6, 11, 26, 0, 130, 105, 99, 104, 0, 68, 71, 79,
+  15, 86, 79, 0, 21, 10, 17, 18, 11, 19, 0, 132, 111, 103, 114, 97, 112, 104, 0,
+  10, 18, 21, 8, 12, 11, 0, 129, 121, 112, 104, 0, 76, 105, 79, 24, 157, 79, 0,
+  74, 115, 79, 15, 128, 79, 21, 144, 79, 0, 17, 12, 23, 22, 12, 7, 0, 130, 117,
+  105, 115, 104, 0, 19, 16, 18, 6, 4, 0, 134, 99, 111, 109, 112, 108, 105, 115,
+  104, 0, 18, 24, 15, 9, 0, 133, 111, 117, 114, 105, 115, 104, 0, 20, 17, 12,
+  15, 8, 21, 0, 129, 105, 115, 104, 0, 68, 197, 79, 8, 211, 79, 10, 219, 79, 12,
+  253, 79, 15, 8, 80, 17, 17, 80, 21, 47, 80, 24, 57, 80, 26, 65, 80, 0, 8, 26,
+  17, 18, 16, 16, 18, 6, 0, 129, 108, 116, 104, 0, 17, 12, 17, 0, 130, 116, 104,
+  0, 72, 229, 79, 12, 239, 79, 24, 246, 79, 0, 21, 23, 22, 0, 130, 110, 103,
+  116, 104, 0, 8, 11, 0, 129, 104, 116, 0, 18, 9, 0, 129, 104, 116, 0, 26, 7,
+  17, 4, 5, 0, 129, 100, 116, 104, 0, 8, 26, 23, 0, 129, 102, 116, 104, 0, 72,
+  24, 80, 24, 39, 80, 0, 8, 23, 17, 12, 17, 0, 133, 101, 116, 101, 101, 110,
+  116, 104, 0, 18, 16, 0, 131, 110, 116, 104, 0, 24, 23, 44, 0, 131, 114, 117,
+  116, 104, 0, 18, 9, 0, 129, 114, 116, 104, 0, 12, 44, 0, 131, 119, 105, 116,
+  104, 0, 72, 81, 80, 23, 89, 80, 0, 25, 18, 16, 0, 129, 105, 101, 0, 23, 12, 9,
+  4, 21, 10, 0, 131, 102, 105, 116, 105, 0, 68, 124, 80, 6, 147, 80, 8, 194, 80,
+  12, 201, 80, 17, 210, 80, 18, 235, 80, 21, 242, 80, 0, 70, 131, 80, 8, 138,
+  80, 0, 5, 0, 130, 97, 99, 107, 0, 21, 11, 22, 0, 130, 105, 101, 107, 0, 4, 0,
+  69, 159, 80, 13, 170, 80, 21, 180, 80, 0, 16, 18, 6, 0, 131, 101, 98, 97, 99,
+  107, 0, 28, 11, 0, 132, 105, 106, 97, 99, 107, 0, 23, 17, 24, 18, 22, 0, 132,
+  100, 116, 114, 97, 99, 107, 0, 12, 15, 0, 129, 107, 101, 0, 17, 21, 7, 0, 130,
+  105, 110, 107, 0, 76, 217, 80, 24, 227, 80, 0, 23, 11, 0, 132, 116, 104, 105,
+  110, 107, 0, 12, 11, 23, 0, 130, 110, 107, 0, 18, 18, 5, 0, 129, 107, 0, 26,
+  18, 44, 0, 131, 119, 111, 114, 107, 0, 68, 27, 81, 7, 243, 88, 8, 29, 89, 12,
+  186, 89, 15, 245, 89, 18, 138, 90, 23, 183, 90, 24, 192, 90, 26, 12, 91, 28,
+  21, 91, 0, 70, 64, 81, 7, 0, 83, 8, 28, 83, 11, 38, 83, 12, 63, 83, 17, 222,
+  85, 19, 233, 86, 21, 9, 87, 22, 122, 87, 23, 172, 87, 24, 56, 88, 25, 197, 88,
+  0, 68, 74, 81, 12, 83, 81, 18, 247, 82, 0, 23, 22, 5, 18, 0, 129, 108, 101, 0,
+  68, 117, 81, 6, 126, 81, 7, 140, 81, 9, 148, 81, 10, 171, 81, 11, 224, 81, 15,
+  49, 82, 17, 77, 82, 21, 110, 82, 22, 160, 82, 23, 181, 82, 0, 21, 5, 8, 10,
+  15, 4, 0, 129, 0, 21, 4, 21, 8, 12, 11, 0, 131, 104, 105, 99, 97, 108, 0, 24,
+  13, 0, 129, 105, 97, 108, 0, 73, 155, 81, 12, 162, 81, 0, 18, 0, 129, 105, 97,
+  108, 0, 23, 21, 4, 0, 129, 105, 97, 108, 0, 18, 15, 0, 72, 184, 81, 12, 200,
+  81, 18, 209, 81, 0, 4, 11, 6, 21, 4, 0, 134, 111, 108, 111, 103, 105, 99, 97,
+  108, 0, 133, 108, 111, 103, 105, 99, 97, 108, 0, 8, 17, 8, 10, 0, 135, 97,
+  108, 111, 103, 105, 99, 97, 108, 0, 70, 231, 81, 19, 246, 81, 0, 4, 21, 8, 12,
+  11, 0, 133, 114, 99, 104, 105, 99, 97, 108, 0, 68, 253, 81, 18, 6, 82, 0, 21,
+  10, 18, 16, 8, 7, 0, 129, 0, 22, 0, 76, 15, 82, 18, 31, 82, 0, 15, 12, 11, 19,
+  0, 136, 111, 115, 111, 112, 104, 105, 99, 97, 108, 0, 15, 28, 11, 19, 0, 138,
+  105, 108, 111, 115, 111, 112, 104, 105, 99, 97, 108, 0, 69, 56, 82, 18, 68,
+  82, 0, 4, 12, 7, 0, 132, 111, 108, 105, 99, 97, 108, 0, 19, 0, 130, 116, 105,
+  99, 97, 108, 0, 81, 84, 82, 18, 97, 82, 0, 4, 23, 12, 21, 24, 19, 0, 132, 105,
+  99, 97, 108, 0, 17, 17, 4, 6, 0, 134, 111, 110, 105, 99, 97, 108, 0, 72, 117,
+  82, 23, 145, 82, 0, 80, 124, 82, 19, 134, 82, 0, 16, 18, 6, 0, 131, 99, 105,
+  97, 108, 0, 16, 8, 0, 133, 105, 114, 105, 99, 97, 108, 0, 8, 16, 28, 22, 0,
+  134, 109, 101, 116, 114, 105, 99, 97, 108, 0, 28, 11, 19, 4, 23, 4, 16, 0,
+  138, 101, 116, 97, 112, 104, 121, 115, 105, 99, 97, 108, 0, 79, 194, 82, 17,
+  205, 82, 21, 220, 82, 22, 239, 82, 0, 18, 19, 0, 132, 105, 116, 105, 99, 97,
+  108, 0, 8, 7, 17, 12, 0, 136, 100, 101, 110, 116, 105, 99, 97, 108, 0, 68,
+  227, 82, 6, 231, 82, 0, 129, 108, 101, 0, 132, 105, 116, 105, 99, 97, 108, 0,
+  12, 8, 11, 23, 4, 0, 129, 0, 23, 18, 21, 19, 0, 129, 111, 108, 0, 76, 7, 83,
+  21, 17, 83, 0, 21, 18, 6, 0, 131, 100, 105, 97, 108, 0, 18, 16, 12, 21, 19, 0,
+  129, 105, 97, 108, 0, 21, 8, 25, 8, 22, 0, 130, 97, 108, 0, 82, 45, 83, 23,
+  53, 83, 0, 6, 15, 4, 0, 129, 111, 108, 0, 4, 8, 15, 0, 132, 116, 104, 97, 108,
+  0, 70, 88, 83, 7, 131, 84, 16, 144, 84, 17, 155, 84, 19, 191, 84, 21, 202, 84,
+  23, 19, 85, 25, 210, 85, 0, 68, 113, 83, 12, 124, 83, 16, 252, 83, 17, 6, 84,
+  19, 64, 84, 21, 73, 84, 22, 111, 84, 24, 120, 84, 0, 17, 12, 9, 0, 131, 110,
+  99, 105, 97, 108, 0, 73, 143, 83, 11, 179, 83, 17, 191, 83, 21, 203, 83, 23,
+  232, 83, 25, 241, 83, 0, 73, 150, 83, 12, 166, 83, 0, 18, 17, 12, 0, 137, 117,
+  110, 111, 102, 102, 105, 99, 105, 97, 108, 0, 17, 8, 5, 0, 134, 101, 102, 105,
+  99, 105, 97, 108, 0, 19, 4, 21, 10, 18, 8, 10, 0, 130, 97, 108, 0, 12, 25, 18,
+  21, 19, 0, 132, 99, 105, 97, 108, 0, 72, 210, 83, 18, 221, 83, 0, 16, 16, 18,
+  6, 0, 132, 99, 105, 97, 108, 0, 11, 19, 4, 23, 8, 16, 0, 130, 97, 108, 0, 17,
+  8, 7, 12, 0, 130, 97, 108, 0, 18, 21, 19, 0, 131, 110, 99, 105, 97, 108, 0, 8,
+  11, 6, 0, 131, 105, 99, 97, 108, 0, 68, 16, 84, 8, 28, 84, 12, 55, 84, 0, 23,
+  22, 5, 24, 22, 0, 131, 116, 105, 97, 108, 0, 86, 35, 84, 24, 44, 84, 0, 22, 8,
+  0, 131, 116, 105, 97, 108, 0, 15, 9, 17, 12, 0, 131, 116, 105, 97, 108, 0, 15,
+  6, 0, 131, 105, 99, 97, 108, 0, 28, 23, 0, 131, 105, 99, 97, 108, 0, 8, 25, 0,
+  68, 83, 84, 18, 99, 84, 0, 21, 23, 17, 18, 6, 0, 135, 111, 118, 101, 114, 115,
+  105, 97, 108, 0, 21, 23, 17, 18, 6, 0, 131, 115, 105, 97, 108, 0, 24, 16, 0,
+  131, 105, 99, 97, 108, 0, 7, 24, 13, 0, 132, 105, 99, 105, 97, 108, 0, 12, 6,
+  24, 22, 0, 133, 105, 99, 105, 100, 97, 108, 0, 18, 17, 18, 21, 19, 0, 129,
+  110, 97, 108, 0, 72, 162, 84, 18, 176, 84, 0, 23, 17, 8, 23, 17, 8, 6, 0, 133,
   110, 105, 97, 108, 0, 16, 12, 21, 8, 6, 0, 134, 101, 109, 111, 110, 105, 97,
-  108, 0, 12, 6, 17, 12, 21, 19, 0, 130, 97, 108, 0, 72, 38, 84, 12, 46, 84, 18,
-  55, 84, 23, 70, 84, 0, 17, 12, 16, 0, 130, 97, 108, 0, 19, 16, 8, 0, 129, 99,
-  97, 108, 0, 23, 12, 24, 20, 8, 0, 134, 97, 116, 111, 114, 105, 97, 108, 0, 70,
-  77, 84, 24, 86, 84, 0, 8, 15, 8, 0, 129, 99, 97, 108, 0, 7, 17, 12, 0, 132,
-  115, 116, 114, 105, 97, 108, 0, 68, 120, 84, 6, 133, 84, 17, 142, 84, 19, 239,
-  84, 21, 248, 84, 22, 7, 85, 24, 24, 85, 0, 23, 22, 5, 24, 22, 0, 131, 110,
-  116, 105, 97, 108, 0, 4, 21, 19, 0, 129, 99, 97, 108, 0, 72, 149, 84, 12, 232,
-  84, 0, 71, 162, 84, 17, 178, 84, 22, 188, 84, 25, 222, 84, 0, 8, 22, 8, 21,
-  19, 0, 135, 105, 100, 101, 110, 116, 105, 97, 108, 0, 12, 23, 17, 18, 6, 0,
-  130, 97, 108, 0, 72, 195, 84, 22, 204, 84, 0, 133, 115, 101, 110, 116, 105,
+  108, 0, 12, 6, 17, 12, 21, 19, 0, 130, 97, 108, 0, 72, 215, 84, 12, 223, 84,
+  18, 232, 84, 23, 247, 84, 0, 17, 12, 16, 0, 130, 97, 108, 0, 19, 16, 8, 0,
+  129, 99, 97, 108, 0, 23, 12, 24, 20, 8, 0, 134, 97, 116, 111, 114, 105, 97,
+  108, 0, 70, 254, 84, 24, 7, 85, 0, 8, 15, 8, 0, 129, 99, 97, 108, 0, 7, 17,
+  12, 0, 132, 115, 116, 114, 105, 97, 108, 0, 68, 41, 85, 6, 54, 85, 17, 63, 85,
+  19, 160, 85, 21, 169, 85, 22, 184, 85, 24, 201, 85, 0, 23, 22, 5, 24, 22, 0,
+  131, 110, 116, 105, 97, 108, 0, 4, 21, 19, 0, 129, 99, 97, 108, 0, 72, 70, 85,
+  12, 153, 85, 0, 71, 83, 85, 17, 99, 85, 22, 109, 85, 25, 143, 85, 0, 8, 22, 8,
+  21, 19, 0, 135, 105, 100, 101, 110, 116, 105, 97, 108, 0, 12, 23, 17, 18, 6,
+  0, 130, 97, 108, 0, 72, 116, 85, 22, 125, 85, 0, 133, 115, 101, 110, 116, 105,
   97, 108, 0, 8, 17, 12, 24, 20, 0, 136, 116, 101, 115, 115, 101, 110, 116, 105,
   97, 108, 0, 17, 18, 6, 0, 129, 111, 110, 97, 108, 0, 131, 105, 116, 105, 97,
   108, 0, 4, 6, 0, 131, 105, 116, 97, 108, 0, 8, 25, 18, 21, 23, 17, 18, 6, 0,
   131, 115, 105, 97, 108, 0, 8, 21, 21, 8, 23, 4, 21, 23, 27, 8, 0, 130, 114,
   105, 97, 108, 0, 21, 6, 0, 131, 99, 105, 97, 108, 0, 8, 7, 8, 16, 0, 132, 105,
-  101, 118, 97, 108, 0, 74, 64, 85, 12, 74, 85, 17, 101, 85, 18, 114, 85, 21,
-  30, 86, 24, 45, 86, 0, 12, 21, 18, 0, 130, 105, 110, 97, 108, 0, 74, 81, 85,
-  16, 92, 85, 0, 21, 18, 0, 132, 105, 103, 105, 110, 97, 108, 0, 18, 17, 12, 5,
-  0, 130, 97, 108, 0, 18, 12, 23, 12, 7, 4, 21, 23, 0, 130, 97, 108, 0, 71, 130,
-  85, 12, 144, 85, 21, 251, 85, 22, 5, 86, 23, 18, 86, 0, 24, 23, 12, 10, 17,
-  18, 15, 0, 131, 105, 110, 97, 108, 0, 71, 157, 85, 10, 168, 85, 22, 177, 85,
-  23, 192, 85, 0, 7, 4, 0, 131, 116, 105, 111, 110, 97, 108, 0, 12, 21, 18, 0,
-  131, 110, 97, 108, 0, 8, 21, 10, 17, 18, 6, 0, 132, 115, 105, 111, 110, 97,
-  108, 0, 4, 0, 81, 201, 85, 21, 217, 85, 0, 8, 23, 17, 12, 0, 135, 114, 110,
-  97, 116, 105, 111, 110, 97, 108, 0, 70, 224, 85, 8, 237, 85, 0, 8, 21, 0, 134,
-  101, 97, 116, 105, 111, 110, 97, 108, 0, 23, 17, 12, 0, 134, 110, 97, 116,
-  105, 111, 110, 97, 108, 0, 8, 19, 0, 131, 115, 111, 110, 97, 108, 0, 12, 25,
-  18, 21, 19, 0, 131, 105, 111, 110, 97, 108, 0, 12, 7, 7, 4, 0, 131, 105, 111,
-  110, 97, 108, 0, 8, 23, 21, 8, 27, 8, 0, 135, 116, 101, 114, 110, 97, 108, 0,
-  21, 18, 13, 0, 132, 117, 114, 110, 97, 108, 0, 12, 6, 12, 0, 81, 67, 86, 21,
-  78, 86, 0, 12, 21, 19, 0, 133, 99, 105, 112, 97, 108, 0, 19, 0, 132, 110, 99,
-  105, 112, 97, 108, 0, 68, 98, 86, 8, 109, 86, 24, 175, 86, 0, 23, 23, 24, 10,
-  0, 131, 117, 114, 97, 108, 0, 73, 122, 86, 14, 130, 86, 23, 138, 86, 25, 167,
-  86, 0, 8, 21, 0, 129, 114, 97, 108, 0, 6, 4, 16, 0, 129, 101, 108, 0, 68, 145,
-  86, 23, 158, 86, 0, 15, 18, 6, 0, 133, 108, 97, 116, 101, 114, 97, 108, 0, 24,
-  10, 0, 131, 117, 114, 97, 108, 0, 8, 21, 0, 129, 115, 97, 108, 0, 82, 182, 86,
-  23, 191, 86, 0, 16, 24, 11, 0, 131, 114, 97, 108, 0, 22, 4, 19, 0, 131, 111,
-  114, 97, 108, 0, 82, 208, 86, 21, 220, 86, 0, 15, 15, 18, 6, 0, 132, 111, 115,
-  115, 97, 108, 0, 8, 0, 75, 229, 86, 25, 239, 86, 0, 8, 21, 0, 131, 97, 114,
-  115, 97, 108, 0, 18, 21, 23, 17, 18, 6, 0, 129, 105, 97, 108, 0, 72, 5, 87,
-  12, 41, 87, 17, 85, 87, 0, 80, 12, 87, 17, 24, 87, 0, 4, 7, 17, 24, 9, 0, 130,
+  101, 118, 97, 108, 0, 74, 241, 85, 12, 251, 85, 17, 22, 86, 18, 35, 86, 21,
+  207, 86, 24, 222, 86, 0, 12, 21, 18, 0, 130, 105, 110, 97, 108, 0, 74, 2, 86,
+  16, 13, 86, 0, 21, 18, 0, 132, 105, 103, 105, 110, 97, 108, 0, 18, 17, 12, 5,
+  0, 130, 97, 108, 0, 18, 12, 23, 12, 7, 4, 21, 23, 0, 130, 97, 108, 0, 71, 51,
+  86, 12, 65, 86, 21, 172, 86, 22, 182, 86, 23, 195, 86, 0, 24, 23, 12, 10, 17,
+  18, 15, 0, 131, 105, 110, 97, 108, 0, 71, 78, 86, 10, 89, 86, 22, 98, 86, 23,
+  113, 86, 0, 7, 4, 0, 131, 116, 105, 111, 110, 97, 108, 0, 12, 21, 18, 0, 131,
+  110, 97, 108, 0, 8, 21, 10, 17, 18, 6, 0, 132, 115, 105, 111, 110, 97, 108, 0,
+  4, 0, 81, 122, 86, 21, 138, 86, 0, 8, 23, 17, 12, 0, 135, 114, 110, 97, 116,
+  105, 111, 110, 97, 108, 0, 70, 145, 86, 8, 158, 86, 0, 8, 21, 0, 134, 101, 97,
+  116, 105, 111, 110, 97, 108, 0, 23, 17, 12, 0, 134, 110, 97, 116, 105, 111,
+  110, 97, 108, 0, 8, 19, 0, 131, 115, 111, 110, 97, 108, 0, 12, 25, 18, 21, 19,
+  0, 131, 105, 111, 110, 97, 108, 0, 12, 7, 7, 4, 0, 131, 105, 111, 110, 97,
+  108, 0, 8, 23, 21, 8, 27, 8, 0, 135, 116, 101, 114, 110, 97, 108, 0, 21, 18,
+  13, 0, 132, 117, 114, 110, 97, 108, 0, 12, 6, 12, 0, 81, 244, 86, 21, 255, 86,
+  0, 12, 21, 19, 0, 133, 99, 105, 112, 97, 108, 0, 19, 0, 132, 110, 99, 105,
+  112, 97, 108, 0, 68, 19, 87, 8, 30, 87, 24, 96, 87, 0, 23, 23, 24, 10, 0, 131,
+  117, 114, 97, 108, 0, 73, 43, 87, 14, 51, 87, 23, 59, 87, 25, 88, 87, 0, 8,
+  21, 0, 129, 114, 97, 108, 0, 6, 4, 16, 0, 129, 101, 108, 0, 68, 66, 87, 23,
+  79, 87, 0, 15, 18, 6, 0, 133, 108, 97, 116, 101, 114, 97, 108, 0, 24, 10, 0,
+  131, 117, 114, 97, 108, 0, 8, 21, 0, 129, 115, 97, 108, 0, 82, 103, 87, 23,
+  112, 87, 0, 16, 24, 11, 0, 131, 114, 97, 108, 0, 22, 4, 19, 0, 131, 111, 114,
+  97, 108, 0, 82, 129, 87, 21, 141, 87, 0, 15, 15, 18, 6, 0, 132, 111, 115, 115,
+  97, 108, 0, 8, 0, 75, 150, 87, 25, 160, 87, 0, 8, 21, 0, 131, 97, 114, 115,
+  97, 108, 0, 18, 21, 23, 17, 18, 6, 0, 129, 105, 97, 108, 0, 72, 182, 87, 12,
+  218, 87, 17, 6, 88, 0, 80, 189, 87, 17, 201, 87, 0, 4, 7, 17, 24, 9, 0, 130,
   110, 116, 97, 108, 0, 12, 23, 17, 18, 6, 21, 8, 23, 17, 12, 0, 130, 110, 116,
-  97, 108, 0, 81, 48, 87, 22, 73, 87, 0, 72, 55, 87, 12, 68, 87, 0, 7, 12, 22,
-  8, 21, 19, 0, 131, 116, 105, 97, 108, 0, 129, 105, 97, 108, 0, 8, 22, 22, 8,
-  0, 132, 110, 116, 105, 97, 108, 0, 8, 0, 71, 94, 87, 16, 120, 87, 0, 12, 0,
-  73, 103, 87, 22, 112, 87, 0, 17, 18, 6, 0, 129, 105, 97, 108, 0, 8, 21, 0,
-  129, 105, 97, 108, 0, 8, 21, 23, 8, 7, 0, 134, 105, 109, 101, 110, 116, 97,
-  108, 0, 81, 145, 87, 21, 154, 87, 23, 163, 87, 0, 4, 44, 0, 130, 110, 117, 97,
-  108, 0, 24, 23, 4, 17, 0, 130, 97, 108, 0, 70, 173, 87, 12, 221, 87, 17, 10,
-  88, 0, 72, 180, 87, 24, 212, 87, 0, 79, 187, 87, 23, 201, 87, 0, 8, 23, 17,
-  12, 0, 133, 108, 101, 99, 116, 117, 97, 108, 0, 12, 11, 6, 21, 4, 0, 129, 114,
-  97, 108, 0, 21, 23, 22, 0, 129, 114, 97, 108, 0, 85, 228, 87, 25, 3, 88, 0,
-  76, 235, 87, 19, 248, 87, 0, 21, 19, 22, 0, 135, 105, 114, 105, 116, 117, 97,
-  108, 0, 22, 0, 133, 105, 114, 105, 116, 117, 97, 108, 0, 131, 114, 116, 117,
-  97, 108, 0, 8, 22, 22, 8, 0, 130, 105, 97, 108, 0, 76, 27, 88, 18, 54, 88, 0,
-  72, 34, 88, 21, 45, 88, 0, 7, 8, 16, 0, 132, 105, 101, 118, 97, 108, 0, 4, 0,
-  131, 114, 105, 118, 97, 108, 0, 21, 19, 4, 0, 132, 112, 114, 111, 118, 97,
-  108, 0, 24, 0, 82, 75, 88, 26, 99, 88, 0, 70, 85, 88, 11, 89, 88, 26, 95, 88,
+  97, 108, 0, 81, 225, 87, 22, 250, 87, 0, 72, 232, 87, 12, 245, 87, 0, 7, 12,
+  22, 8, 21, 19, 0, 131, 116, 105, 97, 108, 0, 129, 105, 97, 108, 0, 8, 22, 22,
+  8, 0, 132, 110, 116, 105, 97, 108, 0, 8, 0, 71, 15, 88, 16, 41, 88, 0, 12, 0,
+  73, 24, 88, 22, 33, 88, 0, 17, 18, 6, 0, 129, 105, 97, 108, 0, 8, 21, 0, 129,
+  105, 97, 108, 0, 8, 21, 23, 8, 7, 0, 134, 105, 109, 101, 110, 116, 97, 108, 0,
+  81, 66, 88, 21, 75, 88, 23, 84, 88, 0, 4, 44, 0, 130, 110, 117, 97, 108, 0,
+  24, 23, 4, 17, 0, 130, 97, 108, 0, 70, 94, 88, 12, 142, 88, 17, 187, 88, 0,
+  72, 101, 88, 24, 133, 88, 0, 79, 108, 88, 23, 122, 88, 0, 8, 23, 17, 12, 0,
+  133, 108, 101, 99, 116, 117, 97, 108, 0, 12, 11, 6, 21, 4, 0, 129, 114, 97,
+  108, 0, 21, 23, 22, 0, 129, 114, 97, 108, 0, 85, 149, 88, 25, 180, 88, 0, 76,
+  156, 88, 19, 169, 88, 0, 21, 19, 22, 0, 135, 105, 114, 105, 116, 117, 97, 108,
+  0, 22, 0, 133, 105, 114, 105, 116, 117, 97, 108, 0, 131, 114, 116, 117, 97,
+  108, 0, 8, 22, 22, 8, 0, 130, 105, 97, 108, 0, 76, 204, 88, 18, 231, 88, 0,
+  72, 211, 88, 21, 222, 88, 0, 7, 8, 16, 0, 132, 105, 101, 118, 97, 108, 0, 4,
+  0, 131, 114, 105, 118, 97, 108, 0, 21, 19, 4, 0, 132, 112, 114, 111, 118, 97,
+  108, 0, 24, 0, 82, 252, 88, 26, 20, 89, 0, 70, 6, 89, 11, 10, 89, 26, 16, 89,
   0, 129, 108, 100, 0, 22, 0, 129, 108, 100, 0, 129, 108, 100, 0, 18, 0, 132,
-  119, 111, 117, 108, 100, 0, 70, 139, 88, 9, 148, 88, 10, 156, 88, 12, 164, 88,
-  15, 172, 88, 17, 218, 88, 19, 229, 88, 23, 237, 88, 24, 245, 88, 25, 255, 88,
-  0, 12, 23, 21, 4, 0, 129, 108, 101, 0, 8, 44, 0, 130, 118, 105, 108, 0, 17,
-  12, 22, 0, 129, 108, 101, 0, 21, 8, 4, 0, 129, 97, 108, 0, 68, 179, 88, 15,
-  205, 88, 0, 21, 0, 68, 188, 88, 21, 195, 88, 0, 19, 0, 129, 108, 101, 108, 0,
-  4, 19, 0, 132, 97, 108, 108, 101, 108, 0, 4, 21, 21, 4, 19, 0, 133, 97, 108,
-  108, 101, 108, 0, 18, 22, 21, 8, 19, 0, 129, 110, 101, 108, 0, 18, 8, 19, 0,
-  129, 108, 101, 0, 23, 12, 15, 0, 129, 108, 101, 0, 7, 8, 11, 6, 22, 0, 129,
-  108, 101, 0, 8, 12, 7, 8, 16, 0, 129, 97, 108, 0, 68, 16, 89, 6, 58, 89, 0,
-  86, 23, 89, 23, 31, 89, 0, 5, 4, 0, 130, 101, 105, 108, 0, 70, 38, 89, 17, 48,
+  119, 111, 117, 108, 100, 0, 70, 60, 89, 9, 69, 89, 10, 77, 89, 12, 85, 89, 15,
+  93, 89, 17, 139, 89, 19, 150, 89, 23, 158, 89, 24, 166, 89, 25, 176, 89, 0,
+  12, 23, 21, 4, 0, 129, 108, 101, 0, 8, 44, 0, 130, 118, 105, 108, 0, 17, 12,
+  22, 0, 129, 108, 101, 0, 21, 8, 4, 0, 129, 97, 108, 0, 68, 100, 89, 15, 126,
+  89, 0, 21, 0, 68, 109, 89, 21, 116, 89, 0, 19, 0, 129, 108, 101, 108, 0, 4,
+  19, 0, 132, 97, 108, 108, 101, 108, 0, 4, 21, 21, 4, 19, 0, 133, 97, 108, 108,
+  101, 108, 0, 18, 22, 21, 8, 19, 0, 129, 110, 101, 108, 0, 18, 8, 19, 0, 129,
+  108, 101, 0, 23, 12, 15, 0, 129, 108, 101, 0, 7, 8, 11, 6, 22, 0, 129, 108,
+  101, 0, 8, 12, 7, 8, 16, 0, 129, 97, 108, 0, 68, 193, 89, 6, 235, 89, 0, 86,
+  200, 89, 23, 208, 89, 0, 5, 4, 0, 130, 101, 105, 108, 0, 70, 215, 89, 17, 225,
   89, 0, 18, 6, 0, 131, 107, 116, 97, 105, 108, 0, 8, 22, 22, 8, 0, 130, 105,
-  97, 108, 0, 24, 18, 6, 0, 130, 110, 99, 105, 108, 0, 68, 87, 89, 6, 101, 89,
-  8, 111, 89, 12, 147, 89, 24, 175, 89, 26, 208, 89, 0, 5, 23, 18, 18, 18, 9, 0,
-  133, 116, 98, 97, 108, 108, 0, 4, 8, 21, 0, 131, 99, 97, 108, 108, 0, 69, 121,
-  89, 19, 126, 89, 26, 137, 89, 0, 12, 15, 0, 128, 0, 22, 12, 16, 0, 131, 115,
-  112, 101, 108, 108, 0, 22, 4, 0, 131, 32, 119, 101, 108, 108, 0, 9, 0, 79,
-  156, 89, 24, 166, 89, 0, 15, 24, 9, 0, 132, 102, 105, 108, 108, 0, 9, 0, 131,
-  108, 102, 105, 108, 108, 0, 9, 0, 72, 184, 89, 19, 202, 89, 0, 70, 191, 89,
-  21, 197, 89, 0, 4, 21, 10, 0, 128, 0, 4, 6, 0, 128, 0, 15, 8, 11, 0, 128, 0,
-  12, 44, 0, 131, 119, 105, 108, 108, 0, 11, 0, 70, 226, 89, 18, 251, 89, 0, 79,
-  233, 89, 18, 241, 89, 0, 4, 0, 130, 111, 104, 111, 108, 0, 15, 4, 0, 132, 99,
-  111, 104, 111, 108, 0, 11, 6, 15, 4, 0, 132, 111, 104, 111, 108, 0, 24, 22, 8,
-  21, 0, 129, 108, 116, 0, 9, 0, 72, 30, 90, 12, 52, 90, 21, 65, 90, 23, 78, 90,
-  0, 26, 0, 68, 39, 90, 18, 44, 90, 0, 131, 102, 117, 108, 0, 19, 0, 130, 114,
+  97, 108, 0, 24, 18, 6, 0, 130, 110, 99, 105, 108, 0, 68, 8, 90, 6, 22, 90, 8,
+  32, 90, 12, 68, 90, 24, 96, 90, 26, 129, 90, 0, 5, 23, 18, 18, 18, 9, 0, 133,
+  116, 98, 97, 108, 108, 0, 4, 8, 21, 0, 131, 99, 97, 108, 108, 0, 69, 42, 90,
+  19, 47, 90, 26, 58, 90, 0, 12, 15, 0, 128, 0, 22, 12, 16, 0, 131, 115, 112,
+  101, 108, 108, 0, 22, 4, 0, 131, 32, 119, 101, 108, 108, 0, 9, 0, 79, 77, 90,
+  24, 87, 90, 0, 15, 24, 9, 0, 132, 102, 105, 108, 108, 0, 9, 0, 131, 108, 102,
+  105, 108, 108, 0, 9, 0, 72, 105, 90, 19, 123, 90, 0, 70, 112, 90, 21, 118, 90,
+  0, 4, 21, 10, 0, 128, 0, 4, 6, 0, 128, 0, 15, 8, 11, 0, 128, 0, 12, 44, 0,
+  131, 119, 105, 108, 108, 0, 11, 0, 70, 147, 90, 18, 172, 90, 0, 79, 154, 90,
+  18, 162, 90, 0, 4, 0, 130, 111, 104, 111, 108, 0, 15, 4, 0, 132, 99, 111, 104,
+  111, 108, 0, 11, 6, 15, 4, 0, 132, 111, 104, 111, 108, 0, 24, 22, 8, 21, 0,
+  129, 108, 116, 0, 9, 0, 72, 207, 90, 12, 229, 90, 21, 242, 90, 23, 255, 90, 0,
+  26, 0, 68, 216, 90, 18, 221, 90, 0, 131, 102, 117, 108, 0, 19, 0, 130, 114,
   102, 117, 108, 0, 23, 4, 8, 5, 0, 132, 117, 116, 105, 102, 117, 108, 0, 8, 25,
   18, 19, 0, 133, 119, 101, 114, 102, 117, 108, 0, 4, 8, 21, 10, 0, 133, 97,
-  116, 101, 102, 117, 108, 0, 8, 17, 8, 21, 0, 128, 97, 108, 0, 15, 0, 68, 109,
-  90, 8, 116, 90, 0, 8, 21, 0, 129, 108, 121, 0, 23, 8, 15, 19, 16, 18, 6, 0,
-  128, 0, 68, 163, 90, 6, 199, 90, 8, 215, 90, 11, 28, 91, 12, 39, 91, 15, 115,
-  91, 18, 126, 91, 21, 157, 91, 22, 187, 91, 23, 90, 92, 24, 118, 92, 26, 106,
-  93, 0, 21, 10, 0, 76, 173, 90, 18, 185, 90, 0, 15, 12, 16, 0, 132, 108, 105,
-  103, 114, 97, 109, 0, 23, 6, 8, 19, 22, 0, 132, 114, 111, 103, 114, 97, 109,
-  0, 12, 21, 23, 17, 8, 6, 18, 17, 11, 23, 8, 0, 129, 115, 109, 0, 71, 228, 90,
-  11, 241, 90, 15, 7, 91, 23, 19, 91, 0, 17, 4, 23, 24, 19, 22, 12, 7, 0, 129,
-  117, 109, 0, 23, 28, 0, 75, 251, 90, 21, 0, 91, 0, 21, 0, 129, 109, 0, 132,
+  116, 101, 102, 117, 108, 0, 8, 17, 8, 21, 0, 128, 97, 108, 0, 15, 0, 68, 30,
+  91, 8, 37, 91, 0, 8, 21, 0, 129, 108, 121, 0, 23, 8, 15, 19, 16, 18, 6, 0,
+  128, 0, 68, 84, 91, 6, 120, 91, 8, 136, 91, 11, 205, 91, 12, 216, 91, 15, 36,
+  92, 18, 47, 92, 21, 78, 92, 22, 108, 92, 23, 11, 93, 24, 39, 93, 26, 27, 94,
+  0, 21, 10, 0, 76, 94, 91, 18, 106, 91, 0, 15, 12, 16, 0, 132, 108, 105, 103,
+  114, 97, 109, 0, 23, 6, 8, 19, 22, 0, 132, 114, 111, 103, 114, 97, 109, 0, 12,
+  21, 23, 17, 8, 6, 18, 17, 11, 23, 8, 0, 129, 115, 109, 0, 71, 149, 91, 11,
+  162, 91, 15, 184, 91, 23, 196, 91, 0, 17, 4, 23, 24, 19, 22, 12, 7, 0, 129,
+  117, 109, 0, 23, 28, 0, 75, 172, 91, 21, 177, 91, 0, 21, 0, 129, 109, 0, 132,
   104, 121, 116, 104, 109, 0, 24, 6, 12, 21, 21, 24, 6, 0, 129, 117, 109, 0, 28,
   22, 0, 130, 115, 116, 101, 109, 0, 23, 28, 21, 0, 131, 104, 121, 116, 104,
-  109, 0, 68, 52, 91, 11, 59, 91, 17, 96, 91, 21, 105, 91, 0, 15, 5, 0, 129,
-  109, 101, 0, 70, 66, 91, 23, 75, 91, 0, 21, 4, 17, 4, 0, 128, 115, 109, 0, 28,
-  0, 75, 84, 91, 21, 89, 91, 0, 21, 0, 129, 109, 0, 132, 104, 121, 116, 104,
+  109, 0, 68, 229, 91, 11, 236, 91, 17, 17, 92, 21, 26, 92, 0, 15, 5, 0, 129,
+  109, 101, 0, 70, 243, 91, 23, 252, 91, 0, 21, 4, 17, 4, 0, 128, 115, 109, 0,
+  28, 0, 75, 5, 92, 21, 10, 92, 0, 21, 0, 129, 109, 0, 132, 104, 121, 116, 104,
   109, 0, 4, 10, 21, 18, 0, 128, 115, 109, 0, 21, 8, 23, 17, 12, 0, 130, 105,
-  109, 0, 8, 5, 18, 21, 19, 0, 130, 108, 101, 109, 0, 81, 133, 91, 23, 144, 91,
-  0, 8, 16, 18, 17, 8, 11, 19, 0, 128, 110, 0, 22, 24, 6, 4, 0, 132, 99, 117,
-  115, 116, 111, 109, 0, 18, 9, 0, 81, 167, 91, 18, 178, 91, 0, 4, 21, 23, 0,
-  131, 115, 102, 111, 114, 109, 0, 6, 0, 131, 110, 102, 111, 114, 109, 0, 68,
-  197, 91, 8, 205, 91, 12, 216, 91, 0, 8, 21, 7, 0, 129, 109, 115, 0, 12, 11,
-  23, 4, 0, 131, 101, 105, 115, 109, 0, 70, 235, 91, 15, 250, 91, 16, 41, 92,
-  21, 53, 92, 22, 67, 92, 23, 79, 92, 0, 18, 15, 18, 11, 23, 4, 6, 0, 132, 105,
-  99, 105, 115, 109, 0, 4, 0, 85, 3, 92, 24, 22, 92, 0, 23, 15, 24, 6, 12, 23,
-  15, 24, 16, 0, 133, 117, 114, 97, 108, 105, 115, 109, 0, 10, 17, 12, 15, 15,
-  12, 5, 0, 137, 105, 110, 103, 117, 97, 108, 105, 115, 109, 0, 18, 23, 19, 18,
-  0, 132, 105, 109, 105, 115, 109, 0, 4, 10, 4, 15, 19, 0, 132, 105, 97, 114,
-  105, 115, 109, 0, 12, 23, 12, 21, 6, 0, 131, 99, 105, 115, 109, 0, 4, 17, 4,
-  9, 0, 129, 99, 105, 115, 109, 0, 76, 97, 92, 22, 107, 92, 0, 21, 18, 10, 15,
-  4, 0, 128, 104, 109, 0, 12, 11, 6, 21, 4, 17, 4, 0, 129, 109, 0, 71, 143, 92,
-  10, 159, 92, 12, 190, 92, 15, 44, 93, 16, 62, 93, 21, 73, 93, 23, 86, 93, 24,
-  96, 93, 0, 17, 8, 7, 8, 9, 8, 21, 0, 133, 114, 101, 110, 100, 117, 109, 0, 76,
-  166, 92, 24, 176, 92, 0, 15, 8, 5, 0, 131, 103, 105, 117, 109, 0, 21, 21, 8,
-  23, 17, 12, 0, 131, 101, 103, 110, 117, 109, 0, 69, 203, 92, 6, 216, 92, 17,
-  229, 92, 21, 5, 93, 0, 12, 15, 12, 24, 20, 8, 0, 130, 114, 105, 117, 109, 0,
-  21, 18, 22, 17, 18, 6, 0, 131, 116, 105, 117, 109, 0, 72, 236, 92, 17, 247,
-  92, 0, 15, 15, 12, 16, 0, 130, 110, 105, 117, 109, 0, 8, 15, 12, 16, 0, 133,
-  108, 101, 110, 110, 105, 117, 109, 0, 5, 12, 15, 0, 68, 16, 93, 8, 30, 93, 0,
-  24, 20, 8, 0, 135, 105, 108, 105, 98, 114, 105, 117, 109, 0, 24, 20, 8, 0,
-  135, 105, 108, 105, 98, 114, 105, 117, 109, 0, 24, 6, 12, 21, 12, 6, 0, 135,
-  117, 114, 114, 105, 99, 117, 108, 117, 109, 0, 24, 17, 12, 16, 0, 131, 105,
-  109, 117, 109, 0, 5, 12, 15, 12, 24, 20, 8, 0, 129, 105, 117, 109, 0, 6, 8,
-  19, 22, 0, 129, 114, 117, 109, 0, 6, 6, 4, 25, 0, 131, 117, 117, 109, 0, 18,
-  21, 6, 0, 128, 110, 0, 68, 156, 93, 7, 140, 95, 8, 170, 95, 10, 211, 96, 12,
-  46, 97, 14, 231, 97, 18, 13, 98, 19, 63, 111, 21, 75, 111, 22, 176, 111, 23,
-  230, 111, 24, 241, 111, 26, 8, 112, 28, 20, 112, 0, 70, 181, 93, 8, 9, 94, 10,
-  20, 94, 11, 36, 94, 12, 47, 94, 16, 86, 95, 21, 124, 95, 27, 133, 95, 0, 12,
-  0, 69, 193, 93, 15, 205, 93, 23, 237, 93, 0, 24, 19, 8, 21, 0, 131, 108, 105,
-  99, 97, 110, 0, 69, 212, 93, 24, 225, 93, 0, 19, 8, 21, 0, 133, 117, 98, 108,
-  105, 99, 97, 110, 0, 19, 8, 21, 0, 132, 98, 108, 105, 99, 97, 110, 0, 68, 244,
-  93, 12, 0, 94, 0, 16, 8, 11, 23, 4, 16, 0, 129, 105, 97, 110, 0, 15, 18, 19,
-  0, 129, 105, 97, 110, 0, 17, 8, 11, 23, 4, 0, 130, 105, 97, 110, 0, 4, 11, 6,
-  12, 16, 0, 135, 77, 105, 99, 104, 105, 103, 97, 110, 0, 22, 21, 18, 19, 0,
-  131, 116, 105, 111, 110, 0, 70, 69, 94, 7, 138, 94, 10, 166, 94, 15, 174, 94,
-  21, 215, 94, 22, 5, 95, 23, 34, 95, 0, 76, 76, 94, 17, 127, 94, 0, 70, 86, 94,
-  11, 97, 94, 23, 109, 94, 0, 22, 24, 16, 0, 133, 105, 99, 105, 97, 110, 0, 6,
-  8, 23, 0, 132, 110, 105, 99, 105, 97, 110, 0, 4, 16, 11, 23, 4, 16, 0, 135,
-  101, 109, 97, 116, 105, 99, 105, 97, 110, 0, 12, 10, 4, 16, 0, 132, 99, 105,
-  97, 110, 0, 72, 145, 94, 21, 157, 94, 0, 16, 12, 11, 6, 21, 4, 0, 130, 101,
-  97, 110, 0, 18, 6, 6, 4, 0, 129, 111, 110, 0, 4, 44, 0, 130, 97, 105, 110, 0,
-  68, 181, 94, 15, 193, 94, 0, 16, 4, 16, 0, 132, 109, 97, 108, 105, 97, 110, 0,
-  12, 25, 0, 108, 203, 94, 12, 208, 94, 0, 130, 97, 105, 110, 0, 6, 0, 131, 105,
-  97, 110, 0, 4, 23, 0, 68, 225, 94, 17, 238, 94, 0, 10, 8, 25, 0, 134, 101,
-  116, 97, 114, 105, 97, 110, 0, 8, 16, 4, 12, 15, 4, 19, 0, 139, 114, 108, 105,
-  97, 109, 101, 110, 116, 97, 114, 105, 97, 110, 0, 72, 12, 95, 12, 26, 95, 0,
-  23, 15, 4, 16, 0, 136, 77, 97, 108, 116, 101, 115, 101, 0, 4, 0, 132, 115,
-  105, 97, 110, 0, 68, 47, 95, 12, 58, 95, 17, 70, 95, 21, 78, 95, 0, 11, 0,
-  133, 72, 97, 105, 116, 105, 97, 110, 0, 17, 11, 6, 8, 23, 0, 131, 99, 105, 97,
-  110, 0, 18, 6, 0, 130, 97, 105, 110, 0, 8, 6, 0, 130, 97, 105, 110, 0, 76, 93,
-  95, 28, 105, 95, 0, 21, 4, 11, 6, 0, 132, 105, 114, 109, 97, 110, 0, 21, 23,
-  17, 4, 21, 9, 17, 12, 0, 136, 97, 110, 116, 114, 121, 109, 97, 110, 0, 8, 15,
-  44, 0, 130, 97, 114, 110, 0, 6, 0, 130, 121, 97, 110, 0, 76, 147, 95, 24, 153,
-  95, 0, 9, 0, 129, 110, 100, 0, 18, 0, 73, 162, 95, 22, 166, 95, 0, 129, 110,
-  100, 0, 129, 110, 100, 0, 69, 201, 95, 7, 213, 95, 8, 0, 96, 10, 42, 96, 11,
-  88, 96, 19, 112, 96, 21, 138, 96, 22, 150, 96, 23, 175, 96, 26, 203, 96, 0,
-  12, 12, 21, 6, 22, 8, 7, 0, 131, 98, 101, 0, 76, 223, 95, 15, 233, 95, 21,
-  242, 95, 0, 5, 21, 18, 9, 0, 129, 100, 101, 110, 0, 12, 11, 6, 0, 129, 114,
-  101, 110, 0, 4, 10, 21, 8, 7, 17, 12, 14, 0, 130, 116, 101, 110, 0, 87, 7, 96,
-  26, 32, 96, 0, 72, 14, 96, 26, 22, 96, 0, 5, 0, 130, 119, 101, 101, 110, 0, 8,
-  5, 0, 132, 116, 119, 101, 101, 110, 0, 8, 5, 0, 131, 116, 119, 101, 101, 110,
-  0, 76, 52, 96, 17, 61, 96, 18, 77, 96, 0, 27, 18, 0, 131, 121, 103, 101, 110,
-  0, 12, 21, 4, 11, 23, 18, 15, 0, 134, 114, 105, 110, 103, 101, 110, 0, 7, 28,
-  11, 0, 131, 114, 111, 103, 101, 110, 0, 23, 0, 72, 97, 96, 21, 105, 96, 0, 21,
-  5, 0, 129, 114, 101, 110, 0, 18, 17, 0, 128, 114, 110, 0, 68, 119, 96, 19,
-  127, 96, 0, 11, 44, 0, 129, 112, 101, 110, 0, 11, 4, 0, 133, 104, 97, 112,
-  112, 101, 110, 0, 8, 11, 23, 8, 21, 5, 0, 131, 114, 101, 110, 0, 82, 157, 96,
-  22, 166, 96, 0, 18, 11, 6, 0, 131, 115, 101, 110, 0, 12, 16, 0, 131, 122, 122,
-  101, 110, 0, 76, 182, 96, 23, 190, 96, 0, 21, 26, 0, 129, 116, 101, 110, 0,
-  12, 26, 8, 21, 0, 132, 114, 105, 116, 116, 101, 110, 0, 23, 8, 5, 0, 128, 101,
-  110, 0, 72, 218, 96, 12, 229, 96, 0, 12, 21, 18, 9, 0, 131, 101, 105, 103,
-  110, 0, 75, 248, 96, 15, 254, 96, 17, 6, 97, 18, 15, 97, 21, 30, 97, 22, 37,
-  97, 0, 23, 0, 129, 110, 103, 0, 15, 4, 0, 131, 105, 103, 110, 0, 21, 4, 8, 15,
-  0, 129, 110, 103, 0, 71, 22, 97, 10, 26, 97, 0, 129, 110, 103, 0, 129, 110,
-  103, 0, 23, 22, 0, 129, 110, 103, 0, 4, 44, 0, 130, 115, 105, 103, 110, 0, 68,
-  68, 97, 10, 122, 97, 14, 158, 97, 15, 168, 97, 18, 179, 97, 22, 197, 97, 23,
-  220, 97, 0, 83, 78, 97, 21, 86, 97, 23, 98, 97, 0, 16, 4, 6, 0, 128, 103, 110,
-  0, 23, 22, 8, 7, 8, 19, 0, 130, 105, 97, 110, 0, 68, 105, 97, 17, 111, 97, 0,
-  130, 116, 97, 105, 110, 0, 24, 18, 6, 0, 133, 110, 116, 97, 105, 110, 0, 68,
-  129, 97, 22, 150, 97, 0, 108, 136, 97, 19, 141, 97, 0, 129, 97, 105, 110, 0,
-  16, 4, 6, 0, 130, 105, 103, 110, 0, 8, 7, 0, 130, 105, 103, 110, 0, 16, 24,
-  19, 0, 130, 112, 107, 105, 110, 0, 4, 19, 27, 8, 0, 131, 108, 97, 105, 110, 0,
-  76, 186, 97, 23, 189, 97, 0, 129, 110, 0, 6, 4, 0, 130, 105, 111, 110, 0, 68,
-  204, 97, 12, 213, 97, 0, 22, 22, 4, 0, 129, 115, 105, 110, 0, 18, 19, 0, 129,
-  111, 110, 0, 4, 21, 8, 6, 0, 131, 116, 97, 105, 110, 0, 75, 238, 97, 12, 247,
-  97, 0, 12, 23, 0, 131, 104, 105, 110, 107, 0, 75, 254, 97, 23, 4, 98, 0, 23,
-  0, 129, 110, 107, 0, 11, 0, 132, 116, 104, 105, 110, 107, 0, 71, 44, 98, 8,
-  75, 98, 11, 104, 98, 12, 115, 98, 15, 28, 110, 17, 37, 110, 21, 72, 110, 22,
-  108, 110, 23, 186, 110, 26, 55, 111, 0, 17, 0, 68, 53, 98, 18, 65, 98, 0, 5,
-  7, 4, 0, 134, 98, 97, 110, 100, 111, 110, 0, 5, 4, 0, 132, 97, 110, 100, 111,
-  110, 0, 71, 82, 98, 21, 93, 98, 0, 21, 18, 6, 6, 4, 0, 130, 105, 111, 110, 0,
-  8, 23, 12, 21, 6, 0, 130, 105, 111, 110, 0, 22, 21, 18, 19, 0, 131, 116, 105,
-  111, 110, 0, 68, 143, 98, 6, 169, 98, 8, 203, 98, 12, 215, 98, 15, 245, 98,
-  17, 15, 99, 22, 27, 99, 23, 222, 100, 24, 14, 110, 0, 79, 150, 98, 23, 161,
-  98, 0, 24, 10, 8, 21, 0, 130, 116, 105, 111, 110, 0, 22, 0, 130, 116, 105,
-  111, 110, 0, 12, 22, 0, 72, 179, 98, 16, 189, 98, 0, 7, 0, 133, 99, 105, 115,
-  105, 111, 110, 0, 24, 6, 21, 12, 6, 0, 133, 99, 105, 115, 105, 111, 110, 0,
-  22, 24, 9, 17, 18, 6, 0, 131, 105, 111, 110, 0, 23, 0, 76, 224, 98, 19, 235,
-  98, 0, 23, 8, 19, 16, 18, 6, 0, 130, 111, 110, 0, 28, 21, 6, 17, 8, 0, 130,
-  111, 110, 0, 76, 252, 98, 15, 5, 99, 0, 16, 44, 0, 130, 108, 105, 111, 110, 0,
-  12, 25, 4, 19, 0, 131, 105, 111, 110, 0, 12, 19, 19, 18, 0, 133, 105, 110,
-  105, 111, 110, 0, 68, 52, 99, 5, 77, 99, 8, 90, 99, 12, 120, 99, 17, 249, 99,
-  18, 24, 100, 22, 48, 100, 24, 211, 100, 0, 70, 59, 99, 12, 69, 99, 0, 18, 0,
-  132, 99, 97, 115, 105, 111, 110, 0, 15, 0, 131, 105, 115, 111, 110, 0, 21, 18,
-  22, 5, 4, 0, 132, 112, 116, 105, 111, 110, 0, 73, 97, 99, 22, 110, 99, 0, 9,
-  18, 21, 19, 0, 133, 101, 115, 115, 105, 111, 110, 0, 22, 18, 19, 0, 130, 115,
-  105, 111, 110, 0, 70, 139, 99, 15, 151, 99, 16, 162, 99, 17, 212, 99, 21, 226,
-  99, 25, 236, 99, 0, 22, 8, 7, 0, 134, 99, 105, 115, 105, 111, 110, 0, 18, 16,
-  8, 7, 0, 131, 116, 105, 111, 110, 0, 72, 172, 99, 16, 178, 99, 18, 201, 99, 0,
-  130, 115, 105, 111, 110, 0, 72, 185, 99, 18, 193, 99, 0, 133, 105, 115, 115,
-  105, 111, 110, 0, 6, 0, 130, 115, 105, 111, 110, 0, 6, 0, 132, 109, 105, 115,
-  115, 105, 111, 110, 0, 4, 10, 21, 18, 8, 21, 0, 130, 97, 116, 105, 111, 110,
-  0, 4, 19, 16, 18, 6, 0, 130, 111, 110, 0, 18, 21, 19, 16, 12, 0, 130, 97, 116,
-  105, 111, 110, 0, 68, 0, 100, 8, 14, 100, 0, 19, 4, 27, 8, 0, 135, 112, 97,
-  110, 115, 105, 111, 110, 0, 23, 23, 4, 0, 131, 116, 105, 111, 110, 0, 83, 31,
-  100, 21, 37, 100, 0, 131, 105, 115, 111, 110, 0, 18, 6, 0, 132, 114, 111, 115,
-  105, 111, 110, 0, 68, 58, 100, 8, 82, 100, 12, 162, 100, 0, 6, 0, 70, 67, 100,
-  18, 74, 100, 0, 18, 0, 131, 105, 111, 110, 0, 133, 99, 97, 115, 105, 111, 110,
-  0, 69, 95, 100, 6, 106, 100, 9, 118, 100, 21, 131, 100, 0, 18, 0, 133, 115,
+  109, 0, 8, 5, 18, 21, 19, 0, 130, 108, 101, 109, 0, 81, 54, 92, 23, 65, 92, 0,
+  8, 16, 18, 17, 8, 11, 19, 0, 128, 110, 0, 22, 24, 6, 4, 0, 132, 99, 117, 115,
+  116, 111, 109, 0, 18, 9, 0, 81, 88, 92, 18, 99, 92, 0, 4, 21, 23, 0, 131, 115,
+  102, 111, 114, 109, 0, 6, 0, 131, 110, 102, 111, 114, 109, 0, 68, 118, 92, 8,
+  126, 92, 12, 137, 92, 0, 8, 21, 7, 0, 129, 109, 115, 0, 12, 11, 23, 4, 0, 131,
+  101, 105, 115, 109, 0, 70, 156, 92, 15, 171, 92, 16, 218, 92, 21, 230, 92, 22,
+  244, 92, 23, 0, 93, 0, 18, 15, 18, 11, 23, 4, 6, 0, 132, 105, 99, 105, 115,
+  109, 0, 4, 0, 85, 180, 92, 24, 199, 92, 0, 23, 15, 24, 6, 12, 23, 15, 24, 16,
+  0, 133, 117, 114, 97, 108, 105, 115, 109, 0, 10, 17, 12, 15, 15, 12, 5, 0,
+  137, 105, 110, 103, 117, 97, 108, 105, 115, 109, 0, 18, 23, 19, 18, 0, 132,
+  105, 109, 105, 115, 109, 0, 4, 10, 4, 15, 19, 0, 132, 105, 97, 114, 105, 115,
+  109, 0, 12, 23, 12, 21, 6, 0, 131, 99, 105, 115, 109, 0, 4, 17, 4, 9, 0, 129,
+  99, 105, 115, 109, 0, 76, 18, 93, 22, 28, 93, 0, 21, 18, 10, 15, 4, 0, 128,
+  104, 109, 0, 12, 11, 6, 21, 4, 17, 4, 0, 129, 109, 0, 71, 64, 93, 10, 80, 93,
+  12, 111, 93, 15, 221, 93, 16, 239, 93, 21, 250, 93, 23, 7, 94, 24, 17, 94, 0,
+  17, 8, 7, 8, 9, 8, 21, 0, 133, 114, 101, 110, 100, 117, 109, 0, 76, 87, 93,
+  24, 97, 93, 0, 15, 8, 5, 0, 131, 103, 105, 117, 109, 0, 21, 21, 8, 23, 17, 12,
+  0, 131, 101, 103, 110, 117, 109, 0, 69, 124, 93, 6, 137, 93, 17, 150, 93, 21,
+  182, 93, 0, 12, 15, 12, 24, 20, 8, 0, 130, 114, 105, 117, 109, 0, 21, 18, 22,
+  17, 18, 6, 0, 131, 116, 105, 117, 109, 0, 72, 157, 93, 17, 168, 93, 0, 15, 15,
+  12, 16, 0, 130, 110, 105, 117, 109, 0, 8, 15, 12, 16, 0, 133, 108, 101, 110,
+  110, 105, 117, 109, 0, 5, 12, 15, 0, 68, 193, 93, 8, 207, 93, 0, 24, 20, 8, 0,
+  135, 105, 108, 105, 98, 114, 105, 117, 109, 0, 24, 20, 8, 0, 135, 105, 108,
+  105, 98, 114, 105, 117, 109, 0, 24, 6, 12, 21, 12, 6, 0, 135, 117, 114, 114,
+  105, 99, 117, 108, 117, 109, 0, 24, 17, 12, 16, 0, 131, 105, 109, 117, 109, 0,
+  5, 12, 15, 12, 24, 20, 8, 0, 129, 105, 117, 109, 0, 6, 8, 19, 22, 0, 129, 114,
+  117, 109, 0, 6, 6, 4, 25, 0, 131, 117, 117, 109, 0, 18, 21, 6, 0, 128, 110, 0,
+  68, 77, 94, 7, 61, 96, 8, 91, 96, 10, 132, 97, 12, 223, 97, 14, 152, 98, 18,
+  190, 98, 19, 240, 111, 21, 252, 111, 22, 97, 112, 23, 151, 112, 24, 162, 112,
+  26, 185, 112, 28, 197, 112, 0, 70, 102, 94, 8, 186, 94, 10, 197, 94, 11, 213,
+  94, 12, 224, 94, 16, 7, 96, 21, 45, 96, 27, 54, 96, 0, 12, 0, 69, 114, 94, 15,
+  126, 94, 23, 158, 94, 0, 24, 19, 8, 21, 0, 131, 108, 105, 99, 97, 110, 0, 69,
+  133, 94, 24, 146, 94, 0, 19, 8, 21, 0, 133, 117, 98, 108, 105, 99, 97, 110, 0,
+  19, 8, 21, 0, 132, 98, 108, 105, 99, 97, 110, 0, 68, 165, 94, 12, 177, 94, 0,
+  16, 8, 11, 23, 4, 16, 0, 129, 105, 97, 110, 0, 15, 18, 19, 0, 129, 105, 97,
+  110, 0, 17, 8, 11, 23, 4, 0, 130, 105, 97, 110, 0, 4, 11, 6, 12, 16, 0, 135,
+  77, 105, 99, 104, 105, 103, 97, 110, 0, 22, 21, 18, 19, 0, 131, 116, 105, 111,
+  110, 0, 70, 246, 94, 7, 59, 95, 10, 87, 95, 15, 95, 95, 21, 136, 95, 22, 182,
+  95, 23, 211, 95, 0, 76, 253, 94, 17, 48, 95, 0, 70, 7, 95, 11, 18, 95, 23, 30,
+  95, 0, 22, 24, 16, 0, 133, 105, 99, 105, 97, 110, 0, 6, 8, 23, 0, 132, 110,
+  105, 99, 105, 97, 110, 0, 4, 16, 11, 23, 4, 16, 0, 135, 101, 109, 97, 116,
+  105, 99, 105, 97, 110, 0, 12, 10, 4, 16, 0, 132, 99, 105, 97, 110, 0, 72, 66,
+  95, 21, 78, 95, 0, 16, 12, 11, 6, 21, 4, 0, 130, 101, 97, 110, 0, 18, 6, 6, 4,
+  0, 129, 111, 110, 0, 4, 44, 0, 130, 97, 105, 110, 0, 68, 102, 95, 15, 114, 95,
+  0, 16, 4, 16, 0, 132, 109, 97, 108, 105, 97, 110, 0, 12, 25, 0, 108, 124, 95,
+  12, 129, 95, 0, 130, 97, 105, 110, 0, 6, 0, 131, 105, 97, 110, 0, 4, 23, 0,
+  68, 146, 95, 17, 159, 95, 0, 10, 8, 25, 0, 134, 101, 116, 97, 114, 105, 97,
+  110, 0, 8, 16, 4, 12, 15, 4, 19, 0, 139, 114, 108, 105, 97, 109, 101, 110,
+  116, 97, 114, 105, 97, 110, 0, 72, 189, 95, 12, 203, 95, 0, 23, 15, 4, 16, 0,
+  136, 77, 97, 108, 116, 101, 115, 101, 0, 4, 0, 132, 115, 105, 97, 110, 0, 68,
+  224, 95, 12, 235, 95, 17, 247, 95, 21, 255, 95, 0, 11, 0, 133, 72, 97, 105,
+  116, 105, 97, 110, 0, 17, 11, 6, 8, 23, 0, 131, 99, 105, 97, 110, 0, 18, 6, 0,
+  130, 97, 105, 110, 0, 8, 6, 0, 130, 97, 105, 110, 0, 76, 14, 96, 28, 26, 96,
+  0, 21, 4, 11, 6, 0, 132, 105, 114, 109, 97, 110, 0, 21, 23, 17, 4, 21, 9, 17,
+  12, 0, 136, 97, 110, 116, 114, 121, 109, 97, 110, 0, 8, 15, 44, 0, 130, 97,
+  114, 110, 0, 6, 0, 130, 121, 97, 110, 0, 76, 68, 96, 24, 74, 96, 0, 9, 0, 129,
+  110, 100, 0, 18, 0, 73, 83, 96, 22, 87, 96, 0, 129, 110, 100, 0, 129, 110,
+  100, 0, 69, 122, 96, 7, 134, 96, 8, 177, 96, 10, 219, 96, 11, 9, 97, 19, 33,
+  97, 21, 59, 97, 22, 71, 97, 23, 96, 97, 26, 124, 97, 0, 12, 12, 21, 6, 22, 8,
+  7, 0, 131, 98, 101, 0, 76, 144, 96, 15, 154, 96, 21, 163, 96, 0, 5, 21, 18, 9,
+  0, 129, 100, 101, 110, 0, 12, 11, 6, 0, 129, 114, 101, 110, 0, 4, 10, 21, 8,
+  7, 17, 12, 14, 0, 130, 116, 101, 110, 0, 87, 184, 96, 26, 209, 96, 0, 72, 191,
+  96, 26, 199, 96, 0, 5, 0, 130, 119, 101, 101, 110, 0, 8, 5, 0, 132, 116, 119,
+  101, 101, 110, 0, 8, 5, 0, 131, 116, 119, 101, 101, 110, 0, 76, 229, 96, 17,
+  238, 96, 18, 254, 96, 0, 27, 18, 0, 131, 121, 103, 101, 110, 0, 12, 21, 4, 11,
+  23, 18, 15, 0, 134, 114, 105, 110, 103, 101, 110, 0, 7, 28, 11, 0, 131, 114,
+  111, 103, 101, 110, 0, 23, 0, 72, 18, 97, 21, 26, 97, 0, 21, 5, 0, 129, 114,
+  101, 110, 0, 18, 17, 0, 128, 114, 110, 0, 68, 40, 97, 19, 48, 97, 0, 11, 44,
+  0, 129, 112, 101, 110, 0, 11, 4, 0, 133, 104, 97, 112, 112, 101, 110, 0, 8,
+  11, 23, 8, 21, 5, 0, 131, 114, 101, 110, 0, 82, 78, 97, 22, 87, 97, 0, 18, 11,
+  6, 0, 131, 115, 101, 110, 0, 12, 16, 0, 131, 122, 122, 101, 110, 0, 76, 103,
+  97, 23, 111, 97, 0, 21, 26, 0, 129, 116, 101, 110, 0, 12, 26, 8, 21, 0, 132,
+  114, 105, 116, 116, 101, 110, 0, 23, 8, 5, 0, 128, 101, 110, 0, 72, 139, 97,
+  12, 150, 97, 0, 12, 21, 18, 9, 0, 131, 101, 105, 103, 110, 0, 75, 169, 97, 15,
+  175, 97, 17, 183, 97, 18, 192, 97, 21, 207, 97, 22, 214, 97, 0, 23, 0, 129,
+  110, 103, 0, 15, 4, 0, 131, 105, 103, 110, 0, 21, 4, 8, 15, 0, 129, 110, 103,
+  0, 71, 199, 97, 10, 203, 97, 0, 129, 110, 103, 0, 129, 110, 103, 0, 23, 22, 0,
+  129, 110, 103, 0, 4, 44, 0, 130, 115, 105, 103, 110, 0, 68, 245, 97, 10, 43,
+  98, 14, 79, 98, 15, 89, 98, 18, 100, 98, 22, 118, 98, 23, 141, 98, 0, 83, 255,
+  97, 21, 7, 98, 23, 19, 98, 0, 16, 4, 6, 0, 128, 103, 110, 0, 23, 22, 8, 7, 8,
+  19, 0, 130, 105, 97, 110, 0, 68, 26, 98, 17, 32, 98, 0, 130, 116, 97, 105,
+  110, 0, 24, 18, 6, 0, 133, 110, 116, 97, 105, 110, 0, 68, 50, 98, 22, 71, 98,
+  0, 108, 57, 98, 19, 62, 98, 0, 129, 97, 105, 110, 0, 16, 4, 6, 0, 130, 105,
+  103, 110, 0, 8, 7, 0, 130, 105, 103, 110, 0, 16, 24, 19, 0, 130, 112, 107,
+  105, 110, 0, 4, 19, 27, 8, 0, 131, 108, 97, 105, 110, 0, 76, 107, 98, 23, 110,
+  98, 0, 129, 110, 0, 6, 4, 0, 130, 105, 111, 110, 0, 68, 125, 98, 12, 134, 98,
+  0, 22, 22, 4, 0, 129, 115, 105, 110, 0, 18, 19, 0, 129, 111, 110, 0, 4, 21, 8,
+  6, 0, 131, 116, 97, 105, 110, 0, 75, 159, 98, 12, 168, 98, 0, 12, 23, 0, 131,
+  104, 105, 110, 107, 0, 75, 175, 98, 23, 181, 98, 0, 23, 0, 129, 110, 107, 0,
+  11, 0, 132, 116, 104, 105, 110, 107, 0, 71, 221, 98, 8, 252, 98, 11, 25, 99,
+  12, 36, 99, 15, 205, 110, 17, 214, 110, 21, 249, 110, 22, 29, 111, 23, 107,
+  111, 26, 232, 111, 0, 17, 0, 68, 230, 98, 18, 242, 98, 0, 5, 7, 4, 0, 134, 98,
+  97, 110, 100, 111, 110, 0, 5, 4, 0, 132, 97, 110, 100, 111, 110, 0, 71, 3, 99,
+  21, 14, 99, 0, 21, 18, 6, 6, 4, 0, 130, 105, 111, 110, 0, 8, 23, 12, 21, 6, 0,
+  130, 105, 111, 110, 0, 22, 21, 18, 19, 0, 131, 116, 105, 111, 110, 0, 68, 64,
+  99, 6, 90, 99, 8, 124, 99, 12, 136, 99, 15, 166, 99, 17, 192, 99, 22, 204, 99,
+  23, 143, 101, 24, 191, 110, 0, 79, 71, 99, 23, 82, 99, 0, 24, 10, 8, 21, 0,
+  130, 116, 105, 111, 110, 0, 22, 0, 130, 116, 105, 111, 110, 0, 12, 22, 0, 72,
+  100, 99, 16, 110, 99, 0, 7, 0, 133, 99, 105, 115, 105, 111, 110, 0, 24, 6, 21,
+  12, 6, 0, 133, 99, 105, 115, 105, 111, 110, 0, 22, 24, 9, 17, 18, 6, 0, 131,
+  105, 111, 110, 0, 23, 0, 76, 145, 99, 19, 156, 99, 0, 23, 8, 19, 16, 18, 6, 0,
+  130, 111, 110, 0, 28, 21, 6, 17, 8, 0, 130, 111, 110, 0, 76, 173, 99, 15, 182,
+  99, 0, 16, 44, 0, 130, 108, 105, 111, 110, 0, 12, 25, 4, 19, 0, 131, 105, 111,
+  110, 0, 12, 19, 19, 18, 0, 133, 105, 110, 105, 111, 110, 0, 68, 229, 99, 5,
+  254, 99, 8, 11, 100, 12, 41, 100, 17, 170, 100, 18, 201, 100, 22, 225, 100,
+  24, 132, 101, 0, 70, 236, 99, 12, 246, 99, 0, 18, 0, 132, 99, 97, 115, 105,
+  111, 110, 0, 15, 0, 131, 105, 115, 111, 110, 0, 21, 18, 22, 5, 4, 0, 132, 112,
+  116, 105, 111, 110, 0, 73, 18, 100, 22, 31, 100, 0, 9, 18, 21, 19, 0, 133,
+  101, 115, 115, 105, 111, 110, 0, 22, 18, 19, 0, 130, 115, 105, 111, 110, 0,
+  70, 60, 100, 15, 72, 100, 16, 83, 100, 17, 133, 100, 21, 147, 100, 25, 157,
+  100, 0, 22, 8, 7, 0, 134, 99, 105, 115, 105, 111, 110, 0, 18, 16, 8, 7, 0,
+  131, 116, 105, 111, 110, 0, 72, 93, 100, 16, 99, 100, 18, 122, 100, 0, 130,
+  115, 105, 111, 110, 0, 72, 106, 100, 18, 114, 100, 0, 133, 105, 115, 115, 105,
+  111, 110, 0, 6, 0, 130, 115, 105, 111, 110, 0, 6, 0, 132, 109, 105, 115, 115,
+  105, 111, 110, 0, 4, 10, 21, 18, 8, 21, 0, 130, 97, 116, 105, 111, 110, 0, 4,
+  19, 16, 18, 6, 0, 130, 111, 110, 0, 18, 21, 19, 16, 12, 0, 130, 97, 116, 105,
+  111, 110, 0, 68, 177, 100, 8, 191, 100, 0, 19, 4, 27, 8, 0, 135, 112, 97, 110,
+  115, 105, 111, 110, 0, 23, 23, 4, 0, 131, 116, 105, 111, 110, 0, 83, 208, 100,
+  21, 214, 100, 0, 131, 105, 115, 111, 110, 0, 18, 6, 0, 132, 114, 111, 115,
+  105, 111, 110, 0, 68, 235, 100, 8, 3, 101, 12, 83, 101, 0, 6, 0, 70, 244, 100,
+  18, 251, 100, 0, 18, 0, 131, 105, 111, 110, 0, 133, 99, 97, 115, 105, 111,
+  110, 0, 69, 16, 101, 6, 27, 101, 9, 39, 101, 21, 52, 101, 0, 18, 0, 133, 115,
   101, 115, 115, 105, 111, 110, 0, 24, 22, 0, 133, 99, 101, 115, 115, 105, 111,
-  110, 0, 9, 18, 21, 19, 0, 134, 101, 115, 115, 105, 111, 110, 0, 74, 138, 100,
-  19, 150, 100, 0, 4, 0, 134, 103, 114, 101, 115, 115, 105, 111, 110, 0, 18, 0,
-  134, 112, 114, 101, 115, 115, 105, 111, 110, 0, 16, 0, 71, 174, 100, 8, 186,
-  100, 18, 200, 100, 0, 7, 4, 0, 135, 109, 105, 115, 115, 105, 111, 110, 0, 21,
+  110, 0, 9, 18, 21, 19, 0, 134, 101, 115, 115, 105, 111, 110, 0, 74, 59, 101,
+  19, 71, 101, 0, 4, 0, 134, 103, 114, 101, 115, 115, 105, 111, 110, 0, 18, 0,
+  134, 112, 114, 101, 115, 115, 105, 111, 110, 0, 16, 0, 71, 95, 101, 8, 107,
+  101, 18, 121, 101, 0, 7, 4, 0, 135, 109, 105, 115, 115, 105, 111, 110, 0, 21,
   19, 0, 136, 101, 114, 109, 105, 115, 115, 105, 111, 110, 0, 6, 0, 133, 109,
   105, 115, 115, 105, 111, 110, 0, 5, 16, 18, 6, 0, 130, 116, 105, 111, 110, 0,
-  68, 9, 101, 5, 30, 106, 6, 60, 106, 7, 148, 107, 8, 175, 107, 12, 239, 107,
-  15, 184, 108, 16, 196, 108, 17, 209, 108, 18, 59, 109, 21, 73, 109, 22, 103,
-  109, 24, 132, 109, 29, 0, 110, 0, 69, 55, 101, 6, 92, 101, 7, 187, 101, 10,
-  244, 101, 12, 23, 102, 15, 157, 102, 16, 232, 102, 17, 57, 103, 19, 177, 103,
-  21, 194, 103, 22, 217, 104, 23, 4, 105, 25, 166, 105, 27, 195, 105, 29, 209,
-  105, 0, 85, 62, 101, 24, 78, 101, 0, 8, 23, 22, 4, 16, 0, 135, 117, 114, 98,
+  68, 186, 101, 5, 207, 106, 6, 237, 106, 7, 69, 108, 8, 96, 108, 12, 160, 108,
+  15, 105, 109, 16, 117, 109, 17, 130, 109, 18, 236, 109, 21, 250, 109, 22, 24,
+  110, 24, 53, 110, 29, 177, 110, 0, 69, 232, 101, 6, 13, 102, 7, 108, 102, 10,
+  165, 102, 12, 200, 102, 15, 78, 103, 16, 153, 103, 17, 234, 103, 19, 98, 104,
+  21, 115, 104, 22, 138, 105, 23, 181, 105, 25, 87, 106, 27, 116, 106, 29, 130,
+  106, 0, 85, 239, 101, 24, 255, 101, 0, 8, 23, 22, 4, 16, 0, 135, 117, 114, 98,
   97, 116, 105, 111, 110, 0, 23, 21, 8, 19, 0, 133, 114, 98, 97, 116, 105, 111,
-  110, 0, 76, 99, 101, 18, 175, 101, 0, 73, 112, 101, 15, 127, 101, 17, 141,
-  101, 22, 158, 101, 0, 21, 8, 25, 0, 135, 105, 102, 105, 99, 97, 116, 105, 111,
-  110, 0, 19, 4, 0, 135, 112, 108, 105, 99, 97, 116, 105, 111, 110, 0, 12, 16,
-  16, 18, 6, 0, 136, 117, 110, 105, 99, 97, 116, 105, 111, 110, 0, 18, 22, 22,
-  4, 0, 136, 97, 115, 115, 105, 110, 97, 116, 105, 111, 110, 0, 22, 22, 4, 0,
-  132, 105, 97, 116, 105, 111, 110, 0, 68, 197, 101, 12, 213, 101, 18, 228, 101,
-  0, 16, 18, 6, 6, 4, 0, 134, 109, 111, 100, 97, 116, 105, 111, 110, 0, 7, 8,
-  21, 6, 6, 4, 0, 133, 116, 97, 116, 105, 111, 110, 0, 16, 18, 6, 6, 4, 0, 134,
-  109, 111, 100, 97, 116, 105, 111, 110, 0, 71, 251, 101, 18, 9, 102, 0, 24, 13,
-  5, 24, 22, 0, 134, 103, 97, 116, 105, 111, 110, 0, 19, 18, 21, 19, 0, 134, 97,
-  103, 97, 116, 105, 111, 110, 0, 70, 39, 102, 7, 97, 102, 17, 111, 102, 19,
-  125, 102, 25, 140, 102, 0, 81, 46, 102, 18, 84, 102, 0, 24, 0, 80, 55, 102,
-  18, 68, 102, 0, 16, 18, 6, 0, 134, 105, 99, 97, 116, 105, 111, 110, 0, 17, 18,
+  110, 0, 76, 20, 102, 18, 96, 102, 0, 73, 33, 102, 15, 48, 102, 17, 62, 102,
+  22, 79, 102, 0, 21, 8, 25, 0, 135, 105, 102, 105, 99, 97, 116, 105, 111, 110,
+  0, 19, 4, 0, 135, 112, 108, 105, 99, 97, 116, 105, 111, 110, 0, 12, 16, 16,
+  18, 6, 0, 136, 117, 110, 105, 99, 97, 116, 105, 111, 110, 0, 18, 22, 22, 4, 0,
+  136, 97, 115, 115, 105, 110, 97, 116, 105, 111, 110, 0, 22, 22, 4, 0, 132,
+  105, 97, 116, 105, 111, 110, 0, 68, 118, 102, 12, 134, 102, 18, 149, 102, 0,
+  16, 18, 6, 6, 4, 0, 134, 109, 111, 100, 97, 116, 105, 111, 110, 0, 7, 8, 21,
+  6, 6, 4, 0, 133, 116, 97, 116, 105, 111, 110, 0, 16, 18, 6, 6, 4, 0, 134, 109,
+  111, 100, 97, 116, 105, 111, 110, 0, 71, 172, 102, 18, 186, 102, 0, 24, 13, 5,
+  24, 22, 0, 134, 103, 97, 116, 105, 111, 110, 0, 19, 18, 21, 19, 0, 134, 97,
+  103, 97, 116, 105, 111, 110, 0, 70, 216, 102, 7, 18, 103, 17, 32, 103, 19, 46,
+  103, 25, 61, 103, 0, 81, 223, 102, 18, 5, 103, 0, 24, 0, 80, 232, 102, 18,
+  245, 102, 0, 16, 18, 6, 0, 134, 105, 99, 97, 116, 105, 111, 110, 0, 17, 18,
   21, 19, 0, 137, 117, 110, 99, 105, 97, 116, 105, 111, 110, 0, 10, 8, 17, 0,
   134, 116, 105, 97, 116, 105, 111, 110, 0, 8, 21, 6, 6, 4, 0, 132, 116, 97,
   116, 105, 111, 110, 0, 24, 16, 16, 18, 6, 0, 132, 99, 97, 116, 105, 111, 110,
   0, 18, 21, 19, 27, 8, 0, 133, 114, 105, 97, 116, 105, 111, 110, 0, 8, 21, 5,
-  4, 0, 136, 98, 114, 101, 118, 105, 97, 116, 105, 111, 110, 0, 76, 164, 102,
-  24, 201, 102, 0, 70, 171, 102, 11, 185, 102, 0, 17, 18, 6, 8, 21, 0, 132, 105,
-  97, 116, 105, 111, 110, 0, 12, 17, 4, 0, 136, 110, 105, 104, 105, 108, 97,
-  116, 105, 111, 110, 0, 18, 19, 0, 108, 211, 102, 18, 221, 102, 0, 134, 112,
-  117, 108, 97, 116, 105, 111, 110, 0, 19, 0, 135, 117, 108, 97, 116, 105, 111,
-  110, 0, 68, 245, 102, 12, 2, 103, 15, 17, 103, 18, 24, 103, 0, 15, 9, 17, 12,
+  4, 0, 136, 98, 114, 101, 118, 105, 97, 116, 105, 111, 110, 0, 76, 85, 103, 24,
+  122, 103, 0, 70, 92, 103, 11, 106, 103, 0, 17, 18, 6, 8, 21, 0, 132, 105, 97,
+  116, 105, 111, 110, 0, 12, 17, 4, 0, 136, 110, 105, 104, 105, 108, 97, 116,
+  105, 111, 110, 0, 18, 19, 0, 108, 132, 103, 18, 142, 103, 0, 134, 112, 117,
+  108, 97, 116, 105, 111, 110, 0, 19, 0, 135, 117, 108, 97, 116, 105, 111, 110,
+  0, 68, 166, 103, 12, 179, 103, 15, 194, 103, 18, 201, 103, 0, 15, 9, 17, 12,
   0, 132, 109, 97, 116, 105, 111, 110, 0, 4, 15, 6, 18, 21, 19, 0, 134, 109, 97,
-  116, 105, 111, 110, 0, 4, 7, 0, 129, 97, 110, 0, 73, 31, 103, 15, 43, 103, 0,
-  17, 12, 0, 133, 114, 109, 97, 116, 105, 111, 110, 0, 6, 18, 21, 19, 0, 134,
-  97, 109, 97, 116, 105, 111, 110, 0, 68, 70, 103, 12, 82, 103, 16, 119, 103,
-  21, 137, 103, 0, 15, 19, 44, 0, 132, 116, 97, 116, 105, 111, 110, 0, 68, 89,
-  103, 16, 102, 103, 0, 15, 19, 27, 8, 0, 134, 110, 97, 116, 105, 111, 110, 0,
-  8, 22, 12, 7, 0, 136, 115, 101, 109, 105, 110, 97, 116, 105, 111, 110, 0, 8,
-  7, 16, 18, 6, 0, 137, 110, 100, 101, 109, 110, 97, 116, 105, 111, 110, 0, 4,
-  0, 70, 146, 103, 23, 162, 103, 0, 12, 8, 21, 0, 136, 110, 99, 97, 114, 110,
-  97, 116, 105, 111, 110, 0, 22, 17, 18, 6, 0, 135, 101, 114, 110, 97, 116, 105,
-  111, 110, 0, 24, 6, 18, 8, 21, 19, 0, 134, 99, 117, 112, 97, 116, 105, 111,
-  110, 0, 72, 210, 103, 10, 64, 104, 12, 107, 104, 23, 121, 104, 24, 181, 104,
-  0, 69, 226, 103, 9, 236, 103, 10, 255, 103, 15, 16, 104, 19, 31, 104, 0, 4, 0,
-  132, 114, 97, 116, 105, 111, 110, 0, 12, 15, 8, 21, 19, 0, 138, 111, 108, 105,
-  102, 101, 114, 97, 116, 105, 111, 110, 0, 7, 12, 21, 9, 8, 21, 0, 136, 103,
-  101, 114, 97, 116, 105, 111, 110, 0, 15, 8, 6, 6, 4, 0, 135, 101, 114, 97,
-  116, 105, 111, 110, 0, 72, 38, 104, 21, 50, 104, 0, 21, 19, 0, 134, 97, 114,
-  97, 116, 105, 111, 110, 0, 18, 6, 17, 12, 0, 134, 111, 114, 97, 116, 105, 111,
-  110, 0, 72, 71, 104, 21, 93, 104, 0, 23, 17, 12, 22, 8, 7, 0, 140, 105, 115,
+  116, 105, 111, 110, 0, 4, 7, 0, 129, 97, 110, 0, 73, 208, 103, 15, 220, 103,
+  0, 17, 12, 0, 133, 114, 109, 97, 116, 105, 111, 110, 0, 6, 18, 21, 19, 0, 134,
+  97, 109, 97, 116, 105, 111, 110, 0, 68, 247, 103, 12, 3, 104, 16, 40, 104, 21,
+  58, 104, 0, 15, 19, 44, 0, 132, 116, 97, 116, 105, 111, 110, 0, 68, 10, 104,
+  16, 23, 104, 0, 15, 19, 27, 8, 0, 134, 110, 97, 116, 105, 111, 110, 0, 8, 22,
+  12, 7, 0, 136, 115, 101, 109, 105, 110, 97, 116, 105, 111, 110, 0, 8, 7, 16,
+  18, 6, 0, 137, 110, 100, 101, 109, 110, 97, 116, 105, 111, 110, 0, 4, 0, 70,
+  67, 104, 23, 83, 104, 0, 12, 8, 21, 0, 136, 110, 99, 97, 114, 110, 97, 116,
+  105, 111, 110, 0, 22, 17, 18, 6, 0, 135, 101, 114, 110, 97, 116, 105, 111,
+  110, 0, 24, 6, 18, 8, 21, 19, 0, 134, 99, 117, 112, 97, 116, 105, 111, 110, 0,
+  72, 131, 104, 10, 241, 104, 12, 28, 105, 23, 42, 105, 24, 102, 105, 0, 69,
+  147, 104, 9, 157, 104, 10, 176, 104, 15, 193, 104, 19, 208, 104, 0, 4, 0, 132,
+  114, 97, 116, 105, 111, 110, 0, 12, 15, 8, 21, 19, 0, 138, 111, 108, 105, 102,
+  101, 114, 97, 116, 105, 111, 110, 0, 7, 12, 21, 9, 8, 21, 0, 136, 103, 101,
+  114, 97, 116, 105, 111, 110, 0, 15, 8, 6, 6, 4, 0, 135, 101, 114, 97, 116,
+  105, 111, 110, 0, 72, 215, 104, 21, 227, 104, 0, 21, 19, 0, 134, 97, 114, 97,
+  116, 105, 111, 110, 0, 18, 6, 17, 12, 0, 134, 111, 114, 97, 116, 105, 111,
+  110, 0, 72, 248, 104, 21, 14, 105, 0, 23, 17, 12, 22, 8, 7, 0, 140, 105, 115,
   105, 110, 116, 101, 103, 114, 97, 116, 105, 111, 110, 0, 8, 23, 17, 12, 0,
   135, 103, 114, 97, 116, 105, 111, 110, 0, 19, 22, 8, 7, 0, 134, 101, 114, 97,
-  116, 105, 111, 110, 0, 76, 128, 104, 22, 143, 104, 0, 15, 12, 9, 17, 12, 0,
-  135, 116, 114, 97, 116, 105, 111, 110, 0, 81, 150, 104, 18, 166, 104, 0, 12,
-  16, 7, 4, 0, 135, 105, 115, 116, 114, 97, 116, 105, 111, 110, 0, 16, 8, 7, 0,
-  135, 110, 115, 116, 114, 97, 116, 105, 111, 110, 0, 68, 188, 104, 10, 202,
-  104, 0, 23, 22, 8, 21, 0, 135, 111, 114, 97, 116, 105, 111, 110, 0, 4, 17, 12,
-  0, 135, 117, 103, 117, 114, 97, 116, 105, 111, 110, 0, 12, 15, 4, 0, 86, 228,
-  104, 23, 245, 104, 0, 17, 4, 0, 139, 110, 97, 115, 97, 108, 105, 115, 97, 116,
-  105, 111, 110, 0, 22, 28, 21, 6, 0, 134, 108, 105, 115, 97, 116, 105, 111,
-  110, 0, 72, 20, 105, 12, 39, 105, 17, 68, 105, 18, 106, 105, 21, 156, 105, 0,
-  21, 19, 8, 23, 17, 12, 0, 136, 114, 112, 114, 101, 116, 97, 116, 105, 111,
-  110, 0, 79, 46, 105, 17, 58, 105, 0, 4, 23, 8, 21, 0, 133, 97, 116, 105, 111,
-  110, 0, 12, 0, 132, 105, 97, 116, 105, 111, 110, 0, 72, 75, 105, 12, 92, 105,
-  0, 16, 8, 10, 8, 22, 0, 137, 109, 101, 110, 116, 97, 116, 105, 111, 110, 0,
-  22, 22, 4, 22, 22, 4, 0, 133, 97, 116, 105, 111, 110, 0, 74, 116, 105, 15,
-  127, 105, 17, 140, 105, 0, 8, 17, 0, 132, 105, 97, 116, 105, 111, 110, 0, 19,
-  27, 8, 0, 133, 105, 116, 97, 116, 105, 111, 110, 0, 17, 4, 6, 0, 137, 111,
-  110, 110, 111, 116, 97, 116, 105, 111, 110, 0, 8, 22, 22, 4, 0, 132, 105, 111,
-  110, 0, 68, 173, 105, 18, 181, 105, 0, 132, 105, 97, 116, 105, 111, 110, 0,
-  17, 17, 8, 21, 0, 135, 111, 118, 97, 116, 105, 111, 110, 0, 28, 11, 19, 22, 4,
-  0, 132, 105, 97, 116, 105, 111, 110, 0, 12, 0, 75, 221, 105, 15, 248, 105, 23,
-  11, 106, 0, 19, 21, 18, 16, 18, 21, 11, 23, 17, 4, 0, 139, 112, 111, 109, 111,
-  114, 112, 104, 105, 122, 97, 116, 105, 111, 110, 0, 4, 22, 17, 4, 0, 139, 110,
-  97, 115, 97, 108, 105, 122, 97, 116, 105, 111, 110, 0, 12, 16, 12, 15, 6, 6,
-  4, 0, 136, 97, 116, 105, 122, 97, 116, 105, 111, 110, 0, 76, 37, 106, 21, 48,
-  106, 0, 11, 27, 8, 0, 131, 105, 116, 105, 111, 110, 0, 18, 22, 5, 4, 0, 132,
-  112, 116, 105, 111, 110, 0, 68, 79, 106, 8, 102, 106, 12, 168, 106, 15, 232,
-  106, 17, 242, 106, 24, 3, 107, 0, 9, 22, 12, 23, 4, 22, 12, 7, 0, 138, 115,
-  97, 116, 105, 115, 102, 97, 99, 116, 105, 111, 110, 0, 81, 115, 106, 21, 127,
-  106, 23, 145, 106, 27, 159, 106, 0, 18, 6, 0, 133, 110, 101, 99, 116, 105,
-  111, 110, 0, 21, 24, 22, 22, 8, 21, 0, 137, 117, 114, 114, 101, 99, 116, 105,
-  111, 110, 0, 8, 21, 19, 0, 135, 111, 116, 101, 99, 116, 105, 111, 110, 0, 8,
-  0, 131, 117, 116, 105, 111, 110, 0, 71, 178, 106, 9, 190, 106, 23, 202, 106,
-  0, 4, 21, 23, 27, 8, 0, 132, 116, 105, 111, 110, 0, 12, 6, 24, 21, 6, 0, 132,
-  120, 105, 111, 110, 0, 22, 12, 0, 71, 212, 106, 21, 220, 106, 0, 132, 110, 99,
-  116, 105, 111, 110, 0, 24, 13, 0, 134, 100, 105, 99, 116, 105, 111, 110, 0, 8,
-  0, 132, 101, 99, 116, 105, 111, 110, 0, 12, 23, 6, 22, 12, 7, 0, 136, 116,
-  105, 110, 99, 116, 105, 111, 110, 0, 77, 13, 107, 21, 25, 107, 23, 118, 107,
-  0, 17, 18, 6, 0, 132, 110, 99, 116, 105, 111, 110, 0, 23, 0, 70, 40, 107, 17,
-  54, 107, 22, 68, 107, 23, 104, 107, 0, 22, 8, 7, 0, 136, 116, 114, 117, 99,
-  116, 105, 111, 110, 0, 18, 6, 0, 135, 115, 116, 114, 117, 99, 116, 105, 111,
-  110, 0, 76, 75, 107, 23, 89, 107, 0, 7, 0, 137, 101, 115, 116, 114, 117, 99,
-  116, 105, 111, 110, 0, 17, 18, 6, 0, 137, 115, 116, 114, 117, 99, 116, 105,
-  111, 110, 0, 22, 17, 18, 6, 0, 135, 114, 117, 99, 116, 105, 111, 110, 0, 22,
-  17, 0, 76, 128, 107, 18, 137, 107, 0, 133, 114, 117, 99, 116, 105, 111, 110,
-  0, 6, 0, 133, 114, 117, 99, 116, 105, 111, 110, 0, 71, 155, 107, 12, 164, 107,
-  0, 4, 0, 131, 105, 116, 105, 111, 110, 0, 7, 17, 18, 6, 0, 132, 116, 105, 111,
-  110, 0, 83, 185, 107, 21, 194, 107, 23, 213, 107, 0, 8, 21, 0, 129, 116, 105,
-  111, 110, 0, 18, 16, 8, 16, 18, 6, 0, 136, 109, 101, 109, 111, 114, 97, 116,
-  105, 111, 110, 0, 8, 0, 79, 222, 107, 19, 232, 107, 0, 19, 16, 18, 6, 0, 132,
-  105, 111, 110, 0, 132, 105, 116, 105, 111, 110, 0, 69, 255, 107, 8, 33, 108,
-  17, 45, 108, 22, 76, 108, 23, 126, 108, 0, 68, 6, 108, 12, 20, 108, 0, 11, 18,
-  21, 19, 0, 134, 105, 98, 105, 116, 105, 111, 110, 0, 27, 8, 0, 134, 104, 105,
-  98, 105, 116, 105, 111, 110, 0, 19, 8, 21, 0, 132, 116, 105, 116, 105, 111,
-  110, 0, 76, 52, 108, 24, 63, 108, 0, 25, 12, 7, 0, 132, 97, 116, 105, 111,
-  110, 0, 16, 4, 0, 134, 109, 117, 110, 105, 116, 105, 111, 110, 0, 76, 86, 108,
-  18, 102, 108, 22, 116, 108, 0, 24, 20, 4, 0, 136, 99, 113, 117, 105, 115, 105,
-  116, 105, 111, 110, 0, 19, 18, 44, 0, 134, 112, 111, 115, 105, 116, 105, 111,
-  110, 0, 18, 19, 0, 133, 105, 116, 105, 111, 110, 0, 76, 133, 108, 19, 172,
-  108, 0, 71, 143, 108, 19, 151, 108, 22, 163, 108, 0, 4, 21, 23, 0, 131, 111,
-  110, 0, 8, 21, 0, 134, 101, 116, 105, 116, 105, 111, 110, 0, 18, 19, 19, 18,
-  0, 131, 111, 110, 0, 8, 21, 0, 133, 101, 116, 105, 116, 105, 111, 110, 0, 4,
-  8, 21, 0, 133, 108, 97, 116, 105, 111, 110, 0, 21, 18, 9, 17, 12, 0, 131, 97,
-  116, 105, 111, 110, 0, 68, 225, 108, 6, 3, 109, 8, 14, 109, 12, 39, 109, 24,
-  50, 109, 0, 76, 232, 108, 22, 246, 108, 0, 7, 21, 18, 18, 6, 0, 133, 110, 97,
-  116, 105, 111, 110, 0, 17, 8, 19, 16, 18, 6, 0, 132, 116, 105, 111, 110, 0,
-  24, 9, 0, 133, 110, 99, 116, 105, 111, 110, 0, 80, 21, 109, 23, 30, 109, 0,
-  12, 7, 0, 131, 115, 105, 111, 110, 0, 27, 8, 0, 131, 115, 105, 111, 110, 0, 9,
-  8, 7, 0, 131, 105, 116, 105, 111, 110, 0, 9, 0, 131, 99, 116, 105, 111, 110,
-  0, 16, 18, 19, 0, 134, 114, 111, 109, 111, 116, 105, 111, 110, 0, 68, 80, 109,
-  8, 92, 109, 0, 19, 8, 21, 19, 0, 131, 97, 116, 105, 111, 110, 0, 25, 17, 18,
-  6, 0, 131, 115, 105, 111, 110, 0, 76, 110, 109, 18, 123, 109, 0, 17, 4, 10,
-  21, 18, 0, 131, 97, 116, 105, 111, 110, 0, 19, 0, 131, 105, 116, 105, 111,
-  110, 0, 69, 145, 109, 6, 161, 109, 15, 175, 109, 23, 200, 109, 0, 24, 21, 23,
-  22, 12, 7, 0, 134, 105, 98, 117, 116, 105, 111, 110, 0, 8, 6, 27, 8, 0, 135,
-  101, 99, 117, 116, 105, 111, 110, 0, 79, 182, 109, 18, 190, 109, 0, 12, 0,
-  131, 115, 105, 111, 110, 0, 19, 0, 132, 108, 117, 116, 105, 111, 110, 0, 12,
-  0, 86, 209, 109, 23, 240, 109, 0, 17, 0, 76, 218, 109, 18, 228, 109, 0, 134,
-  116, 105, 116, 117, 116, 105, 111, 110, 0, 6, 0, 134, 116, 105, 116, 117, 116,
-  105, 111, 110, 0, 22, 18, 6, 0, 136, 110, 115, 116, 105, 116, 117, 116, 105,
-  111, 110, 0, 12, 17, 4, 10, 21, 18, 0, 131, 97, 116, 105, 111, 110, 0, 23, 12,
-  23, 22, 17, 18, 6, 0, 130, 116, 105, 111, 110, 0, 15, 12, 16, 0, 129, 105,
-  111, 110, 0, 72, 44, 110, 18, 59, 110, 0, 17, 18, 16, 18, 17, 8, 11, 19, 0,
-  133, 101, 110, 111, 110, 0, 16, 18, 17, 8, 11, 19, 0, 131, 101, 110, 111, 110,
-  0, 71, 79, 110, 18, 95, 110, 0, 8, 11, 18, 23, 6, 18, 0, 134, 97, 104, 101,
-  100, 114, 111, 110, 0, 16, 12, 27, 18, 0, 133, 121, 109, 111, 114, 111, 110,
-  0, 68, 115, 110, 12, 124, 110, 0, 12, 15, 0, 130, 105, 115, 111, 110, 0, 68,
-  140, 110, 6, 150, 110, 17, 158, 110, 21, 169, 110, 25, 178, 110, 0, 6, 6, 18,
-  0, 131, 115, 105, 111, 110, 0, 8, 7, 0, 129, 105, 111, 110, 0, 21, 4, 10, 0,
-  132, 114, 105, 115, 111, 110, 0, 8, 25, 0, 131, 115, 105, 111, 110, 0, 12, 7,
-  0, 129, 105, 111, 110, 0, 68, 199, 110, 6, 245, 110, 12, 0, 111, 19, 43, 111,
-  0, 79, 206, 110, 17, 235, 110, 0, 72, 213, 110, 24, 225, 110, 0, 14, 22, 18,
-  27, 8, 0, 131, 101, 116, 111, 110, 0, 6, 21, 12, 6, 0, 129, 105, 111, 110, 0,
-  12, 16, 18, 7, 0, 129, 105, 111, 110, 0, 8, 15, 15, 18, 6, 0, 129, 105, 111,
-  110, 0, 68, 10, 111, 6, 23, 111, 17, 33, 111, 0, 6, 12, 15, 19, 19, 4, 0, 131,
-  116, 105, 111, 110, 0, 4, 21, 9, 0, 131, 116, 105, 111, 110, 0, 12, 9, 8, 7,
-  0, 129, 105, 111, 110, 0, 12, 21, 6, 22, 8, 7, 0, 129, 105, 111, 110, 0, 23,
-  44, 0, 130, 111, 119, 110, 0, 19, 11, 4, 0, 132, 104, 97, 112, 112, 101, 110,
-  0, 72, 82, 111, 23, 166, 111, 0, 75, 92, 111, 22, 137, 111, 23, 147, 111, 0,
-  85, 99, 111, 23, 109, 111, 0, 18, 17, 0, 131, 116, 104, 101, 114, 110, 0, 82,
-  116, 111, 21, 126, 111, 0, 17, 0, 132, 114, 116, 104, 101, 114, 110, 0, 24,
-  18, 22, 0, 133, 116, 104, 101, 114, 110, 0, 17, 18, 6, 0, 131, 99, 101, 114,
-  110, 0, 22, 4, 8, 21, 8, 11, 23, 21, 18, 17, 0, 135, 97, 115, 116, 101, 114,
-  110, 0, 24, 8, 21, 0, 131, 116, 117, 114, 110, 0, 74, 186, 111, 12, 195, 111,
-  18, 219, 111, 0, 12, 11, 23, 0, 130, 110, 103, 115, 0, 17, 4, 12, 21, 4, 23,
-  12, 5, 12, 15, 0, 137, 101, 114, 116, 97, 114, 105, 97, 110, 105, 115, 109, 0,
-  12, 22, 12, 25, 18, 21, 19, 0, 129, 110, 0, 4, 23, 22, 17, 18, 6, 0, 129, 110,
-  116, 0, 85, 248, 111, 23, 1, 112, 0, 23, 8, 21, 0, 130, 117, 114, 110, 0, 8,
-  21, 0, 128, 114, 110, 0, 18, 17, 14, 8, 21, 0, 132, 110, 111, 119, 110, 0, 17,
-  18, 7, 24, 8, 22, 19, 0, 128, 109, 0, 71, 50, 112, 8, 101, 112, 12, 110, 112,
-  18, 126, 112, 19, 135, 112, 26, 142, 112, 0, 68, 60, 112, 8, 79, 112, 17, 89,
-  112, 0, 17, 18, 12, 6, 12, 9, 9, 4, 0, 136, 105, 99, 105, 111, 110, 97, 100,
-  111, 0, 24, 22, 19, 0, 131, 101, 117, 100, 111, 0, 4, 16, 18, 6, 0, 131, 109,
-  97, 110, 100, 111, 0, 25, 15, 44, 0, 130, 111, 118, 101, 0, 21, 4, 22, 22, 8,
-  21, 19, 16, 12, 0, 132, 97, 114, 105, 111, 0, 23, 4, 23, 0, 129, 116, 111,
-  111, 0, 26, 23, 44, 0, 129, 111, 0, 78, 152, 112, 15, 160, 112, 21, 168, 112,
-  0, 17, 0, 131, 107, 110, 111, 119, 0, 15, 18, 9, 0, 129, 111, 119, 0, 10, 0,
-  129, 111, 119, 0, 76, 187, 112, 18, 252, 112, 22, 7, 113, 24, 17, 113, 0, 11,
-  22, 0, 72, 200, 112, 17, 218, 112, 21, 234, 112, 0, 15, 23, 23, 4, 6, 0, 137,
-  98, 97, 116, 116, 108, 101, 115, 104, 105, 112, 0, 19, 18, 12, 23, 4, 15, 8,
-  21, 0, 133, 110, 115, 104, 105, 112, 0, 8, 25, 12, 6, 8, 21, 0, 135, 101, 105,
-  118, 101, 114, 115, 104, 105, 112, 0, 12, 23, 14, 22, 8, 7, 0, 130, 111, 112,
-  0, 4, 11, 21, 8, 19, 0, 129, 112, 115, 0, 18, 18, 15, 0, 129, 107, 117, 112,
-  0, 68, 60, 113, 8, 135, 114, 11, 45, 121, 12, 73, 121, 15, 133, 121, 18, 147,
-  121, 21, 133, 123, 22, 144, 123, 23, 152, 123, 24, 164, 123, 28, 35, 124, 0,
-  72, 79, 113, 9, 147, 113, 12, 156, 113, 15, 183, 113, 24, 115, 114, 28, 126,
-  114, 0, 79, 89, 113, 19, 100, 113, 28, 134, 113, 0, 24, 6, 24, 17, 0, 132,
-  108, 101, 97, 114, 0, 68, 107, 113, 19, 120, 113, 0, 22, 22, 12, 7, 0, 133,
-  97, 112, 112, 101, 97, 114, 0, 4, 22, 22, 12, 7, 0, 134, 97, 112, 112, 101,
-  97, 114, 0, 23, 11, 10, 12, 15, 0, 131, 32, 121, 101, 97, 114, 0, 22, 4, 0,
-  130, 32, 102, 97, 114, 0, 15, 0, 76, 165, 113, 15, 173, 113, 0, 16, 12, 22, 0,
-  130, 97, 114, 0, 12, 16, 4, 9, 0, 131, 105, 97, 114, 0, 70, 196, 113, 12, 212,
-  113, 15, 4, 114, 24, 60, 114, 0, 24, 23, 12, 21, 4, 19, 0, 134, 116, 105, 99,
-  117, 108, 97, 114, 0, 80, 219, 113, 19, 229, 113, 0, 16, 12, 22, 0, 132, 105,
-  108, 97, 114, 0, 21, 8, 23, 0, 68, 240, 113, 23, 247, 113, 0, 6, 0, 129, 108,
-  97, 114, 0, 4, 6, 0, 135, 101, 114, 112, 105, 108, 108, 97, 114, 0, 12, 19, 0,
-  68, 17, 114, 8, 31, 114, 21, 44, 114, 0, 23, 4, 6, 0, 134, 101, 114, 112, 105,
-  108, 108, 97, 114, 0, 23, 4, 6, 0, 133, 114, 112, 105, 108, 108, 97, 114, 0,
-  8, 23, 23, 4, 6, 0, 136, 101, 114, 112, 105, 108, 108, 97, 114, 0, 6, 0, 76,
-  69, 114, 24, 107, 114, 0, 71, 76, 114, 23, 94, 114, 0, 17, 12, 19, 21, 8, 19,
-  0, 136, 101, 110, 100, 105, 99, 117, 108, 97, 114, 0, 4, 19, 0, 134, 114, 116,
-  105, 99, 117, 108, 97, 114, 0, 17, 0, 131, 108, 101, 97, 114, 0, 15, 10, 8,
-  21, 0, 131, 117, 108, 97, 114, 0, 8, 44, 0, 131, 121, 101, 97, 114, 0, 68,
-  187, 114, 5, 218, 114, 7, 19, 115, 8, 166, 115, 10, 8, 116, 11, 81, 116, 12,
-  14, 118, 15, 93, 118, 16, 153, 118, 17, 180, 118, 18, 72, 119, 19, 94, 119,
-  21, 103, 119, 22, 145, 119, 23, 226, 119, 24, 219, 120, 25, 229, 120, 0, 79,
-  197, 114, 26, 204, 114, 28, 211, 114, 0, 6, 0, 130, 101, 97, 114, 0, 22, 0,
-  130, 101, 97, 114, 0, 44, 0, 130, 101, 97, 114, 0, 68, 228, 114, 8, 238, 114,
-  16, 3, 115, 0, 15, 4, 6, 0, 131, 105, 98, 101, 114, 0, 16, 8, 0, 80, 248, 114,
-  21, 253, 114, 0, 131, 98, 101, 114, 0, 130, 109, 98, 101, 114, 0, 21, 8, 25,
-  18, 17, 0, 136, 78, 111, 118, 101, 109, 98, 101, 114, 0, 76, 35, 115, 15, 64,
-  115, 17, 82, 115, 21, 144, 115, 24, 158, 115, 0, 70, 42, 115, 7, 53, 115, 0,
-  17, 18, 6, 0, 132, 115, 105, 100, 101, 114, 0, 22, 17, 18, 6, 0, 132, 105,
-  100, 101, 114, 0, 12, 24, 5, 7, 28, 7, 18, 5, 0, 135, 98, 117, 105, 108, 100,
-  101, 114, 0, 68, 92, 115, 8, 120, 115, 12, 131, 115, 0, 79, 99, 115, 16, 109,
-  115, 0, 4, 6, 0, 132, 101, 110, 100, 97, 114, 0, 18, 6, 0, 132, 109, 97, 110,
-  100, 101, 114, 0, 15, 4, 6, 0, 132, 97, 110, 100, 97, 114, 0, 15, 6, 28, 6, 0,
-  134, 108, 105, 110, 100, 101, 114, 0, 18, 22, 8, 7, 0, 134, 105, 115, 111,
-  114, 100, 101, 114, 0, 16, 0, 130, 114, 100, 101, 114, 0, 81, 176, 115, 21,
-  221, 115, 23, 230, 115, 0, 72, 183, 115, 18, 210, 115, 0, 74, 190, 115, 12,
-  200, 115, 0, 17, 8, 0, 132, 105, 110, 101, 101, 114, 0, 10, 17, 8, 0, 132,
-  110, 101, 101, 114, 0, 17, 12, 19, 0, 133, 111, 110, 101, 101, 114, 0, 21, 4,
-  6, 0, 131, 101, 101, 114, 0, 17, 0, 82, 239, 115, 24, 251, 115, 0, 15, 18, 25,
-  0, 133, 117, 110, 116, 101, 101, 114, 0, 18, 15, 18, 25, 0, 134, 117, 110,
-  116, 101, 101, 114, 0, 71, 21, 116, 12, 32, 116, 17, 39, 116, 22, 70, 116, 0,
-  8, 6, 18, 21, 19, 0, 130, 117, 114, 101, 0, 11, 0, 129, 104, 101, 114, 0, 68,
-  46, 116, 8, 58, 116, 0, 22, 22, 8, 16, 0, 132, 101, 110, 103, 101, 114, 0, 22,
-  4, 19, 0, 132, 115, 101, 110, 103, 101, 114, 0, 12, 15, 5, 24, 19, 0, 130,
-  104, 101, 114, 0, 68, 106, 116, 6, 118, 116, 10, 130, 116, 11, 141, 116, 12,
-  152, 116, 19, 165, 116, 22, 223, 116, 23, 143, 117, 0, 12, 15, 5, 24, 19, 0,
-  131, 115, 104, 101, 114, 0, 12, 15, 5, 24, 19, 0, 131, 115, 104, 101, 114, 0,
-  12, 8, 11, 0, 133, 105, 103, 104, 101, 114, 0, 22, 12, 15, 5, 24, 19, 0, 130,
-  101, 114, 0, 22, 15, 5, 24, 19, 0, 132, 105, 115, 104, 101, 114, 0, 68, 175,
-  116, 18, 194, 116, 22, 210, 116, 0, 21, 10, 18, 11, 23, 21, 4, 6, 0, 136, 111,
-  103, 114, 97, 112, 104, 101, 114, 0, 22, 12, 15, 12, 11, 19, 0, 134, 111, 115,
-  111, 112, 104, 101, 114, 0, 18, 15, 12, 11, 19, 0, 131, 111, 112, 104, 101,
-  114, 0, 76, 236, 116, 15, 107, 117, 22, 120, 117, 24, 131, 117, 0, 69, 243,
-  116, 15, 254, 116, 0, 24, 19, 0, 132, 108, 105, 115, 104, 101, 114, 0, 69, 11,
-  117, 15, 56, 117, 19, 67, 117, 24, 79, 117, 0, 76, 21, 117, 19, 33, 117, 24,
-  43, 117, 0, 19, 0, 135, 117, 98, 108, 105, 115, 104, 101, 114, 0, 134, 117,
-  98, 108, 105, 115, 104, 101, 114, 0, 18, 0, 136, 112, 117, 98, 108, 105, 115,
-  104, 101, 114, 0, 5, 24, 19, 0, 133, 105, 115, 104, 101, 114, 0, 24, 19, 0,
-  134, 98, 108, 105, 115, 104, 101, 114, 0, 69, 86, 117, 19, 98, 117, 0, 19, 0,
-  135, 117, 98, 108, 105, 115, 104, 101, 114, 0, 133, 98, 108, 105, 115, 104,
-  101, 114, 0, 12, 5, 24, 19, 0, 133, 108, 105, 115, 104, 101, 114, 0, 12, 15,
-  5, 24, 19, 0, 131, 104, 101, 114, 0, 15, 5, 24, 19, 0, 132, 105, 115, 104,
-  101, 114, 0, 68, 159, 117, 8, 185, 117, 15, 219, 117, 18, 228, 117, 24, 240,
-  117, 0, 8, 0, 75, 168, 117, 26, 174, 117, 0, 23, 0, 130, 101, 114, 0, 15, 15,
-  8, 5, 0, 132, 116, 104, 101, 114, 0, 74, 192, 117, 11, 208, 117, 0, 18, 23,
-  15, 15, 4, 0, 136, 116, 111, 103, 101, 116, 104, 101, 114, 0, 10, 18, 23, 0,
-  133, 101, 116, 104, 101, 114, 0, 18, 44, 0, 132, 116, 104, 101, 114, 0, 28,
-  17, 4, 0, 132, 32, 111, 116, 104, 101, 114, 0, 68, 250, 117, 9, 254, 117, 21,
-  5, 118, 0, 129, 111, 114, 0, 131, 114, 116, 104, 101, 114, 0, 24, 9, 0, 132,
-  116, 104, 101, 114, 0, 75, 27, 118, 15, 35, 118, 17, 74, 118, 21, 83, 118, 0,
-  23, 44, 0, 130, 101, 105, 114, 0, 68, 42, 118, 19, 51, 118, 0, 8, 0, 131, 114,
-  108, 105, 101, 114, 0, 16, 0, 76, 60, 118, 18, 66, 118, 0, 22, 0, 130, 101,
-  114, 0, 6, 0, 131, 105, 108, 101, 114, 0, 8, 25, 24, 18, 22, 0, 129, 114, 0,
-  23, 17, 18, 9, 0, 131, 105, 101, 114, 0, 79, 103, 118, 23, 136, 118, 24, 145,
-  118, 0, 12, 19, 0, 68, 113, 118, 21, 127, 118, 0, 23, 4, 6, 0, 134, 101, 114,
-  112, 105, 108, 108, 97, 114, 0, 8, 23, 4, 6, 0, 129, 97, 114, 0, 12, 9, 0,
-  131, 108, 116, 101, 114, 0, 19, 18, 19, 0, 129, 97, 114, 0, 80, 160, 118, 18,
-  169, 118, 0, 4, 21, 10, 44, 0, 129, 97, 114, 0, 9, 21, 8, 19, 0, 130, 114,
-  109, 101, 114, 0, 68, 202, 118, 8, 218, 118, 12, 231, 118, 17, 243, 118, 18,
-  1, 119, 21, 38, 119, 23, 47, 119, 0, 29, 12, 19, 19, 12, 15, 0, 134, 105, 122,
-  122, 97, 110, 101, 114, 0, 25, 24, 18, 10, 0, 133, 118, 101, 114, 110, 111,
-  114, 0, 10, 10, 8, 5, 0, 132, 105, 110, 110, 101, 114, 0, 24, 21, 18, 9, 0,
-  132, 101, 114, 117, 110, 110, 101, 114, 0, 12, 0, 70, 10, 119, 23, 25, 119, 0,
-  12, 23, 6, 4, 21, 19, 0, 133, 116, 105, 111, 110, 101, 114, 0, 6, 4, 21, 19,
-  0, 131, 116, 105, 111, 110, 101, 114, 0, 8, 25, 18, 10, 0, 129, 111, 114, 0,
-  76, 54, 119, 22, 63, 119, 0, 18, 19, 0, 131, 110, 116, 101, 114, 0, 12, 15, 0,
-  130, 101, 110, 101, 114, 0, 73, 79, 119, 26, 86, 119, 0, 8, 5, 0, 129, 114,
-  101, 0, 19, 0, 131, 111, 119, 101, 114, 0, 19, 18, 21, 19, 0, 130, 101, 114,
-  0, 68, 113, 119, 8, 125, 119, 18, 135, 119, 0, 24, 20, 7, 4, 8, 11, 0, 129,
-  116, 101, 114, 0, 24, 20, 17, 18, 6, 0, 129, 111, 114, 0, 19, 16, 8, 0, 131,
-  101, 114, 111, 114, 0, 75, 161, 119, 12, 173, 119, 17, 183, 119, 21, 191, 119,
-  22, 201, 119, 0, 12, 15, 5, 24, 19, 0, 131, 115, 104, 101, 114, 0, 15, 5, 24,
-  19, 0, 129, 104, 101, 114, 0, 18, 19, 22, 0, 129, 111, 114, 0, 24, 6, 8, 21,
-  19, 0, 129, 111, 114, 0, 8, 0, 70, 210, 119, 9, 218, 119, 0, 18, 21, 19, 0,
-  129, 111, 114, 0, 18, 21, 19, 0, 129, 111, 114, 0, 68, 251, 119, 6, 43, 120,
-  11, 57, 120, 12, 101, 120, 17, 125, 120, 19, 134, 120, 22, 145, 120, 24, 173,
-  120, 0, 79, 2, 120, 24, 31, 120, 0, 24, 6, 0, 68, 12, 120, 15, 24, 120, 0, 6,
-  0, 134, 108, 99, 117, 108, 97, 116, 111, 114, 0, 4, 6, 0, 129, 111, 114, 0,
-  20, 7, 4, 8, 11, 0, 130, 114, 116, 101, 114, 0, 4, 21, 11, 6, 0, 133, 97, 114,
-  97, 99, 116, 101, 114, 0, 70, 64, 120, 18, 92, 120, 0, 4, 21, 4, 0, 70, 75,
-  120, 11, 85, 120, 0, 135, 104, 97, 114, 97, 99, 116, 101, 114, 0, 6, 0, 131,
-  116, 101, 114, 0, 17, 4, 0, 131, 116, 104, 101, 114, 0, 72, 108, 120, 17, 115,
-  120, 0, 44, 0, 129, 104, 101, 114, 0, 18, 21, 9, 0, 131, 116, 105, 101, 114,
-  0, 8, 25, 17, 12, 0, 129, 111, 114, 0, 12, 21, 6, 22, 8, 7, 0, 129, 111, 114,
-  0, 68, 152, 120, 17, 163, 120, 0, 12, 7, 0, 132, 115, 97, 115, 116, 101, 114,
-  0, 4, 10, 0, 131, 103, 115, 116, 101, 114, 0, 69, 180, 120, 19, 191, 120, 0,
-  12, 21, 23, 17, 18, 6, 0, 129, 111, 114, 0, 18, 0, 70, 200, 120, 16, 208, 120,
-  0, 132, 109, 112, 117, 116, 101, 114, 0, 6, 0, 134, 111, 109, 112, 117, 116,
-  101, 114, 0, 23, 4, 16, 4, 0, 130, 101, 117, 114, 0, 72, 242, 120, 18, 253,
-  120, 24, 25, 121, 26, 36, 121, 0, 8, 21, 8, 11, 26, 0, 131, 118, 101, 114, 0,
-  70, 4, 121, 22, 15, 121, 0, 12, 7, 0, 132, 115, 99, 111, 118, 101, 114, 0, 12,
-  7, 0, 131, 99, 111, 118, 101, 114, 0, 17, 4, 16, 0, 131, 101, 117, 118, 101,
-  114, 0, 18, 11, 0, 130, 101, 118, 101, 114, 0, 8, 0, 86, 54, 121, 23, 65, 121,
-  0, 12, 15, 5, 24, 19, 0, 130, 104, 101, 114, 0, 18, 44, 0, 130, 104, 101, 114,
-  0, 68, 80, 121, 18, 120, 121, 0, 73, 87, 121, 19, 95, 121, 0, 4, 0, 130, 102,
-  97, 105, 114, 0, 72, 102, 121, 22, 109, 121, 0, 21, 19, 0, 129, 114, 101, 0,
-  12, 7, 0, 133, 101, 115, 112, 97, 105, 114, 0, 25, 8, 22, 8, 21, 0, 131, 114,
-  118, 111, 105, 114, 0, 4, 24, 6, 12, 23, 21, 4, 19, 0, 130, 108, 97, 114, 0,
-  69, 175, 121, 7, 190, 121, 11, 201, 121, 12, 231, 121, 17, 243, 121, 21, 51,
-  122, 22, 61, 122, 23, 178, 122, 29, 123, 123, 0, 11, 10, 8, 12, 17, 0, 134,
-  101, 105, 103, 104, 111, 117, 114, 0, 17, 8, 23, 17, 18, 6, 0, 129, 101, 114,
-  0, 83, 208, 121, 22, 221, 121, 0, 4, 11, 23, 8, 16, 0, 133, 97, 112, 104, 111,
-  114, 0, 12, 15, 5, 24, 19, 0, 129, 101, 114, 0, 17, 24, 12, 0, 133, 106, 117,
-  110, 105, 111, 114, 0, 68, 253, 121, 8, 14, 122, 12, 42, 122, 0, 8, 16, 4, 7,
-  22, 12, 16, 0, 134, 101, 109, 101, 97, 110, 111, 114, 0, 16, 0, 68, 23, 122,
-  8, 34, 122, 0, 7, 0, 133, 101, 109, 101, 97, 110, 111, 114, 0, 7, 0, 130, 97,
-  110, 111, 114, 0, 8, 22, 0, 131, 110, 105, 111, 114, 0, 8, 6, 21, 18, 22, 0,
-  129, 101, 114, 0, 72, 68, 122, 22, 112, 122, 0, 70, 75, 122, 9, 86, 122, 0, 8,
-  7, 8, 21, 19, 0, 129, 115, 111, 114, 0, 73, 93, 122, 18, 104, 122, 0, 18, 21,
-  19, 0, 132, 101, 115, 115, 111, 114, 0, 21, 19, 0, 129, 115, 111, 114, 0, 8,
-  0, 70, 127, 122, 7, 138, 122, 9, 154, 122, 21, 166, 122, 0, 24, 22, 0, 132,
-  99, 101, 115, 115, 111, 114, 0, 8, 6, 8, 21, 19, 0, 135, 100, 101, 99, 101,
-  115, 115, 111, 114, 0, 9, 18, 21, 19, 0, 133, 101, 115, 115, 111, 114, 0, 10,
-  4, 0, 133, 103, 114, 101, 115, 115, 111, 114, 0, 68, 185, 122, 6, 113, 123, 0,
-  76, 198, 122, 17, 212, 122, 21, 226, 122, 23, 78, 123, 0, 21, 12, 19, 22, 17,
-  18, 6, 0, 132, 97, 116, 111, 114, 0, 12, 15, 18, 19, 0, 133, 108, 105, 110,
-  97, 116, 111, 114, 0, 72, 236, 122, 10, 29, 123, 23, 41, 123, 0, 74, 246, 122,
-  17, 6, 123, 23, 17, 123, 0, 7, 12, 21, 9, 8, 21, 0, 135, 103, 101, 114, 97,
-  116, 111, 114, 0, 8, 19, 0, 132, 116, 114, 97, 116, 111, 114, 0, 17, 12, 0,
-  135, 116, 101, 114, 97, 116, 111, 114, 0, 8, 21, 10, 10, 4, 0, 132, 97, 116,
-  111, 114, 0, 72, 48, 123, 22, 62, 123, 0, 21, 8, 19, 0, 134, 112, 101, 116,
-  114, 97, 116, 111, 114, 0, 17, 12, 16, 7, 4, 0, 134, 105, 115, 116, 114, 97,
-  116, 111, 114, 0, 72, 85, 123, 12, 101, 123, 0, 21, 19, 8, 23, 17, 12, 0, 135,
-  114, 112, 114, 101, 116, 111, 114, 0, 16, 16, 12, 0, 134, 105, 116, 97, 116,
-  111, 114, 0, 4, 21, 4, 11, 6, 0, 129, 101, 114, 0, 17, 18, 19, 22, 0, 130,
-  115, 111, 114, 0, 8, 11, 22, 12, 15, 5, 24, 19, 0, 128, 0, 4, 8, 28, 0, 129,
-  114, 115, 0, 18, 4, 21, 8, 19, 18, 0, 130, 116, 111, 114, 0, 70, 174, 123, 8,
-  182, 123, 18, 199, 123, 0, 18, 44, 0, 129, 99, 117, 114, 0, 17, 8, 19, 8, 21,
-  23, 17, 8, 0, 132, 114, 101, 110, 101, 117, 114, 0, 69, 215, 123, 6, 248, 123,
-  7, 255, 123, 17, 13, 124, 25, 23, 124, 0, 68, 222, 123, 10, 238, 123, 0, 15,
-  15, 24, 17, 0, 136, 78, 117, 108, 108, 97, 114, 98, 111, 114, 0, 12, 8, 17, 0,
-  131, 104, 98, 111, 114, 0, 6, 18, 0, 130, 117, 114, 0, 17, 8, 19, 22, 0, 133,
-  108, 101, 110, 100, 111, 117, 114, 0, 24, 18, 11, 0, 132, 110, 111, 117, 114,
-  0, 8, 7, 17, 8, 0, 131, 97, 118, 111, 117, 114, 0, 72, 42, 124, 18, 49, 124,
-  0, 25, 8, 0, 129, 114, 121, 0, 23, 22, 0, 129, 114, 121, 0, 68, 111, 124, 6,
-  204, 124, 7, 159, 125, 8, 240, 125, 10, 206, 133, 11, 242, 133, 12, 13, 134,
-  15, 110, 134, 16, 176, 134, 17, 192, 134, 18, 231, 136, 19, 82, 137, 21, 94,
-  137, 22, 212, 138, 23, 169, 140, 24, 23, 142, 28, 231, 146, 29, 57, 147, 0,
-  70, 130, 124, 11, 143, 124, 12, 154, 124, 17, 163, 124, 19, 173, 124, 28, 183,
-  124, 0, 12, 23, 4, 16, 8, 11, 23, 4, 16, 0, 129, 115, 0, 19, 21, 8, 19, 0,
-  131, 104, 97, 112, 115, 0, 21, 8, 23, 12, 21, 6, 0, 128, 0, 17, 4, 17, 4, 5,
-  0, 130, 97, 115, 0, 11, 21, 8, 19, 0, 130, 97, 112, 115, 0, 71, 190, 124, 26,
-  196, 124, 0, 130, 114, 121, 97, 115, 0, 15, 4, 0, 130, 97, 121, 115, 0, 76,
-  214, 124, 17, 140, 125, 24, 151, 125, 0, 69, 233, 124, 11, 244, 124, 15, 12,
-  125, 16, 42, 125, 17, 64, 125, 23, 79, 125, 0, 24, 19, 8, 21, 0, 130, 108,
-  105, 99, 115, 0, 19, 28, 15, 10, 18, 21, 12, 8, 11, 0, 139, 105, 101, 114,
-  111, 103, 108, 121, 112, 104, 105, 99, 115, 0, 69, 19, 125, 24, 31, 125, 0,
-  19, 8, 21, 0, 132, 117, 98, 108, 105, 99, 115, 0, 19, 8, 21, 0, 131, 98, 108,
-  105, 99, 115, 0, 4, 17, 28, 7, 18, 8, 21, 4, 0, 138, 101, 114, 111, 100, 121,
-  110, 97, 109, 105, 99, 115, 0, 4, 11, 6, 16, 0, 134, 101, 99, 104, 97, 110,
-  105, 99, 115, 0, 68, 89, 125, 8, 105, 125, 22, 121, 125, 0, 16, 4, 11, 23, 4,
-  16, 0, 134, 101, 109, 97, 116, 105, 99, 115, 0, 10, 8, 15, 18, 19, 4, 0, 134,
-  111, 103, 101, 116, 105, 99, 115, 0, 12, 21, 4, 11, 6, 0, 133, 97, 99, 116,
-  101, 114, 105, 115, 116, 105, 99, 115, 0, 8, 21, 8, 9, 8, 21, 0, 128, 101,
-  115, 0, 18, 9, 0, 130, 99, 117, 115, 0, 68, 172, 125, 12, 185, 125, 17, 194,
-  125, 21, 229, 125, 0, 10, 8, 21, 0, 133, 82, 101, 103, 97, 114, 100, 115, 0,
-  9, 17, 18, 6, 0, 128, 101, 115, 0, 68, 201, 125, 24, 213, 125, 0, 7, 17, 8, 6,
-  22, 8, 7, 0, 129, 116, 115, 0, 18, 21, 14, 6, 4, 5, 0, 133, 103, 114, 111,
-  117, 110, 100, 115, 0, 18, 26, 18, 23, 0, 131, 97, 114, 100, 115, 0, 68, 51,
-  126, 5, 73, 126, 6, 102, 126, 7, 150, 126, 8, 177, 126, 9, 188, 126, 10, 213,
-  126, 11, 252, 126, 12, 28, 127, 14, 26, 131, 15, 33, 131, 16, 144, 131, 17,
-  171, 131, 18, 6, 132, 19, 31, 132, 21, 48, 132, 22, 92, 132, 23, 207, 132, 24,
-  132, 133, 25, 145, 133, 28, 180, 133, 29, 192, 133, 0, 71, 58, 126, 14, 65,
-  126, 0, 12, 0, 130, 101, 97, 115, 0, 23, 0, 131, 97, 107, 101, 115, 0, 76, 80,
-  126, 16, 92, 126, 0, 12, 21, 6, 22, 8, 7, 0, 131, 98, 101, 115, 0, 8, 22, 8,
-  21, 0, 129, 108, 101, 115, 0, 72, 109, 126, 12, 140, 126, 0, 71, 116, 126, 22,
-  125, 126, 0, 17, 12, 0, 131, 105, 99, 101, 115, 0, 8, 24, 20, 8, 22, 17, 18,
-  6, 0, 132, 110, 99, 101, 115, 0, 8, 19, 22, 0, 131, 99, 105, 101, 115, 0, 85,
-  157, 126, 24, 165, 126, 0, 4, 10, 8, 21, 0, 129, 115, 0, 15, 27, 8, 0, 132,
+  116, 105, 111, 110, 0, 76, 49, 105, 22, 64, 105, 0, 15, 12, 9, 17, 12, 0, 135,
+  116, 114, 97, 116, 105, 111, 110, 0, 81, 71, 105, 18, 87, 105, 0, 12, 16, 7,
+  4, 0, 135, 105, 115, 116, 114, 97, 116, 105, 111, 110, 0, 16, 8, 7, 0, 135,
+  110, 115, 116, 114, 97, 116, 105, 111, 110, 0, 68, 109, 105, 10, 123, 105, 0,
+  23, 22, 8, 21, 0, 135, 111, 114, 97, 116, 105, 111, 110, 0, 4, 17, 12, 0, 135,
+  117, 103, 117, 114, 97, 116, 105, 111, 110, 0, 12, 15, 4, 0, 86, 149, 105, 23,
+  166, 105, 0, 17, 4, 0, 139, 110, 97, 115, 97, 108, 105, 115, 97, 116, 105,
+  111, 110, 0, 22, 28, 21, 6, 0, 134, 108, 105, 115, 97, 116, 105, 111, 110, 0,
+  72, 197, 105, 12, 216, 105, 17, 245, 105, 18, 27, 106, 21, 77, 106, 0, 21, 19,
+  8, 23, 17, 12, 0, 136, 114, 112, 114, 101, 116, 97, 116, 105, 111, 110, 0, 79,
+  223, 105, 17, 235, 105, 0, 4, 23, 8, 21, 0, 133, 97, 116, 105, 111, 110, 0,
+  12, 0, 132, 105, 97, 116, 105, 111, 110, 0, 72, 252, 105, 12, 13, 106, 0, 16,
+  8, 10, 8, 22, 0, 137, 109, 101, 110, 116, 97, 116, 105, 111, 110, 0, 22, 22,
+  4, 22, 22, 4, 0, 133, 97, 116, 105, 111, 110, 0, 74, 37, 106, 15, 48, 106, 17,
+  61, 106, 0, 8, 17, 0, 132, 105, 97, 116, 105, 111, 110, 0, 19, 27, 8, 0, 133,
+  105, 116, 97, 116, 105, 111, 110, 0, 17, 4, 6, 0, 137, 111, 110, 110, 111,
+  116, 97, 116, 105, 111, 110, 0, 8, 22, 22, 4, 0, 132, 105, 111, 110, 0, 68,
+  94, 106, 18, 102, 106, 0, 132, 105, 97, 116, 105, 111, 110, 0, 17, 17, 8, 21,
+  0, 135, 111, 118, 97, 116, 105, 111, 110, 0, 28, 11, 19, 22, 4, 0, 132, 105,
+  97, 116, 105, 111, 110, 0, 12, 0, 75, 142, 106, 15, 169, 106, 23, 188, 106, 0,
+  19, 21, 18, 16, 18, 21, 11, 23, 17, 4, 0, 139, 112, 111, 109, 111, 114, 112,
+  104, 105, 122, 97, 116, 105, 111, 110, 0, 4, 22, 17, 4, 0, 139, 110, 97, 115,
+  97, 108, 105, 122, 97, 116, 105, 111, 110, 0, 12, 16, 12, 15, 6, 6, 4, 0, 136,
+  97, 116, 105, 122, 97, 116, 105, 111, 110, 0, 76, 214, 106, 21, 225, 106, 0,
+  11, 27, 8, 0, 131, 105, 116, 105, 111, 110, 0, 18, 22, 5, 4, 0, 132, 112, 116,
+  105, 111, 110, 0, 68, 0, 107, 8, 23, 107, 12, 89, 107, 15, 153, 107, 17, 163,
+  107, 24, 180, 107, 0, 9, 22, 12, 23, 4, 22, 12, 7, 0, 138, 115, 97, 116, 105,
+  115, 102, 97, 99, 116, 105, 111, 110, 0, 81, 36, 107, 21, 48, 107, 23, 66,
+  107, 27, 80, 107, 0, 18, 6, 0, 133, 110, 101, 99, 116, 105, 111, 110, 0, 21,
+  24, 22, 22, 8, 21, 0, 137, 117, 114, 114, 101, 99, 116, 105, 111, 110, 0, 8,
+  21, 19, 0, 135, 111, 116, 101, 99, 116, 105, 111, 110, 0, 8, 0, 131, 117, 116,
+  105, 111, 110, 0, 71, 99, 107, 9, 111, 107, 23, 123, 107, 0, 4, 21, 23, 27, 8,
+  0, 132, 116, 105, 111, 110, 0, 12, 6, 24, 21, 6, 0, 132, 120, 105, 111, 110,
+  0, 22, 12, 0, 71, 133, 107, 21, 141, 107, 0, 132, 110, 99, 116, 105, 111, 110,
+  0, 24, 13, 0, 134, 100, 105, 99, 116, 105, 111, 110, 0, 8, 0, 132, 101, 99,
+  116, 105, 111, 110, 0, 12, 23, 6, 22, 12, 7, 0, 136, 116, 105, 110, 99, 116,
+  105, 111, 110, 0, 77, 190, 107, 21, 202, 107, 23, 39, 108, 0, 17, 18, 6, 0,
+  132, 110, 99, 116, 105, 111, 110, 0, 23, 0, 70, 217, 107, 17, 231, 107, 22,
+  245, 107, 23, 25, 108, 0, 22, 8, 7, 0, 136, 116, 114, 117, 99, 116, 105, 111,
+  110, 0, 18, 6, 0, 135, 115, 116, 114, 117, 99, 116, 105, 111, 110, 0, 76, 252,
+  107, 23, 10, 108, 0, 7, 0, 137, 101, 115, 116, 114, 117, 99, 116, 105, 111,
+  110, 0, 17, 18, 6, 0, 137, 115, 116, 114, 117, 99, 116, 105, 111, 110, 0, 22,
+  17, 18, 6, 0, 135, 114, 117, 99, 116, 105, 111, 110, 0, 22, 17, 0, 76, 49,
+  108, 18, 58, 108, 0, 133, 114, 117, 99, 116, 105, 111, 110, 0, 6, 0, 133, 114,
+  117, 99, 116, 105, 111, 110, 0, 71, 76, 108, 12, 85, 108, 0, 4, 0, 131, 105,
+  116, 105, 111, 110, 0, 7, 17, 18, 6, 0, 132, 116, 105, 111, 110, 0, 83, 106,
+  108, 21, 115, 108, 23, 134, 108, 0, 8, 21, 0, 129, 116, 105, 111, 110, 0, 18,
+  16, 8, 16, 18, 6, 0, 136, 109, 101, 109, 111, 114, 97, 116, 105, 111, 110, 0,
+  8, 0, 79, 143, 108, 19, 153, 108, 0, 19, 16, 18, 6, 0, 132, 105, 111, 110, 0,
+  132, 105, 116, 105, 111, 110, 0, 69, 176, 108, 8, 210, 108, 17, 222, 108, 22,
+  253, 108, 23, 47, 109, 0, 68, 183, 108, 12, 197, 108, 0, 11, 18, 21, 19, 0,
+  134, 105, 98, 105, 116, 105, 111, 110, 0, 27, 8, 0, 134, 104, 105, 98, 105,
+  116, 105, 111, 110, 0, 19, 8, 21, 0, 132, 116, 105, 116, 105, 111, 110, 0, 76,
+  229, 108, 24, 240, 108, 0, 25, 12, 7, 0, 132, 97, 116, 105, 111, 110, 0, 16,
+  4, 0, 134, 109, 117, 110, 105, 116, 105, 111, 110, 0, 76, 7, 109, 18, 23, 109,
+  22, 37, 109, 0, 24, 20, 4, 0, 136, 99, 113, 117, 105, 115, 105, 116, 105, 111,
+  110, 0, 19, 18, 44, 0, 134, 112, 111, 115, 105, 116, 105, 111, 110, 0, 18, 19,
+  0, 133, 105, 116, 105, 111, 110, 0, 76, 54, 109, 19, 93, 109, 0, 71, 64, 109,
+  19, 72, 109, 22, 84, 109, 0, 4, 21, 23, 0, 131, 111, 110, 0, 8, 21, 0, 134,
+  101, 116, 105, 116, 105, 111, 110, 0, 18, 19, 19, 18, 0, 131, 111, 110, 0, 8,
+  21, 0, 133, 101, 116, 105, 116, 105, 111, 110, 0, 4, 8, 21, 0, 133, 108, 97,
+  116, 105, 111, 110, 0, 21, 18, 9, 17, 12, 0, 131, 97, 116, 105, 111, 110, 0,
+  68, 146, 109, 6, 180, 109, 8, 191, 109, 12, 216, 109, 24, 227, 109, 0, 76,
+  153, 109, 22, 167, 109, 0, 7, 21, 18, 18, 6, 0, 133, 110, 97, 116, 105, 111,
+  110, 0, 17, 8, 19, 16, 18, 6, 0, 132, 116, 105, 111, 110, 0, 24, 9, 0, 133,
+  110, 99, 116, 105, 111, 110, 0, 80, 198, 109, 23, 207, 109, 0, 12, 7, 0, 131,
+  115, 105, 111, 110, 0, 27, 8, 0, 131, 115, 105, 111, 110, 0, 9, 8, 7, 0, 131,
+  105, 116, 105, 111, 110, 0, 9, 0, 131, 99, 116, 105, 111, 110, 0, 16, 18, 19,
+  0, 134, 114, 111, 109, 111, 116, 105, 111, 110, 0, 68, 1, 110, 8, 13, 110, 0,
+  19, 8, 21, 19, 0, 131, 97, 116, 105, 111, 110, 0, 25, 17, 18, 6, 0, 131, 115,
+  105, 111, 110, 0, 76, 31, 110, 18, 44, 110, 0, 17, 4, 10, 21, 18, 0, 131, 97,
+  116, 105, 111, 110, 0, 19, 0, 131, 105, 116, 105, 111, 110, 0, 69, 66, 110, 6,
+  82, 110, 15, 96, 110, 23, 121, 110, 0, 24, 21, 23, 22, 12, 7, 0, 134, 105, 98,
+  117, 116, 105, 111, 110, 0, 8, 6, 27, 8, 0, 135, 101, 99, 117, 116, 105, 111,
+  110, 0, 79, 103, 110, 18, 111, 110, 0, 12, 0, 131, 115, 105, 111, 110, 0, 19,
+  0, 132, 108, 117, 116, 105, 111, 110, 0, 12, 0, 86, 130, 110, 23, 161, 110, 0,
+  17, 0, 76, 139, 110, 18, 149, 110, 0, 134, 116, 105, 116, 117, 116, 105, 111,
+  110, 0, 6, 0, 134, 116, 105, 116, 117, 116, 105, 111, 110, 0, 22, 18, 6, 0,
+  136, 110, 115, 116, 105, 116, 117, 116, 105, 111, 110, 0, 12, 17, 4, 10, 21,
+  18, 0, 131, 97, 116, 105, 111, 110, 0, 23, 12, 23, 22, 17, 18, 6, 0, 130, 116,
+  105, 111, 110, 0, 15, 12, 16, 0, 129, 105, 111, 110, 0, 72, 221, 110, 18, 236,
+  110, 0, 17, 18, 16, 18, 17, 8, 11, 19, 0, 133, 101, 110, 111, 110, 0, 16, 18,
+  17, 8, 11, 19, 0, 131, 101, 110, 111, 110, 0, 71, 0, 111, 18, 16, 111, 0, 8,
+  11, 18, 23, 6, 18, 0, 134, 97, 104, 101, 100, 114, 111, 110, 0, 16, 12, 27,
+  18, 0, 133, 121, 109, 111, 114, 111, 110, 0, 68, 36, 111, 12, 45, 111, 0, 12,
+  15, 0, 130, 105, 115, 111, 110, 0, 68, 61, 111, 6, 71, 111, 17, 79, 111, 21,
+  90, 111, 25, 99, 111, 0, 6, 6, 18, 0, 131, 115, 105, 111, 110, 0, 8, 7, 0,
+  129, 105, 111, 110, 0, 21, 4, 10, 0, 132, 114, 105, 115, 111, 110, 0, 8, 25,
+  0, 131, 115, 105, 111, 110, 0, 12, 7, 0, 129, 105, 111, 110, 0, 68, 120, 111,
+  6, 166, 111, 12, 177, 111, 19, 220, 111, 0, 79, 127, 111, 17, 156, 111, 0, 72,
+  134, 111, 24, 146, 111, 0, 14, 22, 18, 27, 8, 0, 131, 101, 116, 111, 110, 0,
+  6, 21, 12, 6, 0, 129, 105, 111, 110, 0, 12, 16, 18, 7, 0, 129, 105, 111, 110,
+  0, 8, 15, 15, 18, 6, 0, 129, 105, 111, 110, 0, 68, 187, 111, 6, 200, 111, 17,
+  210, 111, 0, 6, 12, 15, 19, 19, 4, 0, 131, 116, 105, 111, 110, 0, 4, 21, 9, 0,
+  131, 116, 105, 111, 110, 0, 12, 9, 8, 7, 0, 129, 105, 111, 110, 0, 12, 21, 6,
+  22, 8, 7, 0, 129, 105, 111, 110, 0, 23, 44, 0, 130, 111, 119, 110, 0, 19, 11,
+  4, 0, 132, 104, 97, 112, 112, 101, 110, 0, 72, 3, 112, 23, 87, 112, 0, 75, 13,
+  112, 22, 58, 112, 23, 68, 112, 0, 85, 20, 112, 23, 30, 112, 0, 18, 17, 0, 131,
+  116, 104, 101, 114, 110, 0, 82, 37, 112, 21, 47, 112, 0, 17, 0, 132, 114, 116,
+  104, 101, 114, 110, 0, 24, 18, 22, 0, 133, 116, 104, 101, 114, 110, 0, 17, 18,
+  6, 0, 131, 99, 101, 114, 110, 0, 22, 4, 8, 21, 8, 11, 23, 21, 18, 17, 0, 135,
+  97, 115, 116, 101, 114, 110, 0, 24, 8, 21, 0, 131, 116, 117, 114, 110, 0, 74,
+  107, 112, 12, 116, 112, 18, 140, 112, 0, 12, 11, 23, 0, 130, 110, 103, 115, 0,
+  17, 4, 12, 21, 4, 23, 12, 5, 12, 15, 0, 137, 101, 114, 116, 97, 114, 105, 97,
+  110, 105, 115, 109, 0, 12, 22, 12, 25, 18, 21, 19, 0, 129, 110, 0, 4, 23, 22,
+  17, 18, 6, 0, 129, 110, 116, 0, 85, 169, 112, 23, 178, 112, 0, 23, 8, 21, 0,
+  130, 117, 114, 110, 0, 8, 21, 0, 128, 114, 110, 0, 18, 17, 14, 8, 21, 0, 132,
+  110, 111, 119, 110, 0, 17, 18, 7, 24, 8, 22, 19, 0, 128, 109, 0, 71, 227, 112,
+  8, 22, 113, 12, 31, 113, 18, 47, 113, 19, 56, 113, 26, 63, 113, 0, 68, 237,
+  112, 8, 0, 113, 17, 10, 113, 0, 17, 18, 12, 6, 12, 9, 9, 4, 0, 136, 105, 99,
+  105, 111, 110, 97, 100, 111, 0, 24, 22, 19, 0, 131, 101, 117, 100, 111, 0, 4,
+  16, 18, 6, 0, 131, 109, 97, 110, 100, 111, 0, 25, 15, 44, 0, 130, 111, 118,
+  101, 0, 21, 4, 22, 22, 8, 21, 19, 16, 12, 0, 132, 97, 114, 105, 111, 0, 23, 4,
+  23, 0, 129, 116, 111, 111, 0, 26, 23, 44, 0, 129, 111, 0, 78, 73, 113, 15, 81,
+  113, 21, 89, 113, 0, 17, 0, 131, 107, 110, 111, 119, 0, 15, 18, 9, 0, 129,
+  111, 119, 0, 10, 0, 129, 111, 119, 0, 76, 108, 113, 18, 173, 113, 22, 184,
+  113, 24, 194, 113, 0, 11, 22, 0, 72, 121, 113, 17, 139, 113, 21, 155, 113, 0,
+  15, 23, 23, 4, 6, 0, 137, 98, 97, 116, 116, 108, 101, 115, 104, 105, 112, 0,
+  19, 18, 12, 23, 4, 15, 8, 21, 0, 133, 110, 115, 104, 105, 112, 0, 8, 25, 12,
+  6, 8, 21, 0, 135, 101, 105, 118, 101, 114, 115, 104, 105, 112, 0, 12, 23, 14,
+  22, 8, 7, 0, 130, 111, 112, 0, 4, 11, 21, 8, 19, 0, 129, 112, 115, 0, 18, 18,
+  15, 0, 129, 107, 117, 112, 0, 68, 237, 113, 8, 56, 115, 11, 222, 121, 12, 250,
+  121, 15, 54, 122, 18, 68, 122, 21, 54, 124, 22, 65, 124, 23, 73, 124, 24, 85,
+  124, 28, 212, 124, 0, 72, 0, 114, 9, 68, 114, 12, 77, 114, 15, 104, 114, 24,
+  36, 115, 28, 47, 115, 0, 79, 10, 114, 19, 21, 114, 28, 55, 114, 0, 24, 6, 24,
+  17, 0, 132, 108, 101, 97, 114, 0, 68, 28, 114, 19, 41, 114, 0, 22, 22, 12, 7,
+  0, 133, 97, 112, 112, 101, 97, 114, 0, 4, 22, 22, 12, 7, 0, 134, 97, 112, 112,
+  101, 97, 114, 0, 23, 11, 10, 12, 15, 0, 131, 32, 121, 101, 97, 114, 0, 22, 4,
+  0, 130, 32, 102, 97, 114, 0, 15, 0, 76, 86, 114, 15, 94, 114, 0, 16, 12, 22,
+  0, 130, 97, 114, 0, 12, 16, 4, 9, 0, 131, 105, 97, 114, 0, 70, 117, 114, 12,
+  133, 114, 15, 181, 114, 24, 237, 114, 0, 24, 23, 12, 21, 4, 19, 0, 134, 116,
+  105, 99, 117, 108, 97, 114, 0, 80, 140, 114, 19, 150, 114, 0, 16, 12, 22, 0,
+  132, 105, 108, 97, 114, 0, 21, 8, 23, 0, 68, 161, 114, 23, 168, 114, 0, 6, 0,
+  129, 108, 97, 114, 0, 4, 6, 0, 135, 101, 114, 112, 105, 108, 108, 97, 114, 0,
+  12, 19, 0, 68, 194, 114, 8, 208, 114, 21, 221, 114, 0, 23, 4, 6, 0, 134, 101,
+  114, 112, 105, 108, 108, 97, 114, 0, 23, 4, 6, 0, 133, 114, 112, 105, 108,
+  108, 97, 114, 0, 8, 23, 23, 4, 6, 0, 136, 101, 114, 112, 105, 108, 108, 97,
+  114, 0, 6, 0, 76, 246, 114, 24, 28, 115, 0, 71, 253, 114, 23, 15, 115, 0, 17,
+  12, 19, 21, 8, 19, 0, 136, 101, 110, 100, 105, 99, 117, 108, 97, 114, 0, 4,
+  19, 0, 134, 114, 116, 105, 99, 117, 108, 97, 114, 0, 17, 0, 131, 108, 101, 97,
+  114, 0, 15, 10, 8, 21, 0, 131, 117, 108, 97, 114, 0, 8, 44, 0, 131, 121, 101,
+  97, 114, 0, 68, 108, 115, 5, 139, 115, 7, 196, 115, 8, 87, 116, 10, 185, 116,
+  11, 2, 117, 12, 191, 118, 15, 14, 119, 16, 74, 119, 17, 101, 119, 18, 249,
+  119, 19, 15, 120, 21, 24, 120, 22, 66, 120, 23, 147, 120, 24, 140, 121, 25,
+  150, 121, 0, 79, 118, 115, 26, 125, 115, 28, 132, 115, 0, 6, 0, 130, 101, 97,
+  114, 0, 22, 0, 130, 101, 97, 114, 0, 44, 0, 130, 101, 97, 114, 0, 68, 149,
+  115, 8, 159, 115, 16, 180, 115, 0, 15, 4, 6, 0, 131, 105, 98, 101, 114, 0, 16,
+  8, 0, 80, 169, 115, 21, 174, 115, 0, 131, 98, 101, 114, 0, 130, 109, 98, 101,
+  114, 0, 21, 8, 25, 18, 17, 0, 136, 78, 111, 118, 101, 109, 98, 101, 114, 0,
+  76, 212, 115, 15, 241, 115, 17, 3, 116, 21, 65, 116, 24, 79, 116, 0, 70, 219,
+  115, 7, 230, 115, 0, 17, 18, 6, 0, 132, 115, 105, 100, 101, 114, 0, 22, 17,
+  18, 6, 0, 132, 105, 100, 101, 114, 0, 12, 24, 5, 7, 28, 7, 18, 5, 0, 135, 98,
+  117, 105, 108, 100, 101, 114, 0, 68, 13, 116, 8, 41, 116, 12, 52, 116, 0, 79,
+  20, 116, 16, 30, 116, 0, 4, 6, 0, 132, 101, 110, 100, 97, 114, 0, 18, 6, 0,
+  132, 109, 97, 110, 100, 101, 114, 0, 15, 4, 6, 0, 132, 97, 110, 100, 97, 114,
+  0, 15, 6, 28, 6, 0, 134, 108, 105, 110, 100, 101, 114, 0, 18, 22, 8, 7, 0,
+  134, 105, 115, 111, 114, 100, 101, 114, 0, 16, 0, 130, 114, 100, 101, 114, 0,
+  81, 97, 116, 21, 142, 116, 23, 151, 116, 0, 72, 104, 116, 18, 131, 116, 0, 74,
+  111, 116, 12, 121, 116, 0, 17, 8, 0, 132, 105, 110, 101, 101, 114, 0, 10, 17,
+  8, 0, 132, 110, 101, 101, 114, 0, 17, 12, 19, 0, 133, 111, 110, 101, 101, 114,
+  0, 21, 4, 6, 0, 131, 101, 101, 114, 0, 17, 0, 82, 160, 116, 24, 172, 116, 0,
+  15, 18, 25, 0, 133, 117, 110, 116, 101, 101, 114, 0, 18, 15, 18, 25, 0, 134,
+  117, 110, 116, 101, 101, 114, 0, 71, 198, 116, 12, 209, 116, 17, 216, 116, 22,
+  247, 116, 0, 8, 6, 18, 21, 19, 0, 130, 117, 114, 101, 0, 11, 0, 129, 104, 101,
+  114, 0, 68, 223, 116, 8, 235, 116, 0, 22, 22, 8, 16, 0, 132, 101, 110, 103,
+  101, 114, 0, 22, 4, 19, 0, 132, 115, 101, 110, 103, 101, 114, 0, 12, 15, 5,
+  24, 19, 0, 130, 104, 101, 114, 0, 68, 27, 117, 6, 39, 117, 10, 51, 117, 11,
+  62, 117, 12, 73, 117, 19, 86, 117, 22, 144, 117, 23, 64, 118, 0, 12, 15, 5,
+  24, 19, 0, 131, 115, 104, 101, 114, 0, 12, 15, 5, 24, 19, 0, 131, 115, 104,
+  101, 114, 0, 12, 8, 11, 0, 133, 105, 103, 104, 101, 114, 0, 22, 12, 15, 5, 24,
+  19, 0, 130, 101, 114, 0, 22, 15, 5, 24, 19, 0, 132, 105, 115, 104, 101, 114,
+  0, 68, 96, 117, 18, 115, 117, 22, 131, 117, 0, 21, 10, 18, 11, 23, 21, 4, 6,
+  0, 136, 111, 103, 114, 97, 112, 104, 101, 114, 0, 22, 12, 15, 12, 11, 19, 0,
+  134, 111, 115, 111, 112, 104, 101, 114, 0, 18, 15, 12, 11, 19, 0, 131, 111,
+  112, 104, 101, 114, 0, 76, 157, 117, 15, 28, 118, 22, 41, 118, 24, 52, 118, 0,
+  69, 164, 117, 15, 175, 117, 0, 24, 19, 0, 132, 108, 105, 115, 104, 101, 114,
+  0, 69, 188, 117, 15, 233, 117, 19, 244, 117, 24, 0, 118, 0, 76, 198, 117, 19,
+  210, 117, 24, 220, 117, 0, 19, 0, 135, 117, 98, 108, 105, 115, 104, 101, 114,
+  0, 134, 117, 98, 108, 105, 115, 104, 101, 114, 0, 18, 0, 136, 112, 117, 98,
+  108, 105, 115, 104, 101, 114, 0, 5, 24, 19, 0, 133, 105, 115, 104, 101, 114,
+  0, 24, 19, 0, 134, 98, 108, 105, 115, 104, 101, 114, 0, 69, 7, 118, 19, 19,
+  118, 0, 19, 0, 135, 117, 98, 108, 105, 115, 104, 101, 114, 0, 133, 98, 108,
+  105, 115, 104, 101, 114, 0, 12, 5, 24, 19, 0, 133, 108, 105, 115, 104, 101,
+  114, 0, 12, 15, 5, 24, 19, 0, 131, 104, 101, 114, 0, 15, 5, 24, 19, 0, 132,
+  105, 115, 104, 101, 114, 0, 68, 80, 118, 8, 106, 118, 15, 140, 118, 18, 149,
+  118, 24, 161, 118, 0, 8, 0, 75, 89, 118, 26, 95, 118, 0, 23, 0, 130, 101, 114,
+  0, 15, 15, 8, 5, 0, 132, 116, 104, 101, 114, 0, 74, 113, 118, 11, 129, 118, 0,
+  18, 23, 15, 15, 4, 0, 136, 116, 111, 103, 101, 116, 104, 101, 114, 0, 10, 18,
+  23, 0, 133, 101, 116, 104, 101, 114, 0, 18, 44, 0, 132, 116, 104, 101, 114, 0,
+  28, 17, 4, 0, 132, 32, 111, 116, 104, 101, 114, 0, 68, 171, 118, 9, 175, 118,
+  21, 182, 118, 0, 129, 111, 114, 0, 131, 114, 116, 104, 101, 114, 0, 24, 9, 0,
+  132, 116, 104, 101, 114, 0, 75, 204, 118, 15, 212, 118, 17, 251, 118, 21, 4,
+  119, 0, 23, 44, 0, 130, 101, 105, 114, 0, 68, 219, 118, 19, 228, 118, 0, 8, 0,
+  131, 114, 108, 105, 101, 114, 0, 16, 0, 76, 237, 118, 18, 243, 118, 0, 22, 0,
+  130, 101, 114, 0, 6, 0, 131, 105, 108, 101, 114, 0, 8, 25, 24, 18, 22, 0, 129,
+  114, 0, 23, 17, 18, 9, 0, 131, 105, 101, 114, 0, 79, 24, 119, 23, 57, 119, 24,
+  66, 119, 0, 12, 19, 0, 68, 34, 119, 21, 48, 119, 0, 23, 4, 6, 0, 134, 101,
+  114, 112, 105, 108, 108, 97, 114, 0, 8, 23, 4, 6, 0, 129, 97, 114, 0, 12, 9,
+  0, 131, 108, 116, 101, 114, 0, 19, 18, 19, 0, 129, 97, 114, 0, 80, 81, 119,
+  18, 90, 119, 0, 4, 21, 10, 44, 0, 129, 97, 114, 0, 9, 21, 8, 19, 0, 130, 114,
+  109, 101, 114, 0, 68, 123, 119, 8, 139, 119, 12, 152, 119, 17, 164, 119, 18,
+  178, 119, 21, 215, 119, 23, 224, 119, 0, 29, 12, 19, 19, 12, 15, 0, 134, 105,
+  122, 122, 97, 110, 101, 114, 0, 25, 24, 18, 10, 0, 133, 118, 101, 114, 110,
+  111, 114, 0, 10, 10, 8, 5, 0, 132, 105, 110, 110, 101, 114, 0, 24, 21, 18, 9,
+  0, 132, 101, 114, 117, 110, 110, 101, 114, 0, 12, 0, 70, 187, 119, 23, 202,
+  119, 0, 12, 23, 6, 4, 21, 19, 0, 133, 116, 105, 111, 110, 101, 114, 0, 6, 4,
+  21, 19, 0, 131, 116, 105, 111, 110, 101, 114, 0, 8, 25, 18, 10, 0, 129, 111,
+  114, 0, 76, 231, 119, 22, 240, 119, 0, 18, 19, 0, 131, 110, 116, 101, 114, 0,
+  12, 15, 0, 130, 101, 110, 101, 114, 0, 73, 0, 120, 26, 7, 120, 0, 8, 5, 0,
+  129, 114, 101, 0, 19, 0, 131, 111, 119, 101, 114, 0, 19, 18, 21, 19, 0, 130,
+  101, 114, 0, 68, 34, 120, 8, 46, 120, 18, 56, 120, 0, 24, 20, 7, 4, 8, 11, 0,
+  129, 116, 101, 114, 0, 24, 20, 17, 18, 6, 0, 129, 111, 114, 0, 19, 16, 8, 0,
+  131, 101, 114, 111, 114, 0, 75, 82, 120, 12, 94, 120, 17, 104, 120, 21, 112,
+  120, 22, 122, 120, 0, 12, 15, 5, 24, 19, 0, 131, 115, 104, 101, 114, 0, 15, 5,
+  24, 19, 0, 129, 104, 101, 114, 0, 18, 19, 22, 0, 129, 111, 114, 0, 24, 6, 8,
+  21, 19, 0, 129, 111, 114, 0, 8, 0, 70, 131, 120, 9, 139, 120, 0, 18, 21, 19,
+  0, 129, 111, 114, 0, 18, 21, 19, 0, 129, 111, 114, 0, 68, 172, 120, 6, 220,
+  120, 11, 234, 120, 12, 22, 121, 17, 46, 121, 19, 55, 121, 22, 66, 121, 24, 94,
+  121, 0, 79, 179, 120, 24, 208, 120, 0, 24, 6, 0, 68, 189, 120, 15, 201, 120,
+  0, 6, 0, 134, 108, 99, 117, 108, 97, 116, 111, 114, 0, 4, 6, 0, 129, 111, 114,
+  0, 20, 7, 4, 8, 11, 0, 130, 114, 116, 101, 114, 0, 4, 21, 11, 6, 0, 133, 97,
+  114, 97, 99, 116, 101, 114, 0, 70, 241, 120, 18, 13, 121, 0, 4, 21, 4, 0, 70,
+  252, 120, 11, 6, 121, 0, 135, 104, 97, 114, 97, 99, 116, 101, 114, 0, 6, 0,
+  131, 116, 101, 114, 0, 17, 4, 0, 131, 116, 104, 101, 114, 0, 72, 29, 121, 17,
+  36, 121, 0, 44, 0, 129, 104, 101, 114, 0, 18, 21, 9, 0, 131, 116, 105, 101,
+  114, 0, 8, 25, 17, 12, 0, 129, 111, 114, 0, 12, 21, 6, 22, 8, 7, 0, 129, 111,
+  114, 0, 68, 73, 121, 17, 84, 121, 0, 12, 7, 0, 132, 115, 97, 115, 116, 101,
+  114, 0, 4, 10, 0, 131, 103, 115, 116, 101, 114, 0, 69, 101, 121, 19, 112, 121,
+  0, 12, 21, 23, 17, 18, 6, 0, 129, 111, 114, 0, 18, 0, 70, 121, 121, 16, 129,
+  121, 0, 132, 109, 112, 117, 116, 101, 114, 0, 6, 0, 134, 111, 109, 112, 117,
+  116, 101, 114, 0, 23, 4, 16, 4, 0, 130, 101, 117, 114, 0, 72, 163, 121, 18,
+  174, 121, 24, 202, 121, 26, 213, 121, 0, 8, 21, 8, 11, 26, 0, 131, 118, 101,
+  114, 0, 70, 181, 121, 22, 192, 121, 0, 12, 7, 0, 132, 115, 99, 111, 118, 101,
+  114, 0, 12, 7, 0, 131, 99, 111, 118, 101, 114, 0, 17, 4, 16, 0, 131, 101, 117,
+  118, 101, 114, 0, 18, 11, 0, 130, 101, 118, 101, 114, 0, 8, 0, 86, 231, 121,
+  23, 242, 121, 0, 12, 15, 5, 24, 19, 0, 130, 104, 101, 114, 0, 18, 44, 0, 130,
+  104, 101, 114, 0, 68, 1, 122, 18, 41, 122, 0, 73, 8, 122, 19, 16, 122, 0, 4,
+  0, 130, 102, 97, 105, 114, 0, 72, 23, 122, 22, 30, 122, 0, 21, 19, 0, 129,
+  114, 101, 0, 12, 7, 0, 133, 101, 115, 112, 97, 105, 114, 0, 25, 8, 22, 8, 21,
+  0, 131, 114, 118, 111, 105, 114, 0, 4, 24, 6, 12, 23, 21, 4, 19, 0, 130, 108,
+  97, 114, 0, 69, 96, 122, 7, 111, 122, 11, 122, 122, 12, 152, 122, 17, 164,
+  122, 21, 228, 122, 22, 238, 122, 23, 99, 123, 29, 44, 124, 0, 11, 10, 8, 12,
+  17, 0, 134, 101, 105, 103, 104, 111, 117, 114, 0, 17, 8, 23, 17, 18, 6, 0,
+  129, 101, 114, 0, 83, 129, 122, 22, 142, 122, 0, 4, 11, 23, 8, 16, 0, 133, 97,
+  112, 104, 111, 114, 0, 12, 15, 5, 24, 19, 0, 129, 101, 114, 0, 17, 24, 12, 0,
+  133, 106, 117, 110, 105, 111, 114, 0, 68, 174, 122, 8, 191, 122, 12, 219, 122,
+  0, 8, 16, 4, 7, 22, 12, 16, 0, 134, 101, 109, 101, 97, 110, 111, 114, 0, 16,
+  0, 68, 200, 122, 8, 211, 122, 0, 7, 0, 133, 101, 109, 101, 97, 110, 111, 114,
+  0, 7, 0, 130, 97, 110, 111, 114, 0, 8, 22, 0, 131, 110, 105, 111, 114, 0, 8,
+  6, 21, 18, 22, 0, 129, 101, 114, 0, 72, 245, 122, 22, 33, 123, 0, 70, 252,
+  122, 9, 7, 123, 0, 8, 7, 8, 21, 19, 0, 129, 115, 111, 114, 0, 73, 14, 123, 18,
+  25, 123, 0, 18, 21, 19, 0, 132, 101, 115, 115, 111, 114, 0, 21, 19, 0, 129,
+  115, 111, 114, 0, 8, 0, 70, 48, 123, 7, 59, 123, 9, 75, 123, 21, 87, 123, 0,
+  24, 22, 0, 132, 99, 101, 115, 115, 111, 114, 0, 8, 6, 8, 21, 19, 0, 135, 100,
+  101, 99, 101, 115, 115, 111, 114, 0, 9, 18, 21, 19, 0, 133, 101, 115, 115,
+  111, 114, 0, 10, 4, 0, 133, 103, 114, 101, 115, 115, 111, 114, 0, 68, 106,
+  123, 6, 34, 124, 0, 76, 119, 123, 17, 133, 123, 21, 147, 123, 23, 255, 123, 0,
+  21, 12, 19, 22, 17, 18, 6, 0, 132, 97, 116, 111, 114, 0, 12, 15, 18, 19, 0,
+  133, 108, 105, 110, 97, 116, 111, 114, 0, 72, 157, 123, 10, 206, 123, 23, 218,
+  123, 0, 74, 167, 123, 17, 183, 123, 23, 194, 123, 0, 7, 12, 21, 9, 8, 21, 0,
+  135, 103, 101, 114, 97, 116, 111, 114, 0, 8, 19, 0, 132, 116, 114, 97, 116,
+  111, 114, 0, 17, 12, 0, 135, 116, 101, 114, 97, 116, 111, 114, 0, 8, 21, 10,
+  10, 4, 0, 132, 97, 116, 111, 114, 0, 72, 225, 123, 22, 239, 123, 0, 21, 8, 19,
+  0, 134, 112, 101, 116, 114, 97, 116, 111, 114, 0, 17, 12, 16, 7, 4, 0, 134,
+  105, 115, 116, 114, 97, 116, 111, 114, 0, 72, 6, 124, 12, 22, 124, 0, 21, 19,
+  8, 23, 17, 12, 0, 135, 114, 112, 114, 101, 116, 111, 114, 0, 16, 16, 12, 0,
+  134, 105, 116, 97, 116, 111, 114, 0, 4, 21, 4, 11, 6, 0, 129, 101, 114, 0, 17,
+  18, 19, 22, 0, 130, 115, 111, 114, 0, 8, 11, 22, 12, 15, 5, 24, 19, 0, 128, 0,
+  4, 8, 28, 0, 129, 114, 115, 0, 18, 4, 21, 8, 19, 18, 0, 130, 116, 111, 114, 0,
+  70, 95, 124, 8, 103, 124, 18, 120, 124, 0, 18, 44, 0, 129, 99, 117, 114, 0,
+  17, 8, 19, 8, 21, 23, 17, 8, 0, 132, 114, 101, 110, 101, 117, 114, 0, 69, 136,
+  124, 6, 169, 124, 7, 176, 124, 17, 190, 124, 25, 200, 124, 0, 68, 143, 124,
+  10, 159, 124, 0, 15, 15, 24, 17, 0, 136, 78, 117, 108, 108, 97, 114, 98, 111,
+  114, 0, 12, 8, 17, 0, 131, 104, 98, 111, 114, 0, 6, 18, 0, 130, 117, 114, 0,
+  17, 8, 19, 22, 0, 133, 108, 101, 110, 100, 111, 117, 114, 0, 24, 18, 11, 0,
+  132, 110, 111, 117, 114, 0, 8, 7, 17, 8, 0, 131, 97, 118, 111, 117, 114, 0,
+  72, 219, 124, 18, 226, 124, 0, 25, 8, 0, 129, 114, 121, 0, 23, 22, 0, 129,
+  114, 121, 0, 68, 32, 125, 6, 125, 125, 7, 80, 126, 8, 161, 126, 10, 127, 134,
+  11, 163, 134, 12, 190, 134, 15, 31, 135, 16, 97, 135, 17, 113, 135, 18, 152,
+  137, 19, 3, 138, 21, 15, 138, 22, 133, 139, 23, 90, 141, 24, 200, 142, 28,
+  152, 147, 29, 234, 147, 0, 70, 51, 125, 11, 64, 125, 12, 75, 125, 17, 84, 125,
+  19, 94, 125, 28, 104, 125, 0, 12, 23, 4, 16, 8, 11, 23, 4, 16, 0, 129, 115, 0,
+  19, 21, 8, 19, 0, 131, 104, 97, 112, 115, 0, 21, 8, 23, 12, 21, 6, 0, 128, 0,
+  17, 4, 17, 4, 5, 0, 130, 97, 115, 0, 11, 21, 8, 19, 0, 130, 97, 112, 115, 0,
+  71, 111, 125, 26, 117, 125, 0, 130, 114, 121, 97, 115, 0, 15, 4, 0, 130, 97,
+  121, 115, 0, 76, 135, 125, 17, 61, 126, 24, 72, 126, 0, 69, 154, 125, 11, 165,
+  125, 15, 189, 125, 16, 219, 125, 17, 241, 125, 23, 0, 126, 0, 24, 19, 8, 21,
+  0, 130, 108, 105, 99, 115, 0, 19, 28, 15, 10, 18, 21, 12, 8, 11, 0, 139, 105,
+  101, 114, 111, 103, 108, 121, 112, 104, 105, 99, 115, 0, 69, 196, 125, 24,
+  208, 125, 0, 19, 8, 21, 0, 132, 117, 98, 108, 105, 99, 115, 0, 19, 8, 21, 0,
+  131, 98, 108, 105, 99, 115, 0, 4, 17, 28, 7, 18, 8, 21, 4, 0, 138, 101, 114,
+  111, 100, 121, 110, 97, 109, 105, 99, 115, 0, 4, 11, 6, 16, 0, 134, 101, 99,
+  104, 97, 110, 105, 99, 115, 0, 68, 10, 126, 8, 26, 126, 22, 42, 126, 0, 16, 4,
+  11, 23, 4, 16, 0, 134, 101, 109, 97, 116, 105, 99, 115, 0, 10, 8, 15, 18, 19,
+  4, 0, 134, 111, 103, 101, 116, 105, 99, 115, 0, 12, 21, 4, 11, 6, 0, 133, 97,
+  99, 116, 101, 114, 105, 115, 116, 105, 99, 115, 0, 8, 21, 8, 9, 8, 21, 0, 128,
+  101, 115, 0, 18, 9, 0, 130, 99, 117, 115, 0, 68, 93, 126, 12, 106, 126, 17,
+  115, 126, 21, 150, 126, 0, 10, 8, 21, 0, 133, 82, 101, 103, 97, 114, 100, 115,
+  0, 9, 17, 18, 6, 0, 128, 101, 115, 0, 68, 122, 126, 24, 134, 126, 0, 7, 17, 8,
+  6, 22, 8, 7, 0, 129, 116, 115, 0, 18, 21, 14, 6, 4, 5, 0, 133, 103, 114, 111,
+  117, 110, 100, 115, 0, 18, 26, 18, 23, 0, 131, 97, 114, 100, 115, 0, 68, 228,
+  126, 5, 250, 126, 6, 23, 127, 7, 71, 127, 8, 98, 127, 9, 109, 127, 10, 134,
+  127, 11, 173, 127, 12, 205, 127, 14, 203, 131, 15, 210, 131, 16, 65, 132, 17,
+  92, 132, 18, 183, 132, 19, 208, 132, 21, 225, 132, 22, 13, 133, 23, 128, 133,
+  24, 53, 134, 25, 66, 134, 28, 101, 134, 29, 113, 134, 0, 71, 235, 126, 14,
+  242, 126, 0, 12, 0, 130, 101, 97, 115, 0, 23, 0, 131, 97, 107, 101, 115, 0,
+  76, 1, 127, 16, 13, 127, 0, 12, 21, 6, 22, 8, 7, 0, 131, 98, 101, 115, 0, 8,
+  22, 8, 21, 0, 129, 108, 101, 115, 0, 72, 30, 127, 12, 61, 127, 0, 71, 37, 127,
+  22, 46, 127, 0, 17, 12, 0, 131, 105, 99, 101, 115, 0, 8, 24, 20, 8, 22, 17,
+  18, 6, 0, 132, 110, 99, 101, 115, 0, 8, 19, 22, 0, 131, 99, 105, 101, 115, 0,
+  85, 78, 127, 24, 86, 127, 0, 4, 10, 8, 21, 0, 129, 115, 0, 15, 27, 8, 0, 132,
   99, 108, 117, 100, 101, 115, 0, 15, 17, 12, 4, 23, 22, 0, 129, 115, 115, 0,
-  12, 0, 81, 197, 126, 26, 204, 126, 0, 14, 0, 130, 118, 101, 115, 0, 7, 12, 16,
-  0, 130, 118, 101, 115, 0, 71, 220, 126, 8, 236, 126, 0, 8, 15, 8, 25, 12, 21,
+  12, 0, 81, 118, 127, 26, 125, 127, 0, 14, 0, 130, 118, 101, 115, 0, 7, 12, 16,
+  0, 130, 118, 101, 115, 0, 71, 141, 127, 8, 157, 127, 0, 8, 15, 8, 25, 12, 21,
   19, 0, 134, 105, 108, 101, 103, 101, 115, 0, 15, 15, 8, 25, 12, 21, 19, 0,
-  134, 105, 108, 101, 103, 101, 115, 0, 86, 3, 127, 23, 18, 127, 0, 12, 5, 4,
+  134, 105, 108, 101, 103, 101, 115, 0, 86, 180, 127, 23, 195, 127, 0, 12, 5, 4,
   23, 22, 8, 0, 132, 108, 105, 115, 104, 101, 115, 0, 12, 15, 18, 7, 17, 8, 0,
-  129, 115, 0, 70, 59, 127, 10, 189, 127, 11, 29, 128, 15, 65, 128, 17, 97, 128,
-  21, 145, 128, 22, 162, 129, 23, 172, 129, 24, 0, 131, 27, 13, 131, 0, 68, 72,
-  127, 8, 84, 127, 12, 94, 127, 17, 116, 127, 0, 7, 17, 24, 5, 4, 0, 131, 110,
-  99, 101, 115, 0, 7, 17, 12, 0, 132, 105, 99, 101, 115, 0, 71, 101, 127, 23,
-  108, 127, 0, 17, 12, 0, 130, 101, 115, 0, 21, 8, 25, 0, 130, 101, 115, 0, 68,
-  123, 127, 8, 169, 127, 0, 71, 130, 127, 10, 156, 127, 0, 17, 0, 72, 139, 127,
-  24, 149, 127, 0, 23, 0, 133, 101, 110, 99, 105, 101, 115, 0, 5, 4, 0, 130,
-  101, 115, 0, 8, 21, 19, 0, 133, 110, 97, 110, 99, 105, 101, 115, 0, 24, 23,
-  12, 22, 17, 18, 6, 0, 136, 116, 105, 116, 117, 101, 110, 99, 105, 101, 115, 0,
-  72, 196, 127, 18, 231, 127, 0, 71, 203, 127, 23, 216, 127, 0, 4, 21, 23, 22,
-  0, 133, 116, 101, 103, 105, 101, 115, 0, 21, 4, 23, 22, 0, 135, 114, 97, 116,
-  101, 103, 105, 101, 115, 0, 15, 0, 68, 240, 127, 18, 253, 127, 0, 8, 7, 12, 0,
-  134, 111, 108, 111, 103, 105, 101, 115, 0, 72, 4, 128, 19, 17, 128, 0, 17, 8,
-  10, 0, 134, 97, 108, 111, 103, 105, 101, 115, 0, 19, 4, 0, 135, 111, 108, 111,
-  103, 105, 101, 115, 0, 70, 36, 128, 19, 50, 128, 0, 4, 21, 8, 12, 11, 0, 132,
-  114, 99, 104, 105, 101, 115, 0, 22, 18, 15, 12, 11, 19, 0, 132, 111, 112, 104,
-  105, 101, 115, 0, 76, 72, 128, 18, 85, 128, 0, 16, 12, 9, 0, 134, 97, 109,
-  105, 108, 105, 101, 115, 0, 16, 18, 17, 4, 0, 132, 97, 108, 105, 101, 115, 0,
-  82, 104, 128, 21, 136, 128, 0, 79, 111, 128, 16, 122, 128, 0, 15, 18, 6, 0,
-  133, 111, 110, 105, 101, 115, 0, 12, 21, 8, 6, 0, 134, 101, 109, 111, 110,
-  105, 101, 115, 0, 24, 18, 13, 0, 130, 101, 121, 115, 0, 68, 164, 128, 8, 36,
-  129, 17, 50, 129, 18, 61, 129, 21, 110, 129, 23, 127, 129, 0, 71, 183, 128,
-  12, 194, 128, 15, 209, 128, 21, 223, 128, 22, 244, 128, 23, 3, 129, 0, 17, 24,
-  18, 9, 0, 132, 114, 105, 101, 115, 0, 15, 15, 12, 27, 24, 4, 0, 134, 105, 97,
-  114, 105, 101, 115, 0, 15, 12, 27, 24, 4, 0, 133, 105, 97, 114, 105, 101, 115,
-  0, 18, 19, 16, 4, 23, 17, 18, 6, 0, 137, 101, 109, 112, 111, 114, 97, 114,
-  105, 101, 115, 0, 12, 16, 16, 8, 0, 135, 105, 115, 115, 97, 114, 105, 101,
-  115, 0, 72, 10, 129, 22, 21, 129, 0, 16, 8, 6, 0, 132, 101, 114, 105, 101,
-  115, 0, 8, 17, 18, 16, 0, 135, 97, 115, 116, 101, 114, 105, 101, 115, 0, 25,
-  18, 21, 23, 17, 18, 6, 0, 130, 115, 105, 101, 115, 0, 24, 18, 6, 0, 131, 116,
-  114, 105, 101, 115, 0, 74, 71, 129, 22, 85, 129, 23, 98, 129, 0, 4, 23, 4, 6,
-  0, 134, 101, 103, 111, 114, 105, 101, 115, 0, 8, 6, 6, 4, 0, 132, 115, 111,
-  114, 105, 101, 115, 0, 12, 25, 0, 133, 99, 116, 111, 114, 105, 101, 115, 0, 4,
-  22, 12, 16, 16, 8, 0, 136, 105, 115, 115, 97, 114, 105, 101, 115, 0, 81, 134,
-  129, 22, 149, 129, 0, 24, 6, 18, 0, 136, 99, 111, 117, 110, 116, 114, 105,
+  129, 115, 0, 70, 236, 127, 10, 110, 128, 11, 206, 128, 15, 242, 128, 17, 18,
+  129, 21, 66, 129, 22, 83, 130, 23, 93, 130, 24, 177, 131, 27, 190, 131, 0, 68,
+  249, 127, 8, 5, 128, 12, 15, 128, 17, 37, 128, 0, 7, 17, 24, 5, 4, 0, 131,
+  110, 99, 101, 115, 0, 7, 17, 12, 0, 132, 105, 99, 101, 115, 0, 71, 22, 128,
+  23, 29, 128, 0, 17, 12, 0, 130, 101, 115, 0, 21, 8, 25, 0, 130, 101, 115, 0,
+  68, 44, 128, 8, 90, 128, 0, 71, 51, 128, 10, 77, 128, 0, 17, 0, 72, 60, 128,
+  24, 70, 128, 0, 23, 0, 133, 101, 110, 99, 105, 101, 115, 0, 5, 4, 0, 130, 101,
+  115, 0, 8, 21, 19, 0, 133, 110, 97, 110, 99, 105, 101, 115, 0, 24, 23, 12, 22,
+  17, 18, 6, 0, 136, 116, 105, 116, 117, 101, 110, 99, 105, 101, 115, 0, 72,
+  117, 128, 18, 152, 128, 0, 71, 124, 128, 23, 137, 128, 0, 4, 21, 23, 22, 0,
+  133, 116, 101, 103, 105, 101, 115, 0, 21, 4, 23, 22, 0, 135, 114, 97, 116,
+  101, 103, 105, 101, 115, 0, 15, 0, 68, 161, 128, 18, 174, 128, 0, 8, 7, 12, 0,
+  134, 111, 108, 111, 103, 105, 101, 115, 0, 72, 181, 128, 19, 194, 128, 0, 17,
+  8, 10, 0, 134, 97, 108, 111, 103, 105, 101, 115, 0, 19, 4, 0, 135, 111, 108,
+  111, 103, 105, 101, 115, 0, 70, 213, 128, 19, 227, 128, 0, 4, 21, 8, 12, 11,
+  0, 132, 114, 99, 104, 105, 101, 115, 0, 22, 18, 15, 12, 11, 19, 0, 132, 111,
+  112, 104, 105, 101, 115, 0, 76, 249, 128, 18, 6, 129, 0, 16, 12, 9, 0, 134,
+  97, 109, 105, 108, 105, 101, 115, 0, 16, 18, 17, 4, 0, 132, 97, 108, 105, 101,
+  115, 0, 82, 25, 129, 21, 57, 129, 0, 79, 32, 129, 16, 43, 129, 0, 15, 18, 6,
+  0, 133, 111, 110, 105, 101, 115, 0, 12, 21, 8, 6, 0, 134, 101, 109, 111, 110,
+  105, 101, 115, 0, 24, 18, 13, 0, 130, 101, 121, 115, 0, 68, 85, 129, 8, 213,
+  129, 17, 227, 129, 18, 238, 129, 21, 31, 130, 23, 48, 130, 0, 71, 104, 129,
+  12, 115, 129, 15, 130, 129, 21, 144, 129, 22, 165, 129, 23, 180, 129, 0, 17,
+  24, 18, 9, 0, 132, 114, 105, 101, 115, 0, 15, 15, 12, 27, 24, 4, 0, 134, 105,
+  97, 114, 105, 101, 115, 0, 15, 12, 27, 24, 4, 0, 133, 105, 97, 114, 105, 101,
+  115, 0, 18, 19, 16, 4, 23, 17, 18, 6, 0, 137, 101, 109, 112, 111, 114, 97,
+  114, 105, 101, 115, 0, 12, 16, 16, 8, 0, 135, 105, 115, 115, 97, 114, 105,
+  101, 115, 0, 72, 187, 129, 22, 198, 129, 0, 16, 8, 6, 0, 132, 101, 114, 105,
+  101, 115, 0, 8, 17, 18, 16, 0, 135, 97, 115, 116, 101, 114, 105, 101, 115, 0,
+  25, 18, 21, 23, 17, 18, 6, 0, 130, 115, 105, 101, 115, 0, 24, 18, 6, 0, 131,
+  116, 114, 105, 101, 115, 0, 74, 248, 129, 22, 6, 130, 23, 19, 130, 0, 4, 23,
+  4, 6, 0, 134, 101, 103, 111, 114, 105, 101, 115, 0, 8, 6, 6, 4, 0, 132, 115,
+  111, 114, 105, 101, 115, 0, 12, 25, 0, 133, 99, 116, 111, 114, 105, 101, 115,
+  0, 4, 22, 12, 16, 16, 8, 0, 136, 105, 115, 115, 97, 114, 105, 101, 115, 0, 81,
+  55, 130, 22, 70, 130, 0, 24, 6, 18, 0, 136, 99, 111, 117, 110, 116, 114, 105,
   101, 115, 0, 17, 12, 16, 0, 133, 105, 115, 116, 114, 105, 101, 115, 0, 24, 21,
-  6, 0, 131, 105, 115, 101, 115, 0, 68, 194, 129, 8, 208, 129, 12, 236, 129, 15,
-  213, 130, 17, 224, 130, 21, 234, 130, 24, 245, 130, 0, 15, 24, 22, 4, 6, 0,
-  133, 97, 108, 116, 105, 101, 115, 0, 12, 0, 68, 217, 129, 7, 228, 129, 0, 25,
+  6, 0, 131, 105, 115, 101, 115, 0, 68, 115, 130, 8, 129, 130, 12, 157, 130, 15,
+  134, 131, 17, 145, 131, 21, 155, 131, 24, 166, 131, 0, 15, 24, 22, 4, 6, 0,
+  133, 97, 108, 116, 105, 101, 115, 0, 12, 0, 68, 138, 130, 7, 149, 130, 0, 25,
   0, 133, 114, 105, 101, 116, 105, 101, 115, 0, 133, 101, 105, 116, 105, 101,
-  115, 0, 70, 249, 129, 15, 9, 130, 21, 186, 130, 22, 196, 130, 0, 18, 21, 23,
-  23, 4, 0, 136, 114, 111, 99, 105, 116, 105, 101, 115, 0, 68, 19, 130, 5, 59,
-  130, 12, 140, 130, 0, 83, 26, 130, 22, 45, 130, 0, 12, 6, 17, 24, 16, 0, 137,
+  115, 0, 70, 170, 130, 15, 186, 130, 21, 107, 131, 22, 117, 131, 0, 18, 21, 23,
+  23, 4, 0, 136, 114, 111, 99, 105, 116, 105, 101, 115, 0, 68, 196, 130, 5, 236,
+  130, 12, 61, 131, 0, 83, 203, 130, 22, 222, 130, 0, 12, 6, 17, 24, 16, 0, 137,
   105, 99, 105, 112, 97, 108, 105, 116, 105, 101, 115, 0, 24, 4, 6, 0, 136, 115,
-  117, 97, 108, 116, 105, 101, 115, 0, 68, 66, 130, 12, 84, 130, 0, 23, 4, 19,
-  16, 18, 6, 0, 135, 105, 98, 105, 108, 105, 116, 105, 101, 115, 0, 86, 91, 130,
-  23, 125, 130, 0, 81, 98, 130, 22, 113, 130, 0, 18, 19, 22, 8, 21, 0, 133, 105,
+  117, 97, 108, 116, 105, 101, 115, 0, 68, 243, 130, 12, 5, 131, 0, 23, 4, 19,
+  16, 18, 6, 0, 135, 105, 98, 105, 108, 105, 116, 105, 101, 115, 0, 86, 12, 131,
+  23, 46, 131, 0, 81, 19, 131, 22, 34, 131, 0, 18, 19, 22, 8, 21, 0, 133, 105,
   108, 105, 116, 105, 101, 115, 0, 18, 19, 0, 133, 105, 108, 105, 116, 105, 101,
   115, 0, 4, 19, 16, 18, 6, 0, 133, 105, 108, 105, 116, 105, 101, 115, 0, 5, 0,
-  68, 149, 130, 12, 167, 130, 0, 23, 4, 19, 16, 18, 6, 0, 136, 105, 98, 105,
-  108, 105, 116, 105, 101, 115, 0, 17, 18, 19, 22, 8, 21, 0, 136, 115, 105, 98,
-  105, 108, 105, 116, 105, 101, 115, 0, 4, 25, 0, 131, 101, 116, 105, 101, 115,
-  0, 22, 8, 6, 6, 8, 17, 0, 136, 101, 115, 115, 105, 116, 105, 101, 115, 0, 12,
-  5, 4, 0, 131, 105, 116, 105, 101, 115, 0, 12, 17, 0, 134, 49, 57, 57, 48, 115,
-  0, 24, 18, 9, 0, 133, 114, 116, 105, 101, 115, 0, 23, 17, 8, 6, 0, 131, 114,
-  105, 101, 115, 0, 21, 23, 17, 8, 6, 0, 132, 117, 114, 105, 101, 115, 0, 4, 15,
-  15, 4, 10, 0, 133, 97, 120, 105, 101, 115, 0, 21, 4, 16, 0, 129, 115, 0, 68,
-  52, 131, 5, 58, 131, 6, 74, 131, 7, 87, 131, 10, 97, 131, 12, 114, 131, 0, 9,
-  0, 129, 115, 101, 0, 4, 23, 21, 8, 25, 17, 18, 6, 0, 132, 105, 98, 108, 101,
-  115, 0, 17, 4, 23, 22, 5, 18, 0, 132, 99, 108, 101, 115, 0, 12, 21, 10, 0,
-  130, 100, 108, 101, 115, 0, 17, 12, 22, 23, 12, 11, 0, 134, 32, 115, 105, 110,
-  103, 108, 101, 115, 0, 71, 121, 131, 16, 136, 131, 0, 18, 14, 6, 18, 21, 6, 0,
-  134, 111, 100, 105, 108, 101, 115, 0, 4, 9, 0, 129, 105, 101, 115, 0, 12, 0,
-  68, 153, 131, 23, 159, 131, 0, 15, 6, 0, 129, 115, 0, 16, 18, 22, 0, 132, 101,
-  116, 105, 109, 101, 115, 0, 68, 181, 131, 12, 189, 131, 24, 245, 131, 0, 10,
-  44, 0, 130, 109, 101, 115, 0, 68, 202, 131, 21, 210, 131, 23, 222, 131, 25,
-  233, 131, 0, 23, 17, 18, 6, 0, 129, 115, 0, 6, 18, 7, 0, 132, 116, 114, 105,
-  110, 101, 115, 0, 6, 18, 7, 0, 131, 114, 105, 110, 101, 115, 0, 21, 8, 23, 17,
-  12, 0, 131, 101, 110, 101, 115, 0, 23, 21, 24, 18, 9, 22, 12, 16, 0, 134, 114,
-  116, 117, 110, 101, 115, 0, 71, 13, 132, 18, 23, 132, 0, 17, 4, 16, 16, 18, 6,
-  0, 129, 115, 0, 23, 23, 4, 23, 0, 129, 115, 0, 28, 23, 18, 21, 8, 23, 22, 0,
-  133, 101, 111, 116, 121, 112, 101, 115, 0, 72, 58, 132, 12, 68, 132, 24, 80,
-  132, 0, 7, 12, 22, 17, 18, 6, 0, 128, 100, 0, 23, 17, 24, 18, 6, 0, 131, 114,
-  105, 101, 115, 0, 10, 24, 4, 17, 12, 0, 129, 97, 116, 101, 115, 0, 68, 108,
-  132, 8, 134, 132, 18, 159, 132, 22, 169, 132, 24, 182, 132, 0, 21, 0, 68, 117,
-  132, 21, 124, 132, 0, 11, 0, 129, 115, 101, 115, 0, 4, 11, 0, 132, 97, 115,
-  115, 101, 115, 0, 79, 141, 132, 22, 150, 132, 0, 8, 21, 0, 130, 97, 115, 101,
-  115, 0, 22, 18, 19, 0, 129, 115, 101, 115, 0, 11, 6, 44, 0, 130, 111, 115,
-  101, 115, 0, 4, 21, 21, 4, 11, 0, 133, 97, 115, 115, 101, 100, 0, 70, 189,
-  132, 10, 200, 132, 0, 4, 6, 0, 132, 117, 99, 117, 115, 101, 115, 0, 17, 24, 9,
-  0, 131, 105, 0, 68, 214, 132, 12, 56, 133, 0, 74, 224, 132, 21, 237, 132, 25,
-  40, 133, 0, 4, 15, 8, 7, 0, 133, 101, 103, 97, 116, 101, 115, 0, 69, 247, 132,
-  18, 8, 133, 19, 26, 133, 0, 12, 23, 21, 8, 25, 17, 12, 0, 134, 101, 98, 114,
-  97, 116, 101, 115, 0, 16, 16, 8, 16, 18, 6, 0, 136, 109, 101, 109, 111, 114,
-  97, 116, 101, 115, 0, 21, 18, 6, 17, 12, 0, 132, 111, 114, 97, 116, 101, 115,
-  0, 4, 21, 4, 10, 10, 4, 0, 135, 114, 97, 118, 97, 116, 101, 115, 0, 79, 69,
-  133, 17, 100, 133, 21, 111, 133, 25, 122, 133, 0, 12, 0, 69, 78, 133, 6, 92,
-  133, 0, 12, 22, 17, 18, 19, 22, 8, 21, 0, 129, 105, 101, 115, 0, 4, 9, 0, 129,
-  105, 101, 115, 0, 24, 16, 16, 18, 6, 0, 129, 105, 101, 115, 0, 18, 11, 23, 24,
-  4, 0, 129, 105, 101, 115, 0, 12, 23, 6, 4, 0, 129, 105, 101, 115, 0, 15, 6, 8,
-  15, 18, 16, 0, 131, 117, 108, 101, 115, 0, 12, 0, 72, 154, 133, 23, 164, 133,
-  0, 11, 23, 0, 132, 105, 101, 118, 101, 115, 0, 12, 17, 21, 8, 23, 15, 4, 0,
-  133, 97, 116, 105, 118, 101, 115, 0, 23, 12, 15, 12, 5, 4, 0, 130, 105, 101,
-  115, 0, 12, 24, 20, 0, 133, 101, 113, 117, 105, 122, 122, 101, 115, 0, 17, 12,
-  0, 71, 216, 133, 8, 230, 133, 0, 8, 6, 18, 21, 19, 0, 132, 101, 100, 105, 110,
-  103, 115, 0, 21, 8, 9, 9, 18, 0, 132, 105, 110, 103, 115, 0, 6, 0, 68, 251,
-  133, 21, 5, 134, 0, 18, 21, 19, 19, 4, 0, 128, 101, 115, 0, 24, 11, 6, 0, 128,
-  101, 115, 0, 72, 26, 134, 15, 36, 134, 17, 46, 134, 22, 56, 134, 0, 21, 18,
-  23, 22, 0, 130, 105, 101, 115, 0, 5, 24, 19, 8, 21, 0, 128, 99, 115, 0, 8, 18,
-  19, 0, 132, 101, 110, 105, 115, 0, 72, 66, 134, 11, 84, 134, 28, 94, 134, 0,
-  11, 23, 17, 4, 21, 4, 19, 0, 135, 101, 110, 116, 104, 101, 115, 105, 115, 0,
-  19, 16, 8, 0, 130, 97, 115, 105, 115, 0, 11, 19, 21, 18, 16, 4, 23, 8, 16, 0,
-  131, 111, 115, 105, 115, 0, 72, 123, 134, 15, 153, 134, 21, 161, 134, 24, 167,
-  134, 0, 79, 130, 134, 25, 144, 134, 0, 15, 8, 21, 4, 19, 0, 133, 97, 108, 108,
+  68, 70, 131, 12, 88, 131, 0, 23, 4, 19, 16, 18, 6, 0, 136, 105, 98, 105, 108,
+  105, 116, 105, 101, 115, 0, 17, 18, 19, 22, 8, 21, 0, 136, 115, 105, 98, 105,
+  108, 105, 116, 105, 101, 115, 0, 4, 25, 0, 131, 101, 116, 105, 101, 115, 0,
+  22, 8, 6, 6, 8, 17, 0, 136, 101, 115, 115, 105, 116, 105, 101, 115, 0, 12, 5,
+  4, 0, 131, 105, 116, 105, 101, 115, 0, 12, 17, 0, 134, 49, 57, 57, 48, 115, 0,
+  24, 18, 9, 0, 133, 114, 116, 105, 101, 115, 0, 23, 17, 8, 6, 0, 131, 114, 105,
+  101, 115, 0, 21, 23, 17, 8, 6, 0, 132, 117, 114, 105, 101, 115, 0, 4, 15, 15,
+  4, 10, 0, 133, 97, 120, 105, 101, 115, 0, 21, 4, 16, 0, 129, 115, 0, 68, 229,
+  131, 5, 235, 131, 6, 251, 131, 7, 8, 132, 10, 18, 132, 12, 35, 132, 0, 9, 0,
+  129, 115, 101, 0, 4, 23, 21, 8, 25, 17, 18, 6, 0, 132, 105, 98, 108, 101, 115,
+  0, 17, 4, 23, 22, 5, 18, 0, 132, 99, 108, 101, 115, 0, 12, 21, 10, 0, 130,
+  100, 108, 101, 115, 0, 17, 12, 22, 23, 12, 11, 0, 134, 32, 115, 105, 110, 103,
+  108, 101, 115, 0, 71, 42, 132, 16, 57, 132, 0, 18, 14, 6, 18, 21, 6, 0, 134,
+  111, 100, 105, 108, 101, 115, 0, 4, 9, 0, 129, 105, 101, 115, 0, 12, 0, 68,
+  74, 132, 23, 80, 132, 0, 15, 6, 0, 129, 115, 0, 16, 18, 22, 0, 132, 101, 116,
+  105, 109, 101, 115, 0, 68, 102, 132, 12, 110, 132, 24, 166, 132, 0, 10, 44, 0,
+  130, 109, 101, 115, 0, 68, 123, 132, 21, 131, 132, 23, 143, 132, 25, 154, 132,
+  0, 23, 17, 18, 6, 0, 129, 115, 0, 6, 18, 7, 0, 132, 116, 114, 105, 110, 101,
+  115, 0, 6, 18, 7, 0, 131, 114, 105, 110, 101, 115, 0, 21, 8, 23, 17, 12, 0,
+  131, 101, 110, 101, 115, 0, 23, 21, 24, 18, 9, 22, 12, 16, 0, 134, 114, 116,
+  117, 110, 101, 115, 0, 71, 190, 132, 18, 200, 132, 0, 17, 4, 16, 16, 18, 6, 0,
+  129, 115, 0, 23, 23, 4, 23, 0, 129, 115, 0, 28, 23, 18, 21, 8, 23, 22, 0, 133,
+  101, 111, 116, 121, 112, 101, 115, 0, 72, 235, 132, 12, 245, 132, 24, 1, 133,
+  0, 7, 12, 22, 17, 18, 6, 0, 128, 100, 0, 23, 17, 24, 18, 6, 0, 131, 114, 105,
+  101, 115, 0, 10, 24, 4, 17, 12, 0, 129, 97, 116, 101, 115, 0, 68, 29, 133, 8,
+  55, 133, 18, 80, 133, 22, 90, 133, 24, 103, 133, 0, 21, 0, 68, 38, 133, 21,
+  45, 133, 0, 11, 0, 129, 115, 101, 115, 0, 4, 11, 0, 132, 97, 115, 115, 101,
+  115, 0, 79, 62, 133, 22, 71, 133, 0, 8, 21, 0, 130, 97, 115, 101, 115, 0, 22,
+  18, 19, 0, 129, 115, 101, 115, 0, 11, 6, 44, 0, 130, 111, 115, 101, 115, 0, 4,
+  21, 21, 4, 11, 0, 133, 97, 115, 115, 101, 100, 0, 70, 110, 133, 10, 121, 133,
+  0, 4, 6, 0, 132, 117, 99, 117, 115, 101, 115, 0, 17, 24, 9, 0, 131, 105, 0,
+  68, 135, 133, 12, 233, 133, 0, 74, 145, 133, 21, 158, 133, 25, 217, 133, 0, 4,
+  15, 8, 7, 0, 133, 101, 103, 97, 116, 101, 115, 0, 69, 168, 133, 18, 185, 133,
+  19, 203, 133, 0, 12, 23, 21, 8, 25, 17, 12, 0, 134, 101, 98, 114, 97, 116,
+  101, 115, 0, 16, 16, 8, 16, 18, 6, 0, 136, 109, 101, 109, 111, 114, 97, 116,
+  101, 115, 0, 21, 18, 6, 17, 12, 0, 132, 111, 114, 97, 116, 101, 115, 0, 4, 21,
+  4, 10, 10, 4, 0, 135, 114, 97, 118, 97, 116, 101, 115, 0, 79, 246, 133, 17,
+  21, 134, 21, 32, 134, 25, 43, 134, 0, 12, 0, 69, 255, 133, 6, 13, 134, 0, 12,
+  22, 17, 18, 19, 22, 8, 21, 0, 129, 105, 101, 115, 0, 4, 9, 0, 129, 105, 101,
+  115, 0, 24, 16, 16, 18, 6, 0, 129, 105, 101, 115, 0, 18, 11, 23, 24, 4, 0,
+  129, 105, 101, 115, 0, 12, 23, 6, 4, 0, 129, 105, 101, 115, 0, 15, 6, 8, 15,
+  18, 16, 0, 131, 117, 108, 101, 115, 0, 12, 0, 72, 75, 134, 23, 85, 134, 0, 11,
+  23, 0, 132, 105, 101, 118, 101, 115, 0, 12, 17, 21, 8, 23, 15, 4, 0, 133, 97,
+  116, 105, 118, 101, 115, 0, 23, 12, 15, 12, 5, 4, 0, 130, 105, 101, 115, 0,
+  12, 24, 20, 0, 133, 101, 113, 117, 105, 122, 122, 101, 115, 0, 17, 12, 0, 71,
+  137, 134, 8, 151, 134, 0, 8, 6, 18, 21, 19, 0, 132, 101, 100, 105, 110, 103,
+  115, 0, 21, 8, 9, 9, 18, 0, 132, 105, 110, 103, 115, 0, 6, 0, 68, 172, 134,
+  21, 182, 134, 0, 18, 21, 19, 19, 4, 0, 128, 101, 115, 0, 24, 11, 6, 0, 128,
+  101, 115, 0, 72, 203, 134, 15, 213, 134, 17, 223, 134, 22, 233, 134, 0, 21,
+  18, 23, 22, 0, 130, 105, 101, 115, 0, 5, 24, 19, 8, 21, 0, 128, 99, 115, 0, 8,
+  18, 19, 0, 132, 101, 110, 105, 115, 0, 72, 243, 134, 11, 5, 135, 28, 15, 135,
+  0, 11, 23, 17, 4, 21, 4, 19, 0, 135, 101, 110, 116, 104, 101, 115, 105, 115,
+  0, 19, 16, 8, 0, 130, 97, 115, 105, 115, 0, 11, 19, 21, 18, 16, 4, 23, 8, 16,
+  0, 131, 111, 115, 105, 115, 0, 72, 44, 135, 15, 74, 135, 21, 82, 135, 24, 88,
+  135, 0, 79, 51, 135, 25, 65, 135, 0, 15, 8, 21, 4, 19, 0, 133, 97, 108, 108,
   101, 108, 115, 0, 8, 7, 0, 131, 108, 118, 101, 115, 0, 8, 6, 27, 8, 0, 129,
   115, 0, 18, 26, 0, 128, 100, 0, 6, 15, 4, 6, 0, 128, 117, 115, 0, 23, 12, 11,
-  21, 18, 10, 15, 4, 0, 132, 105, 116, 104, 109, 115, 0, 68, 205, 134, 8, 46,
-  135, 12, 52, 135, 18, 98, 135, 0, 76, 215, 134, 22, 20, 135, 23, 35, 135, 0,
-  70, 222, 134, 21, 3, 135, 0, 12, 0, 85, 231, 134, 23, 242, 134, 0, 18, 23, 22,
-  12, 11, 0, 132, 97, 110, 115, 0, 8, 11, 23, 4, 16, 0, 134, 109, 97, 116, 105,
-  99, 105, 97, 110, 115, 0, 18, 23, 12, 22, 11, 0, 136, 105, 115, 116, 111, 114,
-  105, 97, 110, 115, 0, 22, 4, 22, 22, 22, 4, 0, 134, 97, 115, 115, 105, 110,
-  115, 0, 12, 5, 4, 11, 17, 12, 0, 128, 116, 115, 0, 18, 7, 0, 129, 115, 0, 68,
-  62, 135, 10, 76, 135, 23, 85, 135, 0, 23, 17, 18, 16, 0, 133, 117, 110, 116,
-  97, 105, 110, 115, 0, 10, 8, 5, 0, 131, 105, 110, 115, 0, 4, 17, 12, 5, 16,
-  18, 6, 0, 129, 111, 110, 115, 0, 76, 108, 135, 16, 208, 136, 23, 216, 136, 0,
-  79, 118, 135, 17, 132, 135, 23, 144, 135, 0, 15, 5, 8, 21, 0, 133, 101, 108,
-  108, 105, 111, 110, 115, 0, 8, 16, 12, 7, 0, 131, 115, 105, 111, 110, 115, 0,
-  68, 157, 135, 12, 142, 136, 18, 178, 136, 24, 191, 136, 0, 70, 179, 135, 12,
-  222, 135, 15, 240, 135, 17, 4, 136, 21, 41, 136, 23, 82, 136, 29, 124, 136, 0,
-  12, 0, 81, 188, 135, 24, 206, 135, 0, 12, 24, 16, 16, 18, 6, 0, 137, 110, 105,
-  99, 97, 116, 105, 111, 110, 115, 0, 16, 16, 18, 6, 0, 135, 110, 105, 99, 97,
-  116, 105, 111, 110, 115, 0, 23, 4, 12, 23, 17, 8, 21, 8, 9, 9, 12, 7, 0, 133,
-  111, 110, 115, 0, 24, 7, 4, 21, 10, 17, 18, 6, 0, 136, 116, 117, 108, 97, 116,
-  105, 111, 110, 115, 0, 68, 11, 136, 12, 26, 136, 0, 5, 16, 18, 6, 0, 135, 105,
-  110, 97, 116, 105, 111, 110, 115, 0, 22, 8, 7, 0, 135, 116, 105, 110, 97, 116,
-  105, 111, 110, 115, 0, 72, 48, 136, 18, 63, 136, 0, 19, 21, 18, 6, 0, 135,
-  111, 114, 97, 116, 105, 111, 110, 115, 0, 5, 4, 15, 18, 6, 0, 137, 108, 97,
-  98, 111, 114, 97, 116, 105, 111, 110, 115, 0, 82, 89, 136, 22, 104, 136, 0,
-  17, 18, 6, 0, 135, 110, 111, 116, 97, 116, 105, 111, 110, 115, 0, 8, 9, 22,
-  12, 17, 4, 16, 0, 138, 102, 101, 115, 116, 97, 116, 105, 111, 110, 115, 0, 12,
-  16, 23, 19, 18, 0, 136, 105, 109, 105, 122, 97, 116, 105, 111, 110, 115, 0,
-  71, 149, 136, 8, 164, 136, 0, 12, 19, 27, 8, 0, 135, 101, 100, 105, 116, 105,
-  111, 110, 115, 0, 19, 16, 18, 6, 0, 133, 116, 105, 116, 105, 111, 110, 115, 0,
-  19, 18, 21, 19, 0, 132, 114, 116, 105, 111, 110, 115, 0, 23, 12, 21, 23, 17,
-  18, 6, 0, 134, 98, 117, 116, 105, 111, 110, 115, 0, 4, 12, 7, 0, 128, 100,
-  115, 0, 12, 6, 12, 7, 8, 21, 19, 0, 132, 116, 105, 111, 110, 115, 0, 71, 247,
-  136, 10, 12, 137, 12, 22, 137, 21, 52, 137, 23, 59, 137, 0, 4, 17, 4, 12, 6,
-  12, 9, 9, 4, 0, 137, 105, 99, 105, 111, 110, 97, 100, 111, 115, 0, 21, 4, 5,
-  16, 8, 0, 128, 101, 115, 0, 85, 29, 137, 25, 44, 137, 0, 4, 17, 8, 22, 0, 134,
-  99, 101, 110, 97, 114, 105, 111, 115, 0, 8, 21, 19, 0, 128, 117, 115, 0, 8,
-  11, 0, 128, 101, 115, 0, 4, 0, 80, 68, 137, 23, 75, 137, 0, 18, 23, 0, 128,
-  101, 115, 0, 18, 19, 0, 128, 101, 115, 0, 4, 8, 11, 21, 8, 19, 0, 131, 97,
-  112, 115, 0, 68, 110, 137, 8, 120, 137, 18, 76, 138, 21, 190, 138, 23, 198,
-  138, 0, 7, 17, 4, 23, 22, 0, 128, 100, 115, 0, 69, 151, 137, 6, 164, 137, 7,
-  175, 137, 9, 187, 137, 12, 200, 137, 14, 212, 137, 15, 224, 137, 19, 237, 137,
-  21, 252, 137, 23, 20, 138, 0, 17, 24, 16, 0, 134, 110, 117, 109, 98, 101, 114,
-  115, 0, 9, 9, 18, 0, 131, 105, 99, 101, 114, 115, 0, 12, 15, 18, 22, 0, 132,
-  100, 105, 101, 114, 115, 0, 12, 23, 17, 8, 7, 12, 0, 130, 105, 101, 114, 115,
-  0, 23, 12, 21, 18, 11, 23, 24, 4, 0, 129, 115, 0, 6, 12, 17, 18, 16, 0, 132,
-  107, 101, 114, 115, 0, 19, 12, 23, 15, 24, 16, 0, 130, 105, 101, 114, 115, 0,
-  8, 8, 8, 14, 19, 18, 11, 22, 0, 132, 112, 101, 114, 115, 0, 73, 3, 138, 21,
-  11, 138, 0, 8, 21, 0, 131, 101, 114, 115, 0, 4, 6, 0, 131, 101, 101, 114, 115,
-  0, 70, 27, 138, 23, 60, 138, 0, 68, 34, 138, 8, 50, 138, 0, 21, 11, 4, 6, 0,
-  136, 104, 97, 114, 97, 99, 116, 101, 114, 115, 0, 21, 21, 18, 6, 0, 130, 111,
-  114, 115, 0, 8, 15, 26, 8, 17, 0, 134, 115, 108, 101, 116, 116, 101, 114, 115,
-  0, 82, 86, 138, 23, 97, 138, 25, 178, 138, 0, 7, 12, 21, 21, 18, 6, 0, 130,
-  114, 115, 0, 68, 110, 138, 12, 123, 138, 17, 141, 138, 22, 149, 138, 0, 29,
-  12, 17, 18, 15, 18, 6, 0, 132, 101, 114, 115, 0, 23, 8, 16, 19, 18, 6, 0, 136,
-  109, 112, 101, 116, 105, 116, 111, 114, 115, 0, 8, 21, 0, 130, 101, 114, 115,
-  0, 72, 156, 138, 12, 169, 138, 0, 22, 17, 4, 0, 134, 99, 101, 115, 116, 111,
-  114, 115, 0, 25, 0, 131, 105, 116, 111, 114, 115, 0, 8, 7, 17, 8, 0, 131, 97,
-  118, 111, 114, 115, 0, 8, 9, 8, 21, 0, 129, 115, 0, 18, 4, 15, 24, 10, 8, 21,
-  0, 131, 116, 111, 114, 115, 0, 68, 225, 138, 8, 237, 138, 18, 145, 140, 24,
-  156, 140, 0, 21, 4, 5, 16, 8, 0, 130, 114, 97, 115, 115, 0, 70, 3, 139, 7, 13,
-  139, 15, 22, 139, 17, 107, 139, 21, 34, 140, 22, 87, 140, 26, 135, 140, 0, 6,
-  18, 21, 19, 0, 131, 101, 115, 115, 0, 18, 10, 0, 130, 100, 101, 115, 115, 0,
-  71, 38, 139, 8, 58, 139, 11, 74, 139, 15, 88, 139, 16, 96, 139, 0, 21, 4, 10,
-  8, 21, 21, 12, 0, 139, 114, 101, 103, 97, 114, 100, 108, 101, 115, 115, 0, 11,
-  23, 17, 18, 17, 0, 134, 101, 116, 104, 101, 108, 101, 115, 115, 0, 23, 21, 8,
-  25, 8, 17, 0, 131, 101, 108, 101, 115, 115, 0, 12, 0, 130, 110, 101, 115, 115,
-  0, 16, 24, 21, 7, 0, 132, 108, 101, 115, 115, 0, 72, 129, 139, 12, 138, 139,
-  15, 150, 139, 21, 159, 139, 22, 172, 139, 24, 246, 139, 28, 5, 140, 0, 19, 18,
-  0, 130, 110, 101, 115, 115, 0, 22, 22, 24, 5, 0, 133, 105, 110, 101, 115, 115,
-  0, 12, 0, 131, 108, 110, 101, 115, 115, 0, 18, 5, 5, 24, 23, 22, 0, 130, 110,
-  101, 115, 115, 0, 76, 179, 139, 24, 190, 139, 0, 24, 5, 0, 133, 115, 105, 110,
-  101, 115, 115, 0, 69, 197, 139, 18, 204, 139, 0, 131, 105, 110, 101, 115, 115,
-  0, 70, 211, 139, 12, 228, 139, 0, 12, 22, 17, 18, 6, 0, 136, 99, 105, 111,
-  117, 115, 110, 101, 115, 115, 0, 6, 12, 22, 17, 18, 6, 0, 137, 99, 105, 111,
-  117, 115, 110, 101, 115, 115, 0, 18, 12, 6, 22, 17, 18, 6, 0, 131, 115, 110,
-  101, 115, 115, 0, 79, 12, 140, 29, 24, 140, 0, 8, 17, 18, 15, 0, 132, 105,
-  110, 101, 115, 115, 0, 4, 15, 0, 132, 105, 110, 101, 115, 115, 0, 70, 44, 140,
-  7, 51, 140, 19, 60, 140, 0, 8, 7, 0, 129, 101, 115, 0, 4, 0, 131, 100, 114,
-  101, 115, 115, 0, 85, 67, 140, 24, 78, 140, 0, 24, 22, 0, 133, 112, 112, 114,
-  101, 115, 115, 0, 22, 0, 131, 112, 114, 101, 115, 115, 0, 70, 97, 140, 18,
-  106, 140, 22, 114, 140, 0, 6, 24, 22, 0, 131, 101, 115, 115, 0, 19, 0, 130,
-  115, 101, 115, 115, 0, 8, 0, 85, 123, 140, 22, 129, 140, 0, 7, 7, 4, 0, 128,
-  0, 22, 18, 19, 0, 128, 0, 4, 15, 9, 0, 130, 108, 101, 115, 115, 0, 21, 6, 6,
-  4, 0, 132, 114, 111, 115, 115, 0, 6, 22, 8, 7, 0, 133, 105, 115, 99, 117, 115,
-  115, 0, 70, 197, 140, 9, 211, 140, 11, 220, 140, 12, 235, 140, 16, 5, 141, 17,
-  18, 141, 21, 210, 141, 22, 217, 141, 23, 16, 142, 0, 12, 21, 22, 12, 7, 0,
-  132, 116, 114, 105, 99, 116, 115, 0, 4, 21, 6, 21, 12, 4, 0, 128, 0, 10, 24,
-  18, 21, 11, 23, 14, 4, 8, 21, 5, 0, 129, 115, 0, 72, 242, 140, 16, 252, 140,
-  0, 25, 18, 22, 0, 131, 105, 101, 116, 115, 0, 15, 0, 131, 105, 109, 105, 116,
-  115, 0, 8, 16, 8, 23, 4, 23, 22, 0, 130, 110, 116, 115, 0, 68, 31, 141, 8, 48,
-  141, 12, 189, 141, 18, 204, 141, 0, 12, 7, 8, 8, 21, 10, 17, 12, 0, 134, 100,
-  105, 101, 110, 116, 115, 0, 80, 58, 141, 19, 160, 141, 23, 174, 141, 0, 72,
-  71, 141, 12, 114, 141, 17, 128, 141, 24, 146, 141, 0, 70, 78, 141, 15, 97,
-  141, 0, 17, 24, 18, 21, 19, 0, 136, 110, 111, 117, 110, 99, 101, 109, 101,
-  110, 116, 115, 0, 10, 4, 23, 17, 8, 0, 135, 110, 103, 108, 101, 109, 101, 110,
-  116, 115, 0, 8, 19, 27, 8, 0, 133, 114, 105, 109, 101, 110, 116, 115, 0, 18,
-  12, 21, 25, 17, 8, 0, 136, 105, 114, 111, 110, 109, 101, 110, 116, 115, 0, 23,
-  22, 17, 12, 0, 133, 114, 117, 109, 101, 110, 116, 115, 0, 8, 12, 6, 8, 21, 0,
-  133, 112, 105, 101, 110, 116, 115, 0, 4, 5, 16, 18, 6, 17, 18, 17, 0, 131, 97,
-  110, 116, 115, 0, 4, 23, 22, 17, 18, 6, 0, 132, 114, 97, 105, 110, 116, 115,
-  0, 16, 0, 128, 104, 115, 0, 12, 9, 0, 129, 115, 116, 0, 12, 0, 70, 229, 141,
-  10, 238, 141, 15, 1, 142, 0, 12, 23, 12, 21, 6, 0, 131, 115, 0, 18, 15, 8, 4,
-  11, 6, 21, 4, 0, 134, 111, 108, 111, 103, 105, 115, 116, 115, 0, 4, 21, 8, 23,
-  4, 16, 0, 133, 105, 97, 108, 105, 115, 116, 0, 24, 5, 4, 0, 129, 115, 0, 70,
-  45, 142, 8, 73, 142, 12, 115, 142, 15, 141, 142, 16, 151, 142, 18, 171, 142,
-  22, 216, 146, 0, 17, 8, 0, 70, 55, 142, 22, 60, 142, 0, 130, 115, 117, 115, 0,
-  8, 17, 18, 6, 0, 134, 115, 101, 110, 115, 117, 115, 0, 68, 83, 142, 5, 92,
-  142, 17, 99, 142, 0, 5, 4, 11, 0, 131, 101, 97, 115, 0, 4, 11, 0, 129, 97,
-  115, 0, 4, 21, 18, 19, 16, 8, 23, 17, 18, 6, 0, 129, 111, 117, 115, 0, 81,
-  122, 142, 25, 132, 142, 0, 8, 10, 17, 12, 0, 129, 111, 117, 115, 0, 8, 21, 19,
-  0, 129, 111, 117, 115, 0, 12, 23, 22, 0, 131, 121, 108, 117, 115, 0, 4, 23,
-  18, 19, 18, 19, 12, 11, 0, 135, 112, 111, 112, 111, 116, 97, 109, 117, 115, 0,
-  70, 205, 142, 8, 218, 142, 10, 49, 143, 12, 111, 143, 15, 137, 144, 16, 173,
-  144, 17, 21, 145, 21, 195, 145, 24, 128, 146, 25, 155, 146, 29, 204, 146, 0,
-  22, 12, 16, 18, 21, 19, 0, 130, 117, 111, 117, 115, 0, 74, 225, 142, 17, 13,
-  143, 0, 76, 232, 142, 18, 3, 143, 0, 79, 239, 142, 23, 248, 142, 0, 8, 21, 0,
-  131, 105, 111, 117, 115, 0, 22, 8, 21, 19, 0, 131, 105, 111, 117, 115, 0, 15,
-  4, 17, 4, 0, 131, 111, 117, 115, 0, 68, 20, 143, 12, 36, 143, 0, 15, 8, 6, 22,
-  12, 16, 0, 133, 108, 97, 110, 101, 111, 117, 115, 0, 10, 12, 7, 17, 12, 0,
-  133, 101, 110, 111, 117, 115, 0, 68, 56, 143, 12, 84, 143, 0, 79, 63, 143, 21,
-  74, 143, 0, 4, 17, 4, 0, 132, 111, 103, 111, 117, 115, 0, 23, 24, 18, 0, 130,
-  101, 111, 117, 115, 0, 79, 91, 143, 23, 100, 143, 0, 8, 21, 0, 130, 105, 111,
-  117, 115, 0, 22, 8, 21, 19, 0, 130, 105, 111, 117, 115, 0, 70, 136, 143, 7,
-  166, 143, 10, 181, 143, 17, 219, 143, 21, 234, 143, 22, 50, 144, 23, 76, 144,
-  25, 104, 144, 0, 76, 143, 143, 17, 155, 143, 0, 23, 6, 12, 9, 0, 132, 116,
-  105, 111, 117, 115, 0, 18, 6, 0, 132, 115, 99, 105, 111, 117, 115, 0, 12, 6,
-  8, 0, 135, 100, 101, 99, 105, 100, 117, 111, 117, 115, 0, 72, 188, 143, 23,
-  204, 143, 0, 21, 10, 10, 4, 0, 137, 101, 103, 114, 101, 103, 105, 111, 117,
-  115, 0, 12, 22, 8, 21, 19, 0, 134, 116, 105, 103, 105, 111, 117, 115, 0, 4,
-  15, 15, 8, 6, 22, 12, 16, 0, 131, 101, 111, 117, 115, 0, 68, 241, 143, 8, 17,
-  144, 0, 15, 0, 68, 250, 143, 15, 6, 144, 0, 11, 0, 135, 105, 108, 97, 114,
-  105, 111, 117, 115, 0, 12, 11, 0, 134, 97, 114, 105, 111, 117, 115, 0, 79, 24,
-  144, 23, 35, 144, 0, 8, 7, 0, 133, 105, 114, 105, 111, 117, 115, 0, 22, 12,
-  16, 0, 136, 121, 115, 116, 101, 114, 105, 111, 117, 115, 0, 76, 57, 144, 17,
-  66, 144, 0, 25, 0, 132, 99, 105, 111, 117, 115, 0, 18, 6, 0, 131, 99, 105,
-  111, 117, 115, 0, 70, 83, 144, 12, 93, 144, 0, 12, 9, 0, 130, 116, 105, 111,
-  117, 115, 0, 24, 23, 4, 21, 10, 0, 131, 111, 117, 115, 0, 8, 0, 75, 113, 144,
-  12, 126, 144, 0, 6, 22, 12, 16, 0, 133, 105, 101, 118, 111, 117, 115, 0, 11,
-  6, 22, 12, 16, 0, 131, 111, 117, 115, 0, 82, 144, 144, 24, 156, 144, 0, 16,
-  18, 17, 4, 0, 132, 97, 108, 111, 117, 115, 0, 6, 12, 7, 8, 21, 0, 136, 105,
-  100, 105, 99, 117, 108, 111, 117, 115, 0, 72, 186, 144, 18, 197, 144, 21, 231,
-  144, 28, 243, 144, 0, 17, 8, 25, 0, 132, 111, 109, 111, 117, 115, 0, 75, 204,
-  144, 17, 216, 144, 0, 23, 22, 18, 19, 0, 132, 117, 109, 111, 117, 115, 0, 18,
-  16, 18, 23, 24, 4, 0, 135, 110, 111, 109, 111, 117, 115, 0, 24, 18, 17, 8, 0,
-  133, 114, 109, 111, 117, 115, 0, 17, 0, 68, 252, 144, 18, 6, 145, 0, 17, 24,
-  0, 132, 105, 109, 111, 117, 115, 0, 17, 18, 7, 24, 8, 22, 19, 0, 134, 121,
-  109, 111, 117, 115, 0, 68, 34, 145, 8, 100, 145, 12, 146, 145, 18, 157, 145,
-  0, 79, 41, 145, 23, 54, 145, 0, 15, 8, 6, 22, 12, 16, 0, 130, 101, 111, 117,
-  115, 0, 79, 61, 145, 17, 72, 145, 0, 24, 16, 12, 22, 0, 130, 101, 111, 117,
-  115, 0, 18, 0, 80, 81, 145, 19, 92, 145, 0, 134, 117, 110, 116, 97, 105, 110,
-  111, 117, 115, 0, 22, 0, 130, 101, 111, 117, 115, 0, 74, 107, 145, 21, 137,
-  145, 0, 18, 21, 0, 71, 117, 145, 8, 127, 145, 0, 17, 4, 0, 132, 121, 110, 111,
-  117, 115, 0, 23, 8, 11, 0, 130, 101, 111, 117, 115, 0, 23, 22, 0, 130, 117,
-  111, 117, 115, 0, 23, 17, 18, 6, 0, 130, 117, 111, 117, 115, 0, 23, 0, 70,
-  166, 145, 11, 181, 145, 0, 18, 23, 24, 4, 0, 133, 104, 116, 104, 111, 110,
-  111, 117, 115, 0, 6, 18, 23, 24, 4, 0, 132, 104, 111, 110, 111, 117, 115, 0,
-  72, 205, 145, 23, 42, 146, 24, 73, 146, 0, 69, 218, 145, 16, 229, 145, 23,
-  239, 145, 25, 10, 146, 0, 16, 24, 17, 0, 133, 101, 114, 111, 117, 115, 0, 24,
-  11, 0, 132, 111, 114, 111, 117, 115, 0, 22, 0, 68, 248, 145, 28, 2, 146, 0,
-  22, 12, 7, 0, 132, 114, 111, 117, 115, 0, 16, 0, 130, 105, 111, 117, 115, 0,
-  12, 0, 81, 19, 146, 23, 29, 146, 0, 16, 18, 0, 132, 111, 114, 111, 117, 115,
-  0, 6, 8, 22, 17, 12, 0, 132, 111, 114, 111, 117, 115, 0, 68, 49, 146, 17, 61,
-  146, 0, 22, 12, 7, 0, 132, 115, 116, 114, 111, 117, 115, 0, 8, 25, 7, 4, 0,
-  131, 117, 114, 111, 117, 115, 0, 80, 80, 146, 18, 90, 146, 0, 24, 11, 0, 132,
-  111, 114, 111, 117, 115, 0, 74, 97, 146, 16, 118, 146, 0, 12, 0, 85, 106, 146,
-  25, 112, 146, 0, 132, 114, 111, 117, 115, 0, 132, 114, 111, 117, 115, 0, 4,
-  15, 10, 0, 132, 114, 111, 117, 115, 0, 70, 135, 146, 23, 143, 146, 0, 24, 16,
-  0, 131, 111, 117, 115, 0, 6, 8, 9, 17, 12, 0, 131, 105, 111, 117, 115, 0, 72,
-  162, 146, 12, 174, 146, 0, 7, 17, 8, 21, 0, 131, 122, 118, 111, 117, 115, 0,
-  72, 181, 146, 25, 195, 146, 0, 11, 6, 22, 12, 16, 0, 133, 105, 101, 118, 111,
-  117, 115, 0, 8, 21, 19, 0, 131, 111, 117, 115, 0, 8, 7, 17, 8, 21, 0, 130,
-  118, 111, 117, 115, 0, 17, 8, 6, 17, 18, 6, 0, 133, 115, 101, 110, 115, 117,
-  115, 0, 68, 247, 146, 5, 3, 147, 6, 15, 147, 18, 29, 147, 21, 43, 147, 0, 7,
-  26, 18, 17, 0, 131, 97, 100, 97, 121, 115, 0, 21, 8, 22, 22, 4, 19, 0, 130,
-  115, 98, 121, 0, 4, 21, 12, 19, 22, 17, 18, 6, 0, 129, 105, 101, 115, 0, 15,
-  19, 16, 12, 0, 134, 101, 109, 112, 108, 111, 121, 115, 0, 4, 17, 18, 12, 23,
-  6, 12, 7, 0, 129, 105, 101, 115, 0, 23, 21, 8, 11, 0, 128, 0, 68, 110, 147, 6,
-  195, 147, 8, 103, 148, 9, 239, 148, 10, 32, 149, 11, 42, 149, 12, 196, 149,
-  15, 84, 150, 16, 129, 150, 17, 155, 150, 18, 41, 162, 19, 134, 162, 21, 2,
-  163, 22, 48, 163, 24, 19, 165, 0, 75, 126, 147, 21, 134, 147, 22, 168, 147,
-  26, 176, 147, 28, 188, 147, 0, 28, 23, 0, 131, 104, 97, 116, 0, 78, 141, 147,
-  21, 150, 147, 0, 21, 8, 8, 16, 0, 130, 97, 116, 0, 8, 22, 17, 18, 16, 0, 136,
-  77, 111, 110, 116, 115, 101, 114, 114, 97, 116, 0, 15, 44, 0, 130, 97, 115,
-  116, 0, 11, 8, 16, 18, 22, 0, 131, 119, 104, 97, 116, 0, 11, 23, 0, 130, 97,
-  116, 0, 68, 211, 147, 8, 239, 147, 12, 68, 148, 17, 79, 148, 24, 90, 148, 0,
-  70, 218, 147, 21, 226, 147, 0, 27, 8, 0, 131, 97, 99, 116, 0, 23, 22, 5, 24,
-  22, 0, 133, 116, 114, 97, 99, 116, 0, 81, 249, 147, 21, 9, 148, 23, 23, 148,
-  0, 17, 18, 6, 12, 7, 0, 134, 115, 99, 111, 110, 110, 101, 99, 116, 0, 24, 22,
-  22, 8, 21, 0, 133, 117, 114, 114, 101, 99, 116, 0, 70, 30, 148, 8, 56, 148, 0,
-  72, 37, 148, 12, 45, 148, 0, 7, 0, 132, 116, 101, 99, 116, 0, 11, 6, 21, 4, 0,
-  132, 116, 101, 99, 116, 0, 11, 6, 21, 4, 0, 132, 105, 116, 101, 99, 116, 0,
-  19, 22, 8, 7, 0, 132, 112, 105, 99, 116, 0, 12, 27, 8, 0, 131, 116, 105, 110,
-  99, 116, 0, 7, 4, 24, 20, 4, 0, 132, 101, 100, 117, 99, 116, 0, 68, 125, 148,
-  7, 133, 148, 12, 147, 148, 15, 180, 148, 17, 208, 148, 18, 221, 148, 19, 228,
-  148, 0, 21, 10, 0, 130, 101, 97, 116, 0, 17, 8, 7, 17, 8, 19, 8, 7, 17, 12, 0,
-  130, 116, 0, 69, 157, 148, 9, 165, 148, 21, 174, 148, 0, 15, 4, 0, 130, 101,
-  105, 116, 0, 21, 18, 9, 0, 130, 101, 105, 116, 0, 26, 0, 129, 116, 101, 0, 73,
-  187, 148, 19, 198, 148, 0, 16, 4, 19, 0, 131, 112, 104, 108, 101, 116, 0, 16,
-  4, 19, 0, 130, 104, 108, 101, 116, 0, 16, 17, 21, 8, 25, 18, 10, 0, 130, 101,
-  110, 116, 0, 21, 26, 0, 129, 116, 101, 0, 21, 8, 23, 17, 12, 0, 129, 114, 101,
-  116, 0, 4, 0, 70, 248, 148, 21, 2, 149, 0, 21, 12, 4, 0, 130, 114, 97, 102,
-  116, 0, 6, 0, 76, 11, 149, 21, 21, 149, 0, 4, 0, 132, 114, 99, 114, 97, 102,
-  116, 0, 21, 12, 4, 0, 133, 99, 114, 97, 102, 116, 0, 11, 24, 4, 6, 0, 130,
-  103, 104, 116, 0, 70, 55, 149, 7, 66, 149, 10, 73, 149, 12, 185, 149, 0, 8,
-  23, 12, 11, 6, 21, 4, 0, 129, 116, 0, 12, 26, 0, 129, 116, 104, 0, 72, 86,
-  149, 12, 96, 149, 17, 126, 149, 24, 133, 149, 0, 12, 11, 0, 132, 101, 105,
-  103, 104, 116, 0, 79, 103, 149, 21, 113, 149, 0, 10, 0, 133, 102, 108, 105,
-  103, 104, 116, 0, 28, 4, 15, 19, 0, 132, 119, 114, 105, 103, 104, 116, 0, 8,
-  15, 0, 129, 116, 104, 0, 68, 140, 149, 18, 161, 149, 0, 73, 147, 149, 22, 154,
-  149, 0, 132, 111, 117, 103, 104, 116, 0, 132, 111, 117, 103, 104, 116, 0, 75,
-  168, 149, 21, 174, 149, 0, 23, 15, 4, 0, 128, 0, 11, 23, 44, 0, 133, 111, 117,
-  103, 104, 116, 0, 10, 17, 18, 23, 0, 131, 105, 103, 104, 116, 0, 68, 212, 149,
-  8, 241, 149, 9, 4, 150, 23, 15, 150, 24, 25, 150, 0, 85, 219, 149, 23, 231,
-  149, 0, 23, 18, 19, 0, 132, 114, 116, 114, 97, 105, 116, 0, 21, 18, 19, 0,
-  130, 114, 97, 105, 116, 0, 11, 17, 8, 21, 4, 9, 0, 136, 70, 97, 104, 114, 101,
-  110, 104, 101, 105, 116, 0, 12, 17, 8, 5, 0, 131, 101, 102, 105, 116, 0, 24,
-  18, 5, 4, 0, 129, 32, 105, 116, 0, 70, 35, 150, 20, 63, 150, 22, 72, 150, 0,
-  76, 42, 150, 21, 52, 150, 0, 21, 12, 6, 0, 132, 99, 117, 105, 116, 0, 24, 6,
-  0, 133, 105, 114, 99, 117, 105, 116, 0, 8, 7, 4, 0, 129, 97, 116, 101, 0, 21,
-  8, 19, 0, 133, 117, 114, 115, 117, 105, 116, 0, 68, 94, 150, 22, 105, 150, 24,
-  115, 150, 0, 24, 22, 22, 4, 0, 131, 97, 117, 108, 116, 0, 24, 8, 21, 0, 131,
-  115, 117, 108, 116, 0, 6, 12, 9, 12, 7, 0, 132, 102, 105, 99, 117, 108, 116,
-  0, 68, 136, 150, 8, 147, 150, 0, 23, 21, 18, 19, 16, 12, 0, 129, 110, 116, 0,
-  23, 23, 4, 0, 128, 112, 116, 0, 68, 180, 150, 8, 226, 153, 12, 107, 161, 16,
-  118, 161, 18, 146, 161, 21, 156, 161, 22, 179, 161, 24, 202, 161, 0, 70, 223,
-  150, 7, 25, 151, 8, 93, 151, 10, 106, 151, 11, 137, 151, 12, 149, 151, 15,
-  221, 151, 16, 57, 152, 17, 83, 152, 21, 217, 152, 22, 59, 153, 23, 70, 153,
-  24, 183, 153, 28, 196, 153, 0, 12, 9, 0, 76, 233, 150, 17, 12, 151, 0, 81,
-  240, 150, 23, 255, 150, 0, 12, 10, 12, 22, 0, 136, 110, 105, 102, 105, 99, 97,
-  110, 116, 0, 21, 18, 5, 4, 0, 132, 97, 99, 105, 101, 110, 116, 0, 10, 12, 22,
-  0, 133, 105, 102, 105, 99, 97, 110, 116, 0, 17, 0, 72, 34, 151, 18, 80, 151,
-  0, 70, 41, 151, 19, 70, 151, 0, 72, 48, 151, 22, 60, 151, 0, 7, 0, 134, 115,
-  99, 101, 110, 100, 97, 110, 116, 0, 17, 4, 21, 23, 0, 130, 101, 110, 116, 0,
-  8, 7, 17, 12, 0, 130, 101, 110, 116, 0, 19, 22, 8, 21, 21, 18, 6, 0, 130, 101,
-  110, 116, 0, 10, 4, 8, 19, 0, 134, 97, 103, 101, 97, 110, 116, 0, 76, 113,
-  151, 18, 126, 151, 0, 9, 12, 17, 10, 12, 22, 0, 131, 99, 97, 110, 116, 0, 21,
-  4, 0, 132, 114, 111, 103, 97, 110, 116, 0, 19, 15, 8, 0, 132, 101, 112, 104,
-  97, 110, 116, 0, 70, 165, 151, 7, 181, 151, 15, 190, 151, 17, 201, 151, 19,
-  211, 151, 0, 12, 9, 17, 10, 12, 22, 0, 134, 105, 102, 105, 99, 97, 110, 116,
-  0, 8, 5, 18, 0, 130, 101, 110, 116, 0, 12, 21, 5, 0, 131, 108, 105, 97, 110,
-  116, 0, 12, 16, 18, 7, 0, 131, 97, 110, 116, 0, 12, 6, 8, 21, 0, 130, 101,
-  110, 116, 0, 72, 234, 151, 12, 8, 152, 15, 21, 152, 24, 46, 152, 0, 25, 0, 72,
-  243, 151, 12, 253, 151, 0, 21, 19, 0, 132, 97, 108, 101, 110, 116, 0, 24, 20,
-  8, 0, 132, 97, 108, 101, 110, 116, 0, 25, 12, 24, 20, 8, 0, 132, 97, 108, 101,
-  110, 116, 0, 72, 28, 152, 12, 37, 152, 0, 6, 27, 8, 0, 130, 101, 110, 116, 0,
-  21, 5, 0, 130, 105, 97, 110, 116, 0, 22, 17, 18, 6, 0, 130, 116, 97, 110, 116,
-  0, 68, 64, 152, 7, 73, 152, 0, 16, 21, 4, 0, 130, 101, 110, 116, 0, 17, 8, 16,
-  4, 0, 130, 101, 110, 116, 0, 68, 96, 152, 8, 106, 152, 12, 183, 152, 18, 193,
-  152, 0, 16, 21, 8, 19, 0, 130, 101, 110, 116, 0, 80, 119, 152, 23, 144, 152,
-  24, 159, 152, 25, 171, 152, 0, 72, 126, 152, 21, 134, 152, 0, 21, 0, 132, 110,
-  97, 110, 116, 0, 8, 19, 0, 132, 97, 110, 101, 110, 116, 0, 24, 8, 15, 0, 135,
-  105, 101, 117, 116, 101, 110, 97, 110, 116, 0, 8, 12, 15, 0, 132, 116, 101,
-  110, 97, 110, 116, 0, 17, 18, 6, 0, 134, 118, 101, 110, 97, 110, 116, 0, 16,
-  18, 21, 19, 0, 130, 101, 110, 116, 0, 19, 0, 80, 202, 152, 19, 210, 152, 0,
-  18, 6, 0, 130, 101, 110, 116, 0, 18, 0, 130, 101, 110, 116, 0, 68, 230, 152,
-  8, 0, 153, 10, 12, 153, 24, 27, 153, 0, 83, 237, 152, 23, 245, 152, 0, 19, 4,
-  0, 130, 101, 110, 116, 0, 22, 8, 21, 0, 131, 117, 114, 97, 110, 116, 0, 10,
-  12, 15, 15, 8, 5, 0, 130, 101, 110, 116, 0, 12, 16, 17, 12, 0, 135, 109, 109,
-  105, 103, 114, 97, 110, 116, 0, 68, 34, 153, 23, 47, 153, 0, 22, 8, 21, 0,
-  133, 116, 97, 117, 114, 97, 110, 116, 0, 22, 8, 21, 0, 132, 97, 117, 114, 97,
-  110, 116, 0, 8, 15, 19, 0, 131, 97, 115, 97, 110, 116, 0, 72, 83, 153, 12, 93,
-  153, 21, 121, 153, 22, 133, 153, 0, 19, 16, 18, 6, 0, 130, 101, 110, 116, 0,
-  79, 100, 153, 22, 111, 153, 0, 15, 12, 16, 0, 133, 105, 116, 97, 110, 116, 0,
-  22, 4, 0, 131, 115, 116, 97, 110, 116, 0, 8, 25, 7, 4, 17, 12, 0, 130, 101,
-  110, 116, 0, 12, 0, 86, 142, 153, 27, 176, 153, 0, 72, 152, 153, 17, 160, 153,
-  21, 168, 153, 0, 11, 0, 132, 116, 97, 110, 116, 0, 18, 6, 0, 130, 101, 110,
-  116, 0, 8, 19, 0, 130, 101, 110, 116, 0, 8, 0, 130, 101, 110, 116, 0, 23, 12,
-  23, 22, 17, 18, 6, 0, 130, 101, 110, 116, 0, 82, 203, 153, 24, 214, 153, 0, 5,
-  44, 0, 132, 117, 111, 121, 97, 110, 116, 0, 18, 5, 44, 0, 133, 117, 111, 121,
-  97, 110, 116, 0, 70, 13, 154, 7, 188, 154, 10, 41, 155, 12, 116, 155, 15, 207,
-  155, 16, 64, 156, 17, 38, 160, 18, 126, 160, 21, 134, 160, 22, 224, 160, 23,
-  234, 160, 24, 72, 161, 25, 86, 161, 29, 96, 161, 0, 72, 23, 154, 12, 35, 154,
-  22, 97, 154, 0, 15, 18, 7, 4, 0, 131, 115, 99, 101, 110, 116, 0, 73, 45, 154,
-  17, 68, 154, 22, 83, 154, 0, 9, 0, 72, 54, 154, 24, 60, 154, 0, 130, 105, 101,
-  110, 116, 0, 22, 0, 130, 105, 101, 110, 116, 0, 8, 16, 8, 21, 0, 134, 105,
-  110, 105, 115, 99, 101, 110, 116, 0, 17, 12, 16, 8, 21, 0, 133, 105, 115, 99,
-  101, 110, 116, 0, 72, 104, 154, 17, 162, 154, 0, 81, 111, 154, 21, 124, 154,
-  0, 12, 16, 8, 21, 0, 133, 105, 115, 99, 101, 110, 116, 0, 82, 131, 154, 24,
-  146, 154, 0, 15, 9, 44, 0, 135, 117, 111, 114, 101, 115, 99, 101, 110, 116, 0,
-  18, 15, 9, 44, 0, 136, 117, 111, 114, 101, 115, 99, 101, 110, 116, 0, 76, 169,
-  154, 18, 181, 154, 0, 16, 8, 21, 0, 132, 105, 115, 99, 101, 110, 116, 0, 6, 0,
-  131, 101, 110, 116, 0, 76, 198, 154, 17, 209, 154, 24, 31, 155, 0, 6, 4, 0,
-  132, 99, 105, 100, 101, 110, 116, 0, 8, 0, 70, 224, 154, 9, 237, 154, 19, 245,
-  154, 23, 23, 155, 0, 8, 7, 0, 134, 115, 99, 101, 110, 100, 97, 110, 116, 0, 8,
-  7, 0, 130, 97, 110, 116, 0, 71, 252, 154, 12, 9, 155, 0, 17, 12, 0, 134, 101,
-  112, 101, 110, 100, 101, 110, 116, 0, 7, 17, 12, 0, 135, 101, 112, 101, 110,
-  100, 101, 110, 116, 0, 23, 4, 0, 130, 97, 110, 116, 0, 22, 0, 132, 116, 117,
-  100, 101, 110, 116, 0, 68, 54, 155, 12, 66, 155, 18, 97, 155, 21, 108, 155, 0,
-  25, 4, 21, 23, 27, 8, 0, 130, 97, 110, 116, 0, 79, 73, 155, 23, 86, 155, 0, 8,
-  23, 17, 12, 0, 132, 108, 105, 103, 101, 110, 116, 0, 17, 18, 6, 0, 131, 110,
-  103, 101, 110, 116, 0, 21, 4, 0, 132, 114, 111, 103, 97, 110, 116, 0, 8, 22,
-  0, 129, 97, 110, 116, 0, 70, 132, 155, 15, 163, 155, 17, 171, 155, 19, 186,
-  155, 21, 199, 155, 0, 72, 139, 155, 12, 151, 155, 0, 9, 9, 8, 0, 133, 105, 99,
-  105, 101, 110, 116, 0, 9, 12, 17, 10, 4, 16, 0, 131, 101, 110, 116, 0, 8, 21,
-  0, 130, 97, 110, 116, 0, 8, 12, 25, 17, 18, 6, 0, 134, 101, 110, 105, 101,
-  110, 116, 0, 8, 6, 8, 21, 0, 133, 105, 112, 105, 101, 110, 116, 0, 4, 25, 0,
-  130, 97, 110, 116, 0, 68, 220, 155, 8, 252, 155, 12, 38, 156, 15, 51, 156, 0,
-  76, 227, 155, 15, 239, 155, 0, 24, 20, 8, 0, 132, 118, 97, 108, 101, 110, 116,
-  0, 25, 12, 24, 20, 8, 0, 133, 97, 108, 101, 110, 116, 0, 70, 6, 156, 25, 15,
-  156, 27, 27, 156, 0, 27, 8, 0, 130, 108, 101, 110, 116, 0, 12, 24, 20, 8, 0,
-  132, 97, 108, 101, 110, 116, 0, 8, 0, 132, 99, 101, 108, 108, 101, 110, 116,
-  0, 25, 12, 24, 20, 8, 0, 132, 97, 108, 101, 110, 116, 0, 8, 27, 8, 0, 133, 99,
-  101, 108, 108, 101, 110, 116, 0, 68, 107, 156, 7, 119, 156, 8, 135, 156, 10,
-  204, 157, 12, 9, 158, 15, 38, 158, 17, 61, 158, 18, 158, 158, 19, 171, 158,
-  21, 222, 158, 22, 91, 159, 23, 160, 159, 24, 203, 159, 25, 235, 159, 0, 12,
-  15, 12, 9, 0, 133, 97, 109, 101, 110, 116, 0, 17, 8, 16, 7, 4, 0, 136, 109,
-  101, 110, 100, 109, 101, 110, 116, 0, 70, 169, 156, 7, 231, 156, 8, 244, 156,
-  10, 41, 157, 15, 97, 157, 17, 111, 157, 19, 123, 157, 22, 140, 157, 23, 152,
-  157, 24, 164, 157, 25, 174, 157, 0, 68, 176, 156, 17, 192, 156, 0, 19, 15, 8,
-  21, 0, 136, 112, 108, 97, 99, 101, 109, 101, 110, 116, 0, 68, 199, 156, 24,
-  215, 156, 0, 11, 6, 17, 8, 0, 137, 104, 97, 110, 99, 101, 109, 101, 110, 116,
-  0, 18, 17, 4, 0, 136, 110, 111, 117, 110, 99, 101, 109, 101, 110, 116, 0, 21,
-  4, 5, 16, 18, 5, 0, 132, 109, 101, 110, 116, 0, 72, 251, 156, 21, 5, 157, 0,
-  21, 10, 4, 0, 132, 109, 101, 110, 116, 0, 10, 0, 68, 14, 157, 10, 30, 157, 0,
-  22, 22, 12, 7, 0, 137, 97, 103, 114, 101, 101, 109, 101, 110, 116, 0, 4, 0,
-  135, 114, 101, 101, 109, 101, 110, 116, 0, 76, 48, 157, 17, 62, 157, 0, 21, 9,
-  17, 12, 0, 133, 110, 103, 101, 109, 101, 110, 116, 0, 68, 69, 157, 8, 83, 157,
-  0, 21, 4, 0, 135, 114, 97, 110, 103, 101, 109, 101, 110, 116, 0, 21, 21, 4, 0,
-  135, 97, 110, 103, 101, 109, 101, 110, 116, 0, 8, 23, 23, 8, 22, 0, 134, 108,
-  101, 109, 101, 110, 116, 0, 10, 12, 22, 8, 21, 0, 132, 109, 101, 110, 116, 0,
-  18, 15, 18, 25, 8, 7, 0, 136, 101, 108, 111, 112, 109, 101, 110, 116, 0, 22,
-  4, 21, 4, 11, 0, 132, 109, 101, 110, 116, 0, 6, 12, 7, 17, 12, 0, 132, 109,
-  101, 110, 116, 0, 10, 21, 4, 0, 132, 109, 101, 110, 116, 0, 76, 181, 157, 18,
-  194, 157, 0, 11, 6, 4, 0, 133, 101, 118, 101, 109, 101, 110, 116, 0, 10, 0,
-  131, 114, 110, 109, 101, 110, 116, 0, 68, 214, 157, 17, 241, 157, 21, 253,
-  157, 0, 74, 221, 157, 17, 231, 157, 0, 17, 8, 0, 131, 101, 109, 101, 110, 116,
-  0, 4, 16, 0, 131, 101, 109, 101, 110, 116, 0, 4, 21, 21, 4, 0, 131, 101, 109,
-  101, 110, 116, 0, 4, 15, 17, 8, 0, 131, 101, 109, 101, 110, 116, 0, 15, 0, 83,
-  18, 158, 21, 28, 158, 0, 16, 12, 0, 132, 101, 109, 101, 110, 116, 0, 4, 19, 0,
-  131, 97, 109, 101, 110, 116, 0, 72, 45, 158, 23, 50, 158, 0, 11, 0, 129, 116,
-  0, 23, 8, 22, 0, 131, 101, 109, 101, 110, 116, 0, 72, 74, 158, 12, 86, 158,
-  18, 104, 158, 21, 124, 158, 0, 25, 18, 10, 0, 132, 114, 110, 109, 101, 110,
-  116, 0, 23, 4, 21, 8, 23, 17, 8, 0, 135, 116, 97, 105, 110, 109, 101, 110,
-  116, 0, 22, 12, 21, 19, 17, 12, 0, 138, 109, 112, 114, 105, 115, 111, 110,
-  109, 101, 110, 116, 0, 18, 0, 76, 133, 158, 25, 146, 158, 0, 25, 17, 8, 0,
-  134, 114, 111, 110, 109, 101, 110, 116, 0, 18, 10, 0, 134, 101, 114, 110, 109,
-  101, 110, 116, 0, 21, 12, 25, 17, 8, 0, 131, 110, 109, 101, 110, 116, 0, 79,
-  181, 158, 18, 194, 158, 19, 211, 158, 0, 8, 25, 8, 7, 0, 132, 111, 112, 109,
-  101, 110, 116, 0, 25, 8, 15, 8, 7, 0, 136, 118, 101, 108, 111, 112, 109, 101,
-  110, 116, 0, 12, 24, 20, 8, 0, 132, 109, 101, 110, 116, 0, 68, 238, 158, 8,
-  23, 159, 12, 34, 159, 17, 46, 159, 18, 59, 159, 0, 69, 245, 158, 19, 0, 159,
-  0, 16, 18, 5, 0, 131, 100, 109, 101, 110, 116, 0, 68, 7, 159, 8, 14, 159, 0,
-  131, 116, 109, 101, 110, 116, 0, 7, 0, 131, 116, 109, 101, 110, 116, 0, 25,
-  18, 10, 0, 131, 110, 109, 101, 110, 116, 0, 24, 20, 8, 21, 0, 131, 101, 109,
-  101, 110, 116, 0, 8, 25, 18, 10, 0, 133, 114, 110, 109, 101, 110, 116, 0, 76,
-  66, 159, 25, 79, 159, 0, 25, 17, 8, 0, 133, 114, 111, 110, 109, 101, 110, 116,
-  0, 18, 10, 0, 133, 101, 114, 110, 109, 101, 110, 116, 0, 68, 101, 159, 12,
-  131, 159, 22, 145, 159, 0, 21, 0, 68, 110, 159, 21, 119, 159, 0, 11, 0, 131,
-  115, 109, 101, 110, 116, 0, 4, 11, 0, 134, 97, 115, 115, 109, 101, 110, 116,
-  0, 23, 21, 8, 25, 7, 4, 0, 131, 101, 109, 101, 110, 116, 0, 4, 21, 21, 4, 11,
-  0, 135, 97, 115, 115, 109, 101, 110, 116, 0, 68, 170, 159, 17, 180, 159, 23,
-  191, 159, 0, 23, 22, 0, 131, 101, 109, 101, 110, 116, 0, 8, 23, 17, 18, 6, 22,
-  12, 7, 0, 131, 0, 12, 16, 16, 18, 6, 0, 132, 109, 101, 110, 116, 0, 70, 210,
-  159, 21, 221, 159, 0, 6, 18, 7, 0, 133, 117, 109, 101, 110, 116, 0, 23, 17,
-  12, 0, 134, 115, 116, 114, 117, 109, 101, 110, 116, 0, 72, 245, 159, 15, 1,
-  160, 18, 13, 160, 0, 12, 11, 6, 4, 0, 131, 101, 109, 101, 110, 116, 0, 18, 25,
-  17, 12, 0, 131, 101, 109, 101, 110, 116, 0, 80, 20, 160, 21, 27, 160, 0, 131,
-  101, 109, 101, 110, 116, 0, 19, 16, 12, 0, 131, 101, 109, 101, 110, 116, 0,
-  76, 45, 160, 18, 86, 160, 0, 72, 52, 160, 16, 64, 160, 0, 25, 17, 18, 6, 0,
-  132, 110, 105, 101, 110, 116, 0, 72, 71, 160, 18, 79, 160, 0, 21, 0, 132, 110,
-  97, 110, 116, 0, 7, 0, 130, 97, 110, 116, 0, 81, 96, 160, 19, 106, 160, 22,
-  117, 160, 0, 18, 19, 19, 18, 0, 132, 101, 110, 116, 0, 18, 44, 0, 132, 112,
-  111, 110, 101, 110, 116, 0, 17, 18, 6, 0, 130, 97, 110, 116, 0, 16, 0, 130,
-  109, 101, 110, 116, 0, 68, 147, 160, 8, 158, 160, 9, 170, 160, 21, 181, 160,
-  0, 19, 4, 0, 132, 112, 97, 114, 101, 110, 116, 0, 9, 12, 7, 0, 132, 102, 101,
-  114, 101, 110, 116, 0, 9, 12, 7, 0, 131, 101, 114, 101, 110, 116, 0, 68, 188,
-  160, 8, 212, 160, 0, 19, 0, 68, 197, 160, 19, 205, 160, 0, 133, 112, 97, 114,
-  101, 110, 116, 0, 4, 0, 131, 101, 110, 116, 0, 9, 12, 7, 0, 133, 102, 101,
-  114, 101, 110, 116, 0, 4, 8, 15, 19, 0, 130, 97, 110, 116, 0, 72, 247, 160,
-  12, 6, 161, 17, 33, 161, 22, 43, 161, 0, 23, 19, 16, 18, 6, 17, 12, 0, 133,
-  101, 116, 101, 110, 116, 0, 83, 13, 161, 21, 24, 161, 0, 16, 18, 6, 0, 132,
-  101, 116, 101, 110, 116, 0, 23, 24, 17, 0, 131, 101, 110, 116, 0, 8, 19, 8,
-  21, 0, 130, 97, 110, 116, 0, 12, 0, 85, 52, 161, 22, 64, 161, 0, 8, 19, 0,
-  133, 115, 105, 115, 116, 101, 110, 116, 0, 8, 21, 0, 130, 97, 110, 116, 0, 20,
-  22, 5, 24, 22, 0, 132, 101, 113, 117, 101, 110, 116, 0, 8, 15, 8, 21, 0, 130,
-  97, 110, 116, 0, 12, 17, 10, 18, 6, 0, 130, 97, 110, 116, 0, 18, 17, 17, 4, 0,
-  132, 111, 105, 110, 116, 0, 8, 0, 72, 127, 161, 22, 136, 161, 0, 21, 10, 4, 0,
-  129, 101, 110, 116, 0, 24, 16, 8, 5, 0, 129, 101, 110, 116, 0, 16, 4, 10, 21,
-  8, 5, 0, 129, 116, 0, 68, 163, 161, 8, 169, 161, 0, 8, 0, 128, 101, 100, 0, 9,
-  9, 12, 7, 0, 129, 101, 110, 116, 0, 76, 186, 161, 18, 195, 161, 0, 4, 10, 4,
-  0, 130, 110, 115, 116, 0, 6, 0, 130, 110, 115, 116, 0, 68, 212, 161, 7, 21,
-  162, 18, 31, 162, 0, 21, 0, 68, 224, 161, 8, 236, 161, 24, 249, 161, 0, 23,
-  22, 8, 21, 0, 132, 117, 114, 97, 110, 116, 0, 23, 22, 8, 21, 0, 133, 97, 117,
-  114, 97, 110, 116, 0, 68, 0, 162, 23, 9, 162, 0, 23, 22, 8, 21, 0, 130, 110,
-  116, 0, 22, 8, 21, 0, 133, 97, 117, 114, 97, 110, 116, 0, 17, 24, 5, 4, 0,
-  130, 97, 110, 116, 0, 16, 16, 4, 0, 132, 111, 117, 110, 116, 0, 76, 54, 162,
-  17, 66, 162, 21, 90, 162, 22, 99, 162, 0, 21, 23, 4, 19, 27, 8, 0, 129, 97,
-  116, 101, 0, 71, 73, 162, 17, 82, 162, 0, 12, 7, 0, 130, 32, 110, 111, 116, 0,
-  17, 4, 6, 0, 130, 111, 116, 0, 19, 8, 21, 0, 130, 111, 114, 116, 0, 79, 109,
-  162, 16, 113, 162, 22, 121, 162, 0, 4, 0, 128, 0, 15, 4, 0, 130, 111, 115,
-  116, 0, 8, 6, 24, 22, 0, 132, 99, 101, 115, 115, 111, 114, 0, 72, 153, 162,
-  16, 191, 162, 18, 201, 162, 21, 210, 162, 24, 236, 162, 28, 248, 162, 0, 76,
-  163, 162, 22, 173, 162, 27, 183, 162, 0, 6, 8, 21, 0, 131, 101, 105, 112, 116,
-  0, 17, 18, 6, 0, 131, 99, 101, 112, 116, 0, 8, 0, 130, 99, 101, 112, 116, 0,
-  4, 27, 8, 0, 131, 101, 109, 112, 116, 0, 7, 7, 4, 0, 131, 111, 112, 116, 0,
-  72, 217, 162, 12, 227, 162, 0, 27, 8, 0, 131, 99, 101, 114, 112, 116, 0, 6,
-  22, 0, 131, 114, 105, 112, 116, 0, 21, 8, 23, 17, 12, 0, 130, 114, 117, 112,
-  116, 0, 6, 17, 8, 0, 130, 114, 121, 112, 116, 0, 68, 9, 163, 18, 18, 163, 0,
-  19, 19, 4, 0, 131, 97, 114, 116, 0, 19, 0, 76, 27, 163, 19, 36, 163, 0, 4, 0,
-  131, 114, 112, 111, 114, 116, 0, 24, 26, 0, 134, 115, 117, 112, 112, 111, 114,
-  116, 0, 68, 76, 163, 8, 91, 163, 10, 163, 163, 12, 193, 163, 16, 209, 164, 17,
-  219, 164, 18, 229, 164, 24, 255, 164, 28, 6, 165, 0, 6, 7, 4, 21, 5, 0, 133,
-  111, 97, 100, 99, 97, 115, 116, 0, 74, 101, 163, 12, 124, 163, 21, 152, 163,
-  0, 76, 108, 163, 24, 116, 163, 0, 11, 0, 130, 104, 101, 115, 116, 0, 22, 0,
-  130, 103, 101, 115, 116, 0, 75, 131, 163, 25, 140, 163, 0, 23, 4, 0, 131, 101,
-  105, 115, 116, 0, 4, 11, 0, 133, 101, 97, 118, 105, 101, 115, 116, 0, 23, 17,
-  12, 0, 131, 101, 114, 101, 115, 116, 0, 72, 170, 163, 21, 185, 163, 0, 17, 21,
-  18, 23, 22, 0, 134, 114, 111, 110, 103, 101, 115, 116, 0, 4, 15, 0, 129, 101,
-  115, 116, 0, 70, 209, 163, 9, 219, 163, 10, 231, 163, 16, 90, 164, 17, 123,
-  164, 0, 4, 9, 0, 131, 115, 99, 105, 115, 116, 0, 8, 17, 4, 16, 0, 132, 105,
-  102, 101, 115, 116, 0, 79, 238, 163, 18, 254, 163, 0, 18, 19, 18, 21, 11, 23,
-  17, 4, 0, 131, 111, 103, 105, 115, 116, 0, 15, 18, 0, 68, 11, 164, 16, 26,
-  164, 21, 74, 164, 0, 8, 11, 6, 21, 4, 0, 135, 111, 108, 111, 103, 105, 115,
-  116, 0, 68, 33, 164, 15, 53, 164, 0, 11, 23, 19, 18, 0, 138, 104, 116, 104,
-  97, 108, 109, 111, 108, 111, 103, 105, 115, 116, 0, 4, 11, 23, 19, 18, 0, 139,
-  104, 116, 104, 97, 108, 109, 111, 108, 111, 103, 105, 115, 116, 0, 8, 23, 8,
-  16, 0, 135, 111, 114, 111, 108, 111, 103, 105, 115, 116, 0, 82, 97, 164, 21,
-  110, 164, 0, 21, 9, 8, 21, 0, 133, 111, 114, 109, 105, 115, 116, 0, 8, 23, 27,
-  8, 0, 133, 114, 101, 109, 105, 115, 116, 0, 68, 133, 164, 12, 180, 164, 28,
-  192, 164, 0, 10, 0, 68, 142, 164, 18, 166, 164, 0, 108, 149, 164, 23, 155,
-  164, 0, 131, 105, 110, 115, 116, 0, 18, 21, 19, 0, 132, 111, 110, 105, 115,
-  116, 0, 23, 18, 21, 19, 0, 134, 97, 103, 111, 110, 105, 115, 116, 0, 16, 16,
-  8, 9, 0, 133, 105, 110, 105, 115, 116, 0, 10, 18, 22, 28, 16, 0, 136, 105,
-  115, 111, 103, 121, 110, 105, 115, 116, 0, 18, 15, 4, 0, 131, 109, 111, 115,
-  116, 0, 17, 12, 4, 10, 4, 0, 130, 115, 116, 0, 68, 236, 164, 16, 244, 164, 0,
-  6, 0, 131, 111, 97, 115, 116, 0, 21, 18, 9, 0, 131, 101, 109, 111, 115, 116,
-  0, 18, 16, 4, 9, 0, 128, 0, 11, 23, 21, 4, 6, 6, 16, 0, 129, 105, 115, 116, 0,
-  70, 35, 165, 18, 43, 165, 19, 86, 165, 22, 109, 165, 23, 116, 165, 0, 21, 12,
-  6, 0, 128, 105, 116, 0, 68, 53, 165, 5, 62, 165, 11, 70, 165, 0, 5, 0, 132,
-  97, 98, 111, 117, 116, 0, 5, 4, 0, 131, 111, 117, 116, 0, 10, 24, 18, 11, 23,
-  0, 134, 114, 111, 117, 103, 104, 111, 117, 116, 0, 87, 93, 165, 24, 101, 165,
-  0, 17, 12, 0, 131, 112, 117, 116, 0, 18, 0, 130, 116, 112, 117, 116, 0, 13, 0,
-  130, 117, 115, 116, 0, 19, 24, 18, 0, 131, 116, 112, 117, 116, 0, 68, 142,
-  165, 8, 169, 165, 19, 192, 165, 23, 200, 165, 28, 221, 165, 0, 8, 0, 79, 151,
-  165, 25, 159, 165, 0, 12, 16, 0, 130, 105, 101, 117, 0, 18, 17, 0, 131, 117,
-  118, 101, 97, 117, 0, 79, 176, 165, 23, 184, 165, 0, 12, 16, 0, 129, 105, 101,
-  117, 0, 4, 15, 19, 0, 128, 97, 117, 0, 18, 21, 10, 0, 129, 117, 112, 0, 82,
-  207, 165, 22, 214, 165, 0, 5, 4, 0, 129, 117, 116, 0, 13, 0, 130, 117, 115,
-  116, 0, 15, 14, 6, 12, 24, 20, 0, 128, 0, 72, 240, 165, 12, 27, 166, 15, 38,
-  166, 0, 68, 253, 165, 11, 4, 166, 12, 12, 166, 18, 20, 166, 0, 11, 44, 0, 129,
-  118, 101, 0, 4, 0, 131, 104, 97, 118, 101, 0, 8, 6, 8, 21, 0, 129, 118, 0, 15,
-  44, 0, 129, 118, 101, 0, 8, 11, 6, 4, 0, 130, 105, 101, 118, 101, 0, 8, 22,
-  16, 12, 11, 0, 128, 102, 0, 68, 57, 166, 12, 68, 166, 18, 78, 166, 0, 22, 21,
-  18, 9, 0, 130, 101, 115, 97, 119, 0, 8, 25, 8, 21, 0, 130, 105, 101, 119, 0,
-  71, 88, 166, 14, 97, 166, 21, 105, 166, 0, 7, 4, 11, 22, 0, 130, 111, 119, 0,
-  17, 0, 131, 107, 110, 111, 119, 0, 82, 112, 166, 21, 124, 166, 0, 16, 16, 18,
-  23, 0, 132, 111, 114, 114, 111, 119, 0, 18, 16, 16, 18, 23, 0, 133, 111, 114,
-  114, 111, 119, 0, 72, 144, 166, 24, 155, 166, 0, 17, 8, 15, 14, 0, 130, 101,
-  110, 101, 120, 0, 8, 12, 15, 8, 16, 0, 133, 105, 108, 105, 101, 117, 120, 0,
-  68, 221, 166, 6, 41, 167, 7, 130, 168, 8, 229, 168, 9, 172, 169, 10, 199, 169,
-  11, 159, 170, 12, 32, 171, 15, 43, 171, 16, 27, 182, 17, 91, 182, 19, 11, 183,
-  21, 60, 183, 22, 50, 188, 23, 99, 188, 24, 188, 192, 26, 199, 192, 0, 71, 234,
-  166, 21, 246, 166, 23, 20, 167, 26, 31, 167, 0, 12, 15, 15, 18, 11, 0, 132,
-  105, 100, 97, 121, 0, 85, 253, 166, 23, 10, 167, 0, 4, 22, 22, 12, 7, 0, 133,
-  97, 114, 114, 97, 121, 0, 18, 19, 0, 131, 114, 116, 114, 97, 121, 0, 17, 8,
-  16, 8, 15, 8, 0, 128, 114, 121, 0, 10, 12, 11, 0, 130, 104, 119, 97, 121, 0,
-  68, 63, 167, 8, 176, 167, 12, 187, 167, 17, 198, 167, 19, 74, 168, 21, 86,
-  168, 23, 114, 168, 0, 71, 73, 167, 11, 83, 167, 21, 93, 167, 0, 17, 8, 23, 0,
-  130, 101, 110, 99, 121, 0, 19, 18, 21, 19, 0, 130, 101, 99, 121, 0, 70, 100,
-  167, 24, 165, 167, 0, 81, 110, 167, 18, 121, 167, 21, 153, 167, 0, 28, 22, 18,
-  12, 7, 12, 0, 129, 115, 121, 0, 83, 128, 167, 21, 136, 167, 0, 28, 11, 0, 130,
-  105, 115, 121, 0, 24, 4, 8, 5, 0, 137, 117, 114, 101, 97, 117, 99, 114, 97,
-  99, 121, 0, 18, 16, 8, 7, 0, 133, 99, 114, 97, 99, 121, 0, 6, 4, 0, 132, 99,
-  117, 114, 97, 99, 121, 0, 24, 20, 8, 21, 9, 0, 129, 110, 99, 121, 0, 21, 6,
-  18, 19, 28, 11, 0, 129, 115, 121, 0, 68, 205, 167, 8, 20, 168, 0, 71, 218,
-  167, 16, 243, 167, 18, 253, 167, 28, 7, 168, 0, 17, 8, 0, 83, 228, 167, 23,
-  237, 167, 0, 8, 7, 0, 131, 101, 110, 99, 121, 0, 131, 101, 110, 99, 121, 0,
-  18, 15, 19, 12, 7, 0, 130, 99, 121, 0, 24, 5, 0, 131, 121, 97, 110, 99, 121,
-  0, 24, 18, 5, 0, 134, 117, 111, 121, 97, 110, 99, 121, 0, 70, 30, 168, 12, 42,
-  168, 24, 57, 168, 0, 12, 9, 9, 8, 0, 131, 105, 101, 110, 99, 121, 0, 6, 8, 9,
-  9, 8, 0, 134, 105, 99, 105, 101, 110, 99, 121, 0, 23, 12, 22, 17, 18, 6, 0,
-  134, 116, 105, 116, 117, 101, 110, 99, 121, 0, 24, 21, 14, 17, 4, 5, 0, 129,
-  116, 99, 121, 0, 68, 93, 168, 8, 102, 168, 0, 21, 8, 12, 11, 0, 128, 104, 121,
-  0, 25, 18, 21, 23, 17, 18, 6, 0, 129, 115, 121, 0, 19, 24, 21, 17, 4, 5, 0,
-  133, 107, 114, 117, 112, 116, 99, 121, 0, 68, 146, 168, 7, 187, 168, 8, 194,
-  168, 12, 204, 168, 21, 215, 168, 0, 72, 153, 168, 18, 180, 168, 0, 21, 0, 68,
-  162, 168, 15, 170, 168, 0, 132, 108, 114, 101, 97, 100, 121, 0, 15, 4, 0, 133,
-  114, 101, 97, 100, 121, 0, 21, 5, 0, 128, 108, 121, 0, 24, 23, 22, 0, 129,
-  121, 0, 10, 8, 15, 15, 4, 0, 128, 108, 121, 0, 10, 18, 21, 19, 0, 131, 100,
-  105, 103, 121, 0, 4, 19, 4, 8, 13, 0, 133, 111, 112, 97, 114, 100, 121, 0, 76,
-  248, 168, 15, 0, 169, 17, 98, 169, 21, 138, 169, 22, 150, 169, 23, 163, 169,
-  0, 21, 4, 25, 0, 128, 116, 121, 0, 69, 22, 169, 17, 30, 169, 18, 38, 169, 19,
-  44, 169, 21, 51, 169, 23, 77, 169, 25, 90, 169, 0, 4, 23, 18, 17, 0, 129, 121,
-  0, 18, 15, 0, 130, 101, 108, 121, 0, 22, 0, 128, 108, 121, 0, 16, 12, 22, 0,
-  129, 121, 0, 8, 0, 70, 60, 169, 25, 69, 169, 0, 17, 12, 22, 0, 130, 101, 108,
-  121, 0, 8, 22, 0, 130, 101, 108, 121, 0, 4, 12, 7, 8, 16, 16, 12, 0, 130, 101,
-  108, 121, 0, 12, 15, 0, 130, 101, 108, 121, 0, 76, 108, 169, 21, 117, 169, 24,
-  129, 169, 0, 6, 12, 7, 8, 16, 0, 129, 121, 0, 18, 23, 4, 0, 132, 116, 111,
-  114, 110, 101, 121, 0, 18, 13, 0, 130, 114, 110, 101, 121, 0, 4, 23, 8, 16, 8,
-  6, 0, 131, 101, 114, 121, 0, 21, 8, 25, 18, 21, 23, 17, 18, 6, 0, 129, 121, 0,
-  9, 4, 22, 0, 130, 101, 116, 121, 0, 12, 0, 79, 181, 169, 24, 190, 169, 0, 15,
-  12, 25, 0, 131, 105, 102, 121, 0, 20, 12, 15, 0, 130, 101, 102, 121, 0, 72,
-  212, 169, 15, 243, 169, 18, 1, 170, 21, 145, 170, 0, 71, 219, 169, 23, 230,
-  169, 0, 4, 21, 23, 22, 0, 131, 116, 101, 103, 121, 0, 21, 4, 23, 22, 0, 133,
-  114, 97, 116, 101, 103, 121, 0, 18, 19, 18, 21, 11, 23, 17, 4, 0, 129, 111,
-  103, 121, 0, 15, 0, 68, 13, 170, 8, 24, 170, 18, 57, 170, 0, 8, 7, 12, 0, 132,
-  111, 108, 111, 103, 121, 0, 68, 31, 170, 18, 43, 170, 0, 11, 6, 21, 4, 0, 131,
-  111, 108, 111, 103, 121, 0, 4, 11, 6, 21, 4, 0, 134, 101, 111, 108, 111, 103,
-  121, 0, 68, 76, 170, 6, 89, 170, 8, 101, 170, 12, 112, 170, 19, 121, 170, 21,
-  131, 170, 0, 11, 6, 21, 4, 0, 133, 101, 111, 108, 111, 103, 121, 0, 28, 22,
-  19, 0, 132, 104, 111, 108, 111, 103, 121, 0, 17, 8, 10, 0, 132, 97, 108, 111,
-  103, 121, 0, 21, 23, 0, 132, 108, 111, 103, 121, 0, 19, 4, 0, 133, 111, 108,
-  111, 103, 121, 0, 8, 23, 8, 16, 0, 133, 111, 114, 111, 108, 111, 103, 121, 0,
-  24, 15, 4, 23, 8, 16, 0, 131, 108, 117, 114, 103, 121, 0, 70, 169, 170, 19,
-  181, 170, 23, 6, 171, 0, 4, 21, 8, 12, 11, 0, 130, 114, 99, 104, 121, 0, 68,
-  191, 170, 18, 235, 170, 22, 250, 170, 0, 21, 10, 0, 76, 201, 170, 18, 215,
-  170, 0, 15, 4, 6, 0, 134, 108, 105, 103, 114, 97, 112, 104, 121, 0, 12, 5, 18,
-  11, 23, 24, 4, 0, 138, 111, 98, 105, 111, 103, 114, 97, 112, 104, 121, 0, 22,
-  12, 15, 12, 11, 19, 0, 133, 111, 115, 111, 112, 104, 121, 0, 18, 15, 12, 11,
-  19, 0, 130, 111, 112, 104, 121, 0, 68, 13, 171, 12, 22, 171, 0, 8, 11, 0, 130,
-  108, 116, 104, 121, 0, 21, 18, 11, 23, 24, 4, 0, 129, 121, 0, 23, 12, 23, 17,
-  4, 24, 20, 0, 129, 121, 0, 68, 101, 171, 5, 248, 172, 6, 233, 173, 7, 51, 174,
-  8, 139, 174, 10, 10, 176, 11, 94, 176, 12, 104, 176, 14, 64, 177, 15, 72, 177,
-  16, 179, 179, 17, 207, 179, 18, 20, 180, 19, 30, 180, 21, 43, 180, 22, 127,
-  180, 23, 152, 180, 24, 179, 181, 25, 220, 181, 0, 69, 129, 171, 6, 138, 171,
-  12, 221, 171, 15, 30, 172, 17, 39, 172, 19, 106, 172, 21, 118, 172, 23, 168,
-  172, 24, 180, 172, 0, 18, 21, 19, 0, 129, 98, 108, 121, 0, 12, 0, 79, 159,
-  171, 16, 167, 171, 17, 175, 171, 19, 183, 171, 22, 190, 171, 23, 210, 171, 0,
-  5, 24, 19, 0, 130, 108, 121, 0, 8, 11, 6, 0, 128, 108, 121, 0, 12, 15, 6, 0,
-  128, 108, 121, 0, 28, 23, 0, 128, 108, 121, 0, 68, 197, 171, 28, 203, 171, 0,
-  5, 0, 128, 108, 121, 0, 11, 19, 0, 128, 108, 121, 0, 4, 16, 16, 4, 21, 10, 0,
-  128, 108, 121, 0, 70, 228, 171, 23, 7, 172, 0, 72, 238, 171, 12, 246, 171, 17,
-  254, 171, 0, 19, 22, 8, 0, 128, 108, 121, 0, 9, 9, 18, 0, 128, 108, 121, 0, 4,
-  17, 12, 9, 0, 128, 108, 121, 0, 81, 14, 172, 21, 23, 172, 0, 8, 22, 22, 8, 0,
-  128, 108, 121, 0, 4, 19, 0, 128, 108, 121, 0, 8, 21, 0, 131, 97, 108, 108,
-  121, 0, 68, 49, 172, 12, 62, 172, 18, 81, 172, 0, 10, 12, 21, 18, 0, 132, 105,
-  110, 97, 108, 108, 121, 0, 73, 69, 172, 10, 73, 172, 0, 128, 108, 121, 0, 12,
-  21, 18, 0, 128, 108, 121, 0, 12, 23, 12, 7, 0, 68, 93, 172, 7, 100, 172, 0,
-  21, 23, 0, 128, 108, 121, 0, 4, 0, 128, 108, 121, 0, 12, 6, 17, 12, 21, 19, 0,
-  128, 105, 116, 121, 0, 72, 125, 172, 24, 160, 172, 0, 81, 132, 172, 23, 139,
-  172, 0, 8, 10, 0, 128, 108, 121, 0, 68, 146, 172, 12, 154, 172, 0, 15, 12, 5,
-  0, 128, 108, 121, 0, 15, 0, 128, 108, 121, 0, 23, 4, 17, 0, 128, 108, 121, 0,
-  17, 8, 7, 12, 6, 6, 4, 0, 128, 108, 121, 0, 71, 193, 172, 17, 204, 172, 22,
-  211, 172, 23, 217, 172, 0, 12, 25, 12, 7, 17, 12, 0, 128, 108, 121, 0, 17, 4,
-  0, 128, 108, 121, 0, 24, 0, 128, 108, 121, 0, 70, 227, 172, 17, 233, 172, 21,
-  241, 172, 0, 4, 0, 128, 108, 121, 0, 8, 25, 8, 0, 128, 108, 121, 0, 12, 25, 0,
-  128, 108, 121, 0, 68, 5, 173, 5, 152, 173, 12, 166, 173, 24, 223, 173, 0, 70,
-  24, 173, 8, 36, 173, 10, 46, 173, 21, 63, 173, 22, 76, 173, 23, 100, 173, 0,
-  12, 23, 18, 17, 0, 131, 101, 97, 98, 108, 121, 0, 23, 18, 17, 0, 132, 97, 98,
-  108, 121, 0, 17, 4, 11, 6, 21, 8, 23, 17, 12, 0, 131, 101, 97, 98, 108, 121,
-  0, 21, 8, 9, 8, 21, 19, 0, 132, 97, 98, 108, 121, 0, 76, 83, 173, 22, 91, 173,
-  0, 25, 0, 131, 105, 98, 108, 121, 0, 18, 19, 0, 131, 105, 98, 108, 121, 0, 76,
-  107, 173, 22, 120, 173, 0, 23, 12, 25, 8, 17, 12, 0, 133, 97, 98, 108, 121, 0,
-  12, 22, 8, 21, 0, 76, 132, 173, 21, 144, 173, 0, 136, 114, 101, 115, 105, 115,
-  116, 105, 98, 108, 121, 0, 12, 0, 131, 105, 98, 108, 121, 0, 4, 6, 8, 19, 16,
-  12, 0, 132, 99, 97, 98, 108, 121, 0, 80, 173, 173, 23, 185, 173, 0, 24, 22, 8,
-  21, 19, 0, 131, 97, 98, 108, 121, 0, 86, 192, 173, 24, 210, 173, 0, 12, 22, 8,
-  21, 12, 0, 136, 114, 101, 115, 105, 115, 116, 105, 98, 108, 121, 0, 19, 22,
-  12, 7, 17, 12, 0, 131, 97, 98, 108, 121, 0, 10, 21, 4, 0, 130, 97, 98, 108,
-  121, 0, 76, 240, 173, 21, 42, 174, 0, 81, 250, 173, 22, 4, 174, 23, 13, 174,
-  0, 18, 21, 12, 0, 129, 97, 108, 108, 121, 0, 4, 5, 0, 129, 97, 108, 108, 121,
-  0, 68, 20, 174, 6, 32, 174, 0, 16, 18, 23, 24, 4, 0, 129, 97, 108, 108, 121,
-  0, 4, 21, 19, 0, 129, 97, 108, 108, 121, 0, 8, 12, 9, 0, 129, 101, 108, 121,
-  0, 68, 61, 174, 8, 94, 174, 21, 125, 174, 0, 72, 68, 174, 23, 82, 174, 0, 23,
-  8, 19, 8, 21, 0, 133, 97, 116, 101, 100, 108, 121, 0, 21, 18, 19, 8, 21, 0,
-  131, 101, 100, 108, 121, 0, 86, 101, 174, 23, 111, 174, 0, 18, 19, 21, 24, 19,
-  0, 130, 108, 121, 0, 18, 19, 21, 24, 19, 0, 132, 114, 116, 101, 100, 108, 121,
-  0, 18, 26, 21, 8, 11, 23, 18, 0, 130, 108, 100, 108, 121, 0, 69, 164, 174, 7,
-  176, 174, 10, 202, 174, 16, 212, 174, 21, 242, 174, 23, 253, 174, 24, 153,
-  175, 25, 160, 175, 0, 4, 16, 24, 22, 8, 21, 19, 0, 130, 108, 121, 0, 72, 183,
-  174, 12, 193, 174, 0, 10, 8, 15, 15, 4, 0, 130, 108, 121, 0, 6, 8, 7, 0, 129,
-  100, 108, 121, 0, 8, 15, 15, 4, 0, 129, 100, 108, 121, 0, 72, 219, 174, 12,
-  231, 174, 0, 23, 27, 8, 0, 132, 114, 101, 109, 101, 108, 121, 0, 23, 15, 24,
-  0, 130, 97, 116, 101, 108, 121, 0, 24, 23, 4, 17, 0, 130, 97, 108, 108, 121,
-  0, 68, 7, 175, 5, 126, 175, 12, 137, 175, 0, 71, 17, 175, 12, 32, 175, 16,
-  109, 175, 0, 12, 16, 16, 12, 0, 134, 101, 100, 105, 97, 116, 101, 108, 121, 0,
-  71, 39, 175, 27, 95, 175, 0, 72, 46, 175, 12, 81, 175, 0, 16, 0, 76, 55, 175,
-  16, 66, 175, 0, 135, 109, 101, 100, 105, 97, 116, 101, 108, 121, 0, 8, 0, 138,
-  105, 109, 109, 101, 100, 105, 97, 116, 101, 108, 121, 0, 16, 16, 12, 0, 135,
-  101, 100, 105, 97, 116, 101, 108, 121, 0, 18, 21, 19, 19, 4, 0, 132, 109, 97,
-  116, 101, 108, 121, 0, 4, 27, 18, 21, 19, 19, 4, 0, 134, 105, 109, 97, 116,
-  101, 108, 121, 0, 24, 18, 7, 17, 24, 0, 129, 100, 108, 121, 0, 16, 12, 27, 18,
-  21, 19, 19, 4, 0, 132, 97, 116, 101, 108, 121, 0, 21, 23, 0, 130, 108, 121, 0,
-  68, 170, 175, 12, 185, 175, 23, 250, 175, 0, 23, 12, 15, 8, 21, 0, 134, 97,
-  116, 105, 118, 101, 108, 121, 0, 86, 192, 175, 23, 209, 175, 0, 17, 8, 9, 9,
-  8, 7, 0, 136, 101, 110, 115, 105, 118, 101, 108, 121, 0, 6, 8, 0, 83, 219,
-  175, 22, 234, 175, 0, 8, 21, 0, 136, 115, 112, 101, 99, 116, 105, 118, 101,
-  108, 121, 0, 19, 8, 21, 0, 137, 115, 112, 101, 99, 116, 105, 118, 101, 108,
-  121, 0, 12, 15, 4, 8, 21, 0, 135, 108, 97, 116, 105, 118, 101, 108, 121, 0,
-  81, 17, 176, 24, 86, 176, 0, 76, 24, 176, 18, 77, 176, 0, 71, 34, 176, 21, 50,
-  176, 22, 65, 176, 0, 8, 8, 27, 8, 0, 135, 99, 101, 101, 100, 105, 110, 103,
-  108, 121, 0, 4, 19, 22, 12, 7, 0, 132, 97, 103, 105, 110, 103, 108, 121, 0,
-  18, 19, 19, 24, 22, 0, 132, 101, 100, 108, 121, 0, 16, 16, 18, 6, 0, 130, 108,
-  121, 0, 18, 21, 0, 129, 104, 108, 121, 0, 10, 12, 15, 22, 0, 129, 116, 108,
-  121, 0, 85, 111, 176, 23, 38, 177, 0, 4, 0, 79, 126, 176, 17, 165, 176, 22,
-  207, 176, 23, 25, 177, 0, 76, 133, 176, 24, 141, 176, 0, 16, 12, 22, 0, 130,
-  108, 121, 0, 70, 148, 176, 10, 158, 176, 0, 12, 23, 21, 4, 19, 0, 130, 108,
-  121, 0, 8, 21, 0, 130, 108, 121, 0, 12, 7, 0, 76, 175, 176, 21, 188, 176, 0,
-  21, 18, 0, 136, 100, 105, 110, 97, 114, 105, 108, 121, 0, 18, 21, 23, 27, 8,
-  0, 137, 97, 111, 114, 100, 105, 110, 97, 114, 105, 108, 121, 0, 68, 217, 176,
-  8, 233, 176, 22, 9, 177, 0, 22, 22, 8, 17, 0, 136, 99, 101, 115, 115, 97, 114,
-  105, 108, 121, 0, 6, 0, 70, 242, 176, 8, 255, 176, 0, 8, 17, 0, 135, 101, 115,
-  115, 97, 114, 105, 108, 121, 0, 17, 0, 132, 115, 97, 114, 105, 108, 121, 0, 8,
-  6, 6, 8, 17, 0, 136, 101, 115, 115, 97, 114, 105, 108, 121, 0, 12, 5, 21, 4,
-  0, 132, 114, 97, 114, 105, 108, 121, 0, 81, 45, 177, 21, 56, 177, 0, 8, 24,
-  20, 8, 21, 9, 0, 130, 108, 121, 0, 8, 9, 0, 128, 105, 116, 121, 0, 12, 15, 0,
-  129, 101, 108, 121, 0, 68, 85, 177, 5, 134, 179, 8, 143, 179, 17, 168, 179, 0,
-  70, 110, 177, 8, 193, 177, 12, 206, 177, 17, 69, 178, 21, 175, 178, 22, 189,
-  178, 23, 213, 178, 24, 61, 179, 0, 12, 0, 75, 122, 177, 15, 145, 177, 23, 153,
-  177, 0, 19, 18, 22, 18, 15, 15, 12, 11, 19, 0, 139, 111, 115, 111, 112, 104,
-  105, 99, 97, 108, 108, 121, 0, 5, 24, 19, 0, 131, 108, 121, 0, 4, 16, 0, 68,
-  163, 177, 11, 177, 177, 0, 21, 10, 0, 135, 109, 97, 116, 105, 99, 97, 108,
-  108, 121, 0, 23, 4, 16, 0, 136, 101, 109, 97, 116, 105, 99, 97, 108, 108, 121,
-  0, 21, 7, 8, 9, 0, 133, 101, 114, 97, 108, 108, 121, 0, 70, 216, 177, 17, 250,
-  177, 23, 39, 178, 0, 72, 223, 177, 9, 238, 177, 0, 19, 27, 8, 0, 136, 115,
-  112, 101, 99, 105, 97, 108, 108, 121, 0, 9, 18, 0, 133, 105, 99, 105, 97, 108,
-  108, 121, 0, 72, 4, 178, 10, 16, 178, 12, 28, 178, 0, 21, 8, 19, 0, 132, 110,
-  105, 97, 108, 108, 121, 0, 12, 21, 18, 0, 133, 105, 110, 97, 108, 108, 121, 0,
-  10, 12, 21, 18, 0, 132, 97, 108, 108, 121, 0, 17, 8, 0, 71, 49, 178, 25, 60,
-  178, 0, 12, 6, 17, 12, 0, 132, 97, 108, 108, 121, 0, 8, 0, 132, 117, 97, 108,
-  108, 121, 0, 72, 79, 178, 12, 88, 178, 18, 102, 178, 0, 16, 0, 131, 116, 97,
-  108, 108, 121, 0, 23, 12, 7, 7, 4, 0, 132, 111, 110, 97, 108, 108, 121, 0, 12,
-  0, 71, 114, 178, 22, 128, 178, 23, 139, 178, 0, 4, 21, 23, 0, 133, 116, 105,
-  111, 110, 97, 108, 108, 121, 0, 24, 15, 8, 7, 0, 133, 118, 101, 108, 121, 0,
-  68, 146, 178, 7, 160, 178, 0, 6, 6, 18, 0, 135, 115, 105, 111, 110, 97, 108,
-  108, 121, 0, 4, 21, 23, 0, 135, 105, 116, 105, 111, 110, 97, 108, 108, 121, 0,
-  8, 23, 23, 12, 15, 0, 134, 101, 114, 97, 108, 108, 121, 0, 24, 0, 108, 198,
-  178, 22, 205, 178, 0, 131, 117, 97, 108, 108, 121, 0, 24, 0, 132, 97, 108,
-  108, 121, 0, 81, 220, 178, 24, 33, 179, 0, 8, 0, 71, 232, 178, 16, 7, 179, 25,
-  24, 179, 0, 72, 239, 178, 12, 0, 179, 0, 6, 17, 12, 18, 6, 0, 136, 105, 100,
-  101, 110, 116, 97, 108, 108, 121, 0, 25, 8, 0, 131, 108, 121, 0, 4, 21, 6, 17,
-  12, 0, 136, 101, 109, 101, 110, 116, 97, 108, 108, 121, 0, 8, 0, 131, 117, 97,
-  108, 108, 121, 0, 70, 40, 179, 21, 50, 179, 0, 4, 0, 133, 116, 117, 97, 108,
-  108, 121, 0, 12, 25, 0, 133, 116, 117, 97, 108, 108, 121, 0, 70, 71, 179, 17,
-  84, 179, 23, 101, 179, 0, 12, 23, 21, 4, 19, 0, 131, 108, 97, 114, 108, 121,
-  0, 12, 23, 22, 17, 18, 6, 0, 136, 116, 105, 110, 117, 97, 108, 108, 121, 0,
-  75, 108, 179, 17, 121, 179, 0, 17, 8, 25, 8, 0, 134, 116, 117, 97, 108, 108,
-  121, 0, 8, 24, 20, 8, 22, 17, 18, 6, 0, 132, 108, 121, 0, 4, 5, 18, 21, 19, 0,
-  129, 121, 0, 68, 150, 179, 16, 159, 179, 0, 21, 0, 132, 101, 97, 108, 108,
-  121, 0, 21, 18, 9, 0, 130, 114, 108, 121, 0, 4, 12, 9, 0, 132, 110, 97, 108,
-  108, 121, 0, 8, 0, 80, 188, 179, 21, 198, 179, 0, 8, 21, 23, 27, 8, 0, 130,
-  108, 121, 0, 23, 27, 8, 0, 129, 101, 108, 121, 0, 68, 217, 179, 8, 228, 179,
-  18, 5, 180, 0, 23, 22, 17, 18, 6, 0, 129, 116, 108, 121, 0, 83, 238, 179, 21,
-  247, 179, 23, 0, 180, 0, 19, 18, 0, 132, 101, 110, 108, 121, 0, 21, 24, 6, 0,
-  129, 116, 108, 121, 0, 9, 18, 0, 129, 0, 17, 8, 16, 18, 17, 8, 11, 19, 0, 131,
-  97, 108, 108, 121, 0, 16, 18, 17, 4, 0, 130, 97, 108, 121, 0, 12, 6, 17, 12,
-  21, 19, 0, 129, 97, 108, 108, 121, 0, 68, 53, 180, 8, 110, 180, 18, 119, 180,
-  0, 72, 63, 180, 16, 71, 180, 24, 80, 180, 0, 8, 0, 132, 97, 114, 108, 121, 0,
-  12, 21, 19, 0, 129, 105, 108, 121, 0, 70, 87, 180, 10, 100, 180, 0, 12, 23,
-  21, 4, 19, 0, 131, 108, 97, 114, 108, 121, 0, 8, 21, 0, 131, 108, 97, 114,
-  108, 121, 0, 25, 8, 22, 0, 129, 101, 108, 121, 0, 11, 22, 0, 129, 116, 108,
-  121, 0, 76, 134, 180, 17, 144, 180, 0, 6, 8, 21, 19, 0, 129, 101, 108, 121, 0,
-  8, 7, 0, 129, 101, 108, 121, 0, 68, 171, 180, 6, 229, 180, 8, 4, 181, 12, 17,
-  181, 17, 28, 181, 24, 168, 181, 0, 76, 181, 180, 17, 192, 180, 21, 217, 180,
-  0, 7, 8, 16, 16, 12, 0, 129, 101, 108, 121, 0, 72, 199, 180, 12, 206, 180, 0,
-  19, 0, 130, 108, 116, 121, 0, 9, 8, 7, 0, 131, 105, 116, 101, 108, 121, 0, 8,
-  5, 12, 15, 8, 7, 0, 129, 101, 108, 121, 0, 72, 236, 180, 12, 249, 180, 0, 12,
-  21, 7, 0, 134, 105, 114, 101, 99, 116, 108, 121, 0, 15, 19, 27, 8, 0, 130,
-  105, 116, 108, 121, 0, 17, 12, 9, 8, 7, 0, 131, 105, 116, 101, 108, 121, 0,
-  17, 12, 9, 8, 7, 0, 129, 101, 108, 121, 0, 68, 38, 181, 8, 91, 181, 12, 158,
-  181, 0, 71, 48, 181, 12, 64, 181, 21, 79, 181, 0, 8, 19, 8, 7, 17, 12, 0, 133,
-  110, 100, 101, 110, 116, 108, 121, 0, 16, 18, 7, 8, 21, 19, 0, 132, 110, 97,
-  116, 101, 108, 121, 0, 8, 11, 17, 12, 0, 132, 101, 110, 116, 108, 121, 0, 71,
-  101, 181, 17, 127, 181, 24, 141, 181, 0, 12, 6, 0, 70, 111, 181, 17, 119, 181,
-  0, 4, 0, 129, 97, 108, 108, 121, 0, 12, 0, 129, 97, 108, 108, 121, 0, 12, 16,
-  16, 8, 0, 135, 105, 110, 101, 110, 116, 108, 121, 0, 20, 17, 8, 22, 17, 18, 6,
-  0, 135, 113, 117, 101, 110, 116, 108, 121, 0, 4, 23, 21, 8, 6, 0, 130, 108,
-  121, 0, 15, 18, 22, 5, 4, 0, 129, 101, 108, 121, 0, 9, 22, 0, 72, 189, 181,
-  22, 204, 181, 0, 6, 24, 22, 0, 133, 99, 101, 115, 115, 102, 117, 108, 108,
-  121, 0, 8, 6, 24, 22, 0, 134, 99, 101, 115, 115, 102, 117, 108, 108, 121, 0,
-  12, 0, 86, 229, 181, 23, 245, 181, 0, 15, 24, 6, 27, 8, 0, 134, 108, 117, 115,
-  105, 118, 101, 108, 121, 0, 68, 252, 181, 6, 5, 182, 0, 15, 8, 21, 0, 129,
-  101, 108, 121, 0, 68, 12, 182, 8, 17, 182, 0, 129, 101, 108, 121, 0, 19, 22,
-  8, 21, 0, 129, 101, 108, 121, 0, 68, 37, 182, 8, 47, 182, 18, 60, 182, 0, 7,
-  4, 6, 4, 0, 130, 101, 109, 121, 0, 7, 4, 6, 6, 4, 0, 133, 97, 100, 101, 109,
-  121, 0, 81, 67, 182, 23, 79, 182, 0, 18, 8, 6, 8, 0, 133, 111, 110, 111, 109,
-  121, 0, 11, 6, 12, 7, 0, 131, 111, 116, 111, 109, 121, 0, 68, 110, 182, 8,
-  162, 182, 15, 187, 182, 18, 196, 182, 19, 241, 182, 28, 252, 182, 0, 80, 120,
-  182, 19, 129, 182, 21, 140, 182, 0, 18, 6, 0, 130, 112, 97, 110, 121, 0, 4,
-  16, 18, 6, 0, 132, 112, 97, 110, 121, 0, 85, 147, 182, 28, 156, 182, 0, 28,
-  23, 0, 131, 97, 110, 110, 121, 0, 23, 0, 128, 110, 121, 0, 74, 169, 182, 18,
-  180, 182, 0, 18, 21, 7, 17, 4, 0, 130, 121, 110, 121, 0, 16, 0, 130, 110, 101,
-  121, 0, 12, 4, 16, 0, 130, 110, 108, 121, 0, 79, 203, 182, 16, 212, 182, 0,
-  15, 18, 6, 0, 131, 111, 110, 121, 0, 76, 219, 182, 18, 230, 182, 0, 21, 8, 6,
-  0, 132, 101, 109, 111, 110, 121, 0, 21, 8, 6, 0, 132, 101, 109, 111, 110, 121,
-  0, 4, 16, 18, 6, 0, 131, 112, 97, 110, 121, 0, 10, 18, 22, 28, 16, 0, 134,
-  105, 115, 111, 103, 121, 110, 121, 0, 82, 18, 183, 19, 34, 183, 0, 6, 22, 18,
-  6, 12, 16, 0, 133, 114, 111, 115, 99, 111, 112, 121, 0, 75, 41, 183, 12, 52,
-  183, 0, 4, 17, 24, 0, 132, 104, 97, 112, 112, 121, 0, 15, 22, 0, 128, 101,
-  114, 121, 0, 68, 82, 183, 7, 68, 186, 8, 78, 186, 12, 207, 186, 18, 215, 186,
-  21, 124, 187, 23, 166, 187, 0, 69, 119, 183, 6, 128, 183, 7, 161, 183, 12,
-  203, 183, 15, 4, 184, 16, 61, 184, 17, 70, 184, 18, 169, 184, 21, 183, 184,
-  22, 240, 184, 23, 118, 185, 24, 21, 186, 0, 12, 15, 0, 130, 114, 97, 114, 121,
-  0, 72, 135, 183, 12, 149, 183, 0, 22, 22, 8, 17, 0, 134, 99, 101, 115, 115,
-  97, 114, 121, 0, 9, 8, 17, 8, 5, 0, 130, 105, 97, 114, 121, 0, 76, 168, 183,
-  17, 179, 183, 0, 22, 5, 24, 22, 0, 130, 105, 97, 114, 121, 0, 82, 186, 183,
-  24, 196, 183, 0, 5, 0, 132, 117, 110, 100, 97, 114, 121, 0, 18, 9, 0, 130,
-  114, 121, 0, 79, 210, 183, 22, 251, 183, 0, 76, 217, 183, 15, 225, 183, 0, 16,
-  0, 130, 116, 97, 114, 121, 0, 12, 0, 70, 234, 183, 27, 242, 183, 0, 17, 4, 0,
-  131, 97, 114, 121, 0, 24, 4, 0, 132, 105, 97, 114, 121, 0, 22, 8, 19, 0, 131,
-  97, 114, 121, 0, 76, 14, 184, 15, 24, 184, 24, 50, 184, 0, 27, 24, 4, 0, 130,
-  105, 97, 114, 121, 0, 12, 0, 87, 33, 184, 27, 41, 184, 0, 21, 4, 0, 130, 101,
-  114, 121, 0, 24, 4, 0, 131, 105, 97, 114, 121, 0, 6, 12, 23, 21, 4, 19, 0,
-  128, 108, 121, 0, 24, 22, 0, 130, 109, 97, 114, 121, 0, 72, 80, 184, 12, 92,
-  184, 18, 111, 184, 0, 10, 4, 16, 12, 0, 132, 105, 110, 97, 114, 121, 0, 7, 21,
-  18, 21, 23, 27, 8, 0, 135, 97, 111, 114, 100, 105, 110, 97, 114, 121, 0, 76,
-  121, 184, 22, 142, 184, 23, 154, 184, 0, 23, 24, 15, 18, 25, 17, 8, 0, 139,
-  118, 111, 108, 117, 116, 105, 111, 110, 97, 114, 121, 0, 22, 12, 16, 0, 132,
-  105, 111, 110, 97, 114, 121, 0, 12, 7, 8, 19, 27, 8, 0, 132, 105, 111, 110,
-  97, 114, 121, 0, 19, 16, 8, 23, 17, 18, 6, 0, 130, 114, 97, 114, 121, 0, 82,
-  193, 184, 23, 211, 184, 24, 226, 184, 0, 19, 16, 4, 23, 17, 18, 6, 0, 135,
-  101, 109, 112, 111, 114, 97, 114, 121, 0, 12, 21, 5, 4, 0, 135, 114, 98, 105,
-  116, 114, 97, 114, 121, 0, 5, 8, 9, 0, 135, 70, 101, 98, 114, 117, 97, 114,
-  121, 0, 72, 0, 185, 12, 43, 185, 15, 55, 185, 21, 66, 185, 22, 83, 185, 0, 70,
-  7, 185, 25, 33, 185, 0, 70, 14, 185, 8, 25, 185, 0, 8, 17, 0, 133, 101, 115,
-  115, 97, 114, 121, 0, 17, 0, 130, 115, 97, 114, 121, 0, 7, 4, 0, 131, 114,
-  115, 97, 114, 121, 0, 16, 16, 8, 0, 133, 105, 115, 115, 97, 114, 121, 0, 24,
-  19, 16, 18, 6, 0, 130, 111, 114, 121, 0, 8, 25, 12, 17, 4, 0, 135, 110, 105,
-  118, 101, 114, 115, 97, 114, 121, 0, 8, 6, 0, 70, 93, 185, 8, 104, 185, 0, 8,
-  17, 0, 134, 101, 115, 115, 97, 114, 121, 0, 17, 24, 0, 135, 110, 101, 99, 101,
-  115, 115, 97, 114, 121, 0, 68, 134, 185, 8, 162, 185, 12, 191, 185, 15, 218,
-  185, 17, 228, 185, 0, 79, 141, 185, 21, 151, 185, 0, 18, 22, 0, 132, 105, 116,
-  97, 114, 121, 0, 6, 8, 22, 0, 132, 101, 116, 97, 114, 121, 0, 76, 169, 185,
-  16, 183, 185, 0, 19, 18, 21, 19, 0, 133, 114, 105, 101, 116, 97, 114, 121, 0,
-  8, 6, 0, 130, 101, 114, 121, 0, 69, 198, 185, 15, 207, 185, 0, 21, 4, 0, 130,
-  114, 97, 114, 121, 0, 15, 12, 16, 0, 133, 105, 116, 97, 114, 121, 0, 12, 16,
-  0, 131, 105, 116, 97, 114, 121, 0, 72, 235, 185, 18, 9, 186, 0, 16, 0, 72,
-  244, 185, 12, 252, 185, 0, 6, 0, 132, 116, 101, 114, 121, 0, 15, 8, 0, 135,
-  101, 109, 101, 110, 116, 97, 114, 121, 0, 15, 18, 25, 0, 133, 117, 110, 116,
-  97, 114, 121, 0, 69, 31, 186, 7, 44, 186, 22, 56, 186, 0, 8, 9, 0, 134, 70,
-  101, 98, 114, 117, 97, 114, 121, 0, 12, 22, 5, 24, 22, 0, 131, 105, 97, 114,
-  121, 0, 12, 7, 24, 13, 0, 132, 99, 105, 97, 114, 121, 0, 17, 24, 18, 5, 0,
-  129, 97, 114, 121, 0, 77, 97, 186, 15, 106, 186, 19, 119, 186, 22, 127, 186,
-  23, 155, 186, 25, 196, 186, 0, 21, 8, 19, 0, 130, 117, 114, 121, 0, 15, 26, 8,
-  13, 0, 132, 101, 108, 108, 101, 114, 121, 0, 18, 21, 19, 0, 128, 116, 121, 0,
-  79, 134, 186, 22, 145, 186, 0, 24, 19, 16, 18, 6, 0, 130, 111, 114, 121, 0, 8,
-  6, 8, 17, 0, 130, 97, 114, 121, 0, 72, 162, 186, 22, 172, 186, 0, 21, 6, 8,
-  22, 0, 130, 97, 114, 121, 0, 12, 0, 80, 181, 186, 17, 189, 186, 0, 133, 121,
-  115, 116, 101, 114, 121, 0, 12, 16, 0, 130, 114, 121, 0, 18, 21, 23, 17, 18,
-  6, 0, 128, 115, 121, 0, 4, 21, 19, 0, 128, 105, 101, 0, 74, 231, 186, 17, 243,
-  186, 19, 251, 186, 23, 7, 187, 26, 111, 187, 0, 4, 23, 4, 6, 0, 132, 101, 103,
-  111, 114, 121, 0, 18, 11, 0, 128, 97, 114, 121, 0, 16, 8, 23, 17, 18, 6, 0,
-  128, 97, 114, 121, 0, 68, 20, 187, 8, 52, 187, 12, 64, 187, 22, 77, 187, 0,
-  83, 27, 187, 21, 39, 187, 0, 8, 21, 19, 0, 131, 114, 97, 116, 111, 114, 121,
-  0, 5, 4, 15, 0, 133, 111, 114, 97, 116, 111, 114, 121, 0, 12, 21, 19, 18, 21,
-  19, 0, 130, 97, 114, 121, 0, 10, 18, 21, 8, 7, 0, 132, 97, 116, 111, 114, 121,
-  0, 72, 84, 187, 11, 103, 187, 0, 70, 91, 187, 7, 98, 187, 0, 17, 4, 0, 130,
-  114, 121, 0, 130, 114, 111, 121, 0, 132, 105, 115, 116, 111, 114, 121, 0, 4,
-  22, 22, 4, 6, 0, 132, 111, 119, 97, 114, 121, 0, 68, 131, 187, 21, 160, 187,
-  0, 86, 138, 187, 26, 151, 187, 0, 12, 16, 16, 8, 0, 134, 105, 115, 115, 97,
-  114, 121, 0, 18, 22, 22, 4, 6, 0, 129, 121, 0, 4, 15, 0, 129, 121, 0, 68, 182,
-  187, 12, 214, 187, 17, 226, 187, 18, 240, 187, 22, 6, 188, 0, 81, 189, 187,
-  23, 202, 187, 0, 8, 16, 24, 6, 18, 7, 0, 131, 116, 97, 114, 121, 0, 17, 8, 16,
-  12, 7, 24, 21, 0, 130, 114, 121, 0, 22, 17, 12, 16, 0, 132, 105, 115, 116,
-  114, 121, 0, 24, 6, 18, 44, 0, 134, 99, 111, 117, 110, 116, 114, 121, 0, 72,
-  247, 187, 22, 0, 188, 0, 19, 0, 132, 111, 101, 116, 114, 121, 0, 131, 116,
-  111, 114, 121, 0, 71, 16, 188, 8, 28, 188, 17, 40, 188, 0, 24, 17, 12, 0, 133,
-  100, 117, 115, 116, 114, 121, 0, 16, 8, 11, 6, 0, 132, 105, 115, 116, 114,
-  121, 0, 12, 16, 0, 131, 105, 115, 116, 114, 121, 0, 68, 57, 188, 21, 82, 188,
-  0, 85, 64, 188, 26, 75, 188, 0, 6, 18, 19, 28, 11, 0, 130, 105, 115, 121, 0,
-  15, 4, 0, 129, 121, 115, 0, 8, 25, 4, 21, 23, 17, 18, 6, 0, 133, 111, 118,
-  101, 114, 115, 121, 0, 68, 136, 188, 6, 234, 188, 7, 247, 188, 8, 5, 189, 9,
-  44, 189, 12, 52, 189, 15, 0, 192, 16, 69, 192, 17, 80, 192, 18, 125, 192, 21,
-  152, 192, 24, 179, 192, 0, 79, 146, 188, 21, 196, 188, 23, 224, 188, 0, 76,
-  153, 188, 24, 186, 188, 0, 69, 160, 188, 23, 171, 188, 0, 4, 5, 18, 21, 19, 0,
-  130, 105, 116, 121, 0, 12, 22, 21, 8, 25, 0, 134, 97, 116, 105, 108, 105, 116,
-  121, 0, 22, 4, 6, 0, 131, 97, 108, 116, 121, 0, 68, 203, 188, 12, 214, 188, 0,
-  15, 24, 19, 18, 19, 0, 130, 105, 116, 121, 0, 15, 12, 16, 0, 131, 116, 97,
-  114, 121, 0, 17, 4, 24, 20, 0, 130, 105, 116, 121, 0, 12, 21, 23, 6, 8, 15, 8,
-  0, 129, 105, 116, 121, 0, 12, 15, 12, 4, 25, 0, 133, 108, 105, 100, 105, 116,
-  121, 0, 76, 12, 189, 18, 38, 189, 0, 71, 19, 189, 21, 25, 189, 0, 131, 101,
-  105, 116, 121, 0, 8, 23, 18, 17, 0, 133, 111, 114, 105, 101, 116, 121, 0, 19,
-  0, 128, 114, 121, 0, 4, 22, 0, 129, 101, 116, 121, 0, 68, 83, 189, 5, 99, 189,
-  6, 115, 189, 7, 132, 189, 8, 144, 189, 15, 155, 189, 16, 81, 191, 17, 94, 191,
-  21, 216, 191, 23, 248, 191, 0, 15, 19, 12, 6, 17, 12, 21, 19, 0, 132, 97, 108,
-  105, 116, 121, 0, 12, 15, 4, 5, 18, 21, 19, 0, 133, 98, 105, 108, 105, 116,
-  121, 0, 12, 21, 23, 8, 15, 8, 0, 134, 99, 116, 114, 105, 99, 105, 116, 121, 0,
-  12, 21, 8, 11, 0, 132, 101, 100, 105, 116, 121, 0, 21, 25, 0, 132, 97, 114,
-  105, 101, 116, 121, 0, 68, 171, 189, 5, 253, 189, 12, 102, 190, 23, 55, 191,
-  24, 70, 191, 0, 76, 181, 189, 17, 197, 189, 19, 213, 189, 0, 23, 22, 4, 8, 5,
-  0, 136, 115, 116, 105, 97, 108, 105, 116, 121, 0, 22, 18, 21, 8, 19, 0, 135,
-  115, 111, 110, 97, 108, 105, 116, 121, 0, 12, 6, 0, 76, 223, 189, 17, 239,
-  189, 0, 17, 17, 24, 16, 0, 137, 105, 99, 105, 112, 97, 108, 105, 116, 121, 0,
-  24, 16, 0, 135, 105, 99, 105, 112, 97, 108, 105, 116, 121, 0, 68, 4, 190, 12,
-  52, 190, 0, 76, 14, 190, 15, 25, 190, 23, 37, 190, 0, 15, 8, 21, 0, 131, 105,
-  108, 105, 116, 121, 0, 12, 4, 25, 4, 0, 131, 105, 108, 105, 116, 121, 0, 4,
-  19, 16, 18, 6, 0, 133, 105, 98, 105, 108, 105, 116, 121, 0, 86, 59, 190, 23,
-  89, 190, 0, 81, 66, 190, 22, 79, 190, 0, 18, 19, 22, 8, 21, 0, 131, 105, 108,
-  105, 116, 121, 0, 18, 19, 0, 131, 105, 108, 105, 116, 121, 0, 4, 19, 16, 18,
-  6, 0, 131, 105, 108, 105, 116, 121, 0, 69, 109, 190, 15, 249, 190, 0, 68, 116,
-  190, 21, 235, 190, 0, 79, 132, 190, 19, 147, 190, 21, 161, 190, 22, 184, 190,
-  23, 220, 190, 0, 4, 9, 17, 12, 0, 134, 108, 105, 98, 105, 108, 105, 116, 121,
-  0, 16, 18, 6, 0, 133, 116, 105, 98, 105, 108, 105, 116, 121, 0, 8, 25, 24, 8,
-  18, 17, 4, 16, 0, 140, 101, 117, 118, 101, 114, 97, 98, 105, 108, 105, 116,
-  121, 0, 81, 191, 190, 22, 206, 190, 0, 18, 19, 22, 8, 21, 0, 134, 105, 98,
-  105, 108, 105, 116, 121, 0, 12, 16, 7, 4, 0, 134, 105, 98, 105, 108, 105, 116,
-  121, 0, 4, 19, 16, 18, 6, 0, 134, 105, 98, 105, 108, 105, 116, 121, 0, 8, 19,
-  4, 6, 0, 135, 97, 98, 105, 108, 105, 116, 121, 0, 5, 0, 68, 2, 191, 12, 43,
-  191, 0, 81, 12, 191, 21, 21, 191, 23, 34, 191, 0, 12, 0, 133, 105, 108, 105,
-  116, 121, 0, 8, 17, 15, 24, 25, 0, 133, 105, 108, 105, 116, 121, 0, 22, 0,
-  133, 105, 108, 105, 116, 121, 0, 22, 22, 18, 19, 0, 133, 105, 108, 105, 116,
-  121, 0, 12, 22, 21, 8, 25, 0, 133, 97, 116, 105, 108, 105, 116, 121, 0, 6, 12,
-  9, 9, 12, 7, 0, 130, 116, 121, 0, 12, 17, 18, 17, 4, 0, 132, 121, 109, 105,
-  116, 121, 0, 74, 107, 191, 12, 139, 191, 16, 167, 191, 24, 177, 191, 0, 12, 0,
-  72, 116, 191, 21, 126, 191, 0, 21, 8, 25, 18, 22, 0, 130, 116, 121, 0, 8, 25,
-  18, 22, 0, 133, 101, 105, 103, 110, 116, 121, 0, 68, 146, 191, 6, 155, 191, 0,
-  23, 21, 8, 6, 0, 130, 116, 121, 0, 17, 12, 25, 0, 134, 99, 105, 110, 105, 116,
-  121, 0, 8, 44, 0, 132, 110, 109, 105, 116, 121, 0, 23, 0, 82, 186, 191, 21,
-  201, 191, 0, 21, 19, 19, 18, 0, 135, 111, 114, 116, 117, 110, 105, 116, 121,
-  0, 18, 19, 18, 0, 135, 112, 111, 114, 116, 117, 110, 105, 116, 121, 0, 18, 0,
-  77, 225, 191, 23, 237, 191, 0, 21, 4, 16, 0, 134, 106, 111, 114, 105, 116,
-  121, 0, 24, 4, 0, 132, 104, 111, 114, 105, 116, 121, 0, 12, 23, 17, 8, 0, 130,
-  121, 0, 12, 0, 69, 9, 192, 15, 55, 192, 0, 68, 16, 192, 12, 21, 192, 0, 129,
-  105, 116, 121, 0, 22, 0, 81, 30, 192, 22, 47, 192, 0, 17, 18, 19, 22, 8, 21,
-  0, 135, 115, 105, 98, 105, 108, 105, 116, 121, 0, 18, 19, 0, 129, 105, 116,
-  121, 0, 5, 12, 22, 22, 18, 19, 0, 132, 105, 108, 105, 116, 121, 0, 12, 27, 18,
-  21, 19, 0, 129, 105, 116, 121, 0, 72, 90, 192, 10, 103, 192, 12, 118, 192, 0,
-  12, 6, 12, 9, 9, 8, 17, 12, 0, 128, 108, 121, 0, 12, 21, 8, 25, 18, 22, 0,
-  132, 101, 105, 103, 110, 116, 121, 0, 17, 0, 129, 101, 116, 121, 0, 85, 132,
-  192, 23, 142, 192, 0, 18, 13, 4, 16, 0, 130, 105, 116, 121, 0, 6, 8, 21, 12,
-  7, 0, 129, 114, 121, 0, 83, 159, 192, 24, 171, 192, 0, 8, 18, 21, 19, 0, 132,
-  112, 101, 114, 116, 121, 0, 18, 9, 0, 131, 114, 116, 121, 0, 23, 17, 8, 6, 0,
-  129, 114, 121, 0, 21, 23, 17, 8, 6, 0, 130, 117, 114, 121, 0, 18, 15, 22, 0,
-  128, 108, 121, 0, 23, 12, 17, 5, 12, 8, 15, 0, 129, 122, 0};
+  21, 18, 10, 15, 4, 0, 132, 105, 116, 104, 109, 115, 0, 68, 126, 135, 8, 223,
+  135, 12, 229, 135, 18, 19, 136, 0, 76, 136, 135, 22, 197, 135, 23, 212, 135,
+  0, 70, 143, 135, 21, 180, 135, 0, 12, 0, 85, 152, 135, 23, 163, 135, 0, 18,
+  23, 22, 12, 11, 0, 132, 97, 110, 115, 0, 8, 11, 23, 4, 16, 0, 134, 109, 97,
+  116, 105, 99, 105, 97, 110, 115, 0, 18, 23, 12, 22, 11, 0, 136, 105, 115, 116,
+  111, 114, 105, 97, 110, 115, 0, 22, 4, 22, 22, 22, 4, 0, 134, 97, 115, 115,
+  105, 110, 115, 0, 12, 5, 4, 11, 17, 12, 0, 128, 116, 115, 0, 18, 7, 0, 129,
+  115, 0, 68, 239, 135, 10, 253, 135, 23, 6, 136, 0, 23, 17, 18, 16, 0, 133,
+  117, 110, 116, 97, 105, 110, 115, 0, 10, 8, 5, 0, 131, 105, 110, 115, 0, 4,
+  17, 12, 5, 16, 18, 6, 0, 129, 111, 110, 115, 0, 76, 29, 136, 16, 129, 137, 23,
+  137, 137, 0, 79, 39, 136, 17, 53, 136, 23, 65, 136, 0, 15, 5, 8, 21, 0, 133,
+  101, 108, 108, 105, 111, 110, 115, 0, 8, 16, 12, 7, 0, 131, 115, 105, 111,
+  110, 115, 0, 68, 78, 136, 12, 63, 137, 18, 99, 137, 24, 112, 137, 0, 70, 100,
+  136, 12, 143, 136, 15, 161, 136, 17, 181, 136, 21, 218, 136, 23, 3, 137, 29,
+  45, 137, 0, 12, 0, 81, 109, 136, 24, 127, 136, 0, 12, 24, 16, 16, 18, 6, 0,
+  137, 110, 105, 99, 97, 116, 105, 111, 110, 115, 0, 16, 16, 18, 6, 0, 135, 110,
+  105, 99, 97, 116, 105, 111, 110, 115, 0, 23, 4, 12, 23, 17, 8, 21, 8, 9, 9,
+  12, 7, 0, 133, 111, 110, 115, 0, 24, 7, 4, 21, 10, 17, 18, 6, 0, 136, 116,
+  117, 108, 97, 116, 105, 111, 110, 115, 0, 68, 188, 136, 12, 203, 136, 0, 5,
+  16, 18, 6, 0, 135, 105, 110, 97, 116, 105, 111, 110, 115, 0, 22, 8, 7, 0, 135,
+  116, 105, 110, 97, 116, 105, 111, 110, 115, 0, 72, 225, 136, 18, 240, 136, 0,
+  19, 21, 18, 6, 0, 135, 111, 114, 97, 116, 105, 111, 110, 115, 0, 5, 4, 15, 18,
+  6, 0, 137, 108, 97, 98, 111, 114, 97, 116, 105, 111, 110, 115, 0, 82, 10, 137,
+  22, 25, 137, 0, 17, 18, 6, 0, 135, 110, 111, 116, 97, 116, 105, 111, 110, 115,
+  0, 8, 9, 22, 12, 17, 4, 16, 0, 138, 102, 101, 115, 116, 97, 116, 105, 111,
+  110, 115, 0, 12, 16, 23, 19, 18, 0, 136, 105, 109, 105, 122, 97, 116, 105,
+  111, 110, 115, 0, 71, 70, 137, 8, 85, 137, 0, 12, 19, 27, 8, 0, 135, 101, 100,
+  105, 116, 105, 111, 110, 115, 0, 19, 16, 18, 6, 0, 133, 116, 105, 116, 105,
+  111, 110, 115, 0, 19, 18, 21, 19, 0, 132, 114, 116, 105, 111, 110, 115, 0, 23,
+  12, 21, 23, 17, 18, 6, 0, 134, 98, 117, 116, 105, 111, 110, 115, 0, 4, 12, 7,
+  0, 128, 100, 115, 0, 12, 6, 12, 7, 8, 21, 19, 0, 132, 116, 105, 111, 110, 115,
+  0, 71, 168, 137, 10, 189, 137, 12, 199, 137, 21, 229, 137, 23, 236, 137, 0, 4,
+  17, 4, 12, 6, 12, 9, 9, 4, 0, 137, 105, 99, 105, 111, 110, 97, 100, 111, 115,
+  0, 21, 4, 5, 16, 8, 0, 128, 101, 115, 0, 85, 206, 137, 25, 221, 137, 0, 4, 17,
+  8, 22, 0, 134, 99, 101, 110, 97, 114, 105, 111, 115, 0, 8, 21, 19, 0, 128,
+  117, 115, 0, 8, 11, 0, 128, 101, 115, 0, 4, 0, 80, 245, 137, 23, 252, 137, 0,
+  18, 23, 0, 128, 101, 115, 0, 18, 19, 0, 128, 101, 115, 0, 4, 8, 11, 21, 8, 19,
+  0, 131, 97, 112, 115, 0, 68, 31, 138, 8, 41, 138, 18, 253, 138, 21, 111, 139,
+  23, 119, 139, 0, 7, 17, 4, 23, 22, 0, 128, 100, 115, 0, 69, 72, 138, 6, 85,
+  138, 7, 96, 138, 9, 108, 138, 12, 121, 138, 14, 133, 138, 15, 145, 138, 19,
+  158, 138, 21, 173, 138, 23, 197, 138, 0, 17, 24, 16, 0, 134, 110, 117, 109,
+  98, 101, 114, 115, 0, 9, 9, 18, 0, 131, 105, 99, 101, 114, 115, 0, 12, 15, 18,
+  22, 0, 132, 100, 105, 101, 114, 115, 0, 12, 23, 17, 8, 7, 12, 0, 130, 105,
+  101, 114, 115, 0, 23, 12, 21, 18, 11, 23, 24, 4, 0, 129, 115, 0, 6, 12, 17,
+  18, 16, 0, 132, 107, 101, 114, 115, 0, 19, 12, 23, 15, 24, 16, 0, 130, 105,
+  101, 114, 115, 0, 8, 8, 8, 14, 19, 18, 11, 22, 0, 132, 112, 101, 114, 115, 0,
+  73, 180, 138, 21, 188, 138, 0, 8, 21, 0, 131, 101, 114, 115, 0, 4, 6, 0, 131,
+  101, 101, 114, 115, 0, 70, 204, 138, 23, 237, 138, 0, 68, 211, 138, 8, 227,
+  138, 0, 21, 11, 4, 6, 0, 136, 104, 97, 114, 97, 99, 116, 101, 114, 115, 0, 21,
+  21, 18, 6, 0, 130, 111, 114, 115, 0, 8, 15, 26, 8, 17, 0, 134, 115, 108, 101,
+  116, 116, 101, 114, 115, 0, 82, 7, 139, 23, 18, 139, 25, 99, 139, 0, 7, 12,
+  21, 21, 18, 6, 0, 130, 114, 115, 0, 68, 31, 139, 12, 44, 139, 17, 62, 139, 22,
+  70, 139, 0, 29, 12, 17, 18, 15, 18, 6, 0, 132, 101, 114, 115, 0, 23, 8, 16,
+  19, 18, 6, 0, 136, 109, 112, 101, 116, 105, 116, 111, 114, 115, 0, 8, 21, 0,
+  130, 101, 114, 115, 0, 72, 77, 139, 12, 90, 139, 0, 22, 17, 4, 0, 134, 99,
+  101, 115, 116, 111, 114, 115, 0, 25, 0, 131, 105, 116, 111, 114, 115, 0, 8, 7,
+  17, 8, 0, 131, 97, 118, 111, 114, 115, 0, 8, 9, 8, 21, 0, 129, 115, 0, 18, 4,
+  15, 24, 10, 8, 21, 0, 131, 116, 111, 114, 115, 0, 68, 146, 139, 8, 158, 139,
+  18, 66, 141, 24, 77, 141, 0, 21, 4, 5, 16, 8, 0, 130, 114, 97, 115, 115, 0,
+  70, 180, 139, 7, 190, 139, 15, 199, 139, 17, 28, 140, 21, 211, 140, 22, 8,
+  141, 26, 56, 141, 0, 6, 18, 21, 19, 0, 131, 101, 115, 115, 0, 18, 10, 0, 130,
+  100, 101, 115, 115, 0, 71, 215, 139, 8, 235, 139, 11, 251, 139, 15, 9, 140,
+  16, 17, 140, 0, 21, 4, 10, 8, 21, 21, 12, 0, 139, 114, 101, 103, 97, 114, 100,
+  108, 101, 115, 115, 0, 11, 23, 17, 18, 17, 0, 134, 101, 116, 104, 101, 108,
+  101, 115, 115, 0, 23, 21, 8, 25, 8, 17, 0, 131, 101, 108, 101, 115, 115, 0,
+  12, 0, 130, 110, 101, 115, 115, 0, 16, 24, 21, 7, 0, 132, 108, 101, 115, 115,
+  0, 72, 50, 140, 12, 59, 140, 15, 71, 140, 21, 80, 140, 22, 93, 140, 24, 167,
+  140, 28, 182, 140, 0, 19, 18, 0, 130, 110, 101, 115, 115, 0, 22, 22, 24, 5, 0,
+  133, 105, 110, 101, 115, 115, 0, 12, 0, 131, 108, 110, 101, 115, 115, 0, 18,
+  5, 5, 24, 23, 22, 0, 130, 110, 101, 115, 115, 0, 76, 100, 140, 24, 111, 140,
+  0, 24, 5, 0, 133, 115, 105, 110, 101, 115, 115, 0, 69, 118, 140, 18, 125, 140,
+  0, 131, 105, 110, 101, 115, 115, 0, 70, 132, 140, 12, 149, 140, 0, 12, 22, 17,
+  18, 6, 0, 136, 99, 105, 111, 117, 115, 110, 101, 115, 115, 0, 6, 12, 22, 17,
+  18, 6, 0, 137, 99, 105, 111, 117, 115, 110, 101, 115, 115, 0, 18, 12, 6, 22,
+  17, 18, 6, 0, 131, 115, 110, 101, 115, 115, 0, 79, 189, 140, 29, 201, 140, 0,
+  8, 17, 18, 15, 0, 132, 105, 110, 101, 115, 115, 0, 4, 15, 0, 132, 105, 110,
+  101, 115, 115, 0, 70, 221, 140, 7, 228, 140, 19, 237, 140, 0, 8, 7, 0, 129,
+  101, 115, 0, 4, 0, 131, 100, 114, 101, 115, 115, 0, 85, 244, 140, 24, 255,
+  140, 0, 24, 22, 0, 133, 112, 112, 114, 101, 115, 115, 0, 22, 0, 131, 112, 114,
+  101, 115, 115, 0, 70, 18, 141, 18, 27, 141, 22, 35, 141, 0, 6, 24, 22, 0, 131,
+  101, 115, 115, 0, 19, 0, 130, 115, 101, 115, 115, 0, 8, 0, 85, 44, 141, 22,
+  50, 141, 0, 7, 7, 4, 0, 128, 0, 22, 18, 19, 0, 128, 0, 4, 15, 9, 0, 130, 108,
+  101, 115, 115, 0, 21, 6, 6, 4, 0, 132, 114, 111, 115, 115, 0, 6, 22, 8, 7, 0,
+  133, 105, 115, 99, 117, 115, 115, 0, 70, 118, 141, 9, 132, 141, 11, 141, 141,
+  12, 156, 141, 16, 182, 141, 17, 195, 141, 21, 131, 142, 22, 138, 142, 23, 193,
+  142, 0, 12, 21, 22, 12, 7, 0, 132, 116, 114, 105, 99, 116, 115, 0, 4, 21, 6,
+  21, 12, 4, 0, 128, 0, 10, 24, 18, 21, 11, 23, 14, 4, 8, 21, 5, 0, 129, 115, 0,
+  72, 163, 141, 16, 173, 141, 0, 25, 18, 22, 0, 131, 105, 101, 116, 115, 0, 15,
+  0, 131, 105, 109, 105, 116, 115, 0, 8, 16, 8, 23, 4, 23, 22, 0, 130, 110, 116,
+  115, 0, 68, 208, 141, 8, 225, 141, 12, 110, 142, 18, 125, 142, 0, 12, 7, 8, 8,
+  21, 10, 17, 12, 0, 134, 100, 105, 101, 110, 116, 115, 0, 80, 235, 141, 19, 81,
+  142, 23, 95, 142, 0, 72, 248, 141, 12, 35, 142, 17, 49, 142, 24, 67, 142, 0,
+  70, 255, 141, 15, 18, 142, 0, 17, 24, 18, 21, 19, 0, 136, 110, 111, 117, 110,
+  99, 101, 109, 101, 110, 116, 115, 0, 10, 4, 23, 17, 8, 0, 135, 110, 103, 108,
+  101, 109, 101, 110, 116, 115, 0, 8, 19, 27, 8, 0, 133, 114, 105, 109, 101,
+  110, 116, 115, 0, 18, 12, 21, 25, 17, 8, 0, 136, 105, 114, 111, 110, 109, 101,
+  110, 116, 115, 0, 23, 22, 17, 12, 0, 133, 114, 117, 109, 101, 110, 116, 115,
+  0, 8, 12, 6, 8, 21, 0, 133, 112, 105, 101, 110, 116, 115, 0, 4, 5, 16, 18, 6,
+  17, 18, 17, 0, 131, 97, 110, 116, 115, 0, 4, 23, 22, 17, 18, 6, 0, 132, 114,
+  97, 105, 110, 116, 115, 0, 16, 0, 128, 104, 115, 0, 12, 9, 0, 129, 115, 116,
+  0, 12, 0, 70, 150, 142, 10, 159, 142, 15, 178, 142, 0, 12, 23, 12, 21, 6, 0,
+  131, 115, 0, 18, 15, 8, 4, 11, 6, 21, 4, 0, 134, 111, 108, 111, 103, 105, 115,
+  116, 115, 0, 4, 21, 8, 23, 4, 16, 0, 133, 105, 97, 108, 105, 115, 116, 0, 24,
+  5, 4, 0, 129, 115, 0, 70, 222, 142, 8, 250, 142, 12, 36, 143, 15, 62, 143, 16,
+  72, 143, 18, 92, 143, 22, 137, 147, 0, 17, 8, 0, 70, 232, 142, 22, 237, 142,
+  0, 130, 115, 117, 115, 0, 8, 17, 18, 6, 0, 134, 115, 101, 110, 115, 117, 115,
+  0, 68, 4, 143, 5, 13, 143, 17, 20, 143, 0, 5, 4, 11, 0, 131, 101, 97, 115, 0,
+  4, 11, 0, 129, 97, 115, 0, 4, 21, 18, 19, 16, 8, 23, 17, 18, 6, 0, 129, 111,
+  117, 115, 0, 81, 43, 143, 25, 53, 143, 0, 8, 10, 17, 12, 0, 129, 111, 117,
+  115, 0, 8, 21, 19, 0, 129, 111, 117, 115, 0, 12, 23, 22, 0, 131, 121, 108,
+  117, 115, 0, 4, 23, 18, 19, 18, 19, 12, 11, 0, 135, 112, 111, 112, 111, 116,
+  97, 109, 117, 115, 0, 70, 126, 143, 8, 139, 143, 10, 226, 143, 12, 32, 144,
+  15, 58, 145, 16, 94, 145, 17, 198, 145, 21, 116, 146, 24, 49, 147, 25, 76,
+  147, 29, 125, 147, 0, 22, 12, 16, 18, 21, 19, 0, 130, 117, 111, 117, 115, 0,
+  74, 146, 143, 17, 190, 143, 0, 76, 153, 143, 18, 180, 143, 0, 79, 160, 143,
+  23, 169, 143, 0, 8, 21, 0, 131, 105, 111, 117, 115, 0, 22, 8, 21, 19, 0, 131,
+  105, 111, 117, 115, 0, 15, 4, 17, 4, 0, 131, 111, 117, 115, 0, 68, 197, 143,
+  12, 213, 143, 0, 15, 8, 6, 22, 12, 16, 0, 133, 108, 97, 110, 101, 111, 117,
+  115, 0, 10, 12, 7, 17, 12, 0, 133, 101, 110, 111, 117, 115, 0, 68, 233, 143,
+  12, 5, 144, 0, 79, 240, 143, 21, 251, 143, 0, 4, 17, 4, 0, 132, 111, 103, 111,
+  117, 115, 0, 23, 24, 18, 0, 130, 101, 111, 117, 115, 0, 79, 12, 144, 23, 21,
+  144, 0, 8, 21, 0, 130, 105, 111, 117, 115, 0, 22, 8, 21, 19, 0, 130, 105, 111,
+  117, 115, 0, 70, 57, 144, 7, 87, 144, 10, 102, 144, 17, 140, 144, 21, 155,
+  144, 22, 227, 144, 23, 253, 144, 25, 25, 145, 0, 76, 64, 144, 17, 76, 144, 0,
+  23, 6, 12, 9, 0, 132, 116, 105, 111, 117, 115, 0, 18, 6, 0, 132, 115, 99, 105,
+  111, 117, 115, 0, 12, 6, 8, 0, 135, 100, 101, 99, 105, 100, 117, 111, 117,
+  115, 0, 72, 109, 144, 23, 125, 144, 0, 21, 10, 10, 4, 0, 137, 101, 103, 114,
+  101, 103, 105, 111, 117, 115, 0, 12, 22, 8, 21, 19, 0, 134, 116, 105, 103,
+  105, 111, 117, 115, 0, 4, 15, 15, 8, 6, 22, 12, 16, 0, 131, 101, 111, 117,
+  115, 0, 68, 162, 144, 8, 194, 144, 0, 15, 0, 68, 171, 144, 15, 183, 144, 0,
+  11, 0, 135, 105, 108, 97, 114, 105, 111, 117, 115, 0, 12, 11, 0, 134, 97, 114,
+  105, 111, 117, 115, 0, 79, 201, 144, 23, 212, 144, 0, 8, 7, 0, 133, 105, 114,
+  105, 111, 117, 115, 0, 22, 12, 16, 0, 136, 121, 115, 116, 101, 114, 105, 111,
+  117, 115, 0, 76, 234, 144, 17, 243, 144, 0, 25, 0, 132, 99, 105, 111, 117,
+  115, 0, 18, 6, 0, 131, 99, 105, 111, 117, 115, 0, 70, 4, 145, 12, 14, 145, 0,
+  12, 9, 0, 130, 116, 105, 111, 117, 115, 0, 24, 23, 4, 21, 10, 0, 131, 111,
+  117, 115, 0, 8, 0, 75, 34, 145, 12, 47, 145, 0, 6, 22, 12, 16, 0, 133, 105,
+  101, 118, 111, 117, 115, 0, 11, 6, 22, 12, 16, 0, 131, 111, 117, 115, 0, 82,
+  65, 145, 24, 77, 145, 0, 16, 18, 17, 4, 0, 132, 97, 108, 111, 117, 115, 0, 6,
+  12, 7, 8, 21, 0, 136, 105, 100, 105, 99, 117, 108, 111, 117, 115, 0, 72, 107,
+  145, 18, 118, 145, 21, 152, 145, 28, 164, 145, 0, 17, 8, 25, 0, 132, 111, 109,
+  111, 117, 115, 0, 75, 125, 145, 17, 137, 145, 0, 23, 22, 18, 19, 0, 132, 117,
+  109, 111, 117, 115, 0, 18, 16, 18, 23, 24, 4, 0, 135, 110, 111, 109, 111, 117,
+  115, 0, 24, 18, 17, 8, 0, 133, 114, 109, 111, 117, 115, 0, 17, 0, 68, 173,
+  145, 18, 183, 145, 0, 17, 24, 0, 132, 105, 109, 111, 117, 115, 0, 17, 18, 7,
+  24, 8, 22, 19, 0, 134, 121, 109, 111, 117, 115, 0, 68, 211, 145, 8, 21, 146,
+  12, 67, 146, 18, 78, 146, 0, 79, 218, 145, 23, 231, 145, 0, 15, 8, 6, 22, 12,
+  16, 0, 130, 101, 111, 117, 115, 0, 79, 238, 145, 17, 249, 145, 0, 24, 16, 12,
+  22, 0, 130, 101, 111, 117, 115, 0, 18, 0, 80, 2, 146, 19, 13, 146, 0, 134,
+  117, 110, 116, 97, 105, 110, 111, 117, 115, 0, 22, 0, 130, 101, 111, 117, 115,
+  0, 74, 28, 146, 21, 58, 146, 0, 18, 21, 0, 71, 38, 146, 8, 48, 146, 0, 17, 4,
+  0, 132, 121, 110, 111, 117, 115, 0, 23, 8, 11, 0, 130, 101, 111, 117, 115, 0,
+  23, 22, 0, 130, 117, 111, 117, 115, 0, 23, 17, 18, 6, 0, 130, 117, 111, 117,
+  115, 0, 23, 0, 70, 87, 146, 11, 102, 146, 0, 18, 23, 24, 4, 0, 133, 104, 116,
+  104, 111, 110, 111, 117, 115, 0, 6, 18, 23, 24, 4, 0, 132, 104, 111, 110, 111,
+  117, 115, 0, 72, 126, 146, 23, 219, 146, 24, 250, 146, 0, 69, 139, 146, 16,
+  150, 146, 23, 160, 146, 25, 187, 146, 0, 16, 24, 17, 0, 133, 101, 114, 111,
+  117, 115, 0, 24, 11, 0, 132, 111, 114, 111, 117, 115, 0, 22, 0, 68, 169, 146,
+  28, 179, 146, 0, 22, 12, 7, 0, 132, 114, 111, 117, 115, 0, 16, 0, 130, 105,
+  111, 117, 115, 0, 12, 0, 81, 196, 146, 23, 206, 146, 0, 16, 18, 0, 132, 111,
+  114, 111, 117, 115, 0, 6, 8, 22, 17, 12, 0, 132, 111, 114, 111, 117, 115, 0,
+  68, 226, 146, 17, 238, 146, 0, 22, 12, 7, 0, 132, 115, 116, 114, 111, 117,
+  115, 0, 8, 25, 7, 4, 0, 131, 117, 114, 111, 117, 115, 0, 80, 1, 147, 18, 11,
+  147, 0, 24, 11, 0, 132, 111, 114, 111, 117, 115, 0, 74, 18, 147, 16, 39, 147,
+  0, 12, 0, 85, 27, 147, 25, 33, 147, 0, 132, 114, 111, 117, 115, 0, 132, 114,
+  111, 117, 115, 0, 4, 15, 10, 0, 132, 114, 111, 117, 115, 0, 70, 56, 147, 23,
+  64, 147, 0, 24, 16, 0, 131, 111, 117, 115, 0, 6, 8, 9, 17, 12, 0, 131, 105,
+  111, 117, 115, 0, 72, 83, 147, 12, 95, 147, 0, 7, 17, 8, 21, 0, 131, 122, 118,
+  111, 117, 115, 0, 72, 102, 147, 25, 116, 147, 0, 11, 6, 22, 12, 16, 0, 133,
+  105, 101, 118, 111, 117, 115, 0, 8, 21, 19, 0, 131, 111, 117, 115, 0, 8, 7,
+  17, 8, 21, 0, 130, 118, 111, 117, 115, 0, 17, 8, 6, 17, 18, 6, 0, 133, 115,
+  101, 110, 115, 117, 115, 0, 68, 168, 147, 5, 180, 147, 6, 192, 147, 18, 206,
+  147, 21, 220, 147, 0, 7, 26, 18, 17, 0, 131, 97, 100, 97, 121, 115, 0, 21, 8,
+  22, 22, 4, 19, 0, 130, 115, 98, 121, 0, 4, 21, 12, 19, 22, 17, 18, 6, 0, 129,
+  105, 101, 115, 0, 15, 19, 16, 12, 0, 134, 101, 109, 112, 108, 111, 121, 115,
+  0, 4, 17, 18, 12, 23, 6, 12, 7, 0, 129, 105, 101, 115, 0, 23, 21, 8, 11, 0,
+  128, 0, 68, 31, 148, 6, 116, 148, 8, 24, 149, 9, 160, 149, 10, 209, 149, 11,
+  219, 149, 12, 117, 150, 15, 5, 151, 16, 50, 151, 17, 76, 151, 18, 218, 162,
+  19, 55, 163, 21, 179, 163, 22, 225, 163, 24, 196, 165, 0, 75, 47, 148, 21, 55,
+  148, 22, 89, 148, 26, 97, 148, 28, 109, 148, 0, 28, 23, 0, 131, 104, 97, 116,
+  0, 78, 62, 148, 21, 71, 148, 0, 21, 8, 8, 16, 0, 130, 97, 116, 0, 8, 22, 17,
+  18, 16, 0, 136, 77, 111, 110, 116, 115, 101, 114, 114, 97, 116, 0, 15, 44, 0,
+  130, 97, 115, 116, 0, 11, 8, 16, 18, 22, 0, 131, 119, 104, 97, 116, 0, 11, 23,
+  0, 130, 97, 116, 0, 68, 132, 148, 8, 160, 148, 12, 245, 148, 17, 0, 149, 24,
+  11, 149, 0, 70, 139, 148, 21, 147, 148, 0, 27, 8, 0, 131, 97, 99, 116, 0, 23,
+  22, 5, 24, 22, 0, 133, 116, 114, 97, 99, 116, 0, 81, 170, 148, 21, 186, 148,
+  23, 200, 148, 0, 17, 18, 6, 12, 7, 0, 134, 115, 99, 111, 110, 110, 101, 99,
+  116, 0, 24, 22, 22, 8, 21, 0, 133, 117, 114, 114, 101, 99, 116, 0, 70, 207,
+  148, 8, 233, 148, 0, 72, 214, 148, 12, 222, 148, 0, 7, 0, 132, 116, 101, 99,
+  116, 0, 11, 6, 21, 4, 0, 132, 116, 101, 99, 116, 0, 11, 6, 21, 4, 0, 132, 105,
+  116, 101, 99, 116, 0, 19, 22, 8, 7, 0, 132, 112, 105, 99, 116, 0, 12, 27, 8,
+  0, 131, 116, 105, 110, 99, 116, 0, 7, 4, 24, 20, 4, 0, 132, 101, 100, 117, 99,
+  116, 0, 68, 46, 149, 7, 54, 149, 12, 68, 149, 15, 101, 149, 17, 129, 149, 18,
+  142, 149, 19, 149, 149, 0, 21, 10, 0, 130, 101, 97, 116, 0, 17, 8, 7, 17, 8,
+  19, 8, 7, 17, 12, 0, 130, 116, 0, 69, 78, 149, 9, 86, 149, 21, 95, 149, 0, 15,
+  4, 0, 130, 101, 105, 116, 0, 21, 18, 9, 0, 130, 101, 105, 116, 0, 26, 0, 129,
+  116, 101, 0, 73, 108, 149, 19, 119, 149, 0, 16, 4, 19, 0, 131, 112, 104, 108,
+  101, 116, 0, 16, 4, 19, 0, 130, 104, 108, 101, 116, 0, 16, 17, 21, 8, 25, 18,
+  10, 0, 130, 101, 110, 116, 0, 21, 26, 0, 129, 116, 101, 0, 21, 8, 23, 17, 12,
+  0, 129, 114, 101, 116, 0, 4, 0, 70, 169, 149, 21, 179, 149, 0, 21, 12, 4, 0,
+  130, 114, 97, 102, 116, 0, 6, 0, 76, 188, 149, 21, 198, 149, 0, 4, 0, 132,
+  114, 99, 114, 97, 102, 116, 0, 21, 12, 4, 0, 133, 99, 114, 97, 102, 116, 0,
+  11, 24, 4, 6, 0, 130, 103, 104, 116, 0, 70, 232, 149, 7, 243, 149, 10, 250,
+  149, 12, 106, 150, 0, 8, 23, 12, 11, 6, 21, 4, 0, 129, 116, 0, 12, 26, 0, 129,
+  116, 104, 0, 72, 7, 150, 12, 17, 150, 17, 47, 150, 24, 54, 150, 0, 12, 11, 0,
+  132, 101, 105, 103, 104, 116, 0, 79, 24, 150, 21, 34, 150, 0, 10, 0, 133, 102,
+  108, 105, 103, 104, 116, 0, 28, 4, 15, 19, 0, 132, 119, 114, 105, 103, 104,
+  116, 0, 8, 15, 0, 129, 116, 104, 0, 68, 61, 150, 18, 82, 150, 0, 73, 68, 150,
+  22, 75, 150, 0, 132, 111, 117, 103, 104, 116, 0, 132, 111, 117, 103, 104, 116,
+  0, 75, 89, 150, 21, 95, 150, 0, 23, 15, 4, 0, 128, 0, 11, 23, 44, 0, 133, 111,
+  117, 103, 104, 116, 0, 10, 17, 18, 23, 0, 131, 105, 103, 104, 116, 0, 68, 133,
+  150, 8, 162, 150, 9, 181, 150, 23, 192, 150, 24, 202, 150, 0, 85, 140, 150,
+  23, 152, 150, 0, 23, 18, 19, 0, 132, 114, 116, 114, 97, 105, 116, 0, 21, 18,
+  19, 0, 130, 114, 97, 105, 116, 0, 11, 17, 8, 21, 4, 9, 0, 136, 70, 97, 104,
+  114, 101, 110, 104, 101, 105, 116, 0, 12, 17, 8, 5, 0, 131, 101, 102, 105,
+  116, 0, 24, 18, 5, 4, 0, 129, 32, 105, 116, 0, 70, 212, 150, 20, 240, 150, 22,
+  249, 150, 0, 76, 219, 150, 21, 229, 150, 0, 21, 12, 6, 0, 132, 99, 117, 105,
+  116, 0, 24, 6, 0, 133, 105, 114, 99, 117, 105, 116, 0, 8, 7, 4, 0, 129, 97,
+  116, 101, 0, 21, 8, 19, 0, 133, 117, 114, 115, 117, 105, 116, 0, 68, 15, 151,
+  22, 26, 151, 24, 36, 151, 0, 24, 22, 22, 4, 0, 131, 97, 117, 108, 116, 0, 24,
+  8, 21, 0, 131, 115, 117, 108, 116, 0, 6, 12, 9, 12, 7, 0, 132, 102, 105, 99,
+  117, 108, 116, 0, 68, 57, 151, 8, 68, 151, 0, 23, 21, 18, 19, 16, 12, 0, 129,
+  110, 116, 0, 23, 23, 4, 0, 128, 112, 116, 0, 68, 101, 151, 8, 147, 154, 12,
+  28, 162, 16, 39, 162, 18, 67, 162, 21, 77, 162, 22, 100, 162, 24, 123, 162, 0,
+  70, 144, 151, 7, 202, 151, 8, 14, 152, 10, 27, 152, 11, 58, 152, 12, 70, 152,
+  15, 142, 152, 16, 234, 152, 17, 4, 153, 21, 138, 153, 22, 236, 153, 23, 247,
+  153, 24, 104, 154, 28, 117, 154, 0, 12, 9, 0, 76, 154, 151, 17, 189, 151, 0,
+  81, 161, 151, 23, 176, 151, 0, 12, 10, 12, 22, 0, 136, 110, 105, 102, 105, 99,
+  97, 110, 116, 0, 21, 18, 5, 4, 0, 132, 97, 99, 105, 101, 110, 116, 0, 10, 12,
+  22, 0, 133, 105, 102, 105, 99, 97, 110, 116, 0, 17, 0, 72, 211, 151, 18, 1,
+  152, 0, 70, 218, 151, 19, 247, 151, 0, 72, 225, 151, 22, 237, 151, 0, 7, 0,
+  134, 115, 99, 101, 110, 100, 97, 110, 116, 0, 17, 4, 21, 23, 0, 130, 101, 110,
+  116, 0, 8, 7, 17, 12, 0, 130, 101, 110, 116, 0, 19, 22, 8, 21, 21, 18, 6, 0,
+  130, 101, 110, 116, 0, 10, 4, 8, 19, 0, 134, 97, 103, 101, 97, 110, 116, 0,
+  76, 34, 152, 18, 47, 152, 0, 9, 12, 17, 10, 12, 22, 0, 131, 99, 97, 110, 116,
+  0, 21, 4, 0, 132, 114, 111, 103, 97, 110, 116, 0, 19, 15, 8, 0, 132, 101, 112,
+  104, 97, 110, 116, 0, 70, 86, 152, 7, 102, 152, 15, 111, 152, 17, 122, 152,
+  19, 132, 152, 0, 12, 9, 17, 10, 12, 22, 0, 134, 105, 102, 105, 99, 97, 110,
+  116, 0, 8, 5, 18, 0, 130, 101, 110, 116, 0, 12, 21, 5, 0, 131, 108, 105, 97,
+  110, 116, 0, 12, 16, 18, 7, 0, 131, 97, 110, 116, 0, 12, 6, 8, 21, 0, 130,
+  101, 110, 116, 0, 72, 155, 152, 12, 185, 152, 15, 198, 152, 24, 223, 152, 0,
+  25, 0, 72, 164, 152, 12, 174, 152, 0, 21, 19, 0, 132, 97, 108, 101, 110, 116,
+  0, 24, 20, 8, 0, 132, 97, 108, 101, 110, 116, 0, 25, 12, 24, 20, 8, 0, 132,
+  97, 108, 101, 110, 116, 0, 72, 205, 152, 12, 214, 152, 0, 6, 27, 8, 0, 130,
+  101, 110, 116, 0, 21, 5, 0, 130, 105, 97, 110, 116, 0, 22, 17, 18, 6, 0, 130,
+  116, 97, 110, 116, 0, 68, 241, 152, 7, 250, 152, 0, 16, 21, 4, 0, 130, 101,
+  110, 116, 0, 17, 8, 16, 4, 0, 130, 101, 110, 116, 0, 68, 17, 153, 8, 27, 153,
+  12, 104, 153, 18, 114, 153, 0, 16, 21, 8, 19, 0, 130, 101, 110, 116, 0, 80,
+  40, 153, 23, 65, 153, 24, 80, 153, 25, 92, 153, 0, 72, 47, 153, 21, 55, 153,
+  0, 21, 0, 132, 110, 97, 110, 116, 0, 8, 19, 0, 132, 97, 110, 101, 110, 116, 0,
+  24, 8, 15, 0, 135, 105, 101, 117, 116, 101, 110, 97, 110, 116, 0, 8, 12, 15,
+  0, 132, 116, 101, 110, 97, 110, 116, 0, 17, 18, 6, 0, 134, 118, 101, 110, 97,
+  110, 116, 0, 16, 18, 21, 19, 0, 130, 101, 110, 116, 0, 19, 0, 80, 123, 153,
+  19, 131, 153, 0, 18, 6, 0, 130, 101, 110, 116, 0, 18, 0, 130, 101, 110, 116,
+  0, 68, 151, 153, 8, 177, 153, 10, 189, 153, 24, 204, 153, 0, 83, 158, 153, 23,
+  166, 153, 0, 19, 4, 0, 130, 101, 110, 116, 0, 22, 8, 21, 0, 131, 117, 114, 97,
+  110, 116, 0, 10, 12, 15, 15, 8, 5, 0, 130, 101, 110, 116, 0, 12, 16, 17, 12,
+  0, 135, 109, 109, 105, 103, 114, 97, 110, 116, 0, 68, 211, 153, 23, 224, 153,
+  0, 22, 8, 21, 0, 133, 116, 97, 117, 114, 97, 110, 116, 0, 22, 8, 21, 0, 132,
+  97, 117, 114, 97, 110, 116, 0, 8, 15, 19, 0, 131, 97, 115, 97, 110, 116, 0,
+  72, 4, 154, 12, 14, 154, 21, 42, 154, 22, 54, 154, 0, 19, 16, 18, 6, 0, 130,
+  101, 110, 116, 0, 79, 21, 154, 22, 32, 154, 0, 15, 12, 16, 0, 133, 105, 116,
+  97, 110, 116, 0, 22, 4, 0, 131, 115, 116, 97, 110, 116, 0, 8, 25, 7, 4, 17,
+  12, 0, 130, 101, 110, 116, 0, 12, 0, 86, 63, 154, 27, 97, 154, 0, 72, 73, 154,
+  17, 81, 154, 21, 89, 154, 0, 11, 0, 132, 116, 97, 110, 116, 0, 18, 6, 0, 130,
+  101, 110, 116, 0, 8, 19, 0, 130, 101, 110, 116, 0, 8, 0, 130, 101, 110, 116,
+  0, 23, 12, 23, 22, 17, 18, 6, 0, 130, 101, 110, 116, 0, 82, 124, 154, 24, 135,
+  154, 0, 5, 44, 0, 132, 117, 111, 121, 97, 110, 116, 0, 18, 5, 44, 0, 133, 117,
+  111, 121, 97, 110, 116, 0, 70, 190, 154, 7, 109, 155, 10, 218, 155, 12, 37,
+  156, 15, 128, 156, 16, 241, 156, 17, 215, 160, 18, 47, 161, 21, 55, 161, 22,
+  145, 161, 23, 155, 161, 24, 249, 161, 25, 7, 162, 29, 17, 162, 0, 72, 200,
+  154, 12, 212, 154, 22, 18, 155, 0, 15, 18, 7, 4, 0, 131, 115, 99, 101, 110,
+  116, 0, 73, 222, 154, 17, 245, 154, 22, 4, 155, 0, 9, 0, 72, 231, 154, 24,
+  237, 154, 0, 130, 105, 101, 110, 116, 0, 22, 0, 130, 105, 101, 110, 116, 0, 8,
+  16, 8, 21, 0, 134, 105, 110, 105, 115, 99, 101, 110, 116, 0, 17, 12, 16, 8,
+  21, 0, 133, 105, 115, 99, 101, 110, 116, 0, 72, 25, 155, 17, 83, 155, 0, 81,
+  32, 155, 21, 45, 155, 0, 12, 16, 8, 21, 0, 133, 105, 115, 99, 101, 110, 116,
+  0, 82, 52, 155, 24, 67, 155, 0, 15, 9, 44, 0, 135, 117, 111, 114, 101, 115,
+  99, 101, 110, 116, 0, 18, 15, 9, 44, 0, 136, 117, 111, 114, 101, 115, 99, 101,
+  110, 116, 0, 76, 90, 155, 18, 102, 155, 0, 16, 8, 21, 0, 132, 105, 115, 99,
+  101, 110, 116, 0, 6, 0, 131, 101, 110, 116, 0, 76, 119, 155, 17, 130, 155, 24,
+  208, 155, 0, 6, 4, 0, 132, 99, 105, 100, 101, 110, 116, 0, 8, 0, 70, 145, 155,
+  9, 158, 155, 19, 166, 155, 23, 200, 155, 0, 8, 7, 0, 134, 115, 99, 101, 110,
+  100, 97, 110, 116, 0, 8, 7, 0, 130, 97, 110, 116, 0, 71, 173, 155, 12, 186,
+  155, 0, 17, 12, 0, 134, 101, 112, 101, 110, 100, 101, 110, 116, 0, 7, 17, 12,
+  0, 135, 101, 112, 101, 110, 100, 101, 110, 116, 0, 23, 4, 0, 130, 97, 110,
+  116, 0, 22, 0, 132, 116, 117, 100, 101, 110, 116, 0, 68, 231, 155, 12, 243,
+  155, 18, 18, 156, 21, 29, 156, 0, 25, 4, 21, 23, 27, 8, 0, 130, 97, 110, 116,
+  0, 79, 250, 155, 23, 7, 156, 0, 8, 23, 17, 12, 0, 132, 108, 105, 103, 101,
+  110, 116, 0, 17, 18, 6, 0, 131, 110, 103, 101, 110, 116, 0, 21, 4, 0, 132,
+  114, 111, 103, 97, 110, 116, 0, 8, 22, 0, 129, 97, 110, 116, 0, 70, 53, 156,
+  15, 84, 156, 17, 92, 156, 19, 107, 156, 21, 120, 156, 0, 72, 60, 156, 12, 72,
+  156, 0, 9, 9, 8, 0, 133, 105, 99, 105, 101, 110, 116, 0, 9, 12, 17, 10, 4, 16,
+  0, 131, 101, 110, 116, 0, 8, 21, 0, 130, 97, 110, 116, 0, 8, 12, 25, 17, 18,
+  6, 0, 134, 101, 110, 105, 101, 110, 116, 0, 8, 6, 8, 21, 0, 133, 105, 112,
+  105, 101, 110, 116, 0, 4, 25, 0, 130, 97, 110, 116, 0, 68, 141, 156, 8, 173,
+  156, 12, 215, 156, 15, 228, 156, 0, 76, 148, 156, 15, 160, 156, 0, 24, 20, 8,
+  0, 132, 118, 97, 108, 101, 110, 116, 0, 25, 12, 24, 20, 8, 0, 133, 97, 108,
+  101, 110, 116, 0, 70, 183, 156, 25, 192, 156, 27, 204, 156, 0, 27, 8, 0, 130,
+  108, 101, 110, 116, 0, 12, 24, 20, 8, 0, 132, 97, 108, 101, 110, 116, 0, 8, 0,
+  132, 99, 101, 108, 108, 101, 110, 116, 0, 25, 12, 24, 20, 8, 0, 132, 97, 108,
+  101, 110, 116, 0, 8, 27, 8, 0, 133, 99, 101, 108, 108, 101, 110, 116, 0, 68,
+  28, 157, 7, 40, 157, 8, 56, 157, 10, 125, 158, 12, 186, 158, 15, 215, 158, 17,
+  238, 158, 18, 79, 159, 19, 92, 159, 21, 143, 159, 22, 12, 160, 23, 81, 160,
+  24, 124, 160, 25, 156, 160, 0, 12, 15, 12, 9, 0, 133, 97, 109, 101, 110, 116,
+  0, 17, 8, 16, 7, 4, 0, 136, 109, 101, 110, 100, 109, 101, 110, 116, 0, 70, 90,
+  157, 7, 152, 157, 8, 165, 157, 10, 218, 157, 15, 18, 158, 17, 32, 158, 19, 44,
+  158, 22, 61, 158, 23, 73, 158, 24, 85, 158, 25, 95, 158, 0, 68, 97, 157, 17,
+  113, 157, 0, 19, 15, 8, 21, 0, 136, 112, 108, 97, 99, 101, 109, 101, 110, 116,
+  0, 68, 120, 157, 24, 136, 157, 0, 11, 6, 17, 8, 0, 137, 104, 97, 110, 99, 101,
+  109, 101, 110, 116, 0, 18, 17, 4, 0, 136, 110, 111, 117, 110, 99, 101, 109,
+  101, 110, 116, 0, 21, 4, 5, 16, 18, 5, 0, 132, 109, 101, 110, 116, 0, 72, 172,
+  157, 21, 182, 157, 0, 21, 10, 4, 0, 132, 109, 101, 110, 116, 0, 10, 0, 68,
+  191, 157, 10, 207, 157, 0, 22, 22, 12, 7, 0, 137, 97, 103, 114, 101, 101, 109,
+  101, 110, 116, 0, 4, 0, 135, 114, 101, 101, 109, 101, 110, 116, 0, 76, 225,
+  157, 17, 239, 157, 0, 21, 9, 17, 12, 0, 133, 110, 103, 101, 109, 101, 110,
+  116, 0, 68, 246, 157, 8, 4, 158, 0, 21, 4, 0, 135, 114, 97, 110, 103, 101,
+  109, 101, 110, 116, 0, 21, 21, 4, 0, 135, 97, 110, 103, 101, 109, 101, 110,
+  116, 0, 8, 23, 23, 8, 22, 0, 134, 108, 101, 109, 101, 110, 116, 0, 10, 12, 22,
+  8, 21, 0, 132, 109, 101, 110, 116, 0, 18, 15, 18, 25, 8, 7, 0, 136, 101, 108,
+  111, 112, 109, 101, 110, 116, 0, 22, 4, 21, 4, 11, 0, 132, 109, 101, 110, 116,
+  0, 6, 12, 7, 17, 12, 0, 132, 109, 101, 110, 116, 0, 10, 21, 4, 0, 132, 109,
+  101, 110, 116, 0, 76, 102, 158, 18, 115, 158, 0, 11, 6, 4, 0, 133, 101, 118,
+  101, 109, 101, 110, 116, 0, 10, 0, 131, 114, 110, 109, 101, 110, 116, 0, 68,
+  135, 158, 17, 162, 158, 21, 174, 158, 0, 74, 142, 158, 17, 152, 158, 0, 17, 8,
+  0, 131, 101, 109, 101, 110, 116, 0, 4, 16, 0, 131, 101, 109, 101, 110, 116, 0,
+  4, 21, 21, 4, 0, 131, 101, 109, 101, 110, 116, 0, 4, 15, 17, 8, 0, 131, 101,
+  109, 101, 110, 116, 0, 15, 0, 83, 195, 158, 21, 205, 158, 0, 16, 12, 0, 132,
+  101, 109, 101, 110, 116, 0, 4, 19, 0, 131, 97, 109, 101, 110, 116, 0, 72, 222,
+  158, 23, 227, 158, 0, 11, 0, 129, 116, 0, 23, 8, 22, 0, 131, 101, 109, 101,
+  110, 116, 0, 72, 251, 158, 12, 7, 159, 18, 25, 159, 21, 45, 159, 0, 25, 18,
+  10, 0, 132, 114, 110, 109, 101, 110, 116, 0, 23, 4, 21, 8, 23, 17, 8, 0, 135,
+  116, 97, 105, 110, 109, 101, 110, 116, 0, 22, 12, 21, 19, 17, 12, 0, 138, 109,
+  112, 114, 105, 115, 111, 110, 109, 101, 110, 116, 0, 18, 0, 76, 54, 159, 25,
+  67, 159, 0, 25, 17, 8, 0, 134, 114, 111, 110, 109, 101, 110, 116, 0, 18, 10,
+  0, 134, 101, 114, 110, 109, 101, 110, 116, 0, 21, 12, 25, 17, 8, 0, 131, 110,
+  109, 101, 110, 116, 0, 79, 102, 159, 18, 115, 159, 19, 132, 159, 0, 8, 25, 8,
+  7, 0, 132, 111, 112, 109, 101, 110, 116, 0, 25, 8, 15, 8, 7, 0, 136, 118, 101,
+  108, 111, 112, 109, 101, 110, 116, 0, 12, 24, 20, 8, 0, 132, 109, 101, 110,
+  116, 0, 68, 159, 159, 8, 200, 159, 12, 211, 159, 17, 223, 159, 18, 236, 159,
+  0, 69, 166, 159, 19, 177, 159, 0, 16, 18, 5, 0, 131, 100, 109, 101, 110, 116,
+  0, 68, 184, 159, 8, 191, 159, 0, 131, 116, 109, 101, 110, 116, 0, 7, 0, 131,
+  116, 109, 101, 110, 116, 0, 25, 18, 10, 0, 131, 110, 109, 101, 110, 116, 0,
+  24, 20, 8, 21, 0, 131, 101, 109, 101, 110, 116, 0, 8, 25, 18, 10, 0, 133, 114,
+  110, 109, 101, 110, 116, 0, 76, 243, 159, 25, 0, 160, 0, 25, 17, 8, 0, 133,
+  114, 111, 110, 109, 101, 110, 116, 0, 18, 10, 0, 133, 101, 114, 110, 109, 101,
+  110, 116, 0, 68, 22, 160, 12, 52, 160, 22, 66, 160, 0, 21, 0, 68, 31, 160, 21,
+  40, 160, 0, 11, 0, 131, 115, 109, 101, 110, 116, 0, 4, 11, 0, 134, 97, 115,
+  115, 109, 101, 110, 116, 0, 23, 21, 8, 25, 7, 4, 0, 131, 101, 109, 101, 110,
+  116, 0, 4, 21, 21, 4, 11, 0, 135, 97, 115, 115, 109, 101, 110, 116, 0, 68, 91,
+  160, 17, 101, 160, 23, 112, 160, 0, 23, 22, 0, 131, 101, 109, 101, 110, 116,
+  0, 8, 23, 17, 18, 6, 22, 12, 7, 0, 131, 0, 12, 16, 16, 18, 6, 0, 132, 109,
+  101, 110, 116, 0, 70, 131, 160, 21, 142, 160, 0, 6, 18, 7, 0, 133, 117, 109,
+  101, 110, 116, 0, 23, 17, 12, 0, 134, 115, 116, 114, 117, 109, 101, 110, 116,
+  0, 72, 166, 160, 15, 178, 160, 18, 190, 160, 0, 12, 11, 6, 4, 0, 131, 101,
+  109, 101, 110, 116, 0, 18, 25, 17, 12, 0, 131, 101, 109, 101, 110, 116, 0, 80,
+  197, 160, 21, 204, 160, 0, 131, 101, 109, 101, 110, 116, 0, 19, 16, 12, 0,
+  131, 101, 109, 101, 110, 116, 0, 76, 222, 160, 18, 7, 161, 0, 72, 229, 160,
+  16, 241, 160, 0, 25, 17, 18, 6, 0, 132, 110, 105, 101, 110, 116, 0, 72, 248,
+  160, 18, 0, 161, 0, 21, 0, 132, 110, 97, 110, 116, 0, 7, 0, 130, 97, 110, 116,
+  0, 81, 17, 161, 19, 27, 161, 22, 38, 161, 0, 18, 19, 19, 18, 0, 132, 101, 110,
+  116, 0, 18, 44, 0, 132, 112, 111, 110, 101, 110, 116, 0, 17, 18, 6, 0, 130,
+  97, 110, 116, 0, 16, 0, 130, 109, 101, 110, 116, 0, 68, 68, 161, 8, 79, 161,
+  9, 91, 161, 21, 102, 161, 0, 19, 4, 0, 132, 112, 97, 114, 101, 110, 116, 0, 9,
+  12, 7, 0, 132, 102, 101, 114, 101, 110, 116, 0, 9, 12, 7, 0, 131, 101, 114,
+  101, 110, 116, 0, 68, 109, 161, 8, 133, 161, 0, 19, 0, 68, 118, 161, 19, 126,
+  161, 0, 133, 112, 97, 114, 101, 110, 116, 0, 4, 0, 131, 101, 110, 116, 0, 9,
+  12, 7, 0, 133, 102, 101, 114, 101, 110, 116, 0, 4, 8, 15, 19, 0, 130, 97, 110,
+  116, 0, 72, 168, 161, 12, 183, 161, 17, 210, 161, 22, 220, 161, 0, 23, 19, 16,
+  18, 6, 17, 12, 0, 133, 101, 116, 101, 110, 116, 0, 83, 190, 161, 21, 201, 161,
+  0, 16, 18, 6, 0, 132, 101, 116, 101, 110, 116, 0, 23, 24, 17, 0, 131, 101,
+  110, 116, 0, 8, 19, 8, 21, 0, 130, 97, 110, 116, 0, 12, 0, 85, 229, 161, 22,
+  241, 161, 0, 8, 19, 0, 133, 115, 105, 115, 116, 101, 110, 116, 0, 8, 21, 0,
+  130, 97, 110, 116, 0, 20, 22, 5, 24, 22, 0, 132, 101, 113, 117, 101, 110, 116,
+  0, 8, 15, 8, 21, 0, 130, 97, 110, 116, 0, 12, 17, 10, 18, 6, 0, 130, 97, 110,
+  116, 0, 18, 17, 17, 4, 0, 132, 111, 105, 110, 116, 0, 8, 0, 72, 48, 162, 22,
+  57, 162, 0, 21, 10, 4, 0, 129, 101, 110, 116, 0, 24, 16, 8, 5, 0, 129, 101,
+  110, 116, 0, 16, 4, 10, 21, 8, 5, 0, 129, 116, 0, 68, 84, 162, 8, 90, 162, 0,
+  8, 0, 128, 101, 100, 0, 9, 9, 12, 7, 0, 129, 101, 110, 116, 0, 76, 107, 162,
+  18, 116, 162, 0, 4, 10, 4, 0, 130, 110, 115, 116, 0, 6, 0, 130, 110, 115, 116,
+  0, 68, 133, 162, 7, 198, 162, 18, 208, 162, 0, 21, 0, 68, 145, 162, 8, 157,
+  162, 24, 170, 162, 0, 23, 22, 8, 21, 0, 132, 117, 114, 97, 110, 116, 0, 23,
+  22, 8, 21, 0, 133, 97, 117, 114, 97, 110, 116, 0, 68, 177, 162, 23, 186, 162,
+  0, 23, 22, 8, 21, 0, 130, 110, 116, 0, 22, 8, 21, 0, 133, 97, 117, 114, 97,
+  110, 116, 0, 17, 24, 5, 4, 0, 130, 97, 110, 116, 0, 16, 16, 4, 0, 132, 111,
+  117, 110, 116, 0, 76, 231, 162, 17, 243, 162, 21, 11, 163, 22, 20, 163, 0, 21,
+  23, 4, 19, 27, 8, 0, 129, 97, 116, 101, 0, 71, 250, 162, 17, 3, 163, 0, 12, 7,
+  0, 130, 32, 110, 111, 116, 0, 17, 4, 6, 0, 130, 111, 116, 0, 19, 8, 21, 0,
+  130, 111, 114, 116, 0, 79, 30, 163, 16, 34, 163, 22, 42, 163, 0, 4, 0, 128, 0,
+  15, 4, 0, 130, 111, 115, 116, 0, 8, 6, 24, 22, 0, 132, 99, 101, 115, 115, 111,
+  114, 0, 72, 74, 163, 16, 112, 163, 18, 122, 163, 21, 131, 163, 24, 157, 163,
+  28, 169, 163, 0, 76, 84, 163, 22, 94, 163, 27, 104, 163, 0, 6, 8, 21, 0, 131,
+  101, 105, 112, 116, 0, 17, 18, 6, 0, 131, 99, 101, 112, 116, 0, 8, 0, 130, 99,
+  101, 112, 116, 0, 4, 27, 8, 0, 131, 101, 109, 112, 116, 0, 7, 7, 4, 0, 131,
+  111, 112, 116, 0, 72, 138, 163, 12, 148, 163, 0, 27, 8, 0, 131, 99, 101, 114,
+  112, 116, 0, 6, 22, 0, 131, 114, 105, 112, 116, 0, 21, 8, 23, 17, 12, 0, 130,
+  114, 117, 112, 116, 0, 6, 17, 8, 0, 130, 114, 121, 112, 116, 0, 68, 186, 163,
+  18, 195, 163, 0, 19, 19, 4, 0, 131, 97, 114, 116, 0, 19, 0, 76, 204, 163, 19,
+  213, 163, 0, 4, 0, 131, 114, 112, 111, 114, 116, 0, 24, 26, 0, 134, 115, 117,
+  112, 112, 111, 114, 116, 0, 68, 253, 163, 8, 12, 164, 10, 84, 164, 12, 114,
+  164, 16, 130, 165, 17, 140, 165, 18, 150, 165, 24, 176, 165, 28, 183, 165, 0,
+  6, 7, 4, 21, 5, 0, 133, 111, 97, 100, 99, 97, 115, 116, 0, 74, 22, 164, 12,
+  45, 164, 21, 73, 164, 0, 76, 29, 164, 24, 37, 164, 0, 11, 0, 130, 104, 101,
+  115, 116, 0, 22, 0, 130, 103, 101, 115, 116, 0, 75, 52, 164, 25, 61, 164, 0,
+  23, 4, 0, 131, 101, 105, 115, 116, 0, 4, 11, 0, 133, 101, 97, 118, 105, 101,
+  115, 116, 0, 23, 17, 12, 0, 131, 101, 114, 101, 115, 116, 0, 72, 91, 164, 21,
+  106, 164, 0, 17, 21, 18, 23, 22, 0, 134, 114, 111, 110, 103, 101, 115, 116, 0,
+  4, 15, 0, 129, 101, 115, 116, 0, 70, 130, 164, 9, 140, 164, 10, 152, 164, 16,
+  11, 165, 17, 44, 165, 0, 4, 9, 0, 131, 115, 99, 105, 115, 116, 0, 8, 17, 4,
+  16, 0, 132, 105, 102, 101, 115, 116, 0, 79, 159, 164, 18, 175, 164, 0, 18, 19,
+  18, 21, 11, 23, 17, 4, 0, 131, 111, 103, 105, 115, 116, 0, 15, 18, 0, 68, 188,
+  164, 16, 203, 164, 21, 251, 164, 0, 8, 11, 6, 21, 4, 0, 135, 111, 108, 111,
+  103, 105, 115, 116, 0, 68, 210, 164, 15, 230, 164, 0, 11, 23, 19, 18, 0, 138,
+  104, 116, 104, 97, 108, 109, 111, 108, 111, 103, 105, 115, 116, 0, 4, 11, 23,
+  19, 18, 0, 139, 104, 116, 104, 97, 108, 109, 111, 108, 111, 103, 105, 115,
+  116, 0, 8, 23, 8, 16, 0, 135, 111, 114, 111, 108, 111, 103, 105, 115, 116, 0,
+  82, 18, 165, 21, 31, 165, 0, 21, 9, 8, 21, 0, 133, 111, 114, 109, 105, 115,
+  116, 0, 8, 23, 27, 8, 0, 133, 114, 101, 109, 105, 115, 116, 0, 68, 54, 165,
+  12, 101, 165, 28, 113, 165, 0, 10, 0, 68, 63, 165, 18, 87, 165, 0, 108, 70,
+  165, 23, 76, 165, 0, 131, 105, 110, 115, 116, 0, 18, 21, 19, 0, 132, 111, 110,
+  105, 115, 116, 0, 23, 18, 21, 19, 0, 134, 97, 103, 111, 110, 105, 115, 116, 0,
+  16, 16, 8, 9, 0, 133, 105, 110, 105, 115, 116, 0, 10, 18, 22, 28, 16, 0, 136,
+  105, 115, 111, 103, 121, 110, 105, 115, 116, 0, 18, 15, 4, 0, 131, 109, 111,
+  115, 116, 0, 17, 12, 4, 10, 4, 0, 130, 115, 116, 0, 68, 157, 165, 16, 165,
+  165, 0, 6, 0, 131, 111, 97, 115, 116, 0, 21, 18, 9, 0, 131, 101, 109, 111,
+  115, 116, 0, 18, 16, 4, 9, 0, 128, 0, 11, 23, 21, 4, 6, 6, 16, 0, 129, 105,
+  115, 116, 0, 70, 212, 165, 18, 220, 165, 19, 7, 166, 22, 30, 166, 23, 37, 166,
+  0, 21, 12, 6, 0, 128, 105, 116, 0, 68, 230, 165, 5, 239, 165, 11, 247, 165, 0,
+  5, 0, 132, 97, 98, 111, 117, 116, 0, 5, 4, 0, 131, 111, 117, 116, 0, 10, 24,
+  18, 11, 23, 0, 134, 114, 111, 117, 103, 104, 111, 117, 116, 0, 87, 14, 166,
+  24, 22, 166, 0, 17, 12, 0, 131, 112, 117, 116, 0, 18, 0, 130, 116, 112, 117,
+  116, 0, 13, 0, 130, 117, 115, 116, 0, 19, 24, 18, 0, 131, 116, 112, 117, 116,
+  0, 68, 63, 166, 8, 90, 166, 19, 113, 166, 23, 121, 166, 28, 142, 166, 0, 8, 0,
+  79, 72, 166, 25, 80, 166, 0, 12, 16, 0, 130, 105, 101, 117, 0, 18, 17, 0, 131,
+  117, 118, 101, 97, 117, 0, 79, 97, 166, 23, 105, 166, 0, 12, 16, 0, 129, 105,
+  101, 117, 0, 4, 15, 19, 0, 128, 97, 117, 0, 18, 21, 10, 0, 129, 117, 112, 0,
+  82, 128, 166, 22, 135, 166, 0, 5, 4, 0, 129, 117, 116, 0, 13, 0, 130, 117,
+  115, 116, 0, 15, 14, 6, 12, 24, 20, 0, 128, 0, 72, 161, 166, 12, 204, 166, 15,
+  215, 166, 0, 68, 174, 166, 11, 181, 166, 12, 189, 166, 18, 197, 166, 0, 11,
+  44, 0, 129, 118, 101, 0, 4, 0, 131, 104, 97, 118, 101, 0, 8, 6, 8, 21, 0, 129,
+  118, 0, 15, 44, 0, 129, 118, 101, 0, 8, 11, 6, 4, 0, 130, 105, 101, 118, 101,
+  0, 8, 22, 16, 12, 11, 0, 128, 102, 0, 68, 234, 166, 12, 245, 166, 18, 255,
+  166, 0, 22, 21, 18, 9, 0, 130, 101, 115, 97, 119, 0, 8, 25, 8, 21, 0, 130,
+  105, 101, 119, 0, 71, 9, 167, 14, 18, 167, 21, 26, 167, 0, 7, 4, 11, 22, 0,
+  130, 111, 119, 0, 17, 0, 131, 107, 110, 111, 119, 0, 82, 33, 167, 21, 45, 167,
+  0, 16, 16, 18, 23, 0, 132, 111, 114, 114, 111, 119, 0, 18, 16, 16, 18, 23, 0,
+  133, 111, 114, 114, 111, 119, 0, 72, 65, 167, 24, 76, 167, 0, 17, 8, 15, 14,
+  0, 130, 101, 110, 101, 120, 0, 8, 12, 15, 8, 16, 0, 133, 105, 108, 105, 101,
+  117, 120, 0, 68, 142, 167, 6, 218, 167, 7, 51, 169, 8, 150, 169, 9, 93, 170,
+  10, 120, 170, 11, 80, 171, 12, 209, 171, 15, 220, 171, 16, 204, 182, 17, 12,
+  183, 19, 188, 183, 21, 237, 183, 22, 227, 188, 23, 20, 189, 24, 109, 193, 26,
+  120, 193, 0, 71, 155, 167, 21, 167, 167, 23, 197, 167, 26, 208, 167, 0, 12,
+  15, 15, 18, 11, 0, 132, 105, 100, 97, 121, 0, 85, 174, 167, 23, 187, 167, 0,
+  4, 22, 22, 12, 7, 0, 133, 97, 114, 114, 97, 121, 0, 18, 19, 0, 131, 114, 116,
+  114, 97, 121, 0, 17, 8, 16, 8, 15, 8, 0, 128, 114, 121, 0, 10, 12, 11, 0, 130,
+  104, 119, 97, 121, 0, 68, 240, 167, 8, 97, 168, 12, 108, 168, 17, 119, 168,
+  19, 251, 168, 21, 7, 169, 23, 35, 169, 0, 71, 250, 167, 11, 4, 168, 21, 14,
+  168, 0, 17, 8, 23, 0, 130, 101, 110, 99, 121, 0, 19, 18, 21, 19, 0, 130, 101,
+  99, 121, 0, 70, 21, 168, 24, 86, 168, 0, 81, 31, 168, 18, 42, 168, 21, 74,
+  168, 0, 28, 22, 18, 12, 7, 12, 0, 129, 115, 121, 0, 83, 49, 168, 21, 57, 168,
+  0, 28, 11, 0, 130, 105, 115, 121, 0, 24, 4, 8, 5, 0, 137, 117, 114, 101, 97,
+  117, 99, 114, 97, 99, 121, 0, 18, 16, 8, 7, 0, 133, 99, 114, 97, 99, 121, 0,
+  6, 4, 0, 132, 99, 117, 114, 97, 99, 121, 0, 24, 20, 8, 21, 9, 0, 129, 110, 99,
+  121, 0, 21, 6, 18, 19, 28, 11, 0, 129, 115, 121, 0, 68, 126, 168, 8, 197, 168,
+  0, 71, 139, 168, 16, 164, 168, 18, 174, 168, 28, 184, 168, 0, 17, 8, 0, 83,
+  149, 168, 23, 158, 168, 0, 8, 7, 0, 131, 101, 110, 99, 121, 0, 131, 101, 110,
+  99, 121, 0, 18, 15, 19, 12, 7, 0, 130, 99, 121, 0, 24, 5, 0, 131, 121, 97,
+  110, 99, 121, 0, 24, 18, 5, 0, 134, 117, 111, 121, 97, 110, 99, 121, 0, 70,
+  207, 168, 12, 219, 168, 24, 234, 168, 0, 12, 9, 9, 8, 0, 131, 105, 101, 110,
+  99, 121, 0, 6, 8, 9, 9, 8, 0, 134, 105, 99, 105, 101, 110, 99, 121, 0, 23, 12,
+  22, 17, 18, 6, 0, 134, 116, 105, 116, 117, 101, 110, 99, 121, 0, 24, 21, 14,
+  17, 4, 5, 0, 129, 116, 99, 121, 0, 68, 14, 169, 8, 23, 169, 0, 21, 8, 12, 11,
+  0, 128, 104, 121, 0, 25, 18, 21, 23, 17, 18, 6, 0, 129, 115, 121, 0, 19, 24,
+  21, 17, 4, 5, 0, 133, 107, 114, 117, 112, 116, 99, 121, 0, 68, 67, 169, 7,
+  108, 169, 8, 115, 169, 12, 125, 169, 21, 136, 169, 0, 72, 74, 169, 18, 101,
+  169, 0, 21, 0, 68, 83, 169, 15, 91, 169, 0, 132, 108, 114, 101, 97, 100, 121,
+  0, 15, 4, 0, 133, 114, 101, 97, 100, 121, 0, 21, 5, 0, 128, 108, 121, 0, 24,
+  23, 22, 0, 129, 121, 0, 10, 8, 15, 15, 4, 0, 128, 108, 121, 0, 10, 18, 21, 19,
+  0, 131, 100, 105, 103, 121, 0, 4, 19, 4, 8, 13, 0, 133, 111, 112, 97, 114,
+  100, 121, 0, 76, 169, 169, 15, 177, 169, 17, 19, 170, 21, 59, 170, 22, 71,
+  170, 23, 84, 170, 0, 21, 4, 25, 0, 128, 116, 121, 0, 69, 199, 169, 17, 207,
+  169, 18, 215, 169, 19, 221, 169, 21, 228, 169, 23, 254, 169, 25, 11, 170, 0,
+  4, 23, 18, 17, 0, 129, 121, 0, 18, 15, 0, 130, 101, 108, 121, 0, 22, 0, 128,
+  108, 121, 0, 16, 12, 22, 0, 129, 121, 0, 8, 0, 70, 237, 169, 25, 246, 169, 0,
+  17, 12, 22, 0, 130, 101, 108, 121, 0, 8, 22, 0, 130, 101, 108, 121, 0, 4, 12,
+  7, 8, 16, 16, 12, 0, 130, 101, 108, 121, 0, 12, 15, 0, 130, 101, 108, 121, 0,
+  76, 29, 170, 21, 38, 170, 24, 50, 170, 0, 6, 12, 7, 8, 16, 0, 129, 121, 0, 18,
+  23, 4, 0, 132, 116, 111, 114, 110, 101, 121, 0, 18, 13, 0, 130, 114, 110, 101,
+  121, 0, 4, 23, 8, 16, 8, 6, 0, 131, 101, 114, 121, 0, 21, 8, 25, 18, 21, 23,
+  17, 18, 6, 0, 129, 121, 0, 9, 4, 22, 0, 130, 101, 116, 121, 0, 12, 0, 79, 102,
+  170, 24, 111, 170, 0, 15, 12, 25, 0, 131, 105, 102, 121, 0, 20, 12, 15, 0,
+  130, 101, 102, 121, 0, 72, 133, 170, 15, 164, 170, 18, 178, 170, 21, 66, 171,
+  0, 71, 140, 170, 23, 151, 170, 0, 4, 21, 23, 22, 0, 131, 116, 101, 103, 121,
+  0, 21, 4, 23, 22, 0, 133, 114, 97, 116, 101, 103, 121, 0, 18, 19, 18, 21, 11,
+  23, 17, 4, 0, 129, 111, 103, 121, 0, 15, 0, 68, 190, 170, 8, 201, 170, 18,
+  234, 170, 0, 8, 7, 12, 0, 132, 111, 108, 111, 103, 121, 0, 68, 208, 170, 18,
+  220, 170, 0, 11, 6, 21, 4, 0, 131, 111, 108, 111, 103, 121, 0, 4, 11, 6, 21,
+  4, 0, 134, 101, 111, 108, 111, 103, 121, 0, 68, 253, 170, 6, 10, 171, 8, 22,
+  171, 12, 33, 171, 19, 42, 171, 21, 52, 171, 0, 11, 6, 21, 4, 0, 133, 101, 111,
+  108, 111, 103, 121, 0, 28, 22, 19, 0, 132, 104, 111, 108, 111, 103, 121, 0,
+  17, 8, 10, 0, 132, 97, 108, 111, 103, 121, 0, 21, 23, 0, 132, 108, 111, 103,
+  121, 0, 19, 4, 0, 133, 111, 108, 111, 103, 121, 0, 8, 23, 8, 16, 0, 133, 111,
+  114, 111, 108, 111, 103, 121, 0, 24, 15, 4, 23, 8, 16, 0, 131, 108, 117, 114,
+  103, 121, 0, 70, 90, 171, 19, 102, 171, 23, 183, 171, 0, 4, 21, 8, 12, 11, 0,
+  130, 114, 99, 104, 121, 0, 68, 112, 171, 18, 156, 171, 22, 171, 171, 0, 21,
+  10, 0, 76, 122, 171, 18, 136, 171, 0, 15, 4, 6, 0, 134, 108, 105, 103, 114,
+  97, 112, 104, 121, 0, 12, 5, 18, 11, 23, 24, 4, 0, 138, 111, 98, 105, 111,
+  103, 114, 97, 112, 104, 121, 0, 22, 12, 15, 12, 11, 19, 0, 133, 111, 115, 111,
+  112, 104, 121, 0, 18, 15, 12, 11, 19, 0, 130, 111, 112, 104, 121, 0, 68, 190,
+  171, 12, 199, 171, 0, 8, 11, 0, 130, 108, 116, 104, 121, 0, 21, 18, 11, 23,
+  24, 4, 0, 129, 121, 0, 23, 12, 23, 17, 4, 24, 20, 0, 129, 121, 0, 68, 22, 172,
+  5, 169, 173, 6, 154, 174, 7, 228, 174, 8, 60, 175, 10, 187, 176, 11, 15, 177,
+  12, 25, 177, 14, 241, 177, 15, 249, 177, 16, 100, 180, 17, 128, 180, 18, 197,
+  180, 19, 207, 180, 21, 220, 180, 22, 48, 181, 23, 73, 181, 24, 100, 182, 25,
+  141, 182, 0, 69, 50, 172, 6, 59, 172, 12, 142, 172, 15, 207, 172, 17, 216,
+  172, 19, 27, 173, 21, 39, 173, 23, 89, 173, 24, 101, 173, 0, 18, 21, 19, 0,
+  129, 98, 108, 121, 0, 12, 0, 79, 80, 172, 16, 88, 172, 17, 96, 172, 19, 104,
+  172, 22, 111, 172, 23, 131, 172, 0, 5, 24, 19, 0, 130, 108, 121, 0, 8, 11, 6,
+  0, 128, 108, 121, 0, 12, 15, 6, 0, 128, 108, 121, 0, 28, 23, 0, 128, 108, 121,
+  0, 68, 118, 172, 28, 124, 172, 0, 5, 0, 128, 108, 121, 0, 11, 19, 0, 128, 108,
+  121, 0, 4, 16, 16, 4, 21, 10, 0, 128, 108, 121, 0, 70, 149, 172, 23, 184, 172,
+  0, 72, 159, 172, 12, 167, 172, 17, 175, 172, 0, 19, 22, 8, 0, 128, 108, 121,
+  0, 9, 9, 18, 0, 128, 108, 121, 0, 4, 17, 12, 9, 0, 128, 108, 121, 0, 81, 191,
+  172, 21, 200, 172, 0, 8, 22, 22, 8, 0, 128, 108, 121, 0, 4, 19, 0, 128, 108,
+  121, 0, 8, 21, 0, 131, 97, 108, 108, 121, 0, 68, 226, 172, 12, 239, 172, 18,
+  2, 173, 0, 10, 12, 21, 18, 0, 132, 105, 110, 97, 108, 108, 121, 0, 73, 246,
+  172, 10, 250, 172, 0, 128, 108, 121, 0, 12, 21, 18, 0, 128, 108, 121, 0, 12,
+  23, 12, 7, 0, 68, 14, 173, 7, 21, 173, 0, 21, 23, 0, 128, 108, 121, 0, 4, 0,
+  128, 108, 121, 0, 12, 6, 17, 12, 21, 19, 0, 128, 105, 116, 121, 0, 72, 46,
+  173, 24, 81, 173, 0, 81, 53, 173, 23, 60, 173, 0, 8, 10, 0, 128, 108, 121, 0,
+  68, 67, 173, 12, 75, 173, 0, 15, 12, 5, 0, 128, 108, 121, 0, 15, 0, 128, 108,
+  121, 0, 23, 4, 17, 0, 128, 108, 121, 0, 17, 8, 7, 12, 6, 6, 4, 0, 128, 108,
+  121, 0, 71, 114, 173, 17, 125, 173, 22, 132, 173, 23, 138, 173, 0, 12, 25, 12,
+  7, 17, 12, 0, 128, 108, 121, 0, 17, 4, 0, 128, 108, 121, 0, 24, 0, 128, 108,
+  121, 0, 70, 148, 173, 17, 154, 173, 21, 162, 173, 0, 4, 0, 128, 108, 121, 0,
+  8, 25, 8, 0, 128, 108, 121, 0, 12, 25, 0, 128, 108, 121, 0, 68, 182, 173, 5,
+  73, 174, 12, 87, 174, 24, 144, 174, 0, 70, 201, 173, 8, 213, 173, 10, 223,
+  173, 21, 240, 173, 22, 253, 173, 23, 21, 174, 0, 12, 23, 18, 17, 0, 131, 101,
+  97, 98, 108, 121, 0, 23, 18, 17, 0, 132, 97, 98, 108, 121, 0, 17, 4, 11, 6,
+  21, 8, 23, 17, 12, 0, 131, 101, 97, 98, 108, 121, 0, 21, 8, 9, 8, 21, 19, 0,
+  132, 97, 98, 108, 121, 0, 76, 4, 174, 22, 12, 174, 0, 25, 0, 131, 105, 98,
+  108, 121, 0, 18, 19, 0, 131, 105, 98, 108, 121, 0, 76, 28, 174, 22, 41, 174,
+  0, 23, 12, 25, 8, 17, 12, 0, 133, 97, 98, 108, 121, 0, 12, 22, 8, 21, 0, 76,
+  53, 174, 21, 65, 174, 0, 136, 114, 101, 115, 105, 115, 116, 105, 98, 108, 121,
+  0, 12, 0, 131, 105, 98, 108, 121, 0, 4, 6, 8, 19, 16, 12, 0, 132, 99, 97, 98,
+  108, 121, 0, 80, 94, 174, 23, 106, 174, 0, 24, 22, 8, 21, 19, 0, 131, 97, 98,
+  108, 121, 0, 86, 113, 174, 24, 131, 174, 0, 12, 22, 8, 21, 12, 0, 136, 114,
+  101, 115, 105, 115, 116, 105, 98, 108, 121, 0, 19, 22, 12, 7, 17, 12, 0, 131,
+  97, 98, 108, 121, 0, 10, 21, 4, 0, 130, 97, 98, 108, 121, 0, 76, 161, 174, 21,
+  219, 174, 0, 81, 171, 174, 22, 181, 174, 23, 190, 174, 0, 18, 21, 12, 0, 129,
+  97, 108, 108, 121, 0, 4, 5, 0, 129, 97, 108, 108, 121, 0, 68, 197, 174, 6,
+  209, 174, 0, 16, 18, 23, 24, 4, 0, 129, 97, 108, 108, 121, 0, 4, 21, 19, 0,
+  129, 97, 108, 108, 121, 0, 8, 12, 9, 0, 129, 101, 108, 121, 0, 68, 238, 174,
+  8, 15, 175, 21, 46, 175, 0, 72, 245, 174, 23, 3, 175, 0, 23, 8, 19, 8, 21, 0,
+  133, 97, 116, 101, 100, 108, 121, 0, 21, 18, 19, 8, 21, 0, 131, 101, 100, 108,
+  121, 0, 86, 22, 175, 23, 32, 175, 0, 18, 19, 21, 24, 19, 0, 130, 108, 121, 0,
+  18, 19, 21, 24, 19, 0, 132, 114, 116, 101, 100, 108, 121, 0, 18, 26, 21, 8,
+  11, 23, 18, 0, 130, 108, 100, 108, 121, 0, 69, 85, 175, 7, 97, 175, 10, 123,
+  175, 16, 133, 175, 21, 163, 175, 23, 174, 175, 24, 74, 176, 25, 81, 176, 0, 4,
+  16, 24, 22, 8, 21, 19, 0, 130, 108, 121, 0, 72, 104, 175, 12, 114, 175, 0, 10,
+  8, 15, 15, 4, 0, 130, 108, 121, 0, 6, 8, 7, 0, 129, 100, 108, 121, 0, 8, 15,
+  15, 4, 0, 129, 100, 108, 121, 0, 72, 140, 175, 12, 152, 175, 0, 23, 27, 8, 0,
+  132, 114, 101, 109, 101, 108, 121, 0, 23, 15, 24, 0, 130, 97, 116, 101, 108,
+  121, 0, 24, 23, 4, 17, 0, 130, 97, 108, 108, 121, 0, 68, 184, 175, 5, 47, 176,
+  12, 58, 176, 0, 71, 194, 175, 12, 209, 175, 16, 30, 176, 0, 12, 16, 16, 12, 0,
+  134, 101, 100, 105, 97, 116, 101, 108, 121, 0, 71, 216, 175, 27, 16, 176, 0,
+  72, 223, 175, 12, 2, 176, 0, 16, 0, 76, 232, 175, 16, 243, 175, 0, 135, 109,
+  101, 100, 105, 97, 116, 101, 108, 121, 0, 8, 0, 138, 105, 109, 109, 101, 100,
+  105, 97, 116, 101, 108, 121, 0, 16, 16, 12, 0, 135, 101, 100, 105, 97, 116,
+  101, 108, 121, 0, 18, 21, 19, 19, 4, 0, 132, 109, 97, 116, 101, 108, 121, 0,
+  4, 27, 18, 21, 19, 19, 4, 0, 134, 105, 109, 97, 116, 101, 108, 121, 0, 24, 18,
+  7, 17, 24, 0, 129, 100, 108, 121, 0, 16, 12, 27, 18, 21, 19, 19, 4, 0, 132,
+  97, 116, 101, 108, 121, 0, 21, 23, 0, 130, 108, 121, 0, 68, 91, 176, 12, 106,
+  176, 23, 171, 176, 0, 23, 12, 15, 8, 21, 0, 134, 97, 116, 105, 118, 101, 108,
+  121, 0, 86, 113, 176, 23, 130, 176, 0, 17, 8, 9, 9, 8, 7, 0, 136, 101, 110,
+  115, 105, 118, 101, 108, 121, 0, 6, 8, 0, 83, 140, 176, 22, 155, 176, 0, 8,
+  21, 0, 136, 115, 112, 101, 99, 116, 105, 118, 101, 108, 121, 0, 19, 8, 21, 0,
+  137, 115, 112, 101, 99, 116, 105, 118, 101, 108, 121, 0, 12, 15, 4, 8, 21, 0,
+  135, 108, 97, 116, 105, 118, 101, 108, 121, 0, 81, 194, 176, 24, 7, 177, 0,
+  76, 201, 176, 18, 254, 176, 0, 71, 211, 176, 21, 227, 176, 22, 242, 176, 0, 8,
+  8, 27, 8, 0, 135, 99, 101, 101, 100, 105, 110, 103, 108, 121, 0, 4, 19, 22,
+  12, 7, 0, 132, 97, 103, 105, 110, 103, 108, 121, 0, 18, 19, 19, 24, 22, 0,
+  132, 101, 100, 108, 121, 0, 16, 16, 18, 6, 0, 130, 108, 121, 0, 18, 21, 0,
+  129, 104, 108, 121, 0, 10, 12, 15, 22, 0, 129, 116, 108, 121, 0, 85, 32, 177,
+  23, 215, 177, 0, 4, 0, 79, 47, 177, 17, 86, 177, 22, 128, 177, 23, 202, 177,
+  0, 76, 54, 177, 24, 62, 177, 0, 16, 12, 22, 0, 130, 108, 121, 0, 70, 69, 177,
+  10, 79, 177, 0, 12, 23, 21, 4, 19, 0, 130, 108, 121, 0, 8, 21, 0, 130, 108,
+  121, 0, 12, 7, 0, 76, 96, 177, 21, 109, 177, 0, 21, 18, 0, 136, 100, 105, 110,
+  97, 114, 105, 108, 121, 0, 18, 21, 23, 27, 8, 0, 137, 97, 111, 114, 100, 105,
+  110, 97, 114, 105, 108, 121, 0, 68, 138, 177, 8, 154, 177, 22, 186, 177, 0,
+  22, 22, 8, 17, 0, 136, 99, 101, 115, 115, 97, 114, 105, 108, 121, 0, 6, 0, 70,
+  163, 177, 8, 176, 177, 0, 8, 17, 0, 135, 101, 115, 115, 97, 114, 105, 108,
+  121, 0, 17, 0, 132, 115, 97, 114, 105, 108, 121, 0, 8, 6, 6, 8, 17, 0, 136,
+  101, 115, 115, 97, 114, 105, 108, 121, 0, 12, 5, 21, 4, 0, 132, 114, 97, 114,
+  105, 108, 121, 0, 81, 222, 177, 21, 233, 177, 0, 8, 24, 20, 8, 21, 9, 0, 130,
+  108, 121, 0, 8, 9, 0, 128, 105, 116, 121, 0, 12, 15, 0, 129, 101, 108, 121, 0,
+  68, 6, 178, 5, 55, 180, 8, 64, 180, 17, 89, 180, 0, 70, 31, 178, 8, 114, 178,
+  12, 127, 178, 17, 246, 178, 21, 96, 179, 22, 110, 179, 23, 134, 179, 24, 238,
+  179, 0, 12, 0, 75, 43, 178, 15, 66, 178, 23, 74, 178, 0, 19, 18, 22, 18, 15,
+  15, 12, 11, 19, 0, 139, 111, 115, 111, 112, 104, 105, 99, 97, 108, 108, 121,
+  0, 5, 24, 19, 0, 131, 108, 121, 0, 4, 16, 0, 68, 84, 178, 11, 98, 178, 0, 21,
+  10, 0, 135, 109, 97, 116, 105, 99, 97, 108, 108, 121, 0, 23, 4, 16, 0, 136,
+  101, 109, 97, 116, 105, 99, 97, 108, 108, 121, 0, 21, 7, 8, 9, 0, 133, 101,
+  114, 97, 108, 108, 121, 0, 70, 137, 178, 17, 171, 178, 23, 216, 178, 0, 72,
+  144, 178, 9, 159, 178, 0, 19, 27, 8, 0, 136, 115, 112, 101, 99, 105, 97, 108,
+  108, 121, 0, 9, 18, 0, 133, 105, 99, 105, 97, 108, 108, 121, 0, 72, 181, 178,
+  10, 193, 178, 12, 205, 178, 0, 21, 8, 19, 0, 132, 110, 105, 97, 108, 108, 121,
+  0, 12, 21, 18, 0, 133, 105, 110, 97, 108, 108, 121, 0, 10, 12, 21, 18, 0, 132,
+  97, 108, 108, 121, 0, 17, 8, 0, 71, 226, 178, 25, 237, 178, 0, 12, 6, 17, 12,
+  0, 132, 97, 108, 108, 121, 0, 8, 0, 132, 117, 97, 108, 108, 121, 0, 72, 0,
+  179, 12, 9, 179, 18, 23, 179, 0, 16, 0, 131, 116, 97, 108, 108, 121, 0, 23,
+  12, 7, 7, 4, 0, 132, 111, 110, 97, 108, 108, 121, 0, 12, 0, 71, 35, 179, 22,
+  49, 179, 23, 60, 179, 0, 4, 21, 23, 0, 133, 116, 105, 111, 110, 97, 108, 108,
+  121, 0, 24, 15, 8, 7, 0, 133, 118, 101, 108, 121, 0, 68, 67, 179, 7, 81, 179,
+  0, 6, 6, 18, 0, 135, 115, 105, 111, 110, 97, 108, 108, 121, 0, 4, 21, 23, 0,
+  135, 105, 116, 105, 111, 110, 97, 108, 108, 121, 0, 8, 23, 23, 12, 15, 0, 134,
+  101, 114, 97, 108, 108, 121, 0, 24, 0, 108, 119, 179, 22, 126, 179, 0, 131,
+  117, 97, 108, 108, 121, 0, 24, 0, 132, 97, 108, 108, 121, 0, 81, 141, 179, 24,
+  210, 179, 0, 8, 0, 71, 153, 179, 16, 184, 179, 25, 201, 179, 0, 72, 160, 179,
+  12, 177, 179, 0, 6, 17, 12, 18, 6, 0, 136, 105, 100, 101, 110, 116, 97, 108,
+  108, 121, 0, 25, 8, 0, 131, 108, 121, 0, 4, 21, 6, 17, 12, 0, 136, 101, 109,
+  101, 110, 116, 97, 108, 108, 121, 0, 8, 0, 131, 117, 97, 108, 108, 121, 0, 70,
+  217, 179, 21, 227, 179, 0, 4, 0, 133, 116, 117, 97, 108, 108, 121, 0, 12, 25,
+  0, 133, 116, 117, 97, 108, 108, 121, 0, 70, 248, 179, 17, 5, 180, 23, 22, 180,
+  0, 12, 23, 21, 4, 19, 0, 131, 108, 97, 114, 108, 121, 0, 12, 23, 22, 17, 18,
+  6, 0, 136, 116, 105, 110, 117, 97, 108, 108, 121, 0, 75, 29, 180, 17, 42, 180,
+  0, 17, 8, 25, 8, 0, 134, 116, 117, 97, 108, 108, 121, 0, 8, 24, 20, 8, 22, 17,
+  18, 6, 0, 132, 108, 121, 0, 4, 5, 18, 21, 19, 0, 129, 121, 0, 68, 71, 180, 16,
+  80, 180, 0, 21, 0, 132, 101, 97, 108, 108, 121, 0, 21, 18, 9, 0, 130, 114,
+  108, 121, 0, 4, 12, 9, 0, 132, 110, 97, 108, 108, 121, 0, 8, 0, 80, 109, 180,
+  21, 119, 180, 0, 8, 21, 23, 27, 8, 0, 130, 108, 121, 0, 23, 27, 8, 0, 129,
+  101, 108, 121, 0, 68, 138, 180, 8, 149, 180, 18, 182, 180, 0, 23, 22, 17, 18,
+  6, 0, 129, 116, 108, 121, 0, 83, 159, 180, 21, 168, 180, 23, 177, 180, 0, 19,
+  18, 0, 132, 101, 110, 108, 121, 0, 21, 24, 6, 0, 129, 116, 108, 121, 0, 9, 18,
+  0, 129, 0, 17, 8, 16, 18, 17, 8, 11, 19, 0, 131, 97, 108, 108, 121, 0, 16, 18,
+  17, 4, 0, 130, 97, 108, 121, 0, 12, 6, 17, 12, 21, 19, 0, 129, 97, 108, 108,
+  121, 0, 68, 230, 180, 8, 31, 181, 18, 40, 181, 0, 72, 240, 180, 16, 248, 180,
+  24, 1, 181, 0, 8, 0, 132, 97, 114, 108, 121, 0, 12, 21, 19, 0, 129, 105, 108,
+  121, 0, 70, 8, 181, 10, 21, 181, 0, 12, 23, 21, 4, 19, 0, 131, 108, 97, 114,
+  108, 121, 0, 8, 21, 0, 131, 108, 97, 114, 108, 121, 0, 25, 8, 22, 0, 129, 101,
+  108, 121, 0, 11, 22, 0, 129, 116, 108, 121, 0, 76, 55, 181, 17, 65, 181, 0, 6,
+  8, 21, 19, 0, 129, 101, 108, 121, 0, 8, 7, 0, 129, 101, 108, 121, 0, 68, 92,
+  181, 6, 150, 181, 8, 181, 181, 12, 194, 181, 17, 205, 181, 24, 89, 182, 0, 76,
+  102, 181, 17, 113, 181, 21, 138, 181, 0, 7, 8, 16, 16, 12, 0, 129, 101, 108,
+  121, 0, 72, 120, 181, 12, 127, 181, 0, 19, 0, 130, 108, 116, 121, 0, 9, 8, 7,
+  0, 131, 105, 116, 101, 108, 121, 0, 8, 5, 12, 15, 8, 7, 0, 129, 101, 108, 121,
+  0, 72, 157, 181, 12, 170, 181, 0, 12, 21, 7, 0, 134, 105, 114, 101, 99, 116,
+  108, 121, 0, 15, 19, 27, 8, 0, 130, 105, 116, 108, 121, 0, 17, 12, 9, 8, 7, 0,
+  131, 105, 116, 101, 108, 121, 0, 17, 12, 9, 8, 7, 0, 129, 101, 108, 121, 0,
+  68, 215, 181, 8, 12, 182, 12, 79, 182, 0, 71, 225, 181, 12, 241, 181, 21, 0,
+  182, 0, 8, 19, 8, 7, 17, 12, 0, 133, 110, 100, 101, 110, 116, 108, 121, 0, 16,
+  18, 7, 8, 21, 19, 0, 132, 110, 97, 116, 101, 108, 121, 0, 8, 11, 17, 12, 0,
+  132, 101, 110, 116, 108, 121, 0, 71, 22, 182, 17, 48, 182, 24, 62, 182, 0, 12,
+  6, 0, 70, 32, 182, 17, 40, 182, 0, 4, 0, 129, 97, 108, 108, 121, 0, 12, 0,
+  129, 97, 108, 108, 121, 0, 12, 16, 16, 8, 0, 135, 105, 110, 101, 110, 116,
+  108, 121, 0, 20, 17, 8, 22, 17, 18, 6, 0, 135, 113, 117, 101, 110, 116, 108,
+  121, 0, 4, 23, 21, 8, 6, 0, 130, 108, 121, 0, 15, 18, 22, 5, 4, 0, 129, 101,
+  108, 121, 0, 9, 22, 0, 72, 110, 182, 22, 125, 182, 0, 6, 24, 22, 0, 133, 99,
+  101, 115, 115, 102, 117, 108, 108, 121, 0, 8, 6, 24, 22, 0, 134, 99, 101, 115,
+  115, 102, 117, 108, 108, 121, 0, 12, 0, 86, 150, 182, 23, 166, 182, 0, 15, 24,
+  6, 27, 8, 0, 134, 108, 117, 115, 105, 118, 101, 108, 121, 0, 68, 173, 182, 6,
+  182, 182, 0, 15, 8, 21, 0, 129, 101, 108, 121, 0, 68, 189, 182, 8, 194, 182,
+  0, 129, 101, 108, 121, 0, 19, 22, 8, 21, 0, 129, 101, 108, 121, 0, 68, 214,
+  182, 8, 224, 182, 18, 237, 182, 0, 7, 4, 6, 4, 0, 130, 101, 109, 121, 0, 7, 4,
+  6, 6, 4, 0, 133, 97, 100, 101, 109, 121, 0, 81, 244, 182, 23, 0, 183, 0, 18,
+  8, 6, 8, 0, 133, 111, 110, 111, 109, 121, 0, 11, 6, 12, 7, 0, 131, 111, 116,
+  111, 109, 121, 0, 68, 31, 183, 8, 83, 183, 15, 108, 183, 18, 117, 183, 19,
+  162, 183, 28, 173, 183, 0, 80, 41, 183, 19, 50, 183, 21, 61, 183, 0, 18, 6, 0,
+  130, 112, 97, 110, 121, 0, 4, 16, 18, 6, 0, 132, 112, 97, 110, 121, 0, 85, 68,
+  183, 28, 77, 183, 0, 28, 23, 0, 131, 97, 110, 110, 121, 0, 23, 0, 128, 110,
+  121, 0, 74, 90, 183, 18, 101, 183, 0, 18, 21, 7, 17, 4, 0, 130, 121, 110, 121,
+  0, 16, 0, 130, 110, 101, 121, 0, 12, 4, 16, 0, 130, 110, 108, 121, 0, 79, 124,
+  183, 16, 133, 183, 0, 15, 18, 6, 0, 131, 111, 110, 121, 0, 76, 140, 183, 18,
+  151, 183, 0, 21, 8, 6, 0, 132, 101, 109, 111, 110, 121, 0, 21, 8, 6, 0, 132,
+  101, 109, 111, 110, 121, 0, 4, 16, 18, 6, 0, 131, 112, 97, 110, 121, 0, 10,
+  18, 22, 28, 16, 0, 134, 105, 115, 111, 103, 121, 110, 121, 0, 82, 195, 183,
+  19, 211, 183, 0, 6, 22, 18, 6, 12, 16, 0, 133, 114, 111, 115, 99, 111, 112,
+  121, 0, 75, 218, 183, 12, 229, 183, 0, 4, 17, 24, 0, 132, 104, 97, 112, 112,
+  121, 0, 15, 22, 0, 128, 101, 114, 121, 0, 68, 3, 184, 7, 245, 186, 8, 255,
+  186, 12, 128, 187, 18, 136, 187, 21, 45, 188, 23, 87, 188, 0, 69, 40, 184, 6,
+  49, 184, 7, 82, 184, 12, 124, 184, 15, 181, 184, 16, 238, 184, 17, 247, 184,
+  18, 90, 185, 21, 104, 185, 22, 161, 185, 23, 39, 186, 24, 198, 186, 0, 12, 15,
+  0, 130, 114, 97, 114, 121, 0, 72, 56, 184, 12, 70, 184, 0, 22, 22, 8, 17, 0,
+  134, 99, 101, 115, 115, 97, 114, 121, 0, 9, 8, 17, 8, 5, 0, 130, 105, 97, 114,
+  121, 0, 76, 89, 184, 17, 100, 184, 0, 22, 5, 24, 22, 0, 130, 105, 97, 114,
+  121, 0, 82, 107, 184, 24, 117, 184, 0, 5, 0, 132, 117, 110, 100, 97, 114, 121,
+  0, 18, 9, 0, 130, 114, 121, 0, 79, 131, 184, 22, 172, 184, 0, 76, 138, 184,
+  15, 146, 184, 0, 16, 0, 130, 116, 97, 114, 121, 0, 12, 0, 70, 155, 184, 27,
+  163, 184, 0, 17, 4, 0, 131, 97, 114, 121, 0, 24, 4, 0, 132, 105, 97, 114, 121,
+  0, 22, 8, 19, 0, 131, 97, 114, 121, 0, 76, 191, 184, 15, 201, 184, 24, 227,
+  184, 0, 27, 24, 4, 0, 130, 105, 97, 114, 121, 0, 12, 0, 87, 210, 184, 27, 218,
+  184, 0, 21, 4, 0, 130, 101, 114, 121, 0, 24, 4, 0, 131, 105, 97, 114, 121, 0,
+  6, 12, 23, 21, 4, 19, 0, 128, 108, 121, 0, 24, 22, 0, 130, 109, 97, 114, 121,
+  0, 72, 1, 185, 12, 13, 185, 18, 32, 185, 0, 10, 4, 16, 12, 0, 132, 105, 110,
+  97, 114, 121, 0, 7, 21, 18, 21, 23, 27, 8, 0, 135, 97, 111, 114, 100, 105,
+  110, 97, 114, 121, 0, 76, 42, 185, 22, 63, 185, 23, 75, 185, 0, 23, 24, 15,
+  18, 25, 17, 8, 0, 139, 118, 111, 108, 117, 116, 105, 111, 110, 97, 114, 121,
+  0, 22, 12, 16, 0, 132, 105, 111, 110, 97, 114, 121, 0, 12, 7, 8, 19, 27, 8, 0,
+  132, 105, 111, 110, 97, 114, 121, 0, 19, 16, 8, 23, 17, 18, 6, 0, 130, 114,
+  97, 114, 121, 0, 82, 114, 185, 23, 132, 185, 24, 147, 185, 0, 19, 16, 4, 23,
+  17, 18, 6, 0, 135, 101, 109, 112, 111, 114, 97, 114, 121, 0, 12, 21, 5, 4, 0,
+  135, 114, 98, 105, 116, 114, 97, 114, 121, 0, 5, 8, 9, 0, 135, 70, 101, 98,
+  114, 117, 97, 114, 121, 0, 72, 177, 185, 12, 220, 185, 15, 232, 185, 21, 243,
+  185, 22, 4, 186, 0, 70, 184, 185, 25, 210, 185, 0, 70, 191, 185, 8, 202, 185,
+  0, 8, 17, 0, 133, 101, 115, 115, 97, 114, 121, 0, 17, 0, 130, 115, 97, 114,
+  121, 0, 7, 4, 0, 131, 114, 115, 97, 114, 121, 0, 16, 16, 8, 0, 133, 105, 115,
+  115, 97, 114, 121, 0, 24, 19, 16, 18, 6, 0, 130, 111, 114, 121, 0, 8, 25, 12,
+  17, 4, 0, 135, 110, 105, 118, 101, 114, 115, 97, 114, 121, 0, 8, 6, 0, 70, 14,
+  186, 8, 25, 186, 0, 8, 17, 0, 134, 101, 115, 115, 97, 114, 121, 0, 17, 24, 0,
+  135, 110, 101, 99, 101, 115, 115, 97, 114, 121, 0, 68, 55, 186, 8, 83, 186,
+  12, 112, 186, 15, 139, 186, 17, 149, 186, 0, 79, 62, 186, 21, 72, 186, 0, 18,
+  22, 0, 132, 105, 116, 97, 114, 121, 0, 6, 8, 22, 0, 132, 101, 116, 97, 114,
+  121, 0, 76, 90, 186, 16, 104, 186, 0, 19, 18, 21, 19, 0, 133, 114, 105, 101,
+  116, 97, 114, 121, 0, 8, 6, 0, 130, 101, 114, 121, 0, 69, 119, 186, 15, 128,
+  186, 0, 21, 4, 0, 130, 114, 97, 114, 121, 0, 15, 12, 16, 0, 133, 105, 116, 97,
+  114, 121, 0, 12, 16, 0, 131, 105, 116, 97, 114, 121, 0, 72, 156, 186, 18, 186,
+  186, 0, 16, 0, 72, 165, 186, 12, 173, 186, 0, 6, 0, 132, 116, 101, 114, 121,
+  0, 15, 8, 0, 135, 101, 109, 101, 110, 116, 97, 114, 121, 0, 15, 18, 25, 0,
+  133, 117, 110, 116, 97, 114, 121, 0, 69, 208, 186, 7, 221, 186, 22, 233, 186,
+  0, 8, 9, 0, 134, 70, 101, 98, 114, 117, 97, 114, 121, 0, 12, 22, 5, 24, 22, 0,
+  131, 105, 97, 114, 121, 0, 12, 7, 24, 13, 0, 132, 99, 105, 97, 114, 121, 0,
+  17, 24, 18, 5, 0, 129, 97, 114, 121, 0, 77, 18, 187, 15, 27, 187, 19, 40, 187,
+  22, 48, 187, 23, 76, 187, 25, 117, 187, 0, 21, 8, 19, 0, 130, 117, 114, 121,
+  0, 15, 26, 8, 13, 0, 132, 101, 108, 108, 101, 114, 121, 0, 18, 21, 19, 0, 128,
+  116, 121, 0, 79, 55, 187, 22, 66, 187, 0, 24, 19, 16, 18, 6, 0, 130, 111, 114,
+  121, 0, 8, 6, 8, 17, 0, 130, 97, 114, 121, 0, 72, 83, 187, 22, 93, 187, 0, 21,
+  6, 8, 22, 0, 130, 97, 114, 121, 0, 12, 0, 80, 102, 187, 17, 110, 187, 0, 133,
+  121, 115, 116, 101, 114, 121, 0, 12, 16, 0, 130, 114, 121, 0, 18, 21, 23, 17,
+  18, 6, 0, 128, 115, 121, 0, 4, 21, 19, 0, 128, 105, 101, 0, 74, 152, 187, 17,
+  164, 187, 19, 172, 187, 23, 184, 187, 26, 32, 188, 0, 4, 23, 4, 6, 0, 132,
+  101, 103, 111, 114, 121, 0, 18, 11, 0, 128, 97, 114, 121, 0, 16, 8, 23, 17,
+  18, 6, 0, 128, 97, 114, 121, 0, 68, 197, 187, 8, 229, 187, 12, 241, 187, 22,
+  254, 187, 0, 83, 204, 187, 21, 216, 187, 0, 8, 21, 19, 0, 131, 114, 97, 116,
+  111, 114, 121, 0, 5, 4, 15, 0, 133, 111, 114, 97, 116, 111, 114, 121, 0, 12,
+  21, 19, 18, 21, 19, 0, 130, 97, 114, 121, 0, 10, 18, 21, 8, 7, 0, 132, 97,
+  116, 111, 114, 121, 0, 72, 5, 188, 11, 24, 188, 0, 70, 12, 188, 7, 19, 188, 0,
+  17, 4, 0, 130, 114, 121, 0, 130, 114, 111, 121, 0, 132, 105, 115, 116, 111,
+  114, 121, 0, 4, 22, 22, 4, 6, 0, 132, 111, 119, 97, 114, 121, 0, 68, 52, 188,
+  21, 81, 188, 0, 86, 59, 188, 26, 72, 188, 0, 12, 16, 16, 8, 0, 134, 105, 115,
+  115, 97, 114, 121, 0, 18, 22, 22, 4, 6, 0, 129, 121, 0, 4, 15, 0, 129, 121, 0,
+  68, 103, 188, 12, 135, 188, 17, 147, 188, 18, 161, 188, 22, 183, 188, 0, 81,
+  110, 188, 23, 123, 188, 0, 8, 16, 24, 6, 18, 7, 0, 131, 116, 97, 114, 121, 0,
+  17, 8, 16, 12, 7, 24, 21, 0, 130, 114, 121, 0, 22, 17, 12, 16, 0, 132, 105,
+  115, 116, 114, 121, 0, 24, 6, 18, 44, 0, 134, 99, 111, 117, 110, 116, 114,
+  121, 0, 72, 168, 188, 22, 177, 188, 0, 19, 0, 132, 111, 101, 116, 114, 121, 0,
+  131, 116, 111, 114, 121, 0, 71, 193, 188, 8, 205, 188, 17, 217, 188, 0, 24,
+  17, 12, 0, 133, 100, 117, 115, 116, 114, 121, 0, 16, 8, 11, 6, 0, 132, 105,
+  115, 116, 114, 121, 0, 12, 16, 0, 131, 105, 115, 116, 114, 121, 0, 68, 234,
+  188, 21, 3, 189, 0, 85, 241, 188, 26, 252, 188, 0, 6, 18, 19, 28, 11, 0, 130,
+  105, 115, 121, 0, 15, 4, 0, 129, 121, 115, 0, 8, 25, 4, 21, 23, 17, 18, 6, 0,
+  133, 111, 118, 101, 114, 115, 121, 0, 68, 57, 189, 6, 155, 189, 7, 168, 189,
+  8, 182, 189, 9, 221, 189, 12, 229, 189, 15, 177, 192, 16, 246, 192, 17, 1,
+  193, 18, 46, 193, 21, 73, 193, 24, 100, 193, 0, 79, 67, 189, 21, 117, 189, 23,
+  145, 189, 0, 76, 74, 189, 24, 107, 189, 0, 69, 81, 189, 23, 92, 189, 0, 4, 5,
+  18, 21, 19, 0, 130, 105, 116, 121, 0, 12, 22, 21, 8, 25, 0, 134, 97, 116, 105,
+  108, 105, 116, 121, 0, 22, 4, 6, 0, 131, 97, 108, 116, 121, 0, 68, 124, 189,
+  12, 135, 189, 0, 15, 24, 19, 18, 19, 0, 130, 105, 116, 121, 0, 15, 12, 16, 0,
+  131, 116, 97, 114, 121, 0, 17, 4, 24, 20, 0, 130, 105, 116, 121, 0, 12, 21,
+  23, 6, 8, 15, 8, 0, 129, 105, 116, 121, 0, 12, 15, 12, 4, 25, 0, 133, 108,
+  105, 100, 105, 116, 121, 0, 76, 189, 189, 18, 215, 189, 0, 71, 196, 189, 21,
+  202, 189, 0, 131, 101, 105, 116, 121, 0, 8, 23, 18, 17, 0, 133, 111, 114, 105,
+  101, 116, 121, 0, 19, 0, 128, 114, 121, 0, 4, 22, 0, 129, 101, 116, 121, 0,
+  68, 4, 190, 5, 20, 190, 6, 36, 190, 7, 53, 190, 8, 65, 190, 15, 76, 190, 16,
+  2, 192, 17, 15, 192, 21, 137, 192, 23, 169, 192, 0, 15, 19, 12, 6, 17, 12, 21,
+  19, 0, 132, 97, 108, 105, 116, 121, 0, 12, 15, 4, 5, 18, 21, 19, 0, 133, 98,
+  105, 108, 105, 116, 121, 0, 12, 21, 23, 8, 15, 8, 0, 134, 99, 116, 114, 105,
+  99, 105, 116, 121, 0, 12, 21, 8, 11, 0, 132, 101, 100, 105, 116, 121, 0, 21,
+  25, 0, 132, 97, 114, 105, 101, 116, 121, 0, 68, 92, 190, 5, 174, 190, 12, 23,
+  191, 23, 232, 191, 24, 247, 191, 0, 76, 102, 190, 17, 118, 190, 19, 134, 190,
+  0, 23, 22, 4, 8, 5, 0, 136, 115, 116, 105, 97, 108, 105, 116, 121, 0, 22, 18,
+  21, 8, 19, 0, 135, 115, 111, 110, 97, 108, 105, 116, 121, 0, 12, 6, 0, 76,
+  144, 190, 17, 160, 190, 0, 17, 17, 24, 16, 0, 137, 105, 99, 105, 112, 97, 108,
+  105, 116, 121, 0, 24, 16, 0, 135, 105, 99, 105, 112, 97, 108, 105, 116, 121,
+  0, 68, 181, 190, 12, 229, 190, 0, 76, 191, 190, 15, 202, 190, 23, 214, 190, 0,
+  15, 8, 21, 0, 131, 105, 108, 105, 116, 121, 0, 12, 4, 25, 4, 0, 131, 105, 108,
+  105, 116, 121, 0, 4, 19, 16, 18, 6, 0, 133, 105, 98, 105, 108, 105, 116, 121,
+  0, 86, 236, 190, 23, 10, 191, 0, 81, 243, 190, 22, 0, 191, 0, 18, 19, 22, 8,
+  21, 0, 131, 105, 108, 105, 116, 121, 0, 18, 19, 0, 131, 105, 108, 105, 116,
+  121, 0, 4, 19, 16, 18, 6, 0, 131, 105, 108, 105, 116, 121, 0, 69, 30, 191, 15,
+  170, 191, 0, 68, 37, 191, 21, 156, 191, 0, 79, 53, 191, 19, 68, 191, 21, 82,
+  191, 22, 105, 191, 23, 141, 191, 0, 4, 9, 17, 12, 0, 134, 108, 105, 98, 105,
+  108, 105, 116, 121, 0, 16, 18, 6, 0, 133, 116, 105, 98, 105, 108, 105, 116,
+  121, 0, 8, 25, 24, 8, 18, 17, 4, 16, 0, 140, 101, 117, 118, 101, 114, 97, 98,
+  105, 108, 105, 116, 121, 0, 81, 112, 191, 22, 127, 191, 0, 18, 19, 22, 8, 21,
+  0, 134, 105, 98, 105, 108, 105, 116, 121, 0, 12, 16, 7, 4, 0, 134, 105, 98,
+  105, 108, 105, 116, 121, 0, 4, 19, 16, 18, 6, 0, 134, 105, 98, 105, 108, 105,
+  116, 121, 0, 8, 19, 4, 6, 0, 135, 97, 98, 105, 108, 105, 116, 121, 0, 5, 0,
+  68, 179, 191, 12, 220, 191, 0, 81, 189, 191, 21, 198, 191, 23, 211, 191, 0,
+  12, 0, 133, 105, 108, 105, 116, 121, 0, 8, 17, 15, 24, 25, 0, 133, 105, 108,
+  105, 116, 121, 0, 22, 0, 133, 105, 108, 105, 116, 121, 0, 22, 22, 18, 19, 0,
+  133, 105, 108, 105, 116, 121, 0, 12, 22, 21, 8, 25, 0, 133, 97, 116, 105, 108,
+  105, 116, 121, 0, 6, 12, 9, 9, 12, 7, 0, 130, 116, 121, 0, 12, 17, 18, 17, 4,
+  0, 132, 121, 109, 105, 116, 121, 0, 74, 28, 192, 12, 60, 192, 16, 88, 192, 24,
+  98, 192, 0, 12, 0, 72, 37, 192, 21, 47, 192, 0, 21, 8, 25, 18, 22, 0, 130,
+  116, 121, 0, 8, 25, 18, 22, 0, 133, 101, 105, 103, 110, 116, 121, 0, 68, 67,
+  192, 6, 76, 192, 0, 23, 21, 8, 6, 0, 130, 116, 121, 0, 17, 12, 25, 0, 134, 99,
+  105, 110, 105, 116, 121, 0, 8, 44, 0, 132, 110, 109, 105, 116, 121, 0, 23, 0,
+  82, 107, 192, 21, 122, 192, 0, 21, 19, 19, 18, 0, 135, 111, 114, 116, 117,
+  110, 105, 116, 121, 0, 18, 19, 18, 0, 135, 112, 111, 114, 116, 117, 110, 105,
+  116, 121, 0, 18, 0, 77, 146, 192, 23, 158, 192, 0, 21, 4, 16, 0, 134, 106,
+  111, 114, 105, 116, 121, 0, 24, 4, 0, 132, 104, 111, 114, 105, 116, 121, 0,
+  12, 23, 17, 8, 0, 130, 121, 0, 12, 0, 69, 186, 192, 15, 232, 192, 0, 68, 193,
+  192, 12, 198, 192, 0, 129, 105, 116, 121, 0, 22, 0, 81, 207, 192, 22, 224,
+  192, 0, 17, 18, 19, 22, 8, 21, 0, 135, 115, 105, 98, 105, 108, 105, 116, 121,
+  0, 18, 19, 0, 129, 105, 116, 121, 0, 5, 12, 22, 22, 18, 19, 0, 132, 105, 108,
+  105, 116, 121, 0, 12, 27, 18, 21, 19, 0, 129, 105, 116, 121, 0, 72, 11, 193,
+  10, 24, 193, 12, 39, 193, 0, 12, 6, 12, 9, 9, 8, 17, 12, 0, 128, 108, 121, 0,
+  12, 21, 8, 25, 18, 22, 0, 132, 101, 105, 103, 110, 116, 121, 0, 17, 0, 129,
+  101, 116, 121, 0, 85, 53, 193, 23, 63, 193, 0, 18, 13, 4, 16, 0, 130, 105,
+  116, 121, 0, 6, 8, 21, 12, 7, 0, 129, 114, 121, 0, 83, 80, 193, 24, 92, 193,
+  0, 8, 18, 21, 19, 0, 132, 112, 101, 114, 116, 121, 0, 18, 9, 0, 131, 114, 116,
+  121, 0, 23, 17, 8, 6, 0, 129, 114, 121, 0, 21, 23, 17, 8, 6, 0, 130, 117, 114,
+  121, 0, 18, 15, 22, 0, 128, 108, 121, 0, 23, 12, 17, 5, 12, 8, 15, 0, 129,
+  122, 0};
 
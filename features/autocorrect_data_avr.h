@@ -1,7 +1,10 @@
-/* Generated dictionary code (603 entries):
+/* Generated dictionary code (611 entries):
 :adn:          -> and
+:afaik:        => as far as I know
 :alot:         -> a lot
 :anually       -> annually
+:brb:          => be right back
+:btw:          => by the way
 :comming:      -> coming
 :eratic        -> erratic
 :errupted      -> erupted
@@ -12,6 +15,8 @@
 :halp:         -> help
 :hapen         -> happen
 :hting         -> thing
+:iirc:         => if I recall correctly
+:imo:          => in my opinion
 :layed         -> laid
 :leage         -> league
 :leran         -> learn
@@ -19,6 +24,7 @@
 :nkow          -> know
 :nkwo          -> know
 :nto:          -> not
+:omw:          => on my way
 :onyl:         -> only
 :peice         -> piece
 :quitted       -> quit
@@ -27,6 +33,7 @@
 :soem:         -> some
 :sohw:         -> show
 :tath:         -> that
+:tbh:          => to be honest
 :teh:          -> the
 :tghe:         -> the
 :the:the:      -> the
@@ -38,6 +45,7 @@
 :thta:         -> that
 :tiem:         -> time
 :tihs:         -> this
+:ttyl:         => talk to you later
 :ture          -> true
 :twon          -> town
 :twpo          -> two
@@ -607,501 +615,510 @@ youself        -> yourself
 #define DICTIONARY_MIN_LENGTH  4  // "bcak"
 #define DICTIONARY_MAX_LENGTH 14  // "pronounciation"
 
-static const uint8_t dictionary[9396] PROGMEM = {108, 67, 0, 4, 201, 2, 6, 6, 3,
-  7, 98, 3, 8, 185, 5, 9, 170, 14, 10, 234, 14, 11, 15, 17, 12, 190, 17, 14,
-  199, 17, 15, 246, 17, 16, 184, 19, 17, 10, 20, 18, 38, 23, 19, 76, 23, 21, 86,
-  23, 22, 248, 24, 23, 34, 27, 24, 230, 30, 25, 239, 30, 26, 248, 30, 28, 42,
-  31, 0, 68, 122, 0, 7, 169, 0, 8, 192, 0, 10, 42, 1, 11, 69, 1, 12, 104, 1, 14,
-  113, 1, 15, 137, 1, 16, 163, 1, 17, 201, 1, 18, 235, 1, 19, 10, 2, 21, 20, 2,
-  22, 60, 2, 23, 98, 2, 24, 173, 2, 26, 182, 2, 28, 192, 2, 0, 72, 135, 0, 10,
-  143, 0, 17, 153, 0, 23, 161, 0, 0, 25, 11, 0, 131, 97, 118, 101, 0, 16, 4, 21,
-  19, 0, 131, 103, 109, 97, 0, 11, 23, 44, 0, 130, 97, 110, 0, 11, 23, 44, 0,
-  130, 97, 116, 0, 72, 176, 0, 24, 184, 0, 0, 4, 7, 0, 131, 101, 97, 100, 0, 15,
-  6, 17, 12, 0, 128, 101, 0, 68, 211, 0, 11, 219, 0, 17, 241, 0, 21, 249, 0, 23,
-  16, 1, 25, 34, 1, 0, 16, 17, 0, 131, 97, 109, 101, 0, 74, 226, 0, 23, 233, 0,
-  0, 23, 44, 0, 131, 104, 101, 0, 44, 8, 11, 23, 44, 0, 132, 0, 11, 23, 44, 0,
-  130, 101, 110, 0, 71, 0, 1, 28, 8, 1, 0, 17, 24, 44, 0, 130, 101, 114, 0, 25,
-  44, 0, 131, 101, 114, 121, 0, 4, 12, 25, 8, 21, 5, 4, 0, 135, 98, 114, 101,
-  118, 105, 97, 116, 101, 0, 12, 17, 14, 0, 130, 102, 101, 0, 17, 0, 72, 51, 1,
-  12, 58, 1, 0, 5, 0, 130, 105, 110, 103, 0, 16, 16, 18, 6, 44, 0, 132, 105,
-  110, 103, 0, 72, 79, 1, 12, 86, 1, 23, 95, 1, 0, 23, 44, 0, 130, 104, 101, 0,
-  23, 26, 44, 0, 131, 105, 116, 104, 0, 4, 23, 44, 0, 131, 104, 97, 116, 0, 22,
-  11, 23, 44, 0, 130, 105, 115, 0, 72, 120, 1, 18, 128, 1, 0, 8, 17, 22, 0, 130,
-  97, 107, 0, 21, 26, 44, 0, 131, 111, 114, 107, 0, 79, 144, 1, 28, 155, 1, 0,
-  18, 6, 22, 44, 0, 131, 114, 111, 108, 108, 0, 17, 18, 44, 0, 130, 108, 121, 0,
-  72, 170, 1, 24, 191, 1, 0, 76, 177, 1, 18, 184, 1, 0, 23, 44, 0, 130, 109,
-  101, 0, 22, 44, 0, 130, 109, 101, 0, 6, 6, 4, 25, 0, 131, 117, 117, 109, 0,
-  71, 208, 1, 11, 215, 1, 0, 4, 44, 0, 130, 110, 100, 0, 68, 222, 1, 23, 229, 1,
-  0, 23, 0, 131, 104, 97, 110, 0, 44, 0, 129, 101, 110, 0, 87, 245, 1, 24, 252,
-  1, 26, 3, 2, 0, 17, 44, 0, 130, 111, 116, 0, 28, 44, 0, 130, 111, 117, 0, 17,
-  14, 0, 130, 111, 119, 0, 15, 4, 11, 44, 0, 131, 101, 108, 112, 0, 72, 27, 2,
-  28, 52, 2, 0, 75, 34, 2, 28, 44, 2, 0, 10, 24, 4, 7, 0, 130, 116, 101, 114, 0,
-  25, 44, 0, 131, 101, 114, 121, 0, 8, 25, 44, 0, 130, 114, 121, 0, 72, 67, 2,
-  11, 89, 2, 0, 86, 74, 2, 24, 83, 2, 0, 18, 18, 15, 0, 132, 115, 101, 115, 0,
-  44, 0, 130, 115, 101, 0, 12, 23, 44, 0, 131, 104, 105, 115, 0, 75, 114, 2, 12,
-  135, 2, 17, 142, 2, 18, 154, 2, 27, 164, 2, 0, 4, 0, 87, 123, 2, 26, 128, 2,
-  0, 131, 104, 97, 116, 0, 44, 0, 131, 104, 97, 116, 0, 12, 10, 44, 0, 130, 116,
-  0, 4, 7, 12, 6, 6, 4, 0, 131, 101, 110, 116, 0, 15, 4, 44, 0, 131, 32, 108,
-  111, 116, 0, 17, 8, 0, 132, 110, 101, 120, 116, 0, 18, 23, 28, 44, 0, 131,
-  111, 117, 0, 11, 18, 22, 44, 0, 131, 104, 111, 119, 0, 15, 4, 8, 21, 0, 129,
-  108, 121, 0, 72, 217, 2, 15, 226, 2, 21, 237, 2, 23, 245, 2, 28, 254, 2, 0,
-  21, 28, 44, 0, 130, 101, 97, 114, 0, 12, 21, 21, 8, 24, 10, 0, 128, 108, 97,
-  0, 8, 28, 44, 0, 129, 97, 114, 0, 24, 18, 5, 4, 0, 128, 32, 97, 0, 7, 18, 23,
-  0, 129, 97, 121, 0, 75, 13, 3, 12, 34, 3, 0, 68, 20, 3, 23, 26, 3, 0, 8, 0,
-  129, 99, 104, 0, 12, 26, 22, 0, 129, 99, 104, 0, 75, 41, 3, 23, 51, 3, 0, 28,
-  22, 19, 0, 130, 99, 104, 105, 99, 0, 68, 58, 3, 6, 84, 3, 0, 79, 65, 3, 21,
-  74, 3, 0, 4, 10, 0, 130, 99, 116, 105, 99, 0, 8, 44, 0, 131, 114, 97, 116,
-  105, 99, 0, 8, 15, 6, 6, 8, 0, 134, 108, 101, 99, 116, 105, 99, 0, 72, 117, 3,
-  15, 249, 4, 17, 35, 5, 18, 95, 5, 21, 136, 5, 24, 175, 5, 0, 71, 163, 3, 10,
-  175, 3, 11, 185, 3, 12, 214, 3, 14, 240, 3, 15, 251, 3, 17, 6, 4, 19, 53, 4,
-  21, 62, 4, 22, 87, 4, 23, 135, 4, 24, 199, 4, 25, 208, 4, 26, 221, 4, 28, 230,
-  4, 0, 7, 8, 6, 27, 8, 0, 131, 101, 100, 101, 100, 0, 17, 12, 22, 0, 131, 103,
-  110, 101, 100, 0, 70, 192, 3, 17, 204, 3, 0, 23, 4, 23, 8, 7, 0, 132, 99, 104,
-  101, 100, 0, 24, 4, 15, 0, 130, 99, 104, 101, 100, 0, 85, 221, 3, 25, 230, 3,
-  0, 21, 24, 5, 0, 131, 105, 101, 100, 0, 21, 8, 7, 0, 131, 105, 118, 101, 100,
-  0, 17, 12, 21, 11, 22, 0, 132, 117, 110, 107, 0, 15, 12, 4, 23, 8, 7, 0, 130,
-  101, 100, 0, 81, 13, 4, 18, 40, 4, 0, 72, 20, 4, 18, 29, 4, 0, 19, 19, 4, 11,
-  0, 130, 101, 100, 0, 22, 12, 21, 19, 16, 12, 0, 130, 101, 100, 0, 12, 21, 19,
-  16, 12, 0, 131, 115, 111, 110, 101, 100, 0, 12, 11, 22, 0, 129, 112, 101, 100,
-  0, 72, 69, 4, 24, 78, 4, 0, 9, 8, 21, 0, 129, 114, 101, 100, 0, 6, 6, 18, 0,
-  129, 114, 101, 100, 0, 68, 97, 4, 12, 104, 4, 22, 122, 4, 0, 19, 0, 129, 115,
-  101, 100, 0, 21, 18, 10, 4, 23, 4, 6, 0, 135, 101, 103, 111, 114, 105, 115,
-  101, 100, 0, 8, 22, 22, 5, 18, 0, 133, 101, 115, 115, 101, 100, 0, 68, 145, 4,
-  19, 179, 4, 23, 192, 4, 0, 80, 152, 4, 23, 166, 4, 0, 23, 12, 22, 8, 0, 134,
-  116, 105, 109, 97, 116, 101, 100, 0, 12, 21, 12, 0, 133, 114, 105, 116, 97,
-  116, 101, 100, 0, 24, 21, 21, 8, 44, 0, 133, 117, 112, 116, 101, 100, 0, 12,
-  24, 20, 44, 0, 130, 0, 15, 6, 17, 12, 0, 129, 100, 101, 0, 12, 21, 12, 7, 0,
-  133, 101, 114, 105, 118, 101, 100, 0, 26, 4, 17, 10, 0, 130, 101, 100, 0, 4,
-  0, 79, 239, 4, 19, 245, 4, 0, 44, 0, 130, 105, 100, 0, 130, 105, 100, 0, 76,
-  0, 5, 18, 23, 5, 0, 8, 0, 75, 9, 5, 28, 17, 5, 0, 22, 0, 131, 105, 101, 108,
+static const uint8_t dictionary[9574] PROGMEM = {108, 67, 0, 4, 123, 3, 6, 184,
+  3, 7, 20, 4, 8, 107, 6, 9, 92, 15, 10, 156, 15, 11, 193, 17, 12, 112, 18, 14,
+  121, 18, 15, 168, 18, 16, 106, 20, 17, 188, 20, 18, 216, 23, 19, 254, 23, 21,
+  8, 24, 22, 170, 25, 23, 212, 27, 24, 152, 31, 25, 161, 31, 26, 170, 31, 28,
+  220, 31, 0, 68, 128, 0, 5, 175, 0, 6, 193, 0, 7, 220, 0, 8, 243, 0, 10, 93, 1,
+  11, 120, 1, 12, 174, 1, 14, 183, 1, 15, 232, 1, 16, 29, 2, 17, 67, 2, 18, 101,
+  2, 19, 152, 2, 21, 162, 2, 22, 202, 2, 23, 240, 2, 24, 59, 3, 26, 68, 3, 28,
+  114, 3, 0, 72, 141, 0, 10, 149, 0, 17, 159, 0, 23, 167, 0, 0, 25, 11, 0, 131,
+  97, 118, 101, 0, 16, 4, 21, 19, 0, 131, 103, 109, 97, 0, 11, 23, 44, 0, 130,
+  97, 110, 0, 11, 23, 44, 0, 130, 97, 116, 0, 21, 5, 44, 0, 194, 101, 32, 114,
+  105, 103, 104, 116, 32, 98, 97, 99, 107, 0, 21, 12, 12, 44, 0, 195, 102, 32,
+  73, 32, 114, 101, 99, 97, 108, 108, 32, 99, 111, 114, 114, 101, 99, 116, 108,
+  121, 0, 72, 227, 0, 24, 235, 0, 0, 4, 7, 0, 131, 101, 97, 100, 0, 15, 6, 17,
+  12, 0, 128, 101, 0, 68, 6, 1, 11, 14, 1, 17, 36, 1, 21, 44, 1, 23, 67, 1, 25,
+  85, 1, 0, 16, 17, 0, 131, 97, 109, 101, 0, 74, 21, 1, 23, 28, 1, 0, 23, 44, 0,
+  131, 104, 101, 0, 44, 8, 11, 23, 44, 0, 132, 0, 11, 23, 44, 0, 130, 101, 110,
+  0, 71, 51, 1, 28, 59, 1, 0, 17, 24, 44, 0, 130, 101, 114, 0, 25, 44, 0, 131,
+  101, 114, 121, 0, 4, 12, 25, 8, 21, 5, 4, 0, 135, 98, 114, 101, 118, 105, 97,
+  116, 101, 0, 12, 17, 14, 0, 130, 102, 101, 0, 17, 0, 72, 102, 1, 12, 109, 1,
+  0, 5, 0, 130, 105, 110, 103, 0, 16, 16, 18, 6, 44, 0, 132, 105, 110, 103, 0,
+  69, 133, 1, 8, 149, 1, 12, 156, 1, 23, 165, 1, 0, 23, 44, 0, 194, 111, 32, 98,
+  101, 32, 104, 111, 110, 101, 115, 116, 0, 23, 44, 0, 130, 104, 101, 0, 23, 26,
+  44, 0, 131, 105, 116, 104, 0, 4, 23, 44, 0, 131, 104, 97, 116, 0, 22, 11, 23,
+  44, 0, 130, 105, 115, 0, 72, 193, 1, 12, 201, 1, 18, 223, 1, 0, 8, 17, 22, 0,
+  130, 97, 107, 0, 4, 9, 4, 44, 0, 196, 115, 32, 102, 97, 114, 32, 97, 115, 32,
+  73, 32, 107, 110, 111, 119, 0, 21, 26, 44, 0, 131, 111, 114, 107, 0, 79, 239,
+  1, 28, 250, 1, 0, 18, 6, 22, 44, 0, 131, 114, 111, 108, 108, 0, 81, 1, 2, 23,
+  8, 2, 0, 18, 44, 0, 130, 108, 121, 0, 23, 44, 0, 195, 97, 108, 107, 32, 116,
+  111, 32, 121, 111, 117, 32, 108, 97, 116, 101, 114, 0, 72, 36, 2, 24, 57, 2,
+  0, 76, 43, 2, 18, 50, 2, 0, 23, 44, 0, 130, 109, 101, 0, 22, 44, 0, 130, 109,
+  101, 0, 6, 6, 4, 25, 0, 131, 117, 117, 109, 0, 71, 74, 2, 11, 81, 2, 0, 4, 44,
+  0, 130, 110, 100, 0, 68, 88, 2, 23, 95, 2, 0, 23, 0, 131, 104, 97, 110, 0, 44,
+  0, 129, 101, 110, 0, 80, 114, 2, 23, 131, 2, 24, 138, 2, 26, 145, 2, 0, 12,
+  44, 0, 194, 110, 32, 109, 121, 32, 111, 112, 105, 110, 105, 111, 110, 0, 17,
+  44, 0, 130, 111, 116, 0, 28, 44, 0, 130, 111, 117, 0, 17, 14, 0, 130, 111,
+  119, 0, 15, 4, 11, 44, 0, 131, 101, 108, 112, 0, 72, 169, 2, 28, 194, 2, 0,
+  75, 176, 2, 28, 186, 2, 0, 10, 24, 4, 7, 0, 130, 116, 101, 114, 0, 25, 44, 0,
+  131, 101, 114, 121, 0, 8, 25, 44, 0, 130, 114, 121, 0, 72, 209, 2, 11, 231, 2,
+  0, 86, 216, 2, 24, 225, 2, 0, 18, 18, 15, 0, 132, 115, 101, 115, 0, 44, 0,
+  130, 115, 101, 0, 12, 23, 44, 0, 131, 104, 105, 115, 0, 75, 0, 3, 12, 21, 3,
+  17, 28, 3, 18, 40, 3, 27, 50, 3, 0, 4, 0, 87, 9, 3, 26, 14, 3, 0, 131, 104,
+  97, 116, 0, 44, 0, 131, 104, 97, 116, 0, 12, 10, 44, 0, 130, 116, 0, 4, 7, 12,
+  6, 6, 4, 0, 131, 101, 110, 116, 0, 15, 4, 44, 0, 131, 32, 108, 111, 116, 0,
+  17, 8, 0, 132, 110, 101, 120, 116, 0, 18, 23, 28, 44, 0, 131, 111, 117, 0, 75,
+  78, 3, 16, 87, 3, 23, 100, 3, 0, 18, 22, 44, 0, 131, 104, 111, 119, 0, 18, 44,
+  0, 194, 110, 32, 109, 121, 32, 119, 97, 121, 0, 5, 44, 0, 194, 121, 32, 116,
+  104, 101, 32, 119, 97, 121, 0, 15, 4, 8, 21, 0, 129, 108, 121, 0, 72, 139, 3,
+  15, 148, 3, 21, 159, 3, 23, 167, 3, 28, 176, 3, 0, 21, 28, 44, 0, 130, 101,
+  97, 114, 0, 12, 21, 21, 8, 24, 10, 0, 128, 108, 97, 0, 8, 28, 44, 0, 129, 97,
+  114, 0, 24, 18, 5, 4, 0, 128, 32, 97, 0, 7, 18, 23, 0, 129, 97, 121, 0, 75,
+  191, 3, 12, 212, 3, 0, 68, 198, 3, 23, 204, 3, 0, 8, 0, 129, 99, 104, 0, 12,
+  26, 22, 0, 129, 99, 104, 0, 75, 219, 3, 23, 229, 3, 0, 28, 22, 19, 0, 130, 99,
+  104, 105, 99, 0, 68, 236, 3, 6, 6, 4, 0, 79, 243, 3, 21, 252, 3, 0, 4, 10, 0,
+  130, 99, 116, 105, 99, 0, 8, 44, 0, 131, 114, 97, 116, 105, 99, 0, 8, 15, 6,
+  6, 8, 0, 134, 108, 101, 99, 116, 105, 99, 0, 72, 39, 4, 15, 171, 5, 17, 213,
+  5, 18, 17, 6, 21, 58, 6, 24, 97, 6, 0, 71, 85, 4, 10, 97, 4, 11, 107, 4, 12,
+  136, 4, 14, 162, 4, 15, 173, 4, 17, 184, 4, 19, 231, 4, 21, 240, 4, 22, 9, 5,
+  23, 57, 5, 24, 121, 5, 25, 130, 5, 26, 143, 5, 28, 152, 5, 0, 7, 8, 6, 27, 8,
+  0, 131, 101, 100, 101, 100, 0, 17, 12, 22, 0, 131, 103, 110, 101, 100, 0, 70,
+  114, 4, 17, 126, 4, 0, 23, 4, 23, 8, 7, 0, 132, 99, 104, 101, 100, 0, 24, 4,
+  15, 0, 130, 99, 104, 101, 100, 0, 85, 143, 4, 25, 152, 4, 0, 21, 24, 5, 0,
+  131, 105, 101, 100, 0, 21, 8, 7, 0, 131, 105, 118, 101, 100, 0, 17, 12, 21,
+  11, 22, 0, 132, 117, 110, 107, 0, 15, 12, 4, 23, 8, 7, 0, 130, 101, 100, 0,
+  81, 191, 4, 18, 218, 4, 0, 72, 198, 4, 18, 207, 4, 0, 19, 19, 4, 11, 0, 130,
+  101, 100, 0, 22, 12, 21, 19, 16, 12, 0, 130, 101, 100, 0, 12, 21, 19, 16, 12,
+  0, 131, 115, 111, 110, 101, 100, 0, 12, 11, 22, 0, 129, 112, 101, 100, 0, 72,
+  247, 4, 24, 0, 5, 0, 9, 8, 21, 0, 129, 114, 101, 100, 0, 6, 6, 18, 0, 129,
+  114, 101, 100, 0, 68, 19, 5, 12, 26, 5, 22, 44, 5, 0, 19, 0, 129, 115, 101,
+  100, 0, 21, 18, 10, 4, 23, 4, 6, 0, 135, 101, 103, 111, 114, 105, 115, 101,
+  100, 0, 8, 22, 22, 5, 18, 0, 133, 101, 115, 115, 101, 100, 0, 68, 67, 5, 19,
+  101, 5, 23, 114, 5, 0, 80, 74, 5, 23, 88, 5, 0, 23, 12, 22, 8, 0, 134, 116,
+  105, 109, 97, 116, 101, 100, 0, 12, 21, 12, 0, 133, 114, 105, 116, 97, 116,
+  101, 100, 0, 24, 21, 21, 8, 44, 0, 133, 117, 112, 116, 101, 100, 0, 12, 24,
+  20, 44, 0, 130, 0, 15, 6, 17, 12, 0, 129, 100, 101, 0, 12, 21, 12, 7, 0, 133,
+  101, 114, 105, 118, 101, 100, 0, 26, 4, 17, 10, 0, 130, 101, 100, 0, 4, 0, 79,
+  161, 5, 19, 167, 5, 0, 44, 0, 130, 105, 100, 0, 130, 105, 100, 0, 76, 178, 5,
+  18, 201, 5, 0, 8, 0, 75, 187, 5, 28, 195, 5, 0, 22, 0, 131, 105, 101, 108,
   100, 0, 131, 105, 101, 108, 100, 0, 22, 8, 21, 11, 23, 0, 130, 104, 111, 108,
-  100, 0, 72, 45, 5, 12, 70, 5, 24, 80, 5, 0, 83, 52, 5, 21, 60, 5, 0, 19, 4,
+  100, 0, 72, 223, 5, 12, 248, 5, 24, 2, 6, 0, 83, 230, 5, 21, 238, 5, 0, 19, 4,
   11, 0, 128, 101, 100, 0, 12, 9, 0, 132, 114, 105, 101, 110, 100, 0, 8, 21, 9,
   0, 131, 105, 101, 110, 100, 0, 21, 18, 10, 14, 6, 4, 5, 0, 132, 114, 111, 117,
-  110, 100, 0, 18, 11, 0, 85, 105, 5, 28, 123, 5, 0, 18, 5, 10, 12, 8, 17, 0,
-  134, 104, 98, 111, 117, 114, 104, 111, 111, 100, 0, 15, 8, 14, 12, 15, 0, 132,
-  105, 104, 111, 111, 100, 0, 68, 146, 5, 8, 157, 5, 24, 166, 5, 0, 26, 18, 9,
-  0, 131, 114, 119, 97, 114, 100, 0, 12, 26, 0, 131, 101, 105, 114, 100, 0, 4,
-  10, 0, 131, 117, 97, 114, 100, 0, 15, 18, 11, 22, 0, 130, 117, 108, 100, 0,
-  68, 243, 5, 5, 25, 6, 6, 58, 6, 7, 230, 7, 8, 39, 8, 10, 125, 8, 11, 66, 9,
-  14, 93, 9, 15, 103, 9, 16, 241, 10, 17, 24, 11, 18, 166, 11, 19, 188, 11, 21,
-  213, 11, 22, 42, 12, 23, 168, 12, 24, 189, 13, 25, 216, 13, 29, 123, 14, 0,
-  70, 253, 5, 14, 9, 6, 25, 16, 6, 0, 19, 22, 8, 16, 4, 17, 0, 130, 97, 99, 101,
-  0, 16, 0, 130, 97, 107, 101, 0, 4, 15, 0, 130, 114, 118, 97, 101, 0, 12, 21,
-  6, 0, 72, 36, 6, 22, 46, 6, 0, 7, 0, 132, 115, 99, 114, 105, 98, 101, 0, 12,
-  7, 0, 134, 101, 115, 99, 114, 105, 98, 101, 0, 72, 71, 6, 12, 85, 6, 17, 123,
-  6, 24, 213, 7, 0, 7, 17, 8, 19, 8, 7, 17, 12, 0, 129, 110, 99, 101, 0, 72, 92,
-  6, 25, 113, 6, 0, 81, 99, 6, 19, 105, 6, 0, 131, 105, 101, 99, 101, 0, 44, 0,
-  131, 105, 101, 99, 101, 0, 8, 22, 0, 131, 114, 118, 105, 99, 101, 0, 68, 130,
-  6, 8, 12, 7, 0, 71, 146, 6, 12, 158, 6, 17, 170, 6, 21, 205, 6, 23, 217, 6, 0,
-  17, 8, 19, 8, 7, 0, 131, 101, 110, 99, 101, 0, 21, 8, 19, 27, 8, 0, 131, 101,
-  110, 99, 101, 0, 76, 177, 6, 23, 192, 6, 0, 4, 23, 17, 12, 4, 16, 0, 134, 101,
-  110, 97, 110, 99, 101, 0, 17, 12, 4, 16, 0, 132, 101, 110, 97, 110, 99, 101,
-  0, 8, 25, 18, 10, 0, 131, 110, 97, 110, 99, 101, 0, 81, 224, 6, 22, 2, 7, 0,
-  12, 4, 0, 80, 234, 6, 24, 242, 6, 0, 131, 101, 110, 97, 110, 99, 101, 0, 20,
-  4, 0, 137, 99, 113, 117, 97, 105, 110, 116, 97, 110, 99, 101, 0, 12, 27, 8, 0,
-  131, 101, 110, 99, 101, 0, 70, 34, 7, 7, 47, 7, 10, 98, 7, 17, 114, 7, 21,
-  148, 7, 22, 159, 7, 23, 182, 7, 0, 18, 17, 12, 0, 133, 110, 111, 99, 101, 110,
-  99, 101, 0, 72, 57, 7, 12, 71, 7, 17, 80, 7, 0, 19, 8, 7, 17, 12, 0, 132, 110,
-  100, 101, 110, 99, 101, 0, 24, 10, 0, 131, 97, 110, 99, 101, 0, 8, 19, 12, 7,
-  17, 12, 0, 136, 101, 112, 101, 110, 100, 101, 110, 99, 101, 0, 12, 15, 8, 23,
-  17, 12, 0, 133, 108, 105, 103, 101, 110, 99, 101, 0, 72, 121, 7, 12, 133, 7,
-  0, 23, 17, 12, 4, 16, 0, 131, 97, 110, 99, 101, 0, 4, 23, 17, 12, 4, 16, 0,
-  134, 101, 110, 97, 110, 99, 101, 0, 18, 17, 10, 12, 0, 131, 97, 110, 99, 101,
-  0, 76, 166, 7, 17, 175, 7, 0, 15, 0, 132, 99, 101, 110, 115, 101, 0, 18, 17,
-  0, 129, 115, 101, 0, 81, 189, 7, 19, 202, 7, 0, 12, 4, 24, 20, 6, 4, 0, 131,
-  97, 110, 99, 101, 0, 8, 6, 6, 4, 0, 131, 97, 110, 99, 101, 0, 7, 18, 21, 23,
-  6, 17, 12, 0, 135, 116, 114, 111, 100, 117, 99, 101, 0, 68, 240, 7, 12, 255,
-  7, 18, 10, 8, 0, 24, 22, 21, 24, 19, 0, 134, 101, 114, 115, 117, 97, 100, 101,
-  0, 21, 8, 25, 18, 0, 130, 114, 105, 100, 101, 0, 76, 17, 8, 22, 28, 8, 0, 22,
-  19, 8, 0, 132, 105, 115, 111, 100, 101, 0, 7, 12, 19, 8, 0, 132, 115, 111,
-  100, 101, 0, 72, 46, 8, 23, 52, 8, 0, 21, 11, 23, 0, 128, 0, 17, 0, 68, 61, 8,
-  8, 110, 8, 0, 21, 0, 68, 70, 8, 24, 82, 8, 0, 10, 0, 134, 117, 97, 114, 97,
-  110, 116, 101, 101, 0, 68, 89, 8, 10, 101, 8, 0, 10, 0, 135, 117, 97, 114, 97,
-  110, 116, 101, 101, 0, 133, 97, 114, 97, 110, 116, 101, 101, 0, 21, 24, 4, 10,
-  0, 135, 117, 97, 114, 97, 110, 116, 101, 101, 0, 68, 141, 8, 7, 234, 8, 8, 14,
-  9, 12, 44, 9, 17, 53, 9, 0, 72, 157, 8, 10, 177, 8, 12, 188, 8, 23, 199, 8,
-  24, 209, 8, 0, 79, 164, 8, 22, 170, 8, 0, 44, 0, 128, 117, 101, 0, 24, 0, 131,
-  97, 103, 101, 0, 21, 18, 16, 0, 131, 116, 103, 97, 103, 101, 0, 21, 4, 16, 0,
-  131, 114, 105, 97, 103, 101, 0, 21, 18, 16, 0, 130, 103, 97, 103, 101, 0, 10,
-  0, 108, 218, 8, 4, 224, 8, 0, 131, 97, 117, 103, 101, 0, 15, 0, 132, 110, 103,
-  117, 97, 103, 101, 0, 8, 15, 0, 76, 244, 8, 26, 253, 8, 0, 25, 12, 21, 19, 0,
-  130, 103, 101, 0, 18, 17, 14, 4, 0, 136, 99, 107, 110, 111, 119, 108, 101,
-  100, 103, 101, 0, 15, 0, 72, 23, 9, 26, 35, 9, 0, 25, 12, 21, 19, 0, 132, 105,
+  110, 100, 0, 18, 11, 0, 85, 27, 6, 28, 45, 6, 0, 18, 5, 10, 12, 8, 17, 0, 134,
+  104, 98, 111, 117, 114, 104, 111, 111, 100, 0, 15, 8, 14, 12, 15, 0, 132, 105,
+  104, 111, 111, 100, 0, 68, 68, 6, 8, 79, 6, 24, 88, 6, 0, 26, 18, 9, 0, 131,
+  114, 119, 97, 114, 100, 0, 12, 26, 0, 131, 101, 105, 114, 100, 0, 4, 10, 0,
+  131, 117, 97, 114, 100, 0, 15, 18, 11, 22, 0, 130, 117, 108, 100, 0, 68, 165,
+  6, 5, 203, 6, 6, 236, 6, 7, 152, 8, 8, 217, 8, 10, 47, 9, 11, 244, 9, 14, 15,
+  10, 15, 25, 10, 16, 163, 11, 17, 202, 11, 18, 88, 12, 19, 110, 12, 21, 135,
+  12, 22, 220, 12, 23, 90, 13, 24, 111, 14, 25, 138, 14, 29, 45, 15, 0, 70, 175,
+  6, 14, 187, 6, 25, 194, 6, 0, 19, 22, 8, 16, 4, 17, 0, 130, 97, 99, 101, 0,
+  16, 0, 130, 97, 107, 101, 0, 4, 15, 0, 130, 114, 118, 97, 101, 0, 12, 21, 6,
+  0, 72, 214, 6, 22, 224, 6, 0, 7, 0, 132, 115, 99, 114, 105, 98, 101, 0, 12, 7,
+  0, 134, 101, 115, 99, 114, 105, 98, 101, 0, 72, 249, 6, 12, 7, 7, 17, 45, 7,
+  24, 135, 8, 0, 7, 17, 8, 19, 8, 7, 17, 12, 0, 129, 110, 99, 101, 0, 72, 14, 7,
+  25, 35, 7, 0, 81, 21, 7, 19, 27, 7, 0, 131, 105, 101, 99, 101, 0, 44, 0, 131,
+  105, 101, 99, 101, 0, 8, 22, 0, 131, 114, 118, 105, 99, 101, 0, 68, 52, 7, 8,
+  190, 7, 0, 71, 68, 7, 12, 80, 7, 17, 92, 7, 21, 127, 7, 23, 139, 7, 0, 17, 8,
+  19, 8, 7, 0, 131, 101, 110, 99, 101, 0, 21, 8, 19, 27, 8, 0, 131, 101, 110,
+  99, 101, 0, 76, 99, 7, 23, 114, 7, 0, 4, 23, 17, 12, 4, 16, 0, 134, 101, 110,
+  97, 110, 99, 101, 0, 17, 12, 4, 16, 0, 132, 101, 110, 97, 110, 99, 101, 0, 8,
+  25, 18, 10, 0, 131, 110, 97, 110, 99, 101, 0, 81, 146, 7, 22, 180, 7, 0, 12,
+  4, 0, 80, 156, 7, 24, 164, 7, 0, 131, 101, 110, 97, 110, 99, 101, 0, 20, 4, 0,
+  137, 99, 113, 117, 97, 105, 110, 116, 97, 110, 99, 101, 0, 12, 27, 8, 0, 131,
+  101, 110, 99, 101, 0, 70, 212, 7, 7, 225, 7, 10, 20, 8, 17, 36, 8, 21, 70, 8,
+  22, 81, 8, 23, 104, 8, 0, 18, 17, 12, 0, 133, 110, 111, 99, 101, 110, 99, 101,
+  0, 72, 235, 7, 12, 249, 7, 17, 2, 8, 0, 19, 8, 7, 17, 12, 0, 132, 110, 100,
+  101, 110, 99, 101, 0, 24, 10, 0, 131, 97, 110, 99, 101, 0, 8, 19, 12, 7, 17,
+  12, 0, 136, 101, 112, 101, 110, 100, 101, 110, 99, 101, 0, 12, 15, 8, 23, 17,
+  12, 0, 133, 108, 105, 103, 101, 110, 99, 101, 0, 72, 43, 8, 12, 55, 8, 0, 23,
+  17, 12, 4, 16, 0, 131, 97, 110, 99, 101, 0, 4, 23, 17, 12, 4, 16, 0, 134, 101,
+  110, 97, 110, 99, 101, 0, 18, 17, 10, 12, 0, 131, 97, 110, 99, 101, 0, 76, 88,
+  8, 17, 97, 8, 0, 15, 0, 132, 99, 101, 110, 115, 101, 0, 18, 17, 0, 129, 115,
+  101, 0, 81, 111, 8, 19, 124, 8, 0, 12, 4, 24, 20, 6, 4, 0, 131, 97, 110, 99,
+  101, 0, 8, 6, 6, 4, 0, 131, 97, 110, 99, 101, 0, 7, 18, 21, 23, 6, 17, 12, 0,
+  135, 116, 114, 111, 100, 117, 99, 101, 0, 68, 162, 8, 12, 177, 8, 18, 188, 8,
+  0, 24, 22, 21, 24, 19, 0, 134, 101, 114, 115, 117, 97, 100, 101, 0, 21, 8, 25,
+  18, 0, 130, 114, 105, 100, 101, 0, 76, 195, 8, 22, 206, 8, 0, 22, 19, 8, 0,
+  132, 105, 115, 111, 100, 101, 0, 7, 12, 19, 8, 0, 132, 115, 111, 100, 101, 0,
+  72, 224, 8, 23, 230, 8, 0, 21, 11, 23, 0, 128, 0, 17, 0, 68, 239, 8, 8, 32, 9,
+  0, 21, 0, 68, 248, 8, 24, 4, 9, 0, 10, 0, 134, 117, 97, 114, 97, 110, 116,
+  101, 101, 0, 68, 11, 9, 10, 23, 9, 0, 10, 0, 135, 117, 97, 114, 97, 110, 116,
+  101, 101, 0, 133, 97, 114, 97, 110, 116, 101, 101, 0, 21, 24, 4, 10, 0, 135,
+  117, 97, 114, 97, 110, 116, 101, 101, 0, 68, 63, 9, 7, 156, 9, 8, 192, 9, 12,
+  222, 9, 17, 231, 9, 0, 72, 79, 9, 10, 99, 9, 12, 110, 9, 23, 121, 9, 24, 131,
+  9, 0, 79, 86, 9, 22, 92, 9, 0, 44, 0, 128, 117, 101, 0, 24, 0, 131, 97, 103,
+  101, 0, 21, 18, 16, 0, 131, 116, 103, 97, 103, 101, 0, 21, 4, 16, 0, 131, 114,
+  105, 97, 103, 101, 0, 21, 18, 16, 0, 130, 103, 97, 103, 101, 0, 10, 0, 108,
+  140, 9, 4, 146, 9, 0, 131, 97, 117, 103, 101, 0, 15, 0, 132, 110, 103, 117,
+  97, 103, 101, 0, 8, 15, 0, 76, 166, 9, 26, 175, 9, 0, 25, 12, 21, 19, 0, 130,
+  103, 101, 0, 18, 17, 14, 4, 0, 136, 99, 107, 110, 111, 119, 108, 101, 100,
+  103, 101, 0, 15, 0, 72, 201, 9, 26, 213, 9, 0, 25, 12, 21, 19, 0, 132, 105,
   108, 101, 103, 101, 0, 18, 17, 14, 0, 129, 100, 103, 101, 0, 8, 22, 0, 131,
   105, 101, 103, 101, 0, 4, 15, 15, 4, 11, 6, 0, 131, 101, 110, 103, 101, 0, 87,
-  73, 9, 28, 85, 9, 0, 23, 24, 18, 5, 4, 0, 130, 32, 116, 104, 101, 0, 23, 44,
-  0, 130, 104, 101, 121, 0, 21, 18, 5, 0, 131, 114, 111, 107, 101, 0, 69, 119,
-  9, 12, 150, 10, 19, 160, 10, 22, 202, 10, 25, 234, 10, 0, 68, 126, 9, 12, 32,
-  10, 0, 70, 151, 9, 7, 163, 9, 8, 175, 9, 10, 187, 9, 16, 216, 9, 17, 227, 9,
-  22, 243, 9, 23, 255, 9, 0, 12, 23, 18, 17, 0, 131, 101, 97, 98, 108, 101, 0,
-  8, 21, 6, 17, 12, 0, 131, 105, 98, 108, 101, 0, 23, 4, 5, 8, 7, 0, 132, 97,
-  98, 108, 101, 0, 76, 194, 9, 17, 205, 9, 0, 15, 10, 8, 17, 0, 131, 105, 98,
-  108, 101, 0, 4, 11, 6, 0, 131, 101, 97, 98, 108, 101, 0, 4, 15, 9, 0, 131,
-  109, 97, 98, 108, 101, 0, 18, 23, 22, 8, 24, 20, 0, 133, 105, 111, 110, 97,
-  98, 108, 101, 0, 22, 8, 6, 6, 4, 0, 131, 105, 98, 108, 101, 0, 76, 6, 10, 19,
-  18, 10, 0, 21, 12, 0, 133, 114, 105, 116, 97, 98, 108, 101, 0, 16, 18, 6, 17,
-  12, 0, 132, 97, 116, 105, 98, 108, 101, 0, 70, 48, 10, 7, 60, 10, 15, 74, 10,
-  22, 85, 10, 23, 100, 10, 0, 12, 23, 18, 17, 0, 131, 101, 97, 98, 108, 101, 0,
-  4, 8, 21, 6, 17, 12, 0, 133, 100, 105, 98, 108, 101, 0, 10, 8, 17, 0, 130,
-  103, 105, 98, 108, 101, 0, 17, 8, 19, 22, 12, 7, 17, 12, 0, 131, 97, 98, 108,
-  101, 0, 76, 110, 10, 19, 121, 10, 22, 132, 10, 0, 25, 8, 17, 12, 0, 131, 97,
-  98, 108, 101, 0, 8, 6, 6, 4, 0, 131, 97, 98, 108, 101, 0, 12, 22, 8, 21, 12,
-  0, 136, 114, 101, 115, 105, 115, 116, 105, 98, 108, 101, 0, 22, 12, 16, 0,
-  130, 115, 105, 108, 101, 0, 68, 170, 10, 8, 181, 10, 16, 191, 10, 0, 16, 27,
-  8, 0, 132, 97, 109, 112, 108, 101, 0, 18, 19, 0, 132, 101, 111, 112, 108, 101,
-  0, 8, 27, 8, 0, 132, 97, 109, 112, 108, 101, 0, 68, 212, 10, 8, 219, 10, 22,
-  226, 10, 0, 9, 0, 130, 108, 115, 101, 0, 44, 0, 130, 108, 115, 101, 0, 12, 16,
-  0, 129, 105, 108, 101, 0, 8, 15, 0, 129, 101, 108, 0, 76, 251, 10, 18, 9, 11,
-  24, 14, 11, 0, 23, 28, 21, 8, 25, 8, 0, 131, 32, 116, 105, 109, 101, 0, 21, 9,
-  0, 128, 0, 6, 6, 4, 25, 0, 131, 117, 117, 109, 0, 70, 40, 11, 8, 48, 11, 12,
-  58, 11, 16, 149, 11, 18, 157, 11, 0, 12, 22, 0, 130, 110, 99, 101, 0, 10, 28,
-  11, 0, 130, 105, 101, 110, 101, 0, 68, 71, 11, 8, 84, 11, 10, 126, 11, 23,
-  134, 11, 0, 23, 17, 4, 21, 4, 24, 20, 0, 131, 105, 110, 101, 0, 10, 0, 76, 93,
-  11, 28, 103, 11, 0, 11, 0, 133, 121, 103, 105, 101, 110, 101, 0, 75, 110, 11,
-  12, 116, 11, 0, 131, 105, 101, 110, 101, 0, 11, 0, 134, 121, 103, 105, 101,
-  110, 101, 0, 28, 11, 0, 129, 101, 110, 101, 0, 17, 8, 21, 4, 24, 20, 0, 133,
-  97, 110, 116, 105, 110, 101, 0, 24, 15, 18, 25, 0, 129, 101, 0, 18, 17, 0,
-  130, 32, 111, 110, 101, 0, 85, 173, 11, 22, 180, 11, 0, 16, 0, 130, 111, 114,
-  101, 0, 11, 23, 0, 130, 111, 115, 101, 0, 82, 195, 11, 22, 203, 11, 0, 15, 8,
-  25, 8, 7, 0, 128, 0, 12, 15, 6, 8, 0, 130, 112, 115, 101, 0, 68, 223, 11, 12,
-  234, 11, 24, 6, 12, 0, 29, 29, 12, 5, 0, 131, 97, 114, 114, 101, 0, 24, 20, 0,
-  68, 244, 11, 7, 252, 11, 0, 132, 99, 113, 117, 105, 114, 101, 0, 4, 0, 133,
-  99, 113, 117, 105, 114, 101, 0, 75, 16, 12, 23, 23, 12, 29, 30, 12, 0, 22, 0,
-  131, 117, 114, 101, 0, 44, 0, 130, 114, 117, 101, 0, 8, 12, 22, 0, 133, 101,
-  105, 122, 117, 114, 101, 0, 68, 55, 12, 12, 80, 12, 17, 93, 12, 24, 156, 12,
-  0, 79, 62, 12, 24, 70, 12, 0, 9, 0, 131, 97, 108, 115, 101, 0, 6, 8, 5, 0,
-  131, 97, 117, 115, 101, 0, 21, 19, 24, 22, 0, 132, 114, 112, 114, 105, 115,
-  101, 0, 8, 0, 70, 105, 12, 16, 116, 12, 22, 125, 12, 0, 22, 12, 15, 0, 133,
-  99, 101, 110, 115, 101, 0, 12, 0, 131, 109, 101, 110, 115, 101, 0, 69, 135,
-  12, 12, 141, 12, 22, 150, 12, 0, 4, 0, 129, 99, 101, 0, 15, 0, 132, 99, 101,
-  110, 115, 101, 0, 8, 0, 129, 99, 101, 0, 6, 4, 8, 5, 0, 132, 99, 97, 117, 115,
-  101, 0, 68, 181, 12, 8, 124, 13, 12, 143, 13, 24, 156, 13, 0, 70, 209, 12, 7,
-  222, 12, 12, 3, 13, 15, 16, 13, 16, 32, 13, 17, 64, 13, 19, 74, 13, 21, 84,
-  13, 24, 109, 13, 0, 12, 19, 24, 7, 0, 132, 108, 105, 99, 97, 116, 101, 0, 18,
-  16, 0, 80, 232, 12, 18, 247, 12, 0, 18, 6, 4, 0, 135, 99, 111, 109, 109, 111,
-  100, 97, 116, 101, 0, 6, 6, 4, 0, 132, 109, 111, 100, 97, 116, 101, 0, 22, 22,
-  8, 6, 8, 17, 0, 130, 116, 97, 116, 101, 0, 24, 6, 18, 17, 17, 12, 0, 135, 111,
-  99, 117, 108, 97, 116, 101, 0, 68, 39, 13, 23, 52, 13, 0, 23, 12, 10, 8, 15,
+  251, 9, 28, 7, 10, 0, 23, 24, 18, 5, 4, 0, 130, 32, 116, 104, 101, 0, 23, 44,
+  0, 130, 104, 101, 121, 0, 21, 18, 5, 0, 131, 114, 111, 107, 101, 0, 69, 41,
+  10, 12, 72, 11, 19, 82, 11, 22, 124, 11, 25, 156, 11, 0, 68, 48, 10, 12, 210,
+  10, 0, 70, 73, 10, 7, 85, 10, 8, 97, 10, 10, 109, 10, 16, 138, 10, 17, 149,
+  10, 22, 165, 10, 23, 177, 10, 0, 12, 23, 18, 17, 0, 131, 101, 97, 98, 108,
+  101, 0, 8, 21, 6, 17, 12, 0, 131, 105, 98, 108, 101, 0, 23, 4, 5, 8, 7, 0,
+  132, 97, 98, 108, 101, 0, 76, 116, 10, 17, 127, 10, 0, 15, 10, 8, 17, 0, 131,
+  105, 98, 108, 101, 0, 4, 11, 6, 0, 131, 101, 97, 98, 108, 101, 0, 4, 15, 9, 0,
+  131, 109, 97, 98, 108, 101, 0, 18, 23, 22, 8, 24, 20, 0, 133, 105, 111, 110,
+  97, 98, 108, 101, 0, 22, 8, 6, 6, 4, 0, 131, 105, 98, 108, 101, 0, 76, 184,
+  10, 19, 196, 10, 0, 21, 12, 0, 133, 114, 105, 116, 97, 98, 108, 101, 0, 16,
+  18, 6, 17, 12, 0, 132, 97, 116, 105, 98, 108, 101, 0, 70, 226, 10, 7, 238, 10,
+  15, 252, 10, 22, 7, 11, 23, 22, 11, 0, 12, 23, 18, 17, 0, 131, 101, 97, 98,
+  108, 101, 0, 4, 8, 21, 6, 17, 12, 0, 133, 100, 105, 98, 108, 101, 0, 10, 8,
+  17, 0, 130, 103, 105, 98, 108, 101, 0, 17, 8, 19, 22, 12, 7, 17, 12, 0, 131,
+  97, 98, 108, 101, 0, 76, 32, 11, 19, 43, 11, 22, 54, 11, 0, 25, 8, 17, 12, 0,
+  131, 97, 98, 108, 101, 0, 8, 6, 6, 4, 0, 131, 97, 98, 108, 101, 0, 12, 22, 8,
+  21, 12, 0, 136, 114, 101, 115, 105, 115, 116, 105, 98, 108, 101, 0, 22, 12,
+  16, 0, 130, 115, 105, 108, 101, 0, 68, 92, 11, 8, 103, 11, 16, 113, 11, 0, 16,
+  27, 8, 0, 132, 97, 109, 112, 108, 101, 0, 18, 19, 0, 132, 101, 111, 112, 108,
+  101, 0, 8, 27, 8, 0, 132, 97, 109, 112, 108, 101, 0, 68, 134, 11, 8, 141, 11,
+  22, 148, 11, 0, 9, 0, 130, 108, 115, 101, 0, 44, 0, 130, 108, 115, 101, 0, 12,
+  16, 0, 129, 105, 108, 101, 0, 8, 15, 0, 129, 101, 108, 0, 76, 173, 11, 18,
+  187, 11, 24, 192, 11, 0, 23, 28, 21, 8, 25, 8, 0, 131, 32, 116, 105, 109, 101,
+  0, 21, 9, 0, 128, 0, 6, 6, 4, 25, 0, 131, 117, 117, 109, 0, 70, 218, 11, 8,
+  226, 11, 12, 236, 11, 16, 71, 12, 18, 79, 12, 0, 12, 22, 0, 130, 110, 99, 101,
+  0, 10, 28, 11, 0, 130, 105, 101, 110, 101, 0, 68, 249, 11, 8, 6, 12, 10, 48,
+  12, 23, 56, 12, 0, 23, 17, 4, 21, 4, 24, 20, 0, 131, 105, 110, 101, 0, 10, 0,
+  76, 15, 12, 28, 25, 12, 0, 11, 0, 133, 121, 103, 105, 101, 110, 101, 0, 75,
+  32, 12, 12, 38, 12, 0, 131, 105, 101, 110, 101, 0, 11, 0, 134, 121, 103, 105,
+  101, 110, 101, 0, 28, 11, 0, 129, 101, 110, 101, 0, 17, 8, 21, 4, 24, 20, 0,
+  133, 97, 110, 116, 105, 110, 101, 0, 24, 15, 18, 25, 0, 129, 101, 0, 18, 17,
+  0, 130, 32, 111, 110, 101, 0, 85, 95, 12, 22, 102, 12, 0, 16, 0, 130, 111,
+  114, 101, 0, 11, 23, 0, 130, 111, 115, 101, 0, 82, 117, 12, 22, 125, 12, 0,
+  15, 8, 25, 8, 7, 0, 128, 0, 12, 15, 6, 8, 0, 130, 112, 115, 101, 0, 68, 145,
+  12, 12, 156, 12, 24, 184, 12, 0, 29, 29, 12, 5, 0, 131, 97, 114, 114, 101, 0,
+  24, 20, 0, 68, 166, 12, 7, 174, 12, 0, 132, 99, 113, 117, 105, 114, 101, 0, 4,
+  0, 133, 99, 113, 117, 105, 114, 101, 0, 75, 194, 12, 23, 201, 12, 29, 208, 12,
+  0, 22, 0, 131, 117, 114, 101, 0, 44, 0, 130, 114, 117, 101, 0, 8, 12, 22, 0,
+  133, 101, 105, 122, 117, 114, 101, 0, 68, 233, 12, 12, 2, 13, 17, 15, 13, 24,
+  78, 13, 0, 79, 240, 12, 24, 248, 12, 0, 9, 0, 131, 97, 108, 115, 101, 0, 6, 8,
+  5, 0, 131, 97, 117, 115, 101, 0, 21, 19, 24, 22, 0, 132, 114, 112, 114, 105,
+  115, 101, 0, 8, 0, 70, 27, 13, 16, 38, 13, 22, 47, 13, 0, 22, 12, 15, 0, 133,
+  99, 101, 110, 115, 101, 0, 12, 0, 131, 109, 101, 110, 115, 101, 0, 69, 57, 13,
+  12, 63, 13, 22, 72, 13, 0, 4, 0, 129, 99, 101, 0, 15, 0, 132, 99, 101, 110,
+  115, 101, 0, 8, 0, 129, 99, 101, 0, 6, 4, 8, 5, 0, 132, 99, 97, 117, 115, 101,
+  0, 68, 103, 13, 8, 46, 14, 12, 65, 14, 24, 78, 14, 0, 70, 131, 13, 7, 144, 13,
+  12, 181, 13, 15, 194, 13, 16, 210, 13, 17, 242, 13, 19, 252, 13, 21, 6, 14,
+  24, 31, 14, 0, 12, 19, 24, 7, 0, 132, 108, 105, 99, 97, 116, 101, 0, 18, 16,
+  0, 80, 154, 13, 18, 169, 13, 0, 18, 6, 4, 0, 135, 99, 111, 109, 109, 111, 100,
+  97, 116, 101, 0, 6, 6, 4, 0, 132, 109, 111, 100, 97, 116, 101, 0, 22, 22, 8,
+  6, 8, 17, 0, 130, 116, 97, 116, 101, 0, 24, 6, 18, 17, 17, 12, 0, 135, 111,
+  99, 117, 108, 97, 116, 101, 0, 68, 217, 13, 23, 230, 13, 0, 23, 12, 10, 8, 15,
   0, 132, 105, 109, 97, 116, 101, 0, 12, 10, 8, 15, 0, 131, 105, 109, 97, 116,
   101, 0, 12, 9, 8, 7, 0, 130, 105, 116, 101, 0, 7, 24, 0, 132, 112, 100, 97,
-  116, 101, 0, 72, 91, 13, 10, 102, 13, 0, 19, 8, 22, 0, 132, 97, 114, 97, 116,
+  116, 101, 0, 72, 13, 14, 10, 24, 14, 0, 19, 8, 22, 0, 132, 97, 114, 97, 116,
   101, 0, 8, 7, 0, 129, 100, 101, 0, 20, 12, 7, 4, 17, 12, 0, 133, 101, 113,
   117, 97, 116, 101, 0, 15, 19, 16, 18, 6, 16, 12, 0, 136, 110, 99, 111, 109,
   112, 108, 101, 116, 101, 0, 19, 22, 12, 7, 0, 133, 101, 115, 112, 105, 116,
-  101, 0, 69, 163, 13, 6, 177, 13, 0, 12, 23, 17, 18, 6, 0, 132, 114, 105, 98,
-  117, 116, 101, 0, 8, 6, 27, 8, 0, 133, 101, 99, 117, 116, 101, 0, 74, 196, 13,
-  22, 208, 13, 0, 8, 15, 15, 18, 6, 0, 130, 97, 103, 117, 101, 0, 4, 6, 0, 130,
-  117, 115, 101, 0, 72, 223, 13, 12, 17, 14, 0, 12, 0, 68, 232, 13, 6, 238, 13,
-  0, 17, 0, 130, 118, 101, 0, 72, 245, 13, 21, 8, 14, 0, 71, 252, 13, 21, 2, 14,
-  0, 131, 101, 105, 118, 101, 0, 131, 101, 105, 118, 101, 0, 8, 19, 0, 131, 101,
-  105, 118, 101, 0, 72, 27, 14, 15, 52, 14, 23, 60, 14, 0, 75, 34, 14, 15, 43,
-  14, 0, 6, 4, 0, 131, 105, 101, 118, 101, 0, 8, 5, 0, 131, 105, 101, 118, 101,
-  0, 8, 5, 0, 129, 101, 118, 101, 0, 76, 70, 14, 22, 101, 14, 24, 112, 14, 0,
-  68, 77, 14, 25, 89, 14, 0, 12, 23, 12, 17, 12, 0, 132, 116, 105, 118, 101, 0,
-  12, 21, 8, 7, 0, 132, 97, 116, 105, 118, 101, 0, 17, 8, 22, 0, 131, 105, 116,
-  105, 118, 101, 0, 23, 17, 12, 0, 131, 105, 116, 105, 118, 101, 0, 72, 130, 14,
-  12, 140, 14, 0, 12, 22, 44, 0, 131, 101, 105, 122, 101, 0, 21, 0, 72, 149, 14,
-  19, 162, 14, 0, 10, 4, 15, 19, 0, 132, 105, 97, 114, 105, 122, 101, 0, 21, 24,
-  22, 0, 129, 115, 101, 0, 72, 180, 14, 12, 188, 14, 15, 221, 14, 0, 22, 28, 16,
-  0, 128, 108, 102, 0, 8, 0, 75, 197, 14, 21, 214, 14, 0, 70, 204, 14, 23, 209,
-  14, 0, 130, 105, 101, 102, 0, 130, 105, 101, 102, 0, 10, 0, 130, 105, 101,
-  102, 0, 8, 22, 24, 18, 28, 0, 131, 114, 115, 101, 108, 102, 0, 76, 241, 14,
-  17, 22, 15, 0, 71, 248, 14, 17, 255, 14, 0, 17, 8, 0, 128, 110, 103, 0, 75, 6,
-  15, 17, 13, 15, 0, 23, 0, 130, 105, 110, 103, 0, 12, 10, 8, 5, 0, 128, 110,
-  103, 0, 71, 38, 15, 12, 49, 15, 17, 242, 16, 21, 251, 16, 28, 5, 17, 0, 24,
-  15, 6, 17, 12, 0, 129, 105, 110, 103, 0, 68, 95, 15, 5, 111, 15, 7, 148, 15,
-  8, 180, 15, 10, 237, 15, 11, 15, 16, 15, 29, 16, 16, 41, 16, 17, 74, 16, 19,
-  117, 16, 21, 127, 16, 23, 141, 16, 24, 204, 16, 25, 215, 16, 26, 229, 16, 0,
-  17, 12, 23, 17, 12, 4, 16, 0, 133, 97, 105, 110, 105, 110, 103, 0, 12, 21, 6,
-  0, 72, 122, 15, 22, 134, 15, 0, 7, 0, 134, 115, 99, 114, 105, 98, 105, 110,
-  103, 0, 12, 7, 0, 136, 101, 115, 99, 114, 105, 98, 105, 110, 103, 0, 24, 6, 0,
-  79, 158, 15, 17, 170, 15, 0, 17, 12, 0, 134, 99, 108, 117, 100, 105, 110, 103,
-  0, 12, 0, 132, 108, 117, 100, 105, 110, 103, 0, 70, 196, 15, 8, 206, 15, 16,
-  213, 15, 21, 223, 15, 22, 231, 15, 0, 12, 23, 18, 17, 0, 131, 105, 110, 103,
-  0, 5, 0, 131, 105, 110, 103, 0, 18, 6, 8, 5, 0, 131, 105, 110, 103, 0, 4, 6,
-  0, 131, 105, 110, 103, 0, 130, 101, 105, 110, 103, 0, 17, 8, 0, 79, 247, 15,
-  22, 4, 16, 0, 4, 11, 6, 0, 133, 108, 101, 110, 103, 105, 110, 103, 0, 22, 8,
-  16, 0, 133, 97, 103, 105, 110, 103, 0, 23, 21, 8, 25, 8, 0, 132, 121, 116,
-  104, 105, 110, 103, 0, 8, 12, 6, 0, 133, 101, 105, 108, 105, 110, 103, 0, 79,
-  48, 16, 16, 64, 16, 0, 8, 26, 21, 8, 25, 18, 0, 133, 104, 101, 108, 109, 105,
-  110, 103, 0, 18, 6, 8, 5, 0, 131, 105, 110, 103, 0, 12, 0, 74, 83, 16, 17,
-  109, 16, 0, 72, 90, 16, 10, 98, 16, 0, 5, 0, 130, 110, 105, 110, 103, 0, 8, 5,
-  0, 133, 105, 110, 110, 105, 110, 103, 0, 12, 9, 8, 7, 0, 130, 103, 0, 12, 11,
-  22, 0, 130, 112, 105, 110, 103, 0, 24, 23, 24, 17, 0, 133, 114, 116, 117, 114,
-  105, 110, 103, 0, 75, 154, 16, 17, 163, 16, 23, 181, 16, 28, 193, 16, 0, 44,
-  0, 132, 116, 104, 105, 110, 103, 0, 8, 16, 4, 15, 19, 16, 12, 0, 135, 101,
-  109, 101, 110, 116, 105, 110, 103, 0, 4, 21, 8, 17, 8, 10, 0, 131, 105, 110,
-  103, 0, 21, 8, 25, 8, 0, 130, 104, 105, 110, 103, 0, 22, 4, 6, 0, 132, 117,
-  115, 105, 110, 103, 0, 12, 8, 15, 8, 5, 0, 133, 105, 101, 118, 105, 110, 103,
-  0, 18, 15, 18, 9, 0, 132, 108, 111, 119, 105, 110, 103, 0, 12, 17, 4, 8, 16,
-  0, 129, 103, 0, 12, 23, 22, 0, 131, 114, 105, 110, 103, 0, 21, 21, 4, 6, 0,
-  129, 105, 110, 103, 0, 70, 25, 17, 10, 80, 17, 23, 98, 17, 0, 68, 32, 17, 12,
-  53, 17, 0, 8, 0, 83, 41, 17, 22, 48, 17, 0, 22, 0, 130, 101, 99, 104, 0, 129,
-  114, 99, 104, 0, 75, 60, 17, 23, 71, 17, 0, 26, 7, 17, 4, 22, 0, 131, 105, 99,
-  104, 0, 26, 22, 0, 131, 105, 116, 99, 104, 0, 24, 18, 11, 23, 17, 8, 25, 8, 0,
-  133, 32, 116, 104, 111, 117, 103, 104, 0, 72, 117, 17, 10, 125, 17, 12, 146,
-  17, 15, 157, 17, 17, 166, 17, 24, 182, 17, 0, 17, 12, 17, 0, 130, 116, 104, 0,
-  76, 132, 17, 24, 139, 17, 0, 8, 11, 0, 129, 104, 116, 0, 18, 9, 0, 129, 104,
-  116, 0, 26, 7, 17, 4, 5, 0, 129, 100, 116, 104, 0, 8, 26, 23, 0, 129, 102,
-  116, 104, 0, 8, 8, 23, 17, 12, 17, 0, 133, 101, 116, 101, 101, 110, 116, 104,
-  0, 18, 9, 0, 129, 114, 116, 104, 0, 8, 25, 18, 16, 0, 129, 105, 101, 0, 68,
-  209, 17, 8, 232, 17, 18, 239, 17, 0, 70, 216, 17, 8, 223, 17, 0, 5, 0, 130,
-  97, 99, 107, 0, 21, 11, 22, 0, 130, 105, 101, 107, 0, 12, 15, 0, 129, 107,
-  101, 0, 18, 18, 5, 0, 129, 107, 0, 68, 12, 18, 7, 25, 19, 8, 60, 19, 12, 88,
-  19, 15, 101, 19, 24, 129, 19, 28, 175, 19, 0, 70, 31, 18, 8, 96, 18, 12, 106,
-  18, 17, 221, 18, 23, 232, 18, 24, 246, 18, 0, 12, 0, 71, 46, 18, 15, 54, 18,
-  21, 67, 18, 23, 80, 18, 0, 24, 13, 0, 129, 105, 97, 108, 0, 5, 4, 12, 7, 0,
-  132, 111, 108, 105, 99, 97, 108, 0, 8, 19, 16, 8, 0, 133, 105, 114, 105, 99,
-  97, 108, 0, 17, 8, 7, 17, 12, 0, 136, 100, 101, 110, 116, 105, 99, 97, 108, 0,
-  21, 8, 25, 8, 22, 0, 130, 97, 108, 0, 70, 116, 18, 21, 158, 18, 23, 168, 18,
-  0, 80, 126, 18, 17, 136, 18, 24, 147, 18, 0, 8, 11, 6, 0, 131, 105, 99, 97,
+  101, 0, 69, 85, 14, 6, 99, 14, 0, 12, 23, 17, 18, 6, 0, 132, 114, 105, 98,
+  117, 116, 101, 0, 8, 6, 27, 8, 0, 133, 101, 99, 117, 116, 101, 0, 74, 118, 14,
+  22, 130, 14, 0, 8, 15, 15, 18, 6, 0, 130, 97, 103, 117, 101, 0, 4, 6, 0, 130,
+  117, 115, 101, 0, 72, 145, 14, 12, 195, 14, 0, 12, 0, 68, 154, 14, 6, 160, 14,
+  0, 17, 0, 130, 118, 101, 0, 72, 167, 14, 21, 186, 14, 0, 71, 174, 14, 21, 180,
+  14, 0, 131, 101, 105, 118, 101, 0, 131, 101, 105, 118, 101, 0, 8, 19, 0, 131,
+  101, 105, 118, 101, 0, 72, 205, 14, 15, 230, 14, 23, 238, 14, 0, 75, 212, 14,
+  15, 221, 14, 0, 6, 4, 0, 131, 105, 101, 118, 101, 0, 8, 5, 0, 131, 105, 101,
+  118, 101, 0, 8, 5, 0, 129, 101, 118, 101, 0, 76, 248, 14, 22, 23, 15, 24, 34,
+  15, 0, 68, 255, 14, 25, 11, 15, 0, 12, 23, 12, 17, 12, 0, 132, 116, 105, 118,
+  101, 0, 12, 21, 8, 7, 0, 132, 97, 116, 105, 118, 101, 0, 17, 8, 22, 0, 131,
+  105, 116, 105, 118, 101, 0, 23, 17, 12, 0, 131, 105, 116, 105, 118, 101, 0,
+  72, 52, 15, 12, 62, 15, 0, 12, 22, 44, 0, 131, 101, 105, 122, 101, 0, 21, 0,
+  72, 71, 15, 19, 84, 15, 0, 10, 4, 15, 19, 0, 132, 105, 97, 114, 105, 122, 101,
+  0, 21, 24, 22, 0, 129, 115, 101, 0, 72, 102, 15, 12, 110, 15, 15, 143, 15, 0,
+  22, 28, 16, 0, 128, 108, 102, 0, 8, 0, 75, 119, 15, 21, 136, 15, 0, 70, 126,
+  15, 23, 131, 15, 0, 130, 105, 101, 102, 0, 130, 105, 101, 102, 0, 10, 0, 130,
+  105, 101, 102, 0, 8, 22, 24, 18, 28, 0, 131, 114, 115, 101, 108, 102, 0, 76,
+  163, 15, 17, 200, 15, 0, 71, 170, 15, 17, 177, 15, 0, 17, 8, 0, 128, 110, 103,
+  0, 75, 184, 15, 17, 191, 15, 0, 23, 0, 130, 105, 110, 103, 0, 12, 10, 8, 5, 0,
+  128, 110, 103, 0, 71, 216, 15, 12, 227, 15, 17, 164, 17, 21, 173, 17, 28, 183,
+  17, 0, 24, 15, 6, 17, 12, 0, 129, 105, 110, 103, 0, 68, 17, 16, 5, 33, 16, 7,
+  70, 16, 8, 102, 16, 10, 159, 16, 11, 193, 16, 15, 207, 16, 16, 219, 16, 17,
+  252, 16, 19, 39, 17, 21, 49, 17, 23, 63, 17, 24, 126, 17, 25, 137, 17, 26,
+  151, 17, 0, 17, 12, 23, 17, 12, 4, 16, 0, 133, 97, 105, 110, 105, 110, 103, 0,
+  12, 21, 6, 0, 72, 44, 16, 22, 56, 16, 0, 7, 0, 134, 115, 99, 114, 105, 98,
+  105, 110, 103, 0, 12, 7, 0, 136, 101, 115, 99, 114, 105, 98, 105, 110, 103, 0,
+  24, 6, 0, 79, 80, 16, 17, 92, 16, 0, 17, 12, 0, 134, 99, 108, 117, 100, 105,
+  110, 103, 0, 12, 0, 132, 108, 117, 100, 105, 110, 103, 0, 70, 118, 16, 8, 128,
+  16, 16, 135, 16, 21, 145, 16, 22, 153, 16, 0, 12, 23, 18, 17, 0, 131, 105,
+  110, 103, 0, 5, 0, 131, 105, 110, 103, 0, 18, 6, 8, 5, 0, 131, 105, 110, 103,
+  0, 4, 6, 0, 131, 105, 110, 103, 0, 130, 101, 105, 110, 103, 0, 17, 8, 0, 79,
+  169, 16, 22, 182, 16, 0, 4, 11, 6, 0, 133, 108, 101, 110, 103, 105, 110, 103,
+  0, 22, 8, 16, 0, 133, 97, 103, 105, 110, 103, 0, 23, 21, 8, 25, 8, 0, 132,
+  121, 116, 104, 105, 110, 103, 0, 8, 12, 6, 0, 133, 101, 105, 108, 105, 110,
+  103, 0, 79, 226, 16, 16, 242, 16, 0, 8, 26, 21, 8, 25, 18, 0, 133, 104, 101,
+  108, 109, 105, 110, 103, 0, 18, 6, 8, 5, 0, 131, 105, 110, 103, 0, 12, 0, 74,
+  5, 17, 17, 31, 17, 0, 72, 12, 17, 10, 20, 17, 0, 5, 0, 130, 110, 105, 110,
+  103, 0, 8, 5, 0, 133, 105, 110, 110, 105, 110, 103, 0, 12, 9, 8, 7, 0, 130,
+  103, 0, 12, 11, 22, 0, 130, 112, 105, 110, 103, 0, 24, 23, 24, 17, 0, 133,
+  114, 116, 117, 114, 105, 110, 103, 0, 75, 76, 17, 17, 85, 17, 23, 103, 17, 28,
+  115, 17, 0, 44, 0, 132, 116, 104, 105, 110, 103, 0, 8, 16, 4, 15, 19, 16, 12,
+  0, 135, 101, 109, 101, 110, 116, 105, 110, 103, 0, 4, 21, 8, 17, 8, 10, 0,
+  131, 105, 110, 103, 0, 21, 8, 25, 8, 0, 130, 104, 105, 110, 103, 0, 22, 4, 6,
+  0, 132, 117, 115, 105, 110, 103, 0, 12, 8, 15, 8, 5, 0, 133, 105, 101, 118,
+  105, 110, 103, 0, 18, 15, 18, 9, 0, 132, 108, 111, 119, 105, 110, 103, 0, 12,
+  17, 4, 8, 16, 0, 129, 103, 0, 12, 23, 22, 0, 131, 114, 105, 110, 103, 0, 21,
+  21, 4, 6, 0, 129, 105, 110, 103, 0, 70, 203, 17, 10, 2, 18, 23, 20, 18, 0, 68,
+  210, 17, 12, 231, 17, 0, 8, 0, 83, 219, 17, 22, 226, 17, 0, 22, 0, 130, 101,
+  99, 104, 0, 129, 114, 99, 104, 0, 75, 238, 17, 23, 249, 17, 0, 26, 7, 17, 4,
+  22, 0, 131, 105, 99, 104, 0, 26, 22, 0, 131, 105, 116, 99, 104, 0, 24, 18, 11,
+  23, 17, 8, 25, 8, 0, 133, 32, 116, 104, 111, 117, 103, 104, 0, 72, 39, 18, 10,
+  47, 18, 12, 68, 18, 15, 79, 18, 17, 88, 18, 24, 104, 18, 0, 17, 12, 17, 0,
+  130, 116, 104, 0, 76, 54, 18, 24, 61, 18, 0, 8, 11, 0, 129, 104, 116, 0, 18,
+  9, 0, 129, 104, 116, 0, 26, 7, 17, 4, 5, 0, 129, 100, 116, 104, 0, 8, 26, 23,
+  0, 129, 102, 116, 104, 0, 8, 8, 23, 17, 12, 17, 0, 133, 101, 116, 101, 101,
+  110, 116, 104, 0, 18, 9, 0, 129, 114, 116, 104, 0, 8, 25, 18, 16, 0, 129, 105,
+  101, 0, 68, 131, 18, 8, 154, 18, 18, 161, 18, 0, 70, 138, 18, 8, 145, 18, 0,
+  5, 0, 130, 97, 99, 107, 0, 21, 11, 22, 0, 130, 105, 101, 107, 0, 12, 15, 0,
+  129, 107, 101, 0, 18, 18, 5, 0, 129, 107, 0, 68, 190, 18, 7, 203, 19, 8, 238,
+  19, 12, 10, 20, 15, 23, 20, 24, 51, 20, 28, 97, 20, 0, 70, 209, 18, 8, 18, 19,
+  12, 28, 19, 17, 143, 19, 23, 154, 19, 24, 168, 19, 0, 12, 0, 71, 224, 18, 15,
+  232, 18, 21, 245, 18, 23, 2, 19, 0, 24, 13, 0, 129, 105, 97, 108, 0, 5, 4, 12,
+  7, 0, 132, 111, 108, 105, 99, 97, 108, 0, 8, 19, 16, 8, 0, 133, 105, 114, 105,
+  99, 97, 108, 0, 17, 8, 7, 17, 12, 0, 136, 100, 101, 110, 116, 105, 99, 97,
+  108, 0, 21, 8, 25, 8, 22, 0, 130, 97, 108, 0, 70, 38, 19, 21, 80, 19, 23, 90,
+  19, 0, 80, 48, 19, 17, 58, 19, 24, 69, 19, 0, 8, 11, 6, 0, 131, 105, 99, 97,
   108, 0, 8, 22, 22, 8, 0, 131, 116, 105, 97, 108, 0, 7, 24, 13, 0, 132, 105,
-  99, 105, 97, 108, 0, 12, 19, 16, 8, 0, 129, 99, 97, 108, 0, 81, 175, 18, 19,
-  212, 18, 0, 8, 22, 0, 72, 185, 18, 22, 194, 18, 0, 133, 115, 101, 110, 116,
+  99, 105, 97, 108, 0, 12, 19, 16, 8, 0, 129, 99, 97, 108, 0, 81, 97, 19, 19,
+  134, 19, 0, 8, 22, 0, 72, 107, 19, 22, 116, 19, 0, 133, 115, 101, 110, 116,
   105, 97, 108, 0, 8, 17, 12, 24, 20, 0, 136, 116, 101, 115, 115, 101, 110, 116,
   105, 97, 108, 0, 4, 6, 0, 131, 105, 116, 97, 108, 0, 10, 12, 21, 18, 0, 130,
   105, 110, 97, 108, 0, 8, 16, 4, 7, 17, 24, 9, 0, 130, 110, 116, 97, 108, 0,
-  23, 0, 70, 255, 18, 17, 15, 19, 0, 8, 15, 8, 23, 17, 12, 0, 133, 108, 101, 99,
-  116, 117, 97, 108, 0, 8, 22, 22, 8, 0, 130, 105, 97, 108, 0, 24, 0, 82, 34,
-  19, 26, 51, 19, 0, 75, 41, 19, 26, 47, 19, 0, 22, 0, 129, 108, 100, 0, 129,
-  108, 100, 0, 18, 0, 132, 119, 111, 117, 108, 100, 0, 79, 67, 19, 17, 77, 19,
-  0, 4, 21, 4, 19, 0, 129, 108, 101, 108, 0, 18, 22, 21, 8, 19, 0, 129, 110,
-  101, 108, 0, 4, 23, 17, 8, 22, 22, 8, 0, 130, 105, 97, 108, 0, 72, 108, 19,
-  24, 120, 19, 0, 19, 22, 12, 16, 0, 131, 115, 112, 101, 108, 108, 0, 9, 8, 6,
-  4, 21, 10, 0, 128, 0, 9, 0, 72, 141, 19, 12, 149, 19, 23, 162, 19, 0, 26, 4,
+  23, 0, 70, 177, 19, 17, 193, 19, 0, 8, 15, 8, 23, 17, 12, 0, 133, 108, 101,
+  99, 116, 117, 97, 108, 0, 8, 22, 22, 8, 0, 130, 105, 97, 108, 0, 24, 0, 82,
+  212, 19, 26, 229, 19, 0, 75, 219, 19, 26, 225, 19, 0, 22, 0, 129, 108, 100, 0,
+  129, 108, 100, 0, 18, 0, 132, 119, 111, 117, 108, 100, 0, 79, 245, 19, 17,
+  255, 19, 0, 4, 21, 4, 19, 0, 129, 108, 101, 108, 0, 18, 22, 21, 8, 19, 0, 129,
+  110, 101, 108, 0, 4, 23, 17, 8, 22, 22, 8, 0, 130, 105, 97, 108, 0, 72, 30,
+  20, 24, 42, 20, 0, 19, 22, 12, 16, 0, 131, 115, 112, 101, 108, 108, 0, 9, 8,
+  6, 4, 21, 10, 0, 128, 0, 9, 0, 72, 63, 20, 12, 71, 20, 23, 84, 20, 0, 26, 4,
   0, 131, 102, 117, 108, 0, 23, 4, 8, 5, 0, 132, 117, 116, 105, 102, 117, 108,
   0, 4, 8, 21, 10, 0, 133, 97, 116, 101, 102, 117, 108, 0, 15, 4, 8, 21, 0, 129,
-  108, 121, 0, 80, 194, 19, 22, 202, 19, 24, 215, 19, 0, 24, 15, 18, 6, 0, 128,
-  110, 0, 12, 23, 4, 17, 4, 9, 0, 129, 99, 105, 115, 109, 0, 76, 222, 19, 24, 0,
-  20, 0, 17, 0, 72, 231, 19, 17, 242, 19, 0, 15, 15, 12, 16, 0, 130, 110, 105,
-  117, 109, 0, 8, 15, 12, 16, 0, 133, 108, 101, 110, 110, 105, 117, 109, 0, 6,
-  6, 4, 25, 0, 131, 117, 117, 109, 0, 68, 44, 20, 7, 85, 20, 8, 105, 20, 10,
-  245, 20, 12, 26, 21, 14, 85, 21, 18, 108, 21, 21, 221, 22, 22, 250, 22, 24, 4,
-  23, 28, 27, 23, 0, 76, 51, 20, 21, 76, 20, 0, 23, 0, 81, 60, 20, 21, 68, 20,
-  0, 18, 6, 0, 130, 97, 105, 110, 0, 8, 6, 0, 130, 97, 105, 110, 0, 8, 15, 44,
-  0, 130, 97, 114, 110, 0, 76, 92, 20, 24, 98, 20, 0, 9, 0, 129, 110, 100, 0,
-  18, 9, 0, 129, 110, 100, 0, 71, 127, 20, 8, 158, 20, 11, 200, 20, 19, 209, 20,
-  22, 218, 20, 23, 228, 20, 26, 237, 20, 0, 76, 134, 20, 21, 144, 20, 0, 5, 21,
-  18, 9, 0, 129, 100, 101, 110, 0, 4, 10, 21, 8, 7, 17, 12, 14, 0, 130, 116,
-  101, 110, 0, 87, 165, 20, 26, 190, 20, 0, 72, 172, 20, 26, 180, 20, 0, 5, 0,
-  130, 119, 101, 101, 110, 0, 8, 5, 0, 132, 116, 119, 101, 101, 110, 0, 8, 5, 0,
-  131, 116, 119, 101, 101, 110, 0, 23, 21, 18, 17, 0, 128, 114, 110, 0, 4, 11,
-  44, 0, 129, 112, 101, 110, 0, 18, 18, 11, 6, 0, 131, 115, 101, 110, 0, 12, 21,
-  26, 0, 129, 116, 101, 110, 0, 23, 8, 5, 0, 128, 101, 110, 0, 72, 252, 20, 12,
-  7, 21, 0, 12, 21, 18, 9, 0, 131, 101, 105, 103, 110, 0, 75, 14, 21, 18, 20,
-  21, 0, 23, 0, 129, 110, 103, 0, 10, 0, 129, 110, 103, 0, 68, 36, 21, 10, 49,
-  21, 15, 74, 21, 0, 23, 17, 24, 18, 6, 0, 133, 110, 116, 97, 105, 110, 0, 68,
-  56, 21, 22, 66, 21, 0, 19, 16, 4, 6, 0, 130, 105, 103, 110, 0, 8, 7, 0, 130,
-  105, 103, 110, 0, 4, 19, 27, 8, 0, 131, 108, 97, 105, 110, 0, 75, 92, 21, 12,
-  101, 21, 0, 12, 23, 0, 131, 104, 105, 110, 107, 0, 11, 23, 0, 129, 110, 107,
-  0, 76, 121, 21, 22, 143, 22, 23, 183, 22, 26, 213, 22, 0, 86, 128, 21, 23,
-  187, 21, 0, 68, 138, 21, 8, 147, 21, 22, 158, 21, 0, 12, 15, 0, 131, 105, 115,
-  111, 110, 0, 22, 22, 18, 19, 0, 130, 115, 105, 111, 110, 0, 68, 165, 21, 8,
-  174, 21, 0, 6, 6, 18, 0, 131, 105, 111, 110, 0, 22, 18, 19, 0, 133, 115, 101,
-  115, 115, 105, 111, 110, 0, 68, 209, 21, 6, 49, 22, 12, 66, 22, 16, 81, 22,
-  17, 94, 22, 22, 123, 22, 24, 133, 22, 0, 76, 225, 21, 16, 245, 21, 17, 3, 22,
-  21, 18, 22, 23, 36, 22, 0, 6, 17, 24, 18, 17, 18, 21, 19, 0, 137, 117, 110,
-  99, 105, 97, 116, 105, 111, 110, 0, 18, 9, 17, 12, 0, 133, 114, 109, 97, 116,
-  105, 111, 110, 0, 12, 4, 15, 19, 27, 8, 0, 134, 110, 97, 116, 105, 111, 110,
-  0, 23, 22, 18, 16, 8, 7, 0, 135, 110, 115, 116, 114, 97, 116, 105, 111, 110,
-  0, 18, 10, 8, 17, 0, 132, 105, 97, 116, 105, 111, 110, 0, 12, 23, 22, 12, 21,
-  24, 13, 0, 134, 100, 105, 99, 116, 105, 111, 110, 0, 23, 12, 19, 8, 21, 0,
-  134, 101, 116, 105, 116, 105, 111, 110, 0, 21, 18, 9, 17, 12, 0, 131, 97, 116,
-  105, 111, 110, 0, 70, 101, 22, 12, 112, 22, 0, 24, 9, 0, 133, 110, 99, 116,
-  105, 111, 110, 0, 9, 8, 7, 0, 131, 105, 116, 105, 111, 110, 0, 18, 19, 0, 131,
-  105, 116, 105, 111, 110, 0, 15, 15, 12, 0, 131, 115, 105, 111, 110, 0, 68,
-  150, 22, 12, 159, 22, 0, 12, 15, 0, 130, 105, 115, 111, 110, 0, 70, 166, 22,
-  21, 174, 22, 0, 8, 7, 0, 129, 105, 111, 110, 0, 8, 25, 0, 131, 115, 105, 111,
-  110, 0, 76, 190, 22, 19, 201, 22, 0, 17, 12, 9, 8, 7, 0, 129, 105, 111, 110,
-  0, 12, 21, 6, 22, 8, 7, 0, 129, 105, 111, 110, 0, 23, 44, 0, 130, 111, 119,
-  110, 0, 72, 228, 22, 23, 240, 22, 0, 11, 21, 18, 17, 0, 131, 116, 104, 101,
-  114, 110, 0, 24, 8, 21, 0, 131, 116, 117, 114, 110, 0, 10, 12, 11, 23, 0, 130,
-  110, 103, 115, 0, 85, 11, 23, 23, 20, 23, 0, 23, 8, 21, 0, 130, 117, 114, 110,
-  0, 8, 21, 0, 128, 114, 110, 0, 17, 18, 7, 24, 8, 22, 19, 0, 128, 109, 0, 71,
-  48, 23, 19, 59, 23, 26, 66, 23, 0, 8, 24, 22, 19, 0, 131, 101, 117, 100, 111,
-  0, 26, 23, 44, 0, 129, 111, 0, 14, 17, 44, 0, 131, 107, 110, 111, 119, 0, 24,
-  18, 18, 15, 0, 129, 107, 117, 112, 0, 68, 105, 23, 8, 118, 23, 15, 209, 24,
-  22, 223, 24, 24, 231, 24, 28, 240, 24, 0, 12, 15, 15, 12, 16, 4, 9, 0, 131,
-  105, 97, 114, 0, 68, 155, 23, 8, 176, 23, 10, 221, 23, 11, 10, 24, 12, 20, 24,
-  15, 45, 24, 16, 55, 24, 17, 65, 24, 18, 106, 24, 23, 114, 24, 24, 187, 24, 25,
-  197, 24, 0, 79, 162, 23, 28, 169, 23, 0, 6, 0, 130, 101, 97, 114, 0, 44, 0,
-  130, 101, 97, 114, 0, 81, 183, 23, 21, 212, 23, 0, 8, 0, 74, 192, 23, 12, 202,
-  23, 0, 17, 8, 0, 132, 105, 110, 101, 101, 114, 0, 10, 17, 8, 0, 132, 110, 101,
-  101, 114, 0, 21, 4, 6, 0, 131, 101, 101, 114, 0, 76, 228, 23, 17, 235, 23, 0,
-  11, 0, 129, 104, 101, 114, 0, 68, 242, 23, 8, 254, 23, 0, 22, 22, 8, 16, 0,
-  132, 101, 110, 103, 101, 114, 0, 22, 4, 19, 0, 132, 115, 101, 110, 103, 101,
-  114, 0, 23, 4, 8, 11, 23, 0, 130, 101, 114, 0, 75, 27, 24, 15, 35, 24, 0, 23,
-  44, 0, 130, 101, 105, 114, 0, 4, 8, 0, 131, 114, 108, 105, 101, 114, 0, 23,
-  12, 9, 0, 131, 108, 116, 101, 114, 0, 16, 4, 21, 10, 44, 0, 129, 97, 114, 0,
-  76, 75, 24, 21, 87, 24, 23, 96, 24, 0, 10, 10, 8, 5, 0, 132, 105, 110, 110,
-  101, 114, 0, 8, 25, 18, 10, 0, 129, 111, 114, 0, 22, 12, 15, 0, 130, 101, 110,
-  101, 114, 0, 9, 8, 5, 0, 129, 114, 101, 0, 68, 130, 24, 6, 141, 24, 17, 155,
-  24, 19, 164, 24, 22, 175, 24, 0, 15, 24, 6, 15, 4, 6, 0, 129, 111, 114, 0, 4,
-  21, 11, 6, 0, 133, 97, 114, 97, 99, 116, 101, 114, 0, 8, 25, 17, 12, 0, 129,
-  111, 114, 0, 12, 21, 6, 22, 8, 7, 0, 129, 111, 114, 0, 4, 12, 7, 0, 132, 115,
-  97, 115, 116, 101, 114, 0, 23, 4, 16, 4, 0, 130, 101, 117, 114, 0, 18, 22, 12,
-  7, 0, 131, 99, 111, 118, 101, 114, 0, 4, 24, 6, 12, 23, 21, 4, 19, 0, 130,
-  108, 97, 114, 0, 4, 8, 28, 0, 129, 114, 115, 0, 18, 6, 6, 18, 0, 130, 117,
-  114, 0, 8, 25, 8, 0, 129, 114, 121, 0, 72, 8, 25, 17, 206, 25, 21, 217, 25,
-  22, 237, 25, 24, 105, 26, 0, 68, 30, 25, 9, 38, 25, 12, 47, 25, 14, 156, 25,
-  15, 163, 25, 25, 185, 25, 29, 197, 25, 0, 7, 12, 0, 130, 101, 97, 115, 0, 12,
-  17, 14, 0, 130, 118, 101, 115, 0, 85, 57, 25, 23, 93, 25, 27, 143, 25, 0, 18,
-  0, 74, 66, 25, 22, 80, 25, 0, 4, 23, 4, 6, 0, 134, 101, 103, 111, 114, 105,
-  101, 115, 0, 8, 6, 6, 4, 0, 132, 115, 111, 114, 105, 101, 115, 0, 72, 103, 25,
-  12, 114, 25, 21, 132, 25, 0, 12, 7, 0, 133, 101, 105, 116, 105, 101, 115, 0,
-  22, 22, 8, 6, 6, 8, 17, 0, 136, 101, 115, 115, 105, 116, 105, 101, 115, 0, 24,
-  18, 9, 0, 133, 114, 116, 105, 101, 115, 0, 4, 15, 15, 4, 10, 0, 133, 97, 120,
-  105, 101, 115, 0, 21, 4, 16, 0, 129, 115, 0, 68, 170, 25, 12, 176, 25, 0, 9,
-  0, 129, 115, 101, 0, 16, 4, 9, 0, 129, 105, 101, 115, 0, 12, 8, 11, 23, 0,
-  132, 105, 101, 118, 101, 115, 0, 12, 24, 20, 0, 129, 122, 101, 115, 0, 12, 10,
-  10, 8, 5, 0, 131, 105, 110, 115, 0, 8, 23, 6, 4, 21, 11, 4, 6, 0, 136, 104,
-  97, 114, 97, 99, 116, 101, 114, 115, 0, 68, 247, 25, 8, 3, 26, 18, 94, 26, 0,
-  21, 4, 5, 16, 8, 0, 130, 114, 97, 115, 115, 0, 71, 16, 26, 15, 25, 26, 17, 42,
-  26, 21, 84, 26, 0, 18, 10, 0, 130, 100, 101, 115, 115, 0, 8, 11, 23, 17, 18,
-  17, 0, 134, 101, 116, 104, 101, 108, 101, 115, 115, 0, 79, 52, 26, 22, 61, 26,
-  28, 73, 26, 0, 12, 0, 131, 108, 110, 101, 115, 115, 0, 12, 24, 5, 0, 133, 115,
-  105, 110, 101, 115, 115, 0, 29, 4, 15, 0, 132, 105, 110, 101, 115, 115, 0, 7,
-  4, 0, 131, 100, 114, 101, 115, 115, 0, 21, 6, 6, 4, 0, 132, 114, 111, 115,
-  115, 0, 70, 115, 26, 18, 124, 26, 22, 19, 27, 0, 17, 8, 6, 0, 130, 115, 117,
-  115, 0, 72, 140, 26, 10, 155, 26, 12, 167, 26, 16, 231, 26, 21, 244, 26, 0,
-  17, 12, 10, 12, 7, 17, 12, 0, 133, 101, 110, 111, 117, 115, 0, 4, 21, 23, 24,
-  18, 0, 130, 101, 111, 117, 115, 0, 70, 180, 26, 21, 192, 26, 22, 209, 26, 23,
-  219, 26, 0, 17, 18, 6, 0, 132, 115, 99, 105, 111, 117, 115, 0, 8, 23, 22, 12,
-  16, 0, 136, 121, 115, 116, 101, 114, 105, 111, 117, 115, 0, 12, 25, 0, 132,
-  99, 105, 111, 117, 115, 0, 12, 24, 23, 4, 21, 10, 0, 131, 111, 117, 115, 0,
-  28, 17, 4, 17, 24, 0, 132, 105, 109, 111, 117, 115, 0, 8, 0, 80, 253, 26, 23,
-  7, 27, 0, 24, 11, 0, 132, 111, 114, 111, 117, 115, 0, 22, 4, 22, 12, 7, 0,
-  132, 114, 111, 117, 115, 0, 17, 8, 6, 17, 18, 6, 0, 133, 115, 101, 110, 115,
-  117, 115, 0, 70, 65, 27, 8, 98, 27, 10, 160, 27, 11, 170, 27, 12, 235, 27, 15,
-  31, 28, 17, 62, 28, 19, 43, 30, 22, 70, 30, 24, 123, 30, 0, 68, 72, 27, 8, 81,
-  27, 0, 6, 27, 8, 0, 131, 97, 99, 116, 0, 17, 17, 18, 6, 12, 7, 0, 134, 115,
-  99, 111, 110, 110, 101, 99, 116, 0, 68, 114, 27, 12, 122, 27, 15, 129, 27, 17,
-  140, 27, 18, 153, 27, 0, 21, 10, 0, 130, 101, 97, 116, 0, 21, 26, 0, 129, 116,
-  101, 0, 19, 16, 4, 19, 0, 130, 104, 108, 101, 116, 0, 16, 17, 21, 8, 25, 18,
-  10, 0, 130, 101, 110, 116, 0, 21, 26, 0, 129, 116, 101, 0, 11, 24, 4, 6, 0,
-  130, 103, 104, 116, 0, 71, 180, 27, 10, 187, 27, 12, 224, 27, 0, 12, 26, 0,
-  129, 116, 104, 0, 72, 197, 27, 17, 207, 27, 24, 214, 27, 0, 12, 11, 0, 132,
-  101, 105, 103, 104, 116, 0, 8, 15, 0, 129, 116, 104, 0, 4, 22, 0, 132, 111,
-  117, 103, 104, 116, 0, 10, 17, 18, 23, 0, 131, 105, 103, 104, 116, 0, 72, 245,
-  27, 23, 8, 28, 24, 18, 28, 0, 11, 17, 8, 21, 4, 9, 0, 136, 70, 97, 104, 114,
-  101, 110, 104, 101, 105, 116, 0, 24, 18, 5, 4, 0, 129, 32, 105, 116, 0, 6, 21,
-  24, 6, 0, 133, 105, 114, 99, 117, 105, 116, 0, 86, 38, 28, 24, 48, 28, 0, 24,
-  8, 21, 0, 131, 115, 117, 108, 116, 0, 6, 12, 9, 12, 7, 0, 132, 102, 105, 99,
-  117, 108, 116, 0, 68, 75, 28, 8, 123, 28, 21, 17, 30, 24, 28, 30, 0, 71, 82,
-  28, 21, 95, 28, 0, 17, 8, 19, 8, 7, 17, 12, 0, 130, 101, 110, 116, 0, 4, 0,
-  83, 104, 28, 23, 112, 28, 0, 19, 4, 0, 130, 101, 110, 116, 0, 22, 8, 21, 0,
-  131, 117, 114, 97, 110, 116, 0, 70, 148, 28, 10, 159, 28, 12, 174, 28, 15,
-  188, 28, 16, 218, 28, 21, 141, 29, 23, 231, 29, 25, 7, 30, 0, 12, 9, 9, 8, 0,
-  130, 105, 101, 110, 116, 0, 12, 15, 8, 23, 17, 12, 0, 132, 108, 105, 103, 101,
-  110, 116, 0, 6, 8, 9, 9, 8, 0, 133, 105, 99, 105, 101, 110, 116, 0, 72, 195,
-  28, 15, 205, 28, 0, 6, 27, 8, 0, 130, 108, 101, 110, 116, 0, 8, 27, 8, 0, 133,
-  99, 101, 108, 108, 101, 110, 116, 0, 72, 243, 28, 10, 36, 29, 12, 48, 29, 15,
-  78, 29, 17, 90, 29, 18, 103, 29, 21, 116, 29, 25, 128, 29, 0, 70, 253, 28, 24,
-  15, 29, 25, 25, 29, 0, 17, 4, 11, 6, 17, 8, 0, 137, 104, 97, 110, 99, 101,
-  109, 101, 110, 116, 0, 10, 21, 4, 0, 132, 109, 101, 110, 116, 0, 18, 10, 0,
-  131, 114, 110, 109, 101, 110, 116, 0, 4, 17, 4, 16, 0, 131, 101, 109, 101,
-  110, 116, 0, 72, 55, 29, 15, 67, 29, 0, 19, 27, 8, 0, 132, 114, 105, 109, 101,
-  110, 116, 0, 19, 16, 12, 0, 132, 101, 109, 101, 110, 116, 0, 23, 23, 8, 22, 0,
-  131, 101, 109, 101, 110, 116, 0, 8, 25, 18, 10, 0, 132, 114, 110, 109, 101,
-  110, 116, 0, 21, 12, 25, 17, 8, 0, 131, 110, 109, 101, 110, 116, 0, 8, 25, 18,
-  10, 0, 131, 110, 109, 101, 110, 116, 0, 18, 21, 19, 16, 12, 0, 131, 101, 109,
-  101, 110, 116, 0, 68, 154, 29, 8, 165, 29, 9, 177, 29, 21, 188, 29, 0, 19, 4,
-  0, 132, 112, 97, 114, 101, 110, 116, 0, 9, 12, 7, 0, 132, 102, 101, 114, 101,
-  110, 116, 0, 9, 12, 7, 0, 131, 101, 114, 101, 110, 116, 0, 68, 195, 29, 8,
-  219, 29, 0, 19, 0, 68, 204, 29, 19, 212, 29, 0, 133, 112, 97, 114, 101, 110,
-  116, 0, 4, 0, 131, 101, 110, 116, 0, 9, 12, 7, 0, 133, 102, 101, 114, 101,
-  110, 116, 0, 72, 238, 29, 12, 253, 29, 0, 23, 19, 16, 18, 6, 17, 12, 0, 133,
-  101, 116, 101, 110, 116, 0, 21, 23, 24, 17, 0, 131, 101, 110, 116, 0, 8, 15,
-  8, 21, 0, 130, 97, 110, 116, 0, 8, 9, 9, 12, 7, 0, 129, 101, 110, 116, 0, 4,
-  21, 4, 23, 22, 8, 21, 0, 132, 117, 114, 97, 110, 116, 0, 80, 50, 30, 21, 60,
-  30, 0, 4, 27, 8, 0, 131, 101, 109, 112, 116, 0, 12, 6, 22, 0, 131, 114, 105,
-  112, 116, 0, 72, 77, 30, 12, 88, 30, 0, 12, 11, 23, 4, 0, 131, 101, 105, 115,
-  116, 0, 70, 95, 30, 17, 105, 30, 0, 4, 9, 0, 131, 115, 99, 105, 115, 116, 0,
-  28, 10, 18, 22, 28, 16, 0, 136, 105, 115, 111, 103, 121, 110, 105, 115, 116,
-  0, 70, 139, 30, 18, 147, 30, 19, 190, 30, 22, 213, 30, 23, 220, 30, 0, 21, 12,
-  6, 0, 128, 105, 116, 0, 68, 157, 30, 5, 166, 30, 11, 174, 30, 0, 5, 0, 132,
-  97, 98, 111, 117, 116, 0, 5, 4, 0, 131, 111, 117, 116, 0, 10, 24, 18, 11, 23,
-  0, 134, 114, 111, 117, 103, 104, 111, 117, 116, 0, 87, 197, 30, 24, 205, 30,
-  0, 17, 12, 0, 131, 112, 117, 116, 0, 18, 0, 130, 116, 112, 117, 116, 0, 13, 0,
-  130, 117, 115, 116, 0, 19, 24, 18, 0, 131, 116, 112, 117, 116, 0, 23, 18, 5,
-  4, 0, 129, 117, 116, 0, 8, 18, 15, 44, 0, 129, 118, 101, 0, 18, 0, 78, 1, 31,
-  21, 10, 31, 0, 17, 44, 0, 131, 107, 110, 111, 119, 0, 82, 17, 31, 21, 29, 31,
-  0, 16, 16, 18, 23, 0, 132, 111, 114, 114, 111, 119, 0, 18, 16, 16, 18, 23, 0,
-  133, 111, 114, 114, 111, 119, 0, 70, 79, 31, 7, 180, 31, 8, 195, 31, 9, 226,
-  31, 11, 237, 31, 15, 248, 31, 16, 247, 34, 17, 5, 35, 19, 46, 35, 21, 59, 35,
-  22, 55, 36, 23, 73, 36, 0, 72, 92, 31, 17, 103, 31, 19, 152, 31, 23, 164, 31,
-  0, 24, 20, 8, 21, 9, 0, 129, 110, 99, 121, 0, 68, 110, 31, 8, 139, 31, 0, 71,
-  117, 31, 16, 129, 31, 0, 17, 8, 19, 8, 7, 0, 131, 101, 110, 99, 121, 0, 18,
-  15, 19, 12, 7, 0, 130, 99, 121, 0, 6, 12, 9, 9, 8, 0, 131, 105, 101, 110, 99,
-  121, 0, 24, 21, 14, 17, 4, 5, 0, 129, 116, 99, 121, 0, 19, 24, 21, 17, 4, 5,
-  0, 133, 107, 114, 117, 112, 116, 99, 121, 0, 21, 4, 19, 4, 8, 13, 0, 133, 111,
-  112, 97, 114, 100, 121, 0, 79, 202, 31, 17, 216, 31, 0, 23, 4, 12, 7, 8, 16,
-  16, 12, 0, 130, 101, 108, 121, 0, 24, 18, 13, 0, 130, 114, 110, 101, 121, 0,
-  12, 24, 20, 12, 15, 0, 130, 101, 102, 121, 0, 23, 4, 8, 11, 0, 130, 108, 116,
-  104, 121, 0, 68, 26, 32, 5, 143, 32, 6, 239, 32, 7, 250, 32, 8, 27, 33, 12,
-  91, 33, 15, 168, 33, 16, 81, 34, 17, 92, 34, 21, 103, 34, 23, 134, 34, 0, 70,
-  42, 32, 12, 51, 32, 21, 77, 32, 23, 86, 32, 24, 98, 32, 0, 12, 22, 4, 5, 0,
-  128, 108, 121, 0, 70, 58, 32, 23, 67, 32, 0, 8, 19, 22, 8, 0, 128, 108, 121,
-  0, 17, 8, 22, 22, 8, 0, 128, 108, 121, 0, 24, 23, 4, 17, 0, 128, 108, 121, 0,
-  17, 8, 7, 12, 6, 6, 4, 0, 128, 108, 121, 0, 81, 108, 32, 22, 115, 32, 23, 121,
-  32, 0, 17, 4, 0, 128, 108, 121, 0, 24, 0, 128, 108, 121, 0, 81, 128, 32, 21,
-  136, 32, 0, 8, 25, 8, 0, 128, 108, 121, 0, 12, 25, 0, 128, 108, 121, 0, 68,
-  150, 32, 12, 219, 32, 0, 70, 160, 32, 22, 172, 32, 23, 181, 32, 0, 12, 23, 18,
-  17, 0, 131, 101, 97, 98, 108, 121, 0, 12, 25, 0, 131, 105, 98, 108, 121, 0,
-  76, 188, 32, 22, 201, 32, 0, 23, 12, 25, 8, 17, 12, 0, 133, 97, 98, 108, 121,
-  0, 12, 22, 8, 21, 12, 0, 136, 114, 101, 115, 105, 115, 116, 105, 98, 108, 121,
-  0, 23, 22, 12, 22, 8, 21, 12, 0, 136, 114, 101, 115, 105, 115, 116, 105, 98,
-  108, 121, 0, 12, 22, 4, 5, 0, 129, 97, 108, 108, 121, 0, 8, 0, 86, 3, 33, 23,
-  13, 33, 0, 18, 19, 21, 24, 19, 0, 130, 108, 121, 0, 18, 19, 21, 24, 19, 0,
-  132, 114, 116, 101, 100, 108, 121, 0, 80, 37, 33, 23, 49, 33, 24, 84, 33, 0,
-  12, 23, 15, 24, 0, 130, 97, 116, 101, 108, 121, 0, 68, 56, 33, 5, 73, 33, 0,
-  12, 7, 8, 16, 12, 0, 135, 109, 101, 100, 105, 97, 116, 101, 108, 121, 0, 24,
-  18, 7, 17, 24, 0, 129, 100, 108, 121, 0, 21, 23, 0, 130, 108, 121, 0, 21, 4,
-  0, 79, 101, 33, 22, 113, 33, 0, 24, 6, 12, 23, 21, 4, 19, 0, 130, 108, 121, 0,
-  72, 120, 33, 22, 152, 33, 0, 6, 0, 70, 129, 33, 8, 142, 33, 0, 8, 17, 0, 135,
-  101, 115, 115, 97, 114, 105, 108, 121, 0, 17, 0, 132, 115, 97, 114, 105, 108,
-  121, 0, 8, 6, 6, 8, 17, 0, 136, 101, 115, 115, 97, 114, 105, 108, 121, 0, 68,
-  175, 33, 8, 71, 34, 0, 70, 191, 33, 12, 201, 33, 22, 232, 33, 23, 242, 33, 24,
-  40, 34, 0, 12, 15, 5, 24, 19, 0, 131, 108, 121, 0, 23, 17, 8, 0, 71, 212, 33,
-  25, 223, 33, 0, 12, 6, 17, 12, 0, 132, 97, 108, 108, 121, 0, 8, 0, 132, 117,
-  97, 108, 108, 121, 0, 24, 22, 24, 0, 132, 97, 108, 108, 121, 0, 81, 249, 33,
-  24, 28, 34, 0, 8, 0, 80, 2, 34, 25, 19, 34, 0, 4, 21, 6, 17, 12, 0, 136, 101,
-  109, 101, 110, 116, 97, 108, 108, 121, 0, 8, 0, 131, 117, 97, 108, 108, 121,
-  0, 21, 12, 25, 0, 133, 116, 117, 97, 108, 108, 121, 0, 70, 47, 34, 17, 60, 34,
-  0, 12, 23, 21, 4, 19, 0, 131, 108, 97, 114, 108, 121, 0, 4, 44, 0, 132, 110,
-  117, 97, 108, 108, 121, 0, 4, 21, 0, 132, 101, 97, 108, 108, 121, 0, 8, 21,
-  23, 27, 8, 0, 129, 101, 108, 121, 0, 8, 21, 21, 24, 6, 0, 129, 116, 108, 121,
-  0, 4, 0, 72, 112, 34, 24, 120, 34, 0, 8, 0, 132, 97, 114, 108, 121, 0, 6, 12,
-  23, 21, 4, 19, 0, 131, 108, 97, 114, 108, 121, 0, 68, 150, 34, 8, 180, 34, 12,
-  193, 34, 17, 204, 34, 24, 236, 34, 0, 76, 157, 34, 17, 168, 34, 0, 7, 8, 16,
-  16, 12, 0, 129, 101, 108, 121, 0, 12, 9, 8, 7, 0, 131, 105, 116, 101, 108,
-  121, 0, 17, 12, 9, 8, 7, 0, 131, 105, 116, 101, 108, 121, 0, 17, 12, 9, 8, 7,
-  0, 129, 101, 108, 121, 0, 68, 211, 34, 8, 224, 34, 0, 21, 8, 11, 17, 12, 0,
-  132, 101, 110, 116, 108, 121, 0, 7, 12, 6, 17, 12, 0, 129, 97, 108, 108, 121,
-  0, 15, 18, 22, 5, 4, 0, 129, 101, 108, 121, 0, 18, 23, 11, 6, 12, 7, 0, 131,
-  111, 116, 111, 109, 121, 0, 68, 15, 35, 8, 23, 35, 28, 31, 35, 0, 21, 28, 23,
-  0, 128, 110, 121, 0, 18, 16, 0, 130, 110, 101, 121, 0, 10, 18, 22, 28, 16, 0,
-  134, 105, 115, 111, 103, 121, 110, 121, 0, 19, 11, 4, 17, 24, 0, 132, 104, 97,
-  112, 112, 121, 0, 68, 75, 35, 7, 208, 35, 8, 218, 35, 18, 8, 36, 23, 41, 36,
-  0, 69, 91, 35, 15, 100, 35, 17, 112, 35, 22, 125, 35, 24, 195, 35, 0, 12, 15,
-  0, 130, 114, 97, 114, 121, 0, 24, 6, 12, 23, 21, 4, 19, 0, 128, 108, 121, 0,
-  8, 10, 4, 16, 12, 0, 132, 105, 110, 97, 114, 121, 0, 72, 132, 35, 22, 160, 35,
-  0, 6, 0, 70, 141, 35, 8, 152, 35, 0, 8, 17, 0, 133, 101, 115, 115, 97, 114,
-  121, 0, 17, 0, 130, 115, 97, 114, 121, 0, 8, 6, 0, 70, 170, 35, 8, 181, 35, 0,
-  8, 17, 0, 134, 101, 115, 115, 97, 114, 121, 0, 17, 24, 0, 135, 110, 101, 99,
-  101, 115, 115, 97, 114, 121, 0, 22, 12, 7, 24, 13, 0, 132, 99, 105, 97, 114,
-  121, 0, 17, 24, 18, 5, 0, 129, 97, 114, 121, 0, 79, 228, 35, 22, 241, 35, 23,
-  252, 35, 0, 15, 26, 8, 13, 0, 132, 101, 108, 108, 101, 114, 121, 0, 22, 8, 6,
-  8, 17, 0, 130, 97, 114, 121, 0, 22, 12, 16, 0, 133, 121, 115, 116, 101, 114,
-  121, 0, 74, 15, 36, 23, 27, 36, 0, 4, 23, 4, 6, 0, 132, 101, 103, 111, 114,
-  121, 0, 12, 10, 18, 21, 8, 7, 0, 132, 97, 116, 111, 114, 121, 0, 22, 8, 16, 8,
-  11, 6, 0, 132, 105, 115, 116, 114, 121, 0, 21, 8, 25, 4, 21, 23, 17, 18, 6, 0,
-  133, 111, 118, 101, 114, 115, 121, 0, 68, 92, 36, 8, 103, 36, 12, 118, 36, 15,
-  151, 36, 18, 160, 36, 21, 171, 36, 0, 23, 17, 4, 24, 20, 0, 130, 105, 116,
-  121, 0, 12, 21, 8, 23, 18, 17, 0, 133, 111, 114, 105, 101, 116, 121, 0, 79,
-  125, 36, 21, 137, 36, 0, 24, 6, 12, 9, 9, 12, 7, 0, 130, 116, 121, 0, 18, 13,
-  21, 4, 16, 0, 134, 106, 111, 114, 105, 116, 121, 0, 12, 5, 4, 0, 129, 105,
-  116, 121, 0, 23, 6, 8, 21, 12, 7, 0, 129, 114, 121, 0, 24, 18, 9, 0, 131, 114,
-  116, 121, 0};
+  108, 121, 0, 80, 116, 20, 22, 124, 20, 24, 137, 20, 0, 24, 15, 18, 6, 0, 128,
+  110, 0, 12, 23, 4, 17, 4, 9, 0, 129, 99, 105, 115, 109, 0, 76, 144, 20, 24,
+  178, 20, 0, 17, 0, 72, 153, 20, 17, 164, 20, 0, 15, 15, 12, 16, 0, 130, 110,
+  105, 117, 109, 0, 8, 15, 12, 16, 0, 133, 108, 101, 110, 110, 105, 117, 109, 0,
+  6, 6, 4, 25, 0, 131, 117, 117, 109, 0, 68, 222, 20, 7, 7, 21, 8, 27, 21, 10,
+  167, 21, 12, 204, 21, 14, 7, 22, 18, 30, 22, 21, 143, 23, 22, 172, 23, 24,
+  182, 23, 28, 205, 23, 0, 76, 229, 20, 21, 254, 20, 0, 23, 0, 81, 238, 20, 21,
+  246, 20, 0, 18, 6, 0, 130, 97, 105, 110, 0, 8, 6, 0, 130, 97, 105, 110, 0, 8,
+  15, 44, 0, 130, 97, 114, 110, 0, 76, 14, 21, 24, 20, 21, 0, 9, 0, 129, 110,
+  100, 0, 18, 9, 0, 129, 110, 100, 0, 71, 49, 21, 8, 80, 21, 11, 122, 21, 19,
+  131, 21, 22, 140, 21, 23, 150, 21, 26, 159, 21, 0, 76, 56, 21, 21, 66, 21, 0,
+  5, 21, 18, 9, 0, 129, 100, 101, 110, 0, 4, 10, 21, 8, 7, 17, 12, 14, 0, 130,
+  116, 101, 110, 0, 87, 87, 21, 26, 112, 21, 0, 72, 94, 21, 26, 102, 21, 0, 5,
+  0, 130, 119, 101, 101, 110, 0, 8, 5, 0, 132, 116, 119, 101, 101, 110, 0, 8, 5,
+  0, 131, 116, 119, 101, 101, 110, 0, 23, 21, 18, 17, 0, 128, 114, 110, 0, 4,
+  11, 44, 0, 129, 112, 101, 110, 0, 18, 18, 11, 6, 0, 131, 115, 101, 110, 0, 12,
+  21, 26, 0, 129, 116, 101, 110, 0, 23, 8, 5, 0, 128, 101, 110, 0, 72, 174, 21,
+  12, 185, 21, 0, 12, 21, 18, 9, 0, 131, 101, 105, 103, 110, 0, 75, 192, 21, 18,
+  198, 21, 0, 23, 0, 129, 110, 103, 0, 10, 0, 129, 110, 103, 0, 68, 214, 21, 10,
+  227, 21, 15, 252, 21, 0, 23, 17, 24, 18, 6, 0, 133, 110, 116, 97, 105, 110, 0,
+  68, 234, 21, 22, 244, 21, 0, 19, 16, 4, 6, 0, 130, 105, 103, 110, 0, 8, 7, 0,
+  130, 105, 103, 110, 0, 4, 19, 27, 8, 0, 131, 108, 97, 105, 110, 0, 75, 14, 22,
+  12, 23, 22, 0, 12, 23, 0, 131, 104, 105, 110, 107, 0, 11, 23, 0, 129, 110,
+  107, 0, 76, 43, 22, 22, 65, 23, 23, 105, 23, 26, 135, 23, 0, 86, 50, 22, 23,
+  109, 22, 0, 68, 60, 22, 8, 69, 22, 22, 80, 22, 0, 12, 15, 0, 131, 105, 115,
+  111, 110, 0, 22, 22, 18, 19, 0, 130, 115, 105, 111, 110, 0, 68, 87, 22, 8, 96,
+  22, 0, 6, 6, 18, 0, 131, 105, 111, 110, 0, 22, 18, 19, 0, 133, 115, 101, 115,
+  115, 105, 111, 110, 0, 68, 131, 22, 6, 227, 22, 12, 244, 22, 16, 3, 23, 17,
+  16, 23, 22, 45, 23, 24, 55, 23, 0, 76, 147, 22, 16, 167, 22, 17, 181, 22, 21,
+  196, 22, 23, 214, 22, 0, 6, 17, 24, 18, 17, 18, 21, 19, 0, 137, 117, 110, 99,
+  105, 97, 116, 105, 111, 110, 0, 18, 9, 17, 12, 0, 133, 114, 109, 97, 116, 105,
+  111, 110, 0, 12, 4, 15, 19, 27, 8, 0, 134, 110, 97, 116, 105, 111, 110, 0, 23,
+  22, 18, 16, 8, 7, 0, 135, 110, 115, 116, 114, 97, 116, 105, 111, 110, 0, 18,
+  10, 8, 17, 0, 132, 105, 97, 116, 105, 111, 110, 0, 12, 23, 22, 12, 21, 24, 13,
+  0, 134, 100, 105, 99, 116, 105, 111, 110, 0, 23, 12, 19, 8, 21, 0, 134, 101,
+  116, 105, 116, 105, 111, 110, 0, 21, 18, 9, 17, 12, 0, 131, 97, 116, 105, 111,
+  110, 0, 70, 23, 23, 12, 34, 23, 0, 24, 9, 0, 133, 110, 99, 116, 105, 111, 110,
+  0, 9, 8, 7, 0, 131, 105, 116, 105, 111, 110, 0, 18, 19, 0, 131, 105, 116, 105,
+  111, 110, 0, 15, 15, 12, 0, 131, 115, 105, 111, 110, 0, 68, 72, 23, 12, 81,
+  23, 0, 12, 15, 0, 130, 105, 115, 111, 110, 0, 70, 88, 23, 21, 96, 23, 0, 8, 7,
+  0, 129, 105, 111, 110, 0, 8, 25, 0, 131, 115, 105, 111, 110, 0, 76, 112, 23,
+  19, 123, 23, 0, 17, 12, 9, 8, 7, 0, 129, 105, 111, 110, 0, 12, 21, 6, 22, 8,
+  7, 0, 129, 105, 111, 110, 0, 23, 44, 0, 130, 111, 119, 110, 0, 72, 150, 23,
+  23, 162, 23, 0, 11, 21, 18, 17, 0, 131, 116, 104, 101, 114, 110, 0, 24, 8, 21,
+  0, 131, 116, 117, 114, 110, 0, 10, 12, 11, 23, 0, 130, 110, 103, 115, 0, 85,
+  189, 23, 23, 198, 23, 0, 23, 8, 21, 0, 130, 117, 114, 110, 0, 8, 21, 0, 128,
+  114, 110, 0, 17, 18, 7, 24, 8, 22, 19, 0, 128, 109, 0, 71, 226, 23, 19, 237,
+  23, 26, 244, 23, 0, 8, 24, 22, 19, 0, 131, 101, 117, 100, 111, 0, 26, 23, 44,
+  0, 129, 111, 0, 14, 17, 44, 0, 131, 107, 110, 111, 119, 0, 24, 18, 18, 15, 0,
+  129, 107, 117, 112, 0, 68, 27, 24, 8, 40, 24, 15, 131, 25, 22, 145, 25, 24,
+  153, 25, 28, 162, 25, 0, 12, 15, 15, 12, 16, 4, 9, 0, 131, 105, 97, 114, 0,
+  68, 77, 24, 8, 98, 24, 10, 143, 24, 11, 188, 24, 12, 198, 24, 15, 223, 24, 16,
+  233, 24, 17, 243, 24, 18, 28, 25, 23, 36, 25, 24, 109, 25, 25, 119, 25, 0, 79,
+  84, 24, 28, 91, 24, 0, 6, 0, 130, 101, 97, 114, 0, 44, 0, 130, 101, 97, 114,
+  0, 81, 105, 24, 21, 134, 24, 0, 8, 0, 74, 114, 24, 12, 124, 24, 0, 17, 8, 0,
+  132, 105, 110, 101, 101, 114, 0, 10, 17, 8, 0, 132, 110, 101, 101, 114, 0, 21,
+  4, 6, 0, 131, 101, 101, 114, 0, 76, 150, 24, 17, 157, 24, 0, 11, 0, 129, 104,
+  101, 114, 0, 68, 164, 24, 8, 176, 24, 0, 22, 22, 8, 16, 0, 132, 101, 110, 103,
+  101, 114, 0, 22, 4, 19, 0, 132, 115, 101, 110, 103, 101, 114, 0, 23, 4, 8, 11,
+  23, 0, 130, 101, 114, 0, 75, 205, 24, 15, 213, 24, 0, 23, 44, 0, 130, 101,
+  105, 114, 0, 4, 8, 0, 131, 114, 108, 105, 101, 114, 0, 23, 12, 9, 0, 131, 108,
+  116, 101, 114, 0, 16, 4, 21, 10, 44, 0, 129, 97, 114, 0, 76, 253, 24, 21, 9,
+  25, 23, 18, 25, 0, 10, 10, 8, 5, 0, 132, 105, 110, 110, 101, 114, 0, 8, 25,
+  18, 10, 0, 129, 111, 114, 0, 22, 12, 15, 0, 130, 101, 110, 101, 114, 0, 9, 8,
+  5, 0, 129, 114, 101, 0, 68, 52, 25, 6, 63, 25, 17, 77, 25, 19, 86, 25, 22, 97,
+  25, 0, 15, 24, 6, 15, 4, 6, 0, 129, 111, 114, 0, 4, 21, 11, 6, 0, 133, 97,
+  114, 97, 99, 116, 101, 114, 0, 8, 25, 17, 12, 0, 129, 111, 114, 0, 12, 21, 6,
+  22, 8, 7, 0, 129, 111, 114, 0, 4, 12, 7, 0, 132, 115, 97, 115, 116, 101, 114,
+  0, 23, 4, 16, 4, 0, 130, 101, 117, 114, 0, 18, 22, 12, 7, 0, 131, 99, 111,
+  118, 101, 114, 0, 4, 24, 6, 12, 23, 21, 4, 19, 0, 130, 108, 97, 114, 0, 4, 8,
+  28, 0, 129, 114, 115, 0, 18, 6, 6, 18, 0, 130, 117, 114, 0, 8, 25, 8, 0, 129,
+  114, 121, 0, 72, 186, 25, 17, 128, 26, 21, 139, 26, 22, 159, 26, 24, 27, 27,
+  0, 68, 208, 25, 9, 216, 25, 12, 225, 25, 14, 78, 26, 15, 85, 26, 25, 107, 26,
+  29, 119, 26, 0, 7, 12, 0, 130, 101, 97, 115, 0, 12, 17, 14, 0, 130, 118, 101,
+  115, 0, 85, 235, 25, 23, 15, 26, 27, 65, 26, 0, 18, 0, 74, 244, 25, 22, 2, 26,
+  0, 4, 23, 4, 6, 0, 134, 101, 103, 111, 114, 105, 101, 115, 0, 8, 6, 6, 4, 0,
+  132, 115, 111, 114, 105, 101, 115, 0, 72, 25, 26, 12, 36, 26, 21, 54, 26, 0,
+  12, 7, 0, 133, 101, 105, 116, 105, 101, 115, 0, 22, 22, 8, 6, 6, 8, 17, 0,
+  136, 101, 115, 115, 105, 116, 105, 101, 115, 0, 24, 18, 9, 0, 133, 114, 116,
+  105, 101, 115, 0, 4, 15, 15, 4, 10, 0, 133, 97, 120, 105, 101, 115, 0, 21, 4,
+  16, 0, 129, 115, 0, 68, 92, 26, 12, 98, 26, 0, 9, 0, 129, 115, 101, 0, 16, 4,
+  9, 0, 129, 105, 101, 115, 0, 12, 8, 11, 23, 0, 132, 105, 101, 118, 101, 115,
+  0, 12, 24, 20, 0, 129, 122, 101, 115, 0, 12, 10, 10, 8, 5, 0, 131, 105, 110,
+  115, 0, 8, 23, 6, 4, 21, 11, 4, 6, 0, 136, 104, 97, 114, 97, 99, 116, 101,
+  114, 115, 0, 68, 169, 26, 8, 181, 26, 18, 16, 27, 0, 21, 4, 5, 16, 8, 0, 130,
+  114, 97, 115, 115, 0, 71, 194, 26, 15, 203, 26, 17, 220, 26, 21, 6, 27, 0, 18,
+  10, 0, 130, 100, 101, 115, 115, 0, 8, 11, 23, 17, 18, 17, 0, 134, 101, 116,
+  104, 101, 108, 101, 115, 115, 0, 79, 230, 26, 22, 239, 26, 28, 251, 26, 0, 12,
+  0, 131, 108, 110, 101, 115, 115, 0, 12, 24, 5, 0, 133, 115, 105, 110, 101,
+  115, 115, 0, 29, 4, 15, 0, 132, 105, 110, 101, 115, 115, 0, 7, 4, 0, 131, 100,
+  114, 101, 115, 115, 0, 21, 6, 6, 4, 0, 132, 114, 111, 115, 115, 0, 70, 37, 27,
+  18, 46, 27, 22, 197, 27, 0, 17, 8, 6, 0, 130, 115, 117, 115, 0, 72, 62, 27,
+  10, 77, 27, 12, 89, 27, 16, 153, 27, 21, 166, 27, 0, 17, 12, 10, 12, 7, 17,
+  12, 0, 133, 101, 110, 111, 117, 115, 0, 4, 21, 23, 24, 18, 0, 130, 101, 111,
+  117, 115, 0, 70, 102, 27, 21, 114, 27, 22, 131, 27, 23, 141, 27, 0, 17, 18, 6,
+  0, 132, 115, 99, 105, 111, 117, 115, 0, 8, 23, 22, 12, 16, 0, 136, 121, 115,
+  116, 101, 114, 105, 111, 117, 115, 0, 12, 25, 0, 132, 99, 105, 111, 117, 115,
+  0, 12, 24, 23, 4, 21, 10, 0, 131, 111, 117, 115, 0, 28, 17, 4, 17, 24, 0, 132,
+  105, 109, 111, 117, 115, 0, 8, 0, 80, 175, 27, 23, 185, 27, 0, 24, 11, 0, 132,
+  111, 114, 111, 117, 115, 0, 22, 4, 22, 12, 7, 0, 132, 114, 111, 117, 115, 0,
+  17, 8, 6, 17, 18, 6, 0, 133, 115, 101, 110, 115, 117, 115, 0, 70, 243, 27, 8,
+  20, 28, 10, 82, 28, 11, 92, 28, 12, 157, 28, 15, 209, 28, 17, 240, 28, 19,
+  221, 30, 22, 248, 30, 24, 45, 31, 0, 68, 250, 27, 8, 3, 28, 0, 6, 27, 8, 0,
+  131, 97, 99, 116, 0, 17, 17, 18, 6, 12, 7, 0, 134, 115, 99, 111, 110, 110,
+  101, 99, 116, 0, 68, 36, 28, 12, 44, 28, 15, 51, 28, 17, 62, 28, 18, 75, 28,
+  0, 21, 10, 0, 130, 101, 97, 116, 0, 21, 26, 0, 129, 116, 101, 0, 19, 16, 4,
+  19, 0, 130, 104, 108, 101, 116, 0, 16, 17, 21, 8, 25, 18, 10, 0, 130, 101,
+  110, 116, 0, 21, 26, 0, 129, 116, 101, 0, 11, 24, 4, 6, 0, 130, 103, 104, 116,
+  0, 71, 102, 28, 10, 109, 28, 12, 146, 28, 0, 12, 26, 0, 129, 116, 104, 0, 72,
+  119, 28, 17, 129, 28, 24, 136, 28, 0, 12, 11, 0, 132, 101, 105, 103, 104, 116,
+  0, 8, 15, 0, 129, 116, 104, 0, 4, 22, 0, 132, 111, 117, 103, 104, 116, 0, 10,
+  17, 18, 23, 0, 131, 105, 103, 104, 116, 0, 72, 167, 28, 23, 186, 28, 24, 196,
+  28, 0, 11, 17, 8, 21, 4, 9, 0, 136, 70, 97, 104, 114, 101, 110, 104, 101, 105,
+  116, 0, 24, 18, 5, 4, 0, 129, 32, 105, 116, 0, 6, 21, 24, 6, 0, 133, 105, 114,
+  99, 117, 105, 116, 0, 86, 216, 28, 24, 226, 28, 0, 24, 8, 21, 0, 131, 115,
+  117, 108, 116, 0, 6, 12, 9, 12, 7, 0, 132, 102, 105, 99, 117, 108, 116, 0, 68,
+  253, 28, 8, 45, 29, 21, 195, 30, 24, 206, 30, 0, 71, 4, 29, 21, 17, 29, 0, 17,
+  8, 19, 8, 7, 17, 12, 0, 130, 101, 110, 116, 0, 4, 0, 83, 26, 29, 23, 34, 29,
+  0, 19, 4, 0, 130, 101, 110, 116, 0, 22, 8, 21, 0, 131, 117, 114, 97, 110, 116,
+  0, 70, 70, 29, 10, 81, 29, 12, 96, 29, 15, 110, 29, 16, 140, 29, 21, 63, 30,
+  23, 153, 30, 25, 185, 30, 0, 12, 9, 9, 8, 0, 130, 105, 101, 110, 116, 0, 12,
+  15, 8, 23, 17, 12, 0, 132, 108, 105, 103, 101, 110, 116, 0, 6, 8, 9, 9, 8, 0,
+  133, 105, 99, 105, 101, 110, 116, 0, 72, 117, 29, 15, 127, 29, 0, 6, 27, 8, 0,
+  130, 108, 101, 110, 116, 0, 8, 27, 8, 0, 133, 99, 101, 108, 108, 101, 110,
+  116, 0, 72, 165, 29, 10, 214, 29, 12, 226, 29, 15, 0, 30, 17, 12, 30, 18, 25,
+  30, 21, 38, 30, 25, 50, 30, 0, 70, 175, 29, 24, 193, 29, 25, 203, 29, 0, 17,
+  4, 11, 6, 17, 8, 0, 137, 104, 97, 110, 99, 101, 109, 101, 110, 116, 0, 10, 21,
+  4, 0, 132, 109, 101, 110, 116, 0, 18, 10, 0, 131, 114, 110, 109, 101, 110,
+  116, 0, 4, 17, 4, 16, 0, 131, 101, 109, 101, 110, 116, 0, 72, 233, 29, 15,
+  245, 29, 0, 19, 27, 8, 0, 132, 114, 105, 109, 101, 110, 116, 0, 19, 16, 12, 0,
+  132, 101, 109, 101, 110, 116, 0, 23, 23, 8, 22, 0, 131, 101, 109, 101, 110,
+  116, 0, 8, 25, 18, 10, 0, 132, 114, 110, 109, 101, 110, 116, 0, 21, 12, 25,
+  17, 8, 0, 131, 110, 109, 101, 110, 116, 0, 8, 25, 18, 10, 0, 131, 110, 109,
+  101, 110, 116, 0, 18, 21, 19, 16, 12, 0, 131, 101, 109, 101, 110, 116, 0, 68,
+  76, 30, 8, 87, 30, 9, 99, 30, 21, 110, 30, 0, 19, 4, 0, 132, 112, 97, 114,
+  101, 110, 116, 0, 9, 12, 7, 0, 132, 102, 101, 114, 101, 110, 116, 0, 9, 12, 7,
+  0, 131, 101, 114, 101, 110, 116, 0, 68, 117, 30, 8, 141, 30, 0, 19, 0, 68,
+  126, 30, 19, 134, 30, 0, 133, 112, 97, 114, 101, 110, 116, 0, 4, 0, 131, 101,
+  110, 116, 0, 9, 12, 7, 0, 133, 102, 101, 114, 101, 110, 116, 0, 72, 160, 30,
+  12, 175, 30, 0, 23, 19, 16, 18, 6, 17, 12, 0, 133, 101, 116, 101, 110, 116, 0,
+  21, 23, 24, 17, 0, 131, 101, 110, 116, 0, 8, 15, 8, 21, 0, 130, 97, 110, 116,
+  0, 8, 9, 9, 12, 7, 0, 129, 101, 110, 116, 0, 4, 21, 4, 23, 22, 8, 21, 0, 132,
+  117, 114, 97, 110, 116, 0, 80, 228, 30, 21, 238, 30, 0, 4, 27, 8, 0, 131, 101,
+  109, 112, 116, 0, 12, 6, 22, 0, 131, 114, 105, 112, 116, 0, 72, 255, 30, 12,
+  10, 31, 0, 12, 11, 23, 4, 0, 131, 101, 105, 115, 116, 0, 70, 17, 31, 17, 27,
+  31, 0, 4, 9, 0, 131, 115, 99, 105, 115, 116, 0, 28, 10, 18, 22, 28, 16, 0,
+  136, 105, 115, 111, 103, 121, 110, 105, 115, 116, 0, 70, 61, 31, 18, 69, 31,
+  19, 112, 31, 22, 135, 31, 23, 142, 31, 0, 21, 12, 6, 0, 128, 105, 116, 0, 68,
+  79, 31, 5, 88, 31, 11, 96, 31, 0, 5, 0, 132, 97, 98, 111, 117, 116, 0, 5, 4,
+  0, 131, 111, 117, 116, 0, 10, 24, 18, 11, 23, 0, 134, 114, 111, 117, 103, 104,
+  111, 117, 116, 0, 87, 119, 31, 24, 127, 31, 0, 17, 12, 0, 131, 112, 117, 116,
+  0, 18, 0, 130, 116, 112, 117, 116, 0, 13, 0, 130, 117, 115, 116, 0, 19, 24,
+  18, 0, 131, 116, 112, 117, 116, 0, 23, 18, 5, 4, 0, 129, 117, 116, 0, 8, 18,
+  15, 44, 0, 129, 118, 101, 0, 18, 0, 78, 179, 31, 21, 188, 31, 0, 17, 44, 0,
+  131, 107, 110, 111, 119, 0, 82, 195, 31, 21, 207, 31, 0, 16, 16, 18, 23, 0,
+  132, 111, 114, 114, 111, 119, 0, 18, 16, 16, 18, 23, 0, 133, 111, 114, 114,
+  111, 119, 0, 70, 1, 32, 7, 102, 32, 8, 117, 32, 9, 148, 32, 11, 159, 32, 15,
+  170, 32, 16, 169, 35, 17, 183, 35, 19, 224, 35, 21, 237, 35, 22, 233, 36, 23,
+  251, 36, 0, 72, 14, 32, 17, 25, 32, 19, 74, 32, 23, 86, 32, 0, 24, 20, 8, 21,
+  9, 0, 129, 110, 99, 121, 0, 68, 32, 32, 8, 61, 32, 0, 71, 39, 32, 16, 51, 32,
+  0, 17, 8, 19, 8, 7, 0, 131, 101, 110, 99, 121, 0, 18, 15, 19, 12, 7, 0, 130,
+  99, 121, 0, 6, 12, 9, 9, 8, 0, 131, 105, 101, 110, 99, 121, 0, 24, 21, 14, 17,
+  4, 5, 0, 129, 116, 99, 121, 0, 19, 24, 21, 17, 4, 5, 0, 133, 107, 114, 117,
+  112, 116, 99, 121, 0, 21, 4, 19, 4, 8, 13, 0, 133, 111, 112, 97, 114, 100,
+  121, 0, 79, 124, 32, 17, 138, 32, 0, 23, 4, 12, 7, 8, 16, 16, 12, 0, 130, 101,
+  108, 121, 0, 24, 18, 13, 0, 130, 114, 110, 101, 121, 0, 12, 24, 20, 12, 15, 0,
+  130, 101, 102, 121, 0, 23, 4, 8, 11, 0, 130, 108, 116, 104, 121, 0, 68, 204,
+  32, 5, 65, 33, 6, 161, 33, 7, 172, 33, 8, 205, 33, 12, 13, 34, 15, 90, 34, 16,
+  3, 35, 17, 14, 35, 21, 25, 35, 23, 56, 35, 0, 70, 220, 32, 12, 229, 32, 21,
+  255, 32, 23, 8, 33, 24, 20, 33, 0, 12, 22, 4, 5, 0, 128, 108, 121, 0, 70, 236,
+  32, 23, 245, 32, 0, 8, 19, 22, 8, 0, 128, 108, 121, 0, 17, 8, 22, 22, 8, 0,
+  128, 108, 121, 0, 24, 23, 4, 17, 0, 128, 108, 121, 0, 17, 8, 7, 12, 6, 6, 4,
+  0, 128, 108, 121, 0, 81, 30, 33, 22, 37, 33, 23, 43, 33, 0, 17, 4, 0, 128,
+  108, 121, 0, 24, 0, 128, 108, 121, 0, 81, 50, 33, 21, 58, 33, 0, 8, 25, 8, 0,
+  128, 108, 121, 0, 12, 25, 0, 128, 108, 121, 0, 68, 72, 33, 12, 141, 33, 0, 70,
+  82, 33, 22, 94, 33, 23, 103, 33, 0, 12, 23, 18, 17, 0, 131, 101, 97, 98, 108,
+  121, 0, 12, 25, 0, 131, 105, 98, 108, 121, 0, 76, 110, 33, 22, 123, 33, 0, 23,
+  12, 25, 8, 17, 12, 0, 133, 97, 98, 108, 121, 0, 12, 22, 8, 21, 12, 0, 136,
+  114, 101, 115, 105, 115, 116, 105, 98, 108, 121, 0, 23, 22, 12, 22, 8, 21, 12,
+  0, 136, 114, 101, 115, 105, 115, 116, 105, 98, 108, 121, 0, 12, 22, 4, 5, 0,
+  129, 97, 108, 108, 121, 0, 8, 0, 86, 181, 33, 23, 191, 33, 0, 18, 19, 21, 24,
+  19, 0, 130, 108, 121, 0, 18, 19, 21, 24, 19, 0, 132, 114, 116, 101, 100, 108,
+  121, 0, 80, 215, 33, 23, 227, 33, 24, 6, 34, 0, 12, 23, 15, 24, 0, 130, 97,
+  116, 101, 108, 121, 0, 68, 234, 33, 5, 251, 33, 0, 12, 7, 8, 16, 12, 0, 135,
+  109, 101, 100, 105, 97, 116, 101, 108, 121, 0, 24, 18, 7, 17, 24, 0, 129, 100,
+  108, 121, 0, 21, 23, 0, 130, 108, 121, 0, 21, 4, 0, 79, 23, 34, 22, 35, 34, 0,
+  24, 6, 12, 23, 21, 4, 19, 0, 130, 108, 121, 0, 72, 42, 34, 22, 74, 34, 0, 6,
+  0, 70, 51, 34, 8, 64, 34, 0, 8, 17, 0, 135, 101, 115, 115, 97, 114, 105, 108,
+  121, 0, 17, 0, 132, 115, 97, 114, 105, 108, 121, 0, 8, 6, 6, 8, 17, 0, 136,
+  101, 115, 115, 97, 114, 105, 108, 121, 0, 68, 97, 34, 8, 249, 34, 0, 70, 113,
+  34, 12, 123, 34, 22, 154, 34, 23, 164, 34, 24, 218, 34, 0, 12, 15, 5, 24, 19,
+  0, 131, 108, 121, 0, 23, 17, 8, 0, 71, 134, 34, 25, 145, 34, 0, 12, 6, 17, 12,
+  0, 132, 97, 108, 108, 121, 0, 8, 0, 132, 117, 97, 108, 108, 121, 0, 24, 22,
+  24, 0, 132, 97, 108, 108, 121, 0, 81, 171, 34, 24, 206, 34, 0, 8, 0, 80, 180,
+  34, 25, 197, 34, 0, 4, 21, 6, 17, 12, 0, 136, 101, 109, 101, 110, 116, 97,
+  108, 108, 121, 0, 8, 0, 131, 117, 97, 108, 108, 121, 0, 21, 12, 25, 0, 133,
+  116, 117, 97, 108, 108, 121, 0, 70, 225, 34, 17, 238, 34, 0, 12, 23, 21, 4,
+  19, 0, 131, 108, 97, 114, 108, 121, 0, 4, 44, 0, 132, 110, 117, 97, 108, 108,
+  121, 0, 4, 21, 0, 132, 101, 97, 108, 108, 121, 0, 8, 21, 23, 27, 8, 0, 129,
+  101, 108, 121, 0, 8, 21, 21, 24, 6, 0, 129, 116, 108, 121, 0, 4, 0, 72, 34,
+  35, 24, 42, 35, 0, 8, 0, 132, 97, 114, 108, 121, 0, 6, 12, 23, 21, 4, 19, 0,
+  131, 108, 97, 114, 108, 121, 0, 68, 72, 35, 8, 102, 35, 12, 115, 35, 17, 126,
+  35, 24, 158, 35, 0, 76, 79, 35, 17, 90, 35, 0, 7, 8, 16, 16, 12, 0, 129, 101,
+  108, 121, 0, 12, 9, 8, 7, 0, 131, 105, 116, 101, 108, 121, 0, 17, 12, 9, 8, 7,
+  0, 131, 105, 116, 101, 108, 121, 0, 17, 12, 9, 8, 7, 0, 129, 101, 108, 121, 0,
+  68, 133, 35, 8, 146, 35, 0, 21, 8, 11, 17, 12, 0, 132, 101, 110, 116, 108,
+  121, 0, 7, 12, 6, 17, 12, 0, 129, 97, 108, 108, 121, 0, 15, 18, 22, 5, 4, 0,
+  129, 101, 108, 121, 0, 18, 23, 11, 6, 12, 7, 0, 131, 111, 116, 111, 109, 121,
+  0, 68, 193, 35, 8, 201, 35, 28, 209, 35, 0, 21, 28, 23, 0, 128, 110, 121, 0,
+  18, 16, 0, 130, 110, 101, 121, 0, 10, 18, 22, 28, 16, 0, 134, 105, 115, 111,
+  103, 121, 110, 121, 0, 19, 11, 4, 17, 24, 0, 132, 104, 97, 112, 112, 121, 0,
+  68, 253, 35, 7, 130, 36, 8, 140, 36, 18, 186, 36, 23, 219, 36, 0, 69, 13, 36,
+  15, 22, 36, 17, 34, 36, 22, 47, 36, 24, 117, 36, 0, 12, 15, 0, 130, 114, 97,
+  114, 121, 0, 24, 6, 12, 23, 21, 4, 19, 0, 128, 108, 121, 0, 8, 10, 4, 16, 12,
+  0, 132, 105, 110, 97, 114, 121, 0, 72, 54, 36, 22, 82, 36, 0, 6, 0, 70, 63,
+  36, 8, 74, 36, 0, 8, 17, 0, 133, 101, 115, 115, 97, 114, 121, 0, 17, 0, 130,
+  115, 97, 114, 121, 0, 8, 6, 0, 70, 92, 36, 8, 103, 36, 0, 8, 17, 0, 134, 101,
+  115, 115, 97, 114, 121, 0, 17, 24, 0, 135, 110, 101, 99, 101, 115, 115, 97,
+  114, 121, 0, 22, 12, 7, 24, 13, 0, 132, 99, 105, 97, 114, 121, 0, 17, 24, 18,
+  5, 0, 129, 97, 114, 121, 0, 79, 150, 36, 22, 163, 36, 23, 174, 36, 0, 15, 26,
+  8, 13, 0, 132, 101, 108, 108, 101, 114, 121, 0, 22, 8, 6, 8, 17, 0, 130, 97,
+  114, 121, 0, 22, 12, 16, 0, 133, 121, 115, 116, 101, 114, 121, 0, 74, 193, 36,
+  23, 205, 36, 0, 4, 23, 4, 6, 0, 132, 101, 103, 111, 114, 121, 0, 12, 10, 18,
+  21, 8, 7, 0, 132, 97, 116, 111, 114, 121, 0, 22, 8, 16, 8, 11, 6, 0, 132, 105,
+  115, 116, 114, 121, 0, 21, 8, 25, 4, 21, 23, 17, 18, 6, 0, 133, 111, 118, 101,
+  114, 115, 121, 0, 68, 14, 37, 8, 25, 37, 12, 40, 37, 15, 73, 37, 18, 82, 37,
+  21, 93, 37, 0, 23, 17, 4, 24, 20, 0, 130, 105, 116, 121, 0, 12, 21, 8, 23, 18,
+  17, 0, 133, 111, 114, 105, 101, 116, 121, 0, 79, 47, 37, 21, 59, 37, 0, 24, 6,
+  12, 9, 9, 12, 7, 0, 130, 116, 121, 0, 18, 13, 21, 4, 16, 0, 134, 106, 111,
+  114, 105, 116, 121, 0, 12, 5, 4, 0, 129, 105, 116, 121, 0, 23, 6, 8, 21, 12,
+  7, 0, 129, 114, 121, 0, 24, 18, 9, 0, 131, 114, 116, 121, 0};
 
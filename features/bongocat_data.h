@@ -0,0 +1,128 @@
+/* Generated OLED frames (14 entries):
+   idle0       RLE   143 bytes
+   idle1       DELTA  24 bytes
+   idle2       DELTA  29 bytes
+   idle3       DELTA  87 bytes
+   paws        DELTA  85 bytes
+   tap0        DELTA 108 bytes
+   tap1        DELTA  75 bytes
+   left_idle0  RLE   141 bytes
+   left_idle1  DELTA  24 bytes
+   left_idle2  DELTA  29 bytes
+   left_idle3  DELTA  87 bytes
+   left_paws   DELTA  85 bytes
+   left_tap0   DELTA 108 bytes
+   left_tap1   DELTA  75 bytes
+*/
+
+#define OLED_FRAME_RAW   0
+#define OLED_FRAME_RLE   1
+#define OLED_FRAME_LZ    2
+#define OLED_FRAME_DELTA 3
+#define OLED_FRAME_RLE2  4
+#define OLED_FRAME_SIZE  512  // 128x32
+
+static unsigned char const idle0[] PROGMEM = {0x01, 0x8e, 0x3a, 0x00, 0x83,
+    0x80, 0x40, 0x40, 0x04, 0x20, 0x05, 0x10, 0x02, 0x08, 0x03, 0x04, 0x84,
+    0x08, 0x30, 0x40, 0x80, 0x2e, 0x00, 0x03, 0x80, 0x31, 0x00, 0x83, 0x18,
+    0x64, 0x82, 0x05, 0x02, 0x81, 0x01, 0x04, 0x00, 0x02, 0x80, 0x09, 0x00,
+    0x8f, 0x80, 0x00, 0x30, 0x30, 0x00, 0xc0, 0xc1, 0xc1, 0xc2, 0x04, 0x08,
+    0x10, 0x20, 0x40, 0x80, 0x03, 0x00, 0x04, 0x80, 0x04, 0x40, 0x04, 0x20,
+    0x04, 0x10, 0x05, 0x08, 0x05, 0x04, 0x04, 0x02, 0x04, 0x01, 0x33, 0x00,
+    0x84, 0xc0, 0x38, 0x04, 0x03, 0x07, 0x00, 0x03, 0x0c, 0x88, 0x0d, 0x01,
+    0x00, 0x40, 0xa0, 0x21, 0x22, 0x12, 0x03, 0x11, 0x81, 0x09, 0x04, 0x08,
+    0x02, 0x04, 0x02, 0x08, 0x05, 0x10, 0x84, 0x11, 0x0f, 0x01, 0x01, 0x36,
+    0x00, 0x05, 0x80, 0x05, 0x40, 0x05, 0x20, 0x05, 0x10, 0x05, 0x08, 0x05,
+    0x04, 0x84, 0x02, 0x03, 0x02, 0x02, 0x06, 0x01, 0x02, 0x02, 0x02, 0x04,
+    0x05, 0x08, 0x81, 0x07, 0x3d, 0x00};
+static unsigned char const idle1[] PROGMEM = {0x03, 0x45, 0x08, 0x18, 0x00,
+    0x0c, 0x06, 0x06, 0x06, 0x0c, 0x08, 0x64, 0x04, 0x04, 0x86, 0x83, 0x03,
+    0x7b, 0x03, 0x40, 0x48, 0x08, 0x00, 0x00};
+static unsigned char const idle2[] PROGMEM = {0x03, 0x33, 0x02, 0x80, 0x80,
+    0x10, 0x07, 0x18, 0x0c, 0x0a, 0x05, 0x05, 0x06, 0x04, 0x65, 0x06, 0x06,
+    0x85, 0x82, 0x02, 0x03, 0x03, 0x79, 0x03, 0x40, 0x48, 0x08, 0x00, 0x00};
+static unsigned char const idle3[] PROGMEM = {0x03, 0x3a, 0x15, 0x80, 0xc0,
+    0xc0, 0x60, 0x60, 0x60, 0x60, 0x30, 0x30, 0x30, 0x30, 0x00, 0x00, 0x0c,
+    0x06, 0x06, 0x00, 0x10, 0x50, 0xc0, 0x80, 0x62, 0x0a, 0x24, 0xa6, 0x83,
+    0x03, 0x00, 0x00, 0x06, 0x06, 0x03, 0x01, 0x03, 0x02, 0x80, 0x80, 0x09,
+    0x0f, 0x80, 0x00, 0x50, 0x50, 0x00, 0x41, 0x43, 0x43, 0x46, 0x0c, 0x18,
+    0x30, 0x60, 0xc0, 0x80, 0x58, 0x04, 0x40, 0x48, 0x1d, 0x05, 0x07, 0x05,
+    0x14, 0x14, 0x14, 0x16, 0x02, 0x03, 0x07, 0x03, 0x06, 0x06, 0x03, 0x03,
+    0x03, 0x02, 0x04, 0x04, 0x01, 0x01, 0x01, 0x01, 0x00, 0x00};
+static unsigned char const paws[] PROGMEM = {0x03, 0x33, 0x02, 0x80, 0x80, 0x10,
+    0x07, 0x18, 0x0c, 0x0a, 0x05, 0x05, 0x06, 0x04, 0x65, 0x0b, 0x06, 0x85,
+    0x82, 0x02, 0x03, 0x03, 0x00, 0x00, 0x80, 0x80, 0x80, 0x12, 0x0b, 0xc0,
+    0xc0, 0x20, 0xd8, 0x02, 0x01, 0x21, 0x15, 0x41, 0x0a, 0x7c, 0x57, 0x03,
+    0x40, 0x48, 0x08, 0x03, 0x0d, 0x18, 0x06, 0x05, 0x98, 0x99, 0x88, 0xcf,
+    0x70, 0x4c, 0x40, 0x40, 0x00, 0x80, 0x0d, 0x09, 0x0c, 0x0c, 0x14, 0x14,
+    0x12, 0x12, 0x12, 0x10, 0x0e, 0x60, 0x0a, 0x02, 0x02, 0x04, 0x04, 0x08,
+    0x08, 0x08, 0x08, 0x08, 0x07, 0x00, 0x00};
+static unsigned char const tap0[] PROGMEM = {0x03, 0x33, 0x02, 0x80, 0x80, 0x10,
+    0x07, 0x18, 0x0c, 0x0a, 0x05, 0x05, 0x06, 0x04, 0x0a, 0x04, 0xf8, 0xf8,
+    0xf8, 0xf8, 0x05, 0x02, 0x80, 0x80, 0x50, 0x0b, 0x06, 0x85, 0x82, 0x02,
+    0x03, 0x03, 0x00, 0x00, 0x80, 0x80, 0x80, 0x12, 0x04, 0xc0, 0xc0, 0xc0,
+    0xc0, 0x04, 0x0d, 0x03, 0x07, 0x07, 0x01, 0x00, 0x38, 0x3c, 0x3e, 0x1f,
+    0x1f, 0x1f, 0x0f, 0x0c, 0x4d, 0x03, 0x40, 0x48, 0x08, 0x03, 0x0d, 0x18,
+    0x06, 0x05, 0x98, 0x99, 0x88, 0x4f, 0x70, 0x4c, 0x40, 0x40, 0x00, 0x80,
+    0x17, 0x09, 0x3c, 0x7c, 0xfc, 0xfc, 0xfc, 0xfc, 0xfc, 0x3c, 0x0c, 0x56,
+    0x0a, 0x02, 0x02, 0x04, 0x04, 0x08, 0x08, 0x08, 0x08, 0x08, 0x07, 0x1a,
+    0x03, 0x01, 0x03, 0x03, 0x00, 0x00};
+static unsigned char const tap1[] PROGMEM = {0x03, 0x33, 0x02, 0x80, 0x80, 0x10,
+    0x07, 0x18, 0x0c, 0x0a, 0x05, 0x05, 0x06, 0x04, 0x65, 0x06, 0x06, 0x85,
+    0x82, 0x02, 0x03, 0x03, 0x17, 0x0b, 0xc0, 0xc0, 0x20, 0xd8, 0x02, 0x01,
+    0x21, 0x15, 0x41, 0x0a, 0x7c, 0x57, 0x03, 0x40, 0x48, 0x08, 0x08, 0x04,
+    0x0c, 0x0c, 0x0c, 0x0c, 0x11, 0x09, 0x0c, 0x0c, 0x14, 0x14, 0x12, 0x12,
+    0x12, 0x10, 0x0e, 0x58, 0x08, 0x78, 0x78, 0x78, 0x78, 0x78, 0x78, 0x38,
+    0x30, 0x07, 0x04, 0x80, 0x80, 0x80, 0x80, 0x00, 0x00};
+static unsigned char const left_idle0[] PROGMEM = {0x01, 0x8c, 0x03, 0x80, 0x2e,
+    0x00, 0x84, 0x80, 0x40, 0x30, 0x08, 0x03, 0x04, 0x02, 0x08, 0x05, 0x10,
+    0x04, 0x20, 0x02, 0x40, 0x81, 0x80, 0x3d, 0x00, 0x04, 0x01, 0x04, 0x02,
+    0x05, 0x04, 0x05, 0x08, 0x04, 0x10, 0x04, 0x20, 0x04, 0x40, 0x04, 0x80,
+    0x03, 0x00, 0x8f, 0x80, 0x40, 0x20, 0x10, 0x08, 0x04, 0xc2, 0xc1, 0xc1,
+    0xc0, 0x00, 0x30, 0x30, 0x00, 0x80, 0x09, 0x00, 0x02, 0x80, 0x04, 0x00,
+    0x81, 0x01, 0x05, 0x02, 0x83, 0x82, 0x64, 0x18, 0x56, 0x00, 0x02, 0x01,
+    0x82, 0x0f, 0x11, 0x05, 0x10, 0x02, 0x08, 0x02, 0x04, 0x04, 0x08, 0x81,
+    0x09, 0x03, 0x11, 0x88, 0x12, 0x22, 0x21, 0xa0, 0x40, 0x00, 0x01, 0x0d,
+    0x03, 0x0c, 0x07, 0x00, 0x84, 0x03, 0x04, 0x38, 0xc0, 0x6d, 0x00, 0x81,
+    0x07, 0x05, 0x08, 0x02, 0x04, 0x02, 0x02, 0x06, 0x01, 0x02, 0x02, 0x82,
+    0x03, 0x02, 0x05, 0x04, 0x05, 0x08, 0x05, 0x10, 0x05, 0x20, 0x05, 0x40,
+    0x05, 0x80, 0x11, 0x00};
+static unsigned char const left_idle1[] PROGMEM = {0x03, 0x33, 0x08, 0x08, 0x0c,
+    0x06, 0x06, 0x06, 0x0c, 0x00, 0x18, 0x90, 0x04, 0x03, 0x83, 0x86, 0x04,
+    0x7e, 0x03, 0x08, 0x48, 0x40, 0x00, 0x00};
+static unsigned char const left_idle2[] PROGMEM = {0x03, 0x34, 0x07, 0x04, 0x06,
+    0x05, 0x05, 0x0a, 0x0c, 0x18, 0x10, 0x02, 0x80, 0x80, 0x7c, 0x06, 0x03,
+    0x03, 0x02, 0x82, 0x85, 0x06, 0x7e, 0x03, 0x08, 0x48, 0x40, 0x00, 0x00};
+static unsigned char const left_idle3[] PROGMEM = {0x03, 0x31, 0x15, 0x80, 0xc0,
+    0x50, 0x10, 0x00, 0x06, 0x06, 0x0c, 0x00, 0x00, 0x30, 0x30, 0x30, 0x30,
+    0x60, 0x60, 0x60, 0x60, 0xc0, 0xc0, 0x80, 0x62, 0x0f, 0x80, 0xc0, 0x60,
+    0x30, 0x18, 0x0c, 0x46, 0x43, 0x43, 0x41, 0x00, 0x50, 0x50, 0x00, 0x80,
+    0x09, 0x02, 0x80, 0x80, 0x03, 0x0a, 0x01, 0x03, 0x06, 0x06, 0x00, 0x00,
+    0x03, 0x83, 0xa6, 0x24, 0x5f, 0x04, 0x01, 0x01, 0x01, 0x01, 0x04, 0x07,
+    0x02, 0x03, 0x03, 0x03, 0x06, 0x06, 0x03, 0x03, 0x05, 0x02, 0x16, 0x14,
+    0x14, 0x14, 0x07, 0x04, 0x05, 0x1d, 0x48, 0x40, 0x00, 0x00};
+static unsigned char const left_paws[] PROGMEM = {0x03, 0x34, 0x07, 0x04, 0x06,
+    0x05, 0x05, 0x0a, 0x0c, 0x18, 0x10, 0x02, 0x80, 0x80, 0x5a, 0x0b, 0x7c,
+    0x0a, 0x41, 0x15, 0x21, 0x01, 0x02, 0xd8, 0x20, 0xc0, 0xc0, 0x12, 0x0b,
+    0x80, 0x80, 0x80, 0x00, 0x00, 0x03, 0x03, 0x02, 0x82, 0x85, 0x06, 0x58,
+    0x09, 0x0e, 0x10, 0x12, 0x12, 0x12, 0x14, 0x14, 0x0c, 0x0c, 0x0d, 0x0d,
+    0x80, 0x00, 0x40, 0x40, 0x4c, 0x70, 0xcf, 0x88, 0x99, 0x98, 0x05, 0x06,
+    0x18, 0x03, 0x03, 0x08, 0x48, 0x40, 0x6d, 0x0a, 0x07, 0x08, 0x08, 0x08,
+    0x08, 0x08, 0x04, 0x04, 0x02, 0x02, 0x00, 0x00};
+static unsigned char const left_tap0[] PROGMEM = {0x03, 0x1f, 0x02, 0x80, 0x80,
+    0x05, 0x04, 0xf8, 0xf8, 0xf8, 0xf8, 0x0a, 0x07, 0x04, 0x06, 0x05, 0x05,
+    0x0a, 0x0c, 0x18, 0x10, 0x02, 0x80, 0x80, 0x50, 0x0d, 0x0c, 0x0f, 0x1f,
+    0x1f, 0x1f, 0x3e, 0x3c, 0x38, 0x00, 0x01, 0x07, 0x07, 0x03, 0x04, 0x04,
+    0xc0, 0xc0, 0xc0, 0xc0, 0x12, 0x0b, 0x80, 0x80, 0x80, 0x00, 0x00, 0x03,
+    0x03, 0x02, 0x82, 0x85, 0x06, 0x4e, 0x09, 0x0c, 0x3c, 0xfc, 0xfc, 0xfc,
+    0xfc, 0xfc, 0x7c, 0x3c, 0x17, 0x0d, 0x80, 0x00, 0x40, 0x40, 0x4c, 0x70,
+    0x4f, 0x88, 0x99, 0x98, 0x05, 0x06, 0x18, 0x03, 0x03, 0x08, 0x48, 0x40,
+    0x50, 0x03, 0x03, 0x03, 0x01, 0x1a, 0x0a, 0x07, 0x08, 0x08, 0x08, 0x08,
+    0x08, 0x04, 0x04, 0x02, 0x02, 0x00, 0x00};
+static unsigned char const left_tap1[] PROGMEM = {0x03, 0x34, 0x07, 0x04, 0x06,
+    0x05, 0x05, 0x0a, 0x0c, 0x18, 0x10, 0x02, 0x80, 0x80, 0x5a, 0x0b, 0x7c,
+    0x0a, 0x41, 0x15, 0x21, 0x01, 0x02, 0xd8, 0x20, 0xc0, 0xc0, 0x17, 0x06,
+    0x03, 0x03, 0x02, 0x82, 0x85, 0x06, 0x58, 0x09, 0x0e, 0x10, 0x12, 0x12,
+    0x12, 0x14, 0x14, 0x0c, 0x0c, 0x11, 0x04, 0x0c, 0x0c, 0x0c, 0x0c, 0x08,
+    0x03, 0x08, 0x48, 0x40, 0x6c, 0x04, 0x80, 0x80, 0x80, 0x80, 0x07, 0x08,
+    0x30, 0x38, 0x78, 0x78, 0x78, 0x78, 0x78, 0x78, 0x00, 0x00};
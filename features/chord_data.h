@@ -0,0 +1,201 @@
+/* Generated chord code (128 entries):
+ab   -> about
+ad   -> and
+af   -> after
+al   -> all
+an   -> an
+ao   -> also
+as   -> as
+at   -> at
+ay   -> any
+bcs  -> because
+be   -> be
+bk   -> back
+bt   -> between
+bu   -> but
+by   -> by
+cd   -> could
+cm   -> come
+cn   -> can
+dif  -> different
+do   -> do
+dy   -> day
+ev   -> even
+ex   -> example
+fm   -> from
+fr   -> for
+fs   -> first
+fw   -> following
+fx   -> function
+gd   -> good
+go   -> go
+gt   -> get
+gv   -> give
+he   -> he
+hm   -> him
+hr   -> her
+hs   -> his
+hv   -> have
+hw   -> how
+ib   -> I believe
+if   -> if
+ifm  -> information
+in   -> in
+io   -> into
+ip   -> important
+is   -> its
+it   -> it
+it'  -> it is
+js   -> just
+ke   -> keyboard
+kn   -> know
+lk   -> like
+ln   -> let me know
+lo   -> look
+me   -> me
+mk   -> make
+mst  -> most
+my   -> my
+n'   -> no
+nb   -> number
+ne   -> new
+now  -> now
+nt   -> not
+oe   -> one
+of   -> of
+oly  -> only
+on   -> on
+or   -> or
+or'  -> our
+otr  -> other
+ou   -> out
+ov   -> over
+pb   -> problem
+pe   -> people
+pls  -> please
+qe   -> question
+rtn  -> return
+sc   -> should
+se   -> she
+se'  -> see
+sm   -> some
+sme  -> something
+so   -> so
+sy   -> say
+tan  -> than
+tdy  -> today
+tem  -> them
+ten  -> then
+tes  -> these
+th   -> the
+tha  -> that
+thg  -> thing
+thr  -> their
+tik  -> think
+tk   -> take
+tm   -> time
+tmr  -> tomorrow
+to   -> to
+tr   -> there
+tru  -> through
+ts   -> this
+two  -> two
+tx   -> thanks
+ty   -> they
+u'   -> us
+uder -> under
+up   -> up
+us   -> use
+vl   -> value
+wa   -> want
+wc   -> which
+wd   -> would
+we   -> we
+wel  -> well
+whr  -> where
+wi   -> with
+wil  -> while
+wk   -> work
+wl   -> will
+wn   -> when
+wo   -> who
+wt   -> what
+wth  -> without
+wy   -> way
+yes  -> yes
+yo   -> you
+yr   -> year
+ysd  -> yesterday
+yu   -> your
+*/
+
+#define CHORD_COUNT       128
+#define CHORD_SLOT_BITS   8
+#define CHORD_BUCKET_BITS 6
+#define CHORD_SLOT_MULT   0xa7c5cb87u
+#define CHORD_BUCKET_MULT 0x7e969cf3u
+
+static const uint8_t chord_displace[64] PROGMEM = {2, 0, 0, 1, 0, 0, 0, 2, 2, 3,
+    0, 0, 0, 1, 0, 0, 1, 0, 0, 1, 0, 0, 0, 0, 0, 2, 1, 1, 0, 0, 0, 2, 0, 6, 1,
+    0, 0, 2, 2, 6, 0, 0, 0, 4, 0, 0, 0, 1, 0, 0, 1, 0, 1, 0, 0, 0, 0, 0, 0, 0,
+    4, 0, 0, 4};
+
+static const uint32_t chord_masks[256] PROGMEM = {0x0, 0x4008000, 0x108,
+    0x1000010, 0x0, 0x0, 0x0, 0x0, 0x0, 0x2002, 0x0, 0x0, 0x0, 0x200004, 0x0,
+    0x420, 0x1000200, 0x20010, 0x4000020, 0x880, 0x400800, 0x102, 0x8800, 0x0,
+    0x0, 0x0, 0x0, 0x0, 0x0, 0x40006, 0x1020000, 0x840, 0x1100, 0x820, 0x8008,
+    0x2000102, 0x2000400, 0x0, 0x1000004, 0x0, 0x2000014, 0x204, 0x202000,
+    0x80804, 0x0, 0x0, 0x0, 0x104c, 0x0, 0x400002, 0x82, 0x4000014, 0x804000,
+    0x8002, 0x28, 0x20004, 0x4100, 0x0, 0x0, 0x0, 0x2040000, 0x0, 0x401000, 0x0,
+    0x0, 0x0, 0x110, 0x0, 0xc00, 0x40400, 0x5, 0x0, 0x0, 0x22, 0x4000800, 0x814,
+    0x0, 0x80040, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x1020, 0x0, 0x0, 0x0, 0x0,
+    0x0, 0x0, 0x0, 0x2000002, 0x90, 0x0, 0x80108, 0x40082, 0x800004, 0x8010,
+    0x104, 0x0, 0x402, 0x0, 0x0, 0x1000080, 0x2080000, 0x0, 0x0, 0x0, 0x280,
+    0x0, 0x0, 0x0, 0x800a, 0x1400, 0x30, 0x0, 0x0, 0x0, 0x0, 0x8410, 0x1000040,
+    0x0, 0x240, 0x40002, 0x2100, 0x1000020, 0x118, 0x0, 0x0, 0x0, 0x8004, 0x0,
+    0x0, 0x1820, 0x0, 0x800100, 0x2000010, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+    0x410, 0x112, 0x0, 0x3000000, 0x0, 0x1400800, 0x4000010, 0x0, 0x0, 0x0, 0x0,
+    0x0, 0x2080, 0x1000400, 0x8018, 0x2000410, 0x0, 0x0, 0x0, 0x0, 0x0,
+    0x2020000, 0x180, 0x808000, 0x0, 0x58, 0x810, 0x2000004, 0x1002, 0x0,
+    0x8012, 0x0, 0x0, 0x4020000, 0x0, 0x0, 0x0, 0x140, 0x4002080, 0x80090, 0x18,
+    0x4000004, 0x0, 0x0, 0x0, 0x120, 0x0, 0x60000, 0x0, 0x0, 0x0, 0x0, 0x824,
+    0x4000810, 0x2000018, 0x804, 0x0, 0x12, 0x0, 0x0, 0x0, 0x5000, 0x2400,
+    0x2000100, 0x1030, 0x4002000, 0x0, 0xc010, 0x4000018, 0x0, 0x500, 0x0, 0x0,
+    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x2800, 0x20002,
+    0x40a00, 0x4000804, 0x60, 0x200010, 0x40120, 0x2400000, 0x6, 0x4010,
+    0x2000080, 0x840000, 0x0, 0x40100, 0x900, 0x0, 0x2008, 0x20090, 0x3080,
+    0x10800, 0x0, 0x0, 0x0, 0x4400000, 0x0, 0x0};
+
+static const uint16_t chord_words[256] PROGMEM = {0, 222, 106, 434, 0, 0, 0, 0,
+    0, 606, 0, 0, 0, 598, 0, 407, 481, 231, 117, 318, 498, 170, 74, 0, 0, 0, 0,
+    0, 0, 376, 338, 349, 59, 94, 98, 299, 109, 0, 4, 0, 294, 236, 616, 279, 0,
+    0, 0, 529, 0, 178, 44, 274, 417, 357, 248, 638, 184, 0, 0, 0, 663, 0, 268,
+    0, 0, 0, 7, 0, 52, 124, 489, 0, 0, 381, 263, 411, 0, 431, 0, 0, 0, 0, 0, 0,
+    0, 422, 0, 0, 0, 0, 0, 0, 0, 190, 30, 0, 361, 541, 385, 0, 120, 0, 394, 0,
+    0, 647, 214, 0, 0, 0, 452, 0, 0, 0, 535, 13, 86, 0, 0, 0, 0, 20, 70, 0, 154,
+    112, 10, 78, 283, 0, 0, 0, 49, 0, 0, 559, 0, 322, 37, 0, 0, 0, 0, 0, 0, 0,
+    62, 353, 0, 474, 0, 399, 209, 0, 0, 0, 0, 0, 161, 164, 140, 289, 0, 0, 0, 0,
+    0, 226, 243, 25, 0, 521, 65, 390, 128, 0, 547, 0, 0, 195, 0, 0, 0, 157, 462,
+    657, 134, 187, 0, 0, 0, 55, 0, 204, 0, 0, 0, 0, 555, 426, 625, 102, 0, 146,
+    0, 0, 0, 258, 343, 41, 569, 81, 0, 515, 575, 0, 333, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 370, 365, 584, 505, 253, 591, 308, 200, 91, 174, 17, 632, 0,
+    303, 151, 0, 33, 327, 442, 217, 0, 0, 0, 313, 0, 0};
+
+static const char chord_text[675] PROGMEM =
+    "the\0" "be\0" "to\0" "of\0" "and\0" "in\0" "that\0" "have\0" "it\0" "for\0"
+    "not\0" "on\0" "with\0" "he\0" "as\0" "you\0" "do\0" "at\0" "this\0" "but\0"
+    "his\0" "by\0" "from\0" "they\0" "we\0" "say\0" "her\0" "she\0" "or\0"
+    "an\0" "will\0" "my\0" "one\0" "all\0" "would\0" "there\0" "their\0"
+    "what\0" "so\0" "up\0" "out\0" "if\0" "about\0" "who\0" "get\0" "which\0"
+    "go\0" "me\0" "when\0" "make\0" "can\0" "like\0" "time\0" "no\0" "just\0"
+    "him\0" "know\0" "take\0" "people\0" "into\0" "year\0" "your\0" "good\0"
+    "some\0" "could\0" "them\0" "see\0" "other\0" "than\0" "then\0" "now\0"
+    "look\0" "only\0" "come\0" "its\0" "over\0" "think\0" "also\0" "back\0"
+    "after\0" "use\0" "two\0" "how\0" "our\0" "work\0" "first\0" "well\0"
+    "way\0" "even\0" "new\0" "want\0" "because\0" "any\0" "these\0" "give\0"
+    "day\0" "most\0" "us\0" "between\0" "different\0" "important\0"
+    "information\0" "number\0" "problem\0" "question\0" "should\0" "something\0"
+    "thing\0" "through\0" "under\0" "where\0" "while\0" "without\0" "yes\0"
+    "yesterday\0" "today\0" "tomorrow\0" "please\0" "thanks\0" "example\0"
+    "following\0" "function\0" "return\0" "value\0" "keyboard\0" "I believe\0"
+    "it is\0" "let me know\0";
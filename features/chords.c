@@ -0,0 +1,100 @@
+// Copyright @filterpaper
+// SPDX-License-Identifier: GPL-2.0+
+
+/*
+Chorded word entry. Keys pressed together send a word from chord_data.h,
+which make_chord_data.py generates from chords.txt. Chords are keyed by the
+bitmask of their key positions in the CMB layer and resolved on the first
+release with a perfect hash, so the lookup cost does not grow with the
+number of chords. Keys that do not form a chord are typed in press order.
+Chord mode holds every key until its release, so home row mods do not work
+while it is on.
+*/
+
+#include QMK_KEYBOARD_H
+
+#include "chords.h"
+#include "chord_data.h"
+
+// Alpha positions of the 3x5_2 layout, thumbs are not chorded
+#define CHORD_KEYS  30
+// Tap keycodes kept for typing an unmatched chord
+#define CHORD_TAPS  8
+
+static bool     chord_on = false;
+static uint32_t chord_keys;             // Positions pressed since the chord started
+static uint32_t chord_held;             // Captured positions that are still held
+static uint8_t  chord_taps[CHORD_TAPS]; // Tap keycodes in press order
+static uint8_t  chord_count;
+
+void chord_toggle(void) {
+    chord_on = !chord_on;
+    chord_keys = chord_held = chord_count = 0;
+}
+
+bool is_chord_on(void) {
+    return chord_on;
+}
+
+// Returns the text offset of a chord, or UINT16_MAX if there is none
+static uint16_t chord_lookup(uint32_t keys) {
+    uint16_t const bucket = (keys * CHORD_BUCKET_MULT) >> (32 - CHORD_BUCKET_BITS);
+#if CHORD_SLOT_BITS <= 8
+    uint16_t const slot = (keys * CHORD_SLOT_MULT) >> (32 - CHORD_SLOT_BITS) ^ pgm_read_byte(chord_displace + bucket);
+#else
+    uint16_t const slot = (keys * CHORD_SLOT_MULT) >> (32 - CHORD_SLOT_BITS) ^ pgm_read_word(chord_displace + bucket);
+#endif
+    return pgm_read_dword(chord_masks + slot) == keys ? pgm_read_word(chord_words + slot) : UINT16_MAX;
+}
+
+// Send the word of a chord with a trailing space, capitalized with Shift
+static void send_chord(void) {
+    uint16_t const word = chord_count > 1 ? chord_lookup(chord_keys) : UINT16_MAX;
+    if (word == UINT16_MAX) {
+        for (uint8_t i = 0; i < chord_count; ++i) tap_code(chord_taps[i]);
+        return;
+    }
+
+    uint8_t const mods = get_mods();
+    bool const capital = (mods | get_weak_mods()) & MOD_MASK_SHIFT;
+    clear_mods();
+    clear_weak_mods();
+    for (char const *c = chord_text + word; pgm_read_byte(c); ++c) {
+        char ch = pgm_read_byte(c);
+        if (capital && c == chord_text + word && 'a' <= ch && ch <= 'z') ch -= 'a' - 'A';
+        send_char(ch);
+    }
+    send_char(' ');
+    set_mods(mods);
+}
+
+bool process_chord(uint16_t keycode, keyrecord_t *record) {
+    if (!chord_on) return true;
+
+    uint16_t const position = keymap_key_to_keycode(CMB, record->event.key) - QK_USER;
+    if (position >= CHORD_KEYS) return true;
+    uint32_t const bit = (uint32_t)1 << position;
+
+    if (record->event.pressed) {
+        // Chord on base layers only, and leave shortcuts to the keymap
+        if (get_highest_layer(layer_state) > CMK || get_mods() & ~MOD_MASK_SHIFT) return true;
+        if (IS_QK_MOD_TAP(keycode) || IS_QK_LAYER_TAP(keycode)) {
+            keycode &= 0xff;
+        } else if (!IS_BASIC_KEYCODE(keycode)) {
+            return true;
+        }
+        chord_keys |= bit;
+        chord_held |= bit;
+        if (chord_count < CHORD_TAPS) chord_taps[chord_count++] = keycode;
+        return false;
+    }
+
+    // Resolve on the first release, later presses start a new chord
+    if (!(chord_held & bit)) return true;
+    chord_held &= ~bit;
+    if (chord_keys) {
+        send_chord();
+        chord_keys = chord_count = 0;
+    }
+    return false;
+}
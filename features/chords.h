@@ -0,0 +1,8 @@
+// Copyright @filterpaper
+// SPDX-License-Identifier: GPL-2.0+
+
+#pragma once
+
+void chord_toggle(void);
+bool is_chord_on(void);
+bool process_chord(uint16_t keycode, keyrecord_t *record);
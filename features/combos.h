@@ -8,26 +8,97 @@ COMB(name, keycode_shortcut, combo_sequence...)
 SSTR(name, "string to send", combo_sequence...)
 ACTN(name, function_call(),  combo_sequence...)
 
+Combo sequences are key positions from layout.h that are read from the
+CMB layer, so combos stay on the same physical keys on every layer.
+
 Use the COMB macro for simple keycode shortcuts
-Example: COMB(vol_up, KC_VOLU, KC_Y, KC_U).
+Example: COMB(vol_up, KC_VOLU, P_R01, P_R02).
 
-Use the SSTR macro for sending strings
-Example: SSTR(which, "which ", KC_W, KC_H).
+Use the SSTR macro for sending strings of up to SSTR_LENGTH characters
+Example: SSTR(which, "which ", P_L02, P_R06).
 
 Use the ACTN macro for function callbacks
-Example: ACTN(rgb_tog, rgb_matrix_toggle(), KC_Z, KC_X)
+Example: ACTN(rgb_tog, rgb_matrix_toggle(), P_L11, P_L12)
+
+Use the TERM macro to override COMBO_TERM of a combo
+Example: TERM(rgb_tog, 50)
+With COMBO_TERM_LEARN, terms shrink to the press skew that is observed
+
+Run combos_report.py to check combos.inc for overlapping combos,
+tap-hold conflicts and the typing latency they add
+With COMBO_TRACE and CONSOLE_ENABLE, combo windows are logged to the console
+for combos_trace.py to measure the latency that is actually added
 */
 
 #define COMBOS_DEF "combos.inc"
 
 #define C_ENUM(name, val, ...) name,
-#define C_DATA(name, val, ...) uint16_t const name##_combo[] PROGMEM = {__VA_ARGS__, COMBO_END};
+#define C_DATA(name, val, ...) uint16_t const name##_combo[] PROGMEM = {__VA_ARGS__, COMBO_END}; \
+    _Static_assert(sizeof(name##_combo) <= (C_KEYS + 1) * sizeof(uint16_t), #name " combo has too many keys");
+#define S_DATA(name, val, ...) C_DATA(name, val, __VA_ARGS__) \
+    uint8_t const name##_keys[SSTR_LENGTH + 1] PROGMEM = {S_KEYS(val)}; \
+    _Static_assert(sizeof(val) <= SSTR_LENGTH + 1, #name " string is too long");
 #define C_TYPE(name, val, ...) [name] = COMBO(name##_combo, val),
 #define A_TYPE(name, val, ...) [name] = COMBO_ACTION(name##_combo),
-#define P_SSTR(name, val, ...) case name: if (pressed) { SEND_STRING(val); } break;
+#define P_SSTR(name, val, ...) case name: if (pressed) { send_keys(name##_keys); } break;
 #define P_ACTN(name, val, ...) case name: if (pressed) { val; } break;
+#define C_MASK(name, val, ...) | (C_HAS(keycode, __VA_ARGS__) && name / 32 == word ? (uint32_t)1 << name % 32 : 0)
+// Match keycode against a combo sequence of up to C_KEYS keys
+#define C_KEYS 5
+#define C_HAS(kc, ...) C_HAS_(kc, __VA_ARGS__, COMBO_END, COMBO_END, COMBO_END, COMBO_END)
+#define C_HAS_(kc, k1, k2, k3, k4, k5, ...) \
+    ((kc) == (k1) || (kc) == (k2) || (kc) == (k3) || (kc) == (k4) || (kc) == (k5))
+#define C_TERM(name, ms)       case name: return ms;
 #define UNUSED(...)
 
+// SSTR strings are converted to basic keycodes with Shift in bit 7 at compile time.
+// Characters without a keycode read sstr_unsupported_character, which is not
+// a constant, so they fail the build with "initializer element is not constant".
+#define SSTR_LENGTH 8
+#define S_KEYS(s) S_KEY(s, 0), S_KEY(s, 1), S_KEY(s, 2), S_KEY(s, 3), \
+                  S_KEY(s, 4), S_KEY(s, 5), S_KEY(s, 6), S_KEY(s, 7)
+#define S_KEY(s, i) (sizeof(s) > (i) + 1 ? A2K((s)[i]) : 0)
+#define S_SFT 0x80
+#define A2K(c) ( \
+    'a' <= (c) && (c) <= 'z' ? KC_A + (c) - 'a'           : \
+    'A' <= (c) && (c) <= 'Z' ? S_SFT | (KC_A + (c) - 'A') : \
+    '1' <= (c) && (c) <= '9' ? KC_1 + (c) - '1'           : \
+    (c) == '0'  ? KC_0            : (c) == ')'  ? S_SFT | KC_0    : \
+    (c) == '!'  ? S_SFT | KC_1    : (c) == '@'  ? S_SFT | KC_2    : \
+    (c) == '#'  ? S_SFT | KC_3    : (c) == '$'  ? S_SFT | KC_4    : \
+    (c) == '%'  ? S_SFT | KC_5    : (c) == '^'  ? S_SFT | KC_6    : \
+    (c) == '&'  ? S_SFT | KC_7    : (c) == '*'  ? S_SFT | KC_8    : \
+    (c) == '('  ? S_SFT | KC_9    : (c) == ' '  ? KC_SPC          : \
+    (c) == '\n' ? KC_ENT          : (c) == '\t' ? KC_TAB          : \
+    (c) == '-'  ? KC_MINS         : (c) == '_'  ? S_SFT | KC_MINS : \
+    (c) == '='  ? KC_EQL          : (c) == '+'  ? S_SFT | KC_EQL  : \
+    (c) == '['  ? KC_LBRC         : (c) == '{'  ? S_SFT | KC_LBRC : \
+    (c) == ']'  ? KC_RBRC         : (c) == '}'  ? S_SFT | KC_RBRC : \
+    (c) == '\\' ? KC_BSLS         : (c) == '|'  ? S_SFT | KC_BSLS : \
+    (c) == ';'  ? KC_SCLN         : (c) == ':'  ? S_SFT | KC_SCLN : \
+    (c) == '\'' ? KC_QUOT         : (c) == '"'  ? S_SFT | KC_QUOT : \
+    (c) == '`'  ? KC_GRV          : (c) == '~'  ? S_SFT | KC_GRV  : \
+    (c) == ','  ? KC_COMM         : (c) == '<'  ? S_SFT | KC_COMM : \
+    (c) == '.'  ? KC_DOT          : (c) == '>'  ? S_SFT | KC_DOT  : \
+    (c) == '/'  ? KC_SLSH         : (c) == '?'  ? S_SFT | KC_SLSH : sstr_unsupported_character)
+extern uint8_t const sstr_unsupported_character;
+
+// Send SSTR keycodes, toggling Shift only where the case changes. Each key is
+// tapped in its own reports, as hosts do not keep the order of keys that
+// change in one report.
+static void send_keys(uint8_t const *keys) {
+    uint8_t shift = 0;
+    for (uint8_t key; (key = pgm_read_byte(keys)); ++keys) {
+        if ((key ^ shift) & S_SFT) {
+            shift ^= S_SFT;
+            shift ? register_code(KC_LSFT) : unregister_code(KC_LSFT);
+        }
+        tap_code(key & ~S_SFT);
+    }
+    if (shift) unregister_code(KC_LSFT);
+}
+
+#define TERM UNUSED
 #define COMB C_ENUM
 #define SSTR C_ENUM
 #define ACTN C_ENUM
@@ -39,7 +110,7 @@ enum combos {
 #undef SSTR
 #undef ACTN
 #define COMB C_DATA
-#define SSTR C_DATA
+#define SSTR S_DATA
 #define ACTN C_DATA
 #include COMBOS_DEF
 
@@ -53,6 +124,116 @@ combo_t key_combos[] = {
 #   include COMBOS_DEF
 };
 
+#undef COMB
+#undef SSTR
+#undef ACTN
+#define COMB C_MASK
+#define SSTR C_MASK
+#define ACTN C_MASK
+// Bitmask of the combos that contain keycode, in words of 32 combos indexed
+// by combo / 32. It folds to a constant for constant keycodes, and is only
+// used for IS_THUMB_COMBO, as QMK calls combo_should_trigger only for combos
+// that contain the pressed key.
+static inline uint32_t combo_candidates(uint16_t keycode, uint8_t word) {
+    return 0
+#       include COMBOS_DEF
+    ;
+}
+
+static inline bool is_combo_candidate(uint16_t combo_index, uint16_t keycode) {
+    return combo_candidates(keycode, combo_index / 32) >> (combo_index % 32) & 1;
+}
+
+#ifdef COMBO_TRACE
+// Ring of combo windows, from the first buffered key to a combo or fallback.
+// Each full ring is dumped to the console for combos_trace.py.
+#   define TRACE_SIZE     16
+#   define TRACE_KEYS     4
+#   define TRACE_FALLBACK UINT8_MAX
+static struct {
+    uint16_t start;            // Press time of the first buffered key
+    uint8_t  term;             // Longest term of the candidate combos
+    uint8_t  held;             // Time the first key was held back
+    uint8_t  result;           // Combo index or TRACE_FALLBACK
+    uint8_t  count;            // Buffered keys
+    uint8_t  keys[TRACE_KEYS]; // Buffered key positions
+} trace[TRACE_SIZE];
+static uint8_t  trace_head;
+static bool     trace_open;
+static uint16_t trace_presses; // Physical presses since the last dump
+
+static void trace_close(uint8_t result) {
+    if (!trace_open) return;
+    uint16_t const held = TIMER_DIFF_16(timer_read(), trace[trace_head].start);
+    // A window that outlasts its term fell back when the term expired
+    trace[trace_head].held   = held < trace[trace_head].term ? held : trace[trace_head].term;
+    trace[trace_head].result = result;
+    trace_open = false;
+    if (++trace_head < TRACE_SIZE) return;
+
+    trace_head = 0;
+    uprintf("ct presses %u\n", trace_presses);
+    for (uint8_t i = 0; i < TRACE_SIZE; ++i) {
+        uprintf("ct %u %u %u", trace[i].held, trace[i].term, trace[i].result);
+        for (uint8_t k = 0; k < trace[i].count; ++k) uprintf(" %u", trace[i].keys[k]);
+        uprintf("\n");
+    }
+    trace_presses = 0;
+}
+
+// Add a key that QMK buffers for a combo candidate
+static void trace_key(uint16_t combo_index, combo_t *combo, uint16_t keycode, keyrecord_t *record) {
+    uint8_t const key = keycode - QK_USER;
+    uint8_t k = 0;
+    while (trace_open && k < trace[trace_head].count && trace[trace_head].keys[k] != key) ++k;
+
+    if (!record->event.pressed) {
+        // Releasing a buffered key ends the window
+        if (trace_open && k < trace[trace_head].count) trace_close(TRACE_FALLBACK);
+        return;
+    }
+    if (!trace_open) {
+        trace[trace_head].start = record->event.time;
+        trace[trace_head].term  = trace[trace_head].count = 0;
+        trace_open = true;
+    }
+    if (k == trace[trace_head].count && k < TRACE_KEYS) {
+        trace[trace_head].keys[trace[trace_head].count++] = key;
+    }
+#   ifdef COMBO_TERM_PER_COMBO
+    uint16_t const term = get_combo_term(combo_index, combo);
+#   else
+    uint16_t const term = COMBO_TERM;
+#   endif
+    if (trace[trace_head].term < term) trace[trace_head].term = term;
+}
+
+// Count a physical press, which ends the window if its term has expired.
+// It runs before process_combo, so keys that QMK buffers next are not yet
+// known here, and other presses end the window when they release the buffer.
+void combo_trace_press(keyrecord_t *record) {
+    if (!record->event.pressed) return;
+    ++trace_presses;
+    if (trace_open && TIMER_DIFF_16(record->event.time, trace[trace_head].start) >= trace[trace_head].term) {
+        trace_close(TRACE_FALLBACK);
+    }
+}
+
+// End the window with a keycode combo, or a key that QMK released from the buffer
+void combo_trace_record(uint16_t keycode, keyrecord_t *record) {
+    if (!record->event.pressed) return;
+    if (record->event.type == COMBO_EVENT) {
+        for (uint8_t i = 0; i < sizeof(key_combos) / sizeof(combo_t); ++i) {
+            if (key_combos[i].keycode == keycode) {
+                trace_close(i);
+                return;
+            }
+        }
+    }
+    trace_close(TRACE_FALLBACK);
+}
+#endif
+
 #undef COMB
 #undef SSTR
 #undef ACTN
@@ -60,13 +241,97 @@ combo_t key_combos[] = {
 #define SSTR P_SSTR
 #define ACTN P_ACTN
 void process_combo_event(uint16_t combo_index, bool pressed) {
+#ifdef COMBO_TRACE
+    if (pressed) trace_close(combo_index);
+#endif
+    switch (combo_index) {
+#       include COMBOS_DEF
+    }
+}
+
+#ifdef COMBO_TERM_PER_COMBO
+#undef COMB
+#undef SSTR
+#undef ACTN
+#undef TERM
+#define COMB UNUSED
+#define SSTR UNUSED
+#define ACTN UNUSED
+#define TERM C_TERM
+static uint16_t combo_term(uint16_t combo_index) {
     switch (combo_index) {
 #       include COMBOS_DEF
     }
+    return COMBO_TERM;
+}
+
+#   ifdef COMBO_TERM_LEARN
+// Histogram of press skews, the time from the first to the last combo key
+#   define SKEW_BUCKET_MS 5
+#   define SKEW_BUCKETS   8
+#   define SKEW_SAMPLES   16
+static struct {
+    uint16_t first;
+    uint8_t  count[SKEW_BUCKETS];
+} skews[sizeof(key_combos) / sizeof(combo_t)];
+
+// Record the press skew when the last combo key goes down
+static void learn_combo_skew(uint16_t combo_index, combo_t *combo, uint16_t keycode) {
+    uint8_t size = 0, bit = 0;
+    for (uint16_t key; (key = pgm_read_word(&combo->keys[size])) != COMBO_END; ++size) {
+        if (key == keycode) bit = 1 << size;
+    }
+    if (!combo->state) {
+        skews[combo_index].first = timer_read();
+    } else if (!(combo->state & bit) && (combo->state | bit) == (1 << size) - 1) {
+        uint16_t const bucket = timer_elapsed(skews[combo_index].first) / SKEW_BUCKET_MS;
+        uint8_t *count = skews[combo_index].count;
+        // Age the histogram by halving it when a bucket is full
+        if (++count[bucket < SKEW_BUCKETS ? bucket : SKEW_BUCKETS - 1] == UINT8_MAX) {
+            for (uint8_t i = 0; i < SKEW_BUCKETS; ++i) count[i] >>= 1;
+        }
+    }
 }
 
+// Cover 95% of the observed skews with one bucket of margin. Only skews
+// inside the current term are observed, the margin keeps it from drifting.
+static uint16_t learned_term(uint16_t combo_index, uint16_t term) {
+    uint8_t const *count = skews[combo_index].count;
+    uint16_t total = 0, sum = 0;
+    for (uint8_t i = 0; i < SKEW_BUCKETS; ++i) total += count[i];
+    if (total < SKEW_SAMPLES) return term;
+
+    uint8_t bucket = 0;
+    while (bucket < SKEW_BUCKETS - 1 && (sum += count[bucket]) * 20 < total * 19) ++bucket;
+    uint16_t const learned = (bucket + 2) * SKEW_BUCKET_MS;
+    return learned < term ? learned : term;
+}
+#   endif
+
+uint16_t get_combo_term(uint16_t combo_index, combo_t *combo) {
+#   ifdef COMBO_TERM_LEARN
+    return learned_term(combo_index, combo_term(combo_index));
+#   else
+    return combo_term(combo_index);
+#   endif
+}
+#endif
+
 #ifdef COMBO_SHOULD_TRIGGER
+// Thumb combos trigger on every layer. Keys captured by chord mode are
+// consumed before process_combo, so alpha combos need no chord check.
+#define IS_THUMB_COMBO(i) (is_combo_candidate(i, P_L16) || is_combo_candidate(i, P_L17) || \
+                         is_combo_candidate(i, P_R16) || is_combo_candidate(i, P_R17))
+#define ALPHA_COMBOS_OFF() (get_highest_layer(layer_state) > CMK)
+
 bool combo_should_trigger(uint16_t combo_index, combo_t *combo, uint16_t keycode, keyrecord_t *record) {
-    return combo_index >= thmb_l || get_highest_layer(layer_state) <= CMK;
+    if (!IS_THUMB_COMBO(combo_index) && ALPHA_COMBOS_OFF()) return false;
+#   if defined(COMBO_TERM_PER_COMBO) && defined(COMBO_TERM_LEARN)
+    if (record->event.pressed) learn_combo_skew(combo_index, combo, keycode);
+#   endif
+#   ifdef COMBO_TRACE
+    trace_key(combo_index, combo, keycode, record);
+#   endif
+    return true;
 }
 #endif
\ No newline at end of file
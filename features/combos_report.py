@@ -0,0 +1,307 @@
+# Copyright @filterpaper
+# SPDX-License-Identifier: GPL-2.0+
+
+"""Static overlap and timing report for combos.inc.
+
+This program parses combos.inc, layout.h and config.h and reports combos that
+can delay or misfire while typing:
+
+  * Subset combos, whose keys are all part of a longer combo. QMK holds the
+    shorter combo until the longer one can no longer complete.
+  * Overlapping combos that share keys without being subsets.
+  * Combos on mod-tap, layer-tap or tap-hold keys, where the combo and the
+    tap-hold decision race each other.
+  * Combos whose keys form common bigrams on the active base layer, because
+    a fast roll inside COMBO_TERM triggers them by accident.
+
+Every keystroke on a combo key is held back by up to the longest term of its
+combos while QMK waits for the rest of them, so the report closes with the
+added latency per keystroke, weighted by character frequency. Terms are
+COMBO_TERM unless a TERM line of combos.inc overrides them. Run it from the
+repository root without arguments like
+
+$ python3 features/combos_report.py
+
+or for the Colemak layer with bigrams counted from your own writing like
+
+$ python3 features/combos_report.py --layer CMK --corpus notes.txt
+
+Combo keys are positions of the _POSN layout, which are mapped to the keys and
+characters of the active layer with its home row mods. Without
+a corpus, frequencies are counted from the corrections in
+dictionaries/dictionary_huge.txt, which is a rough stand-in for English text.
+"""
+
+import argparse
+import collections
+import itertools
+import os
+import re
+import sys
+from typing import Dict, List, NamedTuple, Optional, Tuple
+
+FEATURES = os.path.dirname(os.path.abspath(__file__))
+ROOT = os.path.dirname(FEATURES)
+
+KEY_CHARS = {
+    'KC_COMM': ',', 'KC_DOT': '.', 'KC_SLSH': '/', 'KC_QUOT': "'",
+    'KC_SCLN': ';', 'KC_SPC': ' ', 'KC_TAB': '\t', 'KC_ENT': '\n',
+    'KC_BSPC': '\b', 'KC_MINS': '-',
+}
+
+
+class Combo(NamedTuple):
+  name: str
+  kind: str
+  keys: Tuple[str, ...]
+  condition: Optional[str]
+  term: int = 0
+
+
+class Key(NamedTuple):
+  name: str
+  position: int
+  tap: str
+  kind: str  # 'key', 'mod-tap', 'layer-tap' or 'tap-hold'
+
+
+def split_args(text: str) -> List[str]:
+  """Splits macro arguments on top level commas outside of strings."""
+  args, depth, quote, start = [], 0, False, 0
+  for i, c in enumerate(text):
+    if c == '"' and text[i - 1] != '\\':
+      quote = not quote
+    elif quote:
+      continue
+    elif c == '(':
+      depth += 1
+    elif c == ')':
+      depth -= 1
+    elif c == ',' and depth == 0:
+      args.append(text[start:i].strip())
+      start = i + 1
+  args.append(text[start:].strip())
+  return args
+
+
+def parse_combos(file_name: str, default_term: int) -> List[Combo]:
+  """Parses COMB, SSTR, ACTN and TERM lines of combos.inc.
+
+  Args:
+    file_name: Path of combos.inc.
+    default_term: COMBO_TERM for combos without a TERM line.
+  Returns:
+    List of combos with the #ifdef condition they are defined under.
+  """
+  combos, terms, condition = [], {}, None
+  with open(file_name, 'rt') as f:
+    for line in f:
+      line = line.split('//')[0].strip()
+      if line.startswith('#if'):
+        condition = line.split(None, 1)[1]
+      elif line.startswith('#endif'):
+        condition = None
+      match = re.match(r'(COMB|SSTR|ACTN)\((.*)\)$', line)
+      if match:
+        name, _, *keys = split_args(match.group(2))
+        combos.append(Combo(name, match.group(1), tuple(keys), condition))
+      match = re.match(r'TERM\((\w+),\s*(\d+)\)$', line)
+      if match:
+        terms[match.group(1)] = int(match.group(2))
+  return [c._replace(term=terms.get(c.name, default_term)) for c in combos]
+
+
+def parse_defines(file_name: str) -> Dict[str, str]:
+  """Returns the #define macros of a header with continuation lines joined."""
+  with open(file_name, 'rt') as f:
+    text = f.read().replace('\\\n', ' ')
+  return {m.group(1): m.group(2).strip() for m in
+          re.finditer(r'^\s*#\s*define\s+(\w+)(?!\()\s+(.*)$', text, re.M)}
+
+
+def parse_layer(defines: Dict[str, str], layer: str) -> List[str]:
+  """Returns the keycodes of a 3x5_2 layout macro in layout.h."""
+  body = defines[layer].split('/*')[0]
+  return [k.strip() for k in body.split(',')]
+
+
+def home_row_mods(layer: List[str]) -> List[str]:
+  """Applies the HRM wrapper of layout.h to a 3x5_2 layer."""
+  layer = list(layer)
+  for i, mod in zip((10, 11, 12, 13, 16, 17, 18, 19),
+                    ('LCTL', 'LALT', 'LGUI', 'LSFT', 'RSFT', 'RGUI', 'RALT',
+                     'RCTL')):
+    layer[i] = f'{mod}_T({layer[i]})'
+  for i in range(26, 30):
+    layer[i] = f'LT(0,{layer[i]})'
+  return layer
+
+
+def resolve_key(defines: Dict[str, str], positions: List[str],
+                layer: List[str], name: str) -> Key:
+  """Finds the position and active layer keycode of a combo key."""
+  position = positions.index(name)
+  value = defines.get(layer[position], layer[position])
+  tap = re.findall(r'KC_\w+', value)[-1] if 'KC_' in value else value
+  if re.match(r'LT\(0,', value):
+    kind = 'tap-hold'
+  elif value.startswith('LT('):
+    kind = 'layer-tap'
+  elif re.match(r'\w+_T\(', value):
+    kind = 'mod-tap'
+  else:
+    kind = 'key'
+  return Key(name, position, tap, kind)
+
+
+def key_char(keycode: str) -> Optional[str]:
+  """Returns the character typed by a basic keycode."""
+  if re.fullmatch(r'KC_[A-Z]', keycode):
+    return keycode[-1].lower()
+  return KEY_CHARS.get(keycode)
+
+
+def count_text(text: str) -> Tuple[collections.Counter, collections.Counter]:
+  """Counts characters and bigrams of lower case text."""
+  text = re.sub(r'\s+', ' ', text.lower())
+  return (collections.Counter(text),
+          collections.Counter(a + b for a, b in zip(text, text[1:])))
+
+
+def default_corpus() -> str:
+  """Joins the corrections of the autocorrect dictionary as sample text."""
+  words = []
+  with open(os.path.join(FEATURES, 'dictionaries', 'dictionary_huge.txt')) as f:
+    for line in f:
+      if '->' in line and not line.startswith('#'):
+        words.append(line.split('->')[1].strip())
+  return ' '.join(words)
+
+
+def report(combos: List[Combo], keys: Dict[str, Key], chars: Dict[int, str],
+           unigrams: collections.Counter, bigrams: collections.Counter,
+           term: int, overlap: float, layer_limited: Dict[str, bool]) -> None:
+  """Prints the combo report."""
+  total = sum(unigrams.values()) or 1
+  total_bigrams = sum(bigrams.values()) or 1
+  key_sets = {c.name: set(c.keys) for c in combos}
+
+  def label(combo: Combo) -> str:
+    keys_text = ' + '.join(combo.keys)
+    chars_text = ''.join(chars.get(keys[k].position, '?') for k in combo.keys)
+    return f'{combo.name:10} {keys_text:32} {chars_text!r}'
+
+  print(f'COMBO_TERM {term} ms, {len(combos)} combos')
+  for combo in combos:
+    if combo.term != term:
+      print(f'  {combo.name:10} {combo.term} ms')
+  print()
+
+  print('Subset combos, the shorter one waits for the longer one:')
+  found = False
+  for a, b in itertools.permutations(combos, 2):
+    if key_sets[a.name] < key_sets[b.name]:
+      print(f'  {a.name} < {b.name}, {a.name} fires up to {b.term} ms late')
+      found = True
+  print('' if found else '  none\n')
+
+  print('Overlapping combos that share keys:')
+  found = False
+  for a, b in itertools.combinations(combos, 2):
+    shared = key_sets[a.name] & key_sets[b.name]
+    if shared and not (key_sets[a.name] < key_sets[b.name] or
+                       key_sets[b.name] < key_sets[a.name]):
+      print(f'  {a.name} & {b.name} on {", ".join(sorted(shared))}')
+      found = True
+  print('' if found else '  none\n')
+
+  print('Combos on tap-hold keys, racing the tap-hold decision:')
+  found = False
+  for combo in combos:
+    held = [f'{k} {keys[k].tap} ({keys[k].kind})' for k in combo.keys
+            if keys[k].kind != 'key']
+    if held:
+      print(f'  {combo.name:10} {", ".join(held)}')
+      found = True
+  print('' if found else '  none\n')
+
+  print(f'Bigram conflicts, assuming {overlap:.0%} of rolls land inside '
+        f'COMBO_TERM:')
+  conflicts = []
+  for combo in combos:
+    if len(combo.keys) != 2:
+      continue
+    a, b = (chars.get(keys[k].position) for k in combo.keys)
+    if a is None or b is None:
+      continue
+    share = (bigrams[a + b] + bigrams[b + a]) / total_bigrams
+    if share:
+      conflicts.append((share, combo))
+  for share, combo in sorted(conflicts, key=lambda c: -c[0]):
+    print(f'  {label(combo)} {share * 1000:6.2f} per 1000 bigrams, '
+          f'{share * overlap * 1000:5.2f} misfires per 1000 keystrokes')
+  print('' if conflicts else '  none\n')
+
+  print('Keys held back by combos, for up to their longest term:')
+  delayed = {}
+  for combo in combos:
+    for k in combo.keys:
+      c = chars.get(keys[k].position)
+      if c is not None:
+        delayed.setdefault(c, []).append(combo)
+  share = latency = 0.0
+  for c, held in sorted(delayed.items(), key=lambda d: -unigrams[d[0]]):
+    frequency = unigrams[c] / total
+    longest = max(combo.term for combo in held)
+    share += frequency
+    latency += frequency * longest
+    limited = all(layer_limited[combo.name] for combo in held)
+    print(f'  {c!r:6} {frequency:6.2%} of keystrokes, {longest} ms, in '
+          f'{", ".join(sorted(combo.name for combo in held))}' +
+          (' (base layers only)' if limited else ''))
+  print(f'\n{share:.1%} of keystrokes wait for combos, adding up to '
+        f'{latency:.1f} ms per keystroke on average.')
+
+
+def main(argv):
+  parser = argparse.ArgumentParser(description='Reports combo overlaps.')
+  parser.add_argument('--combos', default=os.path.join(FEATURES, 'combos.inc'))
+  parser.add_argument('--layout', default=os.path.join(ROOT, 'layout.h'))
+  parser.add_argument('--config', default=os.path.join(ROOT, 'config.h'))
+  parser.add_argument('--layer', default='BSE', choices=('BSE', 'CMK'),
+                      help='active base layer')
+  parser.add_argument('--corpus', help='text file to count bigrams from')
+  parser.add_argument('--overlap', type=float, default=0.05,
+                      help='share of rolled bigrams pressed within COMBO_TERM')
+  args = parser.parse_args(argv[1:])
+
+  term = int(parse_defines(args.config).get('COMBO_TERM', '50'))
+  combos = parse_combos(args.combos, term)
+  defines = parse_defines(args.layout)
+
+  positions = parse_layer(defines, '_POSN')
+  base = parse_layer(defines, '_BASE')
+  layer = parse_layer(defines, {'BSE': '_BASE', 'CMK': '_COLE'}[args.layer])
+  layer = home_row_mods([fallback if keycode == '_______' else keycode
+                         for keycode, fallback in zip(layer, base)])
+
+  keys = {k: resolve_key(defines, positions, layer, k)
+          for c in combos for k in c.keys}
+  chars = {key.position: key_char(key.tap) for key in keys.values()
+           if key_char(key.tap) is not None}
+  # combo_should_trigger keeps thumb combos on every layer.
+  thumbs = set(positions[-4:])
+  layer_limited = {c.name: not thumbs & set(c.keys) for c in combos}
+
+  if args.corpus:
+    with open(args.corpus, 'rt') as f:
+      unigrams, bigrams = count_text(f.read())
+  else:
+    unigrams, bigrams = count_text(default_corpus())
+
+  report(combos, keys, chars, unigrams, bigrams, term, args.overlap,
+         layer_limited)
+
+
+if __name__ == '__main__':
+  main(sys.argv)
@@ -0,0 +1,151 @@
+# Copyright @filterpaper
+# SPDX-License-Identifier: GPL-2.0+
+
+"""Decoder for the COMBO_TRACE console dump of combos.h.
+
+With COMBO_TRACE defined and CONSOLE_ENABLE = yes, the firmware records each
+combo window from the first buffered key until a combo fires or QMK falls back
+to the buffered keys. Every 16 windows it prints lines like
+
+  ct presses 57
+  ct 12 30 255 16 17
+
+with the time the first key was held back, the longest candidate term, the
+combo index or 255 for a fallback, and the buffered key positions. Save the
+output of `qmk console` and decode it like
+
+$ qmk console > trace.txt
+$ python3 features/combos_trace.py trace.txt
+
+The report shows the latency that combo buffering adds per keystroke and the
+combos that cause the most fallbacks. Combo indices follow combos.inc, so
+combos under features that rules.mk does not set to yes, such as
+SWAP_HANDS_ENABLE or CHORD_ENABLE, are dropped. Pass --disable FEATURE for
+features turned off elsewhere, like in the keymap json.
+"""
+
+import argparse
+import collections
+import os
+import re
+import sys
+from typing import Dict, List, NamedTuple, Tuple
+
+from combos_report import (FEATURES, ROOT, parse_combos, parse_defines,
+                           parse_layer)
+
+FALLBACK = 255
+BUCKET_MS = 5
+
+
+class Window(NamedTuple):
+  held: int
+  term: int
+  result: int
+  keys: Tuple[int, ...]
+
+
+def parse_trace(lines: List[str]) -> Tuple[List[Window], int]:
+  """Returns the traced windows and the number of physical key presses."""
+  windows, presses = [], 0
+  for line in lines:
+    match = re.search(r'\bct presses (\d+)', line)
+    if match:
+      presses += int(match.group(1))
+      continue
+    match = re.search(r'\bct (\d+) (\d+) (\d+)((?: \d+)*)\s*$', line)
+    if match:
+      held, term, result = (int(match.group(i)) for i in (1, 2, 3))
+      keys = tuple(int(k) for k in match.group(4).split())
+      windows.append(Window(held, term, result, keys))
+  return windows, presses
+
+
+def parse_rules(file_name: str) -> Dict[str, str]:
+  """Returns the FEATURE = value assignments of a rules.mk."""
+  with open(file_name, 'rt') as f:
+    return {m.group(1): m.group(2).strip().lower() for m in
+            re.finditer(r'^\s*(\w+)\s*[:?]?=\s*(\S*)', f.read(), re.M)}
+
+
+def main(argv):
+  parser = argparse.ArgumentParser(description='Decodes combo traces.')
+  parser.add_argument('trace', nargs='?', help='console log, default stdin')
+  parser.add_argument('--combos', default=os.path.join(FEATURES, 'combos.inc'))
+  parser.add_argument('--layout', default=os.path.join(ROOT, 'layout.h'))
+  parser.add_argument('--rules', default=os.path.join(ROOT, 'rules.mk'))
+  parser.add_argument('--disable', action='append', default=[],
+                      metavar='FEATURE',
+                      help='drop combos under #ifdef FEATURE')
+  args = parser.parse_args(argv[1:])
+
+  rules = parse_rules(args.rules)
+  disabled = set(args.disable) | {
+      c.condition for c in parse_combos(args.combos, 0)
+      if c.condition and c.condition.endswith('_ENABLE')
+      and rules.get(c.condition) != 'yes'}
+  combos = [c for c in parse_combos(args.combos, 0)
+            if c.condition not in disabled]
+  defines = parse_defines(args.layout)
+  positions = parse_layer(defines, '_POSN')
+  base = parse_layer(defines, '_BASE')
+
+  def key_name(key: int) -> str:
+    return base[key] if key < len(base) else str(key)
+
+  def combo_name(result: int) -> str:
+    if result == FALLBACK:
+      return 'fallback'
+    return combos[result].name if result < len(combos) else f'combo {result}'
+
+  if args.trace:
+    with open(args.trace, 'rt') as f:
+      windows, presses = parse_trace(f.readlines())
+  else:
+    windows, presses = parse_trace(sys.stdin.readlines())
+  if not windows:
+    print('No combo trace lines found.')
+    return
+
+  fired = [w for w in windows if w.result != FALLBACK]
+  fallbacks = [w for w in windows if w.result == FALLBACK]
+  print(f'{len(windows)} combo windows over {presses} key presses, '
+        f'{len(fired)} combos and {len(fallbacks)} fallbacks')
+  held = sum(w.held for w in fallbacks)
+  print(f'Fallbacks held keys back for {held} ms, '
+        f'{held / max(len(fallbacks), 1):.1f} ms each and '
+        f'{held / max(presses, 1):.2f} ms per key press on average')
+  print(f'{sum(w.held >= w.term for w in fallbacks)} fallbacks waited out '
+        f'their full term')
+  print(f'Combos fired {sum(w.held for w in fired) / max(len(fired), 1):.1f} '
+        f'ms after their first key on average\n')
+
+  print('Held time of fallbacks:')
+  buckets = collections.Counter(min(w.held // BUCKET_MS, 8) for w in fallbacks)
+  for bucket in range(9):
+    label = (f'{bucket * BUCKET_MS:3}-{bucket * BUCKET_MS + BUCKET_MS - 1:<3}'
+             if bucket < 8 else f'{8 * BUCKET_MS:3}+  ')
+    count = buckets[bucket]
+    print(f'  {label} ms {count:5} {"#" * (60 * count // len(windows))}')
+
+  # A fallback counts against every combo whose keys cover the buffered keys.
+  print('\nCombos by fallbacks:')
+  combo_keys = [{positions.index(k) for k in c.keys} for c in combos]
+  stats = collections.defaultdict(lambda: [0, 0])
+  for w in fired:
+    stats[w.result][0] += 1
+  for w in fallbacks:
+    for i, keys in enumerate(combo_keys):
+      if set(w.keys) <= keys:
+        stats[i][1] += 1
+  for i, (fires, misses) in sorted(stats.items(), key=lambda s: -s[1][1]):
+    print(f'  {combo_name(i):10} {fires:5} fired {misses:5} fallbacks')
+
+  print('\nBuffered keys of fallbacks:')
+  keys = collections.Counter(w.keys for w in fallbacks)
+  for key_set, count in keys.most_common(10):
+    print(f'  {" + ".join(key_name(k) for k in key_set):32} {count:5}')
+
+
+if __name__ == '__main__':
+  main(sys.argv)
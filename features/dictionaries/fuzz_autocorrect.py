@@ -0,0 +1,355 @@
+# Copyright 2022 @filterpaper
+# SPDX-License-Identifier: Apache-2.0
+
+"""Property-based fuzzer for the autocorrect trie walker.
+
+This program generates random dictionaries, serializes them with the same
+`serialize_trie` used by make_autocorrect_data.py and compiles `autocorrect.c`
+against each result with stubbed QMK functions. Random keystroke streams with
+backspaces, Shift, Ctrl, punctuation and toggles are then typed into both the
+compiled walker and a pure Python reference matcher that does not use the
+trie. Every correction and the final text must agree. Run it with
+
+$ python3 fuzz_autocorrect.py
+
+or with a fixed seed, dictionary count and number of parallel jobs like
+
+$ python3 fuzz_autocorrect.py --seed 1 --dicts 5000 --jobs 8
+
+Any change to the trie format or to `process_autocorrect` should keep this
+fuzzer passing. A failing case is printed with its dictionary and stream.
+"""
+
+import argparse
+import multiprocessing
+import os
+import random
+import shutil
+import subprocess
+import sys
+import tempfile
+import time
+from typing import List, Tuple
+
+from make_autocorrect_data import make_trie, serialize_trie, write_generated_code
+
+FEATURES = os.path.dirname(os.path.dirname(os.path.abspath(__file__)))
+
+# Stream tokens: a-z letters, ' ' space, '.' punctuation, '|' Enter, '1' digit,
+# '<' Backspace, '+'/'-' Shift down/up, '['/']' Ctrl down/up, '~' toggle.
+STUB_HEADER = r'''
+#pragma once
+#include <stdbool.h>
+#include <stdint.h>
+#include <string.h>
+
+#define PROGMEM
+#define pgm_read_byte(p) (*(uint8_t const *)(p))
+#define strlen_P(s) strlen(s)
+#define MOD_MASK_SHIFT 0x22
+#define S(kc) (0x0200 | (kc))
+
+enum {
+    KC_A = 0x04, KC_Z = 0x1d, KC_1 = 0x1e, KC_ENT = 0x28, KC_BSPC = 0x2a,
+    KC_TAB = 0x2b, KC_SPC = 0x2c, KC_DOT = 0x37, KC_SLASH = 0x38,
+    KC_CAPS = 0x39, KC_LCTL = 0xe0, KC_LSFT = 0xe1, KC_RSFT = 0xe5
+};
+#define QK_MOD_TAP       0x2000
+#define QK_MOD_TAP_MAX   0x3fff
+#define QK_LAYER_TAP     0x4000
+#define QK_LAYER_TAP_MAX 0x4fff
+
+typedef struct {
+    struct { bool pressed; } event;
+    struct { uint8_t count; } tap;
+} keyrecord_t;
+
+uint8_t get_mods(void);
+void set_mods(uint8_t mods);
+void clear_mods(void);
+static inline uint8_t get_weak_mods(void) { return 0; }
+static inline void clear_weak_mods(void) {}
+void tap_code(uint8_t keycode);
+void tap_code16(uint16_t keycode);
+void send_char(char ascii_code);
+'''
+
+HARNESS = r'''
+#include <stdio.h>
+#include <unistd.h>
+#include <sys/wait.h>
+#include "fuzz_qmk.h"
+#include "autocorrect.h"
+
+static uint8_t mods;
+static char    text[8192];
+static int     length;
+
+uint8_t get_mods(void) { return mods; }
+void set_mods(uint8_t new_mods) { mods = new_mods; }
+void clear_mods(void) { mods = 0; }
+
+// Log every key sent by the engine: '<' for Backspace, otherwise its character
+void send_char(char c) {
+    putchar(c);
+    if (c != '<') {
+        text[length++] = c;
+    } else if (length) {
+        --length;
+    }
+}
+
+void tap_code16(uint16_t keycode) {
+    uint8_t const key = keycode & 0xff;
+    bool const shift = (keycode & 0x0200) || (mods & 0x02);
+    send_char(key == KC_BSPC ? '<' : key == KC_SPC ? ' ' : key == KC_DOT ? '.' :
+              key == KC_ENT ? '|' : (shift ? 'A' : 'a') + key - KC_A);
+}
+
+void tap_code(uint8_t keycode) { tap_code16(keycode); }
+
+static void type(char const *stream) {
+    for (int i = 0; stream[i]; ++i) {
+        keyrecord_t record = {.event.pressed = true};
+        char const c = stream[i];
+        uint8_t keycode = 0;
+        switch (c) {
+            case '+': mods |= 0x02; keycode = KC_LSFT; break;
+            case '-': mods &= ~0x02; continue;
+            case '[': mods |= 0x01; keycode = KC_LCTL; break;
+            case ']': mods &= ~0x01; continue;
+            case '~': autocorrect_toggle(); continue;
+            case ' ': keycode = KC_SPC; break;
+            case '.': keycode = KC_DOT; break;
+            case '|': keycode = KC_ENT; break;
+            case '1': keycode = KC_1; break;
+            case '<': keycode = KC_BSPC; break;
+            default:  keycode = KC_A + c - 'a';
+        }
+        if (!process_autocorrect(keycode, &record) || (mods & 0x01) || keycode >= KC_CAPS) continue;
+        if (keycode == KC_BSPC) {
+            if (length) --length;
+        } else {
+            text[length++] = (mods & 0x02) && 'a' <= c && c <= 'z' ? c - 32 : c;
+        }
+    }
+    text[length] = 0;
+    printf("\t%s\n", text);
+}
+
+int main(void) {
+    static char stream[8192];
+    while (fgets(stream, sizeof(stream), stdin)) {
+        stream[strcspn(stream, "\n")] = 0;
+        fflush(stdout);
+        // Type each stream in a child process for a fresh engine state
+        pid_t const pid = fork();
+        if (pid == 0) {
+            type(stream);
+            fflush(stdout);
+            _exit(0);
+        }
+        waitpid(pid, NULL, 0);
+    }
+    return 0;
+}
+'''
+
+Entry = Tuple[str, str, bool]
+
+
+def random_dictionary(rng: random.Random) -> List[Entry]:
+  """Makes a random dictionary of typos over a small alphabet.
+
+  Typos follow the rules enforced by `parse_file`: letters a-z with optional
+  ':' word boundaries, and no typo may be a substring of another.
+  """
+  alphabet = 'abcdefghijklmnopqrstuvwxyz'[:rng.randint(2, 8)]
+  entries, typos = [], []
+  for _ in range(rng.randint(1, 40)):
+    word = ''.join(rng.choice(alphabet) for _ in range(rng.randint(1, 7)))
+    typo = ':' * rng.randint(0, 1) + word + ':' * rng.randint(0, 1)
+    if len(typo) < 2 or any(typo in t or t in typo for t in typos):
+      continue
+    correction = ''.join(rng.choice(alphabet + ' ')
+                         for _ in range(rng.randint(0, rng.choice((6, 24)))))
+    # The serializer can't encode a correction that extends a non-boundary typo.
+    if not typo.endswith(':') and correction.startswith(word):
+      continue
+    entries.append((typo, correction, rng.random() < 0.2))
+    typos.append(typo)
+  return entries
+
+
+def random_stream(rng: random.Random, entries: List[Entry]) -> str:
+  """Makes a random keystroke stream biased towards typing typos."""
+  alphabet = sorted(set(''.join(e[0] for e in entries).replace(':', '')))
+  pieces = []
+  for _ in range(rng.randint(1, 30)):
+    roll = rng.random()
+    if roll < 0.4:
+      pieces.append(rng.choice(entries)[0].replace(':', ' '))
+    elif roll < 0.7:
+      pieces.append(''.join(rng.choice(alphabet)
+                            for _ in range(rng.randint(1, 5))))
+    else:
+      pieces.append(rng.choice((' ', ' ', '.', '|', '1', '<', '<<', '+', '-',
+                                '[', ']', '~')))
+  return ''.join(pieces).replace('\n', '')
+
+
+def backspaces_and_correction(typo: str, correction: str) -> Tuple[int, str]:
+  """Returns what the firmware should erase and send for a typo."""
+  word_boundary_ending = typo[-1] == ':'
+  typo = typo.strip(':')
+  i = 0
+  while i < min(len(typo), len(correction)) and typo[i] == correction[i]:
+    i += 1
+  return len(typo) - i - 1 + word_boundary_ending, correction[i:]
+
+
+def reference(entries: List[Entry], stream: str) -> str:
+  """Types `stream` with a straightforward suffix matcher over `entries`."""
+  min_length = min(len(e[0]) for e in entries)
+  max_length = max(len(e[0]) for e in entries)
+  buffer, text, log = '', [], []
+  shift = ctrl = False
+  enabled = True
+  undo = suppressed = None
+
+  for c in stream:
+    if c in '+-[]':
+      shift = c == '+' or (shift and c in '[]')
+      ctrl = c == '[' or (ctrl and c in '+-')
+      if ctrl and c in '+[':  # Modifier press with Ctrl held resets the buffer.
+        buffer, undo, suppressed = '', None, None
+      continue
+    if c == '~':
+      enabled = not enabled
+      continue
+
+    passed = True
+    if ctrl:
+      buffer, undo, suppressed = '', None, None
+    elif undo and c == '<':  # Revert the last correction.
+      sent, restore, buffer, suppressed = undo
+      restore = restore.upper() if shift else restore
+      del text[len(text) - min(sent, len(text)):]
+      text += restore
+      log.append('<' * sent + restore)
+      undo = None
+      continue
+    elif c == '<':
+      buffer = buffer[:-1]
+      if not buffer:
+        suppressed = None
+      undo = None
+    elif c == '1':
+      buffer, undo, suppressed = '', None, None
+    elif c.isalpha() or c in ' .|':
+      undo = None
+      if c == '|':
+        buffer, suppressed = '', None
+      key = (c.upper() if shift else c) if c.isalpha() else ':'
+      buffer = buffer[-(max_length - 1):] + key
+      for typo, correction, expansion in entries:
+        if len(buffer) >= min_length and buffer.lower().endswith(typo) and (
+            expansion or enabled):
+          if typo == suppressed:
+            suppressed = None
+            break
+          backspaces, correction = backspaces_and_correction(typo, correction)
+          word = (buffer[:-1] if key == ':' else buffer).split(':')[-1]
+          if not expansion and len(word) > 1 and word.isupper():
+            correction = correction.upper()
+          elif buffer[len(buffer) - 1 - backspaces].isupper():
+            correction = correction[:1].upper() + correction[1:]
+          del text[len(text) - min(backspaces, len(text)):]
+          text += correction
+          log.append('<' * backspaces + correction)
+          passed = key == ':'
+          restore = buffer[len(buffer) - backspaces - 1:-1] + (
+              c.upper() if shift and c.isalpha() else c)
+          undo = (len(correction) + passed, restore, buffer, typo)
+          buffer = ':' if passed else ''
+          break
+
+    if not passed or ctrl:
+      continue
+    if c == '<':
+      del text[-1:]
+    else:
+      text.append(c.upper() if shift and c.isalpha() else c)
+
+  return ''.join(log) + '\t' + ''.join(text)
+
+
+def fuzz_dictionaries(task: Tuple[int, int, int]) -> Tuple[int, str]:
+  """Fuzzes `count` dictionaries derived from `seed` in a worker process."""
+  seed, count, streams = task
+  rng = random.Random(seed)
+  work_dir = tempfile.mkdtemp(prefix='fuzz_autocorrect_')
+  try:
+    for name in ('autocorrect.c', 'autocorrect.h'):
+      shutil.copy(os.path.join(FEATURES, name), work_dir)
+    with open(os.path.join(work_dir, 'fuzz_qmk.h'), 'wt') as f:
+      f.write(STUB_HEADER)
+    with open(os.path.join(work_dir, 'harness.c'), 'wt') as f:
+      f.write(HARNESS)
+    harness = os.path.join(work_dir, 'harness')
+
+    for n in range(count):
+      entries = random_dictionary(rng)
+      if not entries:
+        continue
+      data = serialize_trie(entries, make_trie(entries))
+      write_generated_code(entries, data,
+                           os.path.join(work_dir, 'autocorrect_data.h'))
+      subprocess.run(['cc', '-std=gnu11', '-O0', '-w',
+                      '-DQMK_KEYBOARD_H="fuzz_qmk.h"', '-I', work_dir,
+                      '-o', harness, os.path.join(work_dir, 'harness.c'),
+                      os.path.join(work_dir, 'autocorrect.c')], check=True)
+
+      inputs = [random_stream(rng, entries) for _ in range(streams)]
+      result = subprocess.run([harness], input='\n'.join(inputs) + '\n',
+                              capture_output=True, text=True, check=True)
+      for stream, output in zip(inputs, result.stdout.split('\n')):
+        expected = reference(entries, stream)
+        if output != expected:
+          return n, '\n'.join([
+            'Dictionary:', *(f'  {t} {"=>" if x else "->"} {c!r}'
+                             for t, c, x in entries),
+            f'Stream:   {stream!r}',
+            f'Firmware: {output!r}',
+            f'Expected: {expected!r}'])
+    return count, ''
+  finally:
+    shutil.rmtree(work_dir)
+
+
+def main(argv):
+  parser = argparse.ArgumentParser(description=__doc__.split('\n')[0])
+  parser.add_argument('--seed', type=int, default=int(time.time()))
+  parser.add_argument('--dicts', type=int, default=2000)
+  parser.add_argument('--streams', type=int, default=20)
+  parser.add_argument('--jobs', type=int, default=os.cpu_count())
+  args = parser.parse_args(argv[1:])
+
+  batch = 25
+  tasks = [(args.seed * 100003 + i, min(batch, args.dicts - i), args.streams)
+           for i in range(0, args.dicts, batch)]
+  start = time.time()
+  with multiprocessing.Pool(args.jobs) as pool:
+    for done, failure in pool.imap_unordered(fuzz_dictionaries, tasks):
+      if failure:
+        print(f'Mismatch with seed {args.seed}:\n{failure}')
+        pool.terminate()
+        sys.exit(1)
+  elapsed = time.time() - start
+  print(f'Fuzzed {args.dicts} dictionaries with {args.streams} streams each '
+        f'in {elapsed:.1f}s ({args.dicts * 60 / elapsed:.0f} per minute), '
+        f'seed {args.seed}.')
+
+
+if __name__ == '__main__':
+  main(sys.argv)
@@ -24,6 +24,28 @@ Or to read from a different typo dict file, pass it as the first argument like
 
 $ python3 make_autocorrection_data.py dict.txt
 
+Text expansions are read from an optional third argument and merged into the
+same trie, flagged so that the firmware can tell them apart from corrections:
+
+$ python3 make_autocorrection_data.py dict.txt autocorrect_data.h expansions.txt
+
+To validate the dictionary once and emit several artifacts from one run, add
+`--target name:file.h[:max_bytes]` for each header. A target with a byte limit
+keeps expansions and then the longest run of leading dictionary entries whose
+trie fits in it, so typos should be ordered by priority. `--blob prefix` writes
+the trie of each target to prefix_name.bin for runtime loading, after a header
+that sizes it, and `--manifest` writes a JSON summary of every artifact:
+
+$ python3 make_autocorrection_data.py dictionary_huge.txt \
+    --expansions expansions.txt \
+    --target arm:../autocorrect_data.h \
+    --target avr:../autocorrect_data_avr.h:9500 \
+    --blob autocorrect_data --manifest autocorrect_data.json
+
+Blob headers are 16 bytes: "AC", format version 1, header size 16, the min and
+max typo lengths, the 16-bit little endian trie size, and the target name
+padded with NULs to 8 bytes.
+
 Each line of the dict file defines one typo and its correction with the syntax
 "typo -> correction". Blank lines or lines starting with '#' are ignored.
 Example:
@@ -36,13 +58,22 @@ Example:
 
 See autocorrection_dict_extra.txt for a larger example.
 
+Expansion files use the same syntax, where the typo is an abbreviation and the
+correction is the phrase to send. Expansions may be much longer than
+corrections, as only the abbreviation is held in the firmware's buffer:
+
+  :brb:         -> be right back
+
 For full documentation, see
 https://getreuer.info/posts/keyboards/autocorrection
 """
 
+import argparse
+import json
+import struct
 import sys
 import textwrap
-from typing import Any, Dict, List, Tuple
+from typing import Any, Dict, List, Set, Tuple
 
 try:
   import english_words
@@ -58,8 +89,16 @@ except ImportError:
 
 KC_A = 4
 KC_SPC = 0x2c
-
-def parse_file(file_name: str) -> List[Tuple[str, str]]:
+# Leaf flag of a text expansion, sharing the leaf byte with the backspace count.
+EXPANSION = 64
+# Blob header format, see the module docstring.
+BLOB_VERSION = 1
+BLOB_HEADER = 16
+BLOB_NAME = 8
+
+def parse_file(file_name: str,
+               typos: Set[str] = None,
+               expansion: bool = False) -> List[Tuple[str, str, bool]]:
   """Parses autocorrections dictionary file.
 
   Each line of the file defines one typo and its correction with the syntax
@@ -69,12 +108,14 @@ def parse_file(file_name: str) -> List[Tuple[str, str]]:
 
   Args:
     file_name: String, path of the autocorrections dictionary.
+    typos: Set of typos parsed from other files that will share the same trie.
+    expansion: Bool, whether the file defines text expansions.
   Returns:
-    List of (typo, correction) tuples.
+    List of (typo, correction, expansion) tuples.
   """
 
   autocorrections = []
-  typos = set()
+  typos = set() if typos is None else typos
   line_number = 0
   for line in open(file_name, 'rt'):
     line_number += 1
@@ -107,7 +148,7 @@ def parse_file(file_name: str) -> List[Tuple[str, str]]:
                 f'"{typo}" vs. "{other_typo}".')
           sys.exit(1)
 
-      if len(typo) < 5:
+      if len(typo) < 5 and not expansion:
         print(f'Warning:{line_number}: It is suggested that typos are at '
               f'least 5 characters long to avoid false triggers: "{typo}"')
 
@@ -135,36 +176,36 @@ def parse_file(file_name: str) -> List[Tuple[str, str]]:
             print(f'Warning:{line_number}: Typo "{typo}" would falsely trigger '
                   f'on correctly spelled word "{word}".')
 
-      autocorrections.append((typo, correction))
+      autocorrections.append((typo, correction, expansion))
       typos.add(typo)
 
   return autocorrections
 
 
-def make_trie(autocorrections: List[Tuple[str, str]]) -> Dict[str, Any]:
+def make_trie(autocorrections: List[Tuple[str, str, bool]]) -> Dict[str, Any]:
   """Makes a trie from the the typos, writing in reverse.
 
   Args:
-    autocorrections: List of (typo, correction) tuples.
+    autocorrections: List of (typo, correction, expansion) tuples.
   Returns:
     Dict of dict, representing the trie.
   """
   trie = {}
-  for typo, correction in autocorrections:
+  for typo, correction, expansion in autocorrections:
     node = trie
     for letter in typo[::-1]:
       node = node.setdefault(letter, {})
-    node['LEAF'] = (typo, correction)
+    node['LEAF'] = (typo, correction, expansion)
 
   return trie
 
 
-def serialize_trie(autocorrections: List[Tuple[str, str]],
+def serialize_trie(autocorrections: List[Tuple[str, str, bool]],
                    trie: Dict[str, Any]) -> List[int]:
   """Serializes trie and correction data in a form readable by the C code.
 
   Args:
-    autocorrections: List of (typo, correction) tuples.
+    autocorrections: List of (typo, correction, expansion) tuples.
     trie: Dict of dicts.
   Returns:
     List of ints in the range 0-255.
@@ -174,7 +215,7 @@ def serialize_trie(autocorrections: List[Tuple[str, str]],
   # Traverse trie in depth first order.
   def traverse(trie_node):
     if 'LEAF' in trie_node:  # Handle a leaf trie node.
-      typo, correction = trie_node['LEAF']
+      typo, correction, expansion = trie_node['LEAF']
       word_boundary_ending = typo[-1] == ':'
       typo = typo.strip(':')
       i = 0  # Make the autocorrection data for this entry and serialize it.
@@ -183,7 +224,8 @@ def serialize_trie(autocorrections: List[Tuple[str, str]],
       backspaces = len(typo) - i - 1 + word_boundary_ending
       assert 0 <= backspaces <= 63
       correction = correction[i:]
-      data = [backspaces + 128] + list(bytes(correction, 'ascii')) + [0]
+      flags = 128 | (EXPANSION if expansion else 0)
+      data = [backspaces | flags] + list(bytes(correction, 'ascii')) + [0]
 
       entry = {'data': data, 'links': [], 'byte_offset': 0}
       table.append(entry)
@@ -238,13 +280,85 @@ def serialize_trie(autocorrections: List[Tuple[str, str]],
   return [b for e in table for b in serialize(e)]  # Serialize final table.
 
 
-def write_generated_code(autocorrections: List[Tuple[str, str]],
+def trie_stats(trie: Dict[str, Any]) -> Dict[str, int]:
+  """Counts the nodes of a trie as they will be serialized.
+
+  Args:
+    trie: Dict of dicts.
+  Returns:
+    Dict of leaf, chain and branch node counts, chain characters and depth.
+  """
+  stats = {'leaves': 0, 'chains': 0, 'chain_chars': 0, 'branches': 0,
+           'branch_links': 0, 'max_depth': 0}
+
+  def traverse(trie_node, depth):
+    stats['max_depth'] = max(stats['max_depth'], depth)
+    if 'LEAF' in trie_node:
+      stats['leaves'] += 1
+    elif len(trie_node) == 1:  # Follow chains of single-child nodes.
+      stats['chains'] += 1
+      while len(trie_node) == 1 and 'LEAF' not in trie_node:
+        trie_node = next(iter(trie_node.values()))
+        stats['chain_chars'] += 1
+        depth += 1
+      traverse(trie_node, depth)
+    else:
+      stats['branches'] += 1
+      stats['branch_links'] += len(trie_node)
+      for child in trie_node.values():
+        traverse(child, depth + 1)
+
+  traverse(trie, 0)
+  return stats
+
+
+def fit_entries(autocorrections: List[Tuple[str, str, bool]],
+                max_bytes: int) -> List[Tuple[str, str, bool]]:
+  """Returns the longest run of leading entries that serializes in `max_bytes`.
+
+  Args:
+    autocorrections: List of (typo, correction, expansion) tuples.
+    max_bytes: Int, size limit of the serialized trie.
+  Returns:
+    List of (typo, correction, expansion) tuples.
+  """
+  size = lambda n: len(serialize_trie(autocorrections[:n],
+                                      make_trie(autocorrections[:n])))
+  low, high = 0, len(autocorrections)
+  while low < high:  # Trie size grows with entries, so binary search a count.
+    mid = (low + high + 1) // 2
+    if size(mid) <= max_bytes:
+      low = mid
+    else:
+      high = mid - 1
+  if low == 0:
+    print(f'Error: No entries fit in {max_bytes} bytes.')
+    sys.exit(1)
+  return autocorrections[:low]
+
+
+def describe(autocorrections: List[Tuple[str, str, bool]],
+             trie: Dict[str, Any],
+             data: List[int]) -> Dict[str, Any]:
+  """Summarizes a serialized trie for the JSON manifest."""
+  typo_len = lambda e: len(e[0])
+  return {
+    'entries': len(autocorrections),
+    'expansions': sum(e[2] for e in autocorrections),
+    'bytes': len(data),
+    'min_length': typo_len(min(autocorrections, key=typo_len)),
+    'max_length': typo_len(max(autocorrections, key=typo_len)),
+    'nodes': trie_stats(trie),
+  }
+
+
+def write_generated_code(autocorrections: List[Tuple[str, str, bool]],
                          data: List[int],
                          file_name: str) -> None:
   """Writes autocorrection data as generated C code to `file_name`.
 
   Args:
-    autocorrections: List of (typo, correction) tuples.
+    autocorrections: List of (typo, correction, expansion) tuples.
     data: List of ints in 0-255, the serialized trie.
     file_name: String, path of the output C file.
   """
@@ -254,8 +368,9 @@ def write_generated_code(autocorrections: List[Tuple[str, str]],
   max_typo = max(autocorrections, key=typo_len)[0]
   generated_code = ''.join([
     f'/* Generated dictionary code ({len(autocorrections)} entries):\n',
-    ''.join(sorted(f'{typo:<{len(max_typo)}} -> {correction}\n'
-                   for typo, correction in autocorrections)),
+    ''.join(sorted(f'{typo:<{len(max_typo)}} {"=>" if expansion else "->"} '
+                   f'{correction}\n'
+                   for typo, correction, expansion in autocorrections)),
     '*/\n\n',
     f'#define DICTIONARY_MIN_LENGTH  {len(min_typo)}  // "{min_typo}"\n',
     f'#define DICTIONARY_MAX_LENGTH {len(max_typo)}  // "{max_typo}"\n\n',
@@ -267,15 +382,84 @@ def write_generated_code(autocorrections: List[Tuple[str, str]],
     f.write(generated_code)
 
 
+def write_blob(name: str,
+               autocorrections: List[Tuple[str, str, bool]],
+               data: List[int],
+               file_name: str) -> None:
+  """Writes a serialized trie after a blob header to `file_name`.
+
+  Args:
+    name: String, target name of up to 8 characters.
+    autocorrections: List of (typo, correction, expansion) tuples.
+    data: List of ints in 0-255, the serialized trie.
+    file_name: String, path of the output blob.
+  """
+  if len(name.encode()) > BLOB_NAME or len(data) > 0xffff:
+    print(f'Error: Target {name} does not fit a blob header.')
+    sys.exit(1)
+  typo_len = lambda e: len(e[0])
+  header = struct.pack('<2sBBBBH8s', b'AC', BLOB_VERSION, BLOB_HEADER,
+                       typo_len(min(autocorrections, key=typo_len)),
+                       typo_len(max(autocorrections, key=typo_len)),
+                       len(data), name.encode())
+  with open(file_name, 'wb') as f:
+    f.write(header + bytes(data))
+
+
 def main(argv):
-  dict_file = argv[1] if len(argv) > 1 else 'dictionary.txt'
-  out_file  = argv[2] if len(argv) > 2 else 'autocorrect_data.h'
-  autocorrections = parse_file(dict_file)
+  parser = argparse.ArgumentParser(description='Makes autocorrect_data.h.')
+  parser.add_argument('dict_file', nargs='?', default='dictionary.txt')
+  parser.add_argument('out_file', nargs='?', default='autocorrect_data.h')
+  parser.add_argument('exp_file', nargs='?')
+  parser.add_argument('--expansions')
+  parser.add_argument('--target', action='append', default=[],
+                      metavar='NAME:FILE[:MAX_BYTES]')
+  parser.add_argument('--blob', metavar='PREFIX',
+                      help='write the trie of each target to PREFIX_NAME.bin')
+  parser.add_argument('--manifest')
+  args = parser.parse_args(argv[1:])
+
+  # Parse and validate once, this is the slow part with english_words.
+  typos = set()
+  autocorrections = parse_file(args.dict_file, typos)
+  exp_file = args.expansions or args.exp_file
+  if exp_file:  # Expansions go first to survive target byte limits.
+    autocorrections = parse_file(exp_file, typos, expansion=True) + \
+                      autocorrections
   trie = make_trie(autocorrections)
   data = serialize_trie(autocorrections, trie)
   print(f'Processed %d autocorrection entries to table with %d bytes.'
         % (len(autocorrections), len(data)))
-  write_generated_code(autocorrections, data, out_file)
+  manifest = {'dictionary': describe(autocorrections, trie, data),
+              'targets': {}}
+
+  targets = args.target or [f'default:{args.out_file}']
+  for target in targets:
+    name, out_file = target.split(':', 1)
+    limit = None
+    head, _, tail = out_file.rpartition(':')
+    if head and tail.isdigit():  # Paths may contain ':', limits are numbers.
+      out_file, limit = head, int(tail)
+    entries, target_trie, target_data = autocorrections, trie, data
+    if limit is not None and len(data) > limit:
+      entries = fit_entries(autocorrections, limit)
+      target_trie = make_trie(entries)
+      target_data = serialize_trie(entries, target_trie)
+      print(f'Target {name}: kept %d entries in %d bytes.'
+            % (len(entries), len(target_data)))
+    write_generated_code(entries, target_data, out_file)
+    manifest['targets'][name] = {'file': out_file,
+                                 **describe(entries, target_trie, target_data)}
+    if args.blob:
+      blob_file = f'{args.blob}_{name}.bin'
+      write_blob(name, entries, target_data, blob_file)
+      manifest['targets'][name]['blob'] = {
+          'file': blob_file, 'bytes': BLOB_HEADER + len(target_data)}
+
+  if args.manifest:
+    with open(args.manifest, 'wt') as f:
+      json.dump(manifest, f, indent=2)
+      f.write('\n')
 
 
 if __name__ == '__main__':
@@ -0,0 +1,250 @@
+# Copyright @filterpaper
+# SPDX-License-Identifier: GPL-2.0+
+
+"""Python program to make chord_data.h.
+
+This program reads chords.txt and generates a C header with a perfect hash
+table of chords, keyed by the bitmask of their key positions. The chord engine
+in chords.c looks up a chord with two multiplications and one table probe, so
+the dictionary can grow to hundreds of words without slowing key presses. Run
+it from the repository root without arguments like
+
+$ python3 features/make_chord_data.py
+
+or to read a different chord file, pass it as the first argument like
+
+$ python3 features/make_chord_data.py my_chords.txt features/chord_data.h
+
+Each line of the chord file defines the keys of a chord and the word that it
+sends with the syntax "keys -> word". Keys are the characters of the default
+_BASE layer and are converted to their positions in the _POSN layer, so a
+chord stays on the same physical keys on Colemak. The order of keys does not
+matter, they are pressed together. Blank lines or lines starting with '#' are
+ignored. Example:
+
+  th  -> the
+  wc  -> which
+  bcs -> because
+
+Chords use the 30 alpha positions; thumb keys are left to Shift, Space and
+the layers. A chord needs at least two keys, single keys type themselves.
+"""
+
+import argparse
+import os
+import random
+import sys
+import textwrap
+from typing import Dict, List, NamedTuple
+
+from combos_report import FEATURES, ROOT, key_char, parse_defines, parse_layer
+
+CHORD_KEYS = 30
+MAX_WORD = 32
+ATTEMPTS = 256
+
+
+class Chord(NamedTuple):
+  keys: str
+  word: str
+  mask: int
+
+
+class Hash(NamedTuple):
+  slot_bits: int
+  bucket_bits: int
+  slot_mult: int
+  bucket_mult: int
+  displace: List[int]
+  slots: List[int]  # Chord index in each slot or -1
+
+
+def key_positions(layout: str) -> Dict[str, int]:
+  """Maps characters of the _BASE layer to their chord key positions."""
+  base = parse_layer(parse_defines(layout), '_BASE')
+  return {key_char(keycode): position
+          for position, keycode in enumerate(base[:CHORD_KEYS])
+          if key_char(keycode)}
+
+
+def parse_file(file_name: str, positions: Dict[str, int]) -> List[Chord]:
+  """Parses the chord file.
+
+  Validates that chords use at least two distinct keys of the base layer and
+  that no two chords share the same set of keys.
+
+  Args:
+    file_name: String, path of the chord file.
+    positions: Character to key position map of the base layer.
+  Returns:
+    List of chords with their key position bitmasks.
+  """
+  chords, masks = [], {}
+  for line_number, line in enumerate(open(file_name, 'rt'), 1):
+    line = line.strip()
+    if not line or line[0] == '#':
+      continue
+    tokens = [token.strip() for token in line.split('->', 1)]
+    if len(tokens) != 2 or not tokens[0] or not tokens[1]:
+      print(f'Error:{line_number}: Invalid syntax: "{line}"')
+      sys.exit(1)
+
+    keys, word = tokens[0].lower(), tokens[1]
+    if any(c not in positions for c in keys):
+      print(f'Error:{line_number}: Chord "{keys}" has keys that are not on '
+            f'the base layer: {" ".join(sorted(set(keys) - set(positions)))}')
+      sys.exit(1)
+    if len(set(keys)) != len(keys) or len(keys) < 2:
+      print(f'Error:{line_number}: Chord "{keys}" needs two or more '
+            'distinct keys.')
+      sys.exit(1)
+    if not word.isascii() or len(word) > MAX_WORD:
+      print(f'Error:{line_number}: Word "{word}" must be ASCII and at most '
+            f'{MAX_WORD} characters.')
+      sys.exit(1)
+
+    mask = sum(1 << positions[c] for c in keys)
+    if mask in masks:
+      print(f'Error:{line_number}: Chord "{keys}" uses the same keys as '
+            f'"{masks[mask].keys}" -> {masks[mask].word}.')
+      sys.exit(1)
+    masks[mask] = Chord(keys, word, mask)
+    chords.append(masks[mask])
+  return chords
+
+
+def mix(mask: int, mult: int, bits: int) -> int:
+  """Multiplicative hash to the top `bits` of a 32-bit product."""
+  return ((mask * mult) & 0xffffffff) >> (32 - bits)
+
+
+def place(chords: List[Chord], slot_bits: int, bucket_bits: int,
+          slot_mult: int, bucket_mult: int) -> Hash:
+  """Places chords with hash and displace, returns None if it fails.
+
+  Chords are grouped into buckets by one hash. Starting with the largest
+  bucket, each bucket gets the smallest displacement that is XORed into the
+  other hash of its chords to move all of them to free slots.
+  """
+  buckets = [[] for _ in range(1 << bucket_bits)]
+  for i, chord in enumerate(chords):
+    buckets[mix(chord.mask, bucket_mult, bucket_bits)].append(i)
+
+  slots = [-1] * (1 << slot_bits)
+  displace = [0] * (1 << bucket_bits)
+  for bucket in sorted(range(len(buckets)), key=lambda b: -len(buckets[b])):
+    members = buckets[bucket]
+    if not members:
+      break
+    hashes = [mix(chords[i].mask, slot_mult, slot_bits) for i in members]
+    if len(set(hashes)) != len(hashes):
+      return None
+    for d in range(1 << slot_bits):
+      if all(slots[h ^ d] < 0 for h in hashes):
+        for i, h in zip(members, hashes):
+          slots[h ^ d] = i
+        displace[bucket] = d
+        break
+    else:
+      return None
+  return Hash(slot_bits, bucket_bits, slot_mult, bucket_mult, displace, slots)
+
+
+def make_hash(chords: List[Chord]) -> Hash:
+  """Finds a perfect hash with the smallest power of two table."""
+  rng = random.Random(0)
+  slot_bits = max(1, (len(chords) - 1).bit_length())
+  while True:
+    bucket_bits = max(1, slot_bits - 2)
+    for _ in range(ATTEMPTS):
+      found = place(chords, slot_bits, bucket_bits,
+                    rng.getrandbits(32) | 1, rng.getrandbits(32) | 1)
+      if found:
+        return found
+    slot_bits += 1
+
+
+def lookup(h: Hash, chords: List[Chord], mask: int) -> int:
+  """Mirrors chord_lookup() of chords.c, returns a chord index or -1."""
+  slot = (mix(mask, h.slot_mult, h.slot_bits) ^
+          h.displace[mix(mask, h.bucket_mult, h.bucket_bits)])
+  i = h.slots[slot]
+  return i if i >= 0 and chords[i].mask == mask else -1
+
+
+def c_string(word: str) -> str:
+  return '"' + word.replace('\\', '\\\\').replace('"', '\\"') + '\\0"'
+
+
+def write_generated_code(chords: List[Chord], h: Hash, file_name: str) -> None:
+  """Writes the chord table as generated C code to `file_name`."""
+  offsets, lines, size = {}, [''], 0
+  for chord in chords:
+    offsets[chord.mask] = size
+    size += len(chord.word) + 1
+    literal = c_string(chord.word)
+    if len(lines[-1]) + len(literal) > 75:
+      lines.append('')
+    lines[-1] += (' ' if lines[-1] else '') + literal
+  assert size <= 0xffff
+
+  masks = [chords[i].mask if i >= 0 else 0 for i in h.slots]
+  words = [offsets[chords[i].mask] if i >= 0 else 0 for i in h.slots]
+  disp_type = 'uint8_t' if h.slot_bits <= 8 else 'uint16_t'
+  width = max(len(c.keys) for c in chords)
+  fill = lambda text: textwrap.fill(text, width=80, subsequent_indent='    ')
+
+  generated_code = ''.join([
+    f'/* Generated chord code ({len(chords)} entries):\n',
+    ''.join(sorted(f'{c.keys:<{width}} -> {c.word}\n' for c in chords)),
+    '*/\n\n',
+    f'#define CHORD_COUNT       {len(chords)}\n',
+    f'#define CHORD_SLOT_BITS   {h.slot_bits}\n',
+    f'#define CHORD_BUCKET_BITS {h.bucket_bits}\n',
+    f'#define CHORD_SLOT_MULT   0x{h.slot_mult:08x}u\n',
+    f'#define CHORD_BUCKET_MULT 0x{h.bucket_mult:08x}u\n\n',
+    fill('static const %s chord_displace[%d] PROGMEM = {%s};' % (
+      disp_type, len(h.displace), ', '.join(map(str, h.displace)))), '\n\n',
+    fill('static const uint32_t chord_masks[%d] PROGMEM = {%s};' % (
+      len(masks), ', '.join(f'0x{m:x}' for m in masks))), '\n\n',
+    fill('static const uint16_t chord_words[%d] PROGMEM = {%s};' % (
+      len(words), ', '.join(map(str, words)))), '\n\n',
+    f'static const char chord_text[{size}] PROGMEM =\n',
+    '\n'.join(f'    {line}' for line in lines), ';\n'])
+
+  with open(file_name, 'wt') as f:
+    f.write(generated_code)
+
+
+def main(argv):
+  parser = argparse.ArgumentParser(description='Makes chord_data.h.')
+  parser.add_argument('chord_file', nargs='?',
+                      default=os.path.join(FEATURES, 'chords.txt'))
+  parser.add_argument('out_file', nargs='?',
+                      default=os.path.join(FEATURES, 'chord_data.h'))
+  parser.add_argument('--layout', default=os.path.join(ROOT, 'layout.h'))
+  args = parser.parse_args(argv[1:])
+
+  chords = parse_file(args.chord_file, key_positions(args.layout))
+  if not chords:
+    print('Error: No chords found.')
+    sys.exit(1)
+  h = make_hash(chords)
+  # Check every chord and a sample of other masks against the table.
+  assert all(lookup(h, chords, c.mask) == i for i, c in enumerate(chords))
+  known = {c.mask for c in chords}
+  rng = random.Random(1)
+  for _ in range(10000):
+    mask = rng.getrandbits(CHORD_KEYS) & rng.getrandbits(CHORD_KEYS)
+    assert mask in known or lookup(h, chords, mask) < 0
+
+  write_generated_code(chords, h, args.out_file)
+  table = (1 << h.slot_bits) * 6 + (1 << h.bucket_bits) * (
+      1 if h.slot_bits <= 8 else 2)
+  print(f'Processed {len(chords)} chords to {1 << h.slot_bits} slots, '
+        f'{table} bytes of tables and '
+        f'{sum(len(c.word) + 1 for c in chords)} bytes of text.')
+
+
+if __name__ == '__main__':
+  main(sys.argv)
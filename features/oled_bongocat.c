@@ -3,8 +3,10 @@
 
 /* Graphical bongocat animation
    It has left and right aligned cats optimized for both OLEDs.
-   This code uses run-length encoded frames that saves space by
-   encoding frames into repeated or unique byte count.
+   This code uses frames compiled by oled_frames.py into the smallest of
+   raw, run-length, LZ or XOR delta encoding. Delta frames are applied to
+   the first frame of each cat and only the bytes that change between
+   them are rewritten.
 
    RLE code is modified from @vectorstorm's Bongocat:
    (https://github.com/vectorstorm/qmk_firmware/tree/bongo_rle/keyboards/crkbd/keymaps/vectorstorm)
@@ -32,203 +34,145 @@
 #define TAP_INTERVAL  FRAME_DURATION*2
 #define PAWS_INTERVAL FRAME_DURATION*8
 
-// Run-length encoded animation frames
-// Right frames
-static unsigned char const idle0[] PROGMEM = {144,
-    0x3a,0x00,0x01,0x80,0x02,0x40,0x04,0x20,0x05,0x10,0x02,0x08,0x03,0x04,0x84,0x08,
-    0x30,0x40,0x80,0x2e,0x00,0x03,0x80,0x31,0x00,0x83,0x18,0x64,0x82,0x05,0x02,0x01,
-    0x01,0x04,0x00,0x02,0x80,0x09,0x00,0x82,0x80,0x00,0x02,0x30,0x82,0x00,0xc0,0x02,
-    0xc1,0x87,0xc2,0x04,0x08,0x10,0x20,0x40,0x80,0x03,0x00,0x04,0x80,0x04,0x40,0x04,
-    0x20,0x04,0x10,0x05,0x08,0x05,0x04,0x04,0x02,0x04,0x01,0x33,0x00,0x84,0xc0,0x38,
-    0x04,0x03,0x07,0x00,0x03,0x0c,0x88,0x0d,0x01,0x00,0x40,0xa0,0x21,0x22,0x12,0x03,
-    0x11,0x01,0x09,0x04,0x08,0x02,0x04,0x02,0x08,0x05,0x10,0x82,0x11,0x0f,0x02,0x01,
-    0x36,0x00,0x05,0x80,0x05,0x40,0x05,0x20,0x05,0x10,0x05,0x08,0x05,0x04,0x82,0x02,
-    0x03,0x02,0x02,0x06,0x01,0x02,0x02,0x02,0x04,0x05,0x08,0x01,0x07,0x3d,0x00};
-static unsigned char const idle1[] PROGMEM = {147,
-    0x3a,0x00,0x01,0x80,0x02,0x40,0x04,0x20,0x04,0x10,0x02,0x08,0x01,0x04,0x03,0x02,
-    0x84,0x04,0x38,0x40,0x80,0x2e,0x00,0x03,0x80,0x31,0x00,0x82,0x1c,0xe2,0x02,0x01,
-    0x04,0x02,0x01,0x01,0x04,0x00,0x02,0x80,0x09,0x00,0x82,0x80,0x00,0x02,0x30,0x82,
-    0x00,0xc0,0x02,0xc1,0x87,0xc2,0x04,0x08,0x10,0x20,0x40,0x80,0x03,0x00,0x04,0x80,
-    0x04,0x40,0x04,0x20,0x04,0x10,0x05,0x08,0x05,0x04,0x04,0x02,0x04,0x01,0x33,0x00,
-    0x84,0x80,0x70,0x0c,0x03,0x07,0x00,0x03,0x0c,0x88,0x0d,0x01,0x00,0x40,0xa0,0x21,
-    0x22,0x12,0x03,0x11,0x01,0x09,0x04,0x08,0x02,0x04,0x02,0x08,0x05,0x10,0x82,0x11,
-    0x0f,0x02,0x01,0x36,0x00,0x05,0x80,0x05,0x40,0x05,0x20,0x05,0x10,0x05,0x08,0x05,
-    0x04,0x82,0x02,0x03,0x02,0x02,0x06,0x01,0x02,0x02,0x02,0x04,0x05,0x08,0x01,0x07,
-    0x3d,0x00};
-static unsigned char const idle2[] PROGMEM = {154,
-    0x33,0x00,0x02,0x80,0x05,0x00,0x01,0x80,0x02,0x40,0x04,0x20,0x04,0x10,0x83,0x08,
-    0x04,0x02,0x02,0x01,0x85,0x02,0x0c,0x30,0x40,0x80,0x2e,0x00,0x03,0x80,0x31,0x00,
-    0x82,0x1e,0xe1,0x02,0x00,0x02,0x01,0x02,0x02,0x01,0x01,0x04,0x00,0x02,0x80,0x09,
-    0x00,0x82,0x80,0x00,0x02,0x30,0x82,0x00,0xc0,0x02,0xc1,0x87,0xc2,0x04,0x08,0x10,
-    0x20,0x40,0x80,0x03,0x00,0x04,0x80,0x04,0x40,0x04,0x20,0x04,0x10,0x05,0x08,0x05,
-    0x04,0x04,0x02,0x04,0x01,0x33,0x00,0x84,0x80,0x70,0x0c,0x03,0x07,0x00,0x03,0x0c,
-    0x88,0x0d,0x01,0x00,0x40,0xa0,0x21,0x22,0x12,0x03,0x11,0x01,0x09,0x04,0x08,0x02,
-    0x04,0x02,0x08,0x05,0x10,0x82,0x11,0x0f,0x02,0x01,0x36,0x00,0x05,0x80,0x05,0x40,
-    0x05,0x20,0x05,0x10,0x05,0x08,0x05,0x04,0x82,0x02,0x03,0x02,0x02,0x06,0x01,0x02,
-    0x02,0x02,0x04,0x05,0x08,0x01,0x07,0x3d,0x00};
-static unsigned char const idle3[] PROGMEM = {140,
-    0x3b,0x00,0x02,0x80,0x04,0x40,0x04,0x20,0x83,0x10,0x08,0x04,0x02,0x02,0x84,0x04,
-    0x18,0x60,0x80,0x2f,0x00,0x03,0x80,0x31,0x00,0x82,0x3c,0xc2,0x02,0x01,0x02,0x02,
-    0x02,0x04,0x82,0x02,0x01,0x10,0x00,0x02,0x60,0x82,0x00,0x81,0x02,0x82,0x86,0x84,
-    0x08,0x10,0x20,0x40,0x80,0x04,0x00,0x04,0x80,0x04,0x40,0x04,0x20,0x04,0x10,0x05,
-    0x08,0x05,0x04,0x04,0x02,0x04,0x01,0x33,0x00,0x84,0x80,0x70,0x19,0x06,0x07,0x00,
-    0x03,0x18,0x88,0x1b,0x03,0x00,0x40,0xa0,0x22,0x24,0x14,0x03,0x12,0x01,0x0b,0x04,
-    0x08,0x02,0x05,0x02,0x09,0x05,0x10,0x82,0x11,0x0f,0x02,0x01,0x36,0x00,0x05,0x80,
-    0x05,0x40,0x05,0x20,0x05,0x10,0x05,0x08,0x05,0x04,0x82,0x02,0x03,0x02,0x02,0x06,
-    0x01,0x02,0x02,0x02,0x04,0x05,0x08,0x01,0x07,0x3d,0x00};
+// Frames compiled by oled_frames.py from bongocat/*.pbm
+#include "bongocat_data.h"
+_Static_assert(OLED_FRAME_SIZE == OLED_MATRIX_SIZE, "Frames are compiled for another OLED size");
+
 static unsigned char const *idle[IDLE_FRAMES] = {
     idle0, idle0, idle1, idle2, idle3 };
-
-static unsigned char const paws[] PROGMEM = {150,
-    0x33,0x00,0x02,0x80,0x05,0x00,0x01,0x80,0x02,0x40,0x04,0x20,0x04,0x10,0x83,0x08,
-    0x04,0x02,0x02,0x01,0x85,0x02,0x0c,0x30,0x40,0x80,0x2e,0x00,0x03,0x80,0x31,0x00,
-    0x82,0x1e,0xe1,0x02,0x00,0x02,0x01,0x02,0x02,0x01,0x81,0x02,0x80,0x02,0x00,0x02,
-    0x80,0x09,0x00,0x82,0x80,0x00,0x02,0x30,0x02,0x00,0x8a,0x01,0xe1,0x1a,0x06,0x09,
-    0x31,0x35,0x01,0x8a,0x7c,0x02,0x00,0x04,0x80,0x04,0x40,0x04,0x20,0x04,0x10,0x05,
-    0x08,0x05,0x04,0x04,0x02,0x04,0x01,0x33,0x00,0x84,0x80,0x70,0x0c,0x03,0x02,0x00,
-    0x88,0x18,0x06,0x05,0x98,0x99,0x84,0xc3,0x7c,0x02,0x41,0x02,0x40,0x84,0x20,0x21,
-    0x22,0x12,0x03,0x11,0x01,0x09,0x04,0x08,0x06,0x04,0x03,0x02,0x04,0x01,0x36,0x00,
-    0x05,0x80,0x05,0x40,0x05,0x20,0x05,0x10,0x05,0x08,0x05,0x04,0x82,0x02,0x03,0x02,
-    0x02,0x06,0x01,0x47,0x00};
-
-static unsigned char const tap0[] PROGMEM = {180,
-    0x33,0x00,0x02,0x80,0x05,0x00,0x01,0x80,0x02,0x40,0x04,0x20,0x04,0x10,0x83,0x08,
-    0x04,0x02,0x02,0x01,0x85,0x02,0x0c,0x30,0x40,0x80,0x07,0x00,0x04,0xf8,0x05,0x00,
-    0x02,0x80,0x1c,0x00,0x03,0x80,0x31,0x00,0x82,0x1e,0xe1,0x02,0x00,0x02,0x01,0x02,
-    0x02,0x01,0x81,0x02,0x80,0x02,0x00,0x02,0x80,0x09,0x00,0x82,0x80,0x00,0x02,0x30,
-    0x02,0x00,0x02,0x01,0x8e,0x02,0x04,0x08,0x10,0x20,0x43,0x87,0x07,0x01,0x00,0xb8,
-    0xbc,0xbe,0x9f,0x02,0x5f,0x82,0x4f,0x4c,0x04,0x20,0x04,0x10,0x05,0x08,0x05,0x04,
-    0x04,0x02,0x04,0x01,0x33,0x00,0x84,0x80,0x70,0x0c,0x03,0x02,0x00,0x88,0x18,0x06,
-    0x05,0x98,0x99,0x84,0x43,0x7c,0x02,0x41,0x02,0x40,0x84,0x20,0x21,0x22,0x12,0x03,
-    0x11,0x01,0x09,0x04,0x08,0x02,0x04,0x02,0x08,0x05,0x10,0x85,0x11,0x0f,0x01,0x3d,
-    0x7c,0x05,0xfc,0x82,0x3c,0x0c,0x2e,0x00,0x05,0x80,0x05,0x40,0x05,0x20,0x05,0x10,
-    0x05,0x08,0x05,0x04,0x82,0x02,0x03,0x02,0x02,0x06,0x01,0x24,0x00,0x01,0x01,0x02,
-    0x03,0x20,0x00};
-static unsigned char const tap1[] PROGMEM = {153,
-    0x33,0x00,0x02,0x80,0x05,0x00,0x01,0x80,0x02,0x40,0x04,0x20,0x04,0x10,0x83,0x08,
-    0x04,0x02,0x02,0x01,0x85,0x02,0x0c,0x30,0x40,0x80,0x2e,0x00,0x03,0x80,0x31,0x00,
-    0x82,0x1e,0xe1,0x02,0x00,0x02,0x01,0x02,0x02,0x01,0x01,0x04,0x00,0x02,0x80,0x09,
-    0x00,0x82,0x80,0x00,0x02,0x30,0x02,0x00,0x8a,0x01,0xe1,0x1a,0x06,0x09,0x31,0x35,
-    0x01,0x8a,0x7c,0x02,0x00,0x04,0x80,0x04,0x40,0x04,0x20,0x04,0x10,0x05,0x08,0x05,
-    0x04,0x04,0x02,0x04,0x01,0x33,0x00,0x84,0x80,0x70,0x0c,0x03,0x0a,0x00,0x02,0x01,
-    0x86,0x00,0x40,0xa0,0x21,0x22,0x12,0x03,0x11,0x01,0x09,0x04,0x08,0x06,0x04,0x03,
-    0x02,0x04,0x01,0x36,0x00,0x05,0x80,0x05,0x40,0x05,0x20,0x05,0x10,0x05,0x08,0x05,
-    0x04,0x82,0x02,0x03,0x02,0x7a,0x04,0x79,0x82,0x39,0x31,0x02,0x02,0x02,0x04,0x03,
-    0x08,0x02,0x88,0x82,0x87,0x80,0x3c,0x00};
 static unsigned char const *tap[TAP_FRAMES] = {
     tap0, tap1 };
-
-
-// Left frames
-static unsigned char const left_idle0[] PROGMEM = {142,
-    0x03,0x80,0x2e,0x00,0x84,0x80,0x40,0x30,0x08,0x03,0x04,0x02,0x08,0x05,0x10,0x04,
-    0x20,0x02,0x40,0x01,0x80,0x3d,0x00,0x04,0x01,0x04,0x02,0x05,0x04,0x05,0x08,0x04,
-    0x10,0x04,0x20,0x04,0x40,0x04,0x80,0x03,0x00,0x87,0x80,0x40,0x20,0x10,0x08,0x04,
-    0xc2,0x02,0xc1,0x82,0xc0,0x00,0x02,0x30,0x82,0x00,0x80,0x09,0x00,0x02,0x80,0x04,
-    0x00,0x01,0x01,0x05,0x02,0x83,0x82,0x64,0x18,0x56,0x00,0x02,0x01,0x82,0x0f,0x11,
-    0x05,0x10,0x02,0x08,0x02,0x04,0x04,0x08,0x01,0x09,0x03,0x11,0x88,0x12,0x22,0x21,
-    0xa0,0x40,0x00,0x01,0x0d,0x03,0x0c,0x07,0x00,0x84,0x03,0x04,0x38,0xc0,0x6d,0x00,
-    0x01,0x07,0x05,0x08,0x02,0x04,0x02,0x02,0x06,0x01,0x02,0x02,0x82,0x03,0x02,0x05,
-    0x04,0x05,0x08,0x05,0x10,0x05,0x20,0x05,0x40,0x05,0x80,0x11,0x00};
-static unsigned char const left_idle1[] PROGMEM = {145,
-    0x03,0x80,0x2e,0x00,0x84,0x80,0x40,0x38,0x04,0x03,0x02,0x01,0x04,0x02,0x08,0x04,
-    0x10,0x04,0x20,0x02,0x40,0x01,0x80,0x3d,0x00,0x04,0x01,0x04,0x02,0x05,0x04,0x05,
-    0x08,0x04,0x10,0x04,0x20,0x04,0x40,0x04,0x80,0x03,0x00,0x87,0x80,0x40,0x20,0x10,
-    0x08,0x04,0xc2,0x02,0xc1,0x82,0xc0,0x00,0x02,0x30,0x82,0x00,0x80,0x09,0x00,0x02,
-    0x80,0x04,0x00,0x01,0x01,0x04,0x02,0x02,0x01,0x82,0xe2,0x1c,0x56,0x00,0x02,0x01,
-    0x82,0x0f,0x11,0x05,0x10,0x02,0x08,0x02,0x04,0x04,0x08,0x01,0x09,0x03,0x11,0x88,
-    0x12,0x22,0x21,0xa0,0x40,0x00,0x01,0x0d,0x03,0x0c,0x07,0x00,0x84,0x03,0x0c,0x70,
-    0x80,0x6d,0x00,0x01,0x07,0x05,0x08,0x02,0x04,0x02,0x02,0x06,0x01,0x02,0x02,0x82,
-    0x03,0x02,0x05,0x04,0x05,0x08,0x05,0x10,0x05,0x20,0x05,0x40,0x05,0x80,0x11,0x00};
-static unsigned char const left_idle2[] PROGMEM = {152,
-    0x03,0x80,0x2e,0x00,0x85,0x80,0x40,0x30,0x0c,0x02,0x02,0x01,0x83,0x02,0x04,0x08,
-    0x04,0x10,0x04,0x20,0x02,0x40,0x01,0x80,0x05,0x00,0x02,0x80,0x36,0x00,0x04,0x01,
-    0x04,0x02,0x05,0x04,0x05,0x08,0x04,0x10,0x04,0x20,0x04,0x40,0x04,0x80,0x03,0x00,
-    0x87,0x80,0x40,0x20,0x10,0x08,0x04,0xc2,0x02,0xc1,0x82,0xc0,0x00,0x02,0x30,0x82,
-    0x00,0x80,0x09,0x00,0x02,0x80,0x04,0x00,0x01,0x01,0x02,0x02,0x02,0x01,0x02,0x00,
-    0x82,0xe1,0x1e,0x56,0x00,0x02,0x01,0x82,0x0f,0x11,0x05,0x10,0x02,0x08,0x02,0x04,
-    0x04,0x08,0x01,0x09,0x03,0x11,0x88,0x12,0x22,0x21,0xa0,0x40,0x00,0x01,0x0d,0x03,
-    0x0c,0x07,0x00,0x84,0x03,0x0c,0x70,0x80,0x6d,0x00,0x01,0x07,0x05,0x08,0x02,0x04,
-    0x02,0x02,0x06,0x01,0x02,0x02,0x82,0x03,0x02,0x05,0x04,0x05,0x08,0x05,0x10,0x05,
-    0x20,0x05,0x40,0x05,0x80,0x11,0x00};
-static unsigned char const left_idle3[] PROGMEM = {138,
-    0x03,0x80,0x2f,0x00,0x84,0x80,0x60,0x18,0x04,0x02,0x02,0x83,0x04,0x08,0x10,0x04,
-    0x20,0x04,0x40,0x02,0x80,0x3e,0x00,0x04,0x01,0x04,0x02,0x05,0x04,0x05,0x08,0x04,
-    0x10,0x04,0x20,0x04,0x40,0x04,0x80,0x04,0x00,0x86,0x80,0x40,0x20,0x10,0x08,0x84,
-    0x02,0x82,0x82,0x81,0x00,0x02,0x60,0x10,0x00,0x82,0x01,0x02,0x02,0x04,0x02,0x02,
-    0x02,0x01,0x82,0xc2,0x3c,0x56,0x00,0x02,0x01,0x82,0x0f,0x11,0x05,0x10,0x02,0x09,
-    0x02,0x05,0x04,0x08,0x01,0x0b,0x03,0x12,0x88,0x14,0x24,0x22,0xa0,0x40,0x00,0x03,
-    0x1b,0x03,0x18,0x07,0x00,0x84,0x06,0x19,0x70,0x80,0x6d,0x00,0x01,0x07,0x05,0x08,
-    0x02,0x04,0x02,0x02,0x06,0x01,0x02,0x02,0x82,0x03,0x02,0x05,0x04,0x05,0x08,0x05,
-    0x10,0x05,0x20,0x05,0x40,0x05,0x80,0x11,0x00};
 static unsigned char const *left_idle[IDLE_FRAMES] = {
     left_idle0, left_idle0, left_idle1, left_idle2, left_idle3 };
-
-static unsigned char const left_paws[] PROGMEM = {148,
-    0x03,0x80,0x2e,0x00,0x85,0x80,0x40,0x30,0x0c,0x02,0x02,0x01,0x83,0x02,0x04,0x08,
-    0x04,0x10,0x04,0x20,0x02,0x40,0x01,0x80,0x05,0x00,0x02,0x80,0x36,0x00,0x04,0x01,
-    0x04,0x02,0x05,0x04,0x05,0x08,0x04,0x10,0x04,0x20,0x04,0x40,0x04,0x80,0x02,0x00,
-    0x8a,0x7c,0x8a,0x01,0x35,0x31,0x09,0x06,0x1a,0xe1,0x01,0x02,0x00,0x02,0x30,0x82,
-    0x00,0x80,0x09,0x00,0x02,0x80,0x02,0x00,0x02,0x80,0x01,0x81,0x02,0x02,0x02,0x01,
-    0x02,0x00,0x82,0xe1,0x1e,0x56,0x00,0x04,0x01,0x03,0x02,0x06,0x04,0x04,0x08,0x01,
-    0x09,0x03,0x11,0x84,0x12,0x22,0x21,0x20,0x02,0x40,0x02,0x41,0x88,0x7c,0xc3,0x84,
-    0x99,0x98,0x05,0x06,0x18,0x02,0x00,0x84,0x03,0x0c,0x70,0x80,0x77,0x00,0x06,0x01,
-    0x02,0x02,0x82,0x03,0x02,0x05,0x04,0x05,0x08,0x05,0x10,0x05,0x20,0x05,0x40,0x05,
-    0x80,0x11,0x00};
-
-static unsigned char const left_tap0[] PROGMEM = {178,
-    0x03,0x80,0x1c,0x00,0x02,0x80,0x05,0x00,0x04,0xf8,0x07,0x00,0x85,0x80,0x40,0x30,
-    0x0c,0x02,0x02,0x01,0x83,0x02,0x04,0x08,0x04,0x10,0x04,0x20,0x02,0x40,0x01,0x80,
-    0x05,0x00,0x02,0x80,0x36,0x00,0x04,0x01,0x04,0x02,0x05,0x04,0x05,0x08,0x04,0x10,
-    0x04,0x20,0x82,0x4c,0x4f,0x02,0x5f,0x8e,0x9f,0xbe,0xbc,0xb8,0x00,0x01,0x07,0x87,
-    0x43,0x20,0x10,0x08,0x04,0x02,0x02,0x01,0x02,0x00,0x02,0x30,0x82,0x00,0x80,0x09,
-    0x00,0x02,0x80,0x02,0x00,0x02,0x80,0x01,0x81,0x02,0x02,0x02,0x01,0x02,0x00,0x82,
-    0xe1,0x1e,0x4e,0x00,0x82,0x0c,0x3c,0x05,0xfc,0x85,0x7c,0x3d,0x01,0x0f,0x11,0x05,
-    0x10,0x02,0x08,0x02,0x04,0x04,0x08,0x01,0x09,0x03,0x11,0x84,0x12,0x22,0x21,0x20,
-    0x02,0x40,0x02,0x41,0x88,0x7c,0x43,0x84,0x99,0x98,0x05,0x06,0x18,0x02,0x00,0x84,
-    0x03,0x0c,0x70,0x80,0x50,0x00,0x02,0x03,0x01,0x01,0x24,0x00,0x06,0x01,0x02,0x02,
-    0x82,0x03,0x02,0x05,0x04,0x05,0x08,0x05,0x10,0x05,0x20,0x05,0x40,0x05,0x80,0x11,
-    0x00};
-static unsigned char const left_tap1[] PROGMEM = {151,
-    0x03,0x80,0x2e,0x00,0x85,0x80,0x40,0x30,0x0c,0x02,0x02,0x01,0x83,0x02,0x04,0x08,
-    0x04,0x10,0x04,0x20,0x02,0x40,0x01,0x80,0x05,0x00,0x02,0x80,0x36,0x00,0x04,0x01,
-    0x04,0x02,0x05,0x04,0x05,0x08,0x04,0x10,0x04,0x20,0x04,0x40,0x04,0x80,0x02,0x00,
-    0x8a,0x7c,0x8a,0x01,0x35,0x31,0x09,0x06,0x1a,0xe1,0x01,0x02,0x00,0x02,0x30,0x82,
-    0x00,0x80,0x09,0x00,0x02,0x80,0x04,0x00,0x01,0x01,0x02,0x02,0x02,0x01,0x02,0x00,
-    0x82,0xe1,0x1e,0x56,0x00,0x04,0x01,0x03,0x02,0x06,0x04,0x04,0x08,0x01,0x09,0x03,
-    0x11,0x86,0x12,0x22,0x21,0xa0,0x40,0x00,0x02,0x01,0x0a,0x00,0x84,0x03,0x0c,0x70,
-    0x80,0x6c,0x00,0x82,0x80,0x87,0x02,0x88,0x03,0x08,0x02,0x04,0x02,0x02,0x82,0x31,
-    0x39,0x04,0x79,0x02,0x7a,0x82,0x03,0x02,0x05,0x04,0x05,0x08,0x05,0x10,0x05,0x20,
-    0x05,0x40,0x05,0x80,0x11,0x00};
 static unsigned char const *left_tap[TAP_FRAMES] = {
     left_tap0, left_tap1 };
 
+// Frame buffer that mirrors the animation on the OLED
+static char buffer[OLED_MATRIX_SIZE];
+
 
-// RLE decoding loop that reads count from frame index
+// Decodes a full frame into the frame buffer, the first byte of a frame
+// is its encoding. RLE frames start with their size and read counts:
 // If count >= 0x80, next (count - 128) bytes are unique
 // If count < 0x80, next byte is repeated by count
+// LZ frames read tokens until the buffer is full:
+// If token >= 0x80, copy (token - 125) bytes from a 16-bit distance back
+// If token < 0x80, next (token + 1) bytes are literals
+// RLE2 frames start with a 16-bit size for frames over 255 bytes and read
+// control bytes with the unique flag in bit 7 and a long flag in bit 6:
+// Count is bits 5-0, or 14 bits with the next byte if the run is long
 static void decode_frame(unsigned char const *frame) {
     uint16_t cursor = 0;
-    uint8_t i = 1, size = pgm_read_byte(frame);
 
-    oled_set_cursor(0,0);
-    while (i < size) {
-        uint8_t count = pgm_read_byte(frame + i); i++;
-        if (count & 0x80) {
-            // Next count-128 bytes are unique
-            count &= ~(0x80);
-            for (uint8_t uniqs = 0; uniqs < count; ++uniqs) {
-                uint8_t byte = pgm_read_byte(frame + i); i++;
-                oled_write_raw_byte(byte, cursor++);
+    switch (pgm_read_byte(frame++)) {
+        case OLED_FRAME_RAW:
+            memcpy_P(buffer, frame, sizeof(buffer));
+            break;
+
+        case OLED_FRAME_RLE:
+            for (uint8_t i = 1, size = pgm_read_byte(frame); i < size;) {
+                uint8_t count = pgm_read_byte(frame + i); i++;
+                if (count & 0x80) {
+                    // Next count-128 bytes are unique
+                    count &= ~(0x80);
+                    if (cursor + count > sizeof(buffer)) break;
+                    memcpy_P(buffer + cursor, frame + i, count);
+                    i += count;
+                } else {
+                    // Next byte is repeated by count
+                    if (cursor + count > sizeof(buffer)) break;
+                    memset(buffer + cursor, pgm_read_byte(frame + i), count);
+                    i++;
+                }
+                cursor += count;
             }
-        } else {
-            // Next byte is repeated by count
-            uint8_t byte = pgm_read_byte(frame + i); i++;
-            for (uint8_t reps = 0; reps < count; ++reps) {
-                oled_write_raw_byte(byte, cursor++);
+            break;
+
+        case OLED_FRAME_RLE2: {
+            unsigned char const *const end = frame + 2 + (pgm_read_byte(frame) | pgm_read_byte(frame + 1) << 8);
+            for (frame += 2; frame < end;) {
+                uint8_t const control = pgm_read_byte(frame++);
+                uint16_t      count   = control & 0x3f;
+                if (control & 0x40) count = count << 8 | pgm_read_byte(frame++);
+                if (cursor + count > sizeof(buffer)) break;
+                if (control & 0x80) {
+                    // Next count bytes are unique
+                    memcpy_P(buffer + cursor, frame, count);
+                    frame += count;
+                } else {
+                    // Next byte is repeated by count
+                    memset(buffer + cursor, pgm_read_byte(frame++), count);
+                }
+                cursor += count;
             }
+            break;
         }
+
+        case OLED_FRAME_LZ:
+            while (cursor < sizeof(buffer)) {
+                uint8_t const token = pgm_read_byte(frame++);
+                if (token & 0x80) {
+                    // Copy from earlier bytes that may overlap the copy
+                    uint16_t const distance = pgm_read_byte(frame) | pgm_read_byte(frame + 1) << 8;
+                    uint8_t  const count    = (token & 0x7f) + 3;
+                    frame += 2;
+                    if (distance > cursor || cursor + count > sizeof(buffer)) break;
+                    for (uint8_t n = 0; n < count; ++n, ++cursor) buffer[cursor] = buffer[cursor - distance];
+                } else {
+                    uint8_t const count = token + 1;
+                    if (cursor + count > sizeof(buffer)) break;
+                    memcpy_P(buffer + cursor, frame, count);
+                    frame  += count;
+                    cursor += count;
+                }
+            }
+            break;
+    }
+}
+
+
+// XOR delta loop that reads records of skip and length counts
+// Length bytes after skipping are XORed into the frame buffer, or written
+// to the OLED from the frame buffer, until a record of 0, 0
+static void apply_delta(unsigned char const *delta, bool const write) {
+    uint16_t cursor = 0;
+    for (++delta;;) {
+        uint8_t const skip = pgm_read_byte(delta), len = pgm_read_byte(delta + 1);
+        delta += 2;
+        if (!skip && !len) return;
+        cursor += skip;
+        for (uint8_t n = 0; n < len; ++n, ++cursor, ++delta) {
+            if (write) oled_write_raw_byte(buffer[cursor], cursor);
+            else buffer[cursor] ^= pgm_read_byte(delta);
+        }
+    }
+}
+
+
+// Delta frames are applied to the base frame, the first frame of each cat.
+// Between delta frames and the base, which is an empty delta, the delta on
+// display is reverted before the next one is applied, and only the bytes of
+// both are written. Other frames are decoded and written in full, the OLED
+// driver marks changed blocks dirty.
+static void render_frame(unsigned char const *frame) {
+    static unsigned char const *shown   = NULL;  // Delta on display
+    static bool                 on_base = false; // Buffer is base and shown delta
+    unsigned char const *const  base    = is_keyboard_left() ? left_idle0 : idle0;
+    bool const                  delta   = pgm_read_byte(frame) == OLED_FRAME_DELTA;
+
+    if (on_base && (delta || frame == base)) {
+        if (shown) apply_delta(shown, false);
+        if (delta) apply_delta(frame, false);
+        if (shown) apply_delta(shown, true);
+        if (delta) apply_delta(frame, true);
+    } else {
+        decode_frame(delta ? base : frame);
+        if (delta) apply_delta(frame, false);
+        oled_set_cursor(0, 0);
+        oled_write_raw(buffer, sizeof(buffer));
     }
+    on_base = delta || frame == base;
+    shown   = delta ? frame : NULL;
 }
 
 
@@ -237,12 +181,12 @@ static void animate_cat(uint32_t interval) {
 
     if (interval < TAP_INTERVAL) {
         tap_index = (tap_index + 1) & 1;
-        decode_frame(is_keyboard_left() ? left_tap[tap_index] : tap[tap_index]);
+        render_frame(is_keyboard_left() ? left_tap[tap_index] : tap[tap_index]);
     } else if (interval < PAWS_INTERVAL) {
-        decode_frame(is_keyboard_left() ? left_paws : paws);
+        render_frame(is_keyboard_left() ? left_paws : paws);
     } else {
         idle_index = idle_index < IDLE_FRAMES - 1 ? idle_index + 1 : 0;
-        decode_frame(is_keyboard_left() ? left_idle[idle_index] : idle[idle_index]);
+        render_frame(is_keyboard_left() ? left_idle[idle_index] : idle[idle_index]);
     }
 }
 
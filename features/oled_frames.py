@@ -0,0 +1,477 @@
+# Copyright @filterpaper
+# SPDX-License-Identifier: GPL-2.0+
+
+"""Python program to compile OLED animation frames into a C header.
+
+This program reads 128x32 frames, or other sizes with --size, from PNG, PBM
+or raw images and generates PROGMEM arrays for oled_bongocat.c. Each frame is
+encoded as raw bytes, RLE, LZ or an XOR delta from the first frame of its
+group, whichever is smallest, and every encoding is decoded again to check
+that it matches the image. Run it from the repository root without
+arguments to build the bongocat frames from features/bongocat into
+features/bongocat_data.h like
+
+$ python3 features/oled_frames.py
+
+or to compile other frames, pass groups of images like
+
+$ python3 features/oled_frames.py -o features/my_data.h \\
+    --group base.png frame1.png frame2.png --group left.pbm left1.pbm
+
+Array names are the image file names without extension. The first image of a
+group is its base frame, the others may be deltas from it, so frames of one
+group should share most of their pixels.
+
+Images:
+  .png  Non-interlaced PNG of any color type, dark pixels are lit
+  .pbm  Plain (P1) or raw (P4) PBM, 1 (black) is lit
+  .bin  Frame bytes in OLED page order, 512 for 128x32
+
+Encodings, from the first byte of each array:
+  0 RAW    Frame bytes in OLED page order.
+  1 RLE    Size byte of the RLE data, then count bytes. A count below 0x80
+           repeats the next byte count times, a count of 0x80 or above is
+           followed by (count - 128) unique bytes. It only fits frames that
+           encode to 255 bytes.
+  2 LZ     Tokens until the frame is decoded. A token below 0x80 is followed
+           by (token + 1) literal bytes, a token of 0x80 or above copies
+           (token - 128 + 3) bytes from a 16-bit little endian distance back.
+  3 DELTA  Records of a count of bytes to skip, a count of bytes to XOR into
+           the base frame and those bytes, ending with a 0, 0 record.
+  4 RLE2   16-bit little endian size of the runs that follow. A run starts
+           with a control byte, where bit 7 marks unique bytes and bit 6 a
+           14-bit count with the next byte as the low byte, else the count
+           is in bits 5 to 0. Unique runs are followed by count bytes and
+           repeat runs by the byte to repeat.
+"""
+
+import argparse
+import os
+import struct
+import sys
+import textwrap
+import zlib
+from typing import Callable, Dict, List, NamedTuple, Optional
+
+FEATURES = os.path.dirname(os.path.abspath(__file__))
+WIDTH = 128
+HEIGHT = 32
+FRAME_SIZE = WIDTH * HEIGHT // 8  # Set with WIDTH and HEIGHT by --size
+BONGOCAT = ['idle0', 'idle1', 'idle2', 'idle3', 'paws', 'tap0', 'tap1']
+
+RAW, RLE, LZ, DELTA, RLE2 = range(5)
+ENCODINGS = ['RAW', 'RLE', 'LZ', 'DELTA', 'RLE2']
+MAX_RUN = 0x7f
+MAX_GAP = 2  # Unchanged bytes worth XORing to save a delta record header
+MIN_MATCH = 3
+MAX_MATCH = MAX_RUN + MIN_MATCH
+MAX_SHORT_RUN = 0x3f
+MAX_LONG_RUN = 0x3fff
+
+
+class Frame(NamedTuple):
+  name: str
+  image: List[int]
+  sizes: Dict[int, int]  # Size of each encoding that fits
+  data: List[int]  # Smallest encoding with its leading encoding byte
+
+
+def pixels_to_frame(pixel: Callable[[int, int], int]) -> List[int]:
+  """Packs lit pixels into OLED bytes.
+
+  Returns:
+    List of frame bytes in OLED page order, each byte a column of 8 pixels
+    with the top pixel in the lowest bit.
+  """
+  return [sum(pixel(x, page * 8 + bit) << bit for bit in range(8))
+          for page in range(HEIGHT // 8) for x in range(WIDTH)]
+
+
+def check_size(file_name: str, width: int, height: int) -> None:
+  if (width, height) != (WIDTH, HEIGHT):
+    print(f'Error: {file_name} is {width}x{height}, not {WIDTH}x{HEIGHT}.')
+    sys.exit(1)
+
+
+def read_pbm(file_name: str) -> List[int]:
+  """Reads a plain or raw PBM image as OLED bytes."""
+  data = open(file_name, 'rb').read()
+  tokens, pos = [], 0
+  while len(tokens) < 3:
+    while data[pos:pos + 1].isspace():
+      pos += 1
+    if data[pos:pos + 1] == b'#':
+      pos = data.index(b'\n', pos)
+      continue
+    end = pos
+    while end < len(data) and not data[end:end + 1].isspace():
+      end += 1
+    tokens.append(data[pos:end])
+    pos = end
+  check_size(file_name, int(tokens[1]), int(tokens[2]))
+
+  if tokens[0] == b'P4':
+    raster = data[pos + 1:]
+    row_bytes = (WIDTH + 7) // 8
+    return pixels_to_frame(
+        lambda x, y: raster[y * row_bytes + x // 8] >> (7 - x % 8) & 1)
+  if tokens[0] == b'P1':
+    bits = [int(c) for c in data[pos:].decode() if c in '01']
+    return pixels_to_frame(lambda x, y: bits[y * WIDTH + x])
+  print(f'Error: {file_name} is not a PBM image.')
+  sys.exit(1)
+
+
+def read_png(file_name: str) -> List[int]:
+  """Reads a non-interlaced PNG image as OLED bytes, dark pixels are lit."""
+  data = open(file_name, 'rb').read()
+  if data[:8] != b'\x89PNG\r\n\x1a\n':
+    print(f'Error: {file_name} is not a PNG image.')
+    sys.exit(1)
+  pos, idat, palette, header = 8, b'', [], None
+  while pos < len(data):
+    length, kind = struct.unpack('>I4s', data[pos:pos + 8])
+    chunk = data[pos + 8:pos + 8 + length]
+    if kind == b'IHDR':
+      header = struct.unpack('>IIBBBBB', chunk)
+    elif kind == b'PLTE':
+      palette = [tuple(chunk[i:i + 3]) for i in range(0, length, 3)]
+    elif kind == b'IDAT':
+      idat += chunk
+    pos += 12 + length
+  width, height, depth, color, _, _, interlace = header
+  check_size(file_name, width, height)
+  if interlace:
+    print(f'Error: {file_name} is interlaced.')
+    sys.exit(1)
+
+  channels = {0: 1, 2: 3, 3: 1, 4: 2, 6: 4}[color]
+  bpp = max(1, channels * depth // 8)  # Bytes per pixel for filters
+  stride = (width * channels * depth + 7) // 8
+  raw, rows, prev = zlib.decompress(idat), [], bytearray(stride)
+  for y in range(height):
+    kind = raw[y * (stride + 1)]
+    line = bytearray(raw[y * (stride + 1) + 1:(y + 1) * (stride + 1)])
+    for i in range(stride):
+      a = line[i - bpp] if i >= bpp else 0
+      b, c = prev[i], prev[i - bpp] if i >= bpp else 0
+      if kind == 1:
+        line[i] = (line[i] + a) & 0xff
+      elif kind == 2:
+        line[i] = (line[i] + b) & 0xff
+      elif kind == 3:
+        line[i] = (line[i] + (a + b) // 2) & 0xff
+      elif kind == 4:
+        p = a + b - c
+        pa, pb, pc = abs(p - a), abs(p - b), abs(p - c)
+        line[i] = (line[i] + (a if pa <= pb and pa <= pc else
+                              b if pb <= pc else c)) & 0xff
+    rows.append(line)
+    prev = line
+
+  def sample(x: int, y: int, channel: int) -> int:
+    """Returns a channel scaled to 8 bits, or a palette index."""
+    if depth >= 8:
+      return rows[y][(x * channels + channel) * (depth // 8)]
+    bit = (x * channels + channel) * depth
+    value = rows[y][bit // 8] >> (8 - depth - bit % 8) & ((1 << depth) - 1)
+    return value if color == 3 else value * 255 // ((1 << depth) - 1)
+
+  def lit(x: int, y: int) -> int:
+    alpha = 255
+    if color == 3:
+      rgb = palette[sample(x, y, 0)]
+    elif color in (0, 4):
+      rgb = (sample(x, y, 0),) * 3
+      alpha = sample(x, y, 1) if color == 4 else alpha
+    else:
+      rgb = tuple(sample(x, y, i) for i in range(3))
+      alpha = sample(x, y, 3) if color == 6 else alpha
+    luma = (299 * rgb[0] + 587 * rgb[1] + 114 * rgb[2]) // 1000
+    return int(alpha >= 128 and luma < 128)
+
+  return pixels_to_frame(lit)
+
+
+def read_raw(file_name: str) -> List[int]:
+  """Reads frame bytes in OLED page order."""
+  data = open(file_name, 'rb').read()
+  if len(data) != FRAME_SIZE:
+    print(f'Error: {file_name} has {len(data)} bytes, not {FRAME_SIZE}.')
+    sys.exit(1)
+  return list(data)
+
+
+def read_image(file_name: str) -> List[int]:
+  readers = {'.png': read_png, '.pbm': read_pbm, '.bin': read_raw}
+  extension = os.path.splitext(file_name)[1].lower()
+  if extension not in readers:
+    print(f'Error: {file_name} is not a .png, .pbm or .bin image.')
+    sys.exit(1)
+  return readers[extension](file_name)
+
+
+def rle_encode(frame: List[int]) -> Optional[List[int]]:
+  """Encodes a frame with RLE, returns None if it exceeds the size byte."""
+  out, uniques, i = [0], [], 0
+
+  def flush():
+    if uniques:
+      out.extend([0x80 | len(uniques)] + uniques)
+      uniques.clear()
+
+  while i < len(frame):
+    run = 1
+    while i + run < len(frame) and frame[i + run] == frame[i] and run < MAX_RUN:
+      run += 1
+    if run >= 3 or (run == 2 and not uniques):
+      flush()
+      out.extend([run, frame[i]])
+    else:
+      uniques.extend(frame[i:i + run])
+      if len(uniques) >= MAX_RUN:
+        out.extend([0x80 | MAX_RUN] + uniques[:MAX_RUN])
+        del uniques[:MAX_RUN]
+    i += run
+  flush()
+  if len(out) > 0xff:
+    return None
+  out[0] = len(out)
+  return out
+
+
+def rle2_encode(frame: List[int]) -> List[int]:
+  """Encodes a frame with RLE2 runs of any length and a 16-bit size."""
+  out, uniques, i = [], [], 0
+
+  def control(unique: int, count: int) -> List[int]:
+    if count > MAX_SHORT_RUN:
+      return [unique | 0x40 | count >> 8, count & 0xff]
+    return [unique | count]
+
+  def flush():
+    if uniques:
+      out.extend(control(0x80, len(uniques)) + uniques)
+      uniques.clear()
+
+  while i < len(frame):
+    run = 1
+    while (i + run < len(frame) and frame[i + run] == frame[i] and
+           run < MAX_LONG_RUN):
+      run += 1
+    if run >= 3 or (run == 2 and not uniques):
+      flush()
+      out.extend(control(0, run) + [frame[i]])
+    else:
+      uniques.extend(frame[i:i + run])
+      if len(uniques) == MAX_LONG_RUN:
+        flush()
+    i += run
+  flush()
+  return [len(out) & 0xff, len(out) >> 8] + out
+
+
+def rle2_decode(rle: List[int]) -> List[int]:
+  """Mirrors the RLE2 case of decode_frame() in oled_bongocat.c."""
+  frame, i, end = [], 2, 2 + (rle[0] | rle[1] << 8)
+  while i < end:
+    control, count = rle[i], rle[i] & MAX_SHORT_RUN
+    i += 1
+    if control & 0x40:
+      count = count << 8 | rle[i]
+      i += 1
+    if control & 0x80:
+      frame.extend(rle[i:i + count])
+      i += count
+    else:
+      frame.extend([rle[i]] * count)
+      i += 1
+  return frame
+
+
+def rle_decode(rle: List[int]) -> List[int]:
+  """Mirrors the RLE case of decode_frame() in oled_bongocat.c."""
+  frame, i = [], 1
+  while i < rle[0]:
+    count = rle[i] & MAX_RUN
+    if rle[i] & 0x80:
+      frame.extend(rle[i + 1:i + 1 + count])
+      i += 1 + count
+    else:
+      frame.extend([rle[i + 1]] * count)
+      i += 2
+  return frame
+
+
+def lz_encode(frame: List[int]) -> List[int]:
+  """Encodes a frame with greedy longest matches and literal runs."""
+  out, literals, i = [], [], 0
+
+  def flush():
+    while literals:
+      run = literals[:MAX_RUN + 1]
+      out.extend([len(run) - 1] + run)
+      del literals[:MAX_RUN + 1]
+
+  while i < len(frame):
+    length, distance = 0, 0
+    for start in range(i):
+      n = 0
+      while (n < MAX_MATCH and i + n < len(frame) and
+             frame[start + n] == frame[i + n]):
+        n += 1
+      if n >= length:
+        length, distance = n, i - start
+    if length >= MIN_MATCH:
+      flush()
+      out.extend([0x80 | (length - MIN_MATCH), distance & 0xff, distance >> 8])
+      i += length
+    else:
+      literals.append(frame[i])
+      i += 1
+  flush()
+  return out
+
+
+def lz_decode(lz: List[int]) -> List[int]:
+  """Mirrors the LZ case of decode_frame() in oled_bongocat.c."""
+  frame, i = [], 0
+  while len(frame) < FRAME_SIZE:
+    token = lz[i]
+    if token & 0x80:
+      distance = lz[i + 1] | lz[i + 2] << 8
+      for _ in range((token & MAX_RUN) + MIN_MATCH):
+        frame.append(frame[-distance])
+      i += 3
+    else:
+      frame.extend(lz[i + 1:i + 2 + token])
+      i += 2 + token
+  return frame
+
+
+def delta_encode(base: List[int], frame: List[int]) -> List[int]:
+  """Encodes the XOR delta of a frame from the base as skip and XOR records."""
+  diff = [a ^ b for a, b in zip(base, frame)]
+  # Group changed bytes into spans, bridging short unchanged gaps
+  spans = []
+  for i in (i for i, d in enumerate(diff) if d):
+    if spans and i - spans[-1][1] <= MAX_GAP + 1 and i - spans[-1][0] < 0xff:
+      spans[-1][1] = i
+    else:
+      spans.append([i, i])
+
+  out, cursor = [], 0
+  for start, end in spans:
+    skip = start - cursor
+    while skip > 0xff:
+      out.extend([0xff, 0])
+      skip -= 0xff
+    out.extend([skip, end - start + 1] + diff[start:end + 1])
+    cursor = end + 1
+  return out + [0, 0]
+
+
+def delta_decode(base: List[int], delta: List[int]) -> List[int]:
+  """Mirrors apply_delta() of oled_bongocat.c."""
+  frame, cursor, i = list(base), 0, 0
+  while delta[i] or delta[i + 1]:
+    cursor += delta[i]
+    for d in delta[i + 2:i + 2 + delta[i + 1]]:
+      frame[cursor] ^= d
+      cursor += 1
+    i += 2 + delta[i + 1]
+  return frame
+
+
+def compile_frame(name: str, image: List[int],
+                  base: Optional[List[int]]) -> Frame:
+  """Encodes a frame with every encoding and keeps the smallest.
+
+  Each encoding is decoded again and must match the image.
+
+  Args:
+    name: String, array name of the frame.
+    image: List of frame bytes.
+    base: Base frame of the group, or None for the base itself.
+  Returns:
+    The frame with the size of each encoding and the smallest one.
+  """
+  encoded = {RAW: (list(image), list), LZ: (lz_encode(image), lz_decode),
+             RLE2: (rle2_encode(image), rle2_decode)}
+  rle = rle_encode(image)
+  if rle:
+    encoded[RLE] = (rle, rle_decode)
+  if base:
+    encoded[DELTA] = (delta_encode(base, image),
+                      lambda delta: delta_decode(base, delta))
+  for encoding, (data, decode) in encoded.items():
+    assert decode(data) == image, f'{name} fails {ENCODINGS[encoding]}'
+  best = min(encoded, key=lambda e: len(encoded[e][0]))
+  return Frame(name, image, {e: len(d) + 1 for e, (d, _) in encoded.items()},
+               [best] + encoded[best][0])
+
+
+def write_generated_code(frames: List[Frame], file_name: str) -> None:
+  """Writes the compiled frames as generated C code to `file_name`."""
+  lines = [f'/* Generated OLED frames ({len(frames)} entries):']
+  lines += [f'   {f.name:<11} {ENCODINGS[f.data[0]]:<5} {len(f.data):3} bytes'
+            for f in frames]
+  lines += ['*/', '']
+  lines += [f'#define OLED_FRAME_{e:<5} {i}' for i, e in enumerate(ENCODINGS)]
+  lines += [f'#define OLED_FRAME_SIZE  {FRAME_SIZE}  // {WIDTH}x{HEIGHT}', '']
+  for f in frames:
+    lines.append(textwrap.fill(
+        f'static unsigned char const {f.name}[] PROGMEM = {{' +
+        ', '.join(f'0x{b:02x}' for b in f.data) + '};',
+        width=80, subsequent_indent='    '))
+  with open(file_name, 'wt') as f:
+    f.write('\n'.join(lines) + '\n')
+
+
+def print_report(frames: List[Frame]) -> None:
+  """Prints the size of every encoding of each frame and the totals."""
+  print(f'{"frame":<12}' + ''.join(f'{e:>7}' for e in ENCODINGS) + '  best')
+  for f in frames:
+    print(f'{f.name:<12}' +
+          ''.join(f'{f.sizes.get(e, "-"):>7}' for e in range(len(ENCODINGS))) +
+          f'  {ENCODINGS[f.data[0]]}')
+  total = sum(len(f.data) for f in frames)
+  print(f'Compiled {len(frames)} frames to {total} bytes, from '
+        f'{FRAME_SIZE * len(frames)} bytes raw.')
+
+
+def main(argv):
+  global WIDTH, HEIGHT, FRAME_SIZE
+  parser = argparse.ArgumentParser(description='Compiles OLED frames.')
+  parser.add_argument('-o', '--out',
+                      default=os.path.join(FEATURES, 'bongocat_data.h'))
+  parser.add_argument('--size', default=f'{WIDTH}x{HEIGHT}',
+                      help='Frame width and height, like 128x64.')
+  parser.add_argument('--group', nargs='+', action='append',
+                      help='Base image followed by images of its group.')
+  args = parser.parse_args(argv[1:])
+
+  WIDTH, HEIGHT = map(int, args.size.split('x'))
+  if HEIGHT % 8 or WIDTH * HEIGHT // 8 > 0xffff:
+    print(f'Error: Frames of {args.size} do not fit OLED pages.')
+    sys.exit(1)
+  FRAME_SIZE = WIDTH * HEIGHT // 8
+  groups = args.group or [
+      [os.path.join(FEATURES, 'bongocat', side + f + '.pbm') for f in BONGOCAT]
+      for side in ('', 'left_')]
+
+  frames = []
+  for group in groups:
+    base = None
+    for file_name in group:
+      image = read_image(file_name)
+      name = os.path.splitext(os.path.basename(file_name))[0]
+      frames.append(compile_frame(name, image, base))
+      base = base or image
+
+  write_generated_code(frames, args.out)
+  print_report(frames)
+
+
+if __name__ == '__main__':
+  main(sys.argv)
@@ -0,0 +1,194 @@
+// Copyright @filterpaper
+// SPDX-License-Identifier: GPL-2.0+
+
+/*
+Host benchmark of the bongocat frame decoder in oled_bongocat.c. It is
+compiled against stubs of the QMK OLED buffer API that mirror its bounds
+checks and dirty block flags. Build and run it from the repository root with
+
+$ cc -O2 -o oled_host features/oled_host.c
+$ ./oled_host [-n rounds] [-l]
+
+  -n  Rounds through the ticks of the animation, default 10000
+  -l  Animate the left cat
+
+Every animation tick must leave its full frame, decoded separately from the
+base and delta, in the OLED buffer. It prints the dirty blocks per tick and
+the time per tick of the delta frames, against writing every full frame.
+Host times are only comparable with each other.
+*/
+
+#define _POSIX_C_SOURCE 199309L
+#include <stdbool.h>
+#include <stdint.h>
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+#include <time.h>
+
+// Stubs of the QMK OLED API for a 128x32 display
+#define QMK_KEYBOARD_H <stddef.h>
+#define PROGMEM
+#define pgm_read_byte(p) (*(uint8_t const *)(p))
+#define memcpy_P         memcpy
+#define OLED_TIMEOUT     10000
+#define OLED_MATRIX_SIZE 512
+#define OLED_BLOCK_SIZE  (OLED_MATRIX_SIZE / 16)
+
+typedef enum { OLED_ROTATION_0, OLED_ROTATION_90, OLED_ROTATION_180, OLED_ROTATION_270 } oled_rotation_t;
+
+static uint8_t  oled_buffer[OLED_MATRIX_SIZE];
+static uint8_t *oled_cursor = oled_buffer;
+static uint16_t oled_dirty;
+static bool     keyboard_left;
+
+static void oled_set_cursor(uint8_t col, uint8_t line) { oled_cursor = &oled_buffer[line * 128 + col]; }
+// Writes are not inlined, as the QMK driver is compiled on its own
+__attribute__((noinline)) static void oled_write_raw_byte(char const data, uint16_t index) {
+    if (index > OLED_MATRIX_SIZE - 1) index = OLED_MATRIX_SIZE - 1;
+    if (oled_buffer[index] == (uint8_t)data) return;
+    oled_buffer[index] = data;
+    oled_dirty |= 1 << (index / OLED_BLOCK_SIZE);
+}
+__attribute__((noinline)) static void oled_write_raw(char const *data, uint16_t size) {
+    uint16_t const start = oled_cursor - oled_buffer;
+    if (size + start > OLED_MATRIX_SIZE) size = OLED_MATRIX_SIZE - start;
+    for (uint16_t i = start; i < start + size; ++i) {
+        uint8_t const c = *data++;
+        if (oled_buffer[i] == c) continue;
+        oled_buffer[i] = c;
+        oled_dirty |= 1 << (i / OLED_BLOCK_SIZE);
+    }
+}
+static void oled_off(void) {}
+static bool is_keyboard_master(void) { return true; }
+static bool is_keyboard_left(void) { return keyboard_left; }
+static uint32_t last_matrix_activity_time(void) { return 0; }
+static uint16_t timer_read(void) { return 0; }
+static uint16_t timer_elapsed(uint16_t t) { return t; }
+static uint32_t timer_elapsed32(uint32_t t) { return t; }
+void render_mod_status(void) {}
+
+#include "oled_bongocat.c"
+
+
+// Reference decoder of compiled frames as full images, for checking and
+// timing against full frame writes
+static void decode_full(unsigned char const *frame, unsigned char const *base, uint8_t *out) {
+    uint16_t cursor = 0;
+    switch (*frame++) {
+        case OLED_FRAME_RAW:
+            memcpy(out, frame, OLED_MATRIX_SIZE);
+            break;
+        case OLED_FRAME_RLE:
+            for (uint8_t i = 1; i < frame[0];) {
+                uint8_t const count = frame[i] & 0x7f;
+                if (frame[i] & 0x80) memcpy(out + cursor, frame + i + 1, count), i += 1 + count;
+                else memset(out + cursor, frame[i + 1], count), i += 2;
+                cursor += count;
+            }
+            break;
+        case OLED_FRAME_LZ:
+            while (cursor < OLED_MATRIX_SIZE) {
+                if (*frame & 0x80) {
+                    for (uint8_t n = 0; n < (*frame & 0x7f) + 3; ++n, ++cursor) {
+                        out[cursor] = out[cursor - (frame[1] | frame[2] << 8)];
+                    }
+                    frame += 3;
+                } else {
+                    memcpy(out + cursor, frame + 1, *frame + 1);
+                    cursor += *frame + 1;
+                    frame  += *frame + 2;
+                }
+            }
+            break;
+        case OLED_FRAME_RLE2:
+            for (unsigned char const *end = frame + 2 + (frame[0] | frame[1] << 8), *p = frame + 2; p < end;) {
+                uint8_t const control = *p++;
+                uint16_t      count   = control & 0x3f;
+                if (control & 0x40) count = count << 8 | *p++;
+                if (control & 0x80) memcpy(out + cursor, p, count), p += count;
+                else memset(out + cursor, *p++, count);
+                cursor += count;
+            }
+            break;
+        case OLED_FRAME_DELTA:
+            decode_full(base, NULL, out);
+            for (; frame[0] || frame[1]; frame += 2 + frame[1]) {
+                cursor += frame[0];
+                for (uint8_t n = 0; n < frame[1]; ++n) out[cursor++] ^= frame[2 + n];
+            }
+            break;
+    }
+}
+
+
+static unsigned char const *const *const sequences[][2] = {
+    { idle, tap }, { left_idle, left_tap },
+};
+static unsigned char const *const paw_frames[] = { paws, left_paws };
+static unsigned char const *const bases[] = { idle0, left_idle0 };
+
+// Animation ticks of a typing session, idle to tap to paws and back
+static unsigned char const *tick_frame(uint8_t side, uint32_t tick) {
+    uint32_t const phase = tick % 40;
+    if (phase < 10) return sequences[side][0][phase % IDLE_FRAMES];
+    if (phase < 30) return sequences[side][1][phase & 1];
+    if (phase < 34) return paw_frames[side];
+    return sequences[side][0][phase % IDLE_FRAMES];
+}
+
+static double now_us(void) {
+    struct timespec ts;
+    clock_gettime(CLOCK_MONOTONIC, &ts);
+    return ts.tv_sec * 1e6 + ts.tv_nsec / 1e3;
+}
+
+static int popcount16(uint16_t x) {
+    int n = 0;
+    for (; x; x &= x - 1) ++n;
+    return n;
+}
+
+int main(int argc, char **argv) {
+    uint32_t rounds = 10000;
+    for (int i = 1; i < argc; ++i) {
+        if (!strcmp(argv[i], "-n") && i + 1 < argc) rounds = atoi(argv[++i]);
+        else if (!strcmp(argv[i], "-l")) keyboard_left = true;
+        else {
+            fprintf(stderr, "usage: %s [-n rounds] [-l]\n", argv[0]);
+            return 1;
+        }
+    }
+
+    uint8_t const side = keyboard_left;
+    static uint8_t expected[40][OLED_MATRIX_SIZE];
+    for (uint32_t t = 0; t < 40; ++t) decode_full(tick_frame(side, t), bases[side], expected[t]);
+
+    // Every tick must leave its full frame in the OLED buffer
+    uint32_t dirty_blocks = 0;
+    for (uint32_t t = 0; t < 40; ++t) {
+        oled_dirty = 0;
+        render_frame(tick_frame(side, t));
+        if (memcmp(expected[t], oled_buffer, sizeof(oled_buffer))) {
+            printf("Tick %u decodes differently\n", t);
+            return 1;
+        }
+        if (t) dirty_blocks += popcount16(oled_dirty);
+    }
+
+    double start = now_us();
+    for (uint32_t t = 0; t < rounds * 40; ++t) {
+        oled_set_cursor(0, 0);
+        oled_write_raw((char const *)expected[t % 40], OLED_MATRIX_SIZE);
+    }
+    double const full = (now_us() - start) / (rounds * 40);
+    start = now_us();
+    for (uint32_t t = 0; t < rounds * 40; ++t) render_frame(tick_frame(side, t));
+    double const delta = (now_us() - start) / (rounds * 40);
+
+    printf("%s cat, %.2f of 16 blocks dirty per tick\n", side ? "Left" : "Right", dirty_blocks / 39.0);
+    printf("full   %8.3f us/tick\n", full);
+    printf("delta  %8.3f us/tick\n", delta);
+    return 0;
+}
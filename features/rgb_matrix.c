@@ -2,7 +2,12 @@
 // SPDX-License-Identifier: GPL-2.0+
 
 #include QMK_KEYBOARD_H
-#include <lib/lib8tion/lib8tion.h>
+#ifndef RGB_MATRIX_HOST
+#   include <lib/lib8tion/lib8tion.h>
+#endif
+#ifdef SPLIT_KEYBOARD
+#   include "transactions.h"
+#endif
 
 #define RGB_DPINK   115, 20, 45
 #define RGB_DTEAL   5, 35, 35
@@ -25,46 +30,340 @@ led_config_t g_led_config = { {
 #endif
 
 
+// Effect mode follows the CMK layer. The mode is set only when CMK turns on or
+// off, so momentary layers keep the running effect and its state.
 layer_state_t layer_state_set_user(layer_state_t const state) {
-    rgb_matrix_mode_noeeprom(layer_state_is(CMK) ? CMK_MODE : DEF_MODE);
+    static bool cmk = false;
+    if (cmk != layer_state_cmp(state, CMK)) {
+        cmk = !cmk;
+        rgb_matrix_mode_noeeprom(cmk ? CMK_MODE : DEF_MODE);
+    }
     return state;
 }
 
 
-static RGB hsv_to_rgb_glow(HSV hsv) {
-    // Return glowing RGB values
-    hsv.v = scale8(abs8(sin8(scale16by8(g_rgb_timer, rgb_matrix_config.speed / 8)) - 128) * 2, hsv.v);
-    return hsv_to_rgb(hsv);
+// Steps of the swap hands glow, a half sine cycle of the breathing effect
+#define GLOW_STEPS 32
+
+// Indicator colors, rebuilt when brightness changes
+static struct {
+    bool    built;
+    uint8_t val;
+    RGB     layer[CMB - CMK]; // Layers above CMK
+#ifdef CONVERT_TO_KB2040
+    RGB     mods[16];         // Mod bits of either hand
+#endif
+#ifdef SWAP_HANDS_ENABLE
+    RGB     glow[GLOW_STEPS];
+#endif
+} colors;
+
+static void build_colors(uint8_t const val) {
+    for (uint8_t i = 0; i < CMB - CMK; ++i) {
+        colors.layer[i] = hsv_to_rgb((HSV){i * 80 + 80, 255, val});
+    }
+#ifdef CONVERT_TO_KB2040
+    for (uint8_t i = 0; i < 16; ++i) {
+        colors.mods[i] = hsv_to_rgb((HSV){i * 16, 255, val});
+    }
+#endif
+#ifdef SWAP_HANDS_ENABLE
+    // The glow has its own fixed brightness, it is built once
+    for (uint8_t i = 0; !colors.built && i < GLOW_STEPS; ++i) {
+        HSV hsv = {HSV_SWAP};
+        hsv.v = scale8(abs8(sin8(i * (128 / GLOW_STEPS)) - 128) * 2, hsv.v);
+        colors.glow[i] = hsv_to_rgb(hsv);
+    }
+#endif
+    colors.built = true;
+    colors.val   = val;
+}
+
+
+// Highest layer above CMK or 0, the layer state is compared on every frame
+// because the slave half of a split keyboard receives it without callbacks
+static uint8_t indicator_layer(void) {
+    static layer_state_t layers = (layer_state_t)~0;
+    static uint8_t       layer  = 0;
+    if (layers != layer_state) {
+        layers = layer_state;
+        layer  = get_highest_layer(layer_state);
+        if (layer <= CMK) layer = 0;
+    }
+    return layer;
+}
+
+
+#ifdef CONVERT_TO_KB2040
+// LEDs flagged with any active mod bit, rebuilt only when mods change so the
+// indicator writes those LEDs without testing every LED on every frame
+static struct {
+    uint8_t mods;
+    uint8_t count;
+    uint8_t led[RGB_MATRIX_LED_COUNT];
+} mod_leds;
+
+static void update_mod_leds(uint8_t const mods) {
+    mod_leds.mods  = mods;
+    mod_leds.count = 0;
+    for (uint8_t i = 0; i < RGB_MATRIX_LED_COUNT; ++i) {
+        if (g_led_config.flags[i] & mods) mod_leds.led[mod_leds.count++] = i;
+    }
+}
+#endif
+
+
+// Frame interval of the RGB task in ms, read by QMK as RGB_MATRIX_LED_FLUSH_LIMIT.
+// It is set at the end of each frame from activity, typing and the indicators.
+#define FRAME_BURST    10  // Reactive effects while typing fast
+#define FRAME_FADE     16  // Reactive effects while a hit fades out
+#define FRAME_CALM     33  // Hue drift and other effects during activity
+#define FRAME_IDLE     66  // No input for IDLE_MS
+#define FRAME_STATIC  250  // An indicator covers every LED with a fixed color
+#define IDLE_MS      5000
+#define BURST_PRESSES   3  // Presses within a second that make a burst
+uint8_t rgb_flush_limit = FRAME_FADE;
+
+static bool is_reactive_mode(uint8_t const mode) {
+    switch (mode) {
+#ifdef ENABLE_RGB_MATRIX_CANDY_TAP
+        case RGB_MATRIX_CUSTOM_CANDY_TAP:
+#endif
+#ifdef ENABLE_RGB_MATRIX_CANDY_SPLASH
+        case RGB_MATRIX_CUSTOM_CANDY_SPLASH:
+#endif
+            return true;
+    }
+    return false;
+}
+
+static uint8_t frame_interval(bool const fixed) {
+    if (fixed) return FRAME_STATIC;
+    // Activity is synced, so both halves go idle together
+    if (last_input_activity_elapsed() > IDLE_MS) return FRAME_IDLE;
+    if (!is_reactive_mode(rgb_matrix_get_mode())) return FRAME_CALM;
+
+    // Estimate typing from the hit tracker, which both halves have
+    uint8_t presses = 0;
+    bool    fading  = false;
+#ifdef RGB_MATRIX_KEYREACTIVE_ENABLED
+    uint16_t const fade = 65280 / (qadd8(rgb_matrix_config.speed, 1) + 1);
+    for (uint8_t i = 0; i < g_last_hit_tracker.count; ++i) {
+        if (g_last_hit_tracker.tick[i] < 1000) ++presses;
+        if (g_last_hit_tracker.tick[i] < fade) fading = true;
+    }
+#endif
+    return presses >= BURST_PRESSES ? FRAME_BURST : fading ? FRAME_FADE : FRAME_CALM;
+}
+
+
+#ifdef RGB_GOVERNOR_STATS
+// Frames and scan loops of the last second. Loops that rendered a chunk of
+// a frame are timed apart from the others to estimate the CPU share of RGB.
+static struct {
+    uint16_t frames;
+    uint16_t loops[2];
+    uint32_t us[2];
+    bool     rendered;
+} stats;
+
+bool rgb_matrix_indicators_advanced_user(uint8_t led_min, uint8_t led_max) {
+    stats.rendered = true;
+    return false;
+}
+
+static void governor_stats(void) {
+    static uint32_t second = 0;
+#   ifdef PROTOCOL_CHIBIOS
+    static uint32_t loop_start = 0;
+    uint32_t const now = TIME_I2US(chVTGetSystemTimeX());
+    stats.us[stats.rendered] += now - loop_start;
+    loop_start = now;
+#   endif
+    ++stats.loops[stats.rendered];
+    stats.rendered = false;
+    if (timer_elapsed32(second) < 1000) return;
+
+    second = timer_read32();
+    uint32_t const loops = stats.loops[0] + stats.loops[1];
+    uint32_t cpu = 0;
+    if (stats.loops[0] && stats.loops[1] && stats.us[1] / stats.loops[1] > stats.us[0] / stats.loops[0]) {
+        cpu = (stats.us[1] / stats.loops[1] - stats.us[0] / stats.loops[0]) * stats.loops[1] / 10000;
+    }
+    uprintf("rgb %u fps, %u ms frames, %lu loops/s, %lu%% cpu\n",
+            stats.frames, rgb_flush_limit, (unsigned long)loops, (unsigned long)cpu);
+    memset(&stats, 0, sizeof(stats));
+}
+#endif
+
+
+#ifdef SPLIT_KEYBOARD
+// Both halves render effects locally from the synced RGB timer. The master
+// sends the slave a compact record of the effect seed and the new key presses
+// of both halves, in place of mirroring the matrix on every scan.
+#define RGB_EVENT_KEYS   6
+#define RGB_EVENT_QUEUE 16 // Power of two
+#define RGB_EVENT_DEDUP 50 // Hits of a LED in this many ms are one press
+_Static_assert(MATRIX_ROWS <= 16 && MATRIX_COLS <= 16, "Key events pack rows and columns in nibbles");
+_Static_assert(!(RGB_EVENT_QUEUE & (RGB_EVENT_QUEUE - 1)), "Queue indices wrap at a power of two");
+
+extern uint8_t candy_seed;
+
+typedef struct {
+    uint8_t seed;
+    uint8_t count;
+    uint8_t keys[RGB_EVENT_KEYS]; // Row in the high and column in the low nibble
+} rgb_event_t;
+
+// Events received by the slave. The transport callback may run in the middle
+// of a render, so it only queues them for rgb_event_replay(). The callback
+// writes head and the replay writes tail.
+static struct {
+    volatile uint8_t keys[RGB_EVENT_QUEUE];
+    volatile uint8_t head, tail;
+    volatile uint8_t seed;
+} received;
+
+static void rgb_event_handler(uint8_t in_len, void const *in_data, uint8_t out_len, void *out_data) {
+    rgb_event_t const *event = in_data;
+    if (in_len < 2 || in_len < 2 + event->count) return;
+    received.seed = event->seed;
+    for (uint8_t i = 0; i < event->count && (uint8_t)(received.head - received.tail) < RGB_EVENT_QUEUE; ++i) {
+        received.keys[received.head & (RGB_EVENT_QUEUE - 1)] = event->keys[i];
+        ++received.head;
+    }
+}
+
+void keyboard_post_init_user(void) {
+    transaction_register_rpc(RGB_EVENT_SYNC, rgb_event_handler);
+}
+
+#   if defined(RGB_MATRIX_KEYREACTIVE_ENABLED) && !defined(SPLIT_TRANSPORT_MIRROR)
+// Whether the slave already has a hit of the key, from its own matrix scan
+static bool is_recent_hit(uint8_t const row, uint8_t const col) {
+    uint8_t const led = g_led_config.matrix_co[row][col];
+    for (uint8_t i = 0; i < g_last_hit_tracker.count; ++i) {
+        if (g_last_hit_tracker.index[i] == led && g_last_hit_tracker.tick[i] < RGB_EVENT_DEDUP) return true;
+    }
+    return false;
+}
+#   endif
+
+// Replays events queued on the slave between renders
+static void rgb_event_replay(void) {
+    candy_seed = received.seed;
+    for (uint8_t tail = received.tail; tail != received.head; received.tail = ++tail) {
+#   if defined(RGB_MATRIX_KEYREACTIVE_ENABLED) && !defined(SPLIT_TRANSPORT_MIRROR)
+        uint8_t const key = received.keys[tail & (RGB_EVENT_QUEUE - 1)];
+        if (!is_recent_hit(key >> 4, key & 15)) process_rgb_matrix(key >> 4, key & 15, true);
+#   endif
+    }
+}
+
+// Sends events of the master when there are new key presses or a new seed,
+// unsent events and presses that did not fit the event are retried on the
+// next scan
+static void rgb_event_sync(void) {
+    static rgb_event_t event;
+    static uint8_t     sent_seed = 0;
+    if (!is_keyboard_master()) {
+        rgb_event_replay();
+        return;
+    }
+
+#   if defined(RGB_MATRIX_KEYREACTIVE_ENABLED) && !defined(SPLIT_TRANSPORT_MIRROR)
+    // Presses of both halves are sent, whether or not the slave core feeds
+    // its own keys to process_rgb_matrix, and the slave drops duplicates
+    static matrix_row_t rows[MATRIX_ROWS];
+    for (uint8_t row = 0; row < MATRIX_ROWS; ++row) {
+        matrix_row_t const state   = matrix_get_row(row);
+        matrix_row_t const pressed = state & ~rows[row];
+        // Released keys are cleared, new presses only once they are queued
+        rows[row] &= state;
+        for (uint8_t col = 0; pressed >> col && event.count < RGB_EVENT_KEYS; ++col) {
+            if (pressed >> col & 1) {
+                event.keys[event.count++] = row << 4 | col;
+                rows[row] |= (matrix_row_t)1 << col;
+            }
+        }
+    }
+#   endif
+
+    if (event.count || sent_seed != candy_seed) {
+        event.seed = candy_seed;
+        if (transaction_rpc_send(RGB_EVENT_SYNC, 2 + event.count, &event)) {
+            sent_seed   = event.seed;
+            event.count = 0;
+        }
+    }
+}
+#endif
+
+
+// Render the next frame at once when an input changes, the slave half
+// sees layer and LED state change without callbacks
+void housekeeping_task_user(void) {
+    static layer_state_t layers = 0;
+    static uint32_t      input  = 0;
+    static uint8_t       leds   = 0, mods = 0;
+    if (layers != layer_state || leds != host_keyboard_led_state().raw ||
+        mods != get_mods() || input != last_input_activity_time()) {
+        layers = layer_state;
+        leds   = host_keyboard_led_state().raw;
+        mods   = get_mods();
+        input  = last_input_activity_time();
+        rgb_flush_limit = 0;
+    }
+#ifdef SPLIT_KEYBOARD
+    rgb_event_sync();
+#endif
+#ifdef RGB_GOVERNOR_STATS
+    governor_stats();
+#endif
 }
 
 
 bool rgb_matrix_indicators_user(void) {
-    if (host_keyboard_led_state().caps_lock) {
-        rgb_matrix_set_color_all(RGB_CAPS);
+#ifdef RGB_GOVERNOR_STATS
+    ++stats.frames;
+#endif
+    if (!colors.built || colors.val != rgb_matrix_config.hsv.v) {
+        build_colors(rgb_matrix_config.hsv.v);
+    }
+
+    // Layer color covers every other indicator
+    uint8_t const layer = indicator_layer();
+    if (layer) {
+        RGB const rgb = colors.layer[layer - CMK - 1];
+        rgb_matrix_set_color_all(rgb.r, rgb.g, rgb.b);
+        rgb_flush_limit = frame_interval(true);
+        return false;
     }
 
+    bool fixed = false;
 #ifdef SWAP_HANDS_ENABLE
     if (is_swap_hands_on()) {
-        RGB const rgb = hsv_to_rgb_glow((HSV){HSV_SWAP});
+        uint8_t const phase = scale16by8(g_rgb_timer, rgb_matrix_config.speed / 8);
+        RGB const rgb = colors.glow[(phase & 127) / (128 / GLOW_STEPS)];
         rgb_matrix_set_color_all(rgb.r, rgb.g, rgb.b);
-    }
+    } else
 #endif
+    if (host_keyboard_led_state().caps_lock) {
+        rgb_matrix_set_color_all(RGB_CAPS);
+        fixed = true;
+    }
 
 #ifdef CONVERT_TO_KB2040
-    if (get_mods()) {
-        uint8_t const mods = get_mods();
-        RGB const rgb = hsv_to_rgb((HSV){(mods >> 4 | mods) * 16, 255, rgb_matrix_config.hsv.v});
-        for (uint8_t i = 0; i < RGB_MATRIX_LED_COUNT; ++i) {
-            if (g_led_config.flags[i] & mods) rgb_matrix_set_color(i, rgb.r, rgb.g, rgb.b);
+    uint8_t const mods = get_mods();
+    if (mods != mod_leds.mods) update_mod_leds(mods);
+    if (mods) {
+        RGB const rgb = colors.mods[(mods >> 4 | mods) & 15];
+        for (uint8_t i = 0; i < mod_leds.count; ++i) {
+            rgb_matrix_set_color(mod_leds.led[i], rgb.r, rgb.g, rgb.b);
         }
     }
 #endif
 
-    if (get_highest_layer(layer_state) > CMK) {
-        uint8_t const layer = get_highest_layer(layer_state);
-        RGB const rgb = hsv_to_rgb((HSV){(layer - 1) * 80, 255, rgb_matrix_config.hsv.v});
-        rgb_matrix_set_color_all(rgb.r, rgb.g, rgb.b);
-    }
-
+    rgb_flush_limit = frame_interval(fixed);
     return false;
 }
\ No newline at end of file
@@ -0,0 +1,389 @@
+// Copyright @filterpaper
+// SPDX-License-Identifier: GPL-2.0+
+
+/*
+Host renderer and frame-time benchmark for the custom RGB matrix effects in
+rgb_matrix_user.inc and the indicators of rgb_matrix.c. They are compiled
+against stubs of the QMK RGB matrix API with the 42 key LEDs of a Corne, and
+driven by simulated typing in bursts and pauses. Frames are rendered at the
+interval chosen by the frame-rate governor of rgb_matrix.c. Build and run it
+from the repository root with
+
+$ cc -O2 -o rgb_host features/rgb_matrix_host.c
+$ ./rgb_host [-s seconds] [-e effect] [-l layer] [-c] [-w] [-a] [-p prefix]
+
+  -s  Simulated seconds per effect, default 10
+  -e  Effect to run, CANDY_TAP, CANDY_SPLASH or CANDY_RAIN, default all
+  -l  Active layer for the layer indicator
+  -c  Caps lock indicator on
+  -w  Swap hands indicator on
+  -a  Animate frames in the terminal with ANSI colors at real speed
+  -p  Write a PPM filmstrip of all frames to <prefix>_<effect>.ppm
+
+Every effect prints its frame count, effective frame rate, host time per
+frame and a checksum of all frames. Host times are only comparable with each
+other, the checksum tells whether an optimization changed the output.
+*/
+
+#define _POSIX_C_SOURCE 199309L
+#include <stdbool.h>
+#include <stdint.h>
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+#include <time.h>
+
+// Stubs of the QMK RGB matrix API
+#define RGB_MATRIX_HOST
+#define RGB_MATRIX_ENABLE
+#define SWAP_HANDS_ENABLE
+#define ENABLE_RGB_MATRIX_CANDY_SPLASH
+#define RGB_MATRIX_CUSTOM_EFFECT_IMPLS
+#define RGB_MATRIX_KEYREACTIVE_ENABLED
+#define RGB_MATRIX_EFFECT(name)
+#define QMK_KEYBOARD_H <stddef.h>
+#define QK_USER 0x7E40
+
+#define RGB_MATRIX_LED_COUNT         42
+#define RGB_MATRIX_LED_PROCESS_LIMIT ((RGB_MATRIX_LED_COUNT + 4) / 5)
+#define LED_HITS_TO_REMEMBER         8
+#define LED_FLAG_KEYLIGHT            0x04
+#define LED_FLAG_ALL                 0xFF
+#define HAS_ANY_FLAGS(bits, flags)   (((bits) & (flags)) != 0x00)
+#define HSV_TEAL                     128, 255, 128
+
+#define RGB_MATRIX_USE_LIMITS(min, max) \
+    uint8_t min = RGB_MATRIX_LED_PROCESS_LIMIT * params->iter; \
+    uint8_t max = min + RGB_MATRIX_LED_PROCESS_LIMIT; \
+    if (max > RGB_MATRIX_LED_COUNT) max = RGB_MATRIX_LED_COUNT;
+#define RGB_MATRIX_TEST_LED_FLAGS() \
+    if (!HAS_ANY_FLAGS(g_led_config.flags[i], params->flags)) continue
+
+typedef uint8_t layer_state_t;
+typedef struct { uint8_t h, s, v; } HSV;
+typedef struct { uint8_t r, g, b; } RGB;
+typedef struct { uint8_t x, y; } led_point_t;
+typedef union {
+    uint8_t raw;
+    struct { bool caps_lock : 1; };
+} led_t;
+typedef struct {
+    led_point_t point[RGB_MATRIX_LED_COUNT];
+    uint8_t     flags[RGB_MATRIX_LED_COUNT];
+} led_config_t;
+typedef struct {
+    uint8_t iter;
+    uint8_t flags;
+    bool    init;
+} effect_params_t;
+typedef struct {
+    uint8_t  count;
+    uint8_t  x[LED_HITS_TO_REMEMBER];
+    uint8_t  y[LED_HITS_TO_REMEMBER];
+    uint8_t  index[LED_HITS_TO_REMEMBER];
+    uint16_t tick[LED_HITS_TO_REMEMBER];
+} last_hit_t;
+
+enum { RGB_MATRIX_CUSTOM_CANDY_TAP, RGB_MATRIX_CUSTOM_CANDY_SPLASH, RGB_MATRIX_CUSTOM_CANDY_RAIN };
+
+static struct {
+    HSV     hsv;
+    uint8_t speed;
+} rgb_matrix_config = { {0, 255, 255}, 128 };
+
+static uint32_t      g_rgb_timer;
+static last_hit_t    g_last_hit_tracker;
+static layer_state_t layer_state;
+static uint32_t      input_time;
+static uint8_t       current_mode;
+static bool          caps_lock, swap_hands;
+static RGB           leds[RGB_MATRIX_LED_COUNT];
+
+// Corne key LEDs in rows of 6 per hand, then 3 thumbs per hand, with the
+// grid cells they are drawn in
+static led_config_t g_led_config;
+static uint8_t      led_cell[RGB_MATRIX_LED_COUNT][2];
+#define GRID_COLS 14
+#define GRID_ROWS 4
+
+static void led_layout(void) {
+    uint8_t i = 0;
+    for (uint8_t row = 0; row < 3; ++row) {
+        for (uint8_t col = 0; col < 12; ++col, ++i) {
+            uint8_t const cell = col < 6 ? col : col + 2;
+            g_led_config.point[i] = (led_point_t){cell * 224 / (GRID_COLS - 1), row * 21};
+            led_cell[i][0] = cell;
+            led_cell[i][1] = row;
+        }
+    }
+    for (uint8_t k = 0; k < 6; ++k, ++i) {
+        uint8_t const cell = k < 3 ? k + 3 : k + 5;
+        g_led_config.point[i] = (led_point_t){cell * 224 / (GRID_COLS - 1), 64};
+        led_cell[i][0] = cell;
+        led_cell[i][1] = 3;
+    }
+    memset(g_led_config.flags, LED_FLAG_KEYLIGHT, sizeof(g_led_config.flags));
+}
+
+// lib8tion and color functions, as in QMK
+static uint8_t scale8(uint8_t i, uint8_t scale) { return ((uint16_t)i * (1 + (uint16_t)scale)) >> 8; }
+static uint16_t scale16by8(uint16_t i, uint8_t scale) { return ((uint32_t)i * (1 + (uint32_t)scale)) >> 8; }
+static uint8_t qadd8(uint8_t i, uint8_t j) { return i + j > 255 ? 255 : i + j; }
+static uint8_t abs8(int8_t i) { return i < 0 ? -i : i; }
+
+static uint8_t sin8(uint8_t theta) {
+    static uint8_t const b_m16_interleave[] = {0, 49, 49, 41, 90, 27, 117, 10};
+    uint8_t offset = theta;
+    if (theta & 0x40) offset = 255 - offset;
+    offset &= 0x3F;
+    uint8_t secoffset = offset & 0x0F;
+    if (theta & 0x40) ++secoffset;
+    uint8_t const *p   = b_m16_interleave + (offset >> 4) * 2;
+    int8_t         y   = ((p[1] * secoffset) >> 4) + p[0];
+    if (theta & 0x80) y = -y;
+    return y + 128;
+}
+
+static uint8_t sqrt16(uint16_t x) {
+    if (x <= 1) return x;
+    uint8_t low = 1, hi = x > 7904 ? 255 : (x >> 5) + 8;
+    do {
+        uint16_t const mid = (low + hi) >> 1;
+        if (mid * mid > x) hi = mid - 1; else low = mid + 1;
+    } while (hi >= low);
+    return low - 1;
+}
+
+static RGB hsv_to_rgb(HSV hsv) {
+    if (hsv.s == 0) return (RGB){hsv.v, hsv.v, hsv.v};
+    uint16_t const h = hsv.h, s = hsv.s, v = hsv.v;
+    uint8_t const region    = h * 6 / 255;
+    uint8_t const remainder = (h * 2 - region * 85) * 3;
+    uint8_t const p = (v * (255 - s)) >> 8;
+    uint8_t const q = (v * (255 - ((s * remainder) >> 8))) >> 8;
+    uint8_t const t = (v * (255 - ((s * (255 - remainder)) >> 8))) >> 8;
+    switch (region) {
+        case 6:
+        case 0: return (RGB){v, t, p};
+        case 1: return (RGB){q, v, p};
+        case 2: return (RGB){p, v, t};
+        case 3: return (RGB){p, q, v};
+        case 4: return (RGB){t, p, v};
+        default: return (RGB){v, p, q};
+    }
+}
+#define rgb_matrix_hsv_to_rgb hsv_to_rgb
+
+// QMK core functions used by the effects and indicators
+static uint16_t timer_read(void) { return g_rgb_timer; }
+static void rgb_matrix_set_color(int index, uint8_t r, uint8_t g, uint8_t b) { leds[index] = (RGB){r, g, b}; }
+static void rgb_matrix_set_color_all(uint8_t r, uint8_t g, uint8_t b) {
+    for (uint8_t i = 0; i < RGB_MATRIX_LED_COUNT; ++i) rgb_matrix_set_color(i, r, g, b);
+}
+static bool rgb_matrix_check_finished_leds(uint8_t led_max) { return led_max < RGB_MATRIX_LED_COUNT; }
+static void rgb_matrix_mode_noeeprom(uint8_t mode) { (void)mode; }
+static bool layer_state_cmp(layer_state_t state, uint8_t layer) { return state >> layer & 1; }
+static uint8_t get_highest_layer(layer_state_t state) {
+    uint8_t layer = 0;
+    while (state >>= 1) ++layer;
+    return layer;
+}
+static led_t host_keyboard_led_state(void) { return (led_t){.caps_lock = caps_lock}; }
+static uint8_t get_mods(void) { return 0; }
+static uint8_t rgb_matrix_get_mode(void) { return current_mode; }
+static uint32_t last_input_activity_time(void) { return input_time; }
+static uint32_t last_input_activity_elapsed(void) { return g_rgb_timer - input_time; }
+static bool is_swap_hands_on(void) { return swap_hands; }
+static bool is_keyboard_master(void) { return true; }
+
+#include "../config.h"
+#include "rgb_matrix_user.inc"
+#include "rgb_matrix.c"
+
+
+// Simulated typing in bursts of 1 to 5 s with a key press every 60 to 250 ms
+// on a random key LED, followed by pauses of up to 10 s
+static uint32_t lcg = 1, burst_end = 0;
+static uint32_t random_u32(void) { return lcg = lcg * 1664525 + 1013904223; }
+
+static void press_key(void) {
+    uint8_t const index = (random_u32() >> 8) % RGB_MATRIX_LED_COUNT;
+    if (g_last_hit_tracker.count == LED_HITS_TO_REMEMBER) {
+        memmove(&g_last_hit_tracker.x[0], &g_last_hit_tracker.x[1], LED_HITS_TO_REMEMBER - 1);
+        memmove(&g_last_hit_tracker.y[0], &g_last_hit_tracker.y[1], LED_HITS_TO_REMEMBER - 1);
+        memmove(&g_last_hit_tracker.index[0], &g_last_hit_tracker.index[1], LED_HITS_TO_REMEMBER - 1);
+        memmove(&g_last_hit_tracker.tick[0], &g_last_hit_tracker.tick[1], (LED_HITS_TO_REMEMBER - 1) * sizeof(uint16_t));
+        --g_last_hit_tracker.count;
+    }
+    uint8_t const n = g_last_hit_tracker.count++;
+    g_last_hit_tracker.x[n]     = g_led_config.point[index].x;
+    g_last_hit_tracker.y[n]     = g_led_config.point[index].y;
+    g_last_hit_tracker.index[n] = index;
+    g_last_hit_tracker.tick[n]  = 0;
+    input_time = g_rgb_timer;
+}
+
+static uint32_t next_key(void) {
+    if (g_rgb_timer < burst_end) return g_rgb_timer + 60 + random_u32() % 190;
+    uint32_t const pause = random_u32() % 10000;
+    burst_end = g_rgb_timer + pause + 1000 + random_u32() % 4000;
+    return g_rgb_timer + pause;
+}
+
+static void advance_time(uint16_t ms) {
+    g_rgb_timer += ms;
+    for (uint8_t i = 0; i < g_last_hit_tracker.count; ++i) {
+        uint32_t const tick = g_last_hit_tracker.tick[i] + ms;
+        g_last_hit_tracker.tick[i] = tick < UINT16_MAX ? tick : UINT16_MAX;
+    }
+}
+
+
+// Frame output
+static void print_ansi(void) {
+    static RGB grid[GRID_ROWS][GRID_COLS];
+    memset(grid, 0, sizeof(grid));
+    for (uint8_t i = 0; i < RGB_MATRIX_LED_COUNT; ++i) grid[led_cell[i][1]][led_cell[i][0]] = leds[i];
+    printf("\x1b[H");
+    for (uint8_t row = 0; row < GRID_ROWS; ++row) {
+        for (uint8_t col = 0; col < GRID_COLS; ++col) {
+            RGB const c = grid[row][col];
+            printf("\x1b[48;2;%u;%u;%um    ", c.r, c.g, c.b);
+        }
+        printf("\x1b[0m\n\n");
+    }
+    fflush(stdout);
+}
+
+#define CELL_PX 6
+#define FRAME_PX (GRID_ROWS * CELL_PX + 2)
+
+static void write_ppm_frame(FILE *f) {
+    static uint8_t row_px[GRID_COLS * CELL_PX][3];
+    for (uint8_t row = 0; row < GRID_ROWS; ++row) {
+        memset(row_px, 0, sizeof(row_px));
+        for (uint8_t i = 0; i < RGB_MATRIX_LED_COUNT; ++i) {
+            if (led_cell[i][1] != row) continue;
+            for (uint8_t x = 1; x < CELL_PX; ++x) {
+                uint8_t *px = row_px[led_cell[i][0] * CELL_PX + x];
+                px[0] = leds[i].r, px[1] = leds[i].g, px[2] = leds[i].b;
+            }
+        }
+        for (uint8_t y = 0; y < CELL_PX; ++y) {
+            fwrite(y ? row_px : (void *)memset(row_px, 0, sizeof(row_px)), sizeof(row_px), 1, f);
+        }
+    }
+    memset(row_px, 0, sizeof(row_px));
+    fwrite(row_px, sizeof(row_px), 1, f);
+    fwrite(row_px, sizeof(row_px), 1, f);
+}
+
+
+typedef bool (*effect_f)(effect_params_t *params);
+static struct {
+    char const *name;
+    effect_f    effect;
+    uint8_t     mode;
+} const effects[] = {
+    { "CANDY_TAP",    CANDY_TAP,    RGB_MATRIX_CUSTOM_CANDY_TAP    },
+    { "CANDY_SPLASH", CANDY_SPLASH, RGB_MATRIX_CUSTOM_CANDY_SPLASH },
+    { "CANDY_RAIN",   CANDY_RAIN,   RGB_MATRIX_CUSTOM_CANDY_RAIN   },
+};
+
+static double now_us(void) {
+    struct timespec ts;
+    clock_gettime(CLOCK_MONOTONIC, &ts);
+    return ts.tv_sec * 1e6 + ts.tv_nsec / 1e3;
+}
+
+static void run_effect(effect_f effect, char const *name, uint32_t seconds, bool animate, char const *prefix) {
+    // The frame count is known at the end, it is padded in the PPM header
+    FILE *ppm = NULL;
+    if (prefix) {
+        char path[256];
+        snprintf(path, sizeof(path), "%s_%s.ppm", prefix, name);
+        if (!(ppm = fopen(path, "wb"))) {
+            perror(path);
+            exit(1);
+        }
+        fprintf(ppm, "P6\n%d %10lu\n255\n", GRID_COLS * CELL_PX, 0ul);
+    }
+
+    // Same keystrokes and time base for every effect
+    memset(leds, 0, sizeof(leds));
+    memset(&g_last_hit_tracker, 0, sizeof(g_last_hit_tracker));
+    lcg = 1, burst_end = 0, g_rgb_timer = 0, input_time = 0;
+    rgb_flush_limit = 0;
+    uint32_t next_press = next_key();
+    uint32_t frames = 0, last_frame = 0;
+    uint64_t checksum = 14695981039346656037ull;
+    double   elapsed  = 0;
+    effect_params_t params = { .flags = LED_FLAG_ALL, .init = true };
+
+    // Step the scan loop by 1 ms, a frame starts when its interval is up
+    for (; g_rgb_timer < seconds * 1000; advance_time(1)) {
+        if (g_rgb_timer >= next_press) {
+            press_key();
+            next_press = next_key();
+        }
+        housekeeping_task_user();
+        if (frames && g_rgb_timer - last_frame < rgb_flush_limit) continue;
+
+        // Render the frame in chunks as QMK does, then the indicators
+        double const start = now_us();
+        for (params.iter = 0; effect(&params); ++params.iter) params.init = false;
+        params.init = false;
+        rgb_matrix_indicators_user();
+        elapsed += now_us() - start;
+
+        for (uint8_t i = 0; i < RGB_MATRIX_LED_COUNT; ++i) {
+            checksum = (checksum ^ (leds[i].r << 16 | leds[i].g << 8 | leds[i].b)) * 1099511628211ull;
+        }
+        if (ppm) write_ppm_frame(ppm);
+        if (animate) {
+            print_ansi();
+            struct timespec const ts = { 0, (g_rgb_timer - last_frame) * 1000000L };
+            nanosleep(&ts, NULL);
+        }
+        last_frame = g_rgb_timer;
+        ++frames;
+    }
+    if (ppm) {
+        rewind(ppm);
+        fprintf(ppm, "P6\n%d %10lu\n255\n", GRID_COLS * CELL_PX, (unsigned long)frames * FRAME_PX);
+        fclose(ppm);
+    }
+    printf("%-12s %6lu frames %5.1f fps %8.3f us/frame  checksum %016llx\n", name, (unsigned long)frames,
+           frames * 1000.0 / g_rgb_timer, elapsed / frames, (unsigned long long)checksum);
+}
+
+int main(int argc, char **argv) {
+    uint32_t    seconds = 10;
+    char const *only    = NULL;
+    char const *prefix  = NULL;
+    bool        animate = false;
+
+    for (int i = 1; i < argc; ++i) {
+        if      (!strcmp(argv[i], "-s") && i + 1 < argc) seconds = atoi(argv[++i]);
+        else if (!strcmp(argv[i], "-e") && i + 1 < argc) only = argv[++i];
+        else if (!strcmp(argv[i], "-l") && i + 1 < argc) layer_state = 1 << atoi(argv[++i]);
+        else if (!strcmp(argv[i], "-p") && i + 1 < argc) prefix = argv[++i];
+        else if (!strcmp(argv[i], "-c")) caps_lock = true;
+        else if (!strcmp(argv[i], "-w")) swap_hands = true;
+        else if (!strcmp(argv[i], "-a")) animate = true;
+        else {
+            fprintf(stderr, "usage: %s [-s seconds] [-e effect] [-l layer] [-c] [-w] [-a] [-p prefix]\n", argv[0]);
+            return 1;
+        }
+    }
+
+    led_layout();
+    if (animate) printf("\x1b[2J");
+    for (size_t i = 0; i < sizeof(effects) / sizeof(effects[0]); ++i) {
+        if (!only || !strcmp(only, effects[i].name)) {
+            current_mode = effects[i].mode;
+            run_effect(effects[i].effect, effects[i].name, seconds, animate, prefix);
+        }
+    }
+    return 0;
+}
@@ -37,7 +37,7 @@
 #define SA_DN S(A(KC_DOWN))
 
 // Layers
-enum layers { BSE, CMK, NUM, SYM, FNC };
+enum layers { BSE, CMK, NUM, SYM, FNC, CMB };
 
 // Thumb keys
 #define SYM_TAB LT(SYM,KC_TAB)
@@ -45,6 +45,43 @@ enum layers { BSE, CMK, NUM, SYM, FNC };
 #define SFT_SPC RSFT_T(KC_SPC)
 #define NUM_BSP LT(NUM,KC_BSPC)
 
+// Combo key positions, numbered in layout order
+#define POS(n) (QK_USER + (n))
+#define P_L01 POS(0)
+#define P_L02 POS(1)
+#define P_L03 POS(2)
+#define P_L04 POS(3)
+#define P_L05 POS(4)
+#define P_R01 POS(5)
+#define P_R02 POS(6)
+#define P_R03 POS(7)
+#define P_R04 POS(8)
+#define P_R05 POS(9)
+#define P_L06 POS(10)
+#define P_L07 POS(11)
+#define P_L08 POS(12)
+#define P_L09 POS(13)
+#define P_L10 POS(14)
+#define P_R06 POS(15)
+#define P_R07 POS(16)
+#define P_R08 POS(17)
+#define P_R09 POS(18)
+#define P_R10 POS(19)
+#define P_L11 POS(20)
+#define P_L12 POS(21)
+#define P_L13 POS(22)
+#define P_L14 POS(23)
+#define P_L15 POS(24)
+#define P_R11 POS(25)
+#define P_R12 POS(26)
+#define P_R13 POS(27)
+#define P_R14 POS(28)
+#define P_R15 POS(29)
+#define P_L16 POS(30)
+#define P_L17 POS(31)
+#define P_R16 POS(32)
+#define P_R17 POS(33)
+
 // Default 3x5_2 split layout
 #define _BASE \
     KC_Q,    KC_W,    KC_E,    KC_R,    KC_T,        KC_Y,    KC_U,    KC_I,    KC_O,    KC_P,    \
@@ -122,6 +159,15 @@ enum layers { BSE, CMK, NUM, SYM, FNC };
                               ╰────────┴────────╯   ╰────────┴────────╯*/
 
 
+#define _POSN \
+    P_L01,   P_L02,   P_L03,   P_L04,   P_L05,       P_R01,   P_R02,   P_R03,   P_R04,   P_R05,   \
+    P_L06,   P_L07,   P_L08,   P_L09,   P_L10,       P_R06,   P_R07,   P_R08,   P_R09,   P_R10,   \
+    P_L11,   P_L12,   P_L13,   P_L14,   P_L15,       P_R11,   P_R12,   P_R13,   P_R14,   P_R15,   \
+                               P_L16,   P_L17,       P_R16,   P_R17
+ /* Combo layer that is never active. COMBO_ONLY_FROM_LAYER reads combo keys
+    from it, so combos match physical positions on every layer and board. */
+
+
 // Mod-tap wrapper
 #define HRM(k) HR_MODTAP(k)
 #define HR_MODTAP( \
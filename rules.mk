@@ -8,12 +8,18 @@ SPACE_CADET_ENABLE = no
 LTO_ENABLE = yes
 COMBO_ENABLE = yes
 SWAP_HANDS_ENABLE = yes
+CHORD_ENABLE = yes
 
 MAKECMDGOALS = uf2-split-$(SPLIT)
 VPATH += $(USER_PATH)/features
 INTROSPECTION_KEYMAP_C = NemockZans.c
 SRC += autocorrect.c
 
+ifeq ($(strip $(CHORD_ENABLE)), yes)
+    OPT_DEFS += -DCHORD_ENABLE
+    SRC += chords.c
+endif
+
 ifeq ($(strip $(RGB_MATRIX_ENABLE)), yes)
     RGB_MATRIX_CUSTOM_USER = yes
     SRC += rgb_matrix.c